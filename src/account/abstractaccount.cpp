@@ -5,14 +5,26 @@
 #include "account/abstractaccount.h"
 
 #include "account/accountmanager.h"
+#include "account/prefetchcache.h"
 #include "account/relationship.h"
+#include "account/relationshipcache.h"
+#include "account/statusindex.h"
 #include "network/networkcontroller.h"
+#include "timeline/accountmodel.h"
+#include "timeline/threadmodel.h"
 #include "tokodon_debug.h"
 #include "utils/messagefiltercontainer.h"
 #include "utils/navigation.h"
 
 #include <KLocalizedString>
 
+#include <QDir>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+#include <optional>
+
 using namespace Qt::Literals::StringLiterals;
 
 AbstractAccount::AbstractAccount(QObject *parent, const QString &instanceUri)
@@ -88,6 +100,11 @@ size_t AbstractAccount::charactersReservedPerUrl() const
     return m_charactersReservedPerUrl;
 }
 
+AbstractAccount::MediaAttachmentLimits AbstractAccount::mediaAttachmentLimits() const
+{
+    return m_mediaAttachmentLimits;
+}
+
 QString AbstractAccount::instanceName() const
 {
     return m_instance_name;
@@ -220,22 +237,83 @@ Identity *AbstractAccount::identity()
     return m_identity.get();
 }
 
-std::shared_ptr<Identity> AbstractAccount::identityLookup(const QString &accountId, const QJsonObject &doc)
+std::shared_ptr<Identity> AbstractAccount::identityLookup(const QString &accountId, const QJsonObject &doc, bool force)
 {
     if (m_identity && m_identity->id() == accountId) {
+        if (force && !doc.isEmpty()) {
+            m_identity->fromSourceData(doc);
+        }
         return m_identity;
     }
-    auto id = m_identityCache[accountId];
-    if (id && id->id() == accountId) {
-        return id;
+
+    if (auto identity = m_identityCache.find(accountId)) {
+        // Whatever we were just given is newer, but don't parse the same author over and over while loading a page of posts
+        if (!doc.isEmpty() && (m_identityCache.refreshDue(accountId) || force)) {
+            identity->fromSourceData(doc);
+        }
+        return identity;
     }
 
-    id = std::make_shared<Identity>();
-    id->reparentIdentity(this);
-    id->fromSourceData(doc);
-    m_identityCache[accountId] = id;
+    auto identity = std::make_shared<Identity>();
+    identity->reparentIdentity(this);
+    identity->fromSourceData(doc);
+
+    // Without any data this is only a placeholder, and shouldn't hide the real identity later
+    if (identity->id() == accountId) {
+        m_identityCache.insert(accountId, identity);
+    }
+
+    return identity;
+}
+
+PrefetchCache *AbstractAccount::prefetchCache()
+{
+    if (!m_prefetchCache) {
+        m_prefetchCache = new PrefetchCache(this);
+    }
+    return m_prefetchCache;
+}
+
+void AbstractAccount::prefetchThread(const QString &postId)
+{
+    ThreadModel::prefetch(this, postId);
+}
 
-    return m_identityCache[accountId];
+void AbstractAccount::prefetchProfile(const QString &accountId)
+{
+    AccountModel::prefetch(this, accountId);
+}
+
+StatusIndex *AbstractAccount::statusIndex()
+{
+    if (!m_statusIndex) {
+        m_statusIndex = new StatusIndex(statusIndexPath(), this);
+        connect(this, &AbstractAccount::streamingEvent, m_statusIndex, [this](StreamingEventType eventType, const QByteArray &payload) {
+            if (eventType == DeleteEvent) {
+                m_statusIndex->remove(QString::fromUtf8(payload));
+            }
+        });
+    }
+    return m_statusIndex;
+}
+
+RelationshipCache *AbstractAccount::relationshipCache()
+{
+    if (!m_relationshipCache) {
+        m_relationshipCache = new RelationshipCache(this);
+        connect(this, &AbstractAccount::streamingEvent, m_relationshipCache, [this](StreamingEventType eventType, const QByteArray &payload) {
+            if (eventType != NotificationEvent) {
+                return;
+            }
+
+            // Someone following us is the only change to a relationship we're told about
+            const auto notification = QJsonDocument::fromJson(payload).object();
+            if (notification["type"_L1].toString() == "follow"_L1) {
+                m_relationshipCache->invalidate(notification["account"_L1].toObject()["id"_L1].toString());
+            }
+        });
+    }
+    return m_relationshipCache;
 }
 
 std::shared_ptr<AdminAccountInfo> AbstractAccount::adminIdentityLookup(const QString &accountId, const QJsonObject &doc)
@@ -290,8 +368,7 @@ bool AbstractAccount::identityCached(const QString &accountId) const
     if (m_identity && m_identity->id() == accountId) {
         return true;
     }
-    auto id = m_identityCache[accountId];
-    return id && id->id() == accountId;
+    return m_identityCache.contains(accountId);
 }
 
 QUrlQuery AbstractAccount::buildOAuthQuery() const
@@ -494,6 +571,8 @@ void AbstractAccount::fetchInstanceMetadata()
                     m_maxPostLength = statusConfigObj["max_characters"_L1].toInt();
                     m_charactersReservedPerUrl = statusConfigObj["characters_reserved_per_url"_L1].toInt();
                 }
+
+                parseMediaAttachmentConfiguration(configObj);
             }
 
             // One can only hope that there will always be a version attached
@@ -550,6 +629,8 @@ void AbstractAccount::fetchInstanceMetadata()
                         m_maxPostLength = statusConfigObj["max_characters"_L1].toInt();
                         m_charactersReservedPerUrl = statusConfigObj["characters_reserved_per_url"_L1].toInt();
                     }
+
+                    parseMediaAttachmentConfiguration(configObj);
                 }
 
                 // One can only hope that there will always be a version attached
@@ -593,6 +674,27 @@ void AbstractAccount::fetchInstanceMetadata()
     fetchCustomEmojis();
 }
 
+void AbstractAccount::parseMediaAttachmentConfiguration(const QJsonObject &configuration)
+{
+    const auto statusesObj = configuration["statuses"_L1].toObject();
+    m_mediaAttachmentLimits.maxAttachments = statusesObj["max_media_attachments"_L1].toInt(m_mediaAttachmentLimits.maxAttachments);
+
+    if (!configuration.contains("media_attachments"_L1)) {
+        return;
+    }
+
+    const auto mediaObj = configuration["media_attachments"_L1].toObject();
+    m_mediaAttachmentLimits.imageSizeLimit = mediaObj["image_size_limit"_L1].toInteger(m_mediaAttachmentLimits.imageSizeLimit);
+    m_mediaAttachmentLimits.imageMatrixLimit = mediaObj["image_matrix_limit"_L1].toInteger(m_mediaAttachmentLimits.imageMatrixLimit);
+    m_mediaAttachmentLimits.videoSizeLimit = mediaObj["video_size_limit"_L1].toInteger(m_mediaAttachmentLimits.videoSizeLimit);
+
+    m_mediaAttachmentLimits.supportedMimeTypes.clear();
+    const auto mimeTypes = mediaObj["supported_mime_types"_L1].toArray();
+    for (const auto &mimeType : mimeTypes) {
+        m_mediaAttachmentLimits.supportedMimeTypes.push_back(mimeType.toString());
+    }
+}
+
 void AbstractAccount::invalidate()
 {
     Q_EMIT invalidated();
@@ -672,10 +774,7 @@ void AbstractAccount::executeAction(Identity *identity, AccountAction accountAct
         // If returned json obj is not an error, it's a relationship status.
         // Returned relationship should have a value of true
         // under either the "following" or "requested" keys.
-        auto relationship = identity->relationship();
-        relationship->updateFromJson(jsonObj);
-
-        Q_EMIT identity->relationshipChanged();
+        relationshipCache()->update(jsonObj);
     });
 }
 
@@ -808,32 +907,95 @@ QString AbstractAccount::accessTokenKey() const
     return AccountManager::accessTokenKey(settingsGroupName());
 }
 
+// The catalog changes rarely, so it's only downloaded again after this long (in seconds) even though the instance metadata is refreshed more often
+constexpr qint64 customEmojiCatalogLifetime = 60 * 60;
+
+static std::optional<QList<CustomEmoji>> parseCustomEmojiCatalog(const QByteArray &data)
+{
+    const auto doc = QJsonDocument::fromJson(data);
+    if (!doc.isArray()) {
+        return std::nullopt;
+    }
+
+    const auto array = doc.array();
+
+    QList<CustomEmoji> emojis;
+    emojis.reserve(array.size());
+    for (auto emojiObj : array) {
+        if (!emojiObj.isObject()) {
+            continue;
+        }
+
+        CustomEmoji customEmoji{};
+        customEmoji.shortcode = emojiObj[QStringLiteral("shortcode")].toString();
+        customEmoji.url = emojiObj[QStringLiteral("url")].toString();
+
+        emojis.push_back(customEmoji);
+    }
+
+    return emojis;
+}
+
+QString AbstractAccount::customEmojiCatalogPath() const
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/custom_emojis/"_L1 + QUrl::fromUserInput(m_instance_uri).host()
+        + ".json"_L1;
+}
+
+QString AbstractAccount::statusIndexPath() const
+{
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/status_index/"_L1 + QUrl::fromUserInput(m_instance_uri).host() + u'_'
+        + m_name + ".index"_L1;
+}
+
 void AbstractAccount::fetchCustomEmojis()
 {
-    m_customEmojis.clear();
+    const QString catalogPath = customEmojiCatalogPath();
+
+    // Start with the catalog saved in a previous session, it's revalidated in the background
+    if (m_customEmojis.isEmpty()) {
+        QFile catalogFile(catalogPath);
+        if (catalogFile.open(QIODevice::ReadOnly)) {
+            if (auto emojis = parseCustomEmojiCatalog(catalogFile.readAll()); emojis && !emojis->isEmpty()) {
+                m_customEmojis = std::move(*emojis);
+                Q_EMIT fetchedCustomEmojis();
+            }
+        }
+    }
+
+    const QFileInfo catalogInfo(catalogPath);
+    if (!m_customEmojis.isEmpty() && catalogInfo.exists()
+        && catalogInfo.lastModified().secsTo(QDateTime::currentDateTimeUtc()) < customEmojiCatalogLifetime) {
+        return;
+    }
 
-    get(apiUrl(QStringLiteral("/api/v1/custom_emojis")), false, this, [=](QNetworkReply *reply) {
+    get(apiUrl(QStringLiteral("/api/v1/custom_emojis")), false, this, [this, catalogPath](QNetworkReply *reply) {
         if (200 != reply->attribute(QNetworkRequest::HttpStatusCodeAttribute))
             return;
 
         const auto data = reply->readAll();
-        const auto doc = QJsonDocument::fromJson(data);
 
-        if (!doc.isArray())
+        // Nothing to do if it didn't change, except remembering that it's fresh
+        QFile catalogFile(catalogPath);
+        if (catalogFile.open(QIODevice::ReadOnly) && catalogFile.readAll() == data) {
+            catalogFile.setFileTime(QDateTime::currentDateTimeUtc(), QFileDevice::FileModificationTime);
             return;
+        }
+        catalogFile.close();
 
-        const auto array = doc.array();
-
-        for (auto emojiObj : array) {
-            if (!emojiObj.isObject()) {
-                continue;
-            }
-
-            CustomEmoji customEmoji{};
-            customEmoji.shortcode = emojiObj[QStringLiteral("shortcode")].toString();
-            customEmoji.url = emojiObj[QStringLiteral("url")].toString();
-
-            m_customEmojis.push_back(customEmoji);
+        auto emojis = parseCustomEmojiCatalog(data);
+        if (!emojis) {
+            return;
+        }
+        m_customEmojis = std::move(*emojis);
+
+        QDir().mkpath(QFileInfo(catalogPath).path());
+        QSaveFile saveFile(catalogPath);
+        if (saveFile.open(QIODevice::WriteOnly)) {
+            saveFile.write(data);
+            saveFile.commit();
+        } else {
+            qCWarning(TOKODON_LOG) << "Failed to save the custom emoji catalog to" << catalogPath << saveFile.errorString();
         }
 
         Q_EMIT fetchedCustomEmojis();
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "account/identity.h"
+#include "account/identitycache.h"
 #include "account/preferences.h"
 #include "accountconfig.h"
 #include "admin/adminaccountinfo.h"
@@ -18,6 +19,9 @@ class QNetworkReply;
 class QHttpMultiPart;
 class QFile;
 class Preferences;
+class PrefetchCache;
+class RelationshipCache;
+class StatusIndex;
 
 /**
  * @brief Represents an account, which could possibly be real or a mock for testing.
@@ -153,6 +157,8 @@ public:
 
     /**
      * @brief Fetches instance-specific custom emojis.
+     *
+     * The catalog is kept on disk per instance, so it's available immediately on the next start, and is only downloaded again once it's stale.
      */
     void fetchCustomEmojis();
 
@@ -194,6 +200,23 @@ public:
      */
     size_t charactersReservedPerUrl() const;
 
+    /**
+     * @brief The limits an instance places on uploaded media.
+     */
+    struct MediaAttachmentLimits {
+        qint64 imageSizeLimit = 10 * 1024 * 1024; /**< Maximum size of an image in bytes. */
+        qint64 imageMatrixLimit = 4096 * 4096; /**< Maximum number of pixels in an image. */
+        qint64 videoSizeLimit = 40 * 1024 * 1024; /**< Maximum size of a video in bytes. */
+        QStringList supportedMimeTypes; /**< The MIME types the instance accepts, empty if unknown. */
+        int maxAttachments = 4; /**< Maximum number of attachments on a single post. */
+    };
+
+    /**
+     * @return The media upload limits of the instance. Until the instance metadata is fetched (or if the server doesn't report them), these are the
+     * defaults of older Mastodon versions.
+     */
+    MediaAttachmentLimits mediaAttachmentLimits() const;
+
     /**
      * @return The title set by the instance.
      */
@@ -206,12 +229,13 @@ public:
 
     /**
      * @brief Looks up an identity specific to this account (like relationships) using an accountId and optionally a JSON document containing identity
-     * information.
+     * information. If the identity is already known and @p doc is given, it's updated in place unless it was updated recently.
      * @param accountId The account ID.
      * @param doc Optionally provide an existing account JSON, if you were already given some in another request.
+     * @param force Always update a known identity with @p doc, like when the account itself was just fetched instead of coming with a post.
      * @return The requested identity.
      */
-    std::shared_ptr<Identity> identityLookup(const QString &accountId, const QJsonObject &doc);
+    std::shared_ptr<Identity> identityLookup(const QString &accountId, const QJsonObject &doc, bool force = false);
 
     /**
      * @brief Checks if the accountId exists in the account's identity cache.
@@ -238,6 +262,31 @@ public:
      */
     std::shared_ptr<ReportInfo> reportInfoLookup(const QString &reportId, const QJsonObject &doc);
 
+    /**
+     * @return The responses fetched ahead of time for this account.
+     */
+    PrefetchCache *prefetchCache();
+
+    /**
+     * @brief Starts loading the thread of @p postId in the background, as it's likely about to be opened.
+     */
+    Q_INVOKABLE void prefetchThread(const QString &postId);
+
+    /**
+     * @brief Starts loading the profile of @p accountId in the background, as it's likely about to be opened.
+     */
+    Q_INVOKABLE void prefetchProfile(const QString &accountId);
+
+    /**
+     * @return The statuses this account has seen, to search them without asking the server.
+     */
+    StatusIndex *statusIndex();
+
+    /**
+     * @return Our relationships to other accounts, fetched in batches and shared by every page.
+     */
+    RelationshipCache *relationshipCache();
+
     /**
      * @brief Invalidates this account.
      */
@@ -437,6 +486,15 @@ public:
      */
     virtual QNetworkReply *upload(const QUrl &filename, std::function<void(QNetworkReply *)> callback) = 0;
 
+    /**
+     * @brief Upload an in-memory file to the server.
+     * @param data The contents of the file.
+     * @param fileName The file name reported to the server.
+     * @param mimeType The MIME type of @p data.
+     * @param callback The callback that should be executed if the request is successful.
+     */
+    virtual QNetworkReply *upload(const QByteArray &data, const QString &fileName, const QString &mimeType, std::function<void(QNetworkReply *)> callback) = 0;
+
     /**
      * @brief Find the remote URL on this account's server. For example, giving it a post @p url will give the equivalent post on this server if available.
      * @param url The URL of the object to retrieve.
@@ -659,6 +717,13 @@ Q_SIGNALS:
      */
     void streamingEvent(AbstractAccount::StreamingEventType eventType, const QByteArray &payload);
 
+    /**
+     * @brief Emitted when the streaming connection for @p stream is back after being closed.
+     *
+     * Any events sent in the meantime were missed, so this is the time to catch up on them.
+     */
+    void streamingReconnected(const QString &stream);
+
     /**
      * @brief Emitted when the number of follow requests was changed.
      */
@@ -680,6 +745,12 @@ protected:
     AbstractAccount(QObject *parent, const QString &instanceUri);
     explicit AbstractAccount(QObject *parent);
 
+    /**
+     * @return Where the statuses this account has seen are saved, or an empty string to only keep them in memory.
+     * @see statusIndex()
+     */
+    virtual QString statusIndexPath() const;
+
     QString m_name;
     QString m_instance_uri;
     QString m_token;
@@ -690,6 +761,7 @@ protected:
     bool m_supportsLocalVisibility;
     size_t m_charactersReservedPerUrl;
     QString m_instance_name;
+    MediaAttachmentLimits m_mediaAttachmentLimits;
     QJsonArray m_instance_rules;
     std::shared_ptr<Identity> m_identity;
     std::shared_ptr<AdminAccountInfo> m_adminIdentity;
@@ -709,11 +781,20 @@ protected:
     // OAuth authorization
     QUrlQuery buildOAuthQuery() const;
 
+    // custom emoji
+    QString customEmojiCatalogPath() const;
+
+    // instance metadata
+    void parseMediaAttachmentConfiguration(const QJsonObject &configuration);
+
     // updates and notifications
     void handleNotification(const QJsonDocument &doc);
 
     void mutatePost(const QString &id, const QString &verb, bool deliver_home = false);
-    QMap<QString, std::shared_ptr<Identity>> m_identityCache;
+    IdentityCache m_identityCache;
+    PrefetchCache *m_prefetchCache = nullptr;
+    StatusIndex *m_statusIndex = nullptr;
+    RelationshipCache *m_relationshipCache = nullptr;
     QMap<QString, std::shared_ptr<AdminAccountInfo>> m_adminIdentityCache;
     QMap<QString, AdminAccountInfo *> m_adminIdentityCacheWithVanillaPointer;
     QMap<QString, std::shared_ptr<ReportInfo>> m_reportInfoCache;
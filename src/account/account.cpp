@@ -13,6 +13,9 @@
 #include "tokodon_debug.h"
 #endif
 
+#include <QRandomGenerator>
+#include <QTimer>
+
 #include <qt6keychain/keychain.h>
 
 using namespace Qt::Literals::StringLiterals;
@@ -39,7 +42,13 @@ Account::Account(AccountConfig *settings, QNetworkAccessManager *nam, QObject *p
 
 Account::~Account()
 {
+    const auto statistics = m_identityCache.statistics();
+    qCDebug(TOKODON_LOG) << "Identity cache:" << statistics.hits << "hits," << statistics.misses << "misses," << statistics.refreshes << "refreshes,"
+                         << statistics.evictions << "evictions";
+
     m_identityCache.clear();
+
+    closeStreamingSockets();
 }
 
 void Account::get(const QUrl &url,
@@ -171,7 +180,9 @@ void Account::handleReply(QNetworkReply *reply, std::function<void(QNetworkReply
 {
     connect(reply, &QNetworkReply::finished, [reply, reply_cb, errorCallback]() {
         reply->deleteLater();
-        if (200 != reply->attribute(QNetworkRequest::HttpStatusCodeAttribute) && !reply->url().toString().contains("nodeinfo"_L1)) {
+        // Some endpoints like media uploads also answer with 202 or 206
+        const int statusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+        if ((statusCode < 200 || statusCode >= 300) && !reply->url().toString().contains("nodeinfo"_L1)) {
             if (errorCallback) {
                 errorCallback(reply);
             } else {
@@ -208,12 +219,29 @@ QNetworkReply *Account::upload(const QUrl &filename, std::function<void(QNetwork
 
     mp->append(filePart);
 
-    const auto uploadUrl = apiUrl(QStringLiteral("/api/v1/media"));
+    const auto uploadUrl = apiUrl(QStringLiteral("/api/v2/media"));
     qCDebug(TOKODON_HTTP) << "POST" << uploadUrl << "(upload)";
 
     return post(uploadUrl, mp, true, this, callback);
 }
 
+QNetworkReply *Account::upload(const QByteArray &data, const QString &fileName, const QString &mimeType, std::function<void(QNetworkReply *)> callback)
+{
+    auto mp = new QHttpMultiPart(QHttpMultiPart::FormDataType);
+
+    QHttpPart filePart;
+    filePart.setHeader(QNetworkRequest::ContentTypeHeader, mimeType);
+    filePart.setHeader(QNetworkRequest::ContentDispositionHeader, QStringLiteral("form-data; name=\"file\"; filename=\"%1\"").arg(fileName));
+    filePart.setBody(data);
+
+    mp->append(filePart);
+
+    const auto uploadUrl = apiUrl(QStringLiteral("/api/v2/media"));
+    qCDebug(TOKODON_HTTP) << "POST" << uploadUrl << "(upload," << data.size() << "bytes)";
+
+    return post(uploadUrl, mp, true, this, callback);
+}
+
 void Account::requestRemoteObject(const QUrl &remoteUrl, QObject *parent, std::function<void(QNetworkReply *)> callback)
 {
     auto url = apiUrl(QStringLiteral("/api/v2/search"));
@@ -267,12 +295,69 @@ QWebSocket *Account::streamingSocket(const QString &stream)
         }
     });
 
+    // The server drops idle connections now and then, so reconnect and let everyone know they may have missed events in between.
+    // Attempts back off exponentially, with jitter so clients that were dropped together don't all come back at the same time.
+    auto reconnectTimer = new QTimer(socket);
+    reconnectTimer->setSingleShot(true);
+    connect(reconnectTimer, &QTimer::timeout, socket, [socket, url] {
+        socket->open(url);
+    });
+
+    const auto scheduleReconnect = [socket, reconnectTimer, stream] {
+        if (socket->property("closing").toBool() || reconnectTimer->isActive()) {
+            return;
+        }
+
+        // Retrying won't help if the server doesn't want this client
+        const auto closeCode = socket->closeCode();
+        if (socket->property("unauthorized").toBool() || closeCode == QWebSocketProtocol::CloseCodePolicyViolated) {
+            qCWarning(TOKODON_HTTP) << "Not reconnecting streaming connection for" << stream << closeCode << socket->closeReason();
+            return;
+        }
+
+        const int attempt = socket->property("reconnectAttempts").toInt();
+        socket->setProperty("reconnectAttempts", attempt + 1);
+        socket->setProperty("reconnecting", true);
+
+        const auto delay = std::min<std::chrono::milliseconds>(streamingReconnectInterval * (1 << std::min(attempt, 16)), streamingReconnectMaximumInterval);
+        const auto jitter = QRandomGenerator::global()->bounded(static_cast<int>(delay.count() / 2) + 1);
+        reconnectTimer->start(delay / 2 + std::chrono::milliseconds(jitter));
+    };
+
+    connect(socket, &QWebSocket::authenticationRequired, this, [socket] {
+        socket->setProperty("unauthorized", true);
+    });
+    connect(socket, &QWebSocket::disconnected, this, [socket, stream, scheduleReconnect] {
+        qCDebug(TOKODON_HTTP) << "Streaming connection for" << stream << "closed:" << socket->closeReason();
+        scheduleReconnect();
+    });
+    connect(socket, &QWebSocket::errorOccurred, this, [socket, scheduleReconnect] {
+        if (socket->state() == QAbstractSocket::UnconnectedState) {
+            scheduleReconnect();
+        }
+    });
+    connect(socket, &QWebSocket::connected, this, [this, socket, stream] {
+        socket->setProperty("reconnectAttempts", 0);
+        if (socket->property("reconnecting").toBool()) {
+            socket->setProperty("reconnecting", false);
+            Q_EMIT streamingReconnected(stream);
+        }
+    });
+
     socket->open(url);
 
     m_websockets[stream] = socket;
     return socket;
 }
 
+void Account::closeStreamingSockets()
+{
+    for (const auto socket : std::as_const(m_websockets)) {
+        socket->setProperty("closing", true);
+        socket->close();
+    }
+}
+
 void Account::validateToken(bool newAccount)
 {
     const QUrl verify_credentials = apiUrl(QStringLiteral("/api/v1/accounts/verify_credentials"));
@@ -297,7 +382,7 @@ void Account::validateToken(bool newAccount)
                 return;
             }
 
-            m_identity = identityLookup(object["id"_L1].toString(), object);
+            m_identity = identityLookup(object["id"_L1].toString(), object, true);
             m_name = m_identity->username();
             Q_EMIT identityChanged();
             Q_EMIT authenticated(true, {});
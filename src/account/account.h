@@ -9,6 +9,8 @@
 
 #include <QWebSocket>
 
+#include <chrono>
+
 class AccountConfig;
 
 class Account : public AbstractAccount
@@ -43,8 +45,21 @@ public:
     void patch(const QUrl &url, QHttpMultiPart *multiPart, bool authenticated, QObject *parent, std::function<void(QNetworkReply *)>) override;
     void deleteResource(const QUrl &url, bool authenticated, QObject *parent, std::function<void(QNetworkReply *)> callback) override;
     QNetworkReply *upload(const QUrl &filename, std::function<void(QNetworkReply *)> callback) override;
+    QNetworkReply *upload(const QByteArray &data, const QString &fileName, const QString &mimeType, std::function<void(QNetworkReply *)> callback) override;
     void requestRemoteObject(const QUrl &url, QObject *parent, std::function<void(QNetworkReply *)> callback) override;
 
+    /**
+     * @brief How long to wait before the first attempt to reconnect a streaming connection that was closed.
+     *
+     * Every failed attempt doubles the wait, up to streamingReconnectMaximumInterval.
+     */
+    static constexpr std::chrono::seconds streamingReconnectInterval{5};
+
+    /**
+     * @brief The longest wait between two attempts to reconnect a streaming connection.
+     */
+    static constexpr std::chrono::minutes streamingReconnectMaximumInterval{5};
+
     QWebSocket *streamingSocket(const QString &stream);
     QNetworkAccessManager *qnam()
     {
@@ -64,6 +79,7 @@ public:
     Q_INVOKABLE void registerTokodon(bool authCode);
 
 private:
+    void closeStreamingSockets();
     void unsubscribePushNotifications();
     void subscribePushNotifications();
     QUrlQuery buildNotificationFormData();
@@ -5,6 +5,7 @@
 #include "account/accountmanager.h"
 
 #include "account/account.h"
+#include "account/statusindex.h"
 #include "config.h"
 #include "network/networkaccessmanagerfactory.h"
 #include "tokodon_debug.h"
@@ -184,6 +185,9 @@ void AccountManager::removeAccount(AbstractAccount *account)
     clientSecretJob->setKey(account->clientSecretKey());
     clientSecretJob->start();
 
+    // It has followers-only posts in it, which shouldn't stay around after logging out
+    account->statusIndex()->discard();
+
     const auto index = m_accounts.indexOf(account);
     beginRemoveRows(QModelIndex(), index, index);
     m_accounts.removeOne(account);
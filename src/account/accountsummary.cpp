@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/accountsummary.h"
+
+#include "utils/customemoji.h"
+#include "utils/texthandler.h"
+
+using namespace Qt::Literals::StringLiterals;
+
+AccountSummary::AccountSummary(const QJsonObject &obj)
+    : m_id(obj["id"_L1].toString())
+    , m_username(obj["username"_L1].toString())
+    , m_account(obj["acct"_L1].toString())
+    , m_displayName(obj["display_name"_L1].toString())
+    , m_avatarUrl(QUrl(obj["avatar"_L1].toString()))
+{
+    QString displayNameHtml = m_displayName;
+    displayNameHtml.replace(QLatin1Char('<'), QStringLiteral("&lt;")).replace(QLatin1Char('>'), QStringLiteral("&gt;"));
+
+    // Only the emojis in the name are needed, the bio is never shown
+    const auto emojis = CustomEmoji::parseCustomEmojis(obj["emojis"_L1].toArray());
+    m_displayNameHtml = TextHandler::replaceCustomEmojis(emojis, displayNameHtml);
+}
+
+QString AccountSummary::id() const
+{
+    return m_id;
+}
+
+QString AccountSummary::username() const
+{
+    return m_username;
+}
+
+QString AccountSummary::account() const
+{
+    return m_account;
+}
+
+QString AccountSummary::displayName() const
+{
+    return !m_displayName.isEmpty() ? m_displayName : m_username;
+}
+
+QString AccountSummary::displayNameHtml() const
+{
+    return !m_displayNameHtml.isEmpty() ? m_displayNameHtml : m_username;
+}
+
+QUrl AccountSummary::avatarUrl() const
+{
+    return m_avatarUrl;
+}
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QtQml>
+
+/**
+ * @brief Just enough of an account to list it, like in a list of followers.
+ *
+ * Unlike Identity nothing that's only shown on the profile is kept or processed, so long lists stay cheap. It has the same properties as Identity
+ * where they overlap, so it can be shown by InlineIdentityInfo.
+ */
+class AccountSummary
+{
+    Q_GADGET
+
+    Q_PROPERTY(QString id READ id CONSTANT)
+    Q_PROPERTY(QString username READ username CONSTANT)
+    Q_PROPERTY(QString account READ account CONSTANT)
+    Q_PROPERTY(QString displayName READ displayName CONSTANT)
+    Q_PROPERTY(QString displayNameHtml READ displayNameHtml CONSTANT)
+    Q_PROPERTY(QUrl avatarUrl READ avatarUrl CONSTANT)
+
+public:
+    AccountSummary() = default;
+    explicit AccountSummary(const QJsonObject &obj);
+
+    QString id() const;
+    QString username() const;
+    QString account() const;
+
+    /**
+     * @return The display name, or the username if it's not set.
+     */
+    QString displayName() const;
+
+    /**
+     * @return The display name with custom emojis, or the username if it's not set.
+     */
+    QString displayNameHtml() const;
+
+    QUrl avatarUrl() const;
+
+private:
+    QString m_id;
+    QString m_username;
+    QString m_account;
+    QString m_displayName;
+    QString m_displayNameHtml;
+    QUrl m_avatarUrl;
+};
@@ -21,7 +21,38 @@ QString Identity::username() const
 
 QString Identity::bio() const
 {
-    return m_bio;
+    if (m_bio) {
+        return *m_bio;
+    }
+
+    QString bio = TextHandler::replaceCustomEmojis(CustomEmoji::parseCustomEmojis(m_emojis), m_note);
+
+    const QString baseUrl = m_url.toDisplayString(QUrl::RemovePath);
+
+    // Attempt to replace the tag URLs with proper ones, although this should really be handled by the Mastodon API
+    bio = bio.replace(baseUrl + QStringLiteral("/tags/"), QStringLiteral("hashtag:/"), Qt::CaseInsensitive);
+
+    // Even worse, mentions are not given proper ids so we must figure it out on our own.
+    // The account could be on a different server, so let's take advantage of web+ap and use that
+    // to search for the account!
+    // TODO: Mentions have a specific CSS class in the HTML, maybe we can use that instead of dirty regex?
+    static QRegularExpression re(QStringLiteral(R"((?:href="?)(?:https?|ftp):\S[^"]+)"));
+    const auto match = re.match(bio);
+    if (re.isValid()) {
+        for (int i = 0; i <= match.lastCapturedIndex(); ++i) {
+            const int start = match.capturedStart(i);
+            const int length = match.capturedLength(i);
+            const QString captured = match.captured(i);
+            if (captured.contains('@'_L1)) {
+                // The length of "href=" which is used in the regex.
+                const int hrefLength = 6;
+                bio = bio.replace(start + hrefLength, length - hrefLength, QStringLiteral("web+ap:/") + captured.mid(hrefLength));
+            }
+        }
+    }
+
+    m_bio = bio;
+    return bio;
 }
 
 QString Identity::account() const
@@ -99,11 +130,12 @@ void Identity::reparentIdentity(AbstractAccount *parent)
 
 void Identity::fromSourceData(const QJsonObject &doc)
 {
-    m_id = doc["id"_L1].toString();
-    m_displayName = doc["display_name"_L1].toString();
+    m_id = EntityId::fromJson(doc["id"_L1]);
+    // Labels show it as rich text, so any markup in it has to be escaped
+    m_displayName = doc["display_name"_L1].toString().replace(QLatin1Char('<'), QStringLiteral("&lt;")).replace(QLatin1Char('>'), QStringLiteral("&gt;"));
     m_username = doc["username"_L1].toString();
     m_account = doc["acct"_L1].toString();
-    m_bio = doc["note"_L1].toString();
+    m_note = doc["note"_L1].toString();
     m_locked = doc["locked"_L1].toBool();
     m_backgroundUrl = QUrl(doc["header"_L1].toString());
     m_avatarUrl = QUrl(doc["avatar"_L1].toString());
@@ -119,48 +151,27 @@ void Identity::fromSourceData(const QJsonObject &doc)
     QJsonObject source = doc["source"_L1].toObject();
     m_visibility = source["privacy"_L1].toString();
 
-    m_displayNameHtml = m_displayName.replace(QLatin1Char('<'), QStringLiteral("&lt;")).replace(QLatin1Char('>'), QStringLiteral("&gt;"));
+    m_emojis = doc["emojis"_L1].toArray();
 
-    const auto emojis = CustomEmoji::parseCustomEmojis(doc["emojis"_L1].toArray());
-
-    m_displayNameHtml = TextHandler::replaceCustomEmojis(emojis, m_displayNameHtml);
-    m_bio = TextHandler::replaceCustomEmojis(emojis, m_bio);
-
-    const QString baseUrl = m_url.toDisplayString(QUrl::RemovePath);
-
-    // Attempt to replace the tag URLs with proper ones, although this should really be handled by the Mastodon API
-    m_bio = m_bio.replace(baseUrl + QStringLiteral("/tags/"), QStringLiteral("hashtag:/"), Qt::CaseInsensitive);
-
-    // Even worse, mentions are not given proper ids so we must figure it out on our own.
-    // The account could be on a different server, so let's take advantage of web+ap and use that
-    // to search for the account!
-    // TODO: Mentions have a specific CSS class in the HTML, maybe we can use that instead of dirty regex?
-    static QRegularExpression re(QStringLiteral(R"((?:href="?)(?:https?|ftp):\S[^"]+)"));
-    const auto match = re.match(m_bio);
-    if (re.isValid()) {
-        for (int i = 0; i <= match.lastCapturedIndex(); ++i) {
-            const int start = match.capturedStart(i);
-            const int length = match.capturedLength(i);
-            const QString captured = match.captured(i);
-            if (captured.contains('@'_L1)) {
-                // The length of "href=" which is used in the regex.
-                const int hrefLength = 6;
-                m_bio = m_bio.replace(start + hrefLength, length - hrefLength, QStringLiteral("web+ap:/") + captured.mid(hrefLength));
-            }
-        }
-    }
+    // Whatever was made from the old data is out of date now
+    m_displayNameHtml.reset();
+    m_bio.reset();
 
     Q_EMIT identityUpdated();
 }
 
 QString Identity::id() const
 {
-    return m_id;
+    return m_id.toString();
 }
 
 QString Identity::displayNameHtml() const
 {
-    return !m_displayNameHtml.isEmpty() ? m_displayNameHtml : m_username;
+    if (!m_displayNameHtml) {
+        m_displayNameHtml = TextHandler::replaceCustomEmojis(CustomEmoji::parseCustomEmojis(m_emojis), m_displayName);
+    }
+
+    return !m_displayNameHtml->isEmpty() ? *m_displayNameHtml : m_username;
 }
 
 QUrl Identity::url() const
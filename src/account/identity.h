@@ -3,15 +3,20 @@
 
 #pragma once
 
+#include "utils/entityid.h"
+
 #include <QJsonArray>
 
+#include <optional>
+
 class AbstractAccount;
 class Relationship;
 
 /**
  * @brief Represents a profile on the server.
  *
- * These are attached to Posts, and even our own Accounts.
+ * These are attached to Posts, and even our own Accounts. Only the raw data is stored when it's loaded, the HTML of the display name and bio is made
+ * the first time it's needed since most identities are only ever shown as a post's author.
  */
 class Identity : public QObject
 {
@@ -42,7 +47,7 @@ public:
     QString id() const;
 
     /**
-     * @return This identity's display name, if not set then returns the username
+     * @return This identity's display name with any markup escaped, since it's shown as rich text. If not set then returns the username
      */
     QString displayName() const;
 
@@ -57,7 +62,7 @@ public:
     QString displayNameHtml() const;
 
     /**
-     * @return The biography for this identity.
+     * @return The biography for this identity, with custom emojis and links to hashtags and accounts that open in Tokodon.
      */
     QString bio() const;
 
@@ -144,11 +149,11 @@ Q_SIGNALS:
     void identityUpdated();
 
 private:
-    QString m_id;
+    EntityId m_id;
     QString m_displayName;
-    QString m_displayNameHtml;
     QString m_username;
-    QString m_bio;
+    QString m_note;
+    QJsonArray m_emojis;
     QString m_account;
     bool m_locked;
     QString m_visibility;
@@ -162,4 +167,8 @@ private:
     int m_permission;
     Relationship *m_relationship = nullptr;
     AbstractAccount *m_parent = nullptr;
+
+    // Made from the above when they're first needed, and reset when it changes
+    mutable std::optional<QString> m_displayNameHtml;
+    mutable std::optional<QString> m_bio;
 };
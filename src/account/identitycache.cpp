@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/identitycache.h"
+
+IdentityCache::IdentityCache(qsizetype capacity, std::chrono::milliseconds refreshInterval)
+    : m_capacity(capacity)
+    , m_refreshInterval(refreshInterval)
+{
+}
+
+std::shared_ptr<Identity> IdentityCache::find(const QString &id)
+{
+    const auto key = findKey(id);
+    const auto it = key ? m_entries.find(*key) : m_entries.end();
+    if (it == m_entries.end()) {
+        m_statistics.misses++;
+        return nullptr;
+    }
+
+    m_statistics.hits++;
+    m_recent.splice(m_recent.begin(), m_recent, it->recent);
+
+    return it->identity;
+}
+
+bool IdentityCache::contains(const QString &id) const
+{
+    const auto key = findKey(id);
+    return key && m_entries.contains(*key);
+}
+
+void IdentityCache::insert(const QString &id, std::shared_ptr<Identity> identity)
+{
+    const quint64 key = internKey(id);
+
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+        it->identity = std::move(identity);
+        it->updated = Clock::now();
+        m_recent.splice(m_recent.begin(), m_recent, it->recent);
+        return;
+    }
+
+    m_recent.push_front(key);
+    m_entries.insert(key, Entry{std::move(identity), id, Clock::now(), m_recent.begin()});
+
+    if (m_entries.size() > m_capacity) {
+        evict();
+    }
+}
+
+bool IdentityCache::refreshDue(const QString &id)
+{
+    const auto key = findKey(id);
+    const auto it = key ? m_entries.find(*key) : m_entries.end();
+    if (it == m_entries.end()) {
+        return false;
+    }
+
+    const auto now = Clock::now();
+    if (now - it->updated < m_refreshInterval) {
+        return false;
+    }
+
+    it->updated = now;
+    m_statistics.refreshes++;
+
+    return true;
+}
+
+void IdentityCache::clear()
+{
+    m_entries.clear();
+    m_internedKeys.clear();
+    m_recent.clear();
+}
+
+qsizetype IdentityCache::size() const
+{
+    return m_entries.size();
+}
+
+IdentityCache::Statistics IdentityCache::statistics() const
+{
+    return m_statistics;
+}
+
+std::optional<quint64> IdentityCache::numericKey(const QString &id)
+{
+    // Only canonical numbers, so "01" and "1" don't end up as the same identity
+    if (id.isEmpty() || id.size() > 19 || (id.size() > 1 && id.front() == u'0')) {
+        return std::nullopt;
+    }
+
+    quint64 number = 0;
+    for (const QChar c : id) {
+        if (c < u'0' || c > u'9') {
+            return std::nullopt;
+        }
+        number = number * 10 + (c.unicode() - u'0');
+    }
+
+    if (number & internedBit) {
+        return std::nullopt;
+    }
+
+    return number;
+}
+
+std::optional<quint64> IdentityCache::findKey(const QString &id) const
+{
+    if (const auto key = numericKey(id)) {
+        return key;
+    }
+
+    const auto it = m_internedKeys.constFind(id);
+    if (it == m_internedKeys.cend()) {
+        return std::nullopt;
+    }
+
+    return *it;
+}
+
+quint64 IdentityCache::internKey(const QString &id)
+{
+    if (const auto key = findKey(id)) {
+        return *key;
+    }
+
+    const quint64 key = internedBit | m_nextInternedKey++;
+    m_internedKeys.insert(id, key);
+
+    return key;
+}
+
+void IdentityCache::evict()
+{
+    // Walk from the least recently used end, skipping identities that are still shown somewhere. Those are moved to the front, so they aren't looked
+    // at again until everything else has been.
+    auto it = std::prev(m_recent.end());
+    for (qsizetype remaining = m_recent.size(); remaining > 0 && m_entries.size() > m_capacity; remaining--) {
+        const auto previous = it == m_recent.begin() ? m_recent.end() : std::prev(it);
+
+        const auto entry = m_entries.find(*it);
+        if (entry->identity.use_count() > 1) {
+            m_recent.splice(m_recent.begin(), m_recent, it);
+        } else {
+            if (*it & internedBit) {
+                m_internedKeys.remove(entry->id);
+            }
+            m_entries.erase(entry);
+            m_recent.erase(it);
+            m_statistics.evictions++;
+        }
+
+        if (previous == m_recent.end()) {
+            break;
+        }
+        it = previous;
+    }
+}
@@ -0,0 +1,105 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QString>
+
+#include <chrono>
+#include <list>
+#include <memory>
+#include <optional>
+
+class Identity;
+
+/**
+ * @brief The identities an account has seen, keyed by their id.
+ *
+ * Numeric ids (like Mastodon's) are stored as numbers, and other ids are interned to one, so lookups are cheap integer hashes. Once there are more than
+ * the capacity, the least recently used identities that nothing else references anymore are evicted.
+ */
+class IdentityCache
+{
+public:
+    /**
+     * @brief How the cache has performed so far.
+     */
+    struct Statistics {
+        qint64 hits = 0;
+        qint64 misses = 0;
+        qint64 refreshes = 0;
+        qint64 evictions = 0;
+    };
+
+    static constexpr qsizetype defaultCapacity = 2048;
+    static constexpr std::chrono::milliseconds defaultRefreshInterval = std::chrono::seconds(30);
+
+    /**
+     * @param capacity How many identities to keep before evicting unreferenced ones.
+     * @param refreshInterval How long an identity is considered fresh after it was inserted or updated.
+     */
+    explicit IdentityCache(qsizetype capacity = defaultCapacity, std::chrono::milliseconds refreshInterval = defaultRefreshInterval);
+
+    /**
+     * @return The identity with the id @p id, or nullptr if it isn't cached. This counts as a use.
+     */
+    std::shared_ptr<Identity> find(const QString &id);
+
+    /**
+     * @return If the identity with the id @p id is cached, without counting as a use.
+     */
+    bool contains(const QString &id) const;
+
+    /**
+     * @brief Adds @p identity under the id @p id, replacing any existing one, and evicts old identities if needed.
+     */
+    void insert(const QString &id, std::shared_ptr<Identity> identity);
+
+    /**
+     * @return If the identity with the id @p id is older than the refresh interval. If so, it's considered updated from now on, as the caller is expected
+     * to update it with newer data.
+     */
+    bool refreshDue(const QString &id);
+
+    /**
+     * @brief Removes every identity.
+     */
+    void clear();
+
+    /**
+     * @return The number of cached identities.
+     */
+    qsizetype size() const;
+
+    /**
+     * @return The hit, miss, refresh and eviction counts so far.
+     */
+    Statistics statistics() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        std::shared_ptr<Identity> identity;
+        QString id;
+        Clock::time_point updated;
+        std::list<quint64>::iterator recent;
+    };
+
+    // Interned keys have the top bit set, which snowflake ids never reach
+    static constexpr quint64 internedBit = quint64(1) << 63;
+
+    static std::optional<quint64> numericKey(const QString &id);
+    std::optional<quint64> findKey(const QString &id) const;
+    quint64 internKey(const QString &id);
+    void evict();
+
+    qsizetype m_capacity;
+    std::chrono::milliseconds m_refreshInterval;
+    QHash<quint64, Entry> m_entries;
+    QHash<QString, quint64> m_internedKeys;
+    quint64 m_nextInternedKey = 0;
+    std::list<quint64> m_recent; // Most recently used first
+    Statistics m_statistics;
+};
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/notificationavatarcache.h"
+
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QPainter>
+
+#include <algorithm>
+
+NotificationAvatarCache::NotificationAvatarCache(QNetworkAccessManager *nam, QObject *parent)
+    : QObject(parent)
+    , m_nam(nam)
+{
+    m_pool.setMaxThreadCount(1);
+}
+
+void NotificationAvatarCache::avatar(const QUrl &url, QObject *context, std::function<void(const QImage &)> callback)
+{
+    if (const QImage *cached = m_cache.object(url)) {
+        callback(*cached);
+        return;
+    }
+
+    // Only the first request downloads the avatar, the others wait for it
+    const bool downloading = m_pending.contains(url);
+    m_pending[url].push_back({context, std::move(callback)});
+    if (downloading) {
+        return;
+    }
+
+    auto reply = m_nam->get(QNetworkRequest(url));
+    connect(reply, &QNetworkReply::finished, this, [this, reply, url] {
+        reply->deleteLater();
+        if (reply->error() != QNetworkReply::NoError) {
+            finish(url, {});
+            return;
+        }
+
+        m_pool.start([this, url, data = reply->readAll()] {
+            const QImage rounded = roundedAvatar(QImage::fromData(data));
+            QMetaObject::invokeMethod(
+                this,
+                [this, url, rounded] {
+                    finish(url, rounded);
+                },
+                Qt::QueuedConnection);
+        });
+    });
+}
+
+qsizetype NotificationAvatarCache::size() const
+{
+    return m_cache.size();
+}
+
+QImage NotificationAvatarCache::roundedAvatar(const QImage &image)
+{
+    if (image.isNull()) {
+        return {};
+    }
+
+    // Handle avatars that are lopsided in one dimension
+    const int biggestDimension = std::min(std::max(image.width(), image.height()), maximumSize);
+    const QRect imageRect{0, 0, biggestDimension, biggestDimension};
+
+    QImage roundedImage(imageRect.size(), QImage::Format_ARGB32);
+    roundedImage.fill(Qt::transparent);
+
+    QPainter painter(&roundedImage);
+    painter.setRenderHint(QPainter::SmoothPixmapTransform);
+    painter.setPen(Qt::NoPen);
+
+    // Fill background for transparent avatars
+    painter.setBrush(Qt::white);
+    painter.drawRoundedRect(imageRect, imageRect.width(), imageRect.height());
+
+    QBrush brush(image.scaledToHeight(biggestDimension, Qt::SmoothTransformation));
+    painter.setBrush(brush);
+    painter.drawRoundedRect(imageRect, imageRect.width(), imageRect.height());
+    painter.end();
+
+    return roundedImage;
+}
+
+void NotificationAvatarCache::finish(const QUrl &url, const QImage &image)
+{
+    // Failures aren't cached, the avatar may load next time
+    if (!image.isNull()) {
+        m_cache.insert(url, new QImage(image), std::max<qsizetype>(image.sizeInBytes() / 1024, 1));
+    }
+
+    const auto requests = m_pending.take(url);
+    for (const auto &request : requests) {
+        if (request.context) {
+            request.callback(image);
+        }
+    }
+}
+
+#include "moc_notificationavatarcache.cpp"
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QCache>
+#include <QHash>
+#include <QImage>
+#include <QObject>
+#include <QPointer>
+#include <QThreadPool>
+#include <QUrl>
+
+#include <functional>
+
+class QNetworkAccessManager;
+
+/**
+ * @brief Rounded avatars for desktop notifications, which are rendered in the background and cached.
+ *
+ * Someone who favorites or boosts several posts in a row would otherwise have their avatar downloaded and painted for every single notification.
+ */
+class NotificationAvatarCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief The largest size avatars are rendered at, which is plenty for a notification.
+     */
+    static constexpr int maximumSize = 128;
+
+    explicit NotificationAvatarCache(QNetworkAccessManager *nam, QObject *parent = nullptr);
+
+    /**
+     * @brief Calls @p callback with the rounded avatar at @p url, right away if it's cached.
+     *
+     * The image is null if the avatar couldn't be loaded, and @p callback isn't called at all if @p context is destroyed before then.
+     */
+    void avatar(const QUrl &url, QObject *context, std::function<void(const QImage &)> callback);
+
+    /**
+     * @return The number of cached avatars.
+     */
+    qsizetype size() const;
+
+    /**
+     * @return @p image cropped to a circle on a white background, at most maximumSize wide.
+     */
+    static QImage roundedAvatar(const QImage &image);
+
+private:
+    struct Request {
+        QPointer<QObject> context;
+        std::function<void(const QImage &)> callback;
+    };
+
+    void finish(const QUrl &url, const QImage &image);
+
+    QNetworkAccessManager *m_nam = nullptr;
+
+    QCache<QUrl, QImage> m_cache{8 * 1024}; // in KiB
+    QHash<QUrl, QList<Request>> m_pending;
+
+    // Declared last, so running renders are waited on before anything else goes away
+    QThreadPool m_pool;
+};
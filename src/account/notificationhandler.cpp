@@ -4,10 +4,9 @@
 #include "account/notificationhandler.h"
 
 #include "account/account.h"
+#include "account/notificationavatarcache.h"
 #include "network/networkcontroller.h"
 
-#include <QPainter>
-
 #include <KLocalizedString>
 #include <KNotification>
 
@@ -17,12 +16,110 @@
 
 NotificationHandler::NotificationHandler(QNetworkAccessManager *nam, QObject *parent)
     : QObject(parent)
-    , m_nam(nam)
+    , m_avatars(new NotificationAvatarCache(nam, this))
+{
+    m_updateTimer.setInterval(coalescingUpdateInterval);
+    m_updateTimer.setSingleShot(true);
+    connect(&m_updateTimer, &QTimer::timeout, this, &NotificationHandler::updateBursts);
+}
+
+QString NotificationHandler::title(Notification::Type type, const QString &name, int count)
 {
+    switch (type) {
+    case Notification::Mention:
+        return i18n("%1 mentioned you", name);
+    case Notification::Status:
+        return i18n("%1 wrote a new post", name);
+    case Notification::Repeat:
+        if (count > 1) {
+            return i18np("%2 and one other boosted your post", "%2 and %1 others boosted your post", count - 1, name);
+        }
+        return i18n("%1 boosted your post", name);
+    case Notification::Follow:
+        return i18n("%1 followed you", name);
+    case Notification::FollowRequest:
+        return i18n("%1 requested to follow you", name);
+    case Notification::Favorite:
+        if (count > 1) {
+            return i18np("%2 and one other favorited your post", "%2 and %1 others favorited your post", count - 1, name);
+        }
+        return i18n("%1 favorited your post", name);
+    case Notification::Poll:
+        return i18n("Poll by %1 has ended", name);
+    case Notification::Update:
+        return i18n("%1 edited a post", name);
+    default:
+        return {};
+    }
+}
+
+QString NotificationHandler::burstId(const Notification &notification)
+{
+    if (notification.post() == nullptr) {
+        return {};
+    }
+
+    switch (notification.type()) {
+    case Notification::Favorite:
+    case Notification::Repeat:
+        return QString::number(notification.type()) + QLatin1Char('/') + notification.post()->originalPostId();
+    default:
+        return {};
+    }
+}
+
+bool NotificationHandler::coalesce(const BurstKey &key, const Notification &notification)
+{
+    const auto it = m_bursts.find(key);
+    if (it == m_bursts.end()) {
+        return false;
+    }
+
+    // Once the notification is gone or it's been quiet for a while, the next one gets its own again
+    if (!it->notification || Clock::now() - it->lastEvent > coalescingWindow) {
+        m_bursts.erase(it);
+        return false;
+    }
+
+    it->name = notification.identity()->displayName();
+    it->count++;
+    it->lastEvent = Clock::now();
+    it->changed = true;
+    setLastNotification(it->notification);
+
+    if (!m_updateTimer.isActive()) {
+        m_updateTimer.start();
+    }
+
+    return true;
+}
+
+void NotificationHandler::updateBursts()
+{
+    for (auto &burst : m_bursts) {
+        if (burst.changed && burst.notification) {
+            burst.notification->setTitle(title(burst.type, burst.name, burst.count));
+            burst.notification->update();
+        }
+        burst.changed = false;
+    }
+}
+
+void NotificationHandler::setLastNotification(KNotification *knotification)
+{
+    if (m_lastConnection != nullptr) {
+        disconnect(m_lastConnection);
+    }
+    m_lastConnection = connect(knotification, &KNotification::closed, this, &NotificationHandler::lastNotificationClosed);
 }
 
 void NotificationHandler::handle(std::shared_ptr<Notification> notification, AbstractAccount *account)
 {
+    const BurstKey burstKey{account, burstId(*notification)};
+    if (!burstKey.second.isEmpty() && coalesce(burstKey, *notification)) {
+        return;
+    }
+
     KNotification *knotification;
 
     const auto addViewPostAction = [this, &knotification, notification] {
@@ -71,7 +168,7 @@ void NotificationHandler::handle(std::shared_ptr<Notification> notification, Abs
             return;
         }
         knotification = new KNotification(QStringLiteral("mention"));
-        knotification->setTitle(i18n("%1 mentioned you", notification->identity()->displayName()));
+        knotification->setTitle(title(notification->type(), notification->identity()->displayName()));
         addViewPostAction();
         break;
     case Notification::Status:
@@ -79,7 +176,7 @@ void NotificationHandler::handle(std::shared_ptr<Notification> notification, Abs
             return;
         }
         knotification = new KNotification(QStringLiteral("status"));
-        knotification->setTitle(i18n("%1 wrote a new post", notification->identity()->displayName()));
+        knotification->setTitle(title(notification->type(), notification->identity()->displayName()));
         addViewPostAction();
         break;
     case Notification::Repeat:
@@ -87,7 +184,7 @@ void NotificationHandler::handle(std::shared_ptr<Notification> notification, Abs
             return;
         }
         knotification = new KNotification(QStringLiteral("boost"));
-        knotification->setTitle(i18n("%1 boosted your post", notification->identity()->displayName()));
+        knotification->setTitle(title(notification->type(), notification->identity()->displayName()));
         addViewPostAction();
         break;
     case Notification::Follow:
@@ -95,7 +192,7 @@ void NotificationHandler::handle(std::shared_ptr<Notification> notification, Abs
             return;
         }
         knotification = new KNotification(QStringLiteral("follow"));
-        knotification->setTitle(i18n("%1 followed you", notification->identity()->displayName()));
+        knotification->setTitle(title(notification->type(), notification->identity()->displayName()));
         addViewUserAction();
         break;
     case Notification::FollowRequest:
@@ -103,7 +200,7 @@ void NotificationHandler::handle(std::shared_ptr<Notification> notification, Abs
             return;
         }
         knotification = new KNotification(QStringLiteral("follow-request"));
-        knotification->setTitle(i18n("%1 requested to follow you", notification->identity()->displayName()));
+        knotification->setTitle(title(notification->type(), notification->identity()->displayName()));
         addViewUserAction();
         break;
     case Notification::Favorite:
@@ -111,7 +208,7 @@ void NotificationHandler::handle(std::shared_ptr<Notification> notification, Abs
             return;
         }
         knotification = new KNotification(QStringLiteral("favorite"));
-        knotification->setTitle(i18n("%1 favorited your post", notification->identity()->displayName()));
+        knotification->setTitle(title(notification->type(), notification->identity()->displayName()));
         addViewPostAction();
         break;
     case Notification::Poll:
@@ -119,7 +216,7 @@ void NotificationHandler::handle(std::shared_ptr<Notification> notification, Abs
             return;
         }
         knotification = new KNotification(QStringLiteral("poll"));
-        knotification->setTitle(i18n("Poll by %1 has ended", notification->identity()->displayName()));
+        knotification->setTitle(title(notification->type(), notification->identity()->displayName()));
         addViewPostAction();
         break;
     case Notification::Update:
@@ -127,7 +224,7 @@ void NotificationHandler::handle(std::shared_ptr<Notification> notification, Abs
             return;
         }
         knotification = new KNotification(QStringLiteral("update"));
-        knotification->setTitle(i18n("%1 edited a post", notification->identity()->displayName()));
+        knotification->setTitle(title(notification->type(), notification->identity()->displayName()));
         addViewPostAction();
         break;
 
@@ -140,45 +237,23 @@ void NotificationHandler::handle(std::shared_ptr<Notification> notification, Abs
     }
     knotification->setHint(QStringLiteral("x-kde-origin-name"), account->identity()->displayName());
 
-    if (m_lastConnection != nullptr) {
-        disconnect(m_lastConnection);
+    setLastNotification(knotification);
+
+    if (!burstKey.second.isEmpty()) {
+        m_bursts.insert(burstKey, {knotification, notification->type(), notification->identity()->displayName(), 1, Clock::now(), false});
+        connect(knotification, &KNotification::closed, this, [this, burstKey, knotification] {
+            const auto it = m_bursts.constFind(burstKey);
+            if (it != m_bursts.constEnd() && it->notification == knotification) {
+                m_bursts.erase(it);
+            }
+        });
     }
-    m_lastConnection = connect(knotification, &KNotification::closed, this, &NotificationHandler::lastNotificationClosed);
 
     if (!notification->identity()->avatarUrl().isEmpty()) {
-        const auto avatarUrl = notification->identity()->avatarUrl();
-        auto request = QNetworkRequest(avatarUrl);
-        auto reply = m_nam->get(request);
-        connect(reply, &QNetworkReply::finished, this, [reply, knotification]() {
-            reply->deleteLater();
-            if (reply->error() != QNetworkReply::NoError) {
-                knotification->sendEvent();
-                return;
+        m_avatars->avatar(notification->identity()->avatarUrl(), knotification, [knotification](const QImage &avatar) {
+            if (!avatar.isNull()) {
+                knotification->setPixmap(QPixmap::fromImage(avatar));
             }
-            QPixmap img;
-            img.loadFromData(reply->readAll());
-
-            // Handle avatars that are lopsided in one dimension
-            const int biggestDimension = std::max(img.width(), img.height());
-            const QRect imageRect{0, 0, biggestDimension, biggestDimension};
-
-            QImage roundedImage(imageRect.size(), QImage::Format_ARGB32);
-            roundedImage.fill(Qt::transparent);
-
-            QPainter painter(&roundedImage);
-            painter.setRenderHint(QPainter::SmoothPixmapTransform);
-            painter.setPen(Qt::NoPen);
-
-            // Fill background for transparent avatars
-            painter.setBrush(Qt::white);
-            painter.drawRoundedRect(imageRect, imageRect.width(), imageRect.height());
-
-            QBrush brush(img.scaledToHeight(biggestDimension));
-            painter.setBrush(brush);
-            painter.drawRoundedRect(imageRect, imageRect.width(), imageRect.height());
-            painter.end();
-
-            knotification->setPixmap(QPixmap::fromImage(std::move(roundedImage)));
             knotification->sendEvent();
         });
     } else {
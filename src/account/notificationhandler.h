@@ -5,10 +5,20 @@
 
 #include "timeline/notification.h"
 
+#include <QPointer>
+#include <QTimer>
+
+#include <chrono>
+
+class KNotification;
+class NotificationAvatarCache;
 class QNetworkAccessManager;
 
 /**
  * @brief Handles desktop notifications using KNotification.
+ *
+ * Favorites and boosts of the same post are merged into one notification while they keep coming in, so a popular post doesn't flood the
+ * notification daemon.
  */
 class NotificationHandler : public QObject
 {
@@ -24,10 +34,44 @@ public:
      */
     void handle(std::shared_ptr<Notification> notification, AbstractAccount *account);
 
+    /**
+     * @return The title of a notification of @p type from the account named @p name, and @p count - 1 others if it's merged.
+     */
+    static QString title(Notification::Type type, const QString &name, int count = 1);
+
+    /**
+     * @brief How long after the last one further favorites or boosts of a post are merged into its notification.
+     */
+    static constexpr std::chrono::seconds coalescingWindow{60};
+
+    /**
+     * @brief How often merged notifications are updated at most.
+     */
+    static constexpr std::chrono::seconds coalescingUpdateInterval{2};
+
 Q_SIGNALS:
     void lastNotificationClosed();
 
 private:
-    QNetworkAccessManager *m_nam;
+    using Clock = std::chrono::steady_clock;
+    using BurstKey = std::pair<AbstractAccount *, QString>;
+
+    struct Burst {
+        QPointer<KNotification> notification;
+        Notification::Type type;
+        QString name; // Of the latest account
+        int count = 1;
+        Clock::time_point lastEvent;
+        bool changed = false;
+    };
+
+    static QString burstId(const Notification &notification);
+    bool coalesce(const BurstKey &key, const Notification &notification);
+    void updateBursts();
+    void setLastNotification(KNotification *knotification);
+
+    NotificationAvatarCache *m_avatars;
     QMetaObject::Connection m_lastConnection;
+    QHash<BurstKey, Burst> m_bursts;
+    QTimer m_updateTimer;
 };
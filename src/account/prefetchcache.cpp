@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/prefetchcache.h"
+
+#include "account/abstractaccount.h"
+#include "tokodon_http_debug.h"
+
+#include <QNetworkReply>
+
+PrefetchCache::PrefetchCache(AbstractAccount *account, std::chrono::milliseconds lifetime)
+    : QObject(account)
+    , m_account(account)
+    , m_lifetime(lifetime)
+{
+}
+
+void PrefetchCache::prefetch(const QUrl &url)
+{
+    expire();
+
+    if (m_entries.contains(url) || m_pending.contains(url) || m_pending.size() >= maximumInFlight) {
+        return;
+    }
+
+    qCDebug(TOKODON_HTTP) << "Prefetching" << url;
+
+    m_pending.insert(url, {});
+    m_account->get(
+        url,
+        true,
+        this,
+        [this, url](QNetworkReply *reply) {
+            finish(url, reply->readAll());
+        },
+        [this, url](QNetworkReply *) {
+            finish(url, std::nullopt);
+        });
+}
+
+void PrefetchCache::get(const QUrl &url, QObject *parent, std::function<void(const QByteArray &)> callback, std::function<void(QNetworkReply *)> errorCallback)
+{
+    expire();
+
+    // Responses are only handed out once, the next time the page is opened it should be up to date again
+    if (const auto it = m_entries.constFind(url); it != m_entries.cend()) {
+        const QByteArray data = it->data;
+        m_entries.erase(it);
+        callback(data);
+        return;
+    }
+
+    if (const auto it = m_pending.find(url); it != m_pending.end()) {
+        it->push_back({parent, std::move(callback), std::move(errorCallback)});
+        return;
+    }
+
+    fetch(url, parent, std::move(callback), std::move(errorCallback));
+}
+
+bool PrefetchCache::contains(const QUrl &url) const
+{
+    const auto it = m_entries.constFind(url);
+    return it != m_entries.cend() && !expired(*it);
+}
+
+qsizetype PrefetchCache::size() const
+{
+    return m_entries.size();
+}
+
+void PrefetchCache::clear()
+{
+    m_entries.clear();
+}
+
+void PrefetchCache::fetch(const QUrl &url, QObject *parent, std::function<void(const QByteArray &)> callback, std::function<void(QNetworkReply *)> errorCallback)
+{
+    m_account->get(
+        url,
+        true,
+        parent,
+        [callback](QNetworkReply *reply) {
+            callback(reply->readAll());
+        },
+        errorCallback);
+}
+
+void PrefetchCache::finish(const QUrl &url, const std::optional<QByteArray> &data)
+{
+    const auto waiters = m_pending.take(url);
+
+    bool delivered = false;
+    for (const auto &waiter : waiters) {
+        if (!waiter.parent) {
+            continue;
+        }
+
+        // Let a failed prefetch be retried as a normal request, so the error is reported like any other
+        if (data) {
+            waiter.callback(*data);
+        } else {
+            fetch(url, waiter.parent, waiter.callback, waiter.errorCallback);
+        }
+        delivered = true;
+    }
+
+    if (!data || delivered) {
+        return;
+    }
+
+    if (m_entries.size() >= maximumEntries) {
+        auto oldest = m_entries.begin();
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it) {
+            if (it->fetched < oldest->fetched) {
+                oldest = it;
+            }
+        }
+        m_entries.erase(oldest);
+    }
+
+    m_entries.insert(url, {*data, Clock::now()});
+}
+
+bool PrefetchCache::expired(const Entry &entry) const
+{
+    return Clock::now() - entry.fetched >= m_lifetime;
+}
+
+void PrefetchCache::expire()
+{
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if (expired(*it)) {
+            it = m_entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+#include "moc_prefetchcache.cpp"
@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QUrl>
+
+#include <chrono>
+#include <functional>
+#include <optional>
+
+class AbstractAccount;
+class QNetworkReply;
+
+/**
+ * @brief Responses fetched ahead of time, because the user is likely about to open what they belong to.
+ *
+ * Hovering or pressing a post or an avatar warms the requests its thread or profile page would make, so the page can be filled as soon as it's opened.
+ * Responses are only kept for a short while, and are handed out once.
+ */
+class PrefetchCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    static constexpr std::chrono::milliseconds defaultLifetime = std::chrono::seconds(30);
+
+    /**
+     * @brief How many responses are kept at most, the oldest one is dropped when another comes in.
+     */
+    static constexpr qsizetype maximumEntries = 32;
+
+    /**
+     * @brief How many prefetches can run at once. Any more are dropped, so they never hold up requests for what's on screen.
+     */
+    static constexpr qsizetype maximumInFlight = 6;
+
+    /**
+     * @param lifetime How long a response is used after it was fetched.
+     */
+    explicit PrefetchCache(AbstractAccount *account, std::chrono::milliseconds lifetime = defaultLifetime);
+
+    /**
+     * @brief Fetches @p url in the background, unless it's already cached or being fetched.
+     */
+    void prefetch(const QUrl &url);
+
+    /**
+     * @brief Calls @p callback with the response for @p url, right away if it was prefetched.
+     *
+     * If it's still being prefetched, this waits for it instead of requesting it again. Otherwise this is the same as AbstractAccount::get.
+     */
+    void get(const QUrl &url,
+             QObject *parent,
+             std::function<void(const QByteArray &)> callback,
+             std::function<void(QNetworkReply *)> errorCallback = nullptr);
+
+    /**
+     * @return If a response for @p url is cached and not yet expired.
+     */
+    bool contains(const QUrl &url) const;
+
+    /**
+     * @return The number of cached responses, including expired ones that weren't dropped yet.
+     */
+    qsizetype size() const;
+
+    /**
+     * @brief Drops every cached response.
+     */
+    void clear();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        QByteArray data;
+        Clock::time_point fetched;
+    };
+
+    struct Waiter {
+        QPointer<QObject> parent;
+        std::function<void(const QByteArray &)> callback;
+        std::function<void(QNetworkReply *)> errorCallback;
+    };
+
+    void fetch(const QUrl &url, QObject *parent, std::function<void(const QByteArray &)> callback, std::function<void(QNetworkReply *)> errorCallback);
+    void finish(const QUrl &url, const std::optional<QByteArray> &data);
+    bool expired(const Entry &entry) const;
+    void expire();
+
+    AbstractAccount *m_account = nullptr;
+    std::chrono::milliseconds m_lifetime;
+    QHash<QUrl, Entry> m_entries;
+    QHash<QUrl, QList<Waiter>> m_pending;
+};
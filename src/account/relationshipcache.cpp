@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/relationshipcache.h"
+
+#include "account/abstractaccount.h"
+#include "account/relationship.h"
+#include "tokodon_http_debug.h"
+
+#include <QJsonArray>
+#include <QNetworkReply>
+
+using namespace Qt::Literals::StringLiterals;
+
+RelationshipCache::RelationshipCache(AbstractAccount *account, std::chrono::milliseconds lifetime)
+    : QObject(account)
+    , m_account(account)
+    , m_lifetime(lifetime)
+{
+    // Wait for the rest of the page to ask for theirs too
+    m_batchTimer.setSingleShot(true);
+    m_batchTimer.setInterval(0);
+    connect(&m_batchTimer, &QTimer::timeout, this, &RelationshipCache::fetchQueued);
+}
+
+void RelationshipCache::request(const QString &accountId)
+{
+    if (accountId.isEmpty() || (m_account->identity() && m_account->identity()->id() == accountId)) {
+        return;
+    }
+
+    // The identity may be new since, so it still needs to be told
+    if (const auto it = m_entries.constFind(accountId); it != m_entries.cend() && !expired(*it)) {
+        apply(accountId, it->relationship);
+        return;
+    }
+
+    if (m_pending.contains(accountId) || hasFailed(accountId)) {
+        return;
+    }
+
+    m_pending.insert(accountId);
+    m_queue.push_back(accountId);
+    if (!m_batchTimer.isActive()) {
+        m_batchTimer.start();
+    }
+}
+
+void RelationshipCache::request(const QStringList &accountIds)
+{
+    for (const auto &accountId : accountIds) {
+        request(accountId);
+    }
+}
+
+QJsonObject RelationshipCache::relationship(const QString &accountId) const
+{
+    return m_entries.value(accountId).relationship;
+}
+
+bool RelationshipCache::contains(const QString &accountId) const
+{
+    const auto it = m_entries.constFind(accountId);
+    return it != m_entries.cend() && !expired(*it);
+}
+
+bool RelationshipCache::isPending(const QString &accountId) const
+{
+    return m_pending.contains(accountId);
+}
+
+bool RelationshipCache::hasFailed(const QString &accountId) const
+{
+    const auto it = m_failed.constFind(accountId);
+    return it != m_failed.cend() && Clock::now() - *it < failureLifetime;
+}
+
+void RelationshipCache::update(const QJsonObject &relationship)
+{
+    const QString accountId = relationship["id"_L1].toString();
+    if (accountId.isEmpty()) {
+        return;
+    }
+
+    m_entries.insert(accountId, {relationship, Clock::now()});
+    m_failed.remove(accountId);
+    apply(accountId, relationship);
+    Q_EMIT relationshipChanged(accountId);
+}
+
+void RelationshipCache::invalidate(const QString &accountId)
+{
+    m_entries.remove(accountId);
+    m_failed.remove(accountId);
+
+    if (m_account->identityCached(accountId) && m_account->identityLookup(accountId, {})->relationship() != nullptr) {
+        request(accountId);
+    }
+}
+
+void RelationshipCache::clear()
+{
+    m_entries.clear();
+    m_failed.clear();
+}
+
+void RelationshipCache::fetchQueued()
+{
+    const QStringList queue = std::exchange(m_queue, {});
+
+    for (qsizetype i = 0; i < queue.size(); i += maximumBatchSize) {
+        const QStringList batch = queue.mid(i, maximumBatchSize);
+
+        QUrlQuery query;
+        for (const auto &accountId : batch) {
+            query.addQueryItem(QStringLiteral("id[]"), accountId);
+        }
+
+        auto url = m_account->apiUrl(QStringLiteral("/api/v1/accounts/relationships"));
+        url.setQuery(query);
+
+        qCDebug(TOKODON_HTTP) << "Fetching" << batch.size() << "relationships";
+
+        m_account->get(
+            url,
+            true,
+            this,
+            [this, batch](QNetworkReply *reply) {
+                finish(batch, reply->readAll());
+            },
+            [this, batch](QNetworkReply *) {
+                finish(batch, {});
+            });
+    }
+}
+
+void RelationshipCache::finish(const QStringList &accountIds, const QByteArray &data)
+{
+    for (const auto &accountId : accountIds) {
+        m_pending.remove(accountId);
+    }
+
+    const auto doc = QJsonDocument::fromJson(data);
+    if (!doc.isArray()) {
+        qCWarning(TOKODON_HTTP) << "Failed to fetch relationships for" << accountIds;
+
+        // Whatever shows them would otherwise ask again right away
+        const auto now = Clock::now();
+        for (const auto &accountId : accountIds) {
+            m_failed.insert(accountId, now);
+        }
+        return;
+    }
+
+    const auto relationships = doc.array();
+    for (const auto &relationship : relationships) {
+        update(relationship.toObject());
+    }
+}
+
+void RelationshipCache::apply(const QString &accountId, const QJsonObject &relationship)
+{
+    // Only identities someone has seen can be showing it, anything else gets it once it's requested
+    if (!m_account->identityCached(accountId)) {
+        return;
+    }
+
+    const auto identity = m_account->identityLookup(accountId, {});
+    if (auto existing = identity->relationship()) {
+        existing->updateFromJson(relationship);
+        Q_EMIT identity->relationshipChanged();
+    } else {
+        identity->setRelationship(new Relationship(identity.get(), relationship));
+    }
+}
+
+bool RelationshipCache::expired(const Entry &entry) const
+{
+    return Clock::now() - entry.fetched >= m_lifetime;
+}
+
+#include "moc_relationshipcache.cpp"
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QJsonObject>
+#include <QObject>
+#include <QSet>
+#include <QStringList>
+#include <QTimer>
+
+#include <chrono>
+
+class AbstractAccount;
+
+/**
+ * @brief Our relationships to other accounts, shared by every page of the account.
+ *
+ * Relationships that are requested together, like for a page of followers, are fetched in as few requests as the server allows, and a relationship is only
+ * fetched once even if it's requested again while that's still going on. Whenever a relationship is known or changes, it's set on the cached identity.
+ */
+class RelationshipCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief How many relationships are fetched in one request at most, which is the limit Mastodon has.
+     */
+    static constexpr qsizetype maximumBatchSize = 40;
+
+    static constexpr std::chrono::milliseconds defaultLifetime = std::chrono::minutes(5);
+
+    /**
+     * @brief How long to wait before fetching a relationship again after fetching it failed.
+     */
+    static constexpr std::chrono::milliseconds failureLifetime = std::chrono::minutes(1);
+
+    /**
+     * @param lifetime How long a relationship is used before it's fetched again.
+     */
+    explicit RelationshipCache(AbstractAccount *account, std::chrono::milliseconds lifetime = defaultLifetime);
+
+    /**
+     * @brief Makes sure our relationship to @p accountId is known, fetching it if it isn't.
+     *
+     * Everything requested before control returns to the event loop is fetched together. If fetching it failed recently, it's not tried again until
+     * failureLifetime has passed.
+     */
+    void request(const QString &accountId);
+
+    /**
+     * @copydoc request()
+     */
+    void request(const QStringList &accountIds);
+
+    /**
+     * @return Our relationship to @p accountId, or an empty object if it isn't known.
+     */
+    QJsonObject relationship(const QString &accountId) const;
+
+    /**
+     * @return If our relationship to @p accountId is known and not yet expired.
+     */
+    bool contains(const QString &accountId) const;
+
+    /**
+     * @return If our relationship to @p accountId is waiting to be fetched or being fetched.
+     */
+    bool isPending(const QString &accountId) const;
+
+    /**
+     * @return If fetching our relationship to @p accountId failed less than failureLifetime ago.
+     */
+    bool hasFailed(const QString &accountId) const;
+
+    /**
+     * @brief Stores @p relationship, like one returned after following or blocking someone.
+     */
+    void update(const QJsonObject &relationship);
+
+    /**
+     * @brief Forgets our relationship to @p accountId because it changed, and fetches it again if it's shown somewhere.
+     */
+    void invalidate(const QString &accountId);
+
+    /**
+     * @brief Forgets every relationship.
+     */
+    void clear();
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted when our relationship to @p accountId was fetched or updated.
+     */
+    void relationshipChanged(const QString &accountId);
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Entry {
+        QJsonObject relationship;
+        Clock::time_point fetched;
+    };
+
+    void fetchQueued();
+    void finish(const QStringList &accountIds, const QByteArray &data);
+    void apply(const QString &accountId, const QJsonObject &relationship);
+    bool expired(const Entry &entry) const;
+
+    AbstractAccount *m_account = nullptr;
+    std::chrono::milliseconds m_lifetime;
+    QHash<QString, Entry> m_entries;
+    QSet<QString> m_pending;
+    QHash<QString, Clock::time_point> m_failed;
+    QStringList m_queue;
+    QTimer m_batchTimer;
+};
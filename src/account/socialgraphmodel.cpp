@@ -5,7 +5,7 @@
 
 #include "account/abstractaccount.h"
 #include "account/accountmanager.h"
-#include "account/relationship.h"
+#include "account/relationshipcache.h"
 
 #include <KLocalizedString>
 
@@ -114,15 +114,40 @@ QVariant SocialGraphModel::data(const QModelIndex &index, int role) const
 {
     Q_ASSERT(checkIndex(index, QAbstractItemModel::CheckIndexOption::IndexIsValid));
 
-    const auto identity = m_accounts[index.row()].get();
+    const auto &account = m_accounts[index.row()];
     switch (role) {
     case CustomRoles::IdentityRole:
-        return QVariant::fromValue<Identity *>(identity);
+        return QVariant::fromValue(account);
+    case CustomRoles::RelationshipRole: {
+        if (isFollowRequest()) {
+            return QJsonObject{};
+        }
+
+        // Until it's known this is empty, see rowShown()
+        return AccountManager::instance().selectedAccount()->relationshipCache()->relationship(account.id());
+    }
     default:
         Q_UNREACHABLE();
     }
 }
 
+void SocialGraphModel::rowShown(int row)
+{
+    if (row < 0 || row >= m_accounts.size()) {
+        return;
+    }
+
+    // Only rows that are shown ask for it, and everything shown at once is fetched together
+    if (!isFollowRequest()) {
+        AccountManager::instance().selectedAccount()->relationshipCache()->request(m_accounts[row].id());
+    }
+
+    // Start on the next page while there's still some of this one left, fillTimeline() ignores this while it's loading
+    if (row >= m_accounts.size() - prefetchDistance && canFetchMore({})) {
+        fillTimeline();
+    }
+}
+
 int SocialGraphModel::rowCount(const QModelIndex &) const
 {
     return m_accounts.count();
@@ -132,6 +157,7 @@ QHash<int, QByteArray> SocialGraphModel::roleNames() const
 {
     return {
         {CustomRoles::IdentityRole, "identity"},
+        {CustomRoles::RelationshipRole, "relationship"},
     };
 }
 
@@ -171,21 +197,17 @@ void SocialGraphModel::actionAllow(const QModelIndex &index)
     if (!checkIndex(index, QAbstractItemModel::CheckIndexOption::IndexIsValid))
         return;
 
-    auto requestIdentity = m_accounts[index.row()].get();
-    const auto requestIdentityId = requestIdentity->id();
+    const auto requestIdentityId = m_accounts[index.row()].id();
 
     account->post(account->apiUrl(QStringLiteral("/api/v1/follow_requests/%1/authorize").arg(requestIdentityId)),
                   QJsonDocument{},
                   true,
                   this,
-                  [this, account, requestIdentity, index](QNetworkReply *reply) {
+                  [this, account, requestIdentityId](QNetworkReply *reply) {
                       const auto newRelation = QJsonDocument::fromJson(reply->readAll()).object();
 
-                      m_accounts[index.row()]->setRelationship(new Relationship(requestIdentity, newRelation));
-
-                      beginRemoveRows(QModelIndex(), index.row(), index.row());
-                      m_accounts.removeAt(index.row());
-                      endRemoveRows();
+                      account->relationshipCache()->update(newRelation);
+                      removeAccount(m_rows.value(requestIdentityId, -1));
 
                       account->checkForFollowRequests();
                   });
@@ -198,26 +220,32 @@ void SocialGraphModel::actionDeny(const QModelIndex &index)
     if (!checkIndex(index, QAbstractItemModel::CheckIndexOption::IndexIsValid))
         return;
 
-    auto requestIdentity = m_accounts[index.row()].get();
-    const auto requestIdentityId = requestIdentity->id();
+    const auto requestIdentityId = m_accounts[index.row()].id();
 
     account->post(account->apiUrl(QStringLiteral("/api/v1/follow_requests/%1/reject").arg(requestIdentityId)),
                   QJsonDocument{},
                   true,
                   this,
-                  [this, account, requestIdentity, index](QNetworkReply *reply) {
+                  [this, account, requestIdentityId](QNetworkReply *reply) {
                       const auto newRelation = QJsonDocument::fromJson(reply->readAll()).object();
 
-                      m_accounts[index.row()]->setRelationship(new Relationship(requestIdentity, newRelation));
-
-                      beginRemoveRows(QModelIndex(), index.row(), index.row());
-                      m_accounts.removeAt(index.row());
-                      endRemoveRows();
+                      account->relationshipCache()->update(newRelation);
+                      removeAccount(m_rows.value(requestIdentityId, -1));
 
                       account->checkForFollowRequests();
                   });
 }
 
+void SocialGraphModel::actionFollow(const QModelIndex &index)
+{
+    changeRelationship(index, QStringLiteral("follow"), i18n("Could not follow account"));
+}
+
+void SocialGraphModel::actionUnfollow(const QModelIndex &index)
+{
+    changeRelationship(index, QStringLiteral("unfollow"), i18n("Could not unfollow account"));
+}
+
 bool SocialGraphModel::canFetchMore(const QModelIndex &parent) const
 {
     Q_UNUSED(parent);
@@ -276,35 +304,30 @@ void SocialGraphModel::fillTimeline()
     QUrl url;
     if (m_next.isEmpty()) {
         url = account->apiUrl(uri);
+        url.setQuery(QUrlQuery{{QStringLiteral("limit"), QString::number(pageSize)}});
     } else {
         url = m_next;
     }
 
-    account->get(url, true, this, [this, account](QNetworkReply *reply) {
+    connect(account->relationshipCache(), &RelationshipCache::relationshipChanged, this, &SocialGraphModel::updateRelationship, Qt::UniqueConnection);
+
+    account->get(url, true, this, [this](QNetworkReply *reply) {
         const auto followRequestResult = QJsonDocument::fromJson(reply->readAll());
         const auto accounts = followRequestResult.array();
 
+        // Without a link to the next page this was the last one
+        static QRegularExpression re(QStringLiteral("<(.*)>; rel=\"next\""));
+        const auto next = reply->rawHeader(QByteArrayLiteral("Link"));
+        const auto match = re.match(QString::fromUtf8(next));
+        m_next = !accounts.isEmpty() && match.hasMatch() ? QUrl::fromUserInput(match.captured(1)) : QUrl();
+
         if (!accounts.isEmpty()) {
-            static QRegularExpression re(QStringLiteral("<(.*)>; rel=\"next\""));
-            const auto next = reply->rawHeader(QByteArrayLiteral("Link"));
-            const auto match = re.match(QString::fromUtf8(next));
-            if (re.isValid()) {
-                m_next = QUrl::fromUserInput(match.captured(1));
+            beginInsertRows({}, m_accounts.size(), m_accounts.size() + accounts.size() - 1);
+            for (const auto &value : accounts) {
+                AccountSummary summary(value.toObject());
+                m_rows.insert(summary.id(), m_accounts.size());
+                m_accounts.push_back(std::move(summary));
             }
-
-            QList<std::shared_ptr<Identity>> fetchedAccounts;
-
-            std::transform(
-                accounts.cbegin(),
-                accounts.cend(),
-                std::back_inserter(fetchedAccounts),
-                [account](const QJsonValue &value) -> auto{
-                    const auto identityJson = value.toObject();
-                    return account->identityLookup(identityJson["id"_L1].toString(), identityJson);
-                });
-
-            beginInsertRows({}, m_accounts.size(), m_accounts.size() + fetchedAccounts.size() - 1);
-            m_accounts += fetchedAccounts;
             endInsertRows();
         }
 
@@ -312,4 +335,56 @@ void SocialGraphModel::fillTimeline()
     });
 }
 
+void SocialGraphModel::changeRelationship(const QModelIndex &index, const QString &action, const QString &errorMessage)
+{
+    auto account = AccountManager::instance().selectedAccount();
+
+    if (!checkIndex(index, QAbstractItemModel::CheckIndexOption::IndexIsValid))
+        return;
+
+    const auto accountId = m_accounts[index.row()].id();
+
+    account->post(account->apiUrl(QStringLiteral("/api/v1/accounts/%1/%2").arg(accountId, action)),
+                  QJsonDocument{},
+                  true,
+                  this,
+                  [account, errorMessage](QNetworkReply *reply) {
+                      const auto relationship = QJsonDocument::fromJson(reply->readAll()).object();
+
+                      // Like when one account blocks the other
+                      if (relationship.contains("error"_L1)) {
+                          Q_EMIT account->errorOccured(errorMessage);
+                          return;
+                      }
+
+                      account->relationshipCache()->update(relationship);
+                  });
+}
+
+void SocialGraphModel::removeAccount(int row)
+{
+    if (row < 0 || row >= m_accounts.size()) {
+        return;
+    }
+
+    beginRemoveRows({}, row, row);
+    m_rows.remove(m_accounts[row].id());
+    m_accounts.removeAt(row);
+    for (int i = row; i < m_accounts.size(); i++) {
+        m_rows[m_accounts[i].id()] = i;
+    }
+    endRemoveRows();
+}
+
+void SocialGraphModel::updateRelationship(const QString &accountId)
+{
+    const auto it = m_rows.constFind(accountId);
+    if (it == m_rows.cend()) {
+        return;
+    }
+
+    const auto changed = index(*it, 0);
+    Q_EMIT dataChanged(changed, changed, {CustomRoles::RelationshipRole});
+}
+
 #include "moc_socialgraphmodel.cpp"
\ No newline at end of file
@@ -3,9 +3,9 @@
 
 #pragma once
 
-#include <QtQml>
+#include "account/accountsummary.h"
 
-class Identity;
+#include <QtQml>
 
 class SocialGraphModel : public QAbstractListModel
 {
@@ -29,15 +29,34 @@ class SocialGraphModel : public QAbstractListModel
 
 public:
     enum CustomRoles {
-        IdentityRole = Qt::UserRole + 1,
+        IdentityRole = Qt::UserRole + 1, /**< The account, as an AccountSummary. */
+        RelationshipRole, /**< Our relationship to the account, or an empty object while it's being fetched. */
     };
 
+    /**
+     * @brief How many accounts to ask for at once, which is the most Mastodon allows for followers.
+     */
+    static constexpr int pageSize = 80;
+
+    /**
+     * @brief How close to the end a row has to be shown before the next page is fetched, so it's usually there before the end is reached.
+     */
+    static constexpr int prefetchDistance = 40;
+
     explicit SocialGraphModel(QObject *parent = nullptr);
 
     QVariant data(const QModelIndex &index, int role) const override;
     int rowCount(const QModelIndex &parent) const override;
     QHash<int, QByteArray> roleNames() const override;
 
+    /**
+     * @brief Called by the view when the account at @p row is shown.
+     *
+     * This fetches our relationship to it, together with the other rows shown at the same time, and starts on the next page once @p row is within
+     * prefetchDistance of the end.
+     */
+    Q_INVOKABLE void rowShown(int row);
+
     bool loading() const;
     void setLoading(bool loading);
 
@@ -58,6 +77,8 @@ public:
 public Q_SLOTS:
     void actionAllow(const QModelIndex &index);
     void actionDeny(const QModelIndex &index);
+    void actionFollow(const QModelIndex &index);
+    void actionUnfollow(const QModelIndex &index);
 
 Q_SIGNALS:
     void loadingChanged();
@@ -71,8 +92,13 @@ protected:
 
 private:
     void fillTimeline();
+    void changeRelationship(const QModelIndex &index, const QString &action, const QString &errorMessage);
+    void removeAccount(int row);
+    void updateRelationship(const QString &accountId);
 
-    QList<std::shared_ptr<Identity>> m_accounts;
+    // Identities are only made once a profile is opened, the list itself doesn't need anything else
+    QList<AccountSummary> m_accounts;
+    QHash<QString, int> m_rows;
     bool m_loading = false;
     QUrl m_next;
 
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "account/statusindex.h"
+
+#include "tokodon_debug.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QPointer>
+#include <QSaveFile>
+
+StatusIndex::StatusIndex(const QString &path, QObject *parent)
+    : QObject(parent)
+    , m_path(path)
+{
+    // Jobs have to run in the order they were queued
+    m_pool.setMaxThreadCount(1);
+
+    m_saveTimer.setSingleShot(true);
+    m_saveTimer.setInterval(saveDelay);
+    connect(&m_saveTimer, &QTimer::timeout, this, &StatusIndex::save);
+
+    if (!m_path.isEmpty()) {
+        m_pool.start([this] {
+            QFile file(m_path);
+            if (file.open(QIODevice::ReadOnly) && !m_index.load(&file)) {
+                qCWarning(TOKODON_LOG) << "Discarding unreadable status index" << m_path;
+            }
+        });
+    }
+}
+
+StatusIndex::~StatusIndex()
+{
+    // Don't lose what was indexed since the last save, the pool waits for it
+    if (m_saveTimer.isActive()) {
+        save();
+    }
+}
+
+void StatusIndex::add(const QJsonArray &statuses)
+{
+    if (statuses.isEmpty()) {
+        return;
+    }
+
+    m_pool.start([this, statuses] {
+        for (const auto &status : statuses) {
+            m_index.add(status.toObject());
+        }
+    });
+    scheduleSave();
+}
+
+void StatusIndex::remove(const QString &statusId)
+{
+    m_pool.start([this, statusId] {
+        m_index.remove(statusId);
+    });
+    scheduleSave();
+}
+
+void StatusIndex::search(const QString &query, qsizetype limit, QObject *context, std::function<void(const QList<QJsonObject> &)> callback)
+{
+    m_pool.start([this, query, limit, context = QPointer<QObject>(context), callback = std::move(callback)] {
+        const auto statuses = m_index.search(query, limit);
+        QMetaObject::invokeMethod(
+            this,
+            [context, callback, statuses] {
+                if (context) {
+                    callback(statuses);
+                }
+            },
+            Qt::QueuedConnection);
+    });
+}
+
+void StatusIndex::discard()
+{
+    m_saveTimer.stop();
+
+    // Queued after any save that's still running, so the file can't come back
+    m_pool.start([this, path = std::exchange(m_path, {})] {
+        m_index = StatusSearchIndex();
+        if (!path.isEmpty() && QFile::exists(path) && !QFile::remove(path)) {
+            qCWarning(TOKODON_LOG) << "Failed to remove the status index" << path;
+        }
+    });
+}
+
+void StatusIndex::scheduleSave()
+{
+    if (!m_path.isEmpty() && !m_saveTimer.isActive()) {
+        m_saveTimer.start();
+    }
+}
+
+void StatusIndex::save()
+{
+    m_saveTimer.stop();
+
+    m_pool.start([this] {
+        QDir().mkpath(QFileInfo(m_path).absolutePath());
+
+        QSaveFile file(m_path);
+        if (!file.open(QIODevice::WriteOnly)) {
+            qCWarning(TOKODON_LOG) << "Failed to save the status index" << m_path << file.errorString();
+            return;
+        }
+
+        m_index.save(&file);
+        if (!file.commit()) {
+            qCWarning(TOKODON_LOG) << "Failed to save the status index" << m_path << file.errorString();
+        }
+    });
+}
+
+#include "moc_statusindex.cpp"
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "utils/statussearchindex.h"
+
+#include <QJsonArray>
+#include <QObject>
+#include <QThreadPool>
+#include <QTimer>
+
+#include <chrono>
+#include <functional>
+
+/**
+ * @brief The statuses an account has seen, which can be searched without asking the server.
+ *
+ * Statuses are indexed in the background as the timelines load them, and the index is saved to disk a little while after it changed so it's
+ * still there next time.
+ *
+ * @see StatusSearchIndex
+ */
+class StatusIndex : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief How long to wait for more changes before saving the index.
+     */
+    static constexpr std::chrono::milliseconds saveDelay = std::chrono::seconds(10);
+
+    /**
+     * @param path Where the index is saved and loaded from. If it's empty, the index is only kept in memory.
+     */
+    explicit StatusIndex(const QString &path, QObject *parent = nullptr);
+    ~StatusIndex() override;
+
+    /**
+     * @brief Adds @p statuses to the index, or updates them if they're already in it.
+     */
+    void add(const QJsonArray &statuses);
+
+    /**
+     * @brief Removes the status with the id @p statusId from the index, like when it's deleted.
+     */
+    void remove(const QString &statusId);
+
+    /**
+     * @brief Calls @p callback with at most @p limit statuses matching @p query, newest first.
+     *
+     * @p callback isn't called if @p context is destroyed before the search is done.
+     * @see StatusSearchIndex::search()
+     */
+    void search(const QString &query, qsizetype limit, QObject *context, std::function<void(const QList<QJsonObject> &)> callback);
+
+    /**
+     * @brief Forgets every status and deletes the saved index, like when the account is logged out. Nothing is saved anymore afterwards.
+     */
+    void discard();
+
+private:
+    void scheduleSave();
+    void save();
+
+    QString m_path;
+    QTimer m_saveTimer;
+
+    // Only touched by jobs in m_pool, which runs one at a time
+    StatusSearchIndex m_index;
+
+    // Declared last, so running jobs are waited on before anything else goes away
+    QThreadPool m_pool;
+};
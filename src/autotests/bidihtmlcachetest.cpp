@@ -0,0 +1,98 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest/QtTest>
+
+#include "utils/bidihtmlcache.h"
+#include "utils/texthandler.h"
+
+using namespace Qt::Literals::StringLiterals;
+
+class BidiHtmlCacheTest : public QObject
+{
+    Q_OBJECT
+
+    // Long enough that it's fixed in the background
+    static QString longHtml(const QString &text)
+    {
+        return u"<p>"_s + text.repeated(BidiHtmlCache::synchronousLength / text.size() + 1) + u"</p>"_s;
+    }
+
+private Q_SLOTS:
+    void testComputedInBackground()
+    {
+        BidiHtmlCache cache;
+        QSignalSpy spy(&cache, &BidiHtmlCache::ready);
+
+        const QString html = longHtml(u"مرحبا <a href=\"https://kde.org/@kde\">@kde</a> "_s);
+        const QFont font;
+
+        QVERIFY(!cache.html(u"1/a"_s, html, font).has_value());
+        QVERIFY(cache.contains(u"1/a"_s));
+
+        // Asking again while it's pending doesn't start another job
+        QVERIFY(!cache.html(u"1/a"_s, html, font).has_value());
+
+        QVERIFY(spy.wait());
+        QCOMPARE(spy.count(), 1);
+        QCOMPARE(spy.constFirst().constFirst().toStringList(), QStringList{u"1/a"_s});
+
+        const auto fixed = cache.html(u"1/a"_s, html, font);
+        QVERIFY(fixed.has_value());
+        QCOMPARE(*fixed, TextHandler::fixBidirectionality(html, font));
+        QVERIFY(fixed->contains(u"\u2068@kde\u2069"_s));
+    }
+
+    void testShortContent()
+    {
+        BidiHtmlCache cache;
+        QSignalSpy spy(&cache, &BidiHtmlCache::ready);
+
+        const QString html = u"<p>مرحبا <a href=\"https://kde.org/@kde\">@kde</a></p>"_s;
+        const QFont font;
+
+        // It's fixed right away, so there's nothing to wait for
+        const auto fixed = cache.html(u"1/a"_s, html, font);
+        QVERIFY(fixed.has_value());
+        QCOMPARE(*fixed, TextHandler::fixBidirectionality(html, font));
+        QVERIFY(cache.contains(u"1/a"_s));
+        QVERIFY(!spy.wait(100));
+    }
+
+    void testKeysAreSeparate()
+    {
+        BidiHtmlCache cache;
+        QSignalSpy spy(&cache, &BidiHtmlCache::ready);
+
+        const QFont font;
+        QVERIFY(!cache.html(u"1/a"_s, longHtml(u"first "_s), font).has_value());
+        QVERIFY(!cache.html(u"1/b"_s, longHtml(u"second "_s), font).has_value());
+        QTRY_VERIFY(cache.html(u"1/a"_s, {}, font).has_value() && cache.html(u"1/b"_s, {}, font).has_value());
+
+        QStringList keys;
+        for (const auto &arguments : std::as_const(spy)) {
+            keys += arguments.constFirst().toStringList();
+        }
+        QCOMPARE(keys, (QStringList{u"1/a"_s, u"1/b"_s}));
+
+        QVERIFY(cache.html(u"1/a"_s, {}, font)->contains(u"first"_s));
+        QVERIFY(cache.html(u"1/b"_s, {}, font)->contains(u"second"_s));
+        QVERIFY(!cache.contains(u"1/c"_s));
+    }
+
+    void testFontChange()
+    {
+        BidiHtmlCache cache;
+
+        QFont font;
+        QVERIFY(cache.html(u"1/a"_s, u"<p>first</p>"_s, font).has_value());
+
+        // Made with another font, so it has to be made again
+        font.setPointSize(font.pointSize() + 4);
+        QVERIFY(!cache.html(u"1/a"_s, longHtml(u"first "_s), font).has_value());
+        QVERIFY(cache.contains(u"1/a"_s));
+    }
+};
+
+QTEST_MAIN(BidiHtmlCacheTest)
+#include "bidihtmlcachetest.moc"
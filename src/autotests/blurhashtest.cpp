@@ -48,6 +48,39 @@ private Q_SLOTS:
         QCOMPARE(response->m_image, specialBlurHashImage);
     }
 
+    void testDecodeId()
+    {
+        QCOMPARE(BlurhashImageProvider::decodeId(u"%7CKO2%3FU%252Tw%24%25tL"), QByteArrayLiteral("|KO2?U%2Tw$%tL"));
+        QCOMPARE(BlurhashImageProvider::decodeId(u"URI#cIR+L1%14eoJ"), QByteArrayLiteral("URI#cIR+L1%14eoJ"));
+        QCOMPARE(BlurhashImageProvider::decodeId(u"abc%2"), QByteArrayLiteral("abc%2"));
+    }
+
+    void testImageProviderCache()
+    {
+        const QString blurHash = QStringLiteral("URI#cIR+L1%14eoJtAWYXMt5IAob4oRQfiRR");
+
+        // Concurrent requests share one decode
+        auto first = dynamic_cast<AsyncImageResponse *>(imageProvider->requestImageResponse(blurHash, QSize(25, 25)));
+        auto second = dynamic_cast<AsyncImageResponse *>(imageProvider->requestImageResponse(blurHash, QSize(25, 25)));
+        QSignalSpy firstSpy(first, &QQuickImageResponse::finished);
+        QSignalSpy secondSpy(second, &QQuickImageResponse::finished);
+        QVERIFY(firstSpy.wait());
+        QTRY_COMPARE(secondSpy.count(), 1);
+
+        QCOMPARE(first->m_image, specialBlurHashImage);
+        QCOMPARE(second->m_image, specialBlurHashImage);
+
+        // A cached placeholder still finishes asynchronously, after the caller connected
+        auto cached = dynamic_cast<AsyncImageResponse *>(imageProvider->requestImageResponse(blurHash, QSize(25, 25)));
+        QSignalSpy cachedSpy(cached, &QQuickImageResponse::finished);
+        QVERIFY(cachedSpy.wait());
+        QCOMPARE(cached->m_image, specialBlurHashImage);
+
+        delete first;
+        delete second;
+        delete cached;
+    }
+
     void testBlurHashAlgo()
     {
         const QByteArray blurHash = QByteArrayLiteral(
@@ -60,6 +93,45 @@ private Q_SLOTS:
 
         QCOMPARE(image, goodBlurHashImage);
     }
+
+    void testBlurHashRgb32()
+    {
+        const QByteArray blurHash = QByteArrayLiteral("URI#cIR+L1%14eoJtAWYXMt5IAob4oRQfiRR");
+
+        QImage image(25, 25, QImage::Format_RGB32);
+        QVERIFY(blurhash::decodeRgb32(blurHash.constData(), 25, 25, reinterpret_cast<uint32_t *>(image.bits()), image.bytesPerLine() / sizeof(uint32_t)));
+
+        QCOMPARE(image, specialBlurHashImage);
+
+        QVERIFY(!blurhash::decodeRgb32("invalid", 25, 25, reinterpret_cast<uint32_t *>(image.bits()), image.bytesPerLine() / sizeof(uint32_t)));
+    }
+
+    void benchmarkDecode_data()
+    {
+        QTest::addColumn<QByteArray>("blurHash");
+        QTest::addColumn<QSize>("size");
+
+        const QByteArray largeBlurHash = QByteArrayLiteral(
+            "|KO2?U%2Tw=wR6cErDEhOD]~RBVZRip0W9ofwxM_};RPxuwH%3s89]t8$%tLOtxZ%gixtQt8IUS#I.ENa0NZIVt6xFM{M{%1j^M_bcRPX9nht7n+j[rrW;ni%Mt7V@W;t7t8%1bbxat7WBIUR*"
+            "RjRjRjxuRjs.MxbbV@WY");
+        const QByteArray smallBlurHash = QByteArrayLiteral("URI#cIR+L1%14eoJtAWYXMt5IAob4oRQfiRR");
+
+        QTest::newRow("9x9 components, 25x25") << largeBlurHash << QSize(25, 25);
+        QTest::newRow("9x9 components, 360x200") << largeBlurHash << QSize(360, 200);
+        QTest::newRow("4x3 components, 25x25") << smallBlurHash << QSize(25, 25);
+        QTest::newRow("4x3 components, 360x200") << smallBlurHash << QSize(360, 200);
+    }
+
+    void benchmarkDecode()
+    {
+        QFETCH(QByteArray, blurHash);
+        QFETCH(QSize, size);
+
+        QImage image(size, QImage::Format_RGB32);
+        QBENCHMARK {
+            blurhash::decodeRgb32(blurHash.constData(), size.width(), size.height(), reinterpret_cast<uint32_t *>(image.bits()), image.width());
+        }
+    }
 };
 
 QTEST_MAIN(BlurHashTest)
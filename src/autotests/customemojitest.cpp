@@ -4,6 +4,7 @@
 #include <QtTest/QtTest>
 
 #include "utils/customemoji.h"
+#include "utils/customemojiimageprovider.h"
 #include "utils/texthandler.h"
 
 class CustomEmojiTest : public QObject
@@ -38,10 +39,48 @@ private Q_SLOTS:
 
         content = TextHandler::replaceCustomEmojis(emojis, content);
         QCOMPARE(content,
-                 QStringLiteral(
-                     "<img height=\"16\" align=\"middle\" width=\"16\" "
-                     "src=\"https://cdn.masto.host/mastodonart/custom_emojis/images/000/181/127/static/63bd6a0097df7bbf.png\"> <img height=\"16\" "
-                     "align=\"middle\" width=\"16\" src=\"https://cdn.masto.host/mastodonart/custom_emojis/images/000/389/600/static/4dd38081c3f8f04c.png\">"));
+                 QStringLiteral("<img height=\"16\" align=\"middle\" width=\"16\" "
+                                "src=\"image://customemoji/"
+                                "aHR0cHM6Ly9jZG4ubWFzdG8uaG9zdC9tYXN0b2RvbmFydC9jdXN0b21fZW1vamlzL2ltYWdlcy8wMDAvMTgxLzEyNy9zdGF0aWMvNjNiZDZhMDA5N2RmN2JiZi5wbmc\"> "
+                                "<img height=\"16\" align=\"middle\" width=\"16\" "
+                                "src=\"image://customemoji/"
+                                "aHR0cHM6Ly9jZG4ubWFzdG8uaG9zdC9tYXN0b2RvbmFydC9jdXN0b21fZW1vamlzL2ltYWdlcy8wMDAvMzg5LzYwMC9zdGF0aWMvNGRkMzgwODFjM2Y4ZjA0Yy5wbmc\">"));
+    }
+
+    void testCustomEmojiReplacementEdgeCases()
+    {
+        auto emojis = CustomEmoji::parseCustomEmojis(doc.array());
+
+        // Unknown shortcodes and stray colons are left alone
+        QCOMPARE(TextHandler::replaceCustomEmojis(emojis, QStringLiteral("10:30 :unknown: :")), QStringLiteral("10:30 :unknown: :"));
+
+        // A colon that doesn't start a known shortcode can still end one
+        const QString replaced = TextHandler::replaceCustomEmojis(emojis, QStringLiteral("a: :artaww::artaww:"));
+        QVERIFY(replaced.startsWith(QStringLiteral("a: <img ")));
+        QCOMPARE(replaced.count(QStringLiteral("<img ")), 2);
+    }
+
+    void testCustomEmojiInterning()
+    {
+        const auto first = CustomEmoji::parseCustomEmojis(doc.array());
+        const auto second = CustomEmoji::parseCustomEmojis(doc.array());
+
+        // Parsing the same emoji again shares the strings instead of allocating new ones
+        QCOMPARE(first[0].url.constData(), second[0].url.constData());
+        QCOMPARE(first[0].shortcode.constData(), second[0].shortcode.constData());
+    }
+
+    void testImageSource()
+    {
+        const QString url = QStringLiteral("https://cdn.masto.host/mastodonart/custom_emojis/images/000/181/127/static/63bd6a0097df7bbf.png");
+        const QString source = CustomEmojiImageProvider::imageSource(url);
+        QVERIFY(source.startsWith(QStringLiteral("image://customemoji/")));
+        QCOMPARE(CustomEmojiImageProvider::decodeId(QStringView(source).sliced(20)), QUrl(url));
+
+        // Only web URLs are loaded
+        QVERIFY(!CustomEmojiImageProvider::decodeId(QStringView(CustomEmojiImageProvider::imageSource(QStringLiteral("file:///etc/passwd"))).sliced(20))
+                     .isValid());
+        QVERIFY(!CustomEmojiImageProvider::decodeId(u"not base64!").isValid());
     }
 
 private:
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest/QtTest>
+
+#include "timeline/delegateheightcache.h"
+
+using namespace Qt::Literals::StringLiterals;
+
+class DelegateHeightCacheTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testLookup()
+    {
+        DelegateHeightCache cache;
+        const QFont font(u"Noto Sans"_s, 10);
+
+        QVERIFY(!cache.height(u"1"_s, u"0001"_s, 400, font).has_value());
+
+        cache.setHeight(u"1"_s, u"0001"_s, 400, font, 120.5);
+        QCOMPARE(cache.height(u"1"_s, u"0001"_s, 400, font).value_or(0), 120.5);
+
+        // Close enough widths share a height, but not different posts, layouts, widths or fonts
+        QCOMPARE(cache.height(u"1"_s, u"0001"_s, 401, font).value_or(0), 120.5);
+        QVERIFY(!cache.height(u"2"_s, u"0001"_s, 400, font).has_value());
+        QVERIFY(!cache.height(u"1"_s, u"0000"_s, 400, font).has_value());
+        QVERIFY(!cache.height(u"1"_s, u"1001"_s, 400, font).has_value());
+        QVERIFY(!cache.height(u"1"_s, u"0001"_s, 600, font).has_value());
+        QVERIFY(!cache.height(u"1"_s, u"0001"_s, 400, QFont(u"Noto Sans"_s, 14)).has_value());
+
+        // Delegates that were never laid out aren't remembered
+        cache.setHeight(u"3"_s, u"0001"_s, 0, font, 100);
+        cache.setHeight(u"3"_s, u"0001"_s, 400, font, 0);
+        QCOMPARE(cache.size(), 1);
+    }
+
+    void testPersistence()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString path = dir.filePath(u"delegate_heights"_s);
+        const QFont font(u"Noto Sans"_s, 10);
+
+        {
+            DelegateHeightCache cache(path);
+            cache.setHeight(u"1"_s, u"0001"_s, 400, font, 120);
+            cache.setHeight(u"2"_s, u"0001"_s, 400, font, 300);
+            cache.save();
+        }
+
+        DelegateHeightCache cache(path);
+        QCOMPARE(cache.size(), 2);
+        QCOMPARE(cache.height(u"1"_s, u"0001"_s, 400, font).value_or(0), 120.0);
+        QCOMPARE(cache.height(u"2"_s, u"0001"_s, 400, font).value_or(0), 300.0);
+    }
+
+    void testIgnoresCorruptFiles()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString path = dir.filePath(u"delegate_heights"_s);
+
+        QFile file(path);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write("not a height cache");
+        file.close();
+
+        DelegateHeightCache cache(path);
+        QCOMPARE(cache.size(), 0);
+    }
+};
+
+QTEST_MAIN(DelegateHeightCacheTest)
+#include "delegateheightcachetest.moc"
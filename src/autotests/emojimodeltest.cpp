@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest/QtTest>
+
+#include "utils/emojilistmodel.h"
+#include "utils/emojimodel.h"
+
+using namespace Qt::Literals::StringLiterals;
+
+class EmojiModelTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testCategory()
+    {
+        EmojiModel emojiModel;
+
+        auto model = emojiModel.emojis(nullptr, EmojiModel::Smileys);
+        QVERIFY(model->rowCount() > 0);
+
+        const QModelIndex first = model->index(0, 0);
+        QCOMPARE(model->data(first, EmojiListModel::UnicodeRole).toString(), u"😀"_s);
+        QCOMPARE(model->data(first, EmojiListModel::ShortNameRole).toString(), u"grinning"_s);
+        QCOMPARE(model->data(first, EmojiListModel::DescriptionRole).toString(), u"grinning face"_s);
+        QCOMPARE(model->data(first, EmojiListModel::IsCustomRole).toBool(), false);
+
+        // The category models are shared
+        QCOMPARE(emojiModel.emojis(nullptr, EmojiModel::Smileys), model);
+    }
+
+    void testTones()
+    {
+        EmojiModel emojiModel;
+
+        std::unique_ptr<EmojiListModel> tones(emojiModel.tones(u"waving hand"_s));
+        QCOMPARE(tones->rowCount(), 5);
+        QCOMPARE(tones->data(tones->index(0, 0), EmojiListModel::ShortNameRole).toString(), u"wave_tone1"_s);
+        QCOMPARE(tones->data(tones->index(4, 0), EmojiListModel::ShortNameRole).toString(), u"wave_tone5"_s);
+
+        QVERIFY(emojiModel.hasTones(u"waving hand"_s));
+        QVERIFY(!emojiModel.hasTones(u"waving"_s));
+        QVERIFY(!emojiModel.hasTones(u"waving hands"_s));
+        QVERIFY(!emojiModel.hasTones({}));
+    }
+
+    void testSearch()
+    {
+        std::unique_ptr<EmojiListModel> results(EmojiModel::filterModel(nullptr, u"grinning"_s));
+        QVERIFY(results->rowCount() > 0);
+        QCOMPARE(results->data(results->index(0, 0), EmojiListModel::ShortNameRole).toString(), u"grinning"_s);
+        QCOMPARE(results->data(results->index(0, 0), EmojiListModel::UnicodeRole).toString(), u"😀"_s);
+    }
+};
+
+QTEST_MAIN(EmojiModelTest)
+#include "emojimodeltest.moc"
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest/QtTest>
+
+#include "utils/emojisearchindex.h"
+
+using namespace Qt::Literals::StringLiterals;
+
+class EmojiSearchIndexTest : public QObject
+{
+    Q_OBJECT
+
+    EmojiSearchIndex index;
+
+    static QStringList names(const QVariantList &results)
+    {
+        QStringList list;
+        for (const auto &result : results) {
+            list.push_back(result.toString());
+        }
+        return list;
+    }
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        // The value is the short name, to make comparing results easy
+        const auto add = [this](const QString &shortName, const QString &description) {
+            index.add(shortName, description, shortName);
+        };
+        add(u"grinning"_s, u"grinning face"_s);
+        add(u"smile"_s, u"grinning face with smiling eyes"_s);
+        add(u"thumbsup"_s, u"thumbs up"_s);
+        add(u"thumbs_up_tone1"_s, u"thumbs up: light skin tone"_s);
+        add(u"smiley"_s, u"grinning face with big eyes"_s);
+        add(u"blobcat_smile"_s, {});
+        add(u"Kde"_s, {});
+        index.build();
+    }
+
+    void testRanking()
+    {
+        // Exact match, then short name prefix, then word prefix, then substring
+        QCOMPARE(names(index.search(u"smile")), QStringList({u"smile"_s, u"smiley"_s, u"blobcat_smile"_s}));
+        QCOMPARE(names(index.search(u"smil")), QStringList({u"smile"_s, u"smiley"_s, u"blobcat_smile"_s}));
+        QCOMPARE(names(index.search(u"miling")), QStringList({u"smile"_s}));
+    }
+
+    void testDescription()
+    {
+        QCOMPARE(names(index.search(u"thumbs u")), QStringList({u"thumbsup"_s, u"thumbs_up_tone1"_s}));
+        QCOMPARE(names(index.search(u"skin")), QStringList({u"thumbs_up_tone1"_s}));
+        QCOMPARE(names(index.search(u"face")), QStringList({u"grinning"_s, u"smile"_s, u"smiley"_s}));
+    }
+
+    void testCaseInsensitive()
+    {
+        QCOMPARE(names(index.search(u"KDE")), QStringList({u"Kde"_s}));
+        QCOMPARE(names(index.search(u"kd")), QStringList({u"Kde"_s}));
+    }
+
+    void testShortQueries()
+    {
+        QCOMPARE(names(index.search(u"b")), QStringList({u"blobcat_smile"_s, u"smiley"_s, u"thumbsup"_s, u"thumbs_up_tone1"_s}));
+    }
+
+    void testBoosted()
+    {
+        QCOMPARE(names(index.search(u"smi", {u"blobcat_smile"_s})), QStringList({u"smile"_s, u"smiley"_s, u"blobcat_smile"_s}));
+        QCOMPARE(names(index.search(u"grin", {u"smiley"_s})), QStringList({u"grinning"_s, u"smiley"_s, u"smile"_s}));
+    }
+
+    void testNoResults()
+    {
+        QVERIFY(index.search(u"xyz").isEmpty());
+        QVERIFY(index.search(u"smilez").isEmpty());
+    }
+
+    void testEmptyQuery()
+    {
+        QCOMPARE(index.search(u"").size(), index.size());
+    }
+
+    void testFind()
+    {
+        QCOMPARE(index.find(u"thumbsup"_s).toString(), u"thumbsup"_s);
+        QVERIFY(!index.find(u"thumbs"_s).isValid());
+    }
+};
+
+QTEST_MAIN(EmojiSearchIndexTest)
+#include "emojisearchindextest.moc"
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest/QtTest>
+
+#include "utils/entityid.h"
+
+using namespace Qt::Literals::StringLiterals;
+
+class EntityIdTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testParsing_data()
+    {
+        QTest::addColumn<QString>("id");
+        QTest::addColumn<bool>("numeric");
+
+        QTest::newRow("snowflake") << u"109225016418193536"_s << true;
+        QTest::newRow("small") << u"7"_s << true;
+        QTest::newRow("zero") << u"0"_s << true;
+        QTest::newRow("maximum") << u"18446744073709551615"_s << true;
+        QTest::newRow("overflow") << u"18446744073709551616"_s << false;
+        QTest::newRow("leading zero") << u"0123"_s << false;
+        QTest::newRow("pleroma") << u"AbCdEfGhIjKlMnOpQr"_s << false;
+        QTest::newRow("misskey") << u"9kq2x8yz0a"_s << false;
+        QTest::newRow("sign") << u"+123"_s << false;
+    }
+
+    void testParsing()
+    {
+        QFETCH(QString, id);
+        QFETCH(bool, numeric);
+
+        const EntityId entityId(id);
+        QCOMPARE(entityId.isNumeric(), numeric);
+        QCOMPARE(entityId.toString(), id);
+        QVERIFY(!entityId.isNull());
+    }
+
+    void testNull()
+    {
+        QVERIFY(EntityId().isNull());
+        QVERIFY(EntityId(QString()).isNull());
+        QCOMPARE(EntityId(), EntityId(QString()));
+        QVERIFY(EntityId() < EntityId(u"1"_s));
+    }
+
+    void testFromJson()
+    {
+        QCOMPARE(EntityId::fromJson(QJsonValue(u"109225016418193536"_s)).toUInt64(), 109225016418193536ULL);
+        QCOMPARE(EntityId::fromJson(QJsonValue(42)), EntityId(u"42"_s));
+        QVERIFY(EntityId::fromJson(QJsonValue()).isNull());
+    }
+
+    void testOrdering()
+    {
+        // A string comparison would get these wrong
+        QVERIFY(EntityId(u"99"_s) < EntityId(u"100"_s));
+        QVERIFY(EntityId(u"109225016418193536"_s) > EntityId(u"99999999999999999"_s));
+        QVERIFY(EntityId(u"100"_s) <= EntityId(u"100"_s));
+        QVERIFY(EntityId(u"100"_s) >= EntityId(u"100"_s));
+
+        // Flake ids are ordered by length, then alphabetically
+        QVERIFY(EntityId(u"AbC"_s) < EntityId(u"AbD"_s));
+        QVERIFY(EntityId(u"zz"_s) < EntityId(u"AAA"_s));
+
+        // Mixed ids are ordered the same way
+        QVERIFY(EntityId(u"99"_s) < EntityId(u"0ab"_s));
+        QVERIFY(EntityId(u"0ab"_s) < EntityId(u"100"_s));
+    }
+
+    void testHash()
+    {
+        QCOMPARE(qHash(EntityId(u"123"_s)), qHash(EntityId(u"123"_s)));
+        QCOMPARE(qHash(EntityId(u"abc"_s)), qHash(EntityId(u"abc"_s)));
+
+        QSet<EntityId> ids{EntityId(u"123"_s), EntityId(u"abc"_s)};
+        QVERIFY(ids.contains(EntityId(u"123"_s)));
+        QVERIFY(ids.contains(EntityId(u"abc"_s)));
+        QVERIFY(!ids.contains(EntityId(u"0123"_s)));
+    }
+};
+
+QTEST_MAIN(EntityIdTest)
+#include "entityidtest.moc"
@@ -5,20 +5,27 @@
 
 #include <QFile>
 #include <QNetworkReply>
+#include <QNetworkRequest>
 
 class TestReply : public QNetworkReply
 {
 public:
-    TestReply(const QString &jsonFile, QObject *parent)
+    TestReply(const QString &jsonFile, QObject *parent, int statusCode = 200)
         : QNetworkReply(parent)
     {
-        setError(NetworkError::NoError, QString());
+        setError(statusCode < 400 ? NetworkError::NoError : NetworkError::ContentNotFoundError, QString());
+        setAttribute(QNetworkRequest::HttpStatusCodeAttribute, statusCode);
         setFinished(true);
 
         apiResult.setFileName(QLatin1String(DATA_DIR) + QLatin1Char('/') + jsonFile);
         apiResult.open(QIODevice::ReadOnly);
     }
 
+    void setHeader(const QByteArray &name, const QByteArray &value)
+    {
+        setRawHeader(name, value);
+    }
+
     qint64 readData(char *data, qint64 maxSize) override
     {
         return apiResult.read(data, maxSize);
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest/QtTest>
+
+#include "account/identity.h"
+#include "account/identitycache.h"
+#include "autotests/mockaccount.h"
+
+using namespace Qt::Literals::StringLiterals;
+
+class IdentityCacheTest : public QObject
+{
+    Q_OBJECT
+
+    static std::shared_ptr<Identity> makeIdentity(const QString &id)
+    {
+        auto identity = std::make_shared<Identity>();
+        identity->fromSourceData(QJsonObject{{u"id"_s, id}});
+        return identity;
+    }
+
+private Q_SLOTS:
+    void testLookup()
+    {
+        IdentityCache cache;
+
+        // Both numeric and other ids, which aren't confused with each other
+        cache.insert(u"109225016418193536"_s, makeIdentity(u"109225016418193536"_s));
+        cache.insert(u"AbCdEf123"_s, makeIdentity(u"AbCdEf123"_s));
+        cache.insert(u"42"_s, makeIdentity(u"42"_s));
+
+        QCOMPARE(cache.find(u"109225016418193536"_s)->id(), u"109225016418193536"_s);
+        QCOMPARE(cache.find(u"AbCdEf123"_s)->id(), u"AbCdEf123"_s);
+        QCOMPARE(cache.find(u"42"_s)->id(), u"42"_s);
+        QCOMPARE(cache.find(u"042"_s), nullptr);
+        QCOMPARE(cache.find(u"abcdef123"_s), nullptr);
+        QVERIFY(cache.contains(u"AbCdEf123"_s));
+        QVERIFY(!cache.contains(u"43"_s));
+
+        QCOMPARE(cache.statistics().hits, 3);
+        QCOMPARE(cache.statistics().misses, 2);
+    }
+
+    void testEviction()
+    {
+        IdentityCache cache(2);
+
+        const auto referenced = makeIdentity(u"1"_s);
+        cache.insert(u"1"_s, referenced);
+        cache.insert(u"2"_s, makeIdentity(u"2"_s));
+        cache.insert(u"3"_s, makeIdentity(u"3"_s));
+
+        // The least recently used identity is still referenced, so the next one goes instead
+        QCOMPARE(cache.size(), 2);
+        QVERIFY(cache.contains(u"1"_s));
+        QVERIFY(!cache.contains(u"2"_s));
+        QVERIFY(cache.contains(u"3"_s));
+        QCOMPARE(cache.statistics().evictions, 1);
+
+    }
+
+    void testLeastRecentlyUsed()
+    {
+        IdentityCache cache(2);
+
+        cache.insert(u"1"_s, makeIdentity(u"1"_s));
+        cache.insert(u"user"_s, makeIdentity(u"user"_s));
+
+        // Using an identity keeps it around
+        QVERIFY(cache.find(u"1"_s));
+        cache.insert(u"3"_s, makeIdentity(u"3"_s));
+        QVERIFY(cache.contains(u"1"_s));
+        QVERIFY(!cache.contains(u"user"_s));
+        QVERIFY(cache.contains(u"3"_s));
+
+        // Evicted ids can be added again
+        cache.insert(u"user"_s, makeIdentity(u"user"_s));
+        QCOMPARE(cache.find(u"user"_s)->id(), u"user"_s);
+        QCOMPARE(cache.statistics().evictions, 2);
+    }
+
+    void testEvictionWhenEverythingIsReferenced()
+    {
+        IdentityCache cache(1);
+
+        const auto first = makeIdentity(u"1"_s);
+        const auto second = makeIdentity(u"2"_s);
+        cache.insert(u"1"_s, first);
+        cache.insert(u"2"_s, second);
+
+        // Nothing can be evicted, so the cache grows past its capacity
+        QCOMPARE(cache.size(), 2);
+        QCOMPARE(cache.statistics().evictions, 0);
+    }
+
+    void testRefresh()
+    {
+        IdentityCache fresh(IdentityCache::defaultCapacity, std::chrono::hours(1));
+        fresh.insert(u"1"_s, makeIdentity(u"1"_s));
+        QVERIFY(!fresh.refreshDue(u"1"_s));
+        QVERIFY(!fresh.refreshDue(u"2"_s));
+
+        IdentityCache stale(IdentityCache::defaultCapacity, std::chrono::milliseconds(0));
+        stale.insert(u"1"_s, makeIdentity(u"1"_s));
+        QVERIFY(stale.refreshDue(u"1"_s));
+        QCOMPARE(stale.statistics().refreshes, 1);
+    }
+
+    void testForcedUpdate()
+    {
+        MockAccount account;
+        const auto identity = account.identityLookup(u"1"_s, QJsonObject{{u"id"_s, u"1"_s}, {u"display_name"_s, u"Old"_s}});
+
+        // Coming with another post right after, it's left alone
+        account.identityLookup(u"1"_s, QJsonObject{{u"id"_s, u"1"_s}, {u"display_name"_s, u"Newer"_s}});
+        QCOMPARE(identity->displayName(), u"Old"_s);
+
+        // The profile was fetched on its own, so it's always used
+        QCOMPARE(account.identityLookup(u"1"_s, QJsonObject{{u"id"_s, u"1"_s}, {u"display_name"_s, u"Profile"_s}}, true), identity);
+        QCOMPARE(identity->displayName(), u"Profile"_s);
+    }
+};
+
+QTEST_MAIN(IdentityCacheTest)
+#include "identitycachetest.moc"
@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest/QtTest>
+
+#include "account/identity.h"
+
+using namespace Qt::Literals::StringLiterals;
+
+class IdentityTest : public QObject
+{
+    Q_OBJECT
+
+    static QJsonObject account(const QString &note)
+    {
+        return QJsonObject{
+            {u"id"_s, u"1"_s},
+            {u"username"_s, u"Gargron"_s},
+            {u"acct"_s, u"Gargron"_s},
+            {u"display_name"_s, u"Eugen <3 :kde:"_s},
+            {u"url"_s, u"https://mastodon.social/@Gargron"_s},
+            {u"note"_s, note},
+            {u"emojis"_s, QJsonArray{QJsonObject{{u"shortcode"_s, u"kde"_s}, {u"url"_s, u"https://kde.org"_s}, {u"static_url"_s, u"https://kde.org"_s}}}},
+        };
+    }
+
+private Q_SLOTS:
+    void testDerivedFields()
+    {
+        Identity identity;
+        identity.fromSourceData(account(u"<p>Working on <a href=\"https://mastodon.social/tags/KDE\">#KDE</a> :kde:</p>"_s));
+
+        QCOMPARE(identity.displayName(), u"Eugen &lt;3 :kde:"_s);
+        QCOMPARE(identity.displayNameHtml(), u"Eugen &lt;3 <img height=\"16\" align=\"middle\" width=\"16\" src=\"image://customemoji/aHR0cHM6Ly9rZGUub3Jn\">"_s);
+        QCOMPARE(identity.bio(),
+                 u"<p>Working on <a href=\"hashtag:/KDE\">#KDE</a> <img height=\"16\" align=\"middle\" width=\"16\" src=\"image://customemoji/aHR0cHM6Ly9rZGUub3Jn\"></p>"_s);
+
+        // Newer data replaces what was made from the old one
+        identity.fromSourceData(account(u"<p>Hello</p>"_s));
+        QCOMPARE(identity.bio(), u"<p>Hello</p>"_s);
+
+        auto unnamed = account({});
+        unnamed[u"display_name"_s] = QString();
+        identity.fromSourceData(unnamed);
+        QCOMPARE(identity.displayNameHtml(), u"Gargron"_s);
+    }
+
+    void benchmarkFromSourceData_data()
+    {
+        QTest::addColumn<bool>("showProfile");
+
+        // Most identities are only shown as the author of a post, the bio only matters once their profile is opened
+        QTest::addRow("author") << false;
+        QTest::addRow("profile") << true;
+    }
+
+    void benchmarkFromSourceData()
+    {
+        QFETCH(bool, showProfile);
+
+        const auto doc = account(
+            u"<p>Developer of Mastodon and administrator of <a href=\"https://mastodon.social/tags/mastodon\">#mastodon</a> :kde:</p><p>Also at <a href=\"https://example.com/@gargron\">@gargron@example.com</a></p>"_s);
+
+        QBENCHMARK {
+            Identity identity;
+            identity.fromSourceData(doc);
+            identity.displayNameHtml();
+            if (showProfile) {
+                identity.bio();
+            }
+        }
+    }
+};
+
+QTEST_MAIN(IdentityTest)
+#include "identitytest.moc"
@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest/QtTest>
+
+#include "editor/mediapreprocessor.h"
+
+using namespace Qt::Literals::StringLiterals;
+
+class MediaPreprocessorTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testTargetSize()
+    {
+        AbstractAccount::MediaAttachmentLimits limits;
+        limits.imageMatrixLimit = 1000 * 1000;
+
+        QCOMPARE(MediaPreprocessor::targetSize(QSize(800, 600), limits), QSize(800, 600));
+        QCOMPARE(MediaPreprocessor::targetSize(QSize(1000, 1000), limits), QSize(1000, 1000));
+
+        const QSize downsized = MediaPreprocessor::targetSize(QSize(4000, 2000), limits);
+        QVERIFY(static_cast<qint64>(downsized.width()) * downsized.height() <= limits.imageMatrixLimit);
+        QCOMPARE(downsized.width() / 2, downsized.height());
+
+        // We never upload more than the server would keep, even if it accepts larger images
+        limits.imageMatrixLimit = 10000 * 10000;
+        const QSize capped = MediaPreprocessor::targetSize(QSize(8000, 6000), limits);
+        QVERIFY(static_cast<qint64>(capped.width()) * capped.height() <= MediaPreprocessor::maximumImagePixels);
+    }
+
+    void testProcessImage()
+    {
+        AbstractAccount::MediaAttachmentLimits limits;
+        limits.imageMatrixLimit = 200 * 100;
+
+        QImage image(400, 200, QImage::Format_RGB32);
+        image.fill(Qt::red);
+
+        const PreparedMedia media = MediaPreprocessor::processImage(image, u"photo"_s, limits);
+        QVERIFY(media.isValid());
+        QCOMPARE(media.size, QSize(200, 100));
+        QCOMPARE(media.mimeType, u"image/jpeg"_s);
+        QCOMPARE(media.fileName, u"photo.jpeg"_s);
+        QVERIFY(media.previewUrl.startsWith("data:image/jpeg;base64,"_L1));
+        QVERIFY(!media.blurhash.isEmpty());
+
+        QImage decoded;
+        QVERIFY(decoded.loadFromData(media.data, "JPEG"));
+        QCOMPARE(decoded.size(), QSize(200, 100));
+    }
+
+    void testProcessTransparentImage()
+    {
+        QImage image(64, 64, QImage::Format_ARGB32);
+        image.fill(Qt::transparent);
+
+        const PreparedMedia media = MediaPreprocessor::processImage(image, u"pasted"_s, {});
+        QCOMPARE(media.mimeType, u"image/png"_s);
+        QCOMPARE(media.fileName, u"pasted.png"_s);
+    }
+
+    void testProcessImageSizeLimit()
+    {
+        AbstractAccount::MediaAttachmentLimits limits;
+        limits.imageSizeLimit = 64 * 1024;
+
+        // Noise doesn't compress well, so this has to be downsized to fit
+        QImage image(512, 512, QImage::Format_RGB32);
+        QRandomGenerator generator(42);
+        for (int y = 0; y < image.height(); y++) {
+            for (int x = 0; x < image.width(); x++) {
+                image.setPixel(x, y, generator.generate() | 0xff000000);
+            }
+        }
+
+        const PreparedMedia media = MediaPreprocessor::processImage(image, u"noise"_s, limits);
+        QVERIFY(media.isValid());
+        QVERIFY(media.data.size() <= limits.imageSizeLimit);
+        QVERIFY(media.size.width() < 512);
+    }
+
+    void testProcessFileAsIs()
+    {
+        QTemporaryDir dir;
+        const QString path = dir.filePath(u"notes.txt"_s);
+
+        QFile file(path);
+        QVERIFY(file.open(QIODevice::WriteOnly));
+        file.write("not an image");
+        file.close();
+
+        const PreparedMedia media = MediaPreprocessor::processFile(path, {});
+        QVERIFY(media.isValid());
+        QVERIFY(media.data.isEmpty());
+        QCOMPARE(media.localPath, path);
+        QCOMPARE(media.fileName, u"notes.txt"_s);
+        QVERIFY(media.previewUrl.isEmpty());
+    }
+};
+
+QTEST_MAIN(MediaPreprocessorTest)
+#include "mediapreprocessortest.moc"
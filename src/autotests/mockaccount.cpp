@@ -33,12 +33,18 @@ void MockAccount::get(const QUrl &url,
     if (m_getReplies.contains(url)) {
         auto reply = m_getReplies[url];
         reply->open(QIODevice::ReadOnly);
-        callback(reply);
+        // Like with a real account, unsuccessful replies go to the error callback
+        if (reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() >= 400) {
+            if (errorCallback)
+                errorCallback(reply);
+        } else {
+            callback(reply);
+        }
         reply->seek(0);
     } else {
         qWarning() << url << m_getReplies;
         if (errorCallback)
-            errorCallback(nullptr);
+            errorCallback(new TestReply({}, this, 404));
     }
 }
 
@@ -130,6 +136,15 @@ QNetworkReply *MockAccount::upload(const QUrl &filename, std::function<void(QNet
     return nullptr;
 }
 
+QNetworkReply *MockAccount::upload(const QByteArray &data, const QString &fileName, const QString &mimeType, std::function<void(QNetworkReply *)> callback)
+{
+    Q_UNUSED(data)
+    Q_UNUSED(fileName)
+    Q_UNUSED(mimeType)
+    Q_UNUSED(callback)
+    return nullptr;
+}
+
 void MockAccount::requestRemoteObject(const QUrl &url, QObject *parent, std::function<void(QNetworkReply *)> callback)
 {
     Q_UNUSED(url)
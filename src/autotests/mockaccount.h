@@ -36,6 +36,7 @@ public:
     void put(const QUrl &url, const QUrlQuery &doc, bool authenticated, QObject *parent, std::function<void(QNetworkReply *)> callback) override;
 
     QNetworkReply *upload(const QUrl &filename, std::function<void(QNetworkReply *)> callback) override;
+    QNetworkReply *upload(const QByteArray &data, const QString &fileName, const QString &mimeType, std::function<void(QNetworkReply *)> callback) override;
 
     void requestRemoteObject(const QUrl &url, QObject *parent, std::function<void(QNetworkReply *)> callback) override;
 
@@ -72,9 +73,22 @@ public:
     Q_INVOKABLE void increaseFollowRequests();
     Q_INVOKABLE void decreaseFollowRequests();
 
+    void setStatusIndexPath(const QString &path)
+    {
+        m_statusIndexPath = path;
+    }
+
+protected:
+    QString statusIndexPath() const override
+    {
+        // Tests shouldn't find statuses seen in earlier runs, unless they ask for it
+        return m_statusIndexPath;
+    }
+
 private:
     void readNotificationFromFile(QLatin1String filename);
 
     QHash<QUrl, QNetworkReply *> m_postReplies;
     QHash<QUrl, QNetworkReply *> m_getReplies;
+    QString m_statusIndexPath;
 };
@@ -0,0 +1,177 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest/QtTest>
+
+#include "network/networkdiskcache.h"
+
+using namespace Qt::Literals::StringLiterals;
+
+class NetworkDiskCacheTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void testClassify_data()
+    {
+        QTest::addColumn<QUrl>("url");
+        QTest::addColumn<NetworkDiskCache::ContentClass>("contentClass");
+
+        QTest::newRow("api") << QUrl(u"https://mastodon.example/api/v1/timelines/home"_s) << NetworkDiskCache::Api;
+        QTest::newRow("avatar") << QUrl(u"https://files.example/accounts/avatars/000/000/001/original/abc.png"_s) << NetworkDiskCache::Avatar;
+        QTest::newRow("header") << QUrl(u"https://files.example/accounts/headers/000/000/001/original/abc.png"_s) << NetworkDiskCache::Avatar;
+        QTest::newRow("emoji") << QUrl(u"https://files.example/custom_emojis/images/000/181/127/static/63bd.png"_s) << NetworkDiskCache::Emoji;
+        QTest::newRow("preview") << QUrl(u"https://files.example/media_attachments/files/000/000/001/small/abc.png"_s) << NetworkDiskCache::Preview;
+        QTest::newRow("card") << QUrl(u"https://files.example/preview_cards/images/000/000/001/original/abc.png"_s) << NetworkDiskCache::Preview;
+        QTest::newRow("original") << QUrl(u"https://files.example/media_attachments/files/000/000/001/original/abc.png"_s) << NetworkDiskCache::Original;
+    }
+
+    void testClassify()
+    {
+        QFETCH(QUrl, url);
+        QFETCH(NetworkDiskCache::ContentClass, contentClass);
+
+        QCOMPARE(NetworkDiskCache::classify(url), contentClass);
+    }
+
+    void testInsertAndRead()
+    {
+        QTemporaryDir dir;
+        NetworkDiskCache cache(dir.path());
+
+        const QUrl url(u"https://files.example/accounts/avatars/000/000/001/original/abc.png"_s);
+        QVERIFY(!cache.metaData(url).isValid());
+        QCOMPARE(cache.statistics(NetworkDiskCache::Avatar).misses, 1);
+
+        insert(cache, url, QByteArray(100, 'a'));
+
+        QCOMPARE(cache.metaData(url).url(), url);
+
+        std::unique_ptr<QIODevice> device(cache.data(url));
+        QVERIFY(device);
+        QCOMPARE(device->readAll(), QByteArray(100, 'a'));
+
+        const auto stats = cache.statistics(NetworkDiskCache::Avatar);
+        QCOMPARE(stats.hits, 1);
+        QCOMPARE(stats.entries, 1);
+        QVERIFY(stats.size > 100);
+
+        // Other classes are untouched
+        QCOMPARE(cache.statistics(NetworkDiskCache::Original).entries, 0);
+
+        QVERIFY(cache.remove(url));
+        QVERIFY(!cache.data(url));
+        QCOMPARE(cache.cacheSize(), 0);
+    }
+
+    void testUpdateMetaData()
+    {
+        QTemporaryDir dir;
+        NetworkDiskCache cache(dir.path());
+
+        const QUrl url(u"https://files.example/accounts/avatars/000/000/001/original/abc.png"_s);
+        insert(cache, url, QByteArray(100, 'a'));
+
+        QNetworkCacheMetaData metaData = cache.metaData(url);
+        metaData.setRawHeaders({{QByteArrayLiteral("ETag"), QByteArrayLiteral("\"abc\"")}});
+        cache.updateMetaData(metaData);
+
+        // Revalidating isn't a hit
+        QCOMPARE(cache.statistics(NetworkDiskCache::Avatar).hits, 0);
+        QCOMPARE(cache.metaData(url).rawHeaders(), metaData.rawHeaders());
+
+        std::unique_ptr<QIODevice> device(cache.data(url));
+        QVERIFY(device);
+        QCOMPARE(device->readAll(), QByteArray(100, 'a'));
+        QCOMPARE(cache.statistics(NetworkDiskCache::Avatar).entries, 1);
+    }
+
+    void testCorruptEntry()
+    {
+        QTemporaryDir dir;
+        NetworkDiskCache cache(dir.path());
+
+        const QUrl url(u"https://files.example/accounts/avatars/000/000/001/original/abc.png"_s);
+        insert(cache, url, QByteArray(100, 'a'));
+
+        // Keep the header, but cut the entry short
+        QDirIterator it(dir.path(), QDir::Files, QDirIterator::Subdirectories);
+        QVERIFY(it.hasNext());
+        QFile file(it.next());
+        QVERIFY(file.open(QIODevice::ReadWrite));
+        QVERIFY(file.resize(2 * sizeof(quint32) + 1));
+        file.close();
+
+        QVERIFY(!cache.metaData(url).isValid());
+        QVERIFY(!file.exists());
+        QCOMPARE(cache.statistics(NetworkDiskCache::Avatar).entries, 0);
+    }
+
+    void testSharedStore()
+    {
+        QTemporaryDir dir;
+        NetworkDiskCache cache(dir.path());
+        NetworkDiskCache otherCache(dir.path());
+
+        const QUrl url(u"https://mastodon.example/api/v1/instance"_s);
+        insert(cache, url, QByteArrayLiteral("{}"));
+
+        std::unique_ptr<QIODevice> device(otherCache.data(url));
+        QVERIFY(device);
+        QCOMPARE(otherCache.statistics(NetworkDiskCache::Api).hits, 1);
+    }
+
+    void testEviction()
+    {
+        QTemporaryDir dir;
+        NetworkDiskCache cache(dir.path());
+        cache.setMaximumCacheSize(NetworkDiskCache::Original, 40 * 1024);
+
+        const auto url = [](int i) {
+            return QUrl(u"https://files.example/media_attachments/files/%1/original/image.png"_s.arg(i));
+        };
+
+        // Fill the budget, and keep using the first entry
+        for (int i = 0; i < 3; i++) {
+            insert(cache, url(i), QByteArray(10 * 1024, 'a'));
+        }
+        for (int i = 0; i < 5; i++) {
+            delete cache.data(url(0));
+        }
+
+        // This doesn't fit anymore, so the least frequently used entries have to go
+        insert(cache, url(3), QByteArray(10 * 1024, 'a'));
+
+        QTRY_VERIFY(cache.statistics(NetworkDiskCache::Original).evictions > 0);
+        QVERIFY(cache.statistics(NetworkDiskCache::Original).size <= 40 * 1024);
+
+        std::unique_ptr<QIODevice> device(cache.data(url(0)));
+        QVERIFY(device);
+
+        // A full other tier doesn't touch the avatars
+        const QUrl avatarUrl(u"https://files.example/accounts/avatars/000/000/001/original/abc.png"_s);
+        insert(cache, avatarUrl, QByteArray(10 * 1024, 'a'));
+        for (int i = 4; i < 10; i++) {
+            insert(cache, url(i), QByteArray(10 * 1024, 'a'));
+        }
+        QTRY_VERIFY(cache.statistics(NetworkDiskCache::Original).size <= 40 * 1024);
+        QCOMPARE(cache.statistics(NetworkDiskCache::Avatar).evictions, 0);
+        QCOMPARE(cache.statistics(NetworkDiskCache::Avatar).entries, 1);
+    }
+
+private:
+    static void insert(NetworkDiskCache &cache, const QUrl &url, const QByteArray &payload)
+    {
+        QNetworkCacheMetaData metaData;
+        metaData.setUrl(url);
+        metaData.setSaveToDisk(true);
+
+        auto device = cache.prepare(metaData);
+        QVERIFY(device);
+        device->write(payload);
+        cache.insert(device);
+    }
+};
+
+QTEST_MAIN(NetworkDiskCacheTest)
+#include "networkdiskcachetest.moc"
@@ -0,0 +1,306 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest/QtTest>
+
+#include "notification/notificationgrouper.h"
+#include "timeline/notification.h"
+
+using namespace Qt::Literals::StringLiterals;
+
+using Key = NotificationGrouper::Key;
+
+// The grouping NotificationGroupingModel did before, which scanned every group for each notification. The grouper has to end up with exactly the
+// same groups in the same order.
+class ReferenceGrouping
+{
+public:
+    explicit ReferenceGrouping(const QList<Key> &keys)
+        : m_keys(keys)
+    {
+        for (int i = 0; i < m_keys.size(); ++i) {
+            m_rowMap.push_back({i});
+        }
+        checkGrouping();
+    }
+
+    void insert(int start, const QList<Key> &keys)
+    {
+        for (int i = 0; i < keys.size(); ++i) {
+            m_keys.insert(start + i, keys[i]);
+        }
+        adjustMap(start, static_cast<int>(keys.size()));
+
+        for (int i = start; i < start + keys.size(); ++i) {
+            if (!tryToGroup(i)) {
+                m_rowMap.push_back({i});
+            }
+        }
+        checkGrouping();
+    }
+
+    void remove(int first, int last)
+    {
+        for (int i = first; i <= last; ++i) {
+            for (int j = 0; j < m_rowMap.size(); ++j) {
+                const int mapIndex = m_rowMap[j].indexOf(i);
+                if (mapIndex != -1) {
+                    if (m_rowMap[j].size() == 1) {
+                        m_rowMap.removeAt(j);
+                    } else {
+                        m_rowMap[j].removeAt(mapIndex);
+                    }
+                    break;
+                }
+            }
+        }
+
+        m_keys.remove(first, last - first + 1);
+        adjustMap(first + 1, -(last - first + 1));
+        checkGrouping();
+    }
+
+    QList<QList<int>> groups() const
+    {
+        return m_rowMap;
+    }
+
+private:
+    bool notificationsMatch(int a, int b) const
+    {
+        const Key &aKey = m_keys[a];
+        const Key &bKey = m_keys[b];
+
+        if (aKey.type == bKey.type
+            && (aKey.type == Notification::Follow || aKey.type == Notification::Poll || aKey.type == Notification::Update
+                || aKey.type == Notification::Status || aKey.type == Notification::AdminSignUp)) {
+            return false;
+        }
+
+        return aKey.id == bKey.id && aKey.type == bKey.type;
+    }
+
+    bool tryToGroup(int row)
+    {
+        for (auto &group : m_rowMap) {
+            if (group.constFirst() == row) {
+                continue;
+            }
+            if (notificationsMatch(row, group.constFirst())) {
+                group.push_back(row);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void checkGrouping()
+    {
+        for (int i = static_cast<int>(m_rowMap.size()) - 1; i >= 0; --i) {
+            if (m_rowMap[i].size() > 1) {
+                continue;
+            }
+            if (tryToGroup(m_rowMap[i].constFirst())) {
+                m_rowMap.removeAt(i);
+            }
+        }
+    }
+
+    void adjustMap(int anchor, int delta)
+    {
+        for (auto &group : m_rowMap) {
+            for (int &row : group) {
+                if (row >= anchor) {
+                    row += delta;
+                }
+            }
+        }
+    }
+
+    QList<Key> m_keys;
+    QList<QList<int>> m_rowMap;
+};
+
+class NotificationGrouperTest : public QObject
+{
+    Q_OBJECT
+
+    static Key randomKey(QRandomGenerator &random)
+    {
+        // Few posts and every type, so there's plenty to group and plenty that can't be
+        return {QString::number(random.bounded(6)), random.bounded(Notification::AdminSignUp + 1)};
+    }
+
+    static void insert(NotificationGrouper &grouper, int start, const QList<Key> &keys)
+    {
+        grouper.insertSourceRows(start, static_cast<int>(keys.size()));
+        for (int i = 0; i < keys.size(); ++i) {
+            if (const auto group = grouper.findGroup(keys[i])) {
+                grouper.addToGroup(group, start + i);
+            } else {
+                grouper.addGroup(start + i, keys[i]);
+            }
+        }
+    }
+
+    static void remove(NotificationGrouper &grouper, int first, int last)
+    {
+        for (int i = first; i <= last; ++i) {
+            grouper.removeFromGroup(i);
+        }
+        grouper.removeSourceRows(first, last - first + 1);
+    }
+
+    static void verifyLookups(const NotificationGrouper &grouper)
+    {
+        const auto groups = grouper.groups();
+        QCOMPARE(grouper.groupCount(), static_cast<int>(groups.size()));
+
+        for (int row = 0; row < groups.size(); ++row) {
+            const auto group = grouper.groupAt(row);
+            QVERIFY(group);
+            QCOMPARE(grouper.groupRow(group), row);
+            QCOMPARE(grouper.groupSize(group), static_cast<int>(groups[row].size()));
+
+            for (int i = 0; i < groups[row].size(); ++i) {
+                QCOMPARE(grouper.memberRow(group, i), groups[row][i]);
+                QCOMPARE(grouper.groupOf(groups[row][i]), group);
+                QCOMPARE(grouper.memberIndex(groups[row][i]), i);
+            }
+        }
+    }
+
+private Q_SLOTS:
+    void testGrouping()
+    {
+        NotificationGrouper grouper;
+        grouper.reset({
+            {u"1"_s, Notification::Favorite},
+            {u"1"_s, Notification::Repeat},
+            {u"1"_s, Notification::Favorite},
+            {u"2"_s, Notification::Favorite},
+            {u"1"_s, Notification::Favorite},
+            {u"3"_s, Notification::Follow},
+            {u"3"_s, Notification::Follow},
+        });
+
+        // Follows are never grouped, and the first notification leads its group
+        const QList<QList<int>> expected{{0, 4, 2}, {1}, {3}, {5}, {6}};
+        QCOMPARE(grouper.groups(), expected);
+        verifyLookups(grouper);
+
+        insert(grouper, 0, {{u"2"_s, Notification::Favorite}});
+        const QList<QList<int>> afterInsert{{1, 5, 3}, {2}, {4, 0}, {6}, {7}};
+        QCOMPARE(grouper.groups(), afterInsert);
+        verifyLookups(grouper);
+
+        remove(grouper, 1, 2);
+        const QList<QList<int>> afterRemove{{3, 1}, {2, 0}, {4}, {5}};
+        QCOMPARE(grouper.groups(), afterRemove);
+        verifyLookups(grouper);
+    }
+
+    void testFront()
+    {
+        NotificationGrouper grouper;
+        grouper.reset({
+            {u"1"_s, Notification::Favorite},
+            {u"2"_s, Notification::Favorite},
+            {u"3"_s, Notification::Favorite},
+        });
+
+        // Streamed notifications are prepended, and go on top along with the group they join
+        grouper.insertSourceRows(0, 2);
+        const auto group = grouper.findGroup({u"2"_s, Notification::Favorite});
+        grouper.moveToFront(group);
+        grouper.addToGroup(group, 1);
+        grouper.addGroupToFront(0, {u"4"_s, Notification::Favorite});
+
+        const QList<QList<int>> afterPrepend{{0}, {3, 1}, {2}, {4}};
+        QCOMPARE(grouper.groups(), afterPrepend);
+        verifyLookups(grouper);
+
+        grouper.moveToFront(grouper.groupAt(3));
+        const QList<QList<int>> afterMove{{4}, {0}, {3, 1}, {2}};
+        QCOMPARE(grouper.groups(), afterMove);
+        verifyLookups(grouper);
+
+        remove(grouper, 0, 0);
+        const QList<QList<int>> afterRemove{{3}, {2, 0}, {1}};
+        QCOMPARE(grouper.groups(), afterRemove);
+        verifyLookups(grouper);
+    }
+
+    void testMatchesReference_data()
+    {
+        QTest::addColumn<quint32>("seed");
+
+        for (quint32 seed = 1; seed <= 50; ++seed) {
+            QTest::addRow("seed %u", seed) << seed;
+        }
+    }
+
+    void testMatchesReference()
+    {
+        QFETCH(quint32, seed);
+        QRandomGenerator random(seed);
+
+        QList<Key> keys;
+        const int initialCount = random.bounded(40);
+        for (int i = 0; i < initialCount; ++i) {
+            keys.push_back(randomKey(random));
+        }
+
+        ReferenceGrouping reference(keys);
+        NotificationGrouper grouper;
+        grouper.reset(keys);
+        QCOMPARE(grouper.groups(), reference.groups());
+
+        int rows = initialCount;
+        for (int step = 0; step < 300; ++step) {
+            if (rows == 0 || random.bounded(100) < 55) {
+                // New notifications mostly arrive at the top or the bottom
+                const int position = random.bounded(3) == 0 ? random.bounded(rows + 1) : (random.bounded(2) == 0 ? 0 : rows);
+                QList<Key> inserted;
+                const int count = random.bounded(1, 5);
+                for (int i = 0; i < count; ++i) {
+                    inserted.push_back(randomKey(random));
+                }
+
+                reference.insert(position, inserted);
+                insert(grouper, position, inserted);
+                rows += count;
+            } else {
+                const int first = random.bounded(rows);
+                const int last = std::min(rows - 1, first + random.bounded(4));
+
+                reference.remove(first, last);
+                remove(grouper, first, last);
+                rows -= last - first + 1;
+            }
+
+            QCOMPARE(grouper.groups(), reference.groups());
+        }
+
+        verifyLookups(grouper);
+    }
+
+    void benchmarkManyFavorites()
+    {
+        // An account with thousands of favorites spread over a few hundred posts
+        QRandomGenerator random(42);
+        QList<Key> keys;
+        for (int i = 0; i < 5000; ++i) {
+            keys.push_back({QString::number(random.bounded(300)), Notification::Favorite});
+        }
+
+        QBENCHMARK {
+            NotificationGrouper grouper;
+            grouper.reset(keys);
+            insert(grouper, 0, keys);
+        }
+    }
+};
+
+QTEST_MAIN(NotificationGrouperTest)
+#include "notificationgroupertest.moc"
@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest/QtTest>
+
+#include "account/notificationavatarcache.h"
+#include "account/notificationhandler.h"
+
+#include <KLocalizedString>
+
+#include <QNetworkAccessManager>
+
+using namespace Qt::Literals::StringLiterals;
+
+class NotificationHandlerTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        KLocalizedString::setApplicationDomain(QByteArrayLiteral("tokodon"));
+        KLocalizedString::setLanguages(QStringList{QStringLiteral("C")});
+    }
+
+    void testTitle()
+    {
+        QCOMPARE(NotificationHandler::title(Notification::Favorite, u"Bob"_s), u"Bob favorited your post"_s);
+        QCOMPARE(NotificationHandler::title(Notification::Favorite, u"Bob"_s, 2), u"Bob and one other favorited your post"_s);
+        QCOMPARE(NotificationHandler::title(Notification::Repeat, u"Bob"_s, 58), u"Bob and 57 others boosted your post"_s);
+        QCOMPARE(NotificationHandler::title(Notification::Follow, u"Bob"_s), u"Bob followed you"_s);
+    }
+
+    void testRoundedAvatar()
+    {
+        QImage image(300, 200, QImage::Format_ARGB32);
+        image.fill(Qt::red);
+
+        const QImage rounded = NotificationAvatarCache::roundedAvatar(image);
+        QCOMPARE(rounded.size(), QSize(NotificationAvatarCache::maximumSize, NotificationAvatarCache::maximumSize));
+        QCOMPARE(qAlpha(rounded.pixel(0, 0)), 0);
+        QCOMPARE(QColor(rounded.pixel(rounded.width() / 2, rounded.height() / 2)), QColor(Qt::red));
+
+        QVERIFY(NotificationAvatarCache::roundedAvatar({}).isNull());
+    }
+
+    void testAvatarCache()
+    {
+        QNetworkAccessManager nam;
+        NotificationAvatarCache cache(&nam);
+        const QUrl url = QUrl::fromLocalFile(QLatin1String(DATA_DIR) + "/test.png"_L1);
+
+        // Both requests share one download
+        int loaded = 0;
+        cache.avatar(url, this, [&loaded](const QImage &avatar) {
+            QVERIFY(!avatar.isNull());
+            loaded++;
+        });
+        cache.avatar(url, this, [&loaded](const QImage &avatar) {
+            QVERIFY(!avatar.isNull());
+            loaded++;
+        });
+        QCOMPARE(loaded, 0);
+        QTRY_COMPARE(loaded, 2);
+        QCOMPARE(cache.size(), 1);
+
+        // Now it's cached
+        cache.avatar(url, this, [&loaded](const QImage &) {
+            loaded++;
+        });
+        QCOMPARE(loaded, 3);
+
+        // Callbacks for contexts that are gone are dropped
+        auto context = new QObject;
+        bool called = false;
+        cache.avatar(QUrl::fromLocalFile(QLatin1String(DATA_DIR) + "/blurhash.png"_L1), context, [&called](const QImage &) {
+            called = true;
+        });
+        delete context;
+        QTRY_COMPARE(cache.size(), 2);
+        QVERIFY(!called);
+    }
+};
+
+QTEST_MAIN(NotificationHandlerTest)
+#include "notificationhandlertest.moc"
@@ -0,0 +1,257 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest/QtTest>
+
+#include "autotests/helperreply.h"
+#include "autotests/mockaccount.h"
+#include "notification/notificationgroupingmodel.h"
+#include "notification/notificationmodel.h"
+
+using namespace Qt::Literals::StringLiterals;
+
+class NotificationModelTest : public QObject
+{
+    Q_OBJECT
+
+    static QJsonObject readNotification(const QString &fileName)
+    {
+        QFile file(QLatin1String(DATA_DIR) + QLatin1Char('/') + fileName);
+        file.open(QIODevice::ReadOnly);
+        return QJsonDocument::fromJson(file.readAll()).object();
+    }
+
+    static QUrl groupedUrl(MockAccount *account)
+    {
+        QUrlQuery query;
+        query.addQueryItem(QStringLiteral("grouped_types[]"), QStringLiteral("favourite"));
+        query.addQueryItem(QStringLiteral("grouped_types[]"), QStringLiteral("reblog"));
+
+        auto url = account->apiUrl(QStringLiteral("/api/v2/notifications"));
+        url.setQuery(query);
+        return url;
+    }
+
+    static void stream(MockAccount *account, const QJsonObject &notification)
+    {
+        Q_EMIT account->streamingEvent(AbstractAccount::NotificationEvent, QJsonDocument(notification).toJson(QJsonDocument::Compact));
+    }
+
+private Q_SLOTS:
+    void testGroupedByServer()
+    {
+        auto account = new MockAccount();
+        account->registerGet(groupedUrl(account), new TestReply(QStringLiteral("notifications-grouped.json"), account));
+        AccountManager::instance().addAccount(account, false);
+        AccountManager::instance().selectAccount(account, false);
+
+        NotificationModel model;
+        QVERIFY(model.groupedByServer());
+        QCOMPARE(model.rowCount({}), 4);
+
+        const auto favorites = model.index(0, 0);
+        QCOMPARE(favorites.data(AbstractTimelineModel::TypeRole).toInt(), static_cast<int>(Notification::Favorite));
+        QVERIFY(favorites.data(AbstractTimelineModel::IsGroupRole).toBool());
+        QCOMPARE(favorites.data(AbstractTimelineModel::NumInGroupRole).toInt(), 3);
+
+        const auto actors = favorites.data(AbstractTimelineModel::NotificationActorIdentityRole).toList();
+        QCOMPARE(actors.size(), 3);
+        QCOMPARE(actors[0].value<Identity *>()->username(), QStringLiteral("bob"));
+        QCOMPARE(actors[2].value<Identity *>()->username(), QStringLiteral("dave"));
+
+        const auto mention = model.index(1, 0);
+        QCOMPARE(mention.data(AbstractTimelineModel::TypeRole).toInt(), static_cast<int>(Notification::Mention));
+        QVERIFY(!mention.data(AbstractTimelineModel::IsGroupRole).toBool());
+        QCOMPARE(mention.data(AbstractTimelineModel::NumInGroupRole).toInt(), -1);
+        QCOMPARE(mention.data(AbstractTimelineModel::NotificationActorIdentityRole).value<Identity *>()->username(), QStringLiteral("bob"));
+
+        // Both groups are about the same status, which is only sent and parsed once
+        QVERIFY(model.internalData(favorites)->post() != nullptr);
+        QCOMPARE(model.internalData(favorites)->post(), model.internalData(mention)->post());
+        QCOMPARE(model.internalData(favorites)->post()->id().toString(), QStringLiteral("113010503322889311"));
+
+        // The same goes for accounts, so every group shares one identity for each of them
+        QCOMPARE(actors[0].value<Identity *>(), mention.data(AbstractTimelineModel::NotificationActorIdentityRole).value<Identity *>());
+
+        // Follows aren't grouped, since their delegate shows a single account
+        const auto follow = model.index(2, 0);
+        QCOMPARE(follow.data(AbstractTimelineModel::TypeRole).toInt(), static_cast<int>(Notification::Follow));
+        QVERIFY(!follow.data(AbstractTimelineModel::IsGroupRole).toBool());
+        QCOMPARE(follow.data(AbstractTimelineModel::NumInGroupRole).toInt(), -1);
+        QCOMPARE(follow.data(AbstractTimelineModel::NotificationActorIdentityRole).value<Identity *>()->username(), QStringLiteral("dave"));
+        QVERIFY(model.internalData(follow)->post() == nullptr);
+        QCOMPARE(model.internalData(follow)->id().toString(), QStringLiteral("196010"));
+
+        const auto otherFollow = model.index(3, 0);
+        QCOMPARE(otherFollow.data(AbstractTimelineModel::TypeRole).toInt(), static_cast<int>(Notification::Follow));
+        QCOMPARE(otherFollow.data(AbstractTimelineModel::NotificationActorIdentityRole).value<Identity *>()->username(), QStringLiteral("carol"));
+    }
+
+    void testGroupedNextPage()
+    {
+        auto account = new MockAccount();
+        auto nextUrl = account->apiUrl(QStringLiteral("/api/v2/notifications"));
+        nextUrl.setQuery(QStringLiteral("max_id=196009"));
+
+        auto firstPage = new TestReply(QStringLiteral("notifications-grouped.json"), account);
+        firstPage->setHeader(QByteArrayLiteral("Link"), QStringLiteral("<%1>; rel=\"next\"").arg(nextUrl.toString()).toUtf8());
+        account->registerGet(groupedUrl(account), firstPage);
+        account->registerGet(nextUrl, new TestReply(QStringLiteral("notifications-grouped-page2.json"), account));
+        AccountManager::instance().addAccount(account, false);
+        AccountManager::instance().selectAccount(account, false);
+
+        // Having another page doesn't change which API the first one came from
+        NotificationModel model;
+        QVERIFY(model.groupedByServer());
+        QCOMPARE(model.rowCount({}), 4);
+
+        QVERIFY(model.canFetchMore({}));
+        model.fetchMore({});
+        QVERIFY(model.groupedByServer());
+        QCOMPARE(model.rowCount({}), 5);
+        QCOMPARE(model.index(4, 0).data(AbstractTimelineModel::NotificationActorIdentityRole).value<Identity *>()->username(), QStringLiteral("alice"));
+    }
+
+    void testFallbackToV1()
+    {
+        auto account = new MockAccount();
+        account->registerGet(groupedUrl(account), new TestReply({}, account, 404));
+        account->registerGet(account->apiUrl(QStringLiteral("/api/v1/notifications")), new TestReply(QStringLiteral("notifications.json"), account));
+        AccountManager::instance().addAccount(account, false);
+        AccountManager::instance().selectAccount(account, false);
+
+        NotificationModel model;
+        QVERIFY(!model.groupedByServer());
+        QCOMPARE(model.rowCount({}), 2);
+
+        const auto favorite = model.index(0, 0);
+        QCOMPARE(favorite.data(AbstractTimelineModel::TypeRole).toInt(), static_cast<int>(Notification::Favorite));
+        QVERIFY(!favorite.data(AbstractTimelineModel::IsGroupRole).toBool());
+        QCOMPARE(model.internalData(favorite)->groupSize(), 1);
+        QCOMPARE(model.internalData(favorite)->identity()->username(), QStringLiteral("bob"));
+    }
+
+    void testServerError()
+    {
+        auto account = new MockAccount();
+        account->registerGet(groupedUrl(account), new TestReply({}, account, 500));
+        account->registerGet(account->apiUrl(QStringLiteral("/api/v1/notifications")), new TestReply(QStringLiteral("notifications.json"), account));
+        AccountManager::instance().addAccount(account, false);
+        AccountManager::instance().selectAccount(account, false);
+
+        // The server knows grouped notifications but failed this time, which isn't a reason to stop using them
+        NotificationModel model;
+        QCOMPARE(model.rowCount({}), 0);
+        QVERIFY(!model.loading());
+
+        account->registerGet(groupedUrl(account), new TestReply(QStringLiteral("notifications-grouped.json"), account));
+        model.fillTimeline();
+        QVERIFY(model.groupedByServer());
+        QCOMPARE(model.rowCount({}), 4);
+    }
+
+    void testStreaming()
+    {
+        auto account = new MockAccount();
+        account->registerGet(account->apiUrl(QStringLiteral("/api/v1/notifications")), new TestReply(QStringLiteral("notifications.json"), account));
+        AccountManager::instance().addAccount(account, false);
+        AccountManager::instance().selectAccount(account, false);
+
+        NotificationModel model;
+        NotificationGroupingModel groupingModel;
+        groupingModel.setSourceModel(&model);
+        QCOMPARE(model.rowCount({}), 2);
+        QCOMPARE(groupingModel.rowCount({}), 2);
+
+        // Another favorite of the status at the top joins its group
+        auto favorite = readNotification(QStringLiteral("notification_favorite.json"));
+        favorite["id"_L1] = QStringLiteral("34975900");
+        auto status = favorite["status"_L1].toObject();
+        status["id"_L1] = QStringLiteral("113010503322889311");
+        favorite["status"_L1] = status;
+        stream(account, favorite);
+
+        auto follow = readNotification(QStringLiteral("notification_follow.json"));
+        follow["id"_L1] = QStringLiteral("34975901");
+        stream(account, follow);
+
+        // Both arrive in one batch, newest first
+        QCOMPARE(model.rowCount({}), 2);
+        QTRY_COMPARE(model.rowCount({}), 4);
+        QCOMPARE(model.internalData(model.index(0, 0))->id().toString(), QStringLiteral("34975901"));
+        QCOMPARE(model.internalData(model.index(1, 0))->id().toString(), QStringLiteral("34975900"));
+
+        QCOMPARE(groupingModel.rowCount({}), 3);
+        QCOMPARE(groupingModel.index(0, 0).data(AbstractTimelineModel::TypeRole).toInt(), static_cast<int>(Notification::Follow));
+        QVERIFY(groupingModel.index(1, 0).data(AbstractTimelineModel::IsGroupRole).toBool());
+        QCOMPARE(groupingModel.index(1, 0).data(AbstractTimelineModel::NumInGroupRole).toInt(), 2);
+
+        // Notifications we already have are skipped
+        stream(account, follow);
+        QTest::qWait(1000);
+        QCOMPARE(model.rowCount({}), 4);
+    }
+
+    void testStreamingGroupedByServer()
+    {
+        auto account = new MockAccount();
+        account->registerGet(groupedUrl(account), new TestReply(QStringLiteral("notifications-grouped.json"), account));
+        AccountManager::instance().addAccount(account, false);
+        AccountManager::instance().selectAccount(account, false);
+
+        NotificationModel model;
+        QVERIFY(model.groupedByServer());
+        QCOMPARE(model.rowCount({}), 4);
+
+        // Another favorite of the status joins the group the server sent
+        auto favorite = readNotification(QStringLiteral("notification_favorite.json"));
+        favorite["id"_L1] = QStringLiteral("196020");
+        favorite["group_key"_L1] = QStringLiteral("favourite-113010503322889311-479000");
+        auto status = favorite["status"_L1].toObject();
+        status["id"_L1] = QStringLiteral("113010503322889311");
+        favorite["status"_L1] = status;
+        stream(account, favorite);
+
+        // Follows keep their own rows, even though the server gives them a shared group key
+        auto follow = readNotification(QStringLiteral("notification_follow.json"));
+        follow["id"_L1] = QStringLiteral("196021");
+        follow["group_key"_L1] = QStringLiteral("follow-479000");
+        stream(account, follow);
+        follow["id"_L1] = QStringLiteral("196022");
+        stream(account, follow);
+
+        QTRY_COMPARE(model.rowCount({}), 6);
+        QCOMPARE(model.internalData(model.index(0, 0))->id().toString(), QStringLiteral("196022"));
+        QCOMPARE(model.internalData(model.index(1, 0))->id().toString(), QStringLiteral("196021"));
+
+        const auto favorites = model.index(2, 0);
+        QCOMPARE(favorites.data(AbstractTimelineModel::TypeRole).toInt(), static_cast<int>(Notification::Favorite));
+        QCOMPARE(favorites.data(AbstractTimelineModel::NumInGroupRole).toInt(), 4);
+    }
+
+    void testMissedWhileReconnecting()
+    {
+        auto account = new MockAccount();
+        account->registerGet(account->apiUrl(QStringLiteral("/api/v1/notifications")), new TestReply(QStringLiteral("notifications.json"), account));
+
+        auto missedUrl = account->apiUrl(QStringLiteral("/api/v1/notifications"));
+        missedUrl.setQuery(QUrlQuery{
+            {QStringLiteral("since_id"), QStringLiteral("196014")},
+            {QStringLiteral("limit"), QString::number(NotificationModel::missedNotificationsLimit)},
+        });
+        account->registerGet(missedUrl, new TestReply(QStringLiteral("notifications-missed.json"), account));
+
+        AccountManager::instance().addAccount(account, false);
+        AccountManager::instance().selectAccount(account, false);
+
+        NotificationModel model;
+        QCOMPARE(model.rowCount({}), 2);
+
+        Q_EMIT account->streamingReconnected(QStringLiteral("user"));
+        QTRY_COMPARE(model.rowCount({}), 3);
+        QCOMPARE(model.internalData(model.index(0, 0))->id().toString(), QStringLiteral("34975950"));
+    }
+};
+
+QTEST_MAIN(NotificationModelTest)
+#include "notificationmodeltest.moc"
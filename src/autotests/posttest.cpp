@@ -6,6 +6,13 @@
 #include "autotests/mockaccount.h"
 #include "utils/texthandler.h"
 
+#if defined(__GLIBC__)
+#include <malloc.h>
+#if __GLIBC_PREREQ(2, 33)
+#define HAVE_MALLINFO2
+#endif
+#endif
+
 using namespace Qt::Literals::StringLiterals;
 
 class PostTest : public QObject
@@ -36,7 +43,71 @@ private Q_SLOTS:
         QCOMPARE(post.wasEdited(), false);
 
         QCOMPARE(post.authorIdentity()->displayName(), QStringLiteral("Eugen :kde:"));
-        QCOMPARE(post.authorIdentity()->displayNameHtml(), QStringLiteral("Eugen <img height=\"16\" align=\"middle\" width=\"16\" src=\"https://kde.org\">"));
+        QCOMPARE(post.authorIdentity()->displayNameHtml(), QStringLiteral("Eugen <img height=\"16\" align=\"middle\" width=\"16\" src=\"image://customemoji/aHR0cHM6Ly9rZGUub3Jn\">"));
+    }
+
+    void testCardAndApplication()
+    {
+        MockAccount account;
+
+        QFile statusExampleApi;
+        statusExampleApi.setFileName(QLatin1String(DATA_DIR) + QLatin1Char('/') + "status.json"_L1);
+        statusExampleApi.open(QIODevice::ReadOnly);
+
+        const auto doc = QJsonDocument::fromJson(statusExampleApi.readAll());
+        Post post(&account, doc.object());
+        Post other(&account, doc.object());
+
+        const auto card = post.card();
+        QVERIFY(card.has_value());
+        QCOMPARE(card->title(), QStringLiteral("‘I lost my £193,000 inheritance – with one wrong digit on my sort code’"));
+        QCOMPARE(card->providerName(), QStringLiteral("www.theguardian.com"));
+        QCOMPARE(card->width(), 400);
+        QCOMPARE(card->height(), 210);
+        QCOMPARE(qreal(card->width()) / card->height(), 1200.0 / 630.0);
+        QCOMPARE(card->url().host(), QStringLiteral("www.theguardian.com"));
+
+        const auto application = post.application();
+        QVERIFY(application.has_value());
+        QCOMPARE(application->name(), QStringLiteral("Web"));
+        QVERIFY(application->website().isEmpty());
+
+        // Strings that repeat between posts are shared
+        QCOMPARE(post.language(), QStringLiteral("en"));
+        QCOMPARE(post.language().constData(), other.language().constData());
+        QCOMPARE(application->name().constData(), other.application()->name().constData());
+        QCOMPARE(card->providerName().constData(), other.card()->providerName().constData());
+    }
+
+    void benchmarkMemoryPerPost()
+    {
+#ifdef HAVE_MALLINFO2
+        MockAccount account;
+
+        QFile statusExampleApi;
+        statusExampleApi.setFileName(QLatin1String(DATA_DIR) + QLatin1Char('/') + "status.json"_L1);
+        statusExampleApi.open(QIODevice::ReadOnly);
+
+        const auto obj = QJsonDocument::fromJson(statusExampleApi.readAll()).object();
+
+        // Warm up the author identity and interned strings, so they aren't counted
+        Post warmup(&account, obj);
+
+        constexpr int postCount = 1000;
+        std::vector<std::unique_ptr<Post>> posts;
+        posts.reserve(postCount);
+
+        const auto before = mallinfo2().uordblks;
+        for (int i = 0; i < postCount; i++) {
+            posts.push_back(std::make_unique<Post>(&account, obj));
+        }
+        const auto after = mallinfo2().uordblks;
+
+        qInfo() << "Memory per post:" << (after - before) / postCount << "bytes";
+        QVERIFY(after > before);
+#else
+        QSKIP("Measuring heap usage needs glibc 2.33 or later");
+#endif
     }
 
     void testFromJsonWithPoll()
@@ -67,8 +138,17 @@ private Q_SLOTS:
         QCOMPARE(options.count(), 2);
         QCOMPARE(options[0]["title"_L1], QStringLiteral("accept"));
         QCOMPARE(options[0]["votesCount"_L1], 6);
-        QCOMPARE(options[1]["title"_L1], QStringLiteral("deny <img height=\"16\" align=\"middle\" width=\"16\" src=\"https://kde.org\">"));
+        QCOMPARE(options[1]["title"_L1], QStringLiteral("deny <img height=\"16\" align=\"middle\" width=\"16\" src=\"image://customemoji/aHR0cHM6Ly9rZGUub3Jn\">"));
         QCOMPARE(options[1]["votesCount"_L1], 4);
+
+        const auto value = post.pollValue();
+        QCOMPARE(value.value<Poll>().id(), QStringLiteral("34830"));
+        QCOMPARE(post.pollValue().constData(), value.constData());
+
+        // Old posts are cached until the next minute, and the same text is returned meanwhile
+        const auto relativeTime = post.relativeTime();
+        QVERIFY(relativeTime.endsWith(QStringLiteral("ago")));
+        QCOMPARE(post.relativeTime().constData(), relativeTime.constData());
     }
 
     // Normal case
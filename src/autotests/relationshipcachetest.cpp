@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest/QtTest>
+
+#include "account/relationship.h"
+#include "account/relationshipcache.h"
+#include "autotests/helperreply.h"
+#include "autotests/mockaccount.h"
+
+using namespace Qt::Literals::StringLiterals;
+
+class RelationshipCacheTest : public QObject
+{
+    Q_OBJECT
+
+    QUrl relationshipsUrl(const QStringList &accountIds) const
+    {
+        QUrlQuery query;
+        for (const auto &accountId : accountIds) {
+            query.addQueryItem(QStringLiteral("id[]"), accountId);
+        }
+
+        auto url = account->apiUrl(QStringLiteral("/api/v1/accounts/relationships"));
+        url.setQuery(query);
+        return url;
+    }
+
+    std::shared_ptr<Identity> identity(const QString &accountId)
+    {
+        return account->identityLookup(accountId, QJsonObject{{u"id"_s, accountId}, {u"acct"_s, u"user"_s + accountId}});
+    }
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        account = new MockAccount();
+    }
+
+    void testBatching()
+    {
+        QStringList accountIds;
+        for (int i = 1; i <= RelationshipCache::maximumBatchSize + 1; i++) {
+            accountIds.push_back(QString::number(i));
+        }
+
+        // Anything else, like asking for an account twice, wouldn't match these
+        account->registerGet(relationshipsUrl(accountIds.mid(0, RelationshipCache::maximumBatchSize)), new TestReply(u"relationships.json"_s, account));
+        account->registerGet(relationshipsUrl(accountIds.mid(RelationshipCache::maximumBatchSize)), new TestReply(u"relationships.json"_s, account));
+
+        const auto first = identity(u"1"_s);
+        const auto second = identity(u"2"_s);
+
+        RelationshipCache cache(account);
+        cache.request(accountIds.mid(0, 20));
+        cache.request(u"1"_s);
+        cache.request(accountIds.mid(20));
+        QVERIFY(cache.isPending(u"1"_s));
+        QVERIFY(!cache.contains(u"1"_s));
+
+        QTRY_VERIFY(!cache.isPending(u"41"_s));
+        QVERIFY(!cache.isPending(u"1"_s));
+        QVERIFY(cache.contains(u"1"_s));
+        QVERIFY(cache.contains(u"2"_s));
+        QVERIFY(!cache.contains(u"3"_s));
+
+        // They're set on the identities right away
+        QVERIFY(first->relationship() != nullptr);
+        QVERIFY(first->relationship()->following());
+        QVERIFY(second->relationship() != nullptr);
+        QVERIFY(second->relationship()->requested());
+
+        // Known relationships aren't fetched again
+        cache.request(u"1"_s);
+        QVERIFY(!cache.isPending(u"1"_s));
+    }
+
+    void testUpdates()
+    {
+        account->registerGet(relationshipsUrl({u"2"_s}), new TestReply(u"relationships.json"_s, account));
+
+        const auto second = identity(u"2"_s);
+
+        RelationshipCache cache(account);
+        cache.update(QJsonObject{{u"id"_s, u"2"_s}, {u"blocking"_s, true}});
+        QVERIFY(cache.contains(u"2"_s));
+        QVERIFY(second->relationship()->blocking());
+        QVERIFY(!second->relationship()->requested());
+
+        // It's shown, so it's fetched again
+        cache.invalidate(u"2"_s);
+        QVERIFY(!cache.contains(u"2"_s));
+        QVERIFY(cache.isPending(u"2"_s));
+        QTRY_VERIFY(cache.contains(u"2"_s));
+        QVERIFY(!second->relationship()->blocking());
+        QVERIFY(second->relationship()->requested());
+
+        // Nobody has seen this one, so it's only forgotten
+        cache.invalidate(u"100"_s);
+        QVERIFY(!cache.isPending(u"100"_s));
+
+        RelationshipCache expiringCache(account, std::chrono::milliseconds::zero());
+        expiringCache.update(QJsonObject{{u"id"_s, u"2"_s}});
+        QVERIFY(!expiringCache.contains(u"2"_s));
+    }
+
+    void testFailure()
+    {
+        account->registerGet(relationshipsUrl({u"7"_s}), new TestReply({}, account, 500));
+
+        RelationshipCache cache(account);
+        cache.request(u"7"_s);
+        QVERIFY(cache.isPending(u"7"_s));
+        QTRY_VERIFY(!cache.isPending(u"7"_s));
+        QVERIFY(!cache.contains(u"7"_s));
+        QVERIFY(cache.hasFailed(u"7"_s));
+
+        // It's not asked for again right away, like when the row showing it is drawn again
+        cache.request(u"7"_s);
+        QVERIFY(!cache.isPending(u"7"_s));
+
+        // Until it's known to have changed
+        cache.invalidate(u"7"_s);
+        QVERIFY(!cache.hasFailed(u"7"_s));
+    }
+
+    void testStreaming()
+    {
+        account->registerGet(relationshipsUrl({u"1"_s}), new TestReply(u"relationships.json"_s, account));
+
+        const auto first = identity(u"1"_s);
+        first->relationship()->setFollowedBy(false);
+
+        const auto cache = account->relationshipCache();
+        cache->update(QJsonObject{{u"id"_s, u"1"_s}, {u"following"_s, true}});
+        QVERIFY(!first->relationship()->followedBy());
+
+        // Being followed changes the relationship
+        QFile notification(QLatin1String(DATA_DIR) + QLatin1Char('/') + "notification_follow.json"_L1);
+        QVERIFY(notification.open(QIODevice::ReadOnly));
+        Q_EMIT account->streamingEvent(AbstractAccount::NotificationEvent, notification.readAll());
+
+        QVERIFY(cache->isPending(u"1"_s));
+        QTRY_VERIFY(first->relationship()->followedBy());
+    }
+
+private:
+    MockAccount *account = nullptr;
+};
+
+QTEST_MAIN(RelationshipCacheTest)
+#include "relationshipcachetest.moc"
@@ -3,10 +3,13 @@
 
 #include <QtTest/QtTest>
 
+#include "account/statusindex.h"
 #include "autotests/helperreply.h"
 #include "autotests/mockaccount.h"
 #include "search/searchmodel.h"
 
+using namespace Qt::Literals::StringLiterals;
+
 class SearchTest : public QObject
 {
     Q_OBJECT
@@ -21,14 +24,12 @@ private Q_SLOTS:
 
     void testModel()
     {
-        QUrl url = account->apiUrl(QStringLiteral("/api/v2/search"));
-        url.setQuery(QUrlQuery{{QStringLiteral("q"), QStringLiteral("myQuery")}, {QStringLiteral("resolve"), QStringLiteral("true")}});
-        account->registerGet(url, new TestReply(QStringLiteral("search-result.json"), account));
+        account->registerGet(searchUrl(u"myQuery"_s, false), new TestReply(QStringLiteral("search-result.json"), account));
 
         SearchModel searchModel;
         searchModel.search(QStringLiteral("myQuery"));
 
-        QCOMPARE(searchModel.rowCount({}), 3);
+        QTRY_COMPARE(searchModel.rowCount({}), 3);
         QCOMPARE(searchModel.data(searchModel.index(0, 0), AbstractTimelineModel::TypeRole), SearchModel::Account);
         QCOMPARE(searchModel.data(searchModel.index(1, 0), AbstractTimelineModel::TypeRole), SearchModel::Status);
         QCOMPARE(searchModel.data(searchModel.index(0, 0), AbstractTimelineModel::AuthorIdentityRole).value<Identity *>()->avatarUrl(),
@@ -37,7 +38,90 @@ private Q_SLOTS:
                  QUrl(QStringLiteral("https://files.mastodon.social/accounts/avatars/000/000/001/original/d96d39a0abb45b92.jpg")));
     }
 
+    void testNeedsResolving()
+    {
+        QVERIFY(SearchModel::needsResolving(u"@Gargron@mastodon.social"_s));
+        QVERIFY(SearchModel::needsResolving(u"Gargron@mastodon.social"_s));
+        QVERIFY(SearchModel::needsResolving(u"https://mastodon.social/@Gargron/103270115826048975"_s));
+        QVERIFY(!SearchModel::needsResolving(u"Gargron"_s));
+        QVERIFY(!SearchModel::needsResolving(u"@Gargron"_s));
+        QVERIFY(!SearchModel::needsResolving(u"kde plasma"_s));
+    }
+
+    void testResolve()
+    {
+        // The server is only asked to look further if it didn't know about the account yet
+        account->registerGet(searchUrl(u"@Gargron@mastodon.social"_s, false), new TestReply(QStringLiteral("search-empty.json"), account));
+        account->registerGet(searchUrl(u"@Gargron@mastodon.social"_s, true), new TestReply(QStringLiteral("search-result.json"), account));
+
+        SearchModel searchModel;
+        searchModel.search(QStringLiteral("@Gargron@mastodon.social"));
+        QTRY_VERIFY(searchModel.loaded());
+        QCOMPARE(searchModel.rowCount({}), 3);
+        QVERIFY(!searchModel.loading());
+        QVERIFY(searchModel.typesWithMoreResults().isEmpty());
+    }
+
+    void testCache()
+    {
+        account->registerGet(searchUrl(u"cached"_s, false), new TestReply(QStringLiteral("search-result.json"), account));
+
+        SearchModel searchModel;
+        searchModel.search(QStringLiteral("cached"));
+        QTRY_COMPARE(searchModel.rowCount({}), 3);
+
+        // Only the last of several quick searches is sent
+        account->registerGet(searchUrl(u"cached"_s, false), new TestReply(QStringLiteral("search-empty.json"), account));
+        searchModel.search(QStringLiteral("other"));
+        searchModel.search(QStringLiteral("cached"));
+        QVERIFY(searchModel.loaded());
+
+        // Recent results are shown right away, without asking the server again
+        QCOMPARE(searchModel.rowCount({}), 3);
+        QVERIFY(!searchModel.loading());
+
+        searchModel.clear();
+        QCOMPARE(searchModel.rowCount({}), 0);
+        QVERIFY(!searchModel.loaded());
+    }
+
+    void testSeenStatuses()
+    {
+        QFile file(QLatin1String(DATA_DIR) + "/status.json"_L1);
+        QVERIFY(file.open(QIODevice::ReadOnly));
+        account->statusIndex()->add(QJsonArray{QJsonDocument::fromJson(file.readAll()).object()});
+
+        // Seen statuses are found even if the server doesn't find them
+        account->registerGet(searchUrl(u"lorem"_s, false), new TestReply(QStringLiteral("search-empty.json"), account));
+
+        SearchModel searchModel;
+        searchModel.search(QStringLiteral("lorem"));
+        QTRY_COMPARE(searchModel.rowCount({}), 1);
+        QCOMPARE(searchModel.data(searchModel.index(0, 0), AbstractTimelineModel::TypeRole), SearchModel::SeenStatus);
+        QCOMPARE(searchModel.data(searchModel.index(0, 0), AbstractTimelineModel::IdRole).toString(), u"103270115826048975"_s);
+        QTRY_VERIFY(searchModel.loaded());
+        QCOMPARE(searchModel.rowCount({}), 1);
+
+        // But they aren't listed twice if it does
+        account->registerGet(searchUrl(u"LOREM"_s, false), new TestReply(QStringLiteral("search-result.json"), account));
+        searchModel.search(QStringLiteral("LOREM"));
+        QTRY_VERIFY(searchModel.loaded());
+        QCOMPARE(searchModel.rowCount({}), 3);
+        QCOMPARE(searchModel.data(searchModel.index(2, 0), AbstractTimelineModel::TypeRole), SearchModel::Hashtag);
+    }
+
 private:
+    QUrl searchUrl(const QString &query, bool resolve) const
+    {
+        QUrl url = account->apiUrl(QStringLiteral("/api/v2/search"));
+        url.setQuery(QUrlQuery{
+            {QStringLiteral("q"), query},
+            {QStringLiteral("resolve"), resolve ? QStringLiteral("true") : QStringLiteral("false")},
+            {QStringLiteral("limit"), QString::number(SearchModel::pageSize)},
+        });
+        return url;
+    }
+
     MockAccount *account = nullptr;
 };
 
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest/QtTest>
+
+#include "account/accountmanager.h"
+#include "account/relationshipcache.h"
+#include "account/socialgraphmodel.h"
+#include "autotests/helperreply.h"
+#include "autotests/mockaccount.h"
+
+using namespace Qt::Literals::StringLiterals;
+
+class SocialGraphModelTest : public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+    void initTestCase()
+    {
+        account = new MockAccount();
+        AccountManager::instance().addAccount(account, false);
+        AccountManager::instance().selectAccount(account, false);
+    }
+
+    void testFollowers()
+    {
+        auto followersUrl = account->apiUrl(QStringLiteral("/api/v1/accounts/5/followers"));
+        followersUrl.setQuery(QUrlQuery{{QStringLiteral("limit"), QString::number(SocialGraphModel::pageSize)}});
+        account->registerGet(followersUrl, new TestReply(u"followers.json"_s, account));
+
+        auto relationshipsUrl = account->apiUrl(QStringLiteral("/api/v1/accounts/relationships"));
+        relationshipsUrl.setQuery(QUrlQuery{{QStringLiteral("id[]"), QStringLiteral("1")}, {QStringLiteral("id[]"), QStringLiteral("2")}});
+        account->registerGet(relationshipsUrl, new TestReply(u"relationships.json"_s, account));
+
+        SocialGraphModel model;
+        model.setName(u"followers"_s);
+        model.setAccountId(u"5"_s);
+        QCOMPARE(model.rowCount({}), 2);
+
+        // There's no link to another page
+        QVERIFY(!static_cast<QAbstractItemModel &>(model).canFetchMore({}));
+
+        const auto first = model.data(model.index(0, 0), SocialGraphModel::IdentityRole).value<AccountSummary>();
+        QCOMPARE(first.id(), u"1"_s);
+        QCOMPARE(first.account(), u"Gargron"_s);
+        QCOMPARE(first.displayNameHtml(), u"Eugen <img height=\"16\" align=\"middle\" width=\"16\" src=\"image://customemoji/aHR0cHM6Ly9rZGUub3Jn\">"_s);
+        QCOMPARE(first.avatarUrl(), QUrl(u"https://files.mastodon.social/accounts/avatars/000/000/001/original/d96d39a0abb45b92.jpg"_s));
+
+        const auto second = model.data(model.index(1, 0), SocialGraphModel::IdentityRole).value<AccountSummary>();
+        QCOMPARE(second.displayNameHtml(), u"alice"_s);
+
+        // Listing them doesn't make identities
+        QVERIFY(!account->identityCached(u"1"_s));
+        QVERIFY(!account->identityCached(u"2"_s));
+
+        // Reading the rows doesn't fetch anything
+        QVERIFY(model.data(model.index(0, 0), SocialGraphModel::RelationshipRole).toJsonObject().isEmpty());
+        QVERIFY(!account->relationshipCache()->isPending(u"1"_s));
+
+        // The relationships of the rows that were shown are fetched together
+        QSignalSpy dataChangedSpy(&model, &QAbstractItemModel::dataChanged);
+        model.rowShown(0);
+        model.rowShown(1);
+        QVERIFY(model.data(model.index(0, 0), SocialGraphModel::RelationshipRole).toJsonObject().isEmpty());
+        QVERIFY(model.data(model.index(1, 0), SocialGraphModel::RelationshipRole).toJsonObject().isEmpty());
+        QTRY_COMPARE(dataChangedSpy.count(), 2);
+        QVERIFY(model.data(model.index(0, 0), SocialGraphModel::RelationshipRole).toJsonObject()["following"_L1].toBool());
+        QVERIFY(model.data(model.index(1, 0), SocialGraphModel::RelationshipRole).toJsonObject()["requested"_L1].toBool());
+    }
+
+private:
+    MockAccount *account = nullptr;
+};
+
+QTEST_MAIN(SocialGraphModelTest)
+#include "socialgraphmodeltest.moc"
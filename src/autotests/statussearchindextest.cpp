@@ -0,0 +1,192 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <QtTest/QtTest>
+
+#include "account/accountmanager.h"
+#include "account/statusindex.h"
+#include "autotests/mockaccount.h"
+#include "utils/statussearchindex.h"
+
+#include <QBuffer>
+#include <QJsonArray>
+
+using namespace Qt::Literals::StringLiterals;
+
+class StatusSearchIndexTest : public QObject
+{
+    Q_OBJECT
+
+    static QJsonObject status(const QString &id, const QString &content, const QString &acct = u"alice"_s)
+    {
+        return QJsonObject{
+            {u"id"_s, id},
+            {u"content"_s, content},
+            {u"spoiler_text"_s, QString()},
+            {u"account"_s, QJsonObject{{u"acct"_s, acct}, {u"display_name"_s, acct}}},
+        };
+    }
+
+    static QStringList ids(const QList<QJsonObject> &statuses)
+    {
+        QStringList ids;
+        for (const auto &status : statuses) {
+            ids.push_back(status["id"_L1].toString());
+        }
+        return ids;
+    }
+
+private Q_SLOTS:
+    void testWords()
+    {
+        QCOMPARE(StatusSearchIndex::words(u"Café au LAIT, s'il-vous-plaît!"_s),
+                 (QStringList{u"cafe"_s, u"au"_s, u"lait"_s, u"s"_s, u"il"_s, u"vous"_s, u"plait"_s}));
+        QCOMPARE(StatusSearchIndex::plainText(u"<p>Tom &amp; Jerry<br>rock&#39;n&#x27;roll</p>"_s), u" Tom & Jerry rock'n'roll "_s);
+    }
+
+    void testSearch()
+    {
+        StatusSearchIndex index;
+        index.add(status(u"1"_s, u"<p>The quick brown fox</p>"_s));
+        index.add(status(u"2"_s, u"<p>A quick brown dog</p>"_s, u"bob@example.com"_s));
+        index.add(status(u"10"_s, u"<p>Brown foxes are <a href=\"https://example.com/tags/quick\">#<span>quick</span></a></p>"_s));
+
+        // Newest first, and every word is a prefix
+        QCOMPARE(ids(index.search(u"brown"_s, 10)), (QStringList{u"10"_s, u"2"_s, u"1"_s}));
+        QCOMPARE(ids(index.search(u"QUI fox"_s, 10)), (QStringList{u"10"_s, u"1"_s}));
+        QCOMPARE(ids(index.search(u"brown"_s, 2)), (QStringList{u"10"_s, u"2"_s}));
+        QCOMPARE(ids(index.search(u"bob"_s, 10)), (QStringList{u"2"_s}));
+        QVERIFY(index.search(u"cat"_s, 10).isEmpty());
+        QVERIFY(index.search(u"!!"_s, 10).isEmpty());
+
+        // Phrases have to be in order, and only their last word is a prefix
+        QCOMPARE(ids(index.search(u"\"quick brown\""_s, 10)), (QStringList{u"2"_s, u"1"_s}));
+        QCOMPARE(ids(index.search(u"\"brown fo\""_s, 10)), (QStringList{u"10"_s, u"1"_s}));
+        QVERIFY(index.search(u"\"qui brown\""_s, 10).isEmpty());
+        QVERIFY(index.search(u"\"brown quick\""_s, 10).isEmpty());
+
+        // The status is returned as it was added
+        QCOMPARE(index.search(u"dog"_s, 1).constFirst()["content"_L1].toString(), u"<p>A quick brown dog</p>"_s);
+    }
+
+    void testUpdates()
+    {
+        StatusSearchIndex index(2);
+
+        // Boosts are indexed as the status they boost
+        auto boost = status(u"5"_s, QString());
+        boost[u"reblog"_s] = status(u"3"_s, u"<p>boosted words</p>"_s);
+        index.add(boost);
+        QCOMPARE(ids(index.search(u"boosted"_s, 10)), QStringList{u"3"_s});
+
+        // Edits replace what was indexed before
+        index.add(status(u"3"_s, u"<p>edited words</p>"_s));
+        QVERIFY(index.search(u"boosted"_s, 10).isEmpty());
+        QCOMPARE(ids(index.search(u"words"_s, 10)), QStringList{u"3"_s});
+        QCOMPARE(index.size(), qsizetype(1));
+
+        // The statuses added longest ago go first
+        index.add(status(u"1"_s, u"<p>more words</p>"_s));
+        index.add(status(u"2"_s, u"<p>even more words</p>"_s));
+        QCOMPARE(index.size(), qsizetype(2));
+        QCOMPARE(ids(index.search(u"words"_s, 10)), (QStringList{u"2"_s, u"1"_s}));
+
+        index.remove(u"2"_s);
+        QCOMPARE(ids(index.search(u"words"_s, 10)), QStringList{u"1"_s});
+        QVERIFY(index.search(u"even"_s, 10).isEmpty());
+
+        // Direct messages are never saved to disk
+        auto direct = status(u"4"_s, u"<p>secret words</p>"_s);
+        direct[u"visibility"_s] = u"direct"_s;
+        index.add(direct);
+        QVERIFY(index.search(u"secret"_s, 10).isEmpty());
+        QCOMPARE(ids(index.search(u"words"_s, 10)), QStringList{u"1"_s});
+    }
+
+    void testRemovedWithAccount()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString path = dir.filePath(u"status_index"_s);
+
+        // Left from an earlier session
+        {
+            StatusSearchIndex index;
+            index.add(status(u"1"_s, u"<p>followers only</p>"_s));
+            QFile file(path);
+            QVERIFY(file.open(QIODevice::WriteOnly));
+            index.save(&file);
+        }
+
+        auto account = new MockAccount();
+        account->setStatusIndexPath(path);
+        AccountManager::instance().addAccount(account, false);
+        account->statusIndex()->add(QJsonArray{status(u"2"_s, u"<p>more followers only</p>"_s)});
+
+        AccountManager::instance().removeAccount(account);
+        QTRY_VERIFY(!QFile::exists(path));
+
+        // Nothing is found or saved anymore
+        bool searched = false;
+        account->statusIndex()->search(u"followers"_s, 10, this, [&searched](const QList<QJsonObject> &statuses) {
+            QVERIFY(statuses.isEmpty());
+            searched = true;
+        });
+        QTRY_VERIFY(searched);
+        account->statusIndex()->add(QJsonArray{status(u"3"_s, u"<p>followers only again</p>"_s)});
+        delete account;
+        QVERIFY(!QFile::exists(path));
+    }
+
+    void testSaveAndLoad()
+    {
+        StatusSearchIndex index;
+        index.add(status(u"1"_s, u"<p>The quick brown fox</p>"_s));
+        index.add(status(u"2"_s, u"<p>A quick brown dog</p>"_s));
+
+        QBuffer buffer;
+        buffer.open(QIODevice::WriteOnly);
+        index.save(&buffer);
+        buffer.close();
+
+        StatusSearchIndex loaded;
+        buffer.open(QIODevice::ReadOnly);
+        QVERIFY(loaded.load(&buffer));
+        QCOMPARE(loaded.size(), qsizetype(2));
+        QCOMPARE(ids(loaded.search(u"quick"_s, 10)), (QStringList{u"2"_s, u"1"_s}));
+
+        // New statuses still come after the loaded ones
+        loaded.add(status(u"3"_s, u"<p>A quick cat</p>"_s));
+        loaded.remove(u"2"_s);
+        QCOMPARE(ids(loaded.search(u"quick"_s, 10)), (QStringList{u"3"_s, u"1"_s}));
+
+        QBuffer garbage;
+        garbage.setData("not an index");
+        garbage.open(QIODevice::ReadOnly);
+        QVERIFY(!loaded.load(&garbage));
+        QCOMPARE(loaded.size(), qsizetype(0));
+    }
+
+    void benchmarkSearch()
+    {
+        StatusSearchIndex index;
+        QRandomGenerator random(42);
+        const QStringList vocabulary{
+            u"kde"_s, u"plasma"_s, u"mastodon"_s, u"fediverse"_s, u"release"_s, u"bug"_s, u"fix"_s, u"qt"_s, u"linux"_s, u"desktop"_s,
+        };
+        for (int i = 0; i < StatusSearchIndex::defaultCapacity; ++i) {
+            QStringList words;
+            for (int j = 0; j < 30; ++j) {
+                words.push_back(vocabulary[random.bounded(vocabulary.size())] + QString::number(random.bounded(50)));
+            }
+            index.add(status(QString::number(i), u"<p>"_s + words.join(u' ') + u"</p>"_s));
+        }
+
+        QBENCHMARK {
+            index.search(u"plasma1 \"fix2 bug\""_s, 10);
+        }
+    }
+};
+
+QTEST_MAIN(StatusSearchIndexTest)
+#include "statussearchindextest.moc"
@@ -3,6 +3,7 @@
 
 #include <QtTest/QtTest>
 
+#include "account/prefetchcache.h"
 #include "autotests/helperreply.h"
 #include "autotests/mockaccount.h"
 #include "timeline/maintimelinemodel.h"
@@ -124,6 +125,114 @@ private Q_SLOTS:
                  QStringLiteral("Gargron"));
     }
 
+    void testThreadModelTree()
+    {
+        account->registerGet(account->apiUrl(QStringLiteral("/api/v1/statuses/103270115826048975")), new TestReply(QStringLiteral("status.json"), account));
+        account->registerGet(account->apiUrl(QStringLiteral("/api/v1/statuses/103270115826048975/context")),
+                             new TestReply(QStringLiteral("context-nested.json"), account));
+
+        ThreadModel threadModel;
+        threadModel.setPostId(QStringLiteral("103270115826048975"));
+        QCOMPARE(threadModel.rowCount({}), 6);
+        QCOMPARE(threadModel.getRootIndex(), 0);
+
+        // Replies follow the post they reply to, even if the server sent them later
+        const auto ids = [&threadModel] {
+            return threadIds(threadModel);
+        };
+        QCOMPARE(ids(), (QStringList{u"75"_s, u"80"_s, u"81"_s, u"82"_s, u"84"_s, u"83"_s}));
+        QCOMPARE(threadModel.data(threadModel.index(1, 0), AbstractTimelineModel::CollapsibleRepliesRole).toInt(), 3);
+        QCOMPARE(threadModel.data(threadModel.index(0, 0), AbstractTimelineModel::CollapsibleRepliesRole).toInt(), 0);
+
+        const QList<int> depths{0, 1, 2, 3, 2, 1};
+        const QList<bool> threadReplies{false, false, true, true, true, false};
+        const QList<bool> lastThreadReplies{false, false, false, false, true, true};
+        for (int i = 0; i < threadModel.rowCount({}); i++) {
+            const auto index = threadModel.index(i, 0);
+            QCOMPARE(threadModel.data(index, AbstractTimelineModel::ThreadDepthRole).toInt(), depths[i]);
+            QCOMPARE(threadModel.data(index, AbstractTimelineModel::IsThreadReplyRole).toBool(), threadReplies[i]);
+            QCOMPARE(threadModel.data(index, AbstractTimelineModel::IsLastThreadReplyRole).toBool(), lastThreadReplies[i]);
+        }
+
+        // Collapsed replies stay collapsed when their parent is expanded again
+        threadModel.collapseReplies(2);
+        QCOMPARE(ids(), (QStringList{u"75"_s, u"80"_s, u"81"_s, u"84"_s, u"83"_s}));
+        QCOMPARE(threadModel.data(threadModel.index(2, 0), AbstractTimelineModel::CollapsedRepliesRole).toInt(), 1);
+
+        threadModel.collapseReplies(1);
+        QCOMPARE(ids(), (QStringList{u"75"_s, u"80"_s, u"83"_s}));
+        QCOMPARE(threadModel.data(threadModel.index(1, 0), AbstractTimelineModel::CollapsedRepliesRole).toInt(), 3);
+
+        threadModel.expandReplies(1);
+        QCOMPARE(ids(), (QStringList{u"75"_s, u"80"_s, u"81"_s, u"84"_s, u"83"_s}));
+        QCOMPARE(threadModel.data(threadModel.index(1, 0), AbstractTimelineModel::CollapsedRepliesRole).toInt(), 0);
+
+        threadModel.expandReplies(2);
+        QCOMPARE(threadModel.rowCount({}), 6);
+    }
+
+    void testThreadModelDelete()
+    {
+        account->registerGet(account->apiUrl(QStringLiteral("/api/v1/statuses/103270115826048975")), new TestReply(QStringLiteral("status.json"), account));
+        account->registerGet(account->apiUrl(QStringLiteral("/api/v1/statuses/103270115826048975/context")),
+                             new TestReply(QStringLiteral("context-nested.json"), account));
+
+        ThreadModel threadModel;
+        threadModel.setPostId(QStringLiteral("103270115826048975"));
+        QCOMPARE(threadIds(threadModel), (QStringList{u"75"_s, u"80"_s, u"81"_s, u"82"_s, u"84"_s, u"83"_s}));
+
+        // Replies to a deleted post take its place, even if they were collapsed below it
+        threadModel.collapseReplies(2);
+        Q_EMIT account->streamingEvent(AbstractAccount::StreamingEventType::DeleteEvent, QByteArrayLiteral("103270115826048981"));
+        QCOMPARE(threadIds(threadModel), (QStringList{u"75"_s, u"80"_s, u"82"_s, u"84"_s, u"83"_s}));
+
+        const QList<int> depths{0, 1, 2, 2, 1};
+        for (int i = 0; i < threadModel.rowCount({}); i++) {
+            QCOMPARE(threadModel.data(threadModel.index(i, 0), AbstractTimelineModel::ThreadDepthRole).toInt(), depths[i]);
+        }
+
+        // Hidden replies can be deleted too
+        threadModel.collapseReplies(1);
+        QCOMPARE(threadModel.data(threadModel.index(1, 0), AbstractTimelineModel::CollapsedRepliesRole).toInt(), 2);
+        Q_EMIT account->streamingEvent(AbstractAccount::StreamingEventType::DeleteEvent, QByteArrayLiteral("103270115826048984"));
+        QCOMPARE(threadIds(threadModel), (QStringList{u"75"_s, u"80"_s, u"83"_s}));
+        QCOMPARE(threadModel.data(threadModel.index(1, 0), AbstractTimelineModel::CollapsedRepliesRole).toInt(), 1);
+
+        threadModel.expandReplies(1);
+        QCOMPARE(threadIds(threadModel), (QStringList{u"75"_s, u"80"_s, u"82"_s, u"83"_s}));
+    }
+
+    void testThreadPrefetch()
+    {
+        const auto statusUrl = account->apiUrl(QStringLiteral("/api/v1/statuses/103270115826048975"));
+        const auto contextUrl = account->apiUrl(QStringLiteral("/api/v1/statuses/103270115826048975/context"));
+        account->registerGet(statusUrl, new TestReply(QStringLiteral("status.json"), account));
+        account->registerGet(contextUrl, new TestReply(QStringLiteral("context.json"), account));
+
+        account->prefetchCache()->clear();
+        account->prefetchThread(QStringLiteral("103270115826048975"));
+        QVERIFY(account->prefetchCache()->contains(statusUrl));
+        QVERIFY(account->prefetchCache()->contains(contextUrl));
+
+        // The thread is built from what was prefetched, not what the server has now
+        account->registerGet(contextUrl, new TestReply(QStringLiteral("context-nested.json"), account));
+
+        ThreadModel threadModel;
+        threadModel.setPostId(QStringLiteral("103270115826048975"));
+        QCOMPARE(threadModel.rowCount({}), 4);
+        QCOMPARE(account->prefetchCache()->size(), 0);
+
+        // Prefetched responses are only used once
+        ThreadModel secondThreadModel;
+        secondThreadModel.setPostId(QStringLiteral("103270115826048975"));
+        QCOMPARE(secondThreadModel.rowCount({}), 6);
+
+        // Nor are they used once they're too old
+        PrefetchCache cache(account, std::chrono::milliseconds::zero());
+        cache.prefetch(statusUrl);
+        QVERIFY(!cache.contains(statusUrl));
+    }
+
     void testModelPoll()
     {
         MainTimelineModel timelineModel;
@@ -140,7 +249,7 @@ private Q_SLOTS:
         QCOMPARE(timelineModel.data(timelineModel.index(0, 0), AbstractTimelineModel::ContentRole).value<QString>(), QStringLiteral("<p>LOREM</p>"));
         QCOMPARE(timelineModel.data(timelineModel.index(0, 0), AbstractTimelineModel::AuthorIdentityRole).value<Identity *>()->id(), QStringLiteral("1"));
         QCOMPARE(timelineModel.data(timelineModel.index(0, 0), AbstractTimelineModel::AuthorIdentityRole).value<Identity *>()->displayNameHtml(),
-                 QStringLiteral("Eugen <img height=\"16\" align=\"middle\" width=\"16\" src=\"https://kde.org\">"));
+                 QStringLiteral("Eugen <img height=\"16\" align=\"middle\" width=\"16\" src=\"image://customemoji/aHR0cHM6Ly9rZGUub3Jn\">"));
         QCOMPARE(timelineModel.data(timelineModel.index(0, 0), AbstractTimelineModel::IsBoostedRole).value<bool>(), false);
 
         const auto poll = timelineModel.data(timelineModel.index(0, 0), AbstractTimelineModel::PollRole).value<Poll>();
@@ -156,7 +265,7 @@ private Q_SLOTS:
         QCOMPARE(poll.options().count(), 2);
         QCOMPARE(poll.options()[0]["title"_L1], QStringLiteral("accept"));
         QCOMPARE(poll.options()[0]["votesCount"_L1], 6);
-        QCOMPARE(poll.options()[1]["title"_L1], QStringLiteral("deny <img height=\"16\" align=\"middle\" width=\"16\" src=\"https://kde.org\">"));
+        QCOMPARE(poll.options()[1]["title"_L1], QStringLiteral("deny <img height=\"16\" align=\"middle\" width=\"16\" src=\"image://customemoji/aHR0cHM6Ly9rZGUub3Jn\">"));
         QCOMPARE(poll.options()[1]["votesCount"_L1], 4);
 
         account->registerPost(QStringLiteral("/api/v1/polls/34830/votes"), new TestReply(QStringLiteral("poll.json"), account));
@@ -197,6 +306,16 @@ private Q_SLOTS:
     }
 
 private:
+    // The last two digits of every post id, in the order they're shown
+    static QStringList threadIds(const ThreadModel &threadModel)
+    {
+        QStringList ids;
+        for (int i = 0; i < threadModel.rowCount({}); i++) {
+            ids.push_back(threadModel.data(threadModel.index(i, 0), AbstractTimelineModel::IdRole).toString().right(2));
+        }
+        return ids;
+    }
+
     MockAccount *account = nullptr;
 };
 
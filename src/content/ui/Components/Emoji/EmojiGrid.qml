@@ -48,29 +48,29 @@ QQC2.ScrollView {
         delegate: EmojiDelegate {
             id: emojiDelegate
             checked: emojis.currentIndex === model.index
-            emoji: modelData.unicode
-            name: modelData.shortName
+            emoji: model.unicode
+            name: model.shortName
 
             width: emojis.cellWidth
             height: emojis.cellHeight
 
-            isImage: modelData.isCustom
+            isImage: model.isCustom
             Keys.onEnterPressed: clicked()
             Keys.onReturnPressed: clicked()
             onClicked: {
-                emojiGrid.chosen(modelData.isCustom ? (":" + modelData.shortName + ":") : modelData.unicode)
+                emojiGrid.chosen(model.isCustom ? (":" + model.shortName + ":") : model.unicode)
                 EmojiModel.emojiUsed(AccountManager.selectedAccount, name)
             }
             Keys.onSpacePressed: pressAndHold()
             onPressAndHold: {
-                if (EmojiModel.tones(modelData.shortName).length === 0) {
+                if (!EmojiModel.hasTones(model.shortName)) {
                     return;
                 }
-                let tones = tonesPopupComponent.createObject(emojiDelegate, {shortName: modelData.shortName, unicode: modelData.unicode, categoryIconSize: emojiGrid.targetIconSize})
+                let tones = tonesPopupComponent.createObject(emojiDelegate, {shortName: model.shortName, unicode: model.unicode, categoryIconSize: emojiGrid.targetIconSize})
                 tones.open()
                 tones.forceActiveFocus()
             }
-            showTones: !!modelData && EmojiModel.tones(modelData.shortName).length > 0
+            showTones: EmojiModel.hasTones(model.shortName)
         }
 
         Kirigami.PlaceholderMessage {
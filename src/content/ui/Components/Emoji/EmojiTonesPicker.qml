@@ -43,8 +43,8 @@ QQC2.Popup {
         delegate: EmojiDelegate {
             id: emojiDelegate
             checked: tonesList.currentIndex === model.index
-            emoji: modelData.unicode
-            name: modelData.shortName
+            emoji: model.unicode
+            name: model.shortName
 
             width: tones.categoryIconSize
             height: width
@@ -52,7 +52,7 @@ QQC2.Popup {
             Keys.onEnterPressed: clicked()
             Keys.onReturnPressed: clicked()
             onClicked: {
-                tones.chosen(modelData.unicode)
+                tones.chosen(model.unicode)
                 EmojiModel.emojiUsed(AccountManager.selectedAccount, name)
                 tones.close()
             }
@@ -36,11 +36,26 @@ RowLayout {
             Navigation.openAccount(root.identity.id);
             root.clicked();
         }
+        onPressed: avatar.prefetchProfile()
+        onHoveredChanged: hovered ? prefetchTimer.restart() : prefetchTimer.stop()
         name: root.identity.displayName
 
         QQC2.ToolTip.text: i18n("View profile")
         QQC2.ToolTip.visible: hovered
         QQC2.ToolTip.delay: Kirigami.Units.toolTipDelay
+
+        // The avatar doesn't open anything in the admin tools
+        function prefetchProfile(): void {
+            if (!root.admin) {
+                AccountManager.selectedAccount.prefetchProfile(root.identity.id);
+            }
+        }
+
+        Timer {
+            id: prefetchTimer
+            interval: Kirigami.Units.toolTipDelay
+            onTriggered: avatar.prefetchProfile()
+        }
     }
 
     ColumnLayout {
@@ -18,7 +18,7 @@ Kirigami.ScrollablePage {
 
     property alias listViewHeader: listview.header
     readonly property bool typesAreGroupable: !mentionOnlyAction.checked && !followsOnlyAction.checked && !pollResultsOnlyAction.checked
-    property bool shouldGroupNotifications: typesAreGroupable
+    property bool shouldGroupNotifications: typesAreGroupable && !notificationModel.groupedByServer
     readonly property var currentModel: shouldGroupNotifications ? groupedNotificationModel : notificationModel
 
     onBackRequested: if (dialog) {
@@ -14,6 +14,8 @@ QQC2.TextArea {
     id: root
 
     required property string content
+    // The content with its bidirectionality already fixed, when the model provides it
+    property var bidiContent: undefined
     required property bool expandedPost
     required property bool secondary
     required property bool shouldOpenInternalLinks
@@ -30,7 +32,7 @@ QQC2.TextArea {
         TextHandler.forceRefreshTextDocument(root.textDocument, root);
     }
 
-    text: TextHandler.fixBidirectionality(root.content, Config.defaultFont)
+    text: root.bidiContent !== undefined ? root.bidiContent : TextHandler.fixBidirectionality(root.content, Config.defaultFont)
     Layout.fillWidth: true
     textFormat: TextEdit.RichText
     activeFocusOnTab: false
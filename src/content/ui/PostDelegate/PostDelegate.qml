@@ -46,6 +46,7 @@ QQC2.ItemDelegate {
     required property bool pinned
 
     required property string content
+    required property string bidiContent
     required property string spoilerText
     required property string relativeTime
     required property string absoluteTime
@@ -64,6 +65,8 @@ QQC2.ItemDelegate {
     required property string editedAt
     required property bool isThreadReply
     required property bool isLastThreadReply
+    required property int collapsedReplies
+    required property int collapsibleReplies
 
     required property var post
 
@@ -77,6 +80,7 @@ QQC2.ItemDelegate {
     property bool showSeparator: true
     property bool showInteractionButton: true
     property bool expandedPost: false
+    property bool spoilerShown: root.spoilerText.length === 0 || AccountManager.selectedAccount.preferences.extendSpoiler
     property bool loading: false
     property bool inViewPort: true
     property bool hasWebsite: root.application && root.application.website !== undefined && root.application.website.toString().trim().length > 0
@@ -89,6 +93,30 @@ QQC2.ItemDelegate {
     leftPadding: Kirigami.Units.largeSpacing
     rightPadding: Kirigami.Units.largeSpacing
 
+    // Everything besides the post itself that changes how tall it is, so it's not given a height it had while it looked different
+    readonly property string heightLayout: [root.expandedPost, root.secondary, root.filtered, root.spoilerShown].map(Number).join("")
+    readonly property real cachedHeight: root.timelineModel ? root.timelineModel.cachedDelegateHeight(root.id, root.heightLayout, root.width) : 0
+    readonly property real naturalHeight: Math.max(implicitBackgroundHeight + topInset + bottomInset, implicitContentHeight + topPadding + bottomPadding)
+
+    // Stand in with how tall this post was last time until it's laid out, so the view doesn't jump around while images and cards load
+    property bool measured: false
+    implicitHeight: root.measured || root.cachedHeight <= 0 ? root.naturalHeight : root.cachedHeight
+
+    onNaturalHeightChanged: if (root.naturalHeight >= root.cachedHeight) {
+        root.measured = true;
+    }
+
+    // The post may have become shorter since, like after an edit
+    Timer {
+        interval: 1000
+        running: !root.measured
+        onTriggered: root.measured = true
+    }
+
+    Component.onDestruction: if (root.timelineModel && root.measured) {
+        root.timelineModel.reportDelegateHeight(root.id, root.heightLayout, root.width, root.naturalHeight);
+    }
+
     highlighted: false
     hoverEnabled: false
 
@@ -101,8 +129,29 @@ QQC2.ItemDelegate {
         Navigation.openPost(root.id);
     }
 
+    // The selected post is the one whose thread is already shown
+    function prefetchThread(): void {
+        if (!root.selected) {
+            AccountManager.selectedAccount.prefetchThread(root.id);
+        }
+    }
+
+    onPressed: root.prefetchThread()
+    onActiveFocusChanged: activeFocus ? prefetchTimer.restart() : prefetchTimer.stop()
+
+    HoverHandler {
+        onHoveredChanged: hovered ? prefetchTimer.restart() : prefetchTimer.stop()
+    }
+
+    Timer {
+        id: prefetchTimer
+        interval: Kirigami.Units.toolTipDelay
+        onTriggered: root.prefetchThread()
+    }
+
     ListView.onReused: {
-        postContent.visible = Qt.binding(() => {
+        root.measured = false;
+        spoilerShown = Qt.binding(() => {
             return root.spoilerText.length === 0 || AccountManager.selectedAccount.preferences.extendSpoiler;
         });
         filtered = Qt.binding(() => {
@@ -315,9 +364,9 @@ QQC2.ItemDelegate {
                     }
 
                     QQC2.Button {
-                        text: postContent.visible ? i18n("Show Less") : i18n("Show More")
-                        icon.name: postContent.visible ? "view-hidden-symbolic" : "view-visible-symbolic"
-                        onClicked: postContent.visible = !postContent.visible
+                        text: root.spoilerShown ? i18n("Show Less") : i18n("Show More")
+                        icon.name: root.spoilerShown ? "view-hidden-symbolic" : "view-visible-symbolic"
+                        onClicked: root.spoilerShown = !root.spoilerShown
                     }
                 }
 
@@ -331,9 +380,10 @@ QQC2.ItemDelegate {
                 id: postContent
 
                 content: root.content
+                bidiContent: root.bidiContent
                 expandedPost: root.expandedPost
                 secondary: root.secondary
-                visible: root.spoilerText.length === 0 || AccountManager.selectedAccount.preferences.extendSpoiler
+                visible: root.spoilerShown
                 shouldOpenInternalLinks: true
 
                 onClicked: root.clicked()
@@ -505,6 +555,21 @@ QQC2.ItemDelegate {
             }
         }
 
+        QQC2.Button {
+            visible: root.collapsedReplies > 0
+            text: i18np("Show %1 more reply", "Show %1 more replies", root.collapsedReplies)
+            icon.name: "go-down"
+            onClicked: root.timelineModel.expandReplies(root.index)
+        }
+
+        QQC2.Button {
+            visible: root.collapsibleReplies > 0
+            text: i18np("Hide %1 reply", "Hide %1 replies", root.collapsibleReplies)
+            icon.name: "go-up"
+            flat: true
+            onClicked: root.timelineModel.collapseReplies(root.index)
+        }
+
         Loader {
             active: root.selected
             visible: root.selected
@@ -28,9 +28,22 @@ ListView {
 
     section {
         property: "type"
-        delegate: Kirigami.ListSectionHeader {
-            text: searchModel.labelForType(section)
-            width: parent.width
+        delegate: RowLayout {
+            required property string section
+
+            width: ListView.view.width
+
+            Kirigami.ListSectionHeader {
+                text: searchModel.labelForType(section)
+
+                Layout.fillWidth: true
+            }
+
+            QQC2.ToolButton {
+                text: i18nc("@action:button Show more search results", "Show More")
+                visible: searchModel.typesWithMoreResults.includes(Number(section))
+                onClicked: searchModel.fetchMoreOfType(Number(section))
+            }
         }
     }
 
@@ -135,6 +148,22 @@ ListView {
             }
         }
 
+        DelegateChoice {
+            roleValue: SearchModel.SeenStatus
+            PostDelegate {
+                x: Kirigami.Units.smallSpacing
+                width: ListView.view.width - Kirigami.Units.smallSpacing * 2
+                secondary: true
+                showSeparator: true
+                showInteractionButton: false
+
+                leftPadding: 0
+                rightPadding: 0
+                topPadding: Kirigami.Units.smallSpacing
+                bottomPadding: Kirigami.Units.smallSpacing
+            }
+        }
+
         DelegateChoice {
             roleValue: SearchModel.Hashtag
 
@@ -38,11 +38,14 @@ Kirigami.ScrollablePage {
 
             required property var index
             required property var identity
+            required property var relationship
 
             text: identity.displayName
 
             onClicked: Navigation.openAccount(delegate.identity.id)
 
+            Component.onCompleted: root.model.rowShown(delegate.index)
+
             contentItem: ColumnLayout {
                 spacing: 0
 
@@ -58,6 +61,30 @@ Kirigami.ScrollablePage {
                         Layout.fillWidth: true
                     }
 
+                    QQC2.Button {
+                        readonly property var relationship: delegate.relationship
+
+                        text: {
+                            if (relationship.requested) {
+                                return i18nc("@action:button", "Follow Requested");
+                            }
+                            if (relationship.following) {
+                                return i18nc("@action:button", "Unfollow");
+                            }
+                            return i18nc("@action:button", "Follow");
+                        }
+                        icon.name: relationship.following ? "list-remove-user" : "list-add-user"
+                        onClicked: {
+                            if (relationship.requested || relationship.following) {
+                                model.actionUnfollow(model.index(delegate.index, 0));
+                            } else {
+                                model.actionFollow(model.index(delegate.index, 0));
+                            }
+                        }
+                        // Relationships are fetched for the rows on screen at once, see RelationshipCache
+                        visible: !model.isFollowRequest && relationship.id !== undefined && AccountManager.selectedAccount.identity.id !== delegate.identity.id
+                    }
+
                     QQC2.Button {
                         text: i18nc("@action:button Allow follow request", "Allow")
                         icon.name: "checkmark"
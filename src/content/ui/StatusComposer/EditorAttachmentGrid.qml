@@ -6,6 +6,7 @@ import org.kde.kirigami 2 as Kirigami
 import QtQuick.Controls 2 as QQC2
 import QtQml.Models
 import QtQuick.Layouts
+import org.kde.tokodon
 
 import "../Components"
 
@@ -31,6 +32,9 @@ GridLayout {
             required property string description
             required property real focalX
             required property real focalY
+            required property NetworkRequestProgress progress
+            required property bool processing
+            required property bool failed
 
             readonly property var mediaRatio: 9.0 / 16.0
 
@@ -90,6 +94,37 @@ GridLayout {
                 }
             }
 
+            QQC2.ProgressBar {
+                from: 0
+                to: 100
+                visible: !img.failed && (img.processing || (img.progress !== null && img.progress.uploading))
+                value: img.progress !== null ? img.progress.progress : 0
+                // Once the file is sent, the server may still need to process it
+                indeterminate: img.processing || value === 100
+
+                anchors {
+                    left: parent.left
+                    right: parent.right
+                    bottom: parent.bottom
+                    margins: Kirigami.Units.largeSpacing
+                }
+            }
+
+            Kirigami.Icon {
+                source: "data-error"
+                visible: img.failed
+                implicitWidth: Kirigami.Units.iconSizes.large
+                implicitHeight: Kirigami.Units.iconSizes.large
+                anchors.centerIn: parent
+
+                QQC2.ToolTip.text: i18nc("@info:tooltip", "This attachment could not be uploaded")
+                QQC2.ToolTip.visible: failedHover.hovered
+
+                HoverHandler {
+                    id: failedHover
+                }
+            }
+
             QQC2.RoundButton {
                 id: removeButton
 
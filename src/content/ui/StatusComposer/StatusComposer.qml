@@ -30,7 +30,6 @@ Kirigami.ScrollablePage {
     property var mentions: []
     property int visibility: AccountManager.selectedAccount.preferences.defaultVisibility
     property int sensitive: AccountManager.selectedAccount.preferences.defaultSensitive
-    readonly property NetworkRequestProgress progress: NetworkRequestProgress {}
     property var previewPost: null
     property string initialText
     property bool closeApplicationWhenFinished: false
@@ -183,11 +182,11 @@ Kirigami.ScrollablePage {
     }
 
     function uploadFile(url: string): void {
-        progress.reply = backend.attachmentEditorModel.append(url);
+        backend.attachmentEditorModel.append(url);
     }
 
     function uploadData(data: var): void {
-        progress.reply = backend.attachmentEditorModel.appendData(data);
+        backend.attachmentEditorModel.appendData(data);
     }
 
     function pasteImage(): bool {
@@ -328,17 +327,6 @@ Kirigami.ScrollablePage {
                     Layout.margins: Kirigami.Units.smallSpacing
                 }
 
-                QQC2.ProgressBar {
-                    Layout.fillWidth: true
-                    from: 0
-                    to: 100
-                    visible: progress.uploading
-                    value: progress.progress
-                    indeterminate: progress.progress === 100 && progress.uploading
-                    Layout.leftMargin: Kirigami.Units.smallSpacing
-                    Layout.rightMargin: Kirigami.Units.smallSpacing
-                }
-
                 Kirigami.Separator {
                     visible: addPool.checked
                     Layout.fillWidth: true
@@ -359,14 +347,19 @@ Kirigami.ScrollablePage {
 
                     RowLayout {
                         QQC2.ToolButton {
-                            enabled: backend.attachmentEditorModel.count < 4 && !addPool.checked
+                            enabled: backend.attachmentEditorModel.count < backend.attachmentEditorModel.maximumCount && !addPool.checked
                             icon.name: "mail-attachment-symbolic"
                             onClicked: fileDialog.open()
                             FileDialog {
                                 id: fileDialog
                                 currentFolder: StandardPaths.standardLocations(StandardPaths.HomeLocation)[0]
                                 title: i18nc("@title:window", "Choose a File")
-                                onAccepted: root.uploadFile(fileDialog.selectedFile);
+                                fileMode: FileDialog.OpenFiles
+                                onAccepted: {
+                                    for (const file of fileDialog.selectedFiles) {
+                                        root.uploadFile(file);
+                                    }
+                                }
                                 selectedNameFilter.index: 0
                                 nameFilters: [i18n("All supported formats (*.jpg *.jpeg *.png *.gif *.webp *.heic *.heif *.avif *.webm *.mp4 *.m4v *.mov)"),
                                     i18n("JPEG image (*.jpg *.jpeg)"),
@@ -548,7 +541,7 @@ Kirigami.ScrollablePage {
                             return i18nc("@action:Button Save an edited a post", "Save");
                     }
                 }
-                enabled: root.isStatusValid && root.isPollValid && (!progress.uploading || backend.attachmentEditorModel.count > 0)
+                enabled: root.isStatusValid && root.isPollValid
                 Layout.alignment: Qt.AlignRight
                 onClicked: root.submitPost()
             }
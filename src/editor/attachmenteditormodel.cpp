@@ -5,11 +5,24 @@
 #include "editor/attachmenteditormodel.h"
 
 #include "account/account.h"
+#include "editor/mediapreprocessor.h"
+#include "network/networkrequestprogress.h"
+
+#include <KLocalizedString>
+
+#include <algorithm>
+
+using namespace Qt::StringLiterals;
+
+// Servers are polled with exponential backoff while they process media, up to this interval
+constexpr int maximumPollInterval = 8000;
 
 AttachmentEditorModel::AttachmentEditorModel(QObject *parent, AbstractAccount *account)
     : QAbstractListModel(parent)
     , m_account(account)
 {
+    // The limits come with the instance metadata, which may still be loading
+    connect(m_account, &AbstractAccount::fetchedInstanceMetadata, this, &AttachmentEditorModel::maximumCountChanged);
 }
 
 int AttachmentEditorModel::rowCount(const QModelIndex &parent) const
@@ -23,6 +36,22 @@ int AttachmentEditorModel::count() const
     return rowCount({});
 }
 
+int AttachmentEditorModel::maximumCount() const
+{
+    return m_account->mediaAttachmentLimits().maxAttachments;
+}
+
+bool AttachmentEditorModel::isReady() const
+{
+    if (m_preparing > 0 || !m_processing.isEmpty() || !m_failed.isEmpty()) {
+        return false;
+    }
+
+    return std::none_of(m_attachments.cbegin(), m_attachments.cend(), [](const Attachment *attachment) {
+        return attachment->id().isEmpty();
+    });
+}
+
 QVariant AttachmentEditorModel::data(const QModelIndex &index, int role) const
 {
     if (!index.isValid()) {
@@ -40,6 +69,12 @@ QVariant AttachmentEditorModel::data(const QModelIndex &index, int role) const
         return attachment->focusX();
     case FocalYRole:
         return attachment->focusY();
+    case ProgressRole:
+        return QVariant::fromValue(m_progress.value(attachment));
+    case ProcessingRole:
+        return m_processing.contains(attachment);
+    case FailedRole:
+        return m_failed.contains(attachment);
     }
 
     return {};
@@ -52,42 +87,206 @@ QHash<int, QByteArray> AttachmentEditorModel::roleNames() const
         {DescriptionRole, QByteArrayLiteral("description")},
         {FocalXRole, QByteArrayLiteral("focalX")},
         {FocalYRole, QByteArrayLiteral("focalY")},
+        {ProgressRole, QByteArrayLiteral("progress")},
+        {ProcessingRole, QByteArrayLiteral("processing")},
+        {FailedRole, QByteArrayLiteral("failed")},
     };
 }
 
-QNetworkReply *AttachmentEditorModel::append(const QString &filename)
+void AttachmentEditorModel::append(const QString &filename)
 {
-    if (rowCount({}) >= 4) {
-        return nullptr;
+    if (rowCount({}) + m_preparing >= maximumCount()) {
+        return;
     }
 
     QString localFilename = filename;
     localFilename.remove(QStringLiteral("file://"));
 
-    return m_account->upload(QUrl::fromLocalFile(localFilename), [=](QNetworkReply *reply) {
-        const auto doc = QJsonDocument::fromJson(reply->readAll());
+    upload(MediaPreprocessor::prepareFile(localFilename, m_account->mediaAttachmentLimits()));
+}
+
+void AttachmentEditorModel::appendData(QVariant data)
+{
+    if (rowCount({}) + m_preparing >= maximumCount()) {
+        return;
+    }
 
-        if (!doc.isObject()) {
+    const auto image = data.value<QImage>();
+    if (image.isNull()) {
+        return;
+    }
+
+    upload(MediaPreprocessor::prepareImage(image, m_account->mediaAttachmentLimits()));
+}
+
+void AttachmentEditorModel::upload(QFuture<PreparedMedia> future)
+{
+    m_preparing++;
+    Q_EMIT readyChanged();
+
+    future.then(this, [this](const PreparedMedia &media) {
+        m_preparing--;
+
+        if (!media.isValid() || rowCount({}) >= maximumCount()) {
+            Q_EMIT readyChanged();
             return;
         }
 
+        // Show the local thumbnail right away, the attachment gets its id once the upload finishes
+        QJsonObject object{
+            {QStringLiteral("type"), media.previewUrl.isEmpty() ? QStringLiteral("unknown") : QStringLiteral("image")},
+            {QStringLiteral("preview_url"), media.previewUrl},
+            {QStringLiteral("blurhash"), media.blurhash},
+        };
+        if (media.size.isValid()) {
+            object[QStringLiteral("meta")] = QJsonObject{
+                {QStringLiteral("original"),
+                 QJsonObject{
+                     {QStringLiteral("width"), media.size.width()},
+                     {QStringLiteral("height"), media.size.height()},
+                 }},
+            };
+        }
+        auto pending = new Attachment{object, this};
+
+        const auto callback = [this, pending](QNetworkReply *reply) {
+            const auto doc = QJsonDocument::fromJson(reply->readAll());
+            if (!doc.isObject() || !m_attachments.contains(pending)) {
+                return;
+            }
+
+            // Large media is processed asynchronously, which is signalled by a 202 and no URL yet
+            const bool processing = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() == 202 || doc["url"_L1].isNull();
+            auto attachment = replaceAttachment(pending, doc.object());
+
+            // Apply anything that was edited while it was still uploading
+            const int row = m_attachments.indexOf(attachment);
+            if (!pending->description().isEmpty()) {
+                setDescription(row, pending->description());
+            }
+            if (pending->focusX() != 0.0 || pending->focusY() != 0.0) {
+                setFocusPoint(row, pending->focusX(), pending->focusY());
+            }
+            pending->deleteLater();
+
+            if (processing) {
+                setProcessing(attachment, true);
+                pollProcessing(attachment, 1000);
+            } else {
+                Q_EMIT readyChanged();
+            }
+        };
+
+        QNetworkReply *reply = media.data.isEmpty() ? m_account->upload(QUrl::fromLocalFile(media.localPath), callback)
+                                                    : m_account->upload(media.data, media.fileName, media.mimeType, callback);
+
+        auto progress = new NetworkRequestProgress(this);
+        progress->setReply(reply);
+        m_progress.insert(pending, progress);
+
         beginInsertRows({}, m_attachments.count(), m_attachments.count());
-        m_attachments.append(new Attachment{doc.object(), this});
+        m_attachments.append(pending);
         endInsertRows();
         Q_EMIT countChanged();
+        Q_EMIT readyChanged();
+
+        if (reply) {
+            connect(reply, &QNetworkReply::finished, this, [this, reply, pending] {
+                const int row = m_attachments.indexOf(pending);
+                if (reply->error() != QNetworkReply::NoError && row != -1) {
+                    setFailed(pending);
+                }
+            });
+        }
     });
 }
 
-QNetworkReply *AttachmentEditorModel::appendData(QVariant data)
+Attachment *AttachmentEditorModel::replaceAttachment(Attachment *attachment, const QJsonObject &object)
 {
-    const auto image = data.value<QImage>();
+    const int row = m_attachments.indexOf(attachment);
+    Q_ASSERT(row != -1);
 
-    const QString tempPath = m_saveDir.filePath(QStringLiteral("%1.png").arg(QUuid::createUuid().toString()));
-    if (image.save(tempPath, "PNG")) {
-        return append(tempPath);
+    auto replacement = new Attachment{object, this};
+    if (replacement->m_preview_url.isEmpty()) {
+        replacement->m_preview_url = attachment->m_preview_url;
+    }
+    if (replacement->description().isEmpty()) {
+        replacement->setDescription(attachment->description());
     }
 
-    return nullptr;
+    m_attachments[row] = replacement;
+    if (auto progress = m_progress.take(attachment)) {
+        m_progress.insert(replacement, progress);
+    }
+    if (m_processing.remove(attachment)) {
+        m_processing.insert(replacement);
+    }
+    Q_EMIT dataChanged(index(row, 0), index(row, 0));
+
+    return replacement;
+}
+
+void AttachmentEditorModel::pollProcessing(Attachment *attachment, int delay)
+{
+    QTimer::singleShot(delay, this, [this, attachment, delay] {
+        if (!m_attachments.contains(attachment)) {
+            return;
+        }
+
+        m_account->get(
+            m_account->apiUrl(QStringLiteral("/api/v1/media/%1").arg(attachment->id())),
+            true,
+            this,
+            [this, attachment, delay](QNetworkReply *reply) {
+                if (!m_attachments.contains(attachment)) {
+                    return;
+                }
+
+                // 206 means it's still processing
+                if (reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt() == 206) {
+                    pollProcessing(attachment, std::min(delay * 2, maximumPollInterval));
+                    return;
+                }
+
+                const auto doc = QJsonDocument::fromJson(reply->readAll());
+                if (doc.isObject()) {
+                    auto processed = replaceAttachment(attachment, doc.object());
+                    setProcessing(processed, false);
+                    attachment->deleteLater();
+                }
+            },
+            [this, attachment](QNetworkReply *) {
+                if (m_attachments.contains(attachment)) {
+                    setFailed(attachment);
+                }
+            });
+    });
+}
+
+void AttachmentEditorModel::setProcessing(Attachment *attachment, bool processing)
+{
+    if (processing) {
+        m_processing.insert(attachment);
+    } else {
+        m_processing.remove(attachment);
+    }
+
+    const int row = m_attachments.indexOf(attachment);
+    Q_EMIT dataChanged(index(row, 0), index(row, 0), {ProcessingRole});
+    Q_EMIT readyChanged();
+}
+
+void AttachmentEditorModel::setFailed(Attachment *attachment)
+{
+    m_processing.remove(attachment);
+    m_failed.insert(attachment);
+
+    const int row = m_attachments.indexOf(attachment);
+    Q_EMIT dataChanged(index(row, 0), index(row, 0), {ProcessingRole, FailedRole});
+
+    // Before readyChanged, so a post waiting for the media isn't sent without it
+    Q_EMIT uploadFailed(i18n("An attachment could not be uploaded. Remove it and try again."));
+    Q_EMIT readyChanged();
 }
 
 void AttachmentEditorModel::appendExisting(Attachment *attachment)
@@ -101,9 +300,17 @@ void AttachmentEditorModel::appendExisting(Attachment *attachment)
 void AttachmentEditorModel::removeAttachment(int row)
 {
     beginRemoveRows({}, row, row);
-    m_attachments.removeAt(row);
+    auto attachment = m_attachments.takeAt(row);
     endRemoveRows();
+
+    if (auto progress = m_progress.take(attachment)) {
+        progress->deleteLater();
+    }
+    m_processing.remove(attachment);
+    m_failed.remove(attachment);
+
     Q_EMIT countChanged();
+    Q_EMIT readyChanged();
 }
 
 void AttachmentEditorModel::setDescription(int row, const QString &description)
@@ -112,6 +319,12 @@ void AttachmentEditorModel::setDescription(int row, const QString &description)
     const auto id = attachment->id();
     attachment->setDescription(description);
 
+    // Still uploading, it's sent once it has an id
+    if (id.isEmpty()) {
+        Q_EMIT dataChanged(index(row, 0), index(row, 0), {DescriptionRole});
+        return;
+    }
+
     const auto attachementUrl = m_account->apiUrl(QStringLiteral("/api/v1/media/%1").arg(id));
     const QJsonObject obj{
         {QStringLiteral("description"), description},
@@ -128,6 +341,11 @@ void AttachmentEditorModel::setFocusPoint(int row, double x, double y)
     attachment->setFocusX(x);
     attachment->setFocusY(y);
 
+    if (id.isEmpty()) {
+        Q_EMIT dataChanged(index(row, 0), index(row, 0), {FocalXRole, FocalYRole});
+        return;
+    }
+
     const auto attachementUrl = m_account->apiUrl(QStringLiteral("/api/v1/media/%1").arg(id));
     const QJsonObject obj{
         {QStringLiteral("focus"), QStringLiteral("%1,%2").arg(x).arg(y)},
@@ -6,21 +6,38 @@
 
 #include "timeline/post.h"
 
+#include <QFuture>
+#include <QSet>
+
 class QTimer;
 class AbstractAccount;
+class NetworkRequestProgress;
+struct PreparedMedia;
 
 class AttachmentEditorModel : public QAbstractListModel
 {
     Q_OBJECT
     Q_PROPERTY(int count READ count NOTIFY countChanged)
+    Q_PROPERTY(int maximumCount READ maximumCount NOTIFY maximumCountChanged)
+    Q_PROPERTY(bool ready READ isReady NOTIFY readyChanged)
 
 public:
     explicit AttachmentEditorModel(QObject *parent, AbstractAccount *account);
 
-    enum ExtraRole { PreviewRole = Qt::UserRole + 1, DescriptionRole, FocalXRole, FocalYRole };
+    enum ExtraRole { PreviewRole = Qt::UserRole + 1, DescriptionRole, FocalXRole, FocalYRole, ProgressRole, ProcessingRole, FailedRole };
 
     int count() const;
 
+    /**
+     * @return The maximum number of attachments the instance allows on a post.
+     */
+    int maximumCount() const;
+
+    /**
+     * @return If every attachment has finished uploading and processing, so the post can be sent. It never is while a failed attachment is still there.
+     */
+    bool isReady() const;
+
     Q_INVOKABLE int rowCount(const QModelIndex &parent = {}) const override;
     QVariant data(const QModelIndex &index, int role) const override;
     QHash<int, QByteArray> roleNames() const override;
@@ -29,8 +46,15 @@ public:
     void copyFromOther(AttachmentEditorModel *other);
 
 public Q_SLOTS:
-    QNetworkReply *append(const QString &fileName);
-    QNetworkReply *appendData(QVariant data);
+    /**
+     * @brief Prepares and uploads the file at @p fileName. The attachment is added as soon as it's prepared, and several can upload at once.
+     */
+    void append(const QString &fileName);
+
+    /**
+     * @brief Prepares and uploads the image @p data, usually from the clipboard.
+     */
+    void appendData(QVariant data);
     void appendExisting(Attachment *attachment);
     void removeAttachment(int row);
     void setDescription(int row, const QString &description);
@@ -40,11 +64,26 @@ public Q_SLOTS:
 Q_SIGNALS:
     void postChanged();
     void countChanged();
+    void maximumCountChanged();
+    void readyChanged();
+
+    /**
+     * @brief Emitted when an attachment couldn't be uploaded or processed. It's kept and marked as failed until it's removed.
+     */
+    void uploadFailed(const QString &errorMessage);
 
 private:
+    void upload(QFuture<PreparedMedia> future);
+    Attachment *replaceAttachment(Attachment *attachment, const QJsonObject &object);
+    void pollProcessing(Attachment *attachment, int delay);
+    void setProcessing(Attachment *attachment, bool processing);
+    void setFailed(Attachment *attachment);
+
     QList<Attachment *> m_attachments;
+    QHash<Attachment *, NetworkRequestProgress *> m_progress;
+    QSet<Attachment *> m_processing;
+    QSet<Attachment *> m_failed;
     QHash<QString, QTimer *> m_updateTimers;
     AbstractAccount *m_account = nullptr;
-
-    QTemporaryDir m_saveDir;
+    int m_preparing = 0;
 };
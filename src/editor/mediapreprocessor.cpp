@@ -0,0 +1,226 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "editor/mediapreprocessor.h"
+
+#include "tokodon_debug.h"
+#include "utils/blurhash.hpp"
+
+#include <QBuffer>
+#include <QFileInfo>
+#include <QImageReader>
+#include <QImageWriter>
+#include <QMimeDatabase>
+#include <QPromise>
+#include <QThreadPool>
+
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using namespace Qt::StringLiterals;
+
+namespace
+{
+constexpr int thumbnailSize = 384;
+constexpr int blurhashSampleSize = 32;
+constexpr int initialQuality = 85;
+constexpr int minimumQuality = 60;
+constexpr int maximumEncodeAttempts = 8;
+
+template<typename Function>
+QFuture<PreparedMedia> runInBackground(Function function)
+{
+    auto promise = std::make_shared<QPromise<PreparedMedia>>();
+    auto future = promise->future();
+    promise->start();
+
+    QThreadPool::globalInstance()->start([promise, function = std::move(function)] {
+        promise->addResult(function());
+        promise->finish();
+    });
+
+    return future;
+}
+
+bool hasTransparentPixels(const QImage &image)
+{
+    if (!image.hasAlphaChannel()) {
+        return false;
+    }
+
+    const QImage argb = image.convertToFormat(QImage::Format_ARGB32);
+    for (int y = 0; y < argb.height(); y++) {
+        const auto line = reinterpret_cast<const QRgb *>(argb.constScanLine(y));
+        for (int x = 0; x < argb.width(); x++) {
+            if (qAlpha(line[x]) != 255) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+QByteArray encodeImage(const QImage &image, const QByteArray &format, int quality)
+{
+    QByteArray data;
+    QBuffer buffer(&data);
+    buffer.open(QIODevice::WriteOnly);
+
+    // QImageWriter never copies metadata like EXIF over from the source, so this also strips it
+    QImageWriter writer(&buffer, format);
+    writer.setQuality(quality);
+    writer.setOptimizedWrite(true);
+    writer.setProgressiveScanWrite(true);
+    if (!writer.write(image)) {
+        qCWarning(TOKODON_LOG) << "Failed to encode image as" << format << writer.errorString();
+        return {};
+    }
+
+    return data;
+}
+
+QString encodeBlurhash(const QImage &image)
+{
+    const QImage sample =
+        image.scaled(blurhashSampleSize, blurhashSampleSize, Qt::KeepAspectRatio, Qt::SmoothTransformation).convertToFormat(QImage::Format_RGB888);
+
+    // blurhash expects tightly packed rows, while QImage pads them to 4 bytes
+    const size_t rowSize = static_cast<size_t>(sample.width()) * 3;
+    std::vector<unsigned char> pixels(rowSize * sample.height());
+    for (int y = 0; y < sample.height(); y++) {
+        std::memcpy(pixels.data() + y * rowSize, sample.constScanLine(y), rowSize);
+    }
+
+    return QString::fromStdString(blurhash::encode(pixels.data(), sample.width(), sample.height(), 4, 3));
+}
+}
+
+bool PreparedMedia::isValid() const
+{
+    return !data.isEmpty() || !localPath.isEmpty();
+}
+
+QFuture<PreparedMedia> MediaPreprocessor::prepareFile(const QString &path, const AbstractAccount::MediaAttachmentLimits &limits)
+{
+    return runInBackground([path, limits] {
+        return processFile(path, limits);
+    });
+}
+
+QFuture<PreparedMedia> MediaPreprocessor::prepareImage(const QImage &image, const AbstractAccount::MediaAttachmentLimits &limits)
+{
+    return runInBackground([image, limits] {
+        return processImage(image, u"image"_s, limits);
+    });
+}
+
+PreparedMedia MediaPreprocessor::processFile(const QString &path, const AbstractAccount::MediaAttachmentLimits &limits)
+{
+    const QFileInfo info(path);
+    const QMimeType mimeType = QMimeDatabase().mimeTypeForFile(info);
+
+    PreparedMedia asIs;
+    asIs.fileName = info.fileName();
+    asIs.mimeType = mimeType.name();
+    asIs.localPath = path;
+
+    // GIFs are converted to videos by the server, and we can't re-encode vector images
+    if (!mimeType.name().startsWith("image/"_L1) || mimeType.inherits(u"image/gif"_s) || mimeType.inherits(u"image/svg+xml"_s)) {
+        return asIs;
+    }
+
+    QImageReader reader(path);
+    reader.setAutoTransform(true);
+    if (reader.supportsAnimation() && reader.imageCount() > 1) {
+        return asIs;
+    }
+
+    QImage image = reader.read();
+    if (image.isNull()) {
+        qCWarning(TOKODON_LOG) << "Failed to read" << path << "for preprocessing, uploading it as-is:" << reader.errorString();
+        return asIs;
+    }
+
+    PreparedMedia prepared = processImage(std::move(image), info.completeBaseName(), limits);
+    if (!prepared.isValid()) {
+        return asIs;
+    }
+    prepared.localPath = path;
+
+    return prepared;
+}
+
+PreparedMedia MediaPreprocessor::processImage(QImage image, const QString &baseName, const AbstractAccount::MediaAttachmentLimits &limits)
+{
+    if (image.isNull()) {
+        return {};
+    }
+
+    const QSize size = targetSize(image.size(), limits);
+    if (size != image.size()) {
+        image = image.scaled(size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+    }
+
+    // Prefer WebP when both sides support it, otherwise fall back to JPEG, or PNG if we need to keep transparency
+    const bool transparent = hasTransparentPixels(image);
+    QByteArray format;
+    QString mimeType;
+    if (limits.supportedMimeTypes.contains("image/webp"_L1) && QImageWriter::supportedMimeTypes().contains(QByteArrayLiteral("image/webp"))) {
+        format = "webp";
+        mimeType = u"image/webp"_s;
+    } else if (transparent) {
+        format = "png";
+        mimeType = u"image/png"_s;
+    } else {
+        format = "jpeg";
+        mimeType = u"image/jpeg"_s;
+        image.convertTo(QImage::Format_RGB32);
+    }
+
+    // If it's still too large, lower the quality and then the resolution until it fits
+    const bool lossy = format != "png";
+    int quality = initialQuality;
+    QByteArray data = encodeImage(image, format, quality);
+    for (int attempt = 0; attempt < maximumEncodeAttempts && data.size() > limits.imageSizeLimit; attempt++) {
+        if (lossy && quality > minimumQuality) {
+            quality -= 10;
+        } else {
+            image = image.scaled(image.size() * 0.75, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+        }
+        data = encodeImage(image, format, quality);
+    }
+
+    if (data.isEmpty()) {
+        return {};
+    }
+
+    const QImage thumbnail = image.width() > thumbnailSize || image.height() > thumbnailSize
+        ? image.scaled(thumbnailSize, thumbnailSize, Qt::KeepAspectRatio, Qt::SmoothTransformation)
+        : image;
+    const QByteArray thumbnailFormat = transparent ? "png" : "jpeg";
+
+    PreparedMedia prepared;
+    prepared.fileName = baseName + u'.' + QString::fromLatin1(format);
+    prepared.mimeType = mimeType;
+    prepared.data = std::move(data);
+    prepared.size = image.size();
+    prepared.previewUrl = u"data:image/%1;base64,%2"_s.arg(QString::fromLatin1(thumbnailFormat),
+                                                           QString::fromLatin1(encodeImage(thumbnail, thumbnailFormat, 80).toBase64()));
+    prepared.blurhash = encodeBlurhash(thumbnail);
+
+    return prepared;
+}
+
+QSize MediaPreprocessor::targetSize(const QSize &size, const AbstractAccount::MediaAttachmentLimits &limits)
+{
+    const qint64 maximumPixels = limits.imageMatrixLimit > 0 ? std::min(limits.imageMatrixLimit, maximumImagePixels) : maximumImagePixels;
+    const qint64 pixels = static_cast<qint64>(size.width()) * size.height();
+    if (pixels <= maximumPixels) {
+        return size;
+    }
+
+    const double scale = std::sqrt(static_cast<double>(maximumPixels) / static_cast<double>(pixels));
+    return {std::max(1, static_cast<int>(size.width() * scale)), std::max(1, static_cast<int>(size.height() * scale))};
+}
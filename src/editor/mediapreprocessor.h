@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include "account/abstractaccount.h"
+
+#include <QFuture>
+#include <QImage>
+
+/**
+ * @brief A file that has been prepared for upload.
+ * @see MediaPreprocessor
+ */
+struct PreparedMedia {
+    QString fileName; /**< The file name reported to the server. */
+    QString mimeType; /**< The MIME type of the uploaded contents. */
+    QByteArray data; /**< The re-encoded contents, or empty if the file at localPath should be uploaded as-is. */
+    QString localPath; /**< The original file, if there is one. */
+    QSize size; /**< The dimensions of the uploaded image, or invalid if it isn't one. */
+    QString previewUrl; /**< A small local thumbnail as a data URL, or empty if it isn't an image. */
+    QString blurhash; /**< The blurhash of the image, or empty if it isn't one. */
+
+    /**
+     * @return If there's anything to upload.
+     */
+    bool isValid() const;
+};
+
+/**
+ * @brief Prepares media for upload: images are downsized to what the instance accepts, re-encoded to a compact format without their metadata, and
+ * get a thumbnail and blurhash for displaying them before the upload finishes.
+ *
+ * Anything that isn't a still image (videos, audio, animated images) is uploaded as-is.
+ */
+class MediaPreprocessor
+{
+public:
+    /**
+     * @brief The maximum number of pixels an image is downsized to, even if the instance would accept more. Mastodon downsizes anything larger than 4K
+     * itself, so uploading more only wastes bandwidth.
+     */
+    static constexpr qint64 maximumImagePixels = 3840 * 2160;
+
+    /**
+     * @brief Prepares the file at @p path on a background thread.
+     */
+    static QFuture<PreparedMedia> prepareFile(const QString &path, const AbstractAccount::MediaAttachmentLimits &limits);
+
+    /**
+     * @brief Prepares an in-memory @p image (like one pasted from the clipboard) on a background thread.
+     */
+    static QFuture<PreparedMedia> prepareImage(const QImage &image, const AbstractAccount::MediaAttachmentLimits &limits);
+
+    /**
+     * @brief Synchronous version of prepareFile().
+     */
+    static PreparedMedia processFile(const QString &path, const AbstractAccount::MediaAttachmentLimits &limits);
+
+    /**
+     * @brief Synchronous version of prepareImage(), naming the result @p baseName.
+     */
+    static PreparedMedia processImage(QImage image, const QString &baseName, const AbstractAccount::MediaAttachmentLimits &limits);
+
+    /**
+     * @return The size an image of @p size is downsized to, keeping its aspect ratio.
+     */
+    static QSize targetSize(const QSize &size, const AbstractAccount::MediaAttachmentLimits &limits);
+};
@@ -19,6 +19,12 @@ PostEditorBackend::PostEditorBackend(QObject *parent)
     , m_account(AccountManager::instance().selectedAccount())
     , m_attachmentEditorModel(new AttachmentEditorModel(this, m_account))
 {
+    // A post waiting for its media isn't sent without it, the user has to remove the failed attachment and send it again
+    connect(m_attachmentEditorModel, &AttachmentEditorModel::uploadFailed, this, [this](const QString &errorMessage) {
+        disconnect(m_attachmentEditorModel, &AttachmentEditorModel::readyChanged, this, &PostEditorBackend::save);
+        disconnect(m_attachmentEditorModel, &AttachmentEditorModel::readyChanged, this, &PostEditorBackend::edit);
+        Q_EMIT posted(errorMessage);
+    });
 }
 
 PostEditorBackend::~PostEditorBackend() = default;
@@ -246,6 +252,12 @@ QJsonDocument PostEditorBackend::toJsonDocument() const
 
 void PostEditorBackend::save()
 {
+    // Media can't be attached until the server has processed it, so post as soon as it's done
+    if (!m_attachmentEditorModel->isReady()) {
+        connect(m_attachmentEditorModel, &AttachmentEditorModel::readyChanged, this, &PostEditorBackend::save, static_cast<Qt::ConnectionType>(Qt::SingleShotConnection | Qt::UniqueConnection));
+        return;
+    }
+
     QUrl post_status_url = m_account->apiUrl(QStringLiteral("/api/v1/statuses"));
     auto doc = toJsonDocument();
 
@@ -276,6 +288,11 @@ void PostEditorBackend::save()
 
 void PostEditorBackend::edit()
 {
+    if (!m_attachmentEditorModel->isReady()) {
+        connect(m_attachmentEditorModel, &AttachmentEditorModel::readyChanged, this, &PostEditorBackend::edit, static_cast<Qt::ConnectionType>(Qt::SingleShotConnection | Qt::UniqueConnection));
+        return;
+    }
+
     QUrl edit_status_url = m_account->apiUrl(QStringLiteral("/api/v1/statuses/%1").arg(m_id));
     auto doc = toJsonDocument();
 
@@ -37,6 +37,7 @@
 #include "tokodon_debug.h"
 #include "utils/blurhashimageprovider.h"
 #include "utils/colorschemer.h"
+#include "utils/customemojiimageprovider.h"
 #include "utils/windowcontroller.h"
 
 #ifdef Q_OS_WINDOWS
@@ -231,6 +232,7 @@ int main(int argc, char *argv[])
     engine.setNetworkAccessManagerFactory(&namFactory);
 
     engine.addImageProvider(QLatin1String("blurhash"), new BlurhashImageProvider);
+    engine.addImageProvider(QLatin1String("customemoji"), new CustomEmojiImageProvider);
 
 #ifdef TEST_MODE
     AccountManager::instance().setTestMode(true);
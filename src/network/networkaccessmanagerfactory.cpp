@@ -3,10 +3,14 @@
 
 #include "network/networkaccessmanagerfactory.h"
 
+#include "network/networkdiskcache.h"
+
+#include <QDir>
 #include <QNetworkAccessManager>
-#include <QNetworkDiskCache>
 #include <QStandardPaths>
-#include <QThread>
+#include <QThreadPool>
+
+#include <mutex>
 
 QNetworkAccessManager *NetworkAccessManagerFactory::create(QObject *parent)
 {
@@ -17,8 +21,18 @@ QNetworkAccessManager *NetworkAccessManagerFactory::create(QObject *parent)
     nam->enableStrictTransportSecurityStore(true, QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QLatin1String("/hsts/"));
     nam->setStrictTransportSecurityEnabled(true);
 
-    auto namDiskCache = new QNetworkDiskCache(nam);
-    namDiskCache->setCacheDirectory(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QLatin1String("/nam/"));
+    // Remove the cache left behind by QNetworkDiskCache, from before content classes got their own budgets
+    static std::once_flag removeOldCache;
+    std::call_once(removeOldCache, [] {
+        const QString oldCacheDirectory = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QLatin1String("/nam/");
+        if (QDir(oldCacheDirectory).exists()) {
+            QThreadPool::globalInstance()->start([oldCacheDirectory] {
+                QDir(oldCacheDirectory).removeRecursively();
+            });
+        }
+    });
+
+    auto namDiskCache = new NetworkDiskCache(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QLatin1String("/network/"), nam);
     nam->setCache(namDiskCache);
 
     return nam;
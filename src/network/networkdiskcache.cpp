@@ -0,0 +1,607 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "network/networkdiskcache.h"
+
+#include "tokodon_http_debug.h"
+
+#include <QBuffer>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QDirIterator>
+#include <QMutex>
+#include <QSaveFile>
+#include <QThreadPool>
+
+#include <algorithm>
+#include <array>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+constexpr quint32 cacheMagic = 0x746f6b64; // "tokd"
+constexpr qint32 cacheVersion = 1;
+
+// Once a tier goes over budget, evict down to a bit below it so we don't end up evicting again on the very next insert.
+constexpr double evictionLowWatermark = 0.9;
+
+const std::array<QLatin1String, NetworkDiskCache::ContentClassCount> tierDirectories = {
+    "api"_L1,
+    "avatars"_L1,
+    "emojis"_L1,
+    "previews"_L1,
+    "originals"_L1,
+};
+
+QByteArray cacheKey(const QUrl &url)
+{
+    return QCryptographicHash::hash(url.adjusted(QUrl::RemoveFragment).toEncoded(), QCryptographicHash::Sha1).toHex();
+}
+}
+
+/**
+ * @brief The on-disk store and in-memory index shared between all caches using the same directory.
+ *
+ * Reads and writes of the entry files happen on the caller's thread, the index is protected by a mutex and indexing and eviction run in a
+ * single-threaded pool.
+ */
+class NetworkDiskCacheStore
+{
+public:
+    struct Entry {
+        qint64 size = 0;
+        quint32 hits = 0;
+        double priority = 0;
+        qint64 lastAccess = 0;
+    };
+
+    struct Tier {
+        QString directory;
+        qint64 maximumSize = 0;
+        qint64 currentSize = 0;
+        // GDSF inflation value, the priority of the last evicted entry.
+        double inflation = 0;
+        bool evictionPending = false;
+        QHash<QByteArray, Entry> entries;
+        NetworkDiskCache::Statistics statistics;
+    };
+
+    explicit NetworkDiskCacheStore(const QString &directory)
+        : m_directory(directory)
+    {
+        for (int i = 0; i < NetworkDiskCache::ContentClassCount; i++) {
+            const auto contentClass = static_cast<NetworkDiskCache::ContentClass>(i);
+            m_tiers[i].directory = m_directory + QLatin1Char('/') + tierDirectories[i];
+            m_tiers[i].maximumSize = NetworkDiskCache::defaultMaximumCacheSize(contentClass);
+            QDir().mkpath(m_tiers[i].directory);
+        }
+
+        m_pool.setMaxThreadCount(1);
+        m_pool.start([this] {
+            buildIndex();
+        });
+    }
+
+    ~NetworkDiskCacheStore()
+    {
+        m_pool.waitForDone();
+
+        for (int i = 0; i < NetworkDiskCache::ContentClassCount; i++) {
+            const auto &stats = m_tiers[i].statistics;
+            qCDebug(TOKODON_HTTP) << "Cache" << tierDirectories[i] << "hits:" << stats.hits << "misses:" << stats.misses << "evictions:" << stats.evictions;
+        }
+    }
+
+    static std::shared_ptr<NetworkDiskCacheStore> forDirectory(const QString &directory)
+    {
+        static QMutex storesMutex;
+        static QHash<QString, std::weak_ptr<NetworkDiskCacheStore>> stores;
+
+        QMutexLocker locker(&storesMutex);
+        auto store = stores.value(directory).lock();
+        if (!store) {
+            store = std::make_shared<NetworkDiskCacheStore>(directory);
+            stores[directory] = store;
+        }
+        return store;
+    }
+
+    QString filePath(NetworkDiskCache::ContentClass contentClass, const QByteArray &key) const
+    {
+        return m_tiers[contentClass].directory + QLatin1Char('/') + QString::fromLatin1(key);
+    }
+
+    void recordAccess(NetworkDiskCache::ContentClass contentClass, const QByteArray &key, bool hit)
+    {
+        QMutexLocker locker(&m_mutex);
+        auto &tier = m_tiers[contentClass];
+        if (!hit) {
+            tier.statistics.misses++;
+            return;
+        }
+
+        tier.statistics.hits++;
+        auto it = tier.entries.find(key);
+        if (it != tier.entries.end()) {
+            it->hits++;
+            it->lastAccess = QDateTime::currentSecsSinceEpoch();
+            it->priority = priorityFor(tier, *it);
+        }
+    }
+
+    void recordInsert(NetworkDiskCache::ContentClass contentClass, const QByteArray &key, qint64 size)
+    {
+        QMutexLocker locker(&m_mutex);
+        auto &tier = m_tiers[contentClass];
+
+        auto &entry = tier.entries[key];
+        tier.currentSize += size - entry.size;
+        entry.size = size;
+        entry.lastAccess = QDateTime::currentSecsSinceEpoch();
+        entry.priority = priorityFor(tier, entry);
+
+        scheduleEvictionIfNeeded(contentClass);
+    }
+
+    void recordRemove(NetworkDiskCache::ContentClass contentClass, const QByteArray &key)
+    {
+        QMutexLocker locker(&m_mutex);
+        auto &tier = m_tiers[contentClass];
+
+        const auto it = tier.entries.constFind(key);
+        if (it != tier.entries.cend()) {
+            tier.currentSize -= it->size;
+            tier.entries.erase(it);
+        }
+    }
+
+    void clear()
+    {
+        QMutexLocker locker(&m_mutex);
+        for (auto &tier : m_tiers) {
+            QDir(tier.directory).removeRecursively();
+            QDir().mkpath(tier.directory);
+            tier.entries.clear();
+            tier.currentSize = 0;
+            tier.inflation = 0;
+        }
+    }
+
+    qint64 maximumSize(NetworkDiskCache::ContentClass contentClass) const
+    {
+        QMutexLocker locker(&m_mutex);
+        return m_tiers[contentClass].maximumSize;
+    }
+
+    void setMaximumSize(NetworkDiskCache::ContentClass contentClass, qint64 size)
+    {
+        QMutexLocker locker(&m_mutex);
+        m_tiers[contentClass].maximumSize = size;
+        scheduleEvictionIfNeeded(contentClass);
+    }
+
+    qint64 totalSize() const
+    {
+        QMutexLocker locker(&m_mutex);
+        qint64 size = 0;
+        for (const auto &tier : m_tiers) {
+            size += tier.currentSize;
+        }
+        return size;
+    }
+
+    NetworkDiskCache::Statistics statistics(NetworkDiskCache::ContentClass contentClass) const
+    {
+        QMutexLocker locker(&m_mutex);
+        const auto &tier = m_tiers[contentClass];
+
+        auto stats = tier.statistics;
+        stats.size = tier.currentSize;
+        stats.maximumSize = tier.maximumSize;
+        stats.entries = tier.entries.size();
+        return stats;
+    }
+
+private:
+    // Greedy-Dual-Size-Frequency: frequently used, small entries are the most valuable. The inflation value ages out entries that were popular once.
+    static double priorityFor(const Tier &tier, const Entry &entry)
+    {
+        const double sizeInKiB = std::max<qint64>(entry.size / 1024, 1);
+        return tier.inflation + (entry.hits + 1) / sizeInKiB;
+    }
+
+    // Must be called with m_mutex held.
+    void scheduleEvictionIfNeeded(NetworkDiskCache::ContentClass contentClass)
+    {
+        auto &tier = m_tiers[contentClass];
+        if (tier.evictionPending || tier.currentSize <= tier.maximumSize) {
+            return;
+        }
+
+        tier.evictionPending = true;
+        m_pool.start([this, contentClass] {
+            evict(contentClass);
+        });
+    }
+
+    void buildIndex()
+    {
+        for (int i = 0; i < NetworkDiskCache::ContentClassCount; i++) {
+            QHash<QByteArray, Entry> entries;
+
+            QDirIterator it(m_tiers[i].directory, QDir::Files);
+            while (it.hasNext()) {
+                it.next();
+                const auto info = it.fileInfo();
+
+                Entry entry;
+                entry.size = info.size();
+                entry.lastAccess = info.lastModified().toSecsSinceEpoch();
+                entries.insert(info.fileName().toLatin1(), entry);
+            }
+
+            QMutexLocker locker(&m_mutex);
+            auto &tier = m_tiers[i];
+            for (auto entryIt = entries.cbegin(); entryIt != entries.cend(); ++entryIt) {
+                // Anything that was inserted in the meantime is more up to date
+                if (tier.entries.contains(entryIt.key())) {
+                    continue;
+                }
+
+                auto &entry = tier.entries[entryIt.key()];
+                entry = entryIt.value();
+                entry.priority = priorityFor(tier, entry);
+                tier.currentSize += entry.size;
+            }
+
+            scheduleEvictionIfNeeded(static_cast<NetworkDiskCache::ContentClass>(i));
+        }
+    }
+
+    void evict(NetworkDiskCache::ContentClass contentClass)
+    {
+        QList<QByteArray> victims;
+
+        {
+            QMutexLocker locker(&m_mutex);
+            auto &tier = m_tiers[contentClass];
+            tier.evictionPending = false;
+
+            const auto target = static_cast<qint64>(tier.maximumSize * evictionLowWatermark);
+            if (tier.currentSize <= target) {
+                return;
+            }
+
+            struct Candidate {
+                QByteArray key;
+                double priority;
+                qint64 lastAccess;
+            };
+            std::vector<Candidate> candidates;
+            candidates.reserve(tier.entries.size());
+            for (auto it = tier.entries.cbegin(); it != tier.entries.cend(); ++it) {
+                candidates.push_back({it.key(), it->priority, it->lastAccess});
+            }
+            std::sort(candidates.begin(), candidates.end(), [](const Candidate &a, const Candidate &b) {
+                if (a.priority != b.priority) {
+                    return a.priority < b.priority;
+                }
+                return a.lastAccess < b.lastAccess;
+            });
+
+            for (const auto &candidate : candidates) {
+                if (tier.currentSize <= target) {
+                    break;
+                }
+
+                tier.currentSize -= tier.entries.take(candidate.key).size;
+                tier.inflation = candidate.priority;
+                tier.statistics.evictions++;
+                victims.push_back(candidate.key);
+            }
+
+            qCDebug(TOKODON_HTTP) << "Evicting" << victims.size() << "entries from cache" << tierDirectories[contentClass];
+        }
+
+        for (const auto &key : std::as_const(victims)) {
+            QMutexLocker locker(&m_mutex);
+            // Don't delete the file if it was re-inserted since we picked it.
+            if (!m_tiers[contentClass].entries.contains(key)) {
+                QFile::remove(filePath(contentClass, key));
+            }
+        }
+    }
+
+    const QString m_directory;
+    mutable QMutex m_mutex;
+    std::array<Tier, NetworkDiskCache::ContentClassCount> m_tiers;
+    QThreadPool m_pool;
+};
+
+NetworkDiskCache::NetworkDiskCache(const QString &cacheDirectory, QObject *parent)
+    : QAbstractNetworkCache(parent)
+    , m_store(NetworkDiskCacheStore::forDirectory(QDir::cleanPath(cacheDirectory)))
+{
+}
+
+NetworkDiskCache::~NetworkDiskCache()
+{
+    qDeleteAll(m_inserting.keyBegin(), m_inserting.keyEnd());
+}
+
+NetworkDiskCache::ContentClass NetworkDiskCache::classify(const QUrl &url)
+{
+    const QString path = url.path();
+
+    if (path.startsWith("/api/"_L1) || path.startsWith("/nodeinfo/"_L1) || path.startsWith("/.well-known/"_L1) || path.startsWith("/oauth/"_L1)) {
+        return Api;
+    }
+    // Checked before previews, as avatars also come in a static and original variant
+    if (path.contains("/avatars/"_L1) || path.contains("/headers/"_L1)) {
+        return Avatar;
+    }
+    if (path.contains("/custom_emojis/"_L1) || path.contains("/emoji/"_L1)) {
+        return Emoji;
+    }
+    if (path.contains("/small/"_L1) || path.contains("/preview_cards/"_L1)) {
+        return Preview;
+    }
+
+    return Original;
+}
+
+qint64 NetworkDiskCache::defaultMaximumCacheSize(ContentClass contentClass)
+{
+    constexpr qint64 MiB = 1024 * 1024;
+
+    switch (contentClass) {
+    case Api:
+        return 20 * MiB;
+    case Avatar:
+        return 50 * MiB;
+    case Emoji:
+        return 20 * MiB;
+    case Preview:
+        return 150 * MiB;
+    case Original:
+    case ContentClassCount:
+        break;
+    }
+
+    return 250 * MiB;
+}
+
+qint64 NetworkDiskCache::maximumCacheSize(ContentClass contentClass) const
+{
+    return m_store->maximumSize(contentClass);
+}
+
+void NetworkDiskCache::setMaximumCacheSize(ContentClass contentClass, qint64 size)
+{
+    m_store->setMaximumSize(contentClass, size);
+}
+
+NetworkDiskCache::Statistics NetworkDiskCache::statistics(ContentClass contentClass) const
+{
+    return m_store->statistics(contentClass);
+}
+
+QNetworkCacheMetaData NetworkDiskCache::metaData(const QUrl &url)
+{
+    const auto contentClass = classify(url);
+    const auto key = cacheKey(url);
+
+    QFile file(m_store->filePath(contentClass, key));
+    if (!file.open(QIODevice::ReadOnly)) {
+        m_store->recordAccess(contentClass, key, false);
+        return {};
+    }
+
+    QDataStream stream(&file);
+    quint32 magic = 0;
+    qint32 version = 0;
+    QNetworkCacheMetaData metaData;
+    stream >> magic >> version;
+    if (magic != cacheMagic || version != cacheVersion) {
+        file.close();
+        remove(url);
+        return {};
+    }
+    stream >> metaData;
+
+    if (stream.status() != QDataStream::Ok) {
+        file.close();
+        remove(url);
+        return {};
+    }
+
+    if (metaData.url().adjusted(QUrl::RemoveFragment) != url.adjusted(QUrl::RemoveFragment)) {
+        return {};
+    }
+
+    return metaData;
+}
+
+void NetworkDiskCache::updateMetaData(const QNetworkCacheMetaData &metaData)
+{
+    const QUrl url = metaData.url();
+    const auto contentClass = classify(url);
+    const auto key = cacheKey(url);
+    const QString path = m_store->filePath(contentClass, key);
+
+    QFile oldFile(path);
+    if (!oldFile.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    QDataStream oldStream(&oldFile);
+    quint32 magic = 0;
+    qint32 version = 0;
+    QNetworkCacheMetaData oldMetaData;
+    oldStream >> magic >> version >> oldMetaData;
+    if (magic != cacheMagic || version != cacheVersion || oldStream.status() != QDataStream::Ok) {
+        oldFile.close();
+        remove(url);
+        return;
+    }
+
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(TOKODON_HTTP) << "Failed to update cache entry for" << url << file.errorString();
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream << cacheMagic << cacheVersion << metaData;
+
+    // Only the header changes, so the serialized payload is copied over as-is. Revalidating isn't a hit either.
+    std::array<char, 64 * 1024> buffer;
+    qint64 read = 0;
+    while ((read = oldFile.read(buffer.data(), buffer.size())) > 0) {
+        file.write(buffer.data(), read);
+    }
+    const qint64 size = file.pos();
+    oldFile.close();
+
+    if (read < 0 || !file.commit()) {
+        qCWarning(TOKODON_HTTP) << "Failed to update cache entry for" << url << file.errorString();
+        return;
+    }
+
+    m_store->recordInsert(contentClass, key, size);
+}
+
+QIODevice *NetworkDiskCache::data(const QUrl &url)
+{
+    const auto contentClass = classify(url);
+    const auto key = cacheKey(url);
+
+    QFile file(m_store->filePath(contentClass, key));
+    if (!file.open(QIODevice::ReadOnly)) {
+        m_store->recordAccess(contentClass, key, false);
+        return nullptr;
+    }
+
+    QDataStream stream(&file);
+    quint32 magic = 0;
+    qint32 version = 0;
+    QNetworkCacheMetaData metaData;
+    QByteArray payload;
+    stream >> magic >> version;
+    if (magic != cacheMagic || version != cacheVersion) {
+        file.close();
+        remove(url);
+        return nullptr;
+    }
+    stream >> metaData >> payload;
+
+    if (stream.status() != QDataStream::Ok) {
+        file.close();
+        remove(url);
+        return nullptr;
+    }
+
+    m_store->recordAccess(contentClass, key, true);
+
+    auto buffer = new QBuffer;
+    buffer->setData(payload);
+    buffer->open(QIODevice::ReadOnly);
+    return buffer;
+}
+
+bool NetworkDiskCache::remove(const QUrl &url)
+{
+    const QUrl cleanUrl = url.adjusted(QUrl::RemoveFragment);
+
+    // Also drop any pending insert for this url, QNetworkAccessManager uses this to cancel them
+    for (auto it = m_inserting.begin(); it != m_inserting.end();) {
+        if (it->url() == cleanUrl) {
+            delete it.key();
+            it = m_inserting.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    const auto contentClass = classify(url);
+    const auto key = cacheKey(url);
+
+    m_store->recordRemove(contentClass, key);
+    return QFile::remove(m_store->filePath(contentClass, key));
+}
+
+qint64 NetworkDiskCache::cacheSize() const
+{
+    return m_store->totalSize();
+}
+
+QIODevice *NetworkDiskCache::prepare(const QNetworkCacheMetaData &metaData)
+{
+    if (!metaData.isValid() || !metaData.url().isValid() || !metaData.saveToDisk()) {
+        return nullptr;
+    }
+
+    // Don't bother caching something that would take up most of its budget
+    const auto contentClass = classify(metaData.url());
+    const auto headers = metaData.rawHeaders();
+    for (const auto &[name, value] : headers) {
+        if (name.compare("content-length", Qt::CaseInsensitive) == 0 && value.toLongLong() > m_store->maximumSize(contentClass) / 4) {
+            return nullptr;
+        }
+    }
+
+    auto buffer = new QBuffer;
+    buffer->open(QIODevice::ReadWrite);
+    m_inserting.insert(buffer, metaData);
+    return buffer;
+}
+
+void NetworkDiskCache::insert(QIODevice *device)
+{
+    const auto it = m_inserting.constFind(device);
+    if (it == m_inserting.cend()) {
+        qCWarning(TOKODON_HTTP) << "Tried to insert an unknown device into the cache";
+        return;
+    }
+
+    const QNetworkCacheMetaData metaData = it.value();
+    m_inserting.erase(it);
+
+    const auto buffer = qobject_cast<QBuffer *>(device);
+    const QByteArray payload = buffer->data();
+    delete device;
+
+    const QUrl url = metaData.url();
+    const auto contentClass = classify(url);
+    const auto key = cacheKey(url);
+
+    QSaveFile file(m_store->filePath(contentClass, key));
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(TOKODON_HTTP) << "Failed to write cache entry for" << url << file.errorString();
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream << cacheMagic << cacheVersion << metaData << payload;
+    const qint64 size = file.pos();
+
+    if (!file.commit()) {
+        qCWarning(TOKODON_HTTP) << "Failed to write cache entry for" << url << file.errorString();
+        return;
+    }
+
+    m_store->recordInsert(contentClass, key, size);
+}
+
+void NetworkDiskCache::clear()
+{
+    qDeleteAll(m_inserting.keyBegin(), m_inserting.keyEnd());
+    m_inserting.clear();
+
+    m_store->clear();
+}
+
+#include "moc_networkdiskcache.cpp"
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QAbstractNetworkCache>
+#include <QHash>
+
+class NetworkDiskCacheStore;
+
+/**
+ * @brief Disk cache for network replies, with a separate size budget for each kind of content.
+ *
+ * Unlike QNetworkDiskCache, a large full-size image can only ever evict other full-size images, and never the avatars or emojis that are shown on every
+ * timeline page. Entries are evicted by access frequency relative to their size (GDSF), and eviction runs on a background thread.
+ *
+ * All caches pointing to the same directory share one store, so the network access managers QML creates for its loader threads see the same entries and
+ * budgets.
+ */
+class NetworkDiskCache : public QAbstractNetworkCache
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief The content classes that each get their own budget.
+     */
+    enum ContentClass {
+        Api, /**< JSON responses from the REST API, nodeinfo, etc. */
+        Avatar, /**< Profile avatars and headers. */
+        Emoji, /**< Custom emoji images. */
+        Preview, /**< Media thumbnails and link preview images. */
+        Original, /**< Full-size media and anything else. */
+        ContentClassCount,
+    };
+    Q_ENUM(ContentClass)
+
+    /**
+     * @brief Usage statistics for a single content class.
+     */
+    struct Statistics {
+        qint64 hits = 0;
+        qint64 misses = 0;
+        qint64 evictions = 0;
+        qint64 size = 0;
+        qint64 maximumSize = 0;
+        qsizetype entries = 0;
+    };
+
+    /**
+     * @brief Creates a cache storing its entries below @p cacheDirectory.
+     */
+    explicit NetworkDiskCache(const QString &cacheDirectory, QObject *parent = nullptr);
+    ~NetworkDiskCache() override;
+
+    /**
+     * @return The content class @p url is cached under.
+     */
+    static ContentClass classify(const QUrl &url);
+
+    /**
+     * @return The default budget in bytes for @p contentClass.
+     */
+    static qint64 defaultMaximumCacheSize(ContentClass contentClass);
+
+    /**
+     * @return The budget in bytes for @p contentClass.
+     */
+    qint64 maximumCacheSize(ContentClass contentClass) const;
+
+    /**
+     * @brief Sets the budget in bytes for @p contentClass, evicting entries in the background if it's now over budget.
+     */
+    void setMaximumCacheSize(ContentClass contentClass, qint64 size);
+
+    /**
+     * @return The hit, miss and eviction counters for @p contentClass.
+     */
+    Statistics statistics(ContentClass contentClass) const;
+
+    QNetworkCacheMetaData metaData(const QUrl &url) override;
+    void updateMetaData(const QNetworkCacheMetaData &metaData) override;
+    QIODevice *data(const QUrl &url) override;
+    bool remove(const QUrl &url) override;
+    qint64 cacheSize() const override;
+    QIODevice *prepare(const QNetworkCacheMetaData &metaData) override;
+    void insert(QIODevice *device) override;
+
+public Q_SLOTS:
+    void clear() override;
+
+private:
+    std::shared_ptr<NetworkDiskCacheStore> m_store;
+    QHash<QIODevice *, QNetworkCacheMetaData> m_inserting;
+};
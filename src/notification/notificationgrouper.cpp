@@ -0,0 +1,327 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "notification/notificationgrouper.h"
+
+#include "timeline/notification.h"
+
+struct NotificationGrouper::Entry {
+    int row = 0;
+    Group *group = nullptr;
+    int index = -1;
+};
+
+struct NotificationGrouper::Group {
+    std::pair<QString, int> key;
+    QList<Entry *> members;
+    qsizetype slot = 0;
+    bool front = false;
+};
+
+NotificationGrouper::NotificationGrouper() = default;
+
+NotificationGrouper::~NotificationGrouper() = default;
+
+bool NotificationGrouper::isGroupable(int type)
+{
+    // It makes no sense to group poll or edit updates
+    // TODO: support grouping follow notifications
+    switch (type) {
+    case Notification::Follow:
+    case Notification::Poll:
+    case Notification::Update:
+    case Notification::Status:
+    case Notification::AdminSignUp:
+        return false;
+    default:
+        return true;
+    }
+}
+
+void NotificationGrouper::reset(const QList<Key> &keys)
+{
+    clear();
+
+    m_entries.reserve(keys.size());
+    for (qsizetype i = 0; i < keys.size(); i++) {
+        m_entries.push_back(std::make_unique<Entry>(Entry{static_cast<int>(i)}));
+    }
+
+    // Every group starts with its earliest notification, and the rest follow from the latest one
+    for (qsizetype i = 0; i < keys.size(); i++) {
+        if (!findGroup(keys[i])) {
+            addGroup(static_cast<int>(i), keys[i]);
+        }
+    }
+    for (qsizetype i = keys.size() - 1; i >= 0; i--) {
+        if (m_entries[i]->group == nullptr) {
+            addToGroup(findGroup(keys[i]), static_cast<int>(i));
+        }
+    }
+}
+
+void NotificationGrouper::clear()
+{
+    m_entries.clear();
+    m_back = {};
+    m_front = {};
+    m_groupsByKey.clear();
+}
+
+int NotificationGrouper::groupCount() const
+{
+    return m_front.live + m_back.live;
+}
+
+NotificationGrouper::Group *NotificationGrouper::groupAt(int row) const
+{
+    if (row < 0 || row >= groupCount()) {
+        return nullptr;
+    }
+
+    // Front groups are stored bottom to top
+    if (row < m_front.live) {
+        return m_front.groups[findSlot(m_front, m_front.live - 1 - row)].get();
+    }
+
+    return m_back.groups[findSlot(m_back, row - m_front.live)].get();
+}
+
+int NotificationGrouper::groupRow(const Group *group) const
+{
+    if (group->front) {
+        return m_front.live - prefixSum(m_front, group->slot + 1);
+    }
+
+    return m_front.live + prefixSum(m_back, group->slot);
+}
+
+int NotificationGrouper::groupSize(const Group *group) const
+{
+    return static_cast<int>(group->members.size());
+}
+
+int NotificationGrouper::memberRow(const Group *group, int index) const
+{
+    return group->members[index]->row;
+}
+
+NotificationGrouper::Group *NotificationGrouper::groupOf(int sourceRow) const
+{
+    if (sourceRow < 0 || sourceRow >= static_cast<int>(m_entries.size())) {
+        return nullptr;
+    }
+
+    return m_entries[sourceRow]->group;
+}
+
+int NotificationGrouper::memberIndex(int sourceRow) const
+{
+    if (sourceRow < 0 || sourceRow >= static_cast<int>(m_entries.size())) {
+        return -1;
+    }
+
+    return m_entries[sourceRow]->index;
+}
+
+NotificationGrouper::Group *NotificationGrouper::findGroup(const Key &key) const
+{
+    if (!isGroupable(key.type)) {
+        return nullptr;
+    }
+
+    return m_groupsByKey.value({key.id, key.type});
+}
+
+void NotificationGrouper::insertSourceRows(int first, int count)
+{
+    std::vector<std::unique_ptr<Entry>> inserted;
+    inserted.reserve(count);
+    for (int i = 0; i < count; i++) {
+        inserted.push_back(std::make_unique<Entry>(Entry{first + i}));
+    }
+    m_entries.insert(m_entries.begin() + first, std::make_move_iterator(inserted.begin()), std::make_move_iterator(inserted.end()));
+
+    // Only the rows after the new ones move, which is none when they're appended
+    for (auto it = m_entries.begin() + first + count; it != m_entries.end(); ++it) {
+        (*it)->row += count;
+    }
+}
+
+void NotificationGrouper::addToGroup(Group *group, int sourceRow)
+{
+    Entry *entry = m_entries[sourceRow].get();
+    Q_ASSERT(entry->group == nullptr);
+
+    entry->group = group;
+    entry->index = static_cast<int>(group->members.size());
+    group->members.push_back(entry);
+}
+
+void NotificationGrouper::addGroup(int sourceRow, const Key &key)
+{
+    appendSlot(m_back, createGroup(sourceRow, key));
+}
+
+void NotificationGrouper::addGroupToFront(int sourceRow, const Key &key)
+{
+    appendSlot(m_front, createGroup(sourceRow, key));
+}
+
+void NotificationGrouper::moveToFront(Group *group)
+{
+    appendSlot(m_front, takeSlot(group));
+}
+
+void NotificationGrouper::removeFromGroup(int sourceRow)
+{
+    Entry *entry = m_entries[sourceRow].get();
+    Group *group = entry->group;
+    if (group == nullptr) {
+        return;
+    }
+
+    group->members.removeAt(entry->index);
+    for (qsizetype i = entry->index; i < group->members.size(); i++) {
+        group->members[i]->index = static_cast<int>(i);
+    }
+    entry->group = nullptr;
+    entry->index = -1;
+
+    if (group->members.isEmpty()) {
+        if (m_groupsByKey.value(group->key) == group) {
+            m_groupsByKey.remove(group->key);
+        }
+
+        takeSlot(group);
+    }
+}
+
+void NotificationGrouper::removeSourceRows(int first, int count)
+{
+    for (int i = first; i < first + count; i++) {
+        Q_ASSERT(m_entries[i]->group == nullptr);
+    }
+
+    m_entries.erase(m_entries.begin() + first, m_entries.begin() + first + count);
+    for (auto it = m_entries.begin() + first; it != m_entries.end(); ++it) {
+        (*it)->row -= count;
+    }
+}
+
+QList<QList<int>> NotificationGrouper::groups() const
+{
+    QList<QList<int>> groups;
+    groups.reserve(groupCount());
+    for (int row = 0; row < groupCount(); row++) {
+        const Group *group = groupAt(row);
+
+        QList<int> rows;
+        rows.reserve(group->members.size());
+        for (const Entry *entry : std::as_const(group->members)) {
+            rows.push_back(entry->row);
+        }
+        groups.push_back(rows);
+    }
+
+    return groups;
+}
+
+std::unique_ptr<NotificationGrouper::Group> NotificationGrouper::createGroup(int sourceRow, const Key &key)
+{
+    auto group = std::make_unique<Group>();
+    group->key = {key.id, key.type};
+    if (isGroupable(key.type)) {
+        m_groupsByKey.insert(group->key, group.get());
+    }
+
+    addToGroup(group.get(), sourceRow);
+    return group;
+}
+
+NotificationGrouper::Slots &NotificationGrouper::slotsOf(const Group *group)
+{
+    return group->front ? m_front : m_back;
+}
+
+void NotificationGrouper::appendSlot(Slots &slots, std::unique_ptr<Group> group)
+{
+    group->slot = static_cast<qsizetype>(slots.groups.size());
+    group->front = &slots == &m_front;
+    slots.groups.push_back(std::move(group));
+
+    // A new node covers its own slot and the range below it that its lowest bit spans
+    const qsizetype node = static_cast<qsizetype>(slots.tree.size());
+    slots.tree.push_back(1 + prefixSum(slots, node - 1) - prefixSum(slots, node - (node & -node)));
+    slots.live++;
+}
+
+std::unique_ptr<NotificationGrouper::Group> NotificationGrouper::takeSlot(Group *group)
+{
+    Slots &slots = slotsOf(group);
+
+    addToTree(slots, group->slot, -1);
+    auto taken = std::move(slots.groups[group->slot]);
+    slots.live--;
+
+    // Removed groups leave empty slots behind, so they're cleaned up once they outnumber the live ones
+    if (slots.groups.size() > static_cast<size_t>(slots.live) * 2 + 64) {
+        compact(slots);
+    }
+
+    return taken;
+}
+
+void NotificationGrouper::compact(Slots &slots)
+{
+    std::vector<std::unique_ptr<Group>> groups;
+    groups.reserve(slots.live);
+    for (auto &group : slots.groups) {
+        if (group) {
+            group->slot = static_cast<qsizetype>(groups.size());
+            groups.push_back(std::move(group));
+        }
+    }
+    slots.groups = std::move(groups);
+
+    // Every slot is live now, so each node just counts the slots it covers
+    slots.tree.assign(slots.groups.size() + 1, 0);
+    for (qsizetype node = 1; node < static_cast<qsizetype>(slots.tree.size()); node++) {
+        slots.tree[node] = static_cast<int>(node & -node);
+    }
+}
+
+void NotificationGrouper::addToTree(Slots &slots, qsizetype slot, int delta)
+{
+    for (qsizetype node = slot + 1; node < static_cast<qsizetype>(slots.tree.size()); node += node & -node) {
+        slots.tree[node] += delta;
+    }
+}
+
+int NotificationGrouper::prefixSum(const Slots &slots, qsizetype slot)
+{
+    int sum = 0;
+    for (qsizetype node = slot; node > 0; node -= node & -node) {
+        sum += slots.tree[node];
+    }
+    return sum;
+}
+
+qsizetype NotificationGrouper::findSlot(const Slots &slots, int position)
+{
+    // Walk down the tree to the last node whose prefix doesn't reach past position, the slot after it is the one we want
+    qsizetype node = 0;
+    qsizetype step = 1;
+    while (step * 2 < static_cast<qsizetype>(slots.tree.size())) {
+        step *= 2;
+    }
+
+    for (; step > 0; step /= 2) {
+        if (node + step < static_cast<qsizetype>(slots.tree.size()) && slots.tree[node + step] <= position) {
+            node += step;
+            position -= slots.tree[node];
+        }
+    }
+
+    return node;
+}
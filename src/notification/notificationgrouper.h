@@ -0,0 +1,158 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <QString>
+
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Keeps track of which notifications are grouped together, for NotificationGroupingModel.
+ *
+ * Notifications about the same post with the same type (like several favorites of it) share a group. Groups are found by their key in a hash, and
+ * their position is kept in Fenwick trees, so neither adding nor mapping notifications has to look through every group. Groups are shown in the
+ * order they were created, except for ones added or moved to the front for new notifications, and each group's first notification is the one that
+ * created it.
+ */
+class NotificationGrouper
+{
+public:
+    /**
+     * @brief What notifications are grouped by.
+     */
+    struct Key {
+        QString id; /**< The post id. */
+        int type = 0; /**< The Notification::Type. */
+    };
+
+    struct Group;
+
+    NotificationGrouper();
+    ~NotificationGrouper();
+
+    /**
+     * @return If notifications of @p type can be grouped at all.
+     */
+    static bool isGroupable(int type);
+
+    /**
+     * @brief Groups the notifications with @p keys from scratch, where each key is for the source row of the same index.
+     */
+    void reset(const QList<Key> &keys);
+
+    /**
+     * @brief Removes every notification and group.
+     */
+    void clear();
+
+    /**
+     * @return The number of groups, including ones with only a single notification.
+     */
+    int groupCount() const;
+
+    /**
+     * @return The group at @p row.
+     */
+    Group *groupAt(int row) const;
+
+    /**
+     * @return The row of @p group.
+     */
+    int groupRow(const Group *group) const;
+
+    /**
+     * @return The number of notifications in @p group.
+     */
+    int groupSize(const Group *group) const;
+
+    /**
+     * @return The source row of the notification at @p index in @p group.
+     */
+    int memberRow(const Group *group, int index) const;
+
+    /**
+     * @return The group the notification at @p sourceRow is in, or nullptr if it isn't in one yet.
+     */
+    Group *groupOf(int sourceRow) const;
+
+    /**
+     * @return The index of the notification at @p sourceRow in its group, or -1 if it isn't in one yet.
+     */
+    int memberIndex(int sourceRow) const;
+
+    /**
+     * @return The group notifications with @p key are added to, or nullptr if there's none.
+     */
+    Group *findGroup(const Key &key) const;
+
+    /**
+     * @brief Makes room for @p count notifications at @p first, which aren't in a group yet.
+     * @see addToGroup()
+     * @see addGroup()
+     */
+    void insertSourceRows(int first, int count);
+
+    /**
+     * @brief Adds the notification at @p sourceRow to the end of @p group.
+     */
+    void addToGroup(Group *group, int sourceRow);
+
+    /**
+     * @brief Adds the notification at @p sourceRow with @p key as a new group at the end.
+     */
+    void addGroup(int sourceRow, const Key &key);
+
+    /**
+     * @brief Adds the notification at @p sourceRow with @p key as a new group at the front, above every other group.
+     */
+    void addGroupToFront(int sourceRow, const Key &key);
+
+    /**
+     * @brief Moves @p group to the front, above every other group.
+     */
+    void moveToFront(Group *group);
+
+    /**
+     * @brief Takes the notification at @p sourceRow out of its group, which is removed if it becomes empty.
+     */
+    void removeFromGroup(int sourceRow);
+
+    /**
+     * @brief Removes the @p count notifications at @p first, which must have been taken out of their groups.
+     * @see removeFromGroup()
+     */
+    void removeSourceRows(int first, int count);
+
+    /**
+     * @return The source rows of every group in order.
+     */
+    QList<QList<int>> groups() const;
+
+private:
+    struct Entry;
+
+    // The Fenwick tree counts live groups per slot, so a group's position is the number of live slots before it
+    struct Slots {
+        std::vector<std::unique_ptr<Group>> groups; // With empty slots for removed groups
+        std::vector<int> tree{0}; // One-based
+        int live = 0;
+    };
+
+    std::unique_ptr<Group> createGroup(int sourceRow, const Key &key);
+    Slots &slotsOf(const Group *group);
+    void appendSlot(Slots &slots, std::unique_ptr<Group> group);
+    std::unique_ptr<Group> takeSlot(Group *group);
+    static void compact(Slots &slots);
+    static void addToTree(Slots &slots, qsizetype slot, int delta);
+    static int prefixSum(const Slots &slots, qsizetype slot);
+    static qsizetype findSlot(const Slots &slots, int position);
+
+    std::vector<std::unique_ptr<Entry>> m_entries; // By source row
+    Slots m_back; // In group order
+    Slots m_front; // Groups at the front, with the topmost last
+    QHash<std::pair<QString, int>, Group *> m_groupsByKey;
+};
@@ -10,115 +10,80 @@ NotificationGroupingModel::NotificationGroupingModel(QObject *parent)
 {
 }
 
-bool NotificationGroupingModel::notificationsMatch(const QModelIndex &a, const QModelIndex &b)
+NotificationGrouper::Key NotificationGroupingModel::groupingKey(int sourceRow) const
 {
-    const QString aId = a.data(AbstractTimelineModel::CustoRoles::IdRole).toString();
-    const QString bId = b.data(AbstractTimelineModel::CustoRoles::IdRole).toString();
-
-    const QVariant aType = a.data(AbstractTimelineModel::CustoRoles::TypeRole);
-    const QVariant bType = b.data(AbstractTimelineModel::CustoRoles::TypeRole);
-
-    // it makes no sense to group poll or edit updates
-    // TODO: support grouping follow notifications
-    if (aType == bType
-        && (aType == Notification::Type::Follow || aType == Notification::Type::Poll || aType == Notification::Type::Update
-            || aType == Notification::Type::Status || aType == Notification::Type::AdminSignUp)) {
-        return false;
-    }
-
-    return aId == bId && aType == bType;
+    const QModelIndex sourceIndex = sourceModel()->index(sourceRow, 0);
+    return {sourceIndex.data(AbstractTimelineModel::CustoRoles::IdRole).toString(), sourceIndex.data(AbstractTimelineModel::CustoRoles::TypeRole).toInt()};
 }
 
 bool NotificationGroupingModel::isGroup(int row) const
 {
-    if (row < 0 || row >= rowMap.count()) {
-        return false;
-    }
-
-    return (rowMap.at(row)->count() > 1);
+    const auto group = m_grouper.groupAt(row);
+    return group != nullptr && m_grouper.groupSize(group) > 1;
 }
 
-bool NotificationGroupingModel::tryToGroup(const QModelIndex &sourceIndex, bool silent)
+void NotificationGroupingModel::addToGroup(int sourceRow)
 {
-    // Meat of the matter: Try to add this source row to a sub-list with source rows
-    // associated with the same application.
-    for (int i = 0; i < rowMap.count(); ++i) {
-        const QModelIndex &groupRep = sourceModel()->index(rowMap.at(i)->constFirst(), 0);
-
-        // Don't match a row with itself.
-        if (sourceIndex == groupRep) {
-            continue;
-        }
-
-        if (notificationsMatch(sourceIndex, groupRep)) {
-            const QModelIndex parent = index(i, 0, QModelIndex());
-
-            if (!silent) {
-                const int newIndex = rowMap.at(i)->count();
-
-                if (newIndex == 1) {
-                    beginInsertRows(parent, 0, 1);
-                } else {
-                    beginInsertRows(parent, newIndex, newIndex);
-                }
-            }
+    // Meat of the matter: Try to add this source row to the group of notifications about the same post.
+    const auto key = groupingKey(sourceRow);
+    const auto group = m_grouper.findGroup(key);
+    if (group == nullptr) {
+        const int row = m_grouper.groupCount();
+        beginInsertRows(QModelIndex(), row, row);
+        m_grouper.addGroup(sourceRow, key);
+        endInsertRows();
+        return;
+    }
 
-            rowMap[i]->append(sourceIndex.row());
+    const QModelIndex parent = index(m_grouper.groupRow(group), 0, QModelIndex());
+    const int newIndex = m_grouper.groupSize(group);
 
-            if (!silent) {
-                endInsertRows();
+    if (newIndex == 1) {
+        beginInsertRows(parent, 0, 1);
+    } else {
+        beginInsertRows(parent, newIndex, newIndex);
+    }
 
-                Q_EMIT dataChanged(parent, parent);
-            }
+    m_grouper.addToGroup(group, sourceRow);
 
-            return true;
-        }
-    }
+    endInsertRows();
 
-    return false;
+    Q_EMIT dataChanged(parent, parent);
 }
 
-void NotificationGroupingModel::adjustMap(int anchor, int delta)
+void NotificationGroupingModel::addToFrontGroup(int sourceRow)
 {
-    for (int i = 0; i < rowMap.count(); ++i) {
-        QList<int> *sourceRows = rowMap.at(i);
-        for (auto it = sourceRows->begin(); it != sourceRows->end(); ++it) {
-            if ((*it) >= anchor) {
-                *it += delta;
-            }
-        }
+    // New notifications go on top, along with the group they join
+    const auto key = groupingKey(sourceRow);
+    const auto group = m_grouper.findGroup(key);
+    if (group == nullptr) {
+        beginInsertRows(QModelIndex(), 0, 0);
+        m_grouper.addGroupToFront(sourceRow, key);
+        endInsertRows();
+        return;
+    }
+
+    const int row = m_grouper.groupRow(group);
+    if (row != 0) {
+        beginMoveRows(QModelIndex(), row, row, QModelIndex(), 0);
+        m_grouper.moveToFront(group);
+        endMoveRows();
     }
+
+    addToGroup(sourceRow);
 }
 
 void NotificationGroupingModel::rebuildMap()
 {
-    qDeleteAll(rowMap);
-    rowMap.clear();
-
     const int rows = sourceModel()->rowCount();
 
-    rowMap.reserve(rows);
-
+    QList<NotificationGrouper::Key> keys;
+    keys.reserve(rows);
     for (int i = 0; i < rows; ++i) {
-        rowMap.append(new QList<int>{i});
+        keys.push_back(groupingKey(i));
     }
 
-    checkGrouping(true);
-}
-
-void NotificationGroupingModel::checkGrouping(bool silent)
-{
-    for (int i = (rowMap.count()) - 1; i >= 0; --i) {
-        if (isGroup(i)) {
-            continue;
-        }
-
-        if (tryToGroup(sourceModel()->index(rowMap.at(i)->constFirst(), 0), silent)) {
-            beginRemoveRows(QModelIndex(), i, i);
-            delete rowMap.takeAt(i);
-            endRemoveRows();
-        }
-    }
+    m_grouper.reset(keys);
 }
 
 void NotificationGroupingModel::setSourceModel(QAbstractItemModel *sourceModel)
@@ -134,6 +99,7 @@ void NotificationGroupingModel::setSourceModel(QAbstractItemModel *sourceModel)
     }
 
     QAbstractProxyModel::setSourceModel(sourceModel);
+    m_grouper.clear();
 
     if (sourceModel) {
         rebuildMap();
@@ -143,17 +109,18 @@ void NotificationGroupingModel::setSourceModel(QAbstractItemModel *sourceModel)
                 return;
             }
 
-            adjustMap(start, (end - start) + 1);
+            m_grouper.insertSourceRows(start, (end - start) + 1);
 
-            for (int i = start; i <= end; ++i) {
-                if (!tryToGroup(this->sourceModel()->index(i, 0))) {
-                    beginInsertRows(QModelIndex(), rowMap.count(), rowMap.count());
-                    rowMap.append(new QList<int>{i});
-                    endInsertRows();
+            // Older notifications are appended while scrolling, anything else is new and prepended
+            if (end == this->sourceModel()->rowCount() - 1) {
+                for (int i = start; i <= end; ++i) {
+                    addToGroup(i);
+                }
+            } else {
+                for (int i = end; i >= start; --i) {
+                    addToFrontGroup(i);
                 }
             }
-
-            checkGrouping();
         });
 
         connect(sourceModel, &QAbstractItemModel::rowsAboutToBeRemoved, this, [this](const QModelIndex &parent, int first, int last) {
@@ -162,42 +129,42 @@ void NotificationGroupingModel::setSourceModel(QAbstractItemModel *sourceModel)
             }
 
             for (int i = first; i <= last; ++i) {
-                for (int j = 0; j < rowMap.count(); ++j) {
-                    const QList<int> *sourceRows = rowMap.at(j);
-                    const int mapIndex = sourceRows->indexOf(i);
-
-                    if (mapIndex != -1) {
-                        // Remove top-level item.
-                        if (sourceRows->count() == 1) {
-                            beginRemoveRows(QModelIndex(), j, j);
-                            delete rowMap.takeAt(j);
-                            endRemoveRows();
-                            // Dissolve group.
-                        } else if (sourceRows->count() == 2) {
-                            const QModelIndex parent = index(j, 0, QModelIndex());
-                            beginRemoveRows(parent, 0, 1);
-                            rowMap[j]->remove(mapIndex);
-                            endRemoveRows();
-
-                            // We're no longer a group parent.
-                            Q_EMIT dataChanged(parent, parent);
-                            // Remove group member.
-                        } else {
-                            const QModelIndex parent = index(j, 0, QModelIndex());
-                            beginRemoveRows(parent, mapIndex, mapIndex);
-                            rowMap[j]->remove(mapIndex);
-                            endRemoveRows();
-
-                            // Various roles of the parent evaluate child data, and the
-                            // child list has changed.
-                            Q_EMIT dataChanged(parent, parent);
-
-                            // Signal children count change for all other items in the group.
-                            Q_EMIT dataChanged(index(0, 0, parent), index(rowMap.count() - 1, 0, parent), {AbstractTimelineModel::NumInGroupRole});
-                        }
+                const auto group = m_grouper.groupOf(i);
+                if (group == nullptr) {
+                    continue;
+                }
 
-                        break;
-                    }
+                const int row = m_grouper.groupRow(group);
+                const int size = m_grouper.groupSize(group);
+                const int mapIndex = m_grouper.memberIndex(i);
+
+                // Remove top-level item.
+                if (size == 1) {
+                    beginRemoveRows(QModelIndex(), row, row);
+                    m_grouper.removeFromGroup(i);
+                    endRemoveRows();
+                    // Dissolve group.
+                } else if (size == 2) {
+                    const QModelIndex parent = index(row, 0, QModelIndex());
+                    beginRemoveRows(parent, 0, 1);
+                    m_grouper.removeFromGroup(i);
+                    endRemoveRows();
+
+                    // We're no longer a group parent.
+                    Q_EMIT dataChanged(parent, parent);
+                    // Remove group member.
+                } else {
+                    const QModelIndex parent = index(row, 0, QModelIndex());
+                    beginRemoveRows(parent, mapIndex, mapIndex);
+                    m_grouper.removeFromGroup(i);
+                    endRemoveRows();
+
+                    // Various roles of the parent evaluate child data, and the
+                    // child list has changed.
+                    Q_EMIT dataChanged(parent, parent);
+
+                    // Signal children count change for all other items in the group.
+                    Q_EMIT dataChanged(index(0, 0, parent), index(size - 2, 0, parent), {AbstractTimelineModel::NumInGroupRole});
                 }
             }
         });
@@ -207,9 +174,7 @@ void NotificationGroupingModel::setSourceModel(QAbstractItemModel *sourceModel)
                 return;
             }
 
-            adjustMap(start + 1, -((end - start) + 1));
-
-            checkGrouping();
+            m_grouper.removeSourceRows(start, (end - start) + 1);
         });
 
         connect(sourceModel, &QAbstractItemModel::modelAboutToBeReset, this, &NotificationGroupingModel::beginResetModel);
@@ -261,11 +226,12 @@ int NotificationGroupingModel::rowCount(const QModelIndex &parent) const
             return 0;
         }
 
-        if (parent.row() < 0 || parent.row() >= rowMap.count()) {
+        const auto group = m_grouper.groupAt(parent.row());
+        if (group == nullptr) {
             return 0;
         }
 
-        const int rowCount = rowMap.at(parent.row())->count();
+        const int rowCount = m_grouper.groupSize(group);
         // If this sub-list in the map only has one entry, it's a plain item, not
         // parent to a group.
         if (rowCount == 1) {
@@ -275,7 +241,7 @@ int NotificationGroupingModel::rowCount(const QModelIndex &parent) const
         }
     }
 
-    return rowMap.count();
+    return m_grouper.groupCount();
 }
 
 bool NotificationGroupingModel::hasChildren(const QModelIndex &parent) const
@@ -346,11 +312,15 @@ QModelIndex NotificationGroupingModel::index(int row, int column, const QModelIn
         return {};
     }
 
-    if (parent.isValid() && row < rowMap.at(parent.row())->count()) {
-        return createIndex(row, column, rowMap.at(parent.row()));
+    if (parent.isValid()) {
+        const auto group = m_grouper.groupAt(parent.row());
+        if (group != nullptr && row < m_grouper.groupSize(group)) {
+            return createIndex(row, column, group);
+        }
+        return {};
     }
 
-    if (row < rowMap.count()) {
+    if (row < m_grouper.groupCount()) {
         return createIndex(row, column, nullptr);
     }
 
@@ -361,19 +331,9 @@ QModelIndex NotificationGroupingModel::parent(const QModelIndex &child) const
 {
     if (child.internalPointer() == nullptr) {
         return {};
-    } else {
-        const int parentRow = rowMap.indexOf(static_cast<QList<int> *>(child.internalPointer()));
-
-        if (parentRow != -1) {
-            return index(parentRow, 0, QModelIndex());
-        }
-
-        // If we were asked to find the parent for an internalPointer we can't
-        // locate, we have corrupted data: This should not happen.
-        Q_ASSERT(parentRow != -1);
     }
 
-    return {};
+    return index(m_grouper.groupRow(static_cast<NotificationGrouper::Group *>(child.internalPointer())), 0, QModelIndex());
 }
 
 QModelIndex NotificationGroupingModel::mapFromSource(const QModelIndex &sourceIndex) const
@@ -382,28 +342,28 @@ QModelIndex NotificationGroupingModel::mapFromSource(const QModelIndex &sourceIn
         return {};
     }
 
-    for (int i = 0; i < rowMap.count(); ++i) {
-        const QList<int> *sourceRows = rowMap.at(i);
-        const int childIndex = sourceRows->indexOf(sourceIndex.row());
-        const QModelIndex parent = index(i, 0, QModelIndex());
-
-        if (childIndex == 0) {
-            // If the sub-list we found the source row in is larger than 1 (i.e. part
-            // of a group, map to the logical child item instead of the parent item
-            // the source row also stands in for. The parent is therefore unreachable
-            // from mapToSource().
-            if (isGroup(i)) {
-                return index(0, 0, parent);
-                // Otherwise map to the top-level item.
-            } else {
-                return parent;
-            }
-        } else if (childIndex != -1) {
-            return index(childIndex, 0, parent);
+    const auto group = m_grouper.groupOf(sourceIndex.row());
+    if (group == nullptr) {
+        return {};
+    }
+
+    const int childIndex = m_grouper.memberIndex(sourceIndex.row());
+    const QModelIndex parent = index(m_grouper.groupRow(group), 0, QModelIndex());
+
+    if (childIndex == 0) {
+        // If the group we found the source row in is larger than 1 (i.e. part
+        // of a group, map to the logical child item instead of the parent item
+        // the source row also stands in for. The parent is therefore unreachable
+        // from mapToSource().
+        if (m_grouper.groupSize(group) > 1) {
+            return index(0, 0, parent);
+            // Otherwise map to the top-level item.
+        } else {
+            return parent;
         }
     }
 
-    return {};
+    return index(childIndex, 0, parent);
 }
 
 QModelIndex NotificationGroupingModel::mapToSource(const QModelIndex &proxyIndex) const
@@ -415,11 +375,12 @@ QModelIndex NotificationGroupingModel::mapToSource(const QModelIndex &proxyIndex
     const QModelIndex &parent = proxyIndex.parent();
 
     if (parent.isValid()) {
-        if (parent.row() < 0 || parent.row() >= rowMap.count()) {
+        const auto group = m_grouper.groupAt(parent.row());
+        if (group == nullptr || proxyIndex.row() >= m_grouper.groupSize(group)) {
             return {};
         }
 
-        return sourceModel()->index(rowMap.at(parent.row())->at(proxyIndex.row()), 0);
+        return sourceModel()->index(m_grouper.memberRow(group, proxyIndex.row()), 0);
     } else {
         // Group parents items therefore equate to the first child item; the source
         // row logically appears twice in the proxy.
@@ -428,11 +389,11 @@ QModelIndex NotificationGroupingModel::mapToSource(const QModelIndex &proxyIndex
         // has its Qt::DisplayRole mangled by data(), and it's more useful for trans-
         // lating dataChanged() from the source model.
         // NOTE we changed that to be last
-        if (rowMap.isEmpty()) { // FIXME
-            // How can this happen? (happens when closing a group)
+        const auto group = m_grouper.groupAt(proxyIndex.row());
+        if (group == nullptr) {
             return {};
         }
-        return sourceModel()->index(rowMap.at(proxyIndex.row())->constLast(), 0);
+        return sourceModel()->index(m_grouper.memberRow(group, m_grouper.groupSize(group) - 1), 0);
     }
 }
 
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "notification/notificationgrouper.h"
 #include "notification/notificationmodel.h"
 
 class NotificationGroupingModel : public QAbstractProxyModel
@@ -42,12 +43,11 @@ Q_SIGNALS:
     void sourceModelChanged();
 
 private:
-    bool notificationsMatch(const QModelIndex &a, const QModelIndex &b);
+    NotificationGrouper::Key groupingKey(int sourceRow) const;
     void rebuildMap();
-    void checkGrouping(bool silent = false);
     bool isGroup(int row) const;
-    bool tryToGroup(const QModelIndex &sourceIndex, bool silent = false);
-    void adjustMap(int anchor, int delta);
+    void addToGroup(int sourceRow);
+    void addToFrontGroup(int sourceRow);
 
-    QList<QList<int> *> rowMap;
+    NotificationGrouper m_grouper;
 };
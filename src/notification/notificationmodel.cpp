@@ -4,9 +4,17 @@
 #include "notification/notificationmodel.h"
 
 #include "account/abstractaccount.h"
+#include "account/statusindex.h"
+#include "network/networkcontroller.h"
+#include "tokodon_debug.h"
+#include "tokodon_http_debug.h"
 
 #include <KLocalizedString>
 
+#include <algorithm>
+
+using namespace Qt::Literals::StringLiterals;
+
 NotificationModel::NotificationModel(QObject *parent)
     : AbstractTimelineModel(parent)
 {
@@ -17,9 +25,7 @@ NotificationModel::NotificationModel(QObject *parent)
         if (m_account == account) {
             qDebug() << "Invalidating account" << account;
 
-            beginResetModel();
-            m_notifications.clear();
-            endResetModel();
+            reset();
             m_next = QUrl();
             setLoading(false);
         }
@@ -27,29 +33,69 @@ NotificationModel::NotificationModel(QObject *parent)
 
     connect(m_manager, &AccountManager::accountSelected, this, [=](AbstractAccount *account) {
         if (m_account != account) {
+            if (m_account) {
+                disconnect(m_account, &AbstractAccount::streamingEvent, this, nullptr);
+                disconnect(m_account, &AbstractAccount::streamingReconnected, this, nullptr);
+            }
+
             m_account = account;
+            m_serverGroupingSupported = true;
+            setGroupedByServer(false);
+            connectStreaming();
 
-            beginResetModel();
-            m_notifications.clear();
-            endResetModel();
+            reset();
 
             fillTimeline();
         }
     });
 
     connect(this, &NotificationModel::excludeTypesChanged, this, [this] {
-        beginResetModel();
-        m_notifications.clear();
-        endResetModel();
+        reset();
         m_next = QUrl();
         setLoading(false);
         fillTimeline();
     });
 
+    // Streamed notifications are inserted together, so a burst of them doesn't shift the list around for each one
+    m_insertTimer.setInterval(std::chrono::milliseconds(500));
+    m_insertTimer.setSingleShot(true);
+    connect(&m_insertTimer, &QTimer::timeout, this, &NotificationModel::insertPendingNotifications);
+
+    connectStreaming();
+
     setLoading(false);
     fillTimeline();
 }
 
+void NotificationModel::reset()
+{
+    beginResetModel();
+    m_notifications.clear();
+    endResetModel();
+
+    m_pendingNotifications.clear();
+    m_insertTimer.stop();
+    m_newestId = {};
+}
+
+void NotificationModel::connectStreaming()
+{
+    if (!m_account) {
+        return;
+    }
+
+    connect(m_account, &AbstractAccount::streamingEvent, this, [this](AbstractAccount::StreamingEventType eventType, const QByteArray &payload) {
+        if (eventType == AbstractAccount::StreamingEventType::NotificationEvent) {
+            queueNotification(QJsonDocument::fromJson(payload).object());
+        }
+    });
+    connect(m_account, &AbstractAccount::streamingReconnected, this, [this](const QString &stream) {
+        if (stream == QStringLiteral("user")) {
+            fetchMissedNotifications();
+        }
+    });
+}
+
 QStringList NotificationModel::excludeTypes() const
 {
     return m_excludeTypes;
@@ -65,6 +111,21 @@ void NotificationModel::setExcludesTypes(const QStringList &excludeTypes)
     Q_EMIT excludeTypesChanged();
 }
 
+bool NotificationModel::groupedByServer() const
+{
+    return m_groupedByServer;
+}
+
+void NotificationModel::setGroupedByServer(bool groupedByServer)
+{
+    if (m_groupedByServer == groupedByServer) {
+        return;
+    }
+
+    m_groupedByServer = groupedByServer;
+    Q_EMIT groupedByServerChanged();
+}
+
 void NotificationModel::fillTimeline(const QUrl &next)
 {
     if (!m_account) {
@@ -75,54 +136,254 @@ void NotificationModel::fillTimeline(const QUrl &next)
         return;
     }
     setLoading(true);
+
+    // Later pages have to come from the same API as the first one
+    const bool grouped = next.isEmpty() ? m_serverGroupingSupported : m_groupedByServer;
+
     QUrl uri;
     if (next.isEmpty()) {
-        uri = QUrl::fromUserInput(m_account->instanceUri());
-        uri.setPath(QStringLiteral("/api/v1/notifications"));
+        uri = m_account->apiUrl(grouped ? QStringLiteral("/api/v2/notifications") : QStringLiteral("/api/v1/notifications"));
     } else {
         uri = next;
     }
     QUrlQuery urlQuery(uri);
+    if (grouped && next.isEmpty()) {
+        // Everything else is shown with one delegate per account, like follows
+        urlQuery.addQueryItem(QStringLiteral("grouped_types[]"), QStringLiteral("favourite"));
+        urlQuery.addQueryItem(QStringLiteral("grouped_types[]"), QStringLiteral("reblog"));
+    }
     for (const auto &excludeType : std::as_const(m_excludeTypes)) {
         urlQuery.addQueryItem(QStringLiteral("exclude_types[]"), excludeType);
     }
     uri.setQuery(urlQuery);
 
-    m_account->get(uri, true, this, [=](QNetworkReply *reply) {
-        const auto data = reply->readAll();
-        const auto doc = QJsonDocument::fromJson(data);
+    std::function<void(QNetworkReply *)> errorCallback;
+    if (grouped && next.isEmpty()) {
+        errorCallback = [this](QNetworkReply *reply) {
+            setLoading(false);
+
+            // Servers without grouped notifications don't know the v2 API, so ask for ungrouped ones instead
+            const int statusCode = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+            if (statusCode == 404 || statusCode == 410) {
+                qCDebug(TOKODON_LOG) << "Grouped notifications are not supported, falling back to the v1 API";
+                m_serverGroupingSupported = false;
+                fillTimeline();
+                return;
+            }
 
-        if (!doc.isArray()) {
-            m_account->errorOccured(i18n("Error occurred when fetching the latest notification."));
-            return;
+            qCWarning(TOKODON_HTTP) << statusCode << reply->url();
+            Q_EMIT NetworkController::instance().networkErrorOccurred(reply->errorString());
+        };
+    }
+
+    m_account->get(
+        uri,
+        true,
+        this,
+        [=](QNetworkReply *reply) {
+            const auto data = reply->readAll();
+            const auto doc = QJsonDocument::fromJson(data);
+
+            if (grouped ? !doc.isObject() : !doc.isArray()) {
+                m_account->errorOccured(i18n("Error occurred when fetching the latest notification."));
+                return;
+            }
+            static QRegularExpression re(QStringLiteral("<(.*)>; rel=\"next\""));
+            const auto linkHeader = reply->rawHeader(QByteArrayLiteral("Link"));
+            const auto match = re.match(QString::fromUtf8(linkHeader));
+            m_next = QUrl::fromUserInput(match.captured(1));
+
+            if (next.isEmpty()) {
+                setGroupedByServer(grouped);
+            }
+
+            const auto notifications = grouped ? parseNotificationGroups(doc.object()) : parseNotifications(doc.array());
+            if (notifications.isEmpty()) {
+                setLoading(false);
+                return;
+            }
+
+            for (const auto &notification : notifications) {
+                m_newestId = std::max(m_newestId, notification->id());
+            }
+
+            beginInsertRows({}, m_notifications.count(), m_notifications.count() + notifications.count() - 1);
+            m_notifications.append(notifications);
+            endInsertRows();
+
+            setLoading(false);
+        },
+        errorCallback);
+}
+
+void NotificationModel::queueNotification(const QJsonObject &obj)
+{
+    if (obj.isEmpty() || m_excludeTypes.contains(obj["type"_L1].toString())) {
+        return;
+    }
+
+    m_pendingNotifications.push_back(obj);
+    if (!m_insertTimer.isActive()) {
+        m_insertTimer.start();
+    }
+}
+
+void NotificationModel::insertPendingNotifications()
+{
+    // Until the first page is there, it will include these anyway
+    if (m_notifications.isEmpty() && m_loading) {
+        m_pendingNotifications.clear();
+        return;
+    }
+
+    const auto pending = std::exchange(m_pendingNotifications, {});
+
+    // Pending notifications are oldest first, and may overlap with ones that were fetched in the meantime
+    QList<std::shared_ptr<Notification>> notifications;
+    for (const auto &obj : pending) {
+        auto notification = std::make_shared<Notification>(m_account, obj, this);
+        if (!m_newestId.isNull() && notification->id() <= m_newestId) {
+            continue;
+        }
+
+        m_newestId = notification->id();
+        notifications.push_back(notification);
+    }
+
+    if (notifications.isEmpty()) {
+        return;
+    }
+
+    if (!m_groupedByServer) {
+        std::reverse(notifications.begin(), notifications.end());
+
+        beginInsertRows({}, 0, static_cast<int>(notifications.size()) - 1);
+        m_notifications = notifications + m_notifications;
+        endInsertRows();
+        return;
+    }
+
+    // The server put these in groups we may already show, which then move to the top.
+    // Only favorites and boosts are requested as groups, anything else keeps its own row even if the server gave it a group key.
+    for (const auto &notification : std::as_const(notifications)) {
+        const auto groupKey = notification->groupKey();
+        const bool groupable = notification->type() == Notification::Favorite || notification->type() == Notification::Repeat;
+        const auto it = !groupable || groupKey.isEmpty() || groupKey.startsWith("ungrouped-"_L1)
+            ? m_notifications.end()
+            : std::find_if(m_notifications.begin(), m_notifications.end(), [&groupKey](const auto &existing) {
+                  return existing->groupKey() == groupKey;
+              });
+
+        if (it == m_notifications.end()) {
+            beginInsertRows({}, 0, 0);
+            m_notifications.prepend(notification);
+            endInsertRows();
+            continue;
         }
-        static QRegularExpression re(QStringLiteral("<(.*)>; rel=\"next\""));
-        const auto next = reply->rawHeader(QByteArrayLiteral("Link"));
-        const auto match = re.match(QString::fromUtf8(next));
-        m_next = QUrl::fromUserInput(match.captured(1));
-
-        QList<std::shared_ptr<Notification>> notifications;
-        const auto values = doc.array();
-        for (const auto &value : values) {
-            const QJsonObject obj = value.toObject();
-            const auto notification = std::make_shared<Notification>(m_account, obj, this);
-
-            notifications.push_back(notification);
+
+        const int row = static_cast<int>(std::distance(m_notifications.begin(), it));
+        if (row != 0) {
+            beginMoveRows({}, row, row, {}, 0);
+            m_notifications.move(row, 0);
+            endMoveRows();
         }
 
-        if (notifications.isEmpty()) {
+        m_notifications.constFirst()->addToGroup(*notification);
+        Q_EMIT dataChanged(index(0, 0), index(0, 0));
+    }
+}
+
+void NotificationModel::fetchMissedNotifications()
+{
+    if (!m_account || m_newestId.isNull()) {
+        return;
+    }
+
+    // Catch up on what was sent while the stream was down, instead of fetching everything again
+    QUrl uri = m_account->apiUrl(QStringLiteral("/api/v1/notifications"));
+    QUrlQuery urlQuery;
+    urlQuery.addQueryItem(QStringLiteral("since_id"), m_newestId.toString());
+    urlQuery.addQueryItem(QStringLiteral("limit"), QString::number(missedNotificationsLimit));
+    for (const auto &excludeType : std::as_const(m_excludeTypes)) {
+        urlQuery.addQueryItem(QStringLiteral("exclude_types[]"), excludeType);
+    }
+    uri.setQuery(urlQuery);
+
+    m_account->get(uri, true, this, [this](QNetworkReply *reply) {
+        const auto values = QJsonDocument::fromJson(reply->readAll()).array();
+
+        // There may be a gap between them and what we have, so start over
+        if (values.size() >= missedNotificationsLimit) {
+            reset();
+            m_next = QUrl();
             setLoading(false);
+            fillTimeline();
             return;
         }
 
-        beginInsertRows({}, m_notifications.count(), m_notifications.count() + notifications.count() - 1);
-        m_notifications.append(notifications);
-        endInsertRows();
-
-        setLoading(false);
+        for (auto it = values.crbegin(); it != values.crend(); ++it) {
+            queueNotification(it->toObject());
+        }
     });
 }
 
+QList<std::shared_ptr<Notification>> NotificationModel::parseNotifications(const QJsonArray &values)
+{
+    QList<std::shared_ptr<Notification>> notifications;
+    notifications.reserve(values.size());
+    QJsonArray statuses;
+    for (const auto &value : values) {
+        const QJsonObject obj = value.toObject();
+        notifications.push_back(std::make_shared<Notification>(m_account, obj, this));
+        if (obj["status"_L1].isObject()) {
+            statuses.push_back(obj["status"_L1]);
+        }
+    }
+    m_account->statusIndex()->add(statuses);
+
+    return notifications;
+}
+
+QList<std::shared_ptr<Notification>> NotificationModel::parseNotificationGroups(const QJsonObject &obj)
+{
+    // Each account and status is only sent once per page, however many groups refer to it
+    QHash<QString, std::shared_ptr<Identity>> identities;
+    const auto accounts = obj["accounts"_L1].toArray();
+    for (const auto &value : accounts) {
+        const auto account = value.toObject();
+        const auto accountId = account["id"_L1].toString();
+        identities.insert(accountId, m_account->identityLookup(accountId, account));
+    }
+
+    QHash<QString, Post *> posts;
+    const auto statuses = obj["statuses"_L1].toArray();
+    for (const auto &value : statuses) {
+        const auto status = value.toObject();
+        posts.insert(status["id"_L1].toString(), new Post(m_account, status, this));
+    }
+    m_account->statusIndex()->add(statuses);
+
+    QList<std::shared_ptr<Notification>> notifications;
+    const auto groups = obj["notification_groups"_L1].toArray();
+    notifications.reserve(groups.size());
+    for (const auto &value : groups) {
+        const auto group = value.toObject();
+
+        QList<std::shared_ptr<Identity>> sampleIdentities;
+        const auto sampleAccountIds = group["sample_account_ids"_L1].toArray();
+        for (const auto &accountId : sampleAccountIds) {
+            if (auto identity = identities.value(accountId.toString())) {
+                sampleIdentities.push_back(identity);
+            }
+        }
+
+        Post *post = posts.value(group["status_id"_L1].toString());
+        notifications.push_back(std::make_shared<Notification>(m_account, group, post, sampleIdentities));
+    }
+
+    return notifications;
+}
+
 void NotificationModel::fetchMore(const QModelIndex &parent)
 {
     Q_UNUSED(parent);
@@ -174,8 +435,23 @@ QVariant NotificationModel::data(const QModelIndex &index, int role) const
         }
         return {};
     }
-    case NotificationActorIdentityRole:
+    case IsGroupRole:
+        return notification->groupSize() > 1;
+    case IsInGroupRole:
+        return false;
+    case NumInGroupRole:
+        return notification->groupSize() > 1 ? notification->groupSize() : -1;
+    case NotificationActorIdentityRole: {
+        if (notification->groupSize() > 1) {
+            QVariantList authorList;
+            const auto sampleIdentities = notification->sampleIdentities();
+            for (qsizetype i = 0; i < qMin(sampleIdentities.size(), qsizetype(5)); ++i) {
+                authorList.append(QVariant::fromValue(sampleIdentities[i].get()));
+            }
+            return authorList;
+        }
         return QVariant::fromValue(notification->identity().get());
+    }
     case AuthorIdentityRole: {
         if (notification->type() == Notification::Follow || notification->type() == Notification::FollowRequest) {
             return QVariant::fromValue<Identity *>(notification->identity().get());
@@ -193,6 +469,15 @@ QVariant NotificationModel::data(const QModelIndex &index, int role) const
     return {};
 }
 
+std::shared_ptr<Notification> NotificationModel::internalData(const QModelIndex &index) const
+{
+    if (!checkIndex(index, CheckIndexOption::IndexIsValid)) {
+        return nullptr;
+    }
+
+    return m_notifications[index.row()];
+}
+
 void NotificationModel::actionReply(const QModelIndex &index)
 {
     int row = index.row();
@@ -249,7 +534,7 @@ void NotificationModel::actionDelete(const QModelIndex &index)
 
     // TODO: this sucks
     for (auto &notification : m_notifications) {
-        if (notification->post() != nullptr && notification->post()->postId() == p->postId()) {
+        if (notification->post() != nullptr && notification->post()->id() == p->id()) {
             int row = m_notifications.indexOf(notification);
             beginRemoveRows({}, row, row);
             m_notifications.removeOne(notification);
@@ -6,6 +6,8 @@
 
 #include "timeline/abstracttimelinemodel.h"
 
+#include <QTimer>
+
 /**
  * @brief Model for the notifications page.
  * @see AbstractTimelineModel
@@ -16,10 +18,16 @@ class NotificationModel : public AbstractTimelineModel
     QML_ELEMENT
 
     Q_PROPERTY(QStringList excludeTypes READ excludeTypes WRITE setExcludesTypes NOTIFY excludeTypesChanged)
+    Q_PROPERTY(bool groupedByServer READ groupedByServer NOTIFY groupedByServerChanged)
 
 public:
     explicit NotificationModel(QObject *parent = nullptr);
 
+    /**
+     * @brief The most notifications fetched after the streaming connection is back. If there were more, the first page is fetched again.
+     */
+    static constexpr int missedNotificationsLimit = 40;
+
     int rowCount(const QModelIndex &parent) const override;
     QVariant data(const QModelIndex &index, int role) const override;
 
@@ -41,6 +49,13 @@ public:
      */
     void setExcludesTypes(const QStringList &excludeTypes);
 
+    /**
+     * @return If the notifications were already grouped by the server, in which case they shouldn't be grouped again by NotificationGroupingModel.
+     *
+     * Servers that support it (Mastodon 4.3 and later) group favorites and boosts with the v2 API, otherwise this falls back to the ungrouped v1 API.
+     */
+    bool groupedByServer() const;
+
 public Q_SLOTS:
     /**
      * @brief Reply to the notification at @p index.
@@ -81,6 +96,12 @@ Q_SIGNALS:
      */
     void excludeTypesChanged();
 
+    /**
+     * @brief Emitted when it's known if the server grouped the notifications.
+     * @see groupedByServer()
+     */
+    void groupedByServerChanged();
+
     /**
      * @brief Emitted when actionReply is called.
      */
@@ -96,4 +117,21 @@ protected:
     QList<std::shared_ptr<Notification>> m_notifications;
     QStringList m_excludeTypes;
     QUrl m_next;
+
+private:
+    void reset();
+    void connectStreaming();
+    void queueNotification(const QJsonObject &obj);
+    void insertPendingNotifications();
+    void fetchMissedNotifications();
+    QList<std::shared_ptr<Notification>> parseNotifications(const QJsonArray &values);
+    QList<std::shared_ptr<Notification>> parseNotificationGroups(const QJsonObject &obj);
+    void setGroupedByServer(bool groupedByServer);
+
+    bool m_groupedByServer = false;
+    bool m_serverGroupingSupported = true;
+
+    EntityId m_newestId;
+    QList<QJsonObject> m_pendingNotifications;
+    QTimer m_insertTimer;
 };
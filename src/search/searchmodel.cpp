@@ -4,9 +4,12 @@
 #include "search/searchmodel.h"
 
 #include "account/account.h"
+#include "account/statusindex.h"
 
 #include <KLocalizedString>
 
+#include <QRegularExpression>
+
 using namespace Qt::Literals::StringLiterals;
 
 SearchModel::SearchModel(QObject *parent)
@@ -14,20 +17,24 @@ SearchModel::SearchModel(QObject *parent)
 {
     m_account = AccountManager::instance().selectedAccount();
 
+    m_searchTimer.setSingleShot(true);
+    m_searchTimer.setInterval(searchDelay);
+    connect(&m_searchTimer, &QTimer::timeout, this, [this] {
+        fetchResults(false);
+    });
+
     connect(&AccountManager::instance(), &AccountManager::invalidated, this, [=](AbstractAccount *account) {
         if (m_account == account) {
-            beginResetModel();
+            m_cache.clear();
             clear();
-            endResetModel();
         }
     });
 
     connect(&AccountManager::instance(), &AccountManager::accountSelected, this, [=](AbstractAccount *account) {
         if (m_account != account) {
             m_account = account;
-            beginResetModel();
+            m_cache.clear();
             clear();
-            endResetModel();
         }
     });
 }
@@ -36,52 +43,369 @@ SearchModel::~SearchModel() = default;
 
 void SearchModel::search(const QString &queryString)
 {
-    beginResetModel();
-    clear();
-    endResetModel();
+    const QString query = queryString.trimmed();
+    if (query.isEmpty()) {
+        clear();
+        return;
+    }
 
-    auto url = m_account->apiUrl(QStringLiteral("/api/v2/search"));
-    url.setQuery({{QStringLiteral("q"), queryString}, {QStringLiteral("resolve"), QStringLiteral("true")}});
-    setLoading(true);
-    setLoaded(false);
-    m_account->get(url, true, this, [this](QNetworkReply *reply) {
-        const auto searchResult = QJsonDocument::fromJson(reply->readAll()).object();
-        const auto statuses = searchResult[QStringLiteral("statuses")].toArray();
+    // Accepting the same query again shouldn't start over
+    if (query == m_query && (loading() || m_loaded)) {
+        return;
+    }
 
-        beginResetModel();
-        clear();
+    cancel();
+    m_query = query;
+    searchSeenStatuses();
 
-        std::transform(
-            statuses.cbegin(),
-            statuses.cend(),
-            std::back_inserter(m_statuses),
-            [this](const QJsonValue &value) -> auto{ return new Post(m_account, value.toObject(), this); });
-        const auto accounts = searchResult[QStringLiteral("accounts")].toArray();
-        std::transform(
-            accounts.cbegin(),
-            accounts.cend(),
-            std::back_inserter(m_accounts),
-            [this](const QJsonValue &value) -> auto{
-                const auto account = value.toObject();
-                return m_account->identityLookup(account["id"_L1].toString(), account);
-            });
-        const auto hashtags = searchResult[QStringLiteral("hashtags")].toArray();
-        std::transform(
-            hashtags.cbegin(),
-            hashtags.cend(),
-            std::back_inserter(m_hashtags),
-            [](const QJsonValue &value) -> auto{ return SearchHashtag(value.toObject()); });
-        endResetModel();
+    if (const Results *cached = m_cache.object(query)) {
+        setResults(*cached);
         setLoading(false);
         setLoaded(true);
+        return;
+    }
+
+    setLoading(true);
+    setLoaded(false);
+    m_searchTimer.start();
+}
+
+void SearchModel::fetchMoreOfType(ResultType type)
+{
+    if (m_fetchingMore || !m_typesWithMore.contains(type)) {
+        return;
+    }
+
+    qsizetype offset = 0;
+    switch (type) {
+    case Account:
+        offset = m_accounts.size();
+        break;
+    case Status:
+        offset = m_statuses.size();
+        break;
+    case Hashtag:
+        offset = m_hashtags.size();
+        break;
+    case SeenStatus:
+        return;
+    }
+
+    if (!m_request) {
+        m_request = new QObject(this);
+    }
+
+    m_fetchingMore = true;
+    const QString query = m_query;
+    const auto url = searchUrl({
+        {QStringLiteral("type"), typeKey(type)},
+        {QStringLiteral("offset"), QString::number(offset)},
     });
+    m_account->get(
+        url,
+        true,
+        m_request,
+        [this, query, type](QNetworkReply *reply) {
+            if (query != m_query) {
+                return;
+            }
+            m_fetchingMore = false;
+
+            const auto array = QJsonDocument::fromJson(reply->readAll()).object()[typeKey(type)].toArray();
+            appendResults(type, array);
+
+            auto typesWithMore = m_typesWithMore;
+            if (array.size() < pageSize) {
+                typesWithMore.removeAll(type);
+            }
+
+            // Going back to this query should show everything that was fetched for it
+            if (Results *cached = m_cache.object(query)) {
+                QJsonArray &cachedArray = type == Account ? cached->accounts : (type == Status ? cached->statuses : cached->hashtags);
+                for (const auto &value : array) {
+                    cachedArray.push_back(value);
+                }
+                cached->typesWithMore = typesWithMore;
+            }
+
+            setTypesWithMoreResults(typesWithMore);
+        },
+        [this, query](QNetworkReply *) {
+            if (query == m_query) {
+                m_fetchingMore = false;
+            }
+        });
+}
+
+QList<int> SearchModel::typesWithMoreResults() const
+{
+    return m_typesWithMore;
+}
+
+bool SearchModel::needsResolving(const QString &query)
+{
+    // Posts and profiles by their link
+    if (query.startsWith("https://"_L1) || query.startsWith("http://"_L1)) {
+        return !query.contains(u' ');
+    }
+
+    // Accounts by their handle, like @user@example.com
+    static const QRegularExpression handle(QStringLiteral("^@?[\\w.-]+@[\\w-]+(\\.[\\w-]+)+$"));
+    return handle.match(query).hasMatch();
+}
+
+QString SearchModel::typeKey(ResultType type)
+{
+    switch (type) {
+    case Account:
+        return QStringLiteral("accounts");
+    case Status:
+        return QStringLiteral("statuses");
+    case Hashtag:
+        return QStringLiteral("hashtags");
+    case SeenStatus:
+        break;
+    }
+    return {};
+}
+
+SearchModel::Results SearchModel::parseResults(const QJsonObject &object)
+{
+    Results results{
+        object[typeKey(Account)].toArray(),
+        object[typeKey(Status)].toArray(),
+        object[typeKey(Hashtag)].toArray(),
+        {},
+    };
+
+    // A full page means there may be more
+    if (results.accounts.size() >= pageSize) {
+        results.typesWithMore.push_back(Account);
+    }
+    if (results.statuses.size() >= pageSize) {
+        results.typesWithMore.push_back(Status);
+    }
+    if (results.hashtags.size() >= pageSize) {
+        results.typesWithMore.push_back(Hashtag);
+    }
+
+    return results;
+}
+
+QUrl SearchModel::searchUrl(const QList<std::pair<QString, QString>> &parameters) const
+{
+    QUrlQuery query;
+    query.addQueryItem(QStringLiteral("q"), m_query);
+    for (const auto &[key, value] : parameters) {
+        query.addQueryItem(key, value);
+    }
+    query.addQueryItem(QStringLiteral("limit"), QString::number(pageSize));
+
+    auto url = m_account->apiUrl(QStringLiteral("/api/v2/search"));
+    url.setQuery(query);
+    return url;
+}
+
+void SearchModel::fetchResults(bool resolve)
+{
+    // Replies for a superseded query are aborted, but may have finished already
+    if (m_request) {
+        m_request->deleteLater();
+    }
+    m_request = new QObject(this);
+
+    const QString query = m_query;
+    const auto url = searchUrl({{QStringLiteral("resolve"), resolve ? QStringLiteral("true") : QStringLiteral("false")}});
+    m_account->get(
+        url,
+        true,
+        m_request,
+        [this, query, resolve](QNetworkReply *reply) {
+            if (query != m_query) {
+                return;
+            }
+
+            const auto results = parseResults(QJsonDocument::fromJson(reply->readAll()).object());
+            setResults(results);
+
+            // Looking up remote accounts and posts is slow for the server, so only do it if it didn't know about them already
+            if (!resolve && needsResolving(query) && !hasExactMatch(results)) {
+                fetchResults(true);
+                return;
+            }
+
+            m_cache.insert(query, new Results(results));
+            setLoading(false);
+            setLoaded(true);
+        },
+        [this, query](QNetworkReply *) {
+            if (query != m_query) {
+                return;
+            }
+            setLoading(false);
+            setLoaded(true);
+        });
+}
+
+bool SearchModel::hasExactMatch(const Results &results) const
+{
+    if (m_query.startsWith("http"_L1)) {
+        const auto matches = [this](const QJsonValue &value) {
+            const auto object = value.toObject();
+            return object["url"_L1].toString() == m_query || object["uri"_L1].toString() == m_query;
+        };
+        return std::any_of(results.statuses.cbegin(), results.statuses.cend(), matches)
+            || std::any_of(results.accounts.cbegin(), results.accounts.cend(), matches);
+    }
+
+    // Accounts on our own server don't have the domain in their handle
+    const QString handle = m_query.startsWith(u'@') ? m_query.mid(1) : m_query;
+    const QString localDomain = u'@' + QUrl::fromUserInput(m_account->instanceUri()).host();
+    return std::any_of(results.accounts.cbegin(), results.accounts.cend(), [&handle, &localDomain](const QJsonValue &value) {
+        const auto acct = value.toObject()["acct"_L1].toString();
+        return acct.compare(handle, Qt::CaseInsensitive) == 0 || (acct + localDomain).compare(handle, Qt::CaseInsensitive) == 0;
+    });
+}
+
+void SearchModel::setResults(const Results &results)
+{
+    beginResetModel();
+    clearResults();
+    addResults(Account, results.accounts);
+    addResults(Status, results.statuses);
+    addResults(Hashtag, results.hashtags);
+
+    // Don't list the same status twice
+    for (qsizetype i = m_seenStatuses.size() - 1; i >= 0; i--) {
+        const auto id = m_seenStatuses[i]->originalId();
+        if (std::any_of(m_statuses.cbegin(), m_statuses.cend(), [&id](const Post *post) {
+                return post->originalId() == id;
+            })) {
+            delete m_seenStatuses.takeAt(i);
+        }
+    }
+    endResetModel();
+
+    setTypesWithMoreResults(results.typesWithMore);
+}
+
+void SearchModel::appendResults(ResultType type, const QJsonArray &array)
+{
+    if (array.isEmpty()) {
+        return;
+    }
+
+    // Results are sorted by type, accounts first and hashtags last
+    qsizetype row = m_accounts.size();
+    if (type != Account) {
+        row += m_statuses.size();
+    }
+    if (type == Hashtag) {
+        row += m_hashtags.size();
+    }
+
+    beginInsertRows({}, static_cast<int>(row), static_cast<int>(row + array.size() - 1));
+    addResults(type, array);
+    endInsertRows();
+}
+
+void SearchModel::addResults(ResultType type, const QJsonArray &array)
+{
+    switch (type) {
+    case Account:
+        std::transform(array.cbegin(), array.cend(), std::back_inserter(m_accounts), [this](const QJsonValue &value) -> auto{
+            const auto account = value.toObject();
+            return m_account->identityLookup(account["id"_L1].toString(), account);
+        });
+        break;
+    case Status:
+        std::transform(array.cbegin(), array.cend(), std::back_inserter(m_statuses), [this](const QJsonValue &value) -> auto{
+            return new Post(m_account, value.toObject(), this);
+        });
+        break;
+    case Hashtag:
+        std::transform(array.cbegin(), array.cend(), std::back_inserter(m_hashtags), [](const QJsonValue &value) -> auto{
+            return SearchHashtag(value.toObject());
+        });
+        break;
+    case SeenStatus:
+        break;
+    }
+}
+
+void SearchModel::setTypesWithMoreResults(const QList<int> &types)
+{
+    if (m_typesWithMore == types) {
+        return;
+    }
+    m_typesWithMore = types;
+    Q_EMIT typesWithMoreResultsChanged();
+}
+
+void SearchModel::searchSeenStatuses()
+{
+    const QString query = m_query;
+    m_account->statusIndex()->search(query, seenStatusLimit, this, [this, query](const QList<QJsonObject> &statuses) {
+        if (query == m_query) {
+            setSeenStatuses(statuses);
+        }
+    });
+}
+
+void SearchModel::setSeenStatuses(const QList<QJsonObject> &statuses)
+{
+    removeSeenStatuses(0, m_seenStatuses.size() - 1);
+
+    QList<Post *> posts;
+    for (const auto &status : statuses) {
+        const auto id = EntityId::fromJson(status["id"_L1]);
+        const bool found = std::any_of(m_statuses.cbegin(), m_statuses.cend(), [&id](const Post *post) {
+            return post->originalId() == id;
+        });
+        if (!found) {
+            posts.push_back(new Post(m_account, status, this));
+        }
+    }
+
+    if (posts.isEmpty()) {
+        return;
+    }
+
+    const int row = rowCount({});
+    beginInsertRows({}, row, row + static_cast<int>(posts.size()) - 1);
+    m_seenStatuses = posts;
+    endInsertRows();
+}
+
+void SearchModel::removeSeenStatuses(qsizetype first, qsizetype last)
+{
+    if (first > last) {
+        return;
+    }
+
+    const qsizetype offset = m_accounts.size() + m_statuses.size() + m_hashtags.size();
+    beginRemoveRows({}, static_cast<int>(offset + first), static_cast<int>(offset + last));
+    for (qsizetype i = last; i >= first; i--) {
+        delete m_seenStatuses.takeAt(i);
+    }
+    endRemoveRows();
+}
+
+void SearchModel::cancel()
+{
+    m_searchTimer.stop();
+    if (m_request) {
+        m_request->deleteLater();
+        m_request = nullptr;
+    }
+    m_fetchingMore = false;
 }
 
 int SearchModel::rowCount(const QModelIndex &parent) const
 {
     Q_UNUSED(parent);
 
-    return m_accounts.count() + m_statuses.count() + m_hashtags.count();
+    return m_accounts.count() + m_statuses.count() + m_hashtags.count() + m_seenStatuses.count();
 }
 
 QVariant SearchModel::data(const QModelIndex &index, int role) const
@@ -89,10 +413,13 @@ QVariant SearchModel::data(const QModelIndex &index, int role) const
     const auto row = index.row();
 
     const bool isStatus = row >= m_accounts.count() && row < m_accounts.count() + m_statuses.size();
-    const bool isHashtag = row >= m_accounts.size() + m_statuses.count();
+    const bool isHashtag = row >= m_accounts.size() + m_statuses.count() && row < m_accounts.size() + m_statuses.count() + m_hashtags.count();
+    const bool isSeenStatus = row >= m_accounts.size() + m_statuses.count() + m_hashtags.count();
 
     if (role == TypeRole) {
-        if (isHashtag) {
+        if (isSeenStatus) {
+            return SeenStatus;
+        } else if (isHashtag) {
             return Hashtag;
         } else if (isStatus) {
             return Status;
@@ -106,6 +433,11 @@ QVariant SearchModel::data(const QModelIndex &index, int role) const
         return postData(post, role);
     }
 
+    if (isSeenStatus) {
+        const auto post = m_seenStatuses[row - m_accounts.count() - m_statuses.count() - m_hashtags.count()];
+        return postData(post, role);
+    }
+
     if (isHashtag) {
         const auto hashtag = m_hashtags[row - m_accounts.count() - m_statuses.count()];
         switch (role) {
@@ -124,13 +456,27 @@ QVariant SearchModel::data(const QModelIndex &index, int role) const
 }
 
 void SearchModel::clear()
+{
+    cancel();
+    m_query.clear();
+
+    beginResetModel();
+    clearResults();
+    qDeleteAll(m_seenStatuses);
+    m_seenStatuses.clear();
+    endResetModel();
+
+    setTypesWithMoreResults({});
+    setLoading(false);
+    setLoaded(false);
+}
+
+void SearchModel::clearResults()
 {
     m_accounts.clear();
     qDeleteAll(m_statuses);
     m_statuses.clear();
     m_hashtags.clear();
-    setLoading(false);
-    setLoaded(false);
 }
 
 QString SearchModel::labelForType(ResultType sectionType)
@@ -142,6 +488,8 @@ QString SearchModel::labelForType(ResultType sectionType)
         return i18n("Hashtags");
     case Status:
         return i18n("Posts");
+    case SeenStatus:
+        return i18n("Seen Posts");
     default:
         return {};
     }
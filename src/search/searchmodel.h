@@ -5,6 +5,13 @@
 
 #include "timeline/abstracttimelinemodel.h"
 
+#include <QCache>
+#include <QJsonArray>
+#include <QPointer>
+#include <QTimer>
+
+#include <chrono>
+
 class Identity;
 class Post;
 
@@ -25,6 +32,12 @@ private:
 
 /**
  * @brief Model used to fetch search results.
+ *
+ * Searches are started a moment after the last call to search(), so typing doesn't send a request for every keystroke, and a newer search cancels the
+ * older one. The server is only asked to resolve remote accounts and posts if the query looks like one and it didn't already know about it. Recent
+ * results are kept, so going back to a previous query shows them right away. Statuses the user has already seen are searched locally as well, and are
+ * shown after the server's results.
+ *
  * @see AbstractTimelineModel
  */
 class SearchModel : public AbstractTimelineModel
@@ -34,6 +47,12 @@ class SearchModel : public AbstractTimelineModel
 
     Q_PROPERTY(bool loaded READ loaded NOTIFY loadedChanged)
 
+    /**
+     * @brief The result types that have more results to fetch.
+     * @see fetchMoreOfType()
+     */
+    Q_PROPERTY(QList<int> typesWithMoreResults READ typesWithMoreResults NOTIFY typesWithMoreResultsChanged)
+
 public:
     /**
      * The search result type.
@@ -42,9 +61,30 @@ public:
         Status, /** A status (for full-text search) */
         Account, /** An account. */
         Hashtag, /** A hashtag. */
+        SeenStatus, /** A status the user has seen before, found without asking the server. */
     };
     Q_ENUM(ResultType);
 
+    /**
+     * @brief How long to wait for more input before searching.
+     */
+    static constexpr std::chrono::milliseconds searchDelay{300};
+
+    /**
+     * @brief How many results of each type are fetched at once.
+     */
+    static constexpr int pageSize = 20;
+
+    /**
+     * @brief How many recent queries the results are kept for.
+     */
+    static constexpr int cachedQueries = 16;
+
+    /**
+     * @brief How many seen statuses are shown at most.
+     */
+    static constexpr int seenStatusLimit = 10;
+
     explicit SearchModel(QObject *parent = nullptr);
     ~SearchModel() override;
 
@@ -60,12 +100,30 @@ public:
      */
     void setLoaded(bool loaded);
 
-    ///
     /**
-     * @brief Start searching for @p queryString.
+     * @brief Start searching for @p queryString, once no other search was started for a moment.
+     *
+     * If it was searched for recently, the results are shown right away.
      */
     Q_INVOKABLE void search(const QString &queryString);
 
+    /**
+     * @brief Fetch the next page of results of @p type.
+     * @see typesWithMoreResults()
+     */
+    Q_INVOKABLE void fetchMoreOfType(SearchModel::ResultType type);
+
+    /**
+     * @return The result types that have more results to fetch.
+     * @see fetchMoreOfType()
+     */
+    QList<int> typesWithMoreResults() const;
+
+    /**
+     * @return If @p query could be a remote account or post the server doesn't know about yet, like a handle or a link.
+     */
+    static bool needsResolving(const QString &query);
+
     /**
      * @brief Get a localized label for a result type.
      */
@@ -86,9 +144,45 @@ Q_SIGNALS:
      */
     void loadedChanged();
 
+    /**
+     * @brief Emitted when it changed which result types have more results to fetch.
+     */
+    void typesWithMoreResultsChanged();
+
 private:
+    struct Results {
+        QJsonArray accounts;
+        QJsonArray statuses;
+        QJsonArray hashtags;
+        QList<int> typesWithMore;
+    };
+
+    static QString typeKey(ResultType type);
+    static Results parseResults(const QJsonObject &object);
+
+    QUrl searchUrl(const QList<std::pair<QString, QString>> &parameters) const;
+    void fetchResults(bool resolve);
+    bool hasExactMatch(const Results &results) const;
+    void setResults(const Results &results);
+    void appendResults(ResultType type, const QJsonArray &array);
+    void addResults(ResultType type, const QJsonArray &array);
+    void setTypesWithMoreResults(const QList<int> &types);
+    void searchSeenStatuses();
+    void setSeenStatuses(const QList<QJsonObject> &statuses);
+    void removeSeenStatuses(qsizetype first, qsizetype last);
+    void cancel();
+    void clearResults();
+
     QList<std::shared_ptr<Identity>> m_accounts;
     QList<Post *> m_statuses;
     QList<SearchHashtag> m_hashtags;
+    QList<Post *> m_seenStatuses; // Listed last, and never the same as one in m_statuses
     bool m_loaded = false;
+
+    QString m_query;
+    QTimer m_searchTimer;
+    QPointer<QObject> m_request; // Parent of the replies for the current query, so they're aborted along with it
+    bool m_fetchingMore = false;
+    QList<int> m_typesWithMore;
+    QCache<QString, Results> m_cache{cachedQueries};
 };
\ No newline at end of file
@@ -4,14 +4,24 @@
 #include "timeline/abstracttimelinemodel.h"
 
 #include "account/abstractaccount.h"
+#include "config.h"
 #include "editor/attachmenteditormodel.h"
 #include "editor/posteditorbackend.h"
+#include "timeline/delegateheightcache.h"
+#include "utils/bidihtmlcache.h"
 
 using namespace Qt::Literals::StringLiterals;
 
 AbstractTimelineModel::AbstractTimelineModel(QObject *parent)
     : QAbstractListModel(parent)
 {
+    // One timer for the whole model, instead of every delegate keeping its own time up to date
+    m_relativeTimeTimer.setInterval(std::chrono::minutes(1));
+    m_relativeTimeTimer.setTimerType(Qt::VeryCoarseTimer);
+    connect(&m_relativeTimeTimer, &QTimer::timeout, this, &AbstractTimelineModel::refreshRelativeTimes);
+    m_relativeTimeTimer.start();
+
+    connect(&BidiHtmlCache::instance(), &BidiHtmlCache::ready, this, &AbstractTimelineModel::bidiContentReady);
 }
 
 bool AbstractTimelineModel::loading() const
@@ -28,6 +38,44 @@ void AbstractTimelineModel::setLoading(bool loading)
     Q_EMIT loadingChanged();
 }
 
+qreal AbstractTimelineModel::cachedDelegateHeight(const QString &postId, const QString &layout, qreal width) const
+{
+    return DelegateHeightCache::instance().height(postId, layout, width, Config::self()->defaultFont()).value_or(0);
+}
+
+void AbstractTimelineModel::reportDelegateHeight(const QString &postId, const QString &layout, qreal width, qreal height)
+{
+    // The view already has this delegate at the right height, so there's nothing to notify
+    DelegateHeightCache::instance().setHeight(postId, layout, width, Config::self()->defaultFont(), height);
+}
+
+void AbstractTimelineModel::refreshRelativeTimes()
+{
+    const int rows = rowCount();
+    if (rows > 0) {
+        Q_EMIT dataChanged(index(0, 0), index(rows - 1, 0), {RelativeTimeRole});
+    }
+}
+
+QString AbstractTimelineModel::bidiContent(Post *post) const
+{
+    return BidiHtmlCache::instance().html(post->contentKey(), post->content(), Config::self()->defaultFont()).value_or(post->content());
+}
+
+void AbstractTimelineModel::bidiContentReady(const QStringList &keys)
+{
+    const QSet<QString> ready(keys.cbegin(), keys.cend());
+
+    const int rows = rowCount();
+    for (int row = 0; row < rows; row++) {
+        const QModelIndex idx = index(row, 0);
+        const auto post = data(idx, PostRole).value<Post *>();
+        if (post != nullptr && ready.contains(post->contentKey())) {
+            Q_EMIT dataChanged(idx, idx, {BidiContentRole});
+        }
+    }
+}
+
 QHash<int, QByteArray> AbstractTimelineModel::roleNames() const
 {
     return {
@@ -35,6 +83,7 @@ QHash<int, QByteArray> AbstractTimelineModel::roleNames() const
         {OriginalIdRole, QByteArrayLiteral("originalId")},
         {UrlRole, QByteArrayLiteral("url")},
         {ContentRole, QByteArrayLiteral("content")},
+        {BidiContentRole, QByteArrayLiteral("bidiContent")},
         {SpoilerTextRole, QByteArrayLiteral("spoilerText")},
         {AuthorIdentityRole, QByteArrayLiteral("authorIdentity")},
         {PublishedAtRole, QByteArrayLiteral("publishedAt")},
@@ -48,6 +97,9 @@ QHash<int, QByteArray> AbstractTimelineModel::roleNames() const
         {SensitiveRole, QByteArrayLiteral("sensitive")},
         {IsThreadReplyRole, "isThreadReply"},
         {IsLastThreadReplyRole, QByteArrayLiteral("isLastThreadReply")},
+        {ThreadDepthRole, QByteArrayLiteral("threadDepth")},
+        {CollapsedRepliesRole, QByteArrayLiteral("collapsedReplies")},
+        {CollapsibleRepliesRole, QByteArrayLiteral("collapsibleReplies")},
 
         // Additional content
         {CardRole, QByteArrayLiteral("card")},
@@ -97,6 +149,8 @@ QVariant AbstractTimelineModel::postData(Post *post, int role) const
         return post->mentions();
     case ContentRole:
         return post->content();
+    case BidiContentRole:
+        return bidiContent(post);
     case AuthorIdentityRole:
         return QVariant::fromValue<Identity *>(post->authorIdentity().get());
     case IsBoostedRole:
@@ -156,20 +210,19 @@ QVariant AbstractTimelineModel::postData(Post *post, int role) const
         return false;
     case UrlRole:
         return QVariant::fromValue<QUrl>(post->url());
-    case RelativeTimeRole: {
+    case RelativeTimeRole:
         return post->relativeTime();
-    }
-    case AbsoluteTimeRole: {
+    case AbsoluteTimeRole:
         return post->absoluteTime();
-    }
     case PollRole:
-        if (post->poll()) {
-            return QVariant::fromValue<Poll>(*post->poll());
-        }
-        return {};
+        return post->pollValue();
     case TypeRole:
     case NotificationActorIdentityRole:
         return {};
+    case ThreadDepthRole:
+    case CollapsedRepliesRole:
+    case CollapsibleRepliesRole:
+        return 0;
     case PostRole:
         return QVariant::fromValue<Post *>(post);
     }
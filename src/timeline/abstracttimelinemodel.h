@@ -5,6 +5,8 @@
 
 #include "account/accountmanager.h"
 
+#include <QTimer>
+
 class AbstractAccount;
 class PostEditorBackend;
 
@@ -25,6 +27,7 @@ public:
         OriginalIdRole, /** Original post id (boosted posts generate their own id and live in IdRole) */
         UrlRole, /** Original URL of the post, can be from a different instance. */
         ContentRole, /** Content text of the post. */
+        BidiContentRole, /** Content of the post with its bidirectionality fixed for display, see TextHandler::fixBidirectionality(). Longer content is the plain content until that's done in the background. */
         SpoilerTextRole, /** Spoiler label for the post. */
         AuthorIdentityRole, /** Identity of the author. */
         PublishedAtRole, /** Date that the post was published at. */
@@ -36,6 +39,9 @@ public:
         EditedAtRole, /** The datetime of the last edit. */
         IsThreadReplyRole, /** True if this reply in the thread is not for the main thread. */
         IsLastThreadReplyRole, /** True if this reply is the last "thread reply" and should be visually separated. */
+        ThreadDepthRole, /** How many replies deep this post is below the selected post in a thread, which is negative for its ancestors. */
+        CollapsedRepliesRole, /** The number of replies below this post that are collapsed in a thread. */
+        CollapsibleRepliesRole, /** The number of replies below this post that can be collapsed in a thread. */
 
         // Additional content
         AttachmentsRole, /** Media attachments for the post, which can be null. */
@@ -96,6 +102,18 @@ public:
      */
     void setLoading(bool loading);
 
+    /**
+     * @return The height the delegate for the post @p postId had last time it was shown with @p layout at @p width, or 0 if it's unknown.
+     * @see DelegateHeightCache::height()
+     */
+    Q_INVOKABLE qreal cachedDelegateHeight(const QString &postId, const QString &layout, qreal width) const;
+
+    /**
+     * @brief Remembers that the delegate for the post @p postId was @p height tall when shown with @p layout at @p width.
+     * @see cachedDelegateHeight()
+     */
+    Q_INVOKABLE void reportDelegateHeight(const QString &postId, const QString &layout, qreal width, qreal height);
+
     /**
      * @brief Favorite the @p post at @p index.
      */
@@ -145,4 +163,22 @@ protected:
 
     AbstractAccount *m_account = nullptr;
     bool m_loading = false;
+
+private:
+    /**
+     * @brief Notifies the views that relative times may have changed, which they then re-query for the rows they're showing.
+     */
+    void refreshRelativeTimes();
+
+    /**
+     * @return The content of @p post with its bidirectionality fixed, which is computed in the background the first time it's asked for if it's long.
+     */
+    QString bidiContent(Post *post) const;
+
+    /**
+     * @brief Notifies the views of the rows whose fixed content for @p keys just became ready.
+     */
+    void bidiContentReady(const QStringList &keys);
+
+    QTimer m_relativeTimeTimer;
 };
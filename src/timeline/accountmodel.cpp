@@ -3,7 +3,8 @@
 
 #include "timeline/accountmodel.h"
 
-#include "account/relationship.h"
+#include "account/prefetchcache.h"
+#include "account/relationshipcache.h"
 
 #include <KLocalizedString>
 
@@ -69,11 +70,7 @@ void AccountModel::fillTimeline(const QString &fromId)
         uriStatus.setQuery(statusQuery);
     }
 
-    auto uriPinned = m_account->apiUrl(QStringLiteral("/api/v1/accounts/%1/statuses").arg(m_accountId));
-    uriPinned.setQuery(QUrlQuery{{
-        QStringLiteral("pinned"),
-        QStringLiteral("true"),
-    }});
+    const auto uriPinned = pinnedUrl(m_account, m_accountId);
 
     const auto account = m_account;
     const auto id = m_accountId;
@@ -83,12 +80,11 @@ void AccountModel::fillTimeline(const QString &fromId)
         setLoading(false);
     };
 
-    auto onFetchPinned = [this, id, account](QNetworkReply *reply) {
+    auto onFetchPinned = [this, id, account](const QByteArray &data) {
         if (m_account != account || m_accountId != id) {
             setLoading(false);
             return;
         }
-        const auto data = reply->readAll();
         const auto doc = QJsonDocument::fromJson(data);
         if (!doc.isArray()) {
             setLoading(false);
@@ -113,7 +109,7 @@ void AccountModel::fillTimeline(const QString &fromId)
         setLoading(false);
     };
 
-    auto onFetchAccount = [account, id, fetchPinned, uriPinned, handleError, onFetchPinned, fromId, this](QNetworkReply *reply) {
+    auto onFetchAccount = [account, id, fetchPinned, uriPinned, handleError, onFetchPinned, fromId, this](const QByteArray &data) {
         if (m_account != account || m_accountId != id) {
             setLoading(false);
             return;
@@ -125,15 +121,15 @@ void AccountModel::fillTimeline(const QString &fromId)
             reset();
         }
 
-        fetchedTimeline(reply->readAll(), true);
+        fetchedTimeline(data, true);
         if (fetchPinned) {
-            m_account->get(uriPinned, true, this, onFetchPinned, handleError);
+            m_account->prefetchCache()->get(uriPinned, this, onFetchPinned, handleError);
         } else {
             setLoading(false);
         }
     };
 
-    m_account->get(uriStatus, true, this, onFetchAccount, handleError);
+    m_account->prefetchCache()->get(uriStatus, this, onFetchAccount, handleError);
 }
 
 Identity *AccountModel::identity() const
@@ -154,58 +150,71 @@ void AccountModel::setAccountId(const QString &accountId)
     m_accountId = accountId;
     Q_EMIT accountIdChanged();
 
-    if (!m_account->identityCached(accountId)) {
-        QUrl uriAccount(m_account->instanceUri());
-        uriAccount.setPath(QStringLiteral("/api/v1/accounts/%1").arg(accountId));
-
-        m_account->get(uriAccount, true, this, [this, accountId](QNetworkReply *reply) {
-            const auto data = reply->readAll();
-            const auto doc = QJsonDocument::fromJson(data);
-
-            m_identity = m_account->identityLookup(accountId, doc.object());
-            Q_EMIT identityChanged();
-            updateRelationships();
-        });
-    } else {
+    // Show what we already know right away, the profile is still fetched to bring counts and such up to date
+    const bool cached = m_account->identityCached(accountId);
+    if (cached) {
         m_identity = m_account->identityLookup(accountId, {});
         Q_EMIT identityChanged();
         updateRelationships();
     }
+
+    m_account->prefetchCache()->get(accountUrl(m_account, accountId), this, [this, accountId, cached](const QByteArray &data) {
+        const auto doc = QJsonDocument::fromJson(data);
+
+        // A cached identity is updated in place, so there's nothing else to do
+        const auto identity = m_account->identityLookup(accountId, doc.object(), true);
+        if (!cached || identity != m_identity) {
+            m_identity = identity;
+            Q_EMIT identityChanged();
+            updateRelationships();
+        }
+    });
     Q_EMIT accountIdChanged();
 
     fillTimeline();
 }
 
+void AccountModel::prefetch(AbstractAccount *account, const QString &accountId)
+{
+    if (account == nullptr || accountId.isEmpty()) {
+        return;
+    }
+
+    // Profiles open on the posts tab, see updateTabFilters()
+    auto uriStatus = account->apiUrl(QStringLiteral("/api/v1/accounts/%1/statuses").arg(accountId));
+    uriStatus.setQuery(QUrlQuery{{QStringLiteral("exclude_replies"), QStringLiteral("true")}});
+
+    const auto cache = account->prefetchCache();
+    cache->prefetch(accountUrl(account, accountId));
+    cache->prefetch(uriStatus);
+    cache->prefetch(pinnedUrl(account, accountId));
+    account->relationshipCache()->request(accountId);
+}
+
 AbstractAccount *AccountModel::account() const
 {
     return m_account;
 }
 
-void AccountModel::updateRelationships()
+QUrl AccountModel::accountUrl(AbstractAccount *account, const QString &accountId)
 {
-    if (m_account->identity()->id() == m_identity->id()) {
-        return;
-    }
-
-    // Fetch relationship. Don't cache this; it's lightweight.
-    QUrl uriRelationship(m_account->instanceUri());
-    uriRelationship.setPath(QStringLiteral("/api/v1/accounts/relationships"));
-    uriRelationship.setQuery(QUrlQuery{
-        {QStringLiteral("id[]"), m_identity->id()},
-    });
+    return account->apiUrl(QStringLiteral("/api/v1/accounts/%1").arg(accountId));
+}
 
-    m_account->get(uriRelationship, true, this, [this](QNetworkReply *reply) {
-        const auto doc = QJsonDocument::fromJson(reply->readAll());
-        if (!doc.isArray()) {
-            qWarning() << "Data returned from Relationship network request is not an array"
-                       << "data: " << doc;
-            return;
-        }
+QUrl AccountModel::pinnedUrl(AbstractAccount *account, const QString &accountId)
+{
+    auto url = account->apiUrl(QStringLiteral("/api/v1/accounts/%1/statuses").arg(accountId));
+    url.setQuery(QUrlQuery{{
+        QStringLiteral("pinned"),
+        QStringLiteral("true"),
+    }});
+    return url;
+}
 
-        // We only are requesting for a single relationship, so doc should only contain one element
-        m_identity->setRelationship(new Relationship(m_identity.get(), doc[0].toObject()));
-        Q_EMIT identityChanged();
-    });
+void AccountModel::updateRelationships()
+{
+    // This is shared with every other page, so opening the same profile again doesn't fetch it again
+    m_account->relationshipCache()->request(m_identity->id());
 }
 
 void AccountModel::updateTabFilters()
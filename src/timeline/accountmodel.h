@@ -74,6 +74,12 @@ public:
     QString accountId() const;
     void setAccountId(const QString &accountId);
 
+    /**
+     * @brief Starts loading the profile, posts and relationship of @p accountId ahead of time, so the profile page is filled right away once it's opened.
+     * @see PrefetchCache
+     */
+    static void prefetch(AbstractAccount *account, const QString &accountId);
+
     Identity *identity() const;
 
     QString displayName() const override;
@@ -93,6 +99,9 @@ protected:
     void reset() override;
 
 private:
+    static QUrl accountUrl(AbstractAccount *account, const QString &accountId);
+    static QUrl pinnedUrl(AbstractAccount *account, const QString &accountId);
+
     void updateRelationships();
     void updateTabFilters();
 
@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "timeline/delegateheightcache.h"
+
+#include "tokodon_debug.h"
+
+#include <QCoreApplication>
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+using namespace Qt::Literals::StringLiterals;
+
+// Bumped whenever the file format changes, older files are ignored
+static constexpr quint32 fileVersion = 2;
+
+DelegateHeightCache::DelegateHeightCache(const QString &path)
+    : m_path(path)
+{
+    load();
+}
+
+DelegateHeightCache &DelegateHeightCache::instance()
+{
+    static DelegateHeightCache cache(QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/delegate_heights"_L1);
+    static const bool connected = [] {
+        if (QCoreApplication::instance() == nullptr) {
+            return false;
+        }
+        QObject::connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, [] {
+            cache.save();
+        });
+        return true;
+    }();
+    Q_UNUSED(connected)
+
+    return cache;
+}
+
+std::optional<qreal> DelegateHeightCache::height(const QString &postId, const QString &layout, qreal width, const QFont &font) const
+{
+    if (const qreal *height = m_heights.object(key(postId, layout, width, font))) {
+        return *height;
+    }
+    return std::nullopt;
+}
+
+void DelegateHeightCache::setHeight(const QString &postId, const QString &layout, qreal width, const QFont &font, qreal height)
+{
+    if (postId.isEmpty() || width <= 0 || height <= 0) {
+        return;
+    }
+
+    m_heights.insert(key(postId, layout, width, font), new qreal(height));
+}
+
+qsizetype DelegateHeightCache::size() const
+{
+    return m_heights.size();
+}
+
+void DelegateHeightCache::save() const
+{
+    if (m_path.isEmpty()) {
+        return;
+    }
+
+    QDir().mkpath(QFileInfo(m_path).absolutePath());
+
+    QSaveFile file(m_path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qCWarning(TOKODON_LOG) << "Failed to save delegate heights to" << m_path << file.errorString();
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream << fileVersion << quint32(m_heights.size());
+
+    const auto keys = m_heights.keys();
+    for (const QString &key : keys) {
+        stream << key << double(*m_heights.object(key));
+    }
+
+    file.commit();
+}
+
+QString DelegateHeightCache::key(const QString &postId, const QString &layout, qreal width, const QFont &font)
+{
+    const int bucket = qRound(width) / widthBucketSize;
+    return postId + u'/' + layout + u'/' + QString::number(bucket) + u'/' + font.key();
+}
+
+void DelegateHeightCache::load()
+{
+    if (m_path.isEmpty()) {
+        return;
+    }
+
+    QFile file(m_path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    QDataStream stream(&file);
+    quint32 version = 0;
+    quint32 count = 0;
+    stream >> version >> count;
+    if (version != fileVersion) {
+        return;
+    }
+
+    for (quint32 i = 0; i < count && i < capacity && stream.status() == QDataStream::Ok; i++) {
+        QString key;
+        double height = 0;
+        stream >> key >> height;
+        if (stream.status() == QDataStream::Ok) {
+            m_heights.insert(key, new qreal(height));
+        }
+    }
+}
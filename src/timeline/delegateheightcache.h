@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QCache>
+#include <QFont>
+#include <QString>
+
+#include <optional>
+
+/**
+ * @brief Remembers how tall post delegates were, so they can start out at that height the next time they're created.
+ *
+ * Post delegates are rich text with images and cards loaded afterwards, so their final height is only known once all of that is laid out. Heights
+ * are kept per post, layout, width and font, and saved between sessions so the scrollbars are stable from the start.
+ */
+class DelegateHeightCache
+{
+public:
+    /**
+     * @brief The width in pixels that is considered the same, to not keep a height for every pixel while resizing.
+     */
+    static constexpr int widthBucketSize = 8;
+
+    /**
+     * @brief The most heights that are kept.
+     */
+    static constexpr qsizetype capacity = 8192;
+
+    /**
+     * @param path The file heights are loaded from and saved to, or empty to only keep them in memory.
+     */
+    explicit DelegateHeightCache(const QString &path = {});
+
+    /**
+     * @return The cache shared by every timeline, which is saved in the cache directory when the application quits.
+     */
+    static DelegateHeightCache &instance();
+
+    /**
+     * @return The height of the post @p postId last time it was shown with @p layout at @p width with @p font, if known.
+     * @param layout Anything about how the post is shown that changes its height, like if its content warning is expanded.
+     */
+    std::optional<qreal> height(const QString &postId, const QString &layout, qreal width, const QFont &font) const;
+
+    /**
+     * @brief Remembers that the post @p postId was @p height tall when shown with @p layout at @p width with @p font.
+     */
+    void setHeight(const QString &postId, const QString &layout, qreal width, const QFont &font, qreal height);
+
+    /**
+     * @return The number of heights kept.
+     */
+    qsizetype size() const;
+
+    /**
+     * @brief Saves the heights to the file given in the constructor, if any.
+     */
+    void save() const;
+
+private:
+    static QString key(const QString &postId, const QString &layout, qreal width, const QFont &font);
+    void load();
+
+    QString m_path;
+    QCache<QString, qreal> m_heights{capacity};
+};
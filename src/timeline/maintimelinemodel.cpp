@@ -3,6 +3,8 @@
 
 #include "timeline/maintimelinemodel.h"
 
+#include "account/statusindex.h"
+
 #include <KLocalizedString>
 
 MainTimelineModel::MainTimelineModel(QObject *parent)
@@ -152,6 +154,7 @@ void MainTimelineModel::handleEvent(AbstractAccount::StreamingEventType eventTyp
     TimelineModel::handleEvent(eventType, payload);
     if (eventType == AbstractAccount::StreamingEventType::UpdateEvent && m_timelineName == QStringLiteral("home")) {
         const auto doc = QJsonDocument::fromJson(payload);
+        m_account->statusIndex()->add(QJsonArray{doc.object()});
         const auto post = new Post(m_account, doc.object(), this);
         beginInsertRows({}, 0, 0);
         m_timeline.push_front(post);
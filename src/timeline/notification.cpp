@@ -37,10 +37,25 @@ Notification::Notification(AbstractAccount *account, const QJsonObject &obj, QOb
     m_post = createPost(m_account, status, parent);
     m_identity = m_account->identityLookup(accountId, accountObj);
     m_type = str_to_not_type[type];
-    m_id = obj["id"_L1].toString().toInt();
+    m_id = EntityId::fromJson(obj["id"_L1]);
+    m_groupKey = obj["group_key"_L1].toString();
 }
 
-int Notification::id() const
+Notification::Notification(AbstractAccount *account, const QJsonObject &group, Post *post, QList<std::shared_ptr<Identity>> sampleIdentities)
+    : m_account(account)
+    , m_post(post)
+    , m_sampleIdentities(std::move(sampleIdentities))
+{
+    m_type = str_to_not_type[group["type"_L1].toString()];
+    m_id = EntityId::fromJson(group["most_recent_notification_id"_L1]);
+    m_groupKey = group["group_key"_L1].toString();
+    m_groupSize = qMax(group["notifications_count"_L1].toInt(1), 1);
+    if (!m_sampleIdentities.isEmpty()) {
+        m_identity = m_sampleIdentities.constFirst();
+    }
+}
+
+EntityId Notification::id() const
 {
     return m_id;
 }
@@ -65,4 +80,36 @@ std::shared_ptr<Identity> Notification::identity() const
     return m_identity;
 }
 
+int Notification::groupSize() const
+{
+    return m_groupSize;
+}
+
+QList<std::shared_ptr<Identity>> Notification::sampleIdentities() const
+{
+    if (m_sampleIdentities.isEmpty() && m_identity) {
+        return {m_identity};
+    }
+
+    return m_sampleIdentities;
+}
+
+QString Notification::groupKey() const
+{
+    return m_groupKey;
+}
+
+void Notification::addToGroup(const Notification &notification)
+{
+    m_sampleIdentities = sampleIdentities();
+    if (notification.m_identity) {
+        m_sampleIdentities.removeAll(notification.m_identity);
+        m_sampleIdentities.prepend(notification.m_identity);
+        m_identity = notification.m_identity;
+    }
+
+    m_id = notification.m_id;
+    m_groupSize++;
+}
+
 #include "moc_notification.cpp"
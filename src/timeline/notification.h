@@ -4,6 +4,7 @@
 #pragma once
 
 #include "account/abstractaccount.h"
+#include "utils/entityid.h"
 
 class Notification
 {
@@ -13,22 +14,53 @@ public:
     Notification() = default;
     explicit Notification(AbstractAccount *account, const QJsonObject &obj, QObject *parent = nullptr);
 
+    /**
+     * @brief Creates a notification for a group from the grouped notifications API, whose post and accounts were already looked up.
+     * @param group The notification group object.
+     * @param post The post the group is about, if any.
+     * @param sampleIdentities The identities of the group's most recent accounts, with the latest first.
+     */
+    explicit Notification(AbstractAccount *account, const QJsonObject &group, Post *post, QList<std::shared_ptr<Identity>> sampleIdentities);
+
     enum Type { Mention, Follow, Repeat, Favorite, Poll, FollowRequest, Update, Status, AdminSignUp };
     Q_ENUM(Type);
 
-    int id() const;
+    EntityId id() const;
     AbstractAccount *account() const;
     Type type() const;
     Post *post() const;
     std::shared_ptr<Identity> identity() const;
 
+    /**
+     * @return The number of notifications this stands for, which is only more than one for groups made by the server.
+     */
+    int groupSize() const;
+
+    /**
+     * @return The identities of the group's most recent accounts, or just identity() if this isn't a group made by the server.
+     */
+    QList<std::shared_ptr<Identity>> sampleIdentities() const;
+
+    /**
+     * @return The key of the group the server put this notification in, which is empty if the server doesn't group notifications.
+     */
+    QString groupKey() const;
+
+    /**
+     * @brief Counts the newer @p notification from the same server-side group as part of this one.
+     */
+    void addToGroup(const Notification &notification);
+
 private:
-    int m_id = 0;
+    EntityId m_id;
 
     AbstractAccount *m_account = nullptr;
     Post *m_post = nullptr;
     Type m_type = Type::Favorite;
     std::shared_ptr<Identity> m_identity;
+    QString m_groupKey;
+    int m_groupSize = 1;
+    QList<std::shared_ptr<Identity>> m_sampleIdentities;
 
     Post *createPost(AbstractAccount *account, const QJsonObject &obj, QObject *parent);
 };
@@ -8,6 +8,7 @@
 #include "accountmanager.h"
 #include "networkcontroller.h"
 #include "tokodon_debug.h"
+#include "utils/stringpool.h"
 #include "utils/texthandler.h"
 
 #include <KLocalizedString>
@@ -32,7 +33,6 @@ static const QMap<QString, Post::Visibility> p_stringToVisibility = {
 Post::Post(AbstractAccount *account, QObject *parent)
     : QObject(parent)
     , m_parent(account)
-    , m_attachmentList(this, &m_attachments)
 {
     Q_ASSERT(account);
     QString visibilityString = account->identity()->visibility();
@@ -42,7 +42,6 @@ Post::Post(AbstractAccount *account, QObject *parent)
 Post::Post(AbstractAccount *account, QJsonObject obj, QObject *parent)
     : QObject(parent)
     , m_parent(account)
-    , m_attachmentList(this, &m_attachments)
     , m_visibility(Post::Visibility::Public)
 {
     Q_ASSERT(account);
@@ -54,7 +53,7 @@ void Post::fromJson(QJsonObject obj)
     const auto accountDoc = obj["account"_L1].toObject();
     const auto accountId = accountDoc["id"_L1].toString();
 
-    m_originalPostId = obj["id"_L1].toString();
+    m_originalPostId = EntityId::fromJson(obj["id"_L1]);
     const auto reblogObj = obj["reblog"_L1].toObject();
 
     if (!obj.contains("reblog"_L1) || reblogObj.isEmpty()) {
@@ -72,7 +71,7 @@ void Post::fromJson(QJsonObject obj)
         obj = reblogObj;
     }
 
-    m_postId = obj["id"_L1].toString();
+    m_postId = EntityId::fromJson(obj["id"_L1]);
 
     m_spoilerText = obj["spoiler_text"_L1].toString();
 
@@ -119,7 +118,7 @@ void Post::fromJson(QJsonObject obj)
                 const auto data = reply->readAll();
                 const auto doc = QJsonDocument::fromJson(data);
 
-                m_replyIdentity = m_parent->identityLookup(accountId, doc.object());
+                m_replyIdentity = m_parent->identityLookup(accountId, doc.object(), true);
                 Q_EMIT replyIdentityChanged();
             });
         }
@@ -164,7 +163,7 @@ void Post::fromJson(QJsonObject obj)
 
     m_sensitive = obj["sensitive"_L1].toBool();
     m_visibility = stringToVisibility(obj["visibility"_L1].toString());
-    m_language = obj["language"_L1].toString();
+    m_language = StringPool::intern(obj["language"_L1].toString());
 
     m_publishedAt = QDateTime::fromString(obj["created_at"_L1].toString(), Qt::ISODate).toLocalTime();
 
@@ -192,18 +191,32 @@ void Post::fromJson(QJsonObject obj)
     if (obj.contains(QStringLiteral("poll")) && !obj[QStringLiteral("poll")].isNull()) {
         m_poll = std::make_unique<Poll>(obj[QStringLiteral("poll")].toObject());
     }
+
+    m_relativeTimeValidUntil = 0;
+    m_absoluteTime.clear();
+    m_pollValue.clear();
 }
 
-QString Post::postId() const
+EntityId Post::id() const
 {
     return m_postId;
 }
 
-QString Post::originalPostId() const
+EntityId Post::originalId() const
 {
     return m_originalPostId;
 }
 
+QString Post::postId() const
+{
+    return m_postId.toString();
+}
+
+QString Post::originalPostId() const
+{
+    return m_originalPostId.toString();
+}
+
 QDateTime Post::publishedAt() const
 {
     return m_publishedAt;
@@ -211,37 +224,56 @@ QDateTime Post::publishedAt() const
 
 QString Post::relativeTime() const
 {
+    const qint64 now = QDateTime::currentSecsSinceEpoch();
+    if (now < m_relativeTimeValidUntil) {
+        return m_relativeTime;
+    }
+
     const auto current = QDateTime::currentDateTime();
     const auto publishingDate = publishedAt();
     const auto secsTo = publishingDate.secsTo(current);
     const auto daysTo = publishingDate.daysTo(current);
+
+    // Keep the text until the unit it's shown in ticks over. Days depend on the local date, so check those every minute
     if (secsTo < 0) {
-        return i18n("in the future");
+        m_relativeTime = i18n("in the future");
+        m_relativeTimeValidUntil = publishingDate.toSecsSinceEpoch();
     } else if (secsTo < 60) {
-        return i18n("%1s", qCeil(secsTo));
+        m_relativeTime = i18n("%1s", qCeil(secsTo));
+        m_relativeTimeValidUntil = now + 1;
     } else if (secsTo < 60 * 60) {
-        return i18n("%1m", qCeil(secsTo / 60));
+        m_relativeTime = i18n("%1m", qCeil(secsTo / 60));
+        m_relativeTimeValidUntil = now + 60 - secsTo % 60;
     } else if (secsTo < 60 * 60 * 24) {
-        return i18n("%1h", qCeil(secsTo / (60 * 60)));
-    } else if (daysTo < 7) {
-        return i18n("%1d", qCeil(daysTo));
-    } else if (daysTo < 365) {
-        const auto weeksTo = qCeil(daysTo / 7);
-        if (weeksTo < 5) {
-            return i18np("1 week ago", "%1 weeks ago", weeksTo);
+        m_relativeTime = i18n("%1h", qCeil(secsTo / (60 * 60)));
+        m_relativeTimeValidUntil = now + 60 * 60 - secsTo % (60 * 60);
+    } else {
+        if (daysTo < 7) {
+            m_relativeTime = i18n("%1d", qCeil(daysTo));
+        } else if (daysTo < 365) {
+            const auto weeksTo = qCeil(daysTo / 7);
+            if (weeksTo < 5) {
+                m_relativeTime = i18np("1 week ago", "%1 weeks ago", weeksTo);
+            } else {
+                const auto monthsTo = qCeil(daysTo / 30);
+                m_relativeTime = i18np("1 month ago", "%1 months ago", monthsTo);
+            }
         } else {
-            const auto monthsTo = qCeil(daysTo / 30);
-            return i18np("1 month ago", "%1 months ago", monthsTo);
+            const auto yearsTo = qCeil(daysTo / 365);
+            m_relativeTime = i18np("1 year ago", "%1 years ago", yearsTo);
         }
-    } else {
-        const auto yearsTo = qCeil(daysTo / 365);
-        return i18np("1 year ago", "%1 years ago", yearsTo);
+        m_relativeTimeValidUntil = now + 60;
     }
+
+    return m_relativeTime;
 }
 
 QString Post::absoluteTime() const
 {
-    return QLocale::system().toString(publishedAt(), QLocale::LongFormat);
+    if (m_absoluteTime.isEmpty()) {
+        m_absoluteTime = QLocale::system().toString(publishedAt(), QLocale::LongFormat);
+    }
+    return m_absoluteTime;
 }
 
 std::shared_ptr<Identity> Post::authorIdentity() const
@@ -254,6 +286,11 @@ QString Post::content() const
     return m_content;
 }
 
+const QString &Post::contentKey() const
+{
+    return m_contentKey;
+}
+
 bool Post::hasContent() const
 {
     return m_hasContent;
@@ -329,9 +366,18 @@ Poll *Post::poll() const
     return m_poll.get();
 }
 
+QVariant Post::pollValue() const
+{
+    if (m_poll && !m_pollValue.isValid()) {
+        m_pollValue = QVariant::fromValue<Poll>(*m_poll);
+    }
+    return m_pollValue;
+}
+
 void Post::setPollJson(const QJsonObject &object)
 {
     m_poll = std::make_unique<Poll>(object);
+    m_pollValue.clear();
     Q_EMIT pollChanged();
 }
 
@@ -459,7 +505,8 @@ Identity *Post::getAuthorIdentity() const
 
 QQmlListProperty<Attachment> Post::attachmentList() const
 {
-    return m_attachmentList;
+    // Created when asked for, instead of stored in every post
+    return QQmlListProperty<Attachment>(const_cast<Post *>(this), const_cast<QList<Attachment *> *>(&m_attachments));
 }
 
 Card *Post::getCard() const
@@ -530,95 +577,109 @@ void Post::processContent(const QJsonObject &obj)
 
     m_hasContent = !standaloneContent.isEmpty();
     m_content = standaloneContent;
+
+    // Hashing the content catches edits, no matter which copy of the post they were loaded into
+    m_contentKey = m_postId.toString() + u'/' + QString::number(qHash(m_content), 16);
 }
 
 Card::Card(QJsonObject card)
-    : m_card(card)
-{
+    : m_authorName(card["author_name"_L1].toString())
+    , m_authorUrl(card["author_url"_L1].toString())
+    , m_blurhash(card["blurhash"_L1].toString())
+    , m_description(card["description"_L1].toString())
+    , m_embedUrl(card["embed_url"_L1].toString())
+    , m_html(card["html"_L1].toString())
+    , m_image(card["image"_L1].toString())
+    , m_providerUrl(card["provider_url"_L1].toString())
+    , m_title(card["title"_L1].toString().trimmed())
+    , m_url(QUrl::fromUserInput(card["url"_L1].toString()))
+    , m_width(card["width"_L1].toInt())
+    , m_height(card["height"_L1].toInt())
+{
+    // Cards from the same site repeat the same provider name, so they share it
+    const auto providerName = card["provider_name"_L1].toString();
+    m_providerName = StringPool::intern(providerName.isEmpty() ? m_url.host() : providerName);
 }
 
 QString Card::authorName() const
 {
-    return m_card[QLatin1String("author_name")].toString();
+    return m_authorName;
 }
 
 QString Card::authorUrl() const
 {
-    return m_card[QLatin1String("author_url")].toString();
+    return m_authorUrl;
 }
 
 QString Card::blurhash() const
 {
-    return m_card[QLatin1String("blurhash")].toString();
+    return m_blurhash;
 }
 
 QString Card::description() const
 {
-    return m_card[QLatin1String("description")].toString();
+    return m_description;
 }
 
 QString Card::embedUrl() const
 {
-    return m_card[QLatin1String("embed_url")].toString();
+    return m_embedUrl;
 }
 
 int Card::width() const
 {
-    return m_card[QLatin1String("weight")].toInt();
+    return m_width;
 }
 
 int Card::height() const
 {
-    return m_card[QLatin1String("height")].toInt();
+    return m_height;
 }
 
 QString Card::html() const
 {
-    return m_card[QLatin1String("html")].toString();
+    return m_html;
 }
 
 QString Card::image() const
 {
-    return m_card[QLatin1String("image")].toString();
+    return m_image;
 }
 
 QString Card::providerName() const
 {
-    const auto providerName = m_card[QLatin1String("provider_name")].toString();
-    if (!providerName.isEmpty()) {
-        return providerName;
-    }
-    return url().host();
+    return m_providerName;
 }
 
 QString Card::providerUrl() const
 {
-    return m_card[QLatin1String("provider_url")].toString();
+    return m_providerUrl;
 }
 
 QString Card::title() const
 {
-    return m_card[QLatin1String("title")].toString().trimmed();
+    return m_title;
 }
 
 QUrl Card::url() const
 {
-    return QUrl::fromUserInput(m_card[QLatin1String("url")].toString());
+    return m_url;
 }
 
 Application::Application(QJsonObject application)
-    : m_application(application)
+    : m_name(StringPool::intern(application["name"_L1].toString()))
+    , m_website(QUrl::fromUserInput(application["website"_L1].toString()))
 {
 }
 
 QString Application::name() const
 {
-    return m_application[QLatin1String("name")].toString();
+    return m_name;
 }
 
 QUrl Application::website() const
 {
-    return QUrl::fromUserInput(m_application[QLatin1String("website")].toString());
+    return m_website;
 }
 
 #include "moc_post.cpp"
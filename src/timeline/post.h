@@ -7,6 +7,7 @@
 
 #include "timeline/attachment.h"
 #include "timeline/poll.h"
+#include "utils/entityid.h"
 
 #include <QImage>
 
@@ -14,6 +15,9 @@ class Post;
 class Identity;
 class AbstractAccount;
 
+/**
+ * @brief The application a post was sent from, parsed once from its JSON.
+ */
 class Application
 {
     Q_GADGET
@@ -29,9 +33,13 @@ public:
     QUrl website() const;
 
 private:
-    QJsonObject m_application;
+    QString m_name;
+    QUrl m_website;
 };
 
+/**
+ * @brief A preview card for a link in a post, parsed once from its JSON.
+ */
 class Card
 {
     Q_GADGET
@@ -69,7 +77,19 @@ public:
     QUrl url() const;
 
 private:
-    QJsonObject m_card;
+    QString m_authorName;
+    QString m_authorUrl;
+    QString m_blurhash;
+    QString m_description;
+    QString m_embedUrl;
+    QString m_html;
+    QString m_image;
+    QString m_providerName;
+    QString m_providerUrl;
+    QString m_title;
+    QUrl m_url;
+    int m_width = 0;
+    int m_height = 0;
 };
 
 /**
@@ -127,13 +147,23 @@ public:
     /**
      * @return This post's id.
      * @note The id may be different because it was boosted. This is the id of the parent post.
-     * @sa originalPostId()
+     * @sa originalId()
+     */
+    EntityId id() const;
+
+    /**
+     * @return The post's original id if boosted, but identical to id if not.
+     * @sa id()
+     */
+    EntityId originalId() const;
+
+    /**
+     * @return The string form of id(), for use in URLs and QML.
      */
     QString postId() const;
 
     /**
-     * @return The post's original id if boosted, but identical to postId if not.
-     * @sa postId()
+     * @return The string form of originalId(), for use in URLs and QML.
      */
     QString originalPostId() const;
 
@@ -144,11 +174,13 @@ public:
 
     /**
      * @return A locale-aware relative time when the post was published.
+     * @note This is cached until the text would change, so it's cheap to call repeatedly.
      */
     QString relativeTime() const;
 
     /**
      * @return A absolute locale-aware time when the post was published.
+     * @note This is formatted once and then cached.
      */
     QString absoluteTime() const;
 
@@ -162,6 +194,11 @@ public:
      */
     QString content() const;
 
+    /**
+     * @return A key that's different for every version of content(), for caching what's made from it.
+     */
+    const QString &contentKey() const;
+
     /**
      * @return If the post has any text content.
      * @note Use this instead of checking the length of content() because it could contain useless HTML code.
@@ -244,6 +281,11 @@ public:
      */
     Poll *poll() const;
 
+    /**
+     * @return The poll on this post as a QVariant for models, or an invalid one if there is no poll. It's only copied again when the poll changes.
+     */
+    QVariant pollValue() const;
+
     /**
      * @brief Sets the poll on this post from JSON @p object.
      */
@@ -386,15 +428,13 @@ private:
     AbstractAccount *const m_parent;
 
     QDateTime m_publishedAt;
-    QString m_postId;
-    QString m_originalPostId;
+    EntityId m_postId;
+    EntityId m_originalPostId;
     QUrl m_url;
     QString m_content;
+    QString m_contentKey;
     bool m_hasContent;
     QString m_spoilerText;
-    QString m_author;
-    QString m_reply_to_author;
-    QString m_content_type;
     QStringList m_mentions;
     QString m_language;
     QDateTime m_editedAt;
@@ -407,9 +447,14 @@ private:
     std::optional<Application> m_application;
     std::shared_ptr<Identity> m_authorIdentity;
     QList<Attachment *> m_attachments;
-    QQmlListProperty<Attachment> m_attachmentList;
     std::unique_ptr<Poll> m_poll;
 
+    // Derived values models ask for constantly while scrolling
+    mutable QString m_relativeTime;
+    mutable qint64 m_relativeTimeValidUntil = 0; // In seconds since the epoch
+    mutable QString m_absoluteTime;
+    mutable QVariant m_pollValue;
+
     bool m_sensitive = false;
     Visibility m_visibility;
 
@@ -4,8 +4,14 @@
 
 #include "timeline/threadmodel.h"
 
+#include "account/prefetchcache.h"
+#include "account/statusindex.h"
+
 #include <KLocalizedString>
 
+#include <algorithm>
+#include <optional>
+
 using namespace Qt::Literals::StringLiterals;
 
 ThreadModel::ThreadModel(QObject *parent)
@@ -20,16 +26,33 @@ QVariant ThreadModel::data(const QModelIndex &index, int role) const
         return {};
     }
 
-    if (role == SelectedRole) {
+    switch (role) {
+    case SelectedRole:
         return m_postId == TimelineModel::data(index, IdRole).toString();
-    } else if (role == IsThreadReplyRole) {
-        // This prevents ancestors from being accidentally considered
-        const bool isReplyAfterRootPost = index.row() > m_rootPostIndex;
-        const bool isReplyToRootPost = m_postId != m_timeline[index.row()]->inReplyTo();
-
-        return isReplyAfterRootPost && isReplyToRootPost;
-    } else if (role == IsLastThreadReplyRole) {
-        return !data(ThreadModel::index(index.row() + 1, index.column()), IsThreadReplyRole).toBool();
+    case IsThreadReplyRole: {
+        const Node *node = nodeAt(index.row());
+        return node != nullptr && node->threadReply;
+    }
+    case IsLastThreadReplyRole: {
+        // This depends on the next post that's shown, which skips over collapsed replies
+        const Node *next = nodeAt(index.row() + 1);
+        return next == nullptr || !next->threadReply;
+    }
+    case ThreadDepthRole: {
+        const Node *node = nodeAt(index.row());
+        return node != nullptr ? node->depth : 0;
+    }
+    case CollapsedRepliesRole: {
+        const Node *node = nodeAt(index.row());
+        return node != nullptr && node->collapsed ? node->subtreeSize - 1 : 0;
+    }
+    case CollapsibleRepliesRole: {
+        // The selected post and its ancestors are what the thread is about, so only replies can be collapsed
+        const Node *node = nodeAt(index.row());
+        return node != nullptr && !node->collapsed && node->depth > 0 ? node->subtreeSize - 1 : 0;
+    }
+    default:
+        break;
     }
 
     return TimelineModel::data(index, role);
@@ -37,10 +60,10 @@ QVariant ThreadModel::data(const QModelIndex &index, int role) const
 
 QString ThreadModel::displayName() const
 {
-    if (m_timeline.isEmpty()) {
+    if (m_nodes.empty()) {
         return i18nc("@title:window", "Loading…");
     }
-    auto post = m_timeline.at(m_rootPostIndex);
+    auto post = m_nodes[m_rootPostIndex].post;
 
     // FIXME: the inline page title can be HTML, but this is currently synced as the window title. hence why we're not using the HTML version here...
     return i18nc("@title", "Post by %1", post->authorIdentity()->displayName());
@@ -62,6 +85,16 @@ void ThreadModel::setPostId(const QString &postId)
     fillTimeline();
 }
 
+void ThreadModel::prefetch(AbstractAccount *account, const QString &postId)
+{
+    if (account == nullptr || postId.isEmpty()) {
+        return;
+    }
+
+    account->prefetchCache()->prefetch(account->apiUrl(QStringLiteral("/api/v1/statuses/%1").arg(postId)));
+    account->prefetchCache()->prefetch(account->apiUrl(QStringLiteral("/api/v1/statuses/%1/context").arg(postId)));
+}
+
 QString ThreadModel::postUrl() const
 {
     return m_postUrl;
@@ -83,74 +116,362 @@ void ThreadModel::fillTimeline(const QString &fromId)
 
     const auto statusUrl = m_account->apiUrl(QStringLiteral("/api/v1/statuses/%1").arg(m_postId));
     const auto contextUrl = m_account->apiUrl(QStringLiteral("/api/v1/statuses/%1/context").arg(m_postId));
-    auto thread = std::make_shared<QList<Post *>>();
 
-    auto handleError = [this](QNetworkReply *reply) {
+    // Both are requested at once, and the thread is built when the second one arrives
+    struct PendingThread {
+        Post *status = nullptr;
+        std::optional<QJsonObject> context;
+        bool failed = false;
+    };
+    auto pending = std::make_shared<PendingThread>();
+
+    auto handleError = [this, pending](QNetworkReply *reply) {
         Q_UNUSED(reply);
-        setLoading(false);
+        if (!pending->failed) {
+            pending->failed = true;
+            setLoading(false);
+        }
     };
 
-    auto onFetchContext = [=](QNetworkReply *reply) {
-        const auto data = reply->readAll();
-        const auto doc = QJsonDocument::fromJson(data);
-        const auto obj = doc.object();
+    auto buildWhenReady = [this, pending] {
+        if (!pending->failed && pending->status != nullptr && pending->context.has_value()) {
+            buildThread(pending->status, *pending->context);
+        }
+    };
 
+    auto onFetchStatus = [=](const QByteArray &data) {
+        const auto doc = QJsonDocument::fromJson(data);
         if (!doc.isObject()) {
+            handleError(nullptr);
             return;
         }
 
-        auto ancestors = obj["ancestors"_L1].toArray().toVariantList();
-        std::reverse(ancestors.begin(), ancestors.end());
+        pending->status = new Post(m_account, doc.object(), this);
+        m_account->statusIndex()->add(QJsonArray{doc.object()});
 
-        const auto descendents = obj["descendants"_L1].toArray();
+        m_postUrl = pending->status->url().toString();
+        Q_EMIT postUrlChanged();
 
-        // If the root post has a non-zero reply count but no context from the server, it's possible that some replies are not available to us.
-        if (descendents.isEmpty() && thread->front()->repliesCount() != 0) {
-            m_hasHiddenReplies = true;
-            Q_EMIT hasHiddenRepliesChanged();
+        buildWhenReady();
+    };
+
+    auto onFetchContext = [=](const QByteArray &data) {
+        const auto doc = QJsonDocument::fromJson(data);
+        if (!doc.isObject()) {
+            handleError(nullptr);
+            return;
         }
 
-        m_rootPostIndex = ancestors.size();
+        pending->context = doc.object();
+        m_account->statusIndex()->add(doc.object()["ancestors"_L1].toArray());
+        m_account->statusIndex()->add(doc.object()["descendants"_L1].toArray());
+        buildWhenReady();
+    };
 
-        for (const auto &ancestor : ancestors) {
-            if (ancestor.canConvert<QJsonObject>() || ancestor.canConvert<QVariantMap>()) {
-                thread->push_front(new Post(m_account, ancestor.toJsonObject(), this));
-            }
+    // Either may have been prefetched already, see prefetch()
+    m_account->prefetchCache()->get(statusUrl, this, onFetchStatus, handleError);
+    m_account->prefetchCache()->get(contextUrl, this, onFetchContext, handleError);
+}
+
+void ThreadModel::buildThread(Post *status, const QJsonObject &context)
+{
+    const auto ancestors = context["ancestors"_L1].toArray();
+    const auto descendants = context["descendants"_L1].toArray();
+
+    // If the root post has a non-zero reply count but no context from the server, it's possible that some replies are not available to us.
+    if (descendants.isEmpty() && status->repliesCount() != 0) {
+        m_hasHiddenReplies = true;
+        Q_EMIT hasHiddenRepliesChanged();
+    }
+
+    std::vector<Node> nodes;
+    nodes.reserve(ancestors.size() + 1 + descendants.size());
+
+    // Ancestors come oldest first, each one replying to the one before it
+    for (const auto &ancestor : ancestors) {
+        if (!ancestor.isObject()) {
+            continue;
         }
 
-        for (const auto &descendent : descendents) {
-            if (!descendent.isObject()) {
-                continue;
-            }
+        Node node;
+        node.post = new Post(m_account, ancestor.toObject(), this);
+        node.parent = static_cast<int>(nodes.size()) - 1;
+        nodes.push_back(node);
+    }
 
-            thread->push_back(new Post(m_account, descendent.toObject(), this));
+    m_rootPostIndex = static_cast<qsizetype>(nodes.size());
+    for (qsizetype i = 0; i < m_rootPostIndex; i++) {
+        nodes[i].depth = static_cast<int>(i - m_rootPostIndex);
+    }
+
+    Node root;
+    root.post = status;
+    root.parent = static_cast<int>(m_rootPostIndex) - 1;
+    nodes.push_back(root);
+
+    QList<Post *> replies;
+    replies.reserve(descendants.size());
+    QHash<EntityId, qsizetype> replyIndex;
+    for (const auto &descendant : descendants) {
+        if (!descendant.isObject()) {
+            continue;
         }
 
-        beginResetModel();
-        m_timeline = *thread;
-        endResetModel();
-        setLoading(false);
+        auto post = new Post(m_account, descendant.toObject(), this);
+        replyIndex.insert(post->id(), replies.size());
+        replies.push_back(post);
+    }
 
-        Q_EMIT nameChanged(); // update title
+    // Replies to posts we don't have are shown as replies to the selected post, the last entry is for it
+    const qsizetype rootEntry = replies.size();
+    QList<QList<qsizetype>> children(replies.size() + 1);
+    for (qsizetype i = 0; i < replies.size(); i++) {
+        qsizetype parent = replyIndex.value(EntityId(replies[i]->inReplyTo()), rootEntry);
+        if (parent == i) {
+            parent = rootEntry;
+        }
+        children[parent].push_back(i);
+    }
+
+    const auto addReply = [this, &nodes, &replies](qsizetype entry, int parent) {
+        Node node;
+        node.post = replies[entry];
+        node.parent = parent;
+        node.depth = nodes[parent].depth + 1;
+        node.threadReply = node.post->inReplyTo() != m_postId;
+        nodes.push_back(node);
+        return static_cast<int>(nodes.size()) - 1;
     };
 
-    auto onFetchStatus = [=](QNetworkReply *reply) {
-        const auto data = reply->readAll();
-        const auto doc = QJsonDocument::fromJson(data);
-        const auto obj = doc.object();
+    // Walk the tree depth-first without recursing, as threads can be arbitrarily deep
+    std::vector<bool> visited(replies.size(), false);
+    std::vector<std::pair<qsizetype, int>> stack;
+    for (auto it = children[rootEntry].crbegin(); it != children[rootEntry].crend(); ++it) {
+        stack.emplace_back(*it, static_cast<int>(m_rootPostIndex));
+    }
+    while (!stack.empty()) {
+        const auto [entry, parent] = stack.back();
+        stack.pop_back();
+        visited[entry] = true;
+
+        const int node = addReply(entry, parent);
+        for (auto it = children[entry].crbegin(); it != children[entry].crend(); ++it) {
+            stack.emplace_back(*it, node);
+        }
+    }
 
-        if (!doc.isObject()) {
-            return;
+    // Only replies that form a loop are left, which can't happen unless the server is confused
+    for (qsizetype i = 0; i < replies.size(); i++) {
+        if (!visited[i]) {
+            addReply(i, static_cast<int>(m_rootPostIndex));
+        }
+    }
+
+    // Parents always come before their replies
+    for (auto i = static_cast<qsizetype>(nodes.size()) - 1; i > 0; i--) {
+        if (nodes[i].parent >= 0) {
+            nodes[nodes[i].parent].subtreeSize += nodes[i].subtreeSize;
         }
-        thread->push_front(new Post(m_account, obj, this));
+    }
 
-        m_postUrl = thread->front()->url().toString();
-        Q_EMIT postUrlChanged();
+    if (replies.size() > collapseThreshold) {
+        for (auto &node : nodes) {
+            node.collapsed = node.parent == m_rootPostIndex && node.depth == 1 && node.subtreeSize > 1;
+        }
+    }
 
-        m_account->get(contextUrl, true, this, onFetchContext, handleError);
-    };
+    beginResetModel();
+    m_nodes = std::move(nodes);
+    m_nodeIndex.clear();
+    m_nodeIndex.reserve(static_cast<qsizetype>(m_nodes.size()));
+    for (int i = 0; i < static_cast<int>(m_nodes.size()); i++) {
+        m_nodeIndex.insert(m_nodes[i].post, i);
+    }
 
-    m_account->get(statusUrl, true, this, onFetchStatus, handleError);
+    m_timeline.clear();
+    for (qsizetype i = 0; i <= m_rootPostIndex; i++) {
+        m_timeline.push_back(m_nodes[i].post);
+    }
+    m_timeline.append(visibleReplies(static_cast<int>(m_rootPostIndex)));
+    endResetModel();
+    setLoading(false);
+
+    Q_EMIT nameChanged(); // update title
+}
+
+const ThreadModel::Node *ThreadModel::nodeAt(int row) const
+{
+    if (row < 0 || row >= m_timeline.size()) {
+        return nullptr;
+    }
+
+    const auto it = m_nodeIndex.constFind(m_timeline[row]);
+    return it != m_nodeIndex.constEnd() ? &m_nodes[*it] : nullptr;
+}
+
+QList<Post *> ThreadModel::visibleReplies(int node) const
+{
+    QList<Post *> posts;
+
+    const int end = node + m_nodes[node].subtreeSize;
+    for (int i = node + 1; i < end;) {
+        posts.push_back(m_nodes[i].post);
+        i += m_nodes[i].collapsed ? m_nodes[i].subtreeSize : 1;
+    }
+
+    return posts;
+}
+
+void ThreadModel::collapseReplies(int row)
+{
+    const Node *node = nodeAt(row);
+    if (node == nullptr || node->collapsed || node->subtreeSize == 1) {
+        return;
+    }
+
+    const int nodeIndex = m_nodeIndex.value(node->post);
+    const int end = nodeIndex + node->subtreeSize;
+
+    // Replies directly follow the post, up until the first one that's not in its subtree
+    int count = 0;
+    while (row + 1 + count < m_timeline.size()) {
+        const int next = m_nodeIndex.value(m_timeline[row + 1 + count], -1);
+        if (next <= nodeIndex || next >= end) {
+            break;
+        }
+        count++;
+    }
+
+    m_nodes[nodeIndex].collapsed = true;
+    if (count > 0) {
+        beginRemoveRows({}, row + 1, row + count);
+        m_timeline.remove(row + 1, count);
+        endRemoveRows();
+    }
+
+    Q_EMIT dataChanged(index(row, 0), index(row, 0), {CollapsedRepliesRole, CollapsibleRepliesRole, IsLastThreadReplyRole});
+}
+
+void ThreadModel::expandReplies(int row)
+{
+    const Node *node = nodeAt(row);
+    if (node == nullptr || !node->collapsed) {
+        return;
+    }
+
+    const int nodeIndex = m_nodeIndex.value(node->post);
+    m_nodes[nodeIndex].collapsed = false;
+
+    const auto replies = visibleReplies(nodeIndex);
+    if (!replies.isEmpty()) {
+        beginInsertRows({}, row + 1, row + static_cast<int>(replies.size()));
+        m_timeline.insert(row + 1, replies.size(), nullptr);
+        std::copy(replies.cbegin(), replies.cend(), m_timeline.begin() + row + 1);
+        endInsertRows();
+    }
+
+    Q_EMIT dataChanged(index(row, 0), index(row, 0), {CollapsedRepliesRole, CollapsibleRepliesRole, IsLastThreadReplyRole});
+}
+
+void ThreadModel::handleEvent(AbstractAccount::StreamingEventType eventType, const QByteArray &payload)
+{
+    // The deleted post may be hidden in a collapsed subtree, so look for it among all of them
+    if (eventType == AbstractAccount::StreamingEventType::DeleteEvent) {
+        const EntityId id(QString::fromUtf8(payload));
+        const auto it = std::find_if(m_nodes.cbegin(), m_nodes.cend(), [&id](const Node &node) {
+            return node.post->originalId() == id;
+        });
+        if (it != m_nodes.cend()) {
+            removePost(it->post);
+        }
+        return;
+    }
+
+    TimelineModel::handleEvent(eventType, payload);
+}
+
+void ThreadModel::removePost(Post *post)
+{
+    const auto it = m_nodeIndex.constFind(post);
+    if (it == m_nodeIndex.cend()) {
+        TimelineModel::removePost(post);
+        return;
+    }
+    const int nodeIndex = *it;
+
+    // Without the selected post, there's no thread left to show
+    if (nodeIndex == m_rootPostIndex) {
+        reset();
+        Q_EMIT nameChanged();
+        return;
+    }
+
+    const Node removed = m_nodes[nodeIndex];
+    const int end = nodeIndex + removed.subtreeSize;
+
+    // Its replies move up to its parent, like the server shows them once it's gone
+    for (int i = nodeIndex + 1; i < end; i++) {
+        if (m_nodes[i].parent == nodeIndex) {
+            m_nodes[i].parent = removed.parent;
+        }
+        if (nodeIndex > m_rootPostIndex) {
+            m_nodes[i].depth--;
+        }
+    }
+    // Ancestors are counted back from the selected post, which is now one closer
+    if (nodeIndex < m_rootPostIndex) {
+        for (int i = 0; i < nodeIndex; i++) {
+            m_nodes[i].depth++;
+        }
+        m_rootPostIndex--;
+    }
+    for (int parent = removed.parent; parent >= 0; parent = m_nodes[parent].parent) {
+        m_nodes[parent].subtreeSize--;
+    }
+
+    m_nodes.erase(m_nodes.begin() + nodeIndex);
+    for (auto &node : m_nodes) {
+        if (node.parent > nodeIndex) {
+            node.parent--;
+        }
+    }
+
+    m_nodeIndex.clear();
+    for (int i = 0; i < static_cast<int>(m_nodes.size()); i++) {
+        m_nodeIndex.insert(m_nodes[i].post, i);
+    }
+
+    const int row = static_cast<int>(m_timeline.indexOf(post));
+    if (row >= 0) {
+        beginRemoveRows({}, row, row);
+        m_timeline.removeAt(row);
+        endRemoveRows();
+
+        // Replies that were collapsed below it have nothing left to be hidden under
+        if (removed.collapsed) {
+            QList<Post *> replies;
+            for (int i = nodeIndex; i < end - 1;) {
+                replies.push_back(m_nodes[i].post);
+                i += m_nodes[i].collapsed ? m_nodes[i].subtreeSize : 1;
+            }
+
+            if (!replies.isEmpty()) {
+                beginInsertRows({}, row, row + static_cast<int>(replies.size()) - 1);
+                m_timeline.insert(row, replies.size(), nullptr);
+                std::copy(replies.cbegin(), replies.cend(), m_timeline.begin() + row);
+                endInsertRows();
+            }
+        }
+    }
+
+    // Collapsed ancestors now hide one reply less, and the depth of its replies changed
+    if (!m_timeline.isEmpty()) {
+        Q_EMIT dataChanged(index(0, 0),
+                           index(static_cast<int>(m_timeline.size()) - 1, 0),
+                           {CollapsedRepliesRole, CollapsibleRepliesRole, IsLastThreadReplyRole, ThreadDepthRole});
+    }
+
+    post->deleteLater();
 }
 
 bool ThreadModel::canFetchMore(const QModelIndex &parent) const
@@ -161,19 +482,22 @@ bool ThreadModel::canFetchMore(const QModelIndex &parent) const
 
 int ThreadModel::getRootIndex() const
 {
-    for (int i = 0; i < rowCount({}); i++) {
-        if (data(index(i, 0), SelectedRole).toBool()) {
-            return i;
-        }
+    if (m_nodes.empty()) {
+        return -1;
     }
 
-    return -1;
+    // Ancestors are never collapsed, so this is only ever a few rows in
+    return static_cast<int>(m_timeline.indexOf(m_nodes[m_rootPostIndex].post));
 }
 
 void ThreadModel::reset()
 {
     beginResetModel();
-    qDeleteAll(m_timeline);
+    for (const auto &node : m_nodes) {
+        delete node.post;
+    }
+    m_nodes.clear();
+    m_nodeIndex.clear();
     m_timeline.clear();
     endResetModel();
 }
@@ -36,6 +36,12 @@ public:
      */
     void setPostId(const QString &postId);
 
+    /**
+     * @brief Starts loading the thread of @p postId ahead of time, so it's filled right away once it's opened.
+     * @see PrefetchCache
+     */
+    static void prefetch(AbstractAccount *account, const QString &postId);
+
     /**
      * @return The original post url of the "root" post of the thread.
      */
@@ -43,6 +49,8 @@ public:
 
     QVariant data(const QModelIndex &index, int role) const override;
 
+    void handleEvent(AbstractAccount::StreamingEventType eventType, const QByteArray &payload) override;
+
     QString displayName() const override;
     void fillTimeline(const QString &fromId = QString()) override;
     bool canFetchMore(const QModelIndex &parent) const override;
@@ -64,15 +72,52 @@ public:
      */
     bool hasHiddenReplies() const;
 
+    /**
+     * @brief Hides the replies below the post at @p row.
+     * @see expandReplies()
+     */
+    Q_INVOKABLE void collapseReplies(int row);
+
+    /**
+     * @brief Shows the replies below the post at @p row again, except for ones that were collapsed themselves.
+     * @see collapseReplies()
+     */
+    Q_INVOKABLE void expandReplies(int row);
+
+    /**
+     * @brief Threads with more replies than this start out with only the direct replies to the selected post expanded.
+     */
+    static constexpr int collapseThreshold = 200;
+
 Q_SIGNALS:
     void postIdChanged();
     void postUrlChanged();
     void hasHiddenRepliesChanged();
 
+protected:
+    void removePost(Post *post) override;
+
 private:
+    // A post in the thread, which are kept in depth-first order so every post's replies directly follow it
+    struct Node {
+        Post *post = nullptr;
+        int parent = -1;
+        int depth = 0;
+        int subtreeSize = 1; // Including the post itself
+        bool threadReply = false;
+        bool collapsed = false;
+    };
+
+    void buildThread(Post *status, const QJsonObject &context);
+    const Node *nodeAt(int row) const;
+    QList<Post *> visibleReplies(int node) const;
+
     QString m_postId, m_postUrl;
     bool m_hasHiddenReplies = false;
     qsizetype m_rootPostIndex = 0;
 
+    std::vector<Node> m_nodes;
+    QHash<const Post *, int> m_nodeIndex;
+
     friend class TimelineTest;
 };
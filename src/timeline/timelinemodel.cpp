@@ -4,6 +4,10 @@
 
 #include "timeline/timelinemodel.h"
 
+#include "account/statusindex.h"
+
+#include <algorithm>
+
 using namespace Qt::Literals::StringLiterals;
 
 TimelineModel::TimelineModel(QObject *parent)
@@ -79,6 +83,8 @@ void TimelineModel::fetchedTimeline(const QByteArray &data, bool alwaysAppendToE
         return;
     }
 
+    m_account->statusIndex()->add(array);
+
     std::transform(array.cbegin(), array.cend(), std::back_inserter(posts), [this](const QJsonValue &value) -> Post * {
         auto post = new Post(m_account, value.toObject(), this);
         if (!post->hidden()) {
@@ -109,7 +115,7 @@ void TimelineModel::fetchedTimeline(const QByteArray &data, bool alwaysAppendToE
         } else {
             const auto postOld = m_timeline.first();
             const auto postNew = posts.first();
-            if (postOld->originalPostId() > postNew->originalPostId()) {
+            if (postOld->originalId() > postNew->originalId()) {
                 const int row = m_timeline.size();
                 const int last = row + posts.size() - 1;
                 beginInsertRows({}, row, last);
@@ -258,6 +264,16 @@ void TimelineModel::actionDelete(const QModelIndex &index)
 
     AbstractTimelineModel::actionDelete(index, p);
 
+    removePost(p);
+}
+
+void TimelineModel::removePost(Post *post)
+{
+    const int row = static_cast<int>(m_timeline.indexOf(post));
+    if (row < 0) {
+        return;
+    }
+
     beginRemoveRows({}, row, row);
     m_timeline.removeAt(row);
     endRemoveRows();
@@ -266,15 +282,12 @@ void TimelineModel::actionDelete(const QModelIndex &index)
 void TimelineModel::handleEvent(AbstractAccount::StreamingEventType eventType, const QByteArray &payload)
 {
     if (eventType == AbstractAccount::StreamingEventType::DeleteEvent) {
-        int i = 0;
-        for (const auto &post : std::as_const(m_timeline)) {
-            if (post->originalPostId().toUtf8() == payload) {
-                beginRemoveRows({}, i, i);
-                m_timeline.removeAt(i);
-                endRemoveRows();
-                break;
-            }
-            i++;
+        const EntityId id(QString::fromUtf8(payload));
+        const auto it = std::find_if(m_timeline.cbegin(), m_timeline.cend(), [&id](const Post *post) {
+            return post->originalId() == id;
+        });
+        if (it != m_timeline.cend()) {
+            removePost(*it);
         }
     }
 }
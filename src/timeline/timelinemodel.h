@@ -113,6 +113,11 @@ protected:
     bool canFetchMore(const QModelIndex &parent) const override;
     void fetchedTimeline(const QByteArray &array, bool alwaysAppendToEnd = false);
 
+    /**
+     * @brief Removes @p post from the timeline, after it was deleted.
+     */
+    virtual void removePost(Post *post);
+
     AccountManager *m_manager = nullptr;
 
     QList<Post *> m_timeline;
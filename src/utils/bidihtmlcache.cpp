@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "utils/bidihtmlcache.h"
+
+#include "utils/texthandler.h"
+
+#include <algorithm>
+
+BidiHtmlCache::BidiHtmlCache(QObject *parent)
+    : QObject(parent)
+{
+    // Posts become ready in the order they're shown, one thread is enough to keep up and keeps the rest free for images
+    m_pool.setMaxThreadCount(1);
+
+    m_readyTimer.setInterval(0);
+    m_readyTimer.setSingleShot(true);
+    connect(&m_readyTimer, &QTimer::timeout, this, [this] {
+        Q_EMIT ready(std::exchange(m_ready, {}));
+    });
+}
+
+BidiHtmlCache &BidiHtmlCache::instance()
+{
+    static BidiHtmlCache cache;
+    return cache;
+}
+
+std::optional<QString> BidiHtmlCache::html(const QString &key, const QString &html, const QFont &font)
+{
+    if (font != m_font) {
+        m_font = font;
+        m_generation++;
+        m_cache.clear();
+        m_pending.clear();
+    }
+
+    if (const QString *cached = m_cache.object(key)) {
+        return *cached;
+    }
+
+    if (html.size() <= synchronousLength) {
+        const QString fixed = TextHandler::fixBidirectionality(html, font);
+        m_cache.insert(key, new QString(fixed), std::max<qsizetype>(fixed.size(), 1));
+        return fixed;
+    }
+
+    if (!m_pending.contains(key)) {
+        m_pending.insert(key);
+        m_pool.start([this, key, html, font, generation = m_generation] {
+            const QString fixed = TextHandler::fixBidirectionality(html, font);
+            QMetaObject::invokeMethod(
+                this,
+                [this, key, fixed, generation] {
+                    if (generation == m_generation) {
+                        insert(key, fixed);
+                    }
+                },
+                Qt::QueuedConnection);
+        });
+    }
+
+    return std::nullopt;
+}
+
+bool BidiHtmlCache::contains(const QString &key) const
+{
+    return m_pending.contains(key) || m_cache.contains(key);
+}
+
+void BidiHtmlCache::insert(const QString &key, const QString &html)
+{
+    m_pending.remove(key);
+    // Capped, so even a huge post stays cached instead of being computed over and over
+    m_cache.insert(key, new QString(html), std::clamp<qsizetype>(html.size(), 1, m_cache.maxCost()));
+
+    m_ready.push_back(key);
+    if (!m_readyTimer.isActive()) {
+        m_readyTimer.start();
+    }
+}
+
+#include "moc_bidihtmlcache.cpp"
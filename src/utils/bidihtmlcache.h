@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QCache>
+#include <QFont>
+#include <QObject>
+#include <QSet>
+#include <QStringList>
+#include <QThreadPool>
+#include <QTimer>
+
+#include <optional>
+
+/**
+ * @brief Caches the output of TextHandler::fixBidirectionality(), which is computed in the background for longer HTML.
+ *
+ * Round-tripping HTML through a QTextDocument is too slow to do on the GUI thread for every delegate that's created while scrolling.
+ */
+class BidiHtmlCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    /**
+     * @brief HTML up to this many characters is fixed right away, since that's quicker than laying out the delegate again once it's ready.
+     */
+    static constexpr qsizetype synchronousLength = 300;
+
+    explicit BidiHtmlCache(QObject *parent = nullptr);
+
+    static BidiHtmlCache &instance();
+
+    /**
+     * @return The fixed HTML for @p key if it's ready, or if @p html is short enough to be fixed right away. Otherwise it's computed from @p html in the
+     * background, ready() is emitted once it's cached, and std::nullopt is returned.
+     * @note @p key has to change whenever @p html does. Everything cached is forgotten once another @p font is asked for, so it doesn't have to be part of it.
+     */
+    std::optional<QString> html(const QString &key, const QString &html, const QFont &font);
+
+    /**
+     * @return If the fixed HTML for @p key is pending or cached.
+     */
+    bool contains(const QString &key) const;
+
+Q_SIGNALS:
+    /**
+     * @brief Emitted when the fixed HTML for @p keys is cached. Keys that are ready around the same time are emitted together.
+     */
+    void ready(const QStringList &keys);
+
+private:
+    void insert(const QString &key, const QString &html);
+
+    QCache<QString, QString> m_cache{4 * 1024 * 1024}; // in characters
+    QSet<QString> m_pending;
+    QFont m_font;
+    quint64 m_generation = 0; // Changes with the font, so results made with the old one are dropped
+
+    QStringList m_ready;
+    QTimer m_readyTimer;
+
+    // Declared last, so running jobs are waited on before anything else goes away
+    QThreadPool m_pool;
+};
@@ -7,8 +7,19 @@
 #include <array>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <stdexcept>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define BLURHASH_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define BLURHASH_NEON
+#endif
+
 #ifdef DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #if __has_include(<doctest.h>)
 #include <doctest.h>
@@ -110,24 +121,20 @@ encodeMaxAC(float maxAC) noexcept
 }
 
 float
-srgbToLinear(int value) noexcept
+srgbToLinearF(float x) noexcept
 {
-        auto srgbToLinearF = [](float x) {
-                if (x <= 0.0f)
-                        return 0.0f;
-                else if (x >= 1.0f)
-                        return 1.0f;
-                else if (x < 0.04045f)
-                        return x / 12.92f;
-                else
-                        return std::pow((x + 0.055f) / 1.055f, 2.4f);
-        };
-
-        return srgbToLinearF(static_cast<float>(value) / 255.f);
+        if (x <= 0.0f)
+                return 0.0f;
+        else if (x >= 1.0f)
+                return 1.0f;
+        else if (x < 0.04045f)
+                return x / 12.92f;
+        else
+                return std::pow((x + 0.055f) / 1.055f, 2.4f);
 }
 
 int
-linearToSrgb(float value) noexcept
+linearToSrgbExact(float value) noexcept
 {
         auto linearToSrgbF = [](float x) -> float {
                 if (x <= 0.0f)
@@ -143,6 +150,90 @@ linearToSrgb(float value) noexcept
         return int(linearToSrgbF(value) * 255.f + 0.5f);
 }
 
+float
+srgbToLinear(int value) noexcept
+{
+        static const auto table = []() {
+                std::array<float, 256> t{};
+                for (int i = 0; i < 256; i++)
+                        t[i] = srgbToLinearF(static_cast<float>(i) / 255.f);
+                return t;
+        }();
+
+        return table[std::clamp(value, 0, 255)];
+}
+
+// Lookup tables for linearToSrgb, giving bit-identical results to linearToSrgbExact without
+// calling std::pow per channel. The coarse table gives the sRGB value at the start of each
+// bucket, and since the curve never rises by more than one step within a bucket, the thresholds
+// table then bumps it up to the exact result with at most a comparison or two.
+struct SrgbEncodeTable
+{
+        static constexpr int buckets = 4096;
+
+        // thresholds[v] is the smallest linear value that encodes to at least v.
+        std::array<float, 257> thresholds;
+        std::array<unsigned char, buckets + 1> coarse;
+};
+
+const SrgbEncodeTable &
+srgbEncodeTable() noexcept
+{
+        static const SrgbEncodeTable table = []() {
+                SrgbEncodeTable t{};
+
+                // Binary search over the bit patterns of positive floats, which sort like integers.
+                auto bits = [](float f) {
+                        uint32_t u;
+                        std::memcpy(&u, &f, sizeof(u));
+                        return u;
+                };
+                auto fromBits = [](uint32_t u) {
+                        float f;
+                        std::memcpy(&f, &u, sizeof(f));
+                        return f;
+                };
+
+                t.thresholds[0] = 0.f;
+                for (int v = 1; v < 256; v++) {
+                        uint32_t lo = bits(0.f), hi = bits(1.f);
+                        while (lo < hi) {
+                                const uint32_t mid = lo + (hi - lo) / 2;
+                                if (linearToSrgbExact(fromBits(mid)) >= v)
+                                        hi = mid;
+                                else
+                                        lo = mid + 1;
+                        }
+                        t.thresholds[v] = fromBits(lo);
+                }
+                t.thresholds[256] = std::numeric_limits<float>::infinity();
+
+                for (int i = 0; i <= SrgbEncodeTable::buckets; i++)
+                        t.coarse[i] = static_cast<unsigned char>(
+                          linearToSrgbExact(static_cast<float>(i) / SrgbEncodeTable::buckets));
+
+                return t;
+        }();
+
+        return table;
+}
+
+int
+linearToSrgb(float value) noexcept
+{
+        if (!(value > 0.0f))
+                return 0;
+        if (value >= 1.0f)
+                return 255;
+
+        const auto &table = srgbEncodeTable();
+        // value * buckets is exact, so this never lands in a bucket past the value
+        int v = table.coarse[static_cast<int>(value * SrgbEncodeTable::buckets)];
+        while (value >= table.thresholds[v + 1])
+                v++;
+        return v;
+}
+
 struct Color
 {
         float r, g, b;
@@ -242,26 +333,53 @@ bases_for(size_t dimension, size_t components)
         }
         return bases;
 }
+
+// Same as bases_for, but component-major so that all values for one component are contiguous.
+std::vector<float>
+component_bases_for(size_t dimension, size_t components)
+{
+        std::vector<float> bases(dimension * components, 0.f);
+        auto scale = M_PI / float(dimension);
+        for (size_t nx = 0; nx < size_t(components); nx++) {
+                for (size_t x = 0; x < dimension; x++) {
+                        bases[nx * dimension + x] = std::cos(scale * float(nx * x));
+                }
+        }
+        return bases;
 }
 
-namespace blurhash {
-Image
-decode(std::string_view blurhash, size_t width, size_t height, size_t bytesPerPixel) noexcept
+// out[i] += basis[i] * factor, for a whole row of one colour channel.
+void
+accumulate(float *out, const float *basis, float factor, size_t count) noexcept
 {
-        Image i{};
+        size_t i = 0;
+#if defined(BLURHASH_SSE2)
+        const __m128 f = _mm_set1_ps(factor);
+        for (; i + 4 <= count; i += 4)
+                _mm_storeu_ps(out + i,
+                              _mm_add_ps(_mm_loadu_ps(out + i), _mm_mul_ps(_mm_loadu_ps(basis + i), f)));
+#elif defined(BLURHASH_NEON)
+        const float32x4_t f = vdupq_n_f32(factor);
+        for (; i + 4 <= count; i += 4)
+                vst1q_f32(out + i, vaddq_f32(vld1q_f32(out + i), vmulq_f32(vld1q_f32(basis + i), f)));
+#endif
+        for (; i < count; i++)
+                out[i] += basis[i] * factor;
+}
 
+bool
+decodeValues(std::string_view blurhash, Components &components, std::vector<Color> &values) noexcept
+{
         if (blurhash.size() < 10)
-                return i;
+                return false;
 
-        Components components{};
-        std::vector<Color> values;
         values.reserve(blurhash.size() / 2);
         try {
                 components = unpackComponents(decode83(blurhash.substr(0, 1)));
 
                 if (components.x < 1 || components.y < 1 ||
                     blurhash.size() != size_t(1 + 1 + 4 + (components.x * components.y - 1) * 2))
-                        return {};
+                        return false;
 
                 auto maxAC    = decodeMaxAC(blurhash.substr(1, 1));
                 Color average = decodeDC(blurhash.substr(2, 4));
@@ -270,41 +388,104 @@ decode(std::string_view blurhash, size_t width, size_t height, size_t bytesPerPi
                 for (size_t c = 6; c < blurhash.size(); c += 2)
                         values.push_back(decodeAC(blurhash.substr(c, 2), maxAC));
         } catch (std::invalid_argument &) {
-                return {};
+                return false;
         }
 
-        i.image = decltype(i.image)(height * width * bytesPerPixel, 255);
+        return true;
+}
+
+// Evaluates the blurhash and calls writeRow(y, r, g, b) with the linear colour of every row.
+//
+// The basis functions are separable, so instead of summing all x * y components per pixel we
+// first collapse the vertical components into one colour per horizontal component for the
+// current row, and then only have to sum the horizontal components per pixel.
+template<typename RowWriter>
+bool
+decodeRows(std::string_view blurhash, size_t width, size_t height, RowWriter &&writeRow) noexcept
+{
+        Components components{};
+        std::vector<Color> values;
+        if (!decodeValues(blurhash, components, values))
+                return false;
+
+        const auto componentsX = size_t(components.x);
+        const auto componentsY = size_t(components.y);
 
-        std::vector<float> basis_x = bases_for(width, components.x);
-        std::vector<float> basis_y = bases_for(height, components.y);
+        const std::vector<float> basis_x = component_bases_for(width, componentsX);
+        const std::vector<float> basis_y = bases_for(height, componentsY);
+
+        std::vector<Color> rowValues(componentsX);
+        std::vector<float> r(width), g(width), b(width);
 
         for (size_t y = 0; y < height; y++) {
-                for (size_t x = 0; x < width; x++) {
+                for (size_t nx = 0; nx < componentsX; nx++) {
                         Color c{};
+                        for (size_t ny = 0; ny < componentsY; ny++)
+                                c += values[nx + ny * componentsX] * basis_y[y * componentsY + ny];
+                        rowValues[nx] = c;
+                }
 
-                        for (size_t nx = 0; nx < size_t(components.x); nx++) {
-                                for (size_t ny = 0; ny < size_t(components.y); ny++) {
-                                        float basis = basis_x[x * components.x + nx] *
-                                                      basis_y[y * components.y + ny];
-                                        c += values[nx + ny * components.x] * basis;
-                                }
-                        }
+                std::fill(r.begin(), r.end(), 0.f);
+                std::fill(g.begin(), g.end(), 0.f);
+                std::fill(b.begin(), b.end(), 0.f);
 
-                        i.image[(y * width + x) * bytesPerPixel + 0] =
-                          static_cast<unsigned char>(linearToSrgb(c.r));
-                        i.image[(y * width + x) * bytesPerPixel + 1] =
-                          static_cast<unsigned char>(linearToSrgb(c.g));
-                        i.image[(y * width + x) * bytesPerPixel + 2] =
-                          static_cast<unsigned char>(linearToSrgb(c.b));
+                for (size_t nx = 0; nx < componentsX; nx++) {
+                        const float *basis = basis_x.data() + nx * width;
+                        accumulate(r.data(), basis, rowValues[nx].r, width);
+                        accumulate(g.data(), basis, rowValues[nx].g, width);
+                        accumulate(b.data(), basis, rowValues[nx].b, width);
                 }
+
+                writeRow(y, r.data(), g.data(), b.data());
         }
 
+        return true;
+}
+}
+
+namespace blurhash {
+Image
+decode(std::string_view blurhash, size_t width, size_t height, size_t bytesPerPixel) noexcept
+{
+        Image i{};
+        i.image = decltype(i.image)(height * width * bytesPerPixel, 255);
+
+        const bool valid =
+          decodeRows(blurhash, width, height, [&](size_t y, const float *r, const float *g, const float *b) {
+                  unsigned char *pixel = i.image.data() + y * width * bytesPerPixel;
+                  for (size_t x = 0; x < width; x++, pixel += bytesPerPixel) {
+                          pixel[0] = static_cast<unsigned char>(linearToSrgb(r[x]));
+                          pixel[1] = static_cast<unsigned char>(linearToSrgb(g[x]));
+                          pixel[2] = static_cast<unsigned char>(linearToSrgb(b[x]));
+                  }
+          });
+
+        if (!valid)
+                return {};
+
         i.height = height;
         i.width  = width;
 
         return i;
 }
 
+bool
+decodeRgb32(std::string_view blurhash,
+            size_t width,
+            size_t height,
+            uint32_t *pixels,
+            size_t pixelsPerLine) noexcept
+{
+        return decodeRows(
+          blurhash, width, height, [&](size_t y, const float *r, const float *g, const float *b) {
+                  uint32_t *line = pixels + y * pixelsPerLine;
+                  for (size_t x = 0; x < width; x++) {
+                          line[x] = 0xff000000u | (uint32_t(linearToSrgb(r[x])) << 16) |
+                                    (uint32_t(linearToSrgb(g[x])) << 8) | uint32_t(linearToSrgb(b[x]));
+                  }
+          });
+}
+
 std::string
 encode(unsigned char *image, size_t width, size_t height, int components_x, int components_y)
 {
@@ -3,7 +3,9 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace blurhash {
@@ -17,6 +19,15 @@ struct Image
 Image
 decode(std::string_view blurhash, size_t width, size_t height, size_t bytesPerPixel = 3) noexcept;
 
+// Decode a blurhash directly into 0xffRRGGBB pixels (the layout of QImage::Format_RGB32) with size
+// width*height. pixelsPerLine is the stride of the destination. Returns false if the hash is invalid.
+bool
+decodeRgb32(std::string_view blurhash,
+            size_t width,
+            size_t height,
+            uint32_t *pixels,
+            size_t pixelsPerLine) noexcept;
+
 // Encode an image of rgb pixels (without padding) with size width*height into a blurhash with x*y
 // components
 std::string
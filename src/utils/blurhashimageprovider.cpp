@@ -5,85 +5,133 @@
 
 #include "utils/blurhash.hpp"
 
+#include <QPromise>
+
 /*
  * Qt unfortunately re-encodes the base83 string in QML.
  * The only special ASCII characters used in the blurhash base83 string are:
  * #$%*+,-.:;=?@[]^_{|}~
  * QUrl::fromPercentEncoding is too greedy, and spits out invalid characters
- * for parts of valid base83 like %14.
+ * for parts of valid base83 like %14, so only the escapes QML produces for
+ * these characters are decoded.
  */
-// clang-format off
-static const QMap<QLatin1String, QLatin1String> knownEncodings = {
-    {QLatin1String("%23A"), QLatin1String(":")},
-    {QLatin1String("%3F"), QLatin1String("?")},
-    {QLatin1String("%23"), QLatin1String("#")},
-    {QLatin1String("%5B"), QLatin1String("[")},
-    {QLatin1String("%5D"), QLatin1String("]")},
-    {QLatin1String("%40"), QLatin1String("@")},
-    {QLatin1String("%24"), QLatin1String("$")},
-    {QLatin1String("%2A"), QLatin1String("*")},
-    {QLatin1String("%2B"), QLatin1String("+")},
-    {QLatin1String("%2C"), QLatin1String(",")},
-    {QLatin1String("%2D"), QLatin1String("-")},
-    {QLatin1String("%2E"), QLatin1String(".")},
-    {QLatin1String("%3D"), QLatin1String("=")},
-    {QLatin1String("%25"), QLatin1String("%")},
-    {QLatin1String("%5E"), QLatin1String("^")},
-    {QLatin1String("%7C"), QLatin1String("|")},
-    {QLatin1String("%7B"), QLatin1String("{")},
-    {QLatin1String("%7D"), QLatin1String("}")},
-    {QLatin1String("%7E"), QLatin1String("~")},
-};
-// clang-format on
-
-class AsyncImageResponseRunnable : public QObject, public QRunnable
+static bool isEncodedBase83Character(char c)
 {
-    Q_OBJECT
-
-Q_SIGNALS:
-    void done(QImage image);
-
-public:
-    AsyncImageResponseRunnable(const QString &id, const QSize &requestedSize)
-        : m_id(id)
-        , m_requestedSize(requestedSize)
-    {
-        if (m_requestedSize.width() == -1) {
-            m_requestedSize.setWidth(64);
-        }
-        if (m_requestedSize.height() == -1) {
-            m_requestedSize.setHeight(64);
-        }
+    switch (c) {
+    case ':':
+    case '?':
+    case '#':
+    case '[':
+    case ']':
+    case '@':
+    case '$':
+    case '*':
+    case '+':
+    case ',':
+    case '-':
+    case '.':
+    case '=':
+    case '%':
+    case '^':
+    case '|':
+    case '{':
+    case '}':
+    case '~':
+        return true;
+    default:
+        return false;
     }
+}
 
-    void run() override
-    {
-        if (m_id.isEmpty()) {
-            return;
-        }
+static int hexValue(char16_t c)
+{
+    if (c >= u'0' && c <= u'9') {
+        return c - u'0';
+    }
+    if (c >= u'A' && c <= u'F') {
+        return c - u'A' + 10;
+    }
+    if (c >= u'a' && c <= u'f') {
+        return c - u'a' + 10;
+    }
+    return -1;
+}
 
-        QString decodedId = m_id;
+QByteArray BlurhashImageProvider::decodeId(QStringView id)
+{
+    QByteArray decoded;
+    decoded.reserve(id.size());
+
+    for (qsizetype i = 0; i < id.size(); ++i) {
+        const char16_t c = id[i].unicode();
+        if (c == u'%' && i + 2 < id.size()) {
+            const int high = hexValue(id[i + 1].unicode());
+            const int low = hexValue(id[i + 2].unicode());
+            if (high >= 0 && low >= 0) {
+                const char escaped = static_cast<char>(high << 4 | low);
+                if (isEncodedBase83Character(escaped)) {
+                    decoded.append(escaped);
+                    i += 2;
+                    continue;
+                }
+            }
+        }
+        decoded.append(static_cast<char>(c));
+    }
 
-        QMap<QLatin1String, QLatin1String>::const_iterator i;
-        for (i = knownEncodings.constBegin(); i != knownEncodings.constEnd(); ++i)
-            decodedId.replace(i.key(), i.value());
+    return decoded;
+}
 
-        auto data = blurhash::decode(decodedId.toLatin1().constData(), m_requestedSize.width(), m_requestedSize.height());
-        QImage image(data.image.data(), static_cast<int>(data.width), static_cast<int>(data.height), static_cast<int>(data.width * 3), QImage::Format_RGB888);
+QFuture<QImage> BlurhashCache::image(const QByteArray &hash, const QSize &size, QThreadPool *pool)
+{
+    Key key{hash, size};
 
-        Q_EMIT done(image.convertToFormat(QImage::Format_RGB32));
+    QMutexLocker locker(&m_mutex);
+    if (const QImage *image = m_images.object(key)) {
+        return QtFuture::makeReadyValueFuture(*image);
+    }
+    if (const auto pending = m_pending.constFind(key); pending != m_pending.constEnd()) {
+        return *pending;
     }
 
-private:
-    QString m_id;
-    QSize m_requestedSize;
-};
+    auto promise = std::make_shared<QPromise<QImage>>();
+    QFuture<QImage> future = promise->future();
+    promise->start();
+    m_pending.insert(key, future);
+
+    pool->start([this, key = std::move(key), promise] {
+        QImage image(key.size, QImage::Format_RGB32);
+        if (!blurhash::decodeRgb32(std::string_view(key.hash.constData(), key.hash.size()),
+                                   key.size.width(),
+                                   key.size.height(),
+                                   reinterpret_cast<uint32_t *>(image.bits()),
+                                   image.bytesPerLine() / sizeof(uint32_t))) {
+            image = {};
+        }
+
+        {
+            QMutexLocker locker(&m_mutex);
+            if (!image.isNull()) {
+                const auto cost = std::max<qsizetype>(1, image.sizeInBytes() / 1024);
+                m_images.insert(key, new QImage(image), cost);
+            }
+            m_pending.remove(key);
+        }
+
+        promise->addResult(std::move(image));
+        promise->finish();
+    });
+
+    return future;
+}
 
-AsyncImageResponse::AsyncImageResponse(const QString &id, const QSize &requestedSize, QThreadPool *pool)
+AsyncImageResponse::AsyncImageResponse(const QFuture<QImage> &future)
 {
-    auto runnable = new AsyncImageResponseRunnable(id, requestedSize);
-    connect(runnable, &AsyncImageResponseRunnable::done, this, &AsyncImageResponse::handleDone);
-    pool->start(runnable);
+    // The watcher reports through the event loop even for finished futures, so QML has connected to finished() by then
+    connect(&m_watcher, &QFutureWatcher<QImage>::finished, this, [this] {
+        handleDone(m_watcher.result());
+    });
+    m_watcher.setFuture(future);
 }
 
 void AsyncImageResponse::handleDone(QImage image)
@@ -99,7 +147,17 @@ QQuickTextureFactory *AsyncImageResponse::textureFactory() const
 
 QQuickImageResponse *BlurhashImageProvider::requestImageResponse(const QString &id, const QSize &requestedSize)
 {
-    return new AsyncImageResponse(id, requestedSize, &pool);
-}
+    if (id.isEmpty()) {
+        return new AsyncImageResponse(QtFuture::makeReadyValueFuture(QImage()));
+    }
 
-#include "blurhashimageprovider.moc"
+    QSize size = requestedSize;
+    if (size.width() == -1) {
+        size.setWidth(64);
+    }
+    if (size.height() == -1) {
+        size.setHeight(64);
+    }
+
+    return new AsyncImageResponse(m_cache.image(decodeId(id), size, &pool));
+}
@@ -3,16 +3,57 @@
 
 #pragma once
 
+#include <QCache>
+#include <QFuture>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QMutex>
 #include <QQuickAsyncImageProvider>
 #include <QThreadPool>
 
 class AsyncImageResponse final : public QQuickImageResponse
 {
 public:
-    AsyncImageResponse(const QString &id, const QSize &requestedSize, QThreadPool *pool);
+    explicit AsyncImageResponse(const QFuture<QImage> &future);
     void handleDone(QImage image);
     QQuickTextureFactory *textureFactory() const override;
     QImage m_image;
+
+private:
+    QFutureWatcher<QImage> m_watcher;
+};
+
+/**
+ * @brief Decoded blurhash placeholders, keyed by hash and size.
+ *
+ * Concurrent requests for the same placeholder share a single decode.
+ */
+class BlurhashCache
+{
+public:
+    /**
+     * @return A future for the placeholder of @p hash at @p size, which is already finished when it's cached.
+     */
+    QFuture<QImage> image(const QByteArray &hash, const QSize &size, QThreadPool *pool);
+
+private:
+    struct Key {
+        QByteArray hash;
+        QSize size;
+
+        bool operator==(const Key &other) const
+        {
+            return hash == other.hash && size == other.size;
+        }
+    };
+    friend size_t qHash(const Key &key, size_t seed = 0) noexcept
+    {
+        return qHashMulti(seed, key.hash, key.size.width(), key.size.height());
+    }
+
+    QMutex m_mutex;
+    QCache<Key, QImage> m_images{8 * 1024}; // in KiB
+    QHash<Key, QFuture<QImage>> m_pending;
 };
 
 class BlurhashImageProvider : public QQuickAsyncImageProvider
@@ -20,6 +61,13 @@ class BlurhashImageProvider : public QQuickAsyncImageProvider
 public:
     QQuickImageResponse *requestImageResponse(const QString &id, const QSize &requestedSize) override;
 
+    /**
+     * @brief Undoes the percent-encoding QML applies to the image id, returning the raw base83 blurhash.
+     */
+    static QByteArray decodeId(QStringView id);
+
 private:
+    BlurhashCache m_cache;
+    // Declared after the cache, so running decodes are waited on before the cache goes away
     QThreadPool pool;
 };
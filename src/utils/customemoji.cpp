@@ -3,17 +3,20 @@
 
 #include "utils/customemoji.h"
 
+#include "utils/stringpool.h"
+
 QList<CustomEmoji> CustomEmoji::parseCustomEmojis(const QJsonArray &json)
 {
     QList<CustomEmoji> emojis;
+    emojis.reserve(json.size());
     for (auto emojiObj : json) {
         if (!emojiObj.isObject()) {
             continue;
         }
 
         CustomEmoji customEmoji{};
-        customEmoji.shortcode = emojiObj[QStringLiteral("shortcode")].toString();
-        customEmoji.url = emojiObj[QStringLiteral("static_url")].toString();
+        customEmoji.shortcode = StringPool::intern(emojiObj[QStringLiteral("shortcode")].toString());
+        customEmoji.url = StringPool::intern(emojiObj[QStringLiteral("static_url")].toString());
 
         emojis.push_back(customEmoji);
     }
@@ -21,4 +24,4 @@ QList<CustomEmoji> CustomEmoji::parseCustomEmojis(const QJsonArray &json)
     return emojis;
 }
 
-#include "moc_customemoji.cpp"
\ No newline at end of file
+#include "moc_customemoji.cpp"
@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#include "utils/customemojiimageprovider.h"
+
+#include "network/networkaccessmanagerfactory.h"
+#include "tokodon_debug.h"
+#include "utils/blurhashimageprovider.h"
+
+#include <QBuffer>
+#include <QImageReader>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+
+using namespace Qt::StringLiterals;
+
+constexpr auto idEncoding = QByteArray::Base64UrlEncoding | QByteArray::OmitTrailingEquals;
+
+CustomEmojiImageProvider::CustomEmojiImageProvider()
+    : m_nam(NetworkAccessManagerFactory().create(this))
+{
+}
+
+CustomEmojiImageProvider::~CustomEmojiImageProvider()
+{
+    // Aborting the downloads still reports them as finished, which needs everything else to be around
+    delete m_nam;
+}
+
+QQuickImageResponse *CustomEmojiImageProvider::requestImageResponse(const QString &id, const QSize &requestedSize)
+{
+    Q_UNUSED(requestedSize)
+
+    const QUrl url = decodeId(id);
+    if (!url.isValid()) {
+        return new AsyncImageResponse(QtFuture::makeReadyValueFuture(QImage()));
+    }
+
+    return new AsyncImageResponse(image(url));
+}
+
+QString CustomEmojiImageProvider::imageSource(const QString &url)
+{
+    // Encoded so QML doesn't mangle the URL when passing it back as an id
+    return u"image://customemoji/"_s + QString::fromLatin1(url.toUtf8().toBase64(idEncoding));
+}
+
+QUrl CustomEmojiImageProvider::decodeId(QStringView id)
+{
+    const auto decoded = QByteArray::fromBase64Encoding(id.toLatin1(), idEncoding | QByteArray::AbortOnBase64DecodingErrors);
+    if (!decoded) {
+        return {};
+    }
+
+    // Don't let rich text read arbitrary local files through us
+    QUrl url(QString::fromUtf8(*decoded));
+    if (url.scheme() != "https"_L1 && url.scheme() != "http"_L1) {
+        return {};
+    }
+
+    return url;
+}
+
+QFuture<QImage> CustomEmojiImageProvider::image(const QUrl &url)
+{
+    QMutexLocker locker(&m_mutex);
+    if (const QImage *image = m_images.object(url)) {
+        return QtFuture::makeReadyValueFuture(*image);
+    }
+    if (const auto pending = m_pending.constFind(url); pending != m_pending.constEnd()) {
+        return (*pending)->future();
+    }
+
+    auto promise = std::make_shared<QPromise<QImage>>();
+    promise->start();
+    m_pending.insert(url, promise);
+    locker.unlock();
+
+    // Image responses are requested from QML's loader thread, but the network access manager lives in ours
+    QMetaObject::invokeMethod(
+        this,
+        [this, url] {
+            download(url);
+        },
+        Qt::QueuedConnection);
+
+    return promise->future();
+}
+
+void CustomEmojiImageProvider::download(const QUrl &url)
+{
+    auto reply = m_nam->get(QNetworkRequest(url));
+    connect(reply, &QNetworkReply::finished, this, [this, reply, url] {
+        reply->deleteLater();
+
+        if (reply->error() != QNetworkReply::NoError) {
+            qCDebug(TOKODON_LOG) << "Failed to download custom emoji" << url << reply->errorString();
+            decode(url, {});
+            return;
+        }
+
+        m_pool.start([this, url, data = reply->readAll()] {
+            decode(url, data);
+        });
+    });
+}
+
+void CustomEmojiImageProvider::decode(const QUrl &url, const QByteArray &data)
+{
+    QImage image;
+    if (!data.isEmpty()) {
+        QBuffer buffer;
+        buffer.setData(data);
+
+        QImageReader reader(&buffer);
+        if (reader.size().isValid()) {
+            const QSize size = reader.size();
+            if (size.width() > maximumSize || size.height() > maximumSize) {
+                reader.setScaledSize(size.scaled(maximumSize, maximumSize, Qt::KeepAspectRatio));
+            }
+        }
+        image = reader.read();
+    }
+
+    std::shared_ptr<QPromise<QImage>> promise;
+    {
+        QMutexLocker locker(&m_mutex);
+        // Failures aren't cached, so the emoji is tried again the next time it's shown
+        if (!image.isNull()) {
+            const auto cost = std::max<qsizetype>(1, image.sizeInBytes() / 1024);
+            m_images.insert(url, new QImage(image), cost);
+        }
+        promise = m_pending.take(url);
+    }
+
+    if (promise) {
+        promise->addResult(std::move(image));
+        promise->finish();
+    }
+}
@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+#pragma once
+
+#include <QCache>
+#include <QFuture>
+#include <QHash>
+#include <QMutex>
+#include <QPromise>
+#include <QQuickAsyncImageProvider>
+#include <QThreadPool>
+#include <QUrl>
+
+class QNetworkAccessManager;
+
+/**
+ * @brief Loads custom emoji for rich text, sharing one decoded copy of each between every post that uses it.
+ *
+ * Rich text loads each <img> separately, so a post full of custom emoji would otherwise download and decode every one of them, while scrolling.
+ * Here they're decoded once at a small size and kept in memory, and concurrent requests for the same emoji share a single download.
+ */
+class CustomEmojiImageProvider : public QQuickAsyncImageProvider
+{
+public:
+    CustomEmojiImageProvider();
+    ~CustomEmojiImageProvider() override;
+
+    /**
+     * @brief The largest size emoji are decoded at, which is enough for high DPI screens.
+     */
+    static constexpr int maximumSize = 64;
+
+    QQuickImageResponse *requestImageResponse(const QString &id, const QSize &requestedSize) override;
+
+    /**
+     * @return The image source to use for the custom emoji at @p url.
+     */
+    static QString imageSource(const QString &url);
+
+    /**
+     * @return The emoji URL encoded in the image id @p id, or an invalid URL if it isn't a web URL.
+     */
+    static QUrl decodeId(QStringView id);
+
+    /**
+     * @return A future for the decoded emoji at @p url, which is already finished when it's cached.
+     */
+    QFuture<QImage> image(const QUrl &url);
+
+private:
+    void download(const QUrl &url);
+    void decode(const QUrl &url, const QByteArray &data);
+
+    QNetworkAccessManager *m_nam = nullptr;
+
+    QMutex m_mutex;
+    QCache<QUrl, QImage> m_images{16 * 1024}; // in KiB
+    QHash<QUrl, std::shared_ptr<QPromise<QImage>>> m_pending;
+
+    // Declared last, so running decodes are waited on before anything else goes away
+    QThreadPool m_pool;
+};
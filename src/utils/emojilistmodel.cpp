@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "utils/emojilistmodel.h"
+
+#include "utils/customemoji.h"
+#include "utils/emojimodel.h"
+
+EmojiListModel::EmojiListModel(const EmojiData *emojis, qsizetype count, QObject *parent)
+    : QAbstractListModel(parent)
+    , m_emojis(emojis)
+    , m_count(count)
+{
+}
+
+EmojiListModel::EmojiListModel(QVariantList emojis, QObject *parent)
+    : QAbstractListModel(parent)
+    , m_count(emojis.size())
+    , m_values(std::move(emojis))
+{
+}
+
+int EmojiListModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : static_cast<int>(m_count);
+}
+
+QVariant EmojiListModel::data(const QModelIndex &index, int role) const
+{
+    if (!checkIndex(index, CheckIndexOption::IndexIsValid)) {
+        return {};
+    }
+
+    if (m_emojis != nullptr) {
+        const EmojiData &emoji = m_emojis[index.row()];
+        switch (role) {
+        case UnicodeRole:
+            return QString::fromUtf8(emoji.unicode);
+        case ShortNameRole:
+            return QString::fromUtf8(emoji.shortName);
+        case DescriptionRole:
+            return QString::fromUtf8(emoji.description);
+        case IsCustomRole:
+            return false;
+        }
+
+        return {};
+    }
+
+    const QVariant &value = m_values[index.row()];
+    if (value.metaType() == QMetaType::fromType<CustomEmoji>()) {
+        const auto emoji = value.value<CustomEmoji>();
+        switch (role) {
+        case UnicodeRole:
+            return emoji.url;
+        case ShortNameRole:
+            return emoji.shortcode;
+        case DescriptionRole:
+            return QString();
+        case IsCustomRole:
+            return true;
+        }
+
+        return {};
+    }
+
+    const auto emoji = value.value<Emoji>();
+    switch (role) {
+    case UnicodeRole:
+        return emoji.unicode;
+    case ShortNameRole:
+        return emoji.shortName;
+    case DescriptionRole:
+        return emoji.description;
+    case IsCustomRole:
+        return emoji.isCustom;
+    }
+
+    return {};
+}
+
+QHash<int, QByteArray> EmojiListModel::roleNames() const
+{
+    return {
+        {UnicodeRole, QByteArrayLiteral("unicode")},
+        {ShortNameRole, QByteArrayLiteral("shortName")},
+        {DescriptionRole, QByteArrayLiteral("description")},
+        {IsCustomRole, QByteArrayLiteral("isCustom")},
+    };
+}
+
+#include "moc_emojilistmodel.cpp"
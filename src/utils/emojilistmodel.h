@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QAbstractListModel>
+#include <QtQml>
+
+/**
+ * @brief A built-in emoji, as stored in the generated tables. All strings are UTF-8.
+ * @see tools/update-emojis.py
+ */
+struct EmojiData {
+    const char *unicode;
+    const char *shortName;
+    const char *description;
+};
+
+/**
+ * @brief A list of emoji for the emoji picker.
+ *
+ * Built-in emoji are wrapped directly from their static tables, so their strings are only created for the rows that are actually shown. Anything else
+ * (search results, history and custom emoji) is stored as a list of Emoji or CustomEmoji.
+ */
+class EmojiListModel : public QAbstractListModel
+{
+    Q_OBJECT
+    QML_ELEMENT
+    QML_UNCREATABLE("Access via EmojiModel")
+
+public:
+    /**
+     * @brief Custom roles for this model.
+     */
+    enum CustomRoles {
+        UnicodeRole = Qt::UserRole + 1, /**< The emoji itself, or the image URL of a custom emoji. */
+        ShortNameRole, /**< The short name of the emoji, e.g. "grinning". */
+        DescriptionRole, /**< A description of the emoji, empty for custom emoji. */
+        IsCustomRole, /**< Whether this is a custom emoji. */
+    };
+
+    /**
+     * @brief Wraps the @p count emoji at @p emojis, which must outlive the model.
+     */
+    explicit EmojiListModel(const EmojiData *emojis, qsizetype count, QObject *parent = nullptr);
+
+    /**
+     * @brief Wraps a list of Emoji or CustomEmoji.
+     */
+    explicit EmojiListModel(QVariantList emojis, QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+private:
+    const EmojiData *m_emojis = nullptr;
+    qsizetype m_count = 0;
+    QVariantList m_values;
+};
@@ -7,86 +7,198 @@
 #include <KLocalizedString>
 
 #include "account/abstractaccount.h"
+#include "utils/emojilistmodel.h"
+#include "utils/emojisearchindex.h"
 #include "utils/emojitones.h"
 
 using namespace Qt::Literals::StringLiterals;
 
-QHash<EmojiModel::Category, QVariantList> EmojiModel::_emojis;
+namespace
+{
+#include "utils/emojis.h"
+
+constexpr EmojiModel::Category builtinCategories[] = {EmojiModel::Smileys,
+                                                      EmojiModel::People,
+                                                      EmojiModel::Nature,
+                                                      EmojiModel::Food,
+                                                      EmojiModel::Activities,
+                                                      EmojiModel::Travel,
+                                                      EmojiModel::Objects,
+                                                      EmojiModel::Symbols,
+                                                      EmojiModel::Flags,
+                                                      EmojiModel::Component};
+}
+
+QHash<AbstractAccount *, QStringList> EmojiModel::_history;
+QHash<AbstractAccount *, std::shared_ptr<EmojiSearchIndex>> EmojiModel::_customIndexes;
 
 EmojiModel::EmojiModel(QObject *parent)
     : QObject(parent)
 {
-    if (_emojis.isEmpty()) {
-#include "utils/emojis.h"
-    }
 }
 
-QVariantList EmojiModel::filterModel(AbstractAccount *account, const QString &filter)
+EmojiListModel *EmojiModel::filterModel(AbstractAccount *account, const QString &filter)
 {
-    return filterCustomModel(account, filter) + filterModelNoCustom(filter);
+    const QStringList &recent = cachedHistory(account);
+    const QSet<QString> boosted(recent.cbegin(), recent.cend());
+
+    return new EmojiListModel(filterCustomModel(account, filter, boosted) + filterModelNoCustom(filter, boosted));
 }
 
-QVariantList EmojiModel::emojis(AbstractAccount *account, Category category) const
+EmojiListModel *EmojiModel::emojis(AbstractAccount *account, Category category)
 {
     if (category == History) {
         QVariantList list;
-        for (const auto &historicEmoji : history(account)) {
-            for (const auto &emojiCategory : _emojis) {
-                for (const auto &emoji : emojiCategory) {
-                    if (qvariant_cast<Emoji>(emoji).shortName == historicEmoji) {
-                        list.append(emoji);
-                    }
-                }
+        for (const auto &historicEmoji : cachedHistory(account)) {
+            if (const auto emoji = index().find(historicEmoji); emoji.isValid()) {
+                list.append(emoji);
             }
-
-            for (const auto &customEmoji : filterCustomModel(account, {})) {
-                if (qvariant_cast<CustomEmoji>(customEmoji).shortcode == historicEmoji) {
+            if (account != nullptr) {
+                if (const auto customEmoji = customIndex(account).find(historicEmoji); customEmoji.isValid()) {
                     list.append(customEmoji);
                 }
             }
         }
 
-        return list;
+        return new EmojiListModel(std::move(list));
     } else if (category == Custom) {
-        return filterCustomModel(account, {});
+        return new EmojiListModel(filterCustomModel(account, {}));
     }
 
-    return _emojis[category];
+    // Switching categories only swaps the model, the emoji themselves are never copied
+    auto &model = m_categoryModels[category];
+    if (model == nullptr) {
+        const auto [data, count] = builtinEmojis(category);
+        model = new EmojiListModel(data, count, this);
+    }
+
+    return model;
 }
 
-QVariantList EmojiModel::tones(const QString &baseEmoji) const
+std::pair<const EmojiData *, qsizetype> EmojiModel::builtinEmojis(Category category)
 {
-    if (baseEmoji.endsWith("tone"_L1)) {
-        return EmojiTones::_tones.values(baseEmoji.split(":"_L1)[0]);
+    switch (category) {
+    case Smileys:
+        return {smileysEmojis, std::size(smileysEmojis)};
+    case People:
+        return {peopleEmojis, std::size(peopleEmojis)};
+    case Nature:
+        return {natureEmojis, std::size(natureEmojis)};
+    case Food:
+        return {foodEmojis, std::size(foodEmojis)};
+    case Activities:
+        return {activitiesEmojis, std::size(activitiesEmojis)};
+    case Travel:
+        return {travelEmojis, std::size(travelEmojis)};
+    case Objects:
+        return {objectsEmojis, std::size(objectsEmojis)};
+    case Symbols:
+        return {symbolsEmojis, std::size(symbolsEmojis)};
+    case Flags:
+        return {flagsEmojis, std::size(flagsEmojis)};
+    case Component:
+        return {componentEmojis, std::size(componentEmojis)};
+    default:
+        return {nullptr, 0};
     }
+}
 
-    return EmojiTones::_tones.values(baseEmoji);
+const EmojiSearchIndex &EmojiModel::index()
+{
+    static const EmojiSearchIndex index = [] {
+        EmojiSearchIndex index;
+        // Keep the category order, so results are sorted like the picker
+        for (const auto category : builtinCategories) {
+            const auto [data, count] = builtinEmojis(category);
+            for (qsizetype i = 0; i < count; i++) {
+                const Emoji emoji(QString::fromUtf8(data[i].unicode), QString::fromUtf8(data[i].shortName), QString::fromUtf8(data[i].description));
+                index.add(emoji.shortName, emoji.description, QVariant::fromValue(emoji));
+            }
+        }
+        index.build();
+        return index;
+    }();
+
+    return index;
 }
 
-QStringList EmojiModel::history(AbstractAccount *account) const
+const EmojiSearchIndex &EmojiModel::customIndex(AbstractAccount *account)
+{
+    Q_ASSERT(account != nullptr);
+
+    auto it = _customIndexes.find(account);
+    if (it == _customIndexes.end()) {
+        it = _customIndexes.insert(account, nullptr);
+
+        // Rebuilt the next time it's needed
+        QObject::connect(account, &AbstractAccount::fetchedCustomEmojis, account, [account] {
+            _customIndexes[account].reset();
+        });
+        QObject::connect(account, &QObject::destroyed, [account] {
+            _customIndexes.remove(account);
+        });
+    }
+
+    if (!*it) {
+        auto index = std::make_shared<EmojiSearchIndex>();
+        for (const auto &emoji : account->customEmojis()) {
+            index->add(emoji.shortcode, {}, QVariant::fromValue(emoji));
+        }
+        index->build();
+        *it = std::move(index);
+    }
+
+    return **it;
+}
+
+const QStringList &EmojiModel::cachedHistory(AbstractAccount *account)
 {
+    static const QStringList empty;
     if (account == nullptr) {
-        return {};
+        return empty;
     }
 
-    AccountConfig config(account->settingsGroupName());
-    return config.lastUsedEmojis();
+    auto it = _history.find(account);
+    if (it == _history.end()) {
+        AccountConfig config(account->settingsGroupName());
+        it = _history.insert(account, config.lastUsedEmojis());
+
+        QObject::connect(account, &QObject::destroyed, [account] {
+            _history.remove(account);
+        });
+    }
+
+    return *it;
 }
 
-QVariantList EmojiModel::filterModelNoCustom(const QString &filter)
+EmojiListModel *EmojiModel::tones(const QString &baseEmoji) const
 {
-    QVariantList result;
+    const auto [data, count] = builtinTones(baseEmoji);
+    return new EmojiListModel(data, count);
+}
 
-    for (const auto &e : _emojis.values()) {
-        for (const auto &variant : e) {
-            const auto &emoji = qvariant_cast<Emoji>(variant);
-            if (emoji.shortName.contains(filter, Qt::CaseInsensitive)) {
-                result.append(variant);
-            }
-        }
+bool EmojiModel::hasTones(const QString &baseEmoji) const
+{
+    return builtinTones(baseEmoji).second > 0;
+}
+
+std::pair<const EmojiData *, qsizetype> EmojiModel::builtinTones(const QString &baseEmoji)
+{
+    if (baseEmoji.endsWith("tone"_L1)) {
+        return EmojiTones::tones(QStringView(baseEmoji).left(baseEmoji.indexOf(u':')));
     }
 
-    return result;
+    return EmojiTones::tones(baseEmoji);
+}
+
+QStringList EmojiModel::history(AbstractAccount *account) const
+{
+    return cachedHistory(account);
+}
+
+QVariantList EmojiModel::filterModelNoCustom(const QString &filter, const QSet<QString> &boosted)
+{
+    return index().search(filter, boosted);
 }
 
 void EmojiModel::emojiUsed(AbstractAccount *account, const QString &shortcode)
@@ -117,6 +229,7 @@ void EmojiModel::emojiUsed(AbstractAccount *account, const QString &shortcode)
     AccountConfig config(account->settingsGroupName());
     config.setLastUsedEmojis(list.toList());
     config.save();
+    _history[account] = list.toList();
 
     Q_EMIT historyChanged();
 }
@@ -182,20 +295,13 @@ QVariantList EmojiModel::categories() const
     };
 }
 
-QVariantList EmojiModel::filterCustomModel(AbstractAccount *account, const QString &filter)
+QVariantList EmojiModel::filterCustomModel(AbstractAccount *account, const QString &filter, const QSet<QString> &boosted)
 {
     if (account == nullptr) {
         return {};
     }
 
-    QVariantList result;
-    for (const auto &emoji : account->customEmojis()) {
-        if (emoji.shortcode.contains(filter, Qt::CaseInsensitive)) {
-            result.append(QVariant::fromValue(emoji));
-        }
-    }
-
-    return result;
+    return customIndex(account).search(filter, boosted);
 }
 
 #include "moc_emojimodel.cpp"
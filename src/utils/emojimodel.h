@@ -38,6 +38,9 @@ struct Emoji {
 };
 
 class AbstractAccount;
+class EmojiListModel;
+class EmojiSearchIndex;
+struct EmojiData;
 
 /**
  * @brief This class defines the model for visualising a list of emojis.
@@ -84,17 +87,24 @@ public:
      *
      * @sa filterModelNoCustom
      */
-    Q_INVOKABLE static QVariantList filterModel(AbstractAccount *account, const QString &filter);
+    Q_INVOKABLE static EmojiListModel *filterModel(AbstractAccount *account, const QString &filter);
 
     /**
      * @brief Return a list of emojis for the given category.
+     *
+     * @note The models of the built-in categories are shared, and owned by this object.
      */
-    Q_INVOKABLE QVariantList emojis(AbstractAccount *account, Category category) const;
+    Q_INVOKABLE EmojiListModel *emojis(AbstractAccount *account, Category category);
 
     /**
      * @brief Return a list of emoji tones for the given base emoji.
      */
-    Q_INVOKABLE QVariantList tones(const QString &baseEmoji) const;
+    Q_INVOKABLE EmojiListModel *tones(const QString &baseEmoji) const;
+
+    /**
+     * @brief Return whether the given base emoji has any tones, without creating a model for them.
+     */
+    Q_INVOKABLE bool hasTones(const QString &baseEmoji) const;
 
     /**
      * @brief Return a list of emoji that were recently used.
@@ -108,10 +118,20 @@ public Q_SLOTS:
     void emojiUsed(AbstractAccount *account, const QString &shortcode);
 
 private:
-    static QHash<Category, QVariantList> _emojis;
+    static QHash<AbstractAccount *, QStringList> _history;
+    static QHash<AbstractAccount *, std::shared_ptr<EmojiSearchIndex>> _customIndexes;
+
+    QHash<Category, EmojiListModel *> m_categoryModels;
 
     QVariantList categories() const;
 
-    static QVariantList filterModelNoCustom(const QString &filter);
-    static QVariantList filterCustomModel(AbstractAccount *account, const QString &filter);
+    static std::pair<const EmojiData *, qsizetype> builtinEmojis(Category category);
+    static std::pair<const EmojiData *, qsizetype> builtinTones(const QString &baseEmoji);
+
+    static const EmojiSearchIndex &index();
+    static const EmojiSearchIndex &customIndex(AbstractAccount *account);
+    static const QStringList &cachedHistory(AbstractAccount *account);
+
+    static QVariantList filterModelNoCustom(const QString &filter, const QSet<QString> &boosted = {});
+    static QVariantList filterCustomModel(AbstractAccount *account, const QString &filter, const QSet<QString> &boosted = {});
 };
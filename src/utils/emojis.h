@@ -2,1856 +2,1876 @@
 // SPDX-License-Identifier: LGPL-2.0-or-later
 // This file is auto-generated. All changes will be lost. See tools/update-emojis.py
 // clang-format off
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F600"), QStringLiteral("grinning"), QStringLiteral("grinning face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F603"), QStringLiteral("smiley"), QStringLiteral("grinning face with big eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F604"), QStringLiteral("smile"), QStringLiteral("grinning face with smiling eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F601"), QStringLiteral("grin"), QStringLiteral("beaming face with smiling eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F606"), QStringLiteral("laughing"), QStringLiteral("grinning squinting face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F605"), QStringLiteral("sweat_smile"), QStringLiteral("grinning face with sweat")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F923"), QStringLiteral("rofl"), QStringLiteral("rolling on the floor laughing")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F602"), QStringLiteral("joy"), QStringLiteral("face with tears of joy")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F642"), QStringLiteral("slight_smile"), QStringLiteral("slightly smiling face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F643"), QStringLiteral("upside_down"), QStringLiteral("upside-down face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAE0"), QStringLiteral("melting face"), QStringLiteral("melting face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F609"), QStringLiteral("wink"), QStringLiteral("winking face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F60A"), QStringLiteral("blush"), QStringLiteral("smiling face with smiling eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F607"), QStringLiteral("innocent"), QStringLiteral("smiling face with halo")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F970"), QStringLiteral("smiling_face_with_3_hearts"), QStringLiteral("smiling face with hearts")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F60D"), QStringLiteral("heart_eyes"), QStringLiteral("smiling face with heart-eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F929"), QStringLiteral("star_struck"), QStringLiteral("star-struck")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F618"), QStringLiteral("kissing_heart"), QStringLiteral("face blowing a kiss")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F617"), QStringLiteral("kissing"), QStringLiteral("kissing face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000263A\U0000FE0F"), QStringLiteral("smiling face"), QStringLiteral("smiling face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F61A"), QStringLiteral("kissing_closed_eyes"), QStringLiteral("kissing face with closed eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F619"), QStringLiteral("kissing_smiling_eyes"), QStringLiteral("kissing face with smiling eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F972"), QStringLiteral("smiling face with tear"), QStringLiteral("smiling face with tear")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F60B"), QStringLiteral("yum"), QStringLiteral("face savoring food")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F61B"), QStringLiteral("stuck_out_tongue"), QStringLiteral("face with tongue")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F61C"), QStringLiteral("stuck_out_tongue_winking_eye"), QStringLiteral("winking face with tongue")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F92A"), QStringLiteral("zany_face"), QStringLiteral("zany face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F61D"), QStringLiteral("stuck_out_tongue_closed_eyes"), QStringLiteral("squinting face with tongue")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F911"), QStringLiteral("money_mouth"), QStringLiteral("money-mouth face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F917"), QStringLiteral("hugging"), QStringLiteral("smiling face with open hands")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F92D"), QStringLiteral("face_with_hand_over_mouth"), QStringLiteral("face with hand over mouth")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAE2"), QStringLiteral("face with open eyes and hand over mouth"), QStringLiteral("face with open eyes and hand over mouth")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAE3"), QStringLiteral("face with peeking eye"), QStringLiteral("face with peeking eye")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F92B"), QStringLiteral("shushing_face"), QStringLiteral("shushing face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F914"), QStringLiteral("thinking"), QStringLiteral("thinking face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAE1"), QStringLiteral("saluting face"), QStringLiteral("saluting face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F910"), QStringLiteral("zipper_mouth"), QStringLiteral("zipper-mouth face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F928"), QStringLiteral("face_with_raised_eyebrow"), QStringLiteral("face with raised eyebrow")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F610"), QStringLiteral("neutral_face"), QStringLiteral("neutral face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F611"), QStringLiteral("expressionless"), QStringLiteral("expressionless face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F636"), QStringLiteral("no_mouth"), QStringLiteral("face without mouth")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAE5"), QStringLiteral("dotted line face"), QStringLiteral("dotted line face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F636\U0000200D\U0001F32B\U0000FE0F"), QStringLiteral("face in clouds"), QStringLiteral("face in clouds")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F60F"), QStringLiteral("smirk"), QStringLiteral("smirking face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F612"), QStringLiteral("unamused"), QStringLiteral("unamused face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F644"), QStringLiteral("rolling_eyes"), QStringLiteral("face with rolling eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F62C"), QStringLiteral("grimacing"), QStringLiteral("grimacing face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F62E\U0000200D\U0001F4A8"), QStringLiteral("face exhaling"), QStringLiteral("face exhaling")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F925"), QStringLiteral("lying_face"), QStringLiteral("lying face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F60C"), QStringLiteral("relieved"), QStringLiteral("relieved face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F614"), QStringLiteral("pensive"), QStringLiteral("pensive face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F62A"), QStringLiteral("sleepy"), QStringLiteral("sleepy face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F924"), QStringLiteral("drooling_face"), QStringLiteral("drooling face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F634"), QStringLiteral("sleeping"), QStringLiteral("sleeping face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F637"), QStringLiteral("mask"), QStringLiteral("face with medical mask")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F912"), QStringLiteral("thermometer_face"), QStringLiteral("face with thermometer")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F915"), QStringLiteral("head_bandage"), QStringLiteral("face with head-bandage")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F922"), QStringLiteral("nauseated_face"), QStringLiteral("nauseated face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F92E"), QStringLiteral("face_vomiting"), QStringLiteral("face vomiting")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F927"), QStringLiteral("sneezing_face"), QStringLiteral("sneezing face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F975"), QStringLiteral("hot_face"), QStringLiteral("hot face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F976"), QStringLiteral("cold_face"), QStringLiteral("cold face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F974"), QStringLiteral("woozy_face"), QStringLiteral("woozy face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F635"), QStringLiteral("dizzy_face"), QStringLiteral("face with crossed-out eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F635\U0000200D\U0001F4AB"), QStringLiteral("face with spiral eyes"), QStringLiteral("face with spiral eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F92F"), QStringLiteral("exploding_head"), QStringLiteral("exploding head")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F920"), QStringLiteral("cowboy"), QStringLiteral("cowboy hat face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F973"), QStringLiteral("partying_face"), QStringLiteral("partying face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F978"), QStringLiteral("disguised face"), QStringLiteral("disguised face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F60E"), QStringLiteral("sunglasses"), QStringLiteral("smiling face with sunglasses")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F913"), QStringLiteral("nerd"), QStringLiteral("nerd face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D0"), QStringLiteral("face_with_monocle"), QStringLiteral("face with monocle")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F615"), QStringLiteral("confused"), QStringLiteral("confused face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAE4"), QStringLiteral("face with diagonal mouth"), QStringLiteral("face with diagonal mouth")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F61F"), QStringLiteral("worried"), QStringLiteral("worried face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F641"), QStringLiteral("slight_frown"), QStringLiteral("slightly frowning face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002639\U0000FE0F"), QStringLiteral("frowning face"), QStringLiteral("frowning face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F62E"), QStringLiteral("open_mouth"), QStringLiteral("face with open mouth")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F62F"), QStringLiteral("hushed"), QStringLiteral("hushed face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F632"), QStringLiteral("astonished"), QStringLiteral("astonished face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F633"), QStringLiteral("flushed"), QStringLiteral("flushed face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F97A"), QStringLiteral("pleading_face"), QStringLiteral("pleading face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F979"), QStringLiteral("face holding back tears"), QStringLiteral("face holding back tears")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F626"), QStringLiteral("frowning"), QStringLiteral("frowning face with open mouth")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F627"), QStringLiteral("anguished"), QStringLiteral("anguished face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F628"), QStringLiteral("fearful"), QStringLiteral("fearful face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F630"), QStringLiteral("cold_sweat"), QStringLiteral("anxious face with sweat")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F625"), QStringLiteral("disappointed_relieved"), QStringLiteral("sad but relieved face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F622"), QStringLiteral("cry"), QStringLiteral("crying face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F62D"), QStringLiteral("sob"), QStringLiteral("loudly crying face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F631"), QStringLiteral("scream"), QStringLiteral("face screaming in fear")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F616"), QStringLiteral("confounded"), QStringLiteral("confounded face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F623"), QStringLiteral("persevere"), QStringLiteral("persevering face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F61E"), QStringLiteral("disappointed"), QStringLiteral("disappointed face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F613"), QStringLiteral("sweat"), QStringLiteral("downcast face with sweat")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F629"), QStringLiteral("weary"), QStringLiteral("weary face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F62B"), QStringLiteral("tired_face"), QStringLiteral("tired face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F971"), QStringLiteral("yawning face"), QStringLiteral("yawning face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F624"), QStringLiteral("triumph"), QStringLiteral("face with steam from nose")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F621"), QStringLiteral("rage"), QStringLiteral("pouting face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F620"), QStringLiteral("angry"), QStringLiteral("angry face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F92C"), QStringLiteral("face_with_symbols_over_mouth"), QStringLiteral("face with symbols on mouth")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F608"), QStringLiteral("smiling_imp"), QStringLiteral("smiling face with horns")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47F"), QStringLiteral("imp"), QStringLiteral("angry face with horns")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F480"), QStringLiteral("skull"), QStringLiteral("skull")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002620\U0000FE0F"), QStringLiteral("skull and crossbones"), QStringLiteral("skull and crossbones")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A9"), QStringLiteral("poop"), QStringLiteral("pile of poo")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F921"), QStringLiteral("clown"), QStringLiteral("clown face")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F479"), QStringLiteral("japanese_ogre"), QStringLiteral("ogre")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47A"), QStringLiteral("japanese_goblin"), QStringLiteral("goblin")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47B"), QStringLiteral("ghost"), QStringLiteral("ghost")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47D"), QStringLiteral("alien"), QStringLiteral("alien")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47E"), QStringLiteral("space_invader"), QStringLiteral("alien monster")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F916"), QStringLiteral("robot"), QStringLiteral("robot")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F63A"), QStringLiteral("smiley_cat"), QStringLiteral("grinning cat")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F638"), QStringLiteral("smile_cat"), QStringLiteral("grinning cat with smiling eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F639"), QStringLiteral("joy_cat"), QStringLiteral("cat with tears of joy")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F63B"), QStringLiteral("heart_eyes_cat"), QStringLiteral("smiling cat with heart-eyes")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F63C"), QStringLiteral("smirk_cat"), QStringLiteral("cat with wry smile")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F63D"), QStringLiteral("kissing_cat"), QStringLiteral("kissing cat")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F640"), QStringLiteral("scream_cat"), QStringLiteral("weary cat")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F63F"), QStringLiteral("crying_cat_face"), QStringLiteral("crying cat")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F63E"), QStringLiteral("pouting_cat"), QStringLiteral("pouting cat")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F648"), QStringLiteral("see_no_evil"), QStringLiteral("see-no-evil monkey")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F649"), QStringLiteral("hear_no_evil"), QStringLiteral("hear-no-evil monkey")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64A"), QStringLiteral("speak_no_evil"), QStringLiteral("speak-no-evil monkey")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48B"), QStringLiteral("kiss"), QStringLiteral("kiss mark")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48C"), QStringLiteral("love_letter"), QStringLiteral("love letter")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F498"), QStringLiteral("cupid"), QStringLiteral("heart with arrow")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F49D"), QStringLiteral("gift_heart"), QStringLiteral("heart with ribbon")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F496"), QStringLiteral("sparkling_heart"), QStringLiteral("sparkling heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F497"), QStringLiteral("heartpulse"), QStringLiteral("growing heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F493"), QStringLiteral("heartbeat"), QStringLiteral("beating heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F49E"), QStringLiteral("revolving_hearts"), QStringLiteral("revolving hearts")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F495"), QStringLiteral("two_hearts"), QStringLiteral("two hearts")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F49F"), QStringLiteral("heart_decoration"), QStringLiteral("heart decoration")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002763\U0000FE0F"), QStringLiteral("heart exclamation"), QStringLiteral("heart exclamation")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F494"), QStringLiteral("broken_heart"), QStringLiteral("broken heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002764\U0000FE0F\U0000200D\U0001F525"), QStringLiteral("heart on fire"), QStringLiteral("heart on fire")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002764\U0000FE0F\U0000200D\U0001FA79"), QStringLiteral("mending heart"), QStringLiteral("mending heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002764\U0000FE0F"), QStringLiteral("red heart"), QStringLiteral("red heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E1"), QStringLiteral("orange_heart"), QStringLiteral("orange heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F49B"), QStringLiteral("yellow_heart"), QStringLiteral("yellow heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F49A"), QStringLiteral("green_heart"), QStringLiteral("green heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F499"), QStringLiteral("blue_heart"), QStringLiteral("blue heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F49C"), QStringLiteral("purple_heart"), QStringLiteral("purple heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90E"), QStringLiteral("brown heart"), QStringLiteral("brown heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5A4"), QStringLiteral("black_heart"), QStringLiteral("black heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90D"), QStringLiteral("white heart"), QStringLiteral("white heart")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AF"), QStringLiteral("100"), QStringLiteral("hundred points")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A2"), QStringLiteral("anger"), QStringLiteral("anger symbol")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A5"), QStringLiteral("boom"), QStringLiteral("collision")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AB"), QStringLiteral("dizzy"), QStringLiteral("dizzy")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A6"), QStringLiteral("sweat_drops"), QStringLiteral("sweat droplets")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A8"), QStringLiteral("dash"), QStringLiteral("dashing away")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F573\U0000FE0F"), QStringLiteral("hole"), QStringLiteral("hole")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A3"), QStringLiteral("bomb"), QStringLiteral("bomb")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AC"), QStringLiteral("speech_balloon"), QStringLiteral("speech balloon")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F441\U0000FE0F\U0000200D\U0001F5E8\U0000FE0F"), QStringLiteral("eye in speech bubble"), QStringLiteral("eye in speech bubble")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5E8\U0000FE0F"), QStringLiteral("left speech bubble"), QStringLiteral("left speech bubble")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5EF\U0000FE0F"), QStringLiteral("right anger bubble"), QStringLiteral("right anger bubble")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AD"), QStringLiteral("thought_balloon"), QStringLiteral("thought balloon")}));
-_emojis[Smileys].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A4"), QStringLiteral("zzz"), QStringLiteral("zzz")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44B"), QStringLiteral("wave"), QStringLiteral("waving hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91A"), QStringLiteral("raised_back_of_hand"), QStringLiteral("raised back of hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F590\U0000FE0F"), QStringLiteral("hand with fingers splayed"), QStringLiteral("hand with fingers splayed")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270B"), QStringLiteral("raised_hand"), QStringLiteral("raised hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F596"), QStringLiteral("vulcan"), QStringLiteral("vulcan salute")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1"), QStringLiteral("rightwards hand"), QStringLiteral("rightwards hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF2"), QStringLiteral("leftwards hand"), QStringLiteral("leftwards hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF3"), QStringLiteral("palm down hand"), QStringLiteral("palm down hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF4"), QStringLiteral("palm up hand"), QStringLiteral("palm up hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44C"), QStringLiteral("ok_hand"), QStringLiteral("OK hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90C"), QStringLiteral("pinched fingers"), QStringLiteral("pinched fingers")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90F"), QStringLiteral("pinching hand"), QStringLiteral("pinching hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270C\U0000FE0F"), QStringLiteral("victory hand"), QStringLiteral("victory hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91E"), QStringLiteral("fingers_crossed"), QStringLiteral("crossed fingers")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF0"), QStringLiteral("hand with index finger and thumb crossed"), QStringLiteral("hand with index finger and thumb crossed")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91F"), QStringLiteral("love_you_gesture"), QStringLiteral("love-you gesture")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F918"), QStringLiteral("metal"), QStringLiteral("sign of the horns")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F919"), QStringLiteral("call_me"), QStringLiteral("call me hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F448"), QStringLiteral("point_left"), QStringLiteral("backhand index pointing left")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F449"), QStringLiteral("point_right"), QStringLiteral("backhand index pointing right")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F446"), QStringLiteral("point_up_2"), QStringLiteral("backhand index pointing up")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F595"), QStringLiteral("middle_finger"), QStringLiteral("middle finger")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F447"), QStringLiteral("point_down"), QStringLiteral("backhand index pointing down")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000261D\U0000FE0F"), QStringLiteral("index pointing up"), QStringLiteral("index pointing up")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF5"), QStringLiteral("index pointing at the viewer"), QStringLiteral("index pointing at the viewer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44D"), QStringLiteral("thumbsup"), QStringLiteral("thumbs up")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44E"), QStringLiteral("thumbsdown"), QStringLiteral("thumbs down")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270A"), QStringLiteral("fist"), QStringLiteral("raised fist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44A"), QStringLiteral("punch"), QStringLiteral("oncoming fist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91B"), QStringLiteral("left_facing_fist"), QStringLiteral("left-facing fist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91C"), QStringLiteral("right_facing_fist"), QStringLiteral("right-facing fist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44F"), QStringLiteral("clap"), QStringLiteral("clapping hands")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64C"), QStringLiteral("raised_hands"), QStringLiteral("raising hands")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF6"), QStringLiteral("heart hands"), QStringLiteral("heart hands")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F450"), QStringLiteral("open_hands"), QStringLiteral("open hands")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F932"), QStringLiteral("palms_up_together"), QStringLiteral("palms up together")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91D"), QStringLiteral("handshake"), QStringLiteral("handshake")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64F"), QStringLiteral("pray"), QStringLiteral("folded hands")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270D\U0000FE0F"), QStringLiteral("writing hand"), QStringLiteral("writing hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F485"), QStringLiteral("nail_care"), QStringLiteral("nail polish")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F933"), QStringLiteral("selfie"), QStringLiteral("selfie")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AA"), QStringLiteral("muscle"), QStringLiteral("flexed biceps")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BE"), QStringLiteral("mechanical arm"), QStringLiteral("mechanical arm")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BF"), QStringLiteral("mechanical leg"), QStringLiteral("mechanical leg")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B5"), QStringLiteral("leg"), QStringLiteral("leg")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B6"), QStringLiteral("foot"), QStringLiteral("foot")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F442"), QStringLiteral("ear"), QStringLiteral("ear")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BB"), QStringLiteral("ear with hearing aid"), QStringLiteral("ear with hearing aid")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F443"), QStringLiteral("nose"), QStringLiteral("nose")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E0"), QStringLiteral("brain"), QStringLiteral("brain")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC0"), QStringLiteral("anatomical heart"), QStringLiteral("anatomical heart")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC1"), QStringLiteral("lungs"), QStringLiteral("lungs")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B7"), QStringLiteral("tooth"), QStringLiteral("tooth")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B4"), QStringLiteral("bone"), QStringLiteral("bone")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F440"), QStringLiteral("eyes"), QStringLiteral("eyes")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F441\U0000FE0F"), QStringLiteral("eye"), QStringLiteral("eye")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F445"), QStringLiteral("tongue"), QStringLiteral("tongue")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F444"), QStringLiteral("lips"), QStringLiteral("mouth")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAE6"), QStringLiteral("biting lip"), QStringLiteral("biting lip")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F476"), QStringLiteral("baby"), QStringLiteral("baby")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D2"), QStringLiteral("child"), QStringLiteral("child")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F466"), QStringLiteral("boy"), QStringLiteral("boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F467"), QStringLiteral("girl"), QStringLiteral("girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1"), QStringLiteral("adult"), QStringLiteral("person")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471"), QStringLiteral("person_with_blond_hair"), QStringLiteral("person: blond hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468"), QStringLiteral("man"), QStringLiteral("man")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4"), QStringLiteral("bearded_person"), QStringLiteral("person: beard")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: beard"), QStringLiteral("man: beard")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: beard"), QStringLiteral("woman: beard")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F9B0"), QStringLiteral("man: red hair"), QStringLiteral("man: red hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F9B1"), QStringLiteral("man: curly hair"), QStringLiteral("man: curly hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F9B3"), QStringLiteral("man: white hair"), QStringLiteral("man: white hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F9B2"), QStringLiteral("man: bald"), QStringLiteral("man: bald")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469"), QStringLiteral("woman"), QStringLiteral("woman")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F9B0"), QStringLiteral("woman: red hair"), QStringLiteral("woman: red hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F9B0"), QStringLiteral("person: red hair"), QStringLiteral("person: red hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F9B1"), QStringLiteral("woman: curly hair"), QStringLiteral("woman: curly hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F9B1"), QStringLiteral("person: curly hair"), QStringLiteral("person: curly hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F9B3"), QStringLiteral("woman: white hair"), QStringLiteral("woman: white hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F9B3"), QStringLiteral("person: white hair"), QStringLiteral("person: white hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F9B2"), QStringLiteral("woman: bald"), QStringLiteral("woman: bald")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F9B2"), QStringLiteral("person: bald"), QStringLiteral("person: bald")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: blond hair"), QStringLiteral("woman: blond hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: blond hair"), QStringLiteral("man: blond hair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D3"), QStringLiteral("older_adult"), QStringLiteral("older person")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F474"), QStringLiteral("older_man"), QStringLiteral("old man")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F475"), QStringLiteral("older_woman"), QStringLiteral("old woman")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D"), QStringLiteral("person_frowning"), QStringLiteral("person frowning")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man frowning"), QStringLiteral("man frowning")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman frowning"), QStringLiteral("woman frowning")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E"), QStringLiteral("person_with_pouting_face"), QStringLiteral("person pouting")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man pouting"), QStringLiteral("man pouting")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman pouting"), QStringLiteral("woman pouting")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645"), QStringLiteral("no_good"), QStringLiteral("person gesturing NO")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing NO"), QStringLiteral("man gesturing NO")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing NO"), QStringLiteral("woman gesturing NO")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646"), QStringLiteral("ok_woman"), QStringLiteral("person gesturing OK")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing OK"), QStringLiteral("man gesturing OK")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing OK"), QStringLiteral("woman gesturing OK")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481"), QStringLiteral("information_desk_person"), QStringLiteral("person tipping hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man tipping hand"), QStringLiteral("man tipping hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman tipping hand"), QStringLiteral("woman tipping hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B"), QStringLiteral("raising_hand"), QStringLiteral("person raising hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man raising hand"), QStringLiteral("man raising hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman raising hand"), QStringLiteral("woman raising hand")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF"), QStringLiteral("deaf person"), QStringLiteral("deaf person")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("deaf man"), QStringLiteral("deaf man")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("deaf woman"), QStringLiteral("deaf woman")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647"), QStringLiteral("bow"), QStringLiteral("person bowing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bowing"), QStringLiteral("man bowing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bowing"), QStringLiteral("woman bowing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926"), QStringLiteral("face_palm"), QStringLiteral("person facepalming")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man facepalming"), QStringLiteral("man facepalming")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman facepalming"), QStringLiteral("woman facepalming")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937"), QStringLiteral("shrug"), QStringLiteral("person shrugging")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man shrugging"), QStringLiteral("man shrugging")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman shrugging"), QStringLiteral("woman shrugging")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U00002695\U0000FE0F"), QStringLiteral("health worker"), QStringLiteral("health worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U00002695\U0000FE0F"), QStringLiteral("man health worker"), QStringLiteral("man health worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U00002695\U0000FE0F"), QStringLiteral("woman health worker"), QStringLiteral("woman health worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F393"), QStringLiteral("student"), QStringLiteral("student")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F393"), QStringLiteral("man student"), QStringLiteral("man student")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F393"), QStringLiteral("woman student"), QStringLiteral("woman student")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F3EB"), QStringLiteral("teacher"), QStringLiteral("teacher")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F3EB"), QStringLiteral("man teacher"), QStringLiteral("man teacher")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F3EB"), QStringLiteral("woman teacher"), QStringLiteral("woman teacher")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U00002696\U0000FE0F"), QStringLiteral("judge"), QStringLiteral("judge")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U00002696\U0000FE0F"), QStringLiteral("man judge"), QStringLiteral("man judge")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U00002696\U0000FE0F"), QStringLiteral("woman judge"), QStringLiteral("woman judge")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F33E"), QStringLiteral("farmer"), QStringLiteral("farmer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F33E"), QStringLiteral("man farmer"), QStringLiteral("man farmer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F33E"), QStringLiteral("woman farmer"), QStringLiteral("woman farmer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F373"), QStringLiteral("cook"), QStringLiteral("cook")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F373"), QStringLiteral("man cook"), QStringLiteral("man cook")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F373"), QStringLiteral("woman cook"), QStringLiteral("woman cook")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F527"), QStringLiteral("mechanic"), QStringLiteral("mechanic")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F527"), QStringLiteral("man mechanic"), QStringLiteral("man mechanic")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F527"), QStringLiteral("woman mechanic"), QStringLiteral("woman mechanic")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F3ED"), QStringLiteral("factory worker"), QStringLiteral("factory worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F3ED"), QStringLiteral("man factory worker"), QStringLiteral("man factory worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F3ED"), QStringLiteral("woman factory worker"), QStringLiteral("woman factory worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F4BC"), QStringLiteral("office worker"), QStringLiteral("office worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F4BC"), QStringLiteral("man office worker"), QStringLiteral("man office worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F4BC"), QStringLiteral("woman office worker"), QStringLiteral("woman office worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F52C"), QStringLiteral("scientist"), QStringLiteral("scientist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F52C"), QStringLiteral("man scientist"), QStringLiteral("man scientist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F52C"), QStringLiteral("woman scientist"), QStringLiteral("woman scientist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F4BB"), QStringLiteral("technologist"), QStringLiteral("technologist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F4BB"), QStringLiteral("man technologist"), QStringLiteral("man technologist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F4BB"), QStringLiteral("woman technologist"), QStringLiteral("woman technologist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F3A4"), QStringLiteral("singer"), QStringLiteral("singer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F3A4"), QStringLiteral("man singer"), QStringLiteral("man singer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F3A4"), QStringLiteral("woman singer"), QStringLiteral("woman singer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F3A8"), QStringLiteral("artist"), QStringLiteral("artist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F3A8"), QStringLiteral("man artist"), QStringLiteral("man artist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F3A8"), QStringLiteral("woman artist"), QStringLiteral("woman artist")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U00002708\U0000FE0F"), QStringLiteral("pilot"), QStringLiteral("pilot")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U00002708\U0000FE0F"), QStringLiteral("man pilot"), QStringLiteral("man pilot")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U00002708\U0000FE0F"), QStringLiteral("woman pilot"), QStringLiteral("woman pilot")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F680"), QStringLiteral("astronaut"), QStringLiteral("astronaut")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F680"), QStringLiteral("man astronaut"), QStringLiteral("man astronaut")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F680"), QStringLiteral("woman astronaut"), QStringLiteral("woman astronaut")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F692"), QStringLiteral("firefighter"), QStringLiteral("firefighter")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F692"), QStringLiteral("man firefighter"), QStringLiteral("man firefighter")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F692"), QStringLiteral("woman firefighter"), QStringLiteral("woman firefighter")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E"), QStringLiteral("cop"), QStringLiteral("police officer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man police officer"), QStringLiteral("man police officer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman police officer"), QStringLiteral("woman police officer")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0000FE0F"), QStringLiteral("detective"), QStringLiteral("detective")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0000FE0F\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man detective"), QStringLiteral("man detective")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0000FE0F\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman detective"), QStringLiteral("woman detective")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482"), QStringLiteral("guardsman"), QStringLiteral("guard")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man guard"), QStringLiteral("man guard")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman guard"), QStringLiteral("woman guard")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F977"), QStringLiteral("ninja"), QStringLiteral("ninja")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477"), QStringLiteral("construction_worker"), QStringLiteral("construction worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man construction worker"), QStringLiteral("man construction worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman construction worker"), QStringLiteral("woman construction worker")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC5"), QStringLiteral("person with crown"), QStringLiteral("person with crown")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F934"), QStringLiteral("prince"), QStringLiteral("prince")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F478"), QStringLiteral("princess"), QStringLiteral("princess")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473"), QStringLiteral("man_with_turban"), QStringLiteral("person wearing turban")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man wearing turban"), QStringLiteral("man wearing turban")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman wearing turban"), QStringLiteral("woman wearing turban")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F472"), QStringLiteral("man_with_gua_pi_mao"), QStringLiteral("person with skullcap")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D5"), QStringLiteral("woman_with_headscarf"), QStringLiteral("woman with headscarf")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935"), QStringLiteral("man_in_tuxedo"), QStringLiteral("person in tuxedo")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in tuxedo"), QStringLiteral("man in tuxedo")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in tuxedo"), QStringLiteral("woman in tuxedo")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470"), QStringLiteral("bride_with_veil"), QStringLiteral("person with veil")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man with veil"), QStringLiteral("man with veil")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman with veil"), QStringLiteral("woman with veil")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F930"), QStringLiteral("pregnant_woman"), QStringLiteral("pregnant woman")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC3"), QStringLiteral("pregnant man"), QStringLiteral("pregnant man")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC4"), QStringLiteral("pregnant person"), QStringLiteral("pregnant person")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F931"), QStringLiteral("breast_feeding"), QStringLiteral("breast-feeding")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F37C"), QStringLiteral("woman feeding baby"), QStringLiteral("woman feeding baby")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F37C"), QStringLiteral("man feeding baby"), QStringLiteral("man feeding baby")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F37C"), QStringLiteral("person feeding baby"), QStringLiteral("person feeding baby")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47C"), QStringLiteral("angel"), QStringLiteral("baby angel")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F385"), QStringLiteral("santa"), QStringLiteral("Santa Claus")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F936"), QStringLiteral("mrs_claus"), QStringLiteral("Mrs. Claus")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F384"), QStringLiteral("mx claus"), QStringLiteral("mx claus")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8"), QStringLiteral("superhero"), QStringLiteral("superhero")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man superhero"), QStringLiteral("man superhero")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman superhero"), QStringLiteral("woman superhero")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9"), QStringLiteral("supervillain"), QStringLiteral("supervillain")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man supervillain"), QStringLiteral("man supervillain")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman supervillain"), QStringLiteral("woman supervillain")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9"), QStringLiteral("mage"), QStringLiteral("mage")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mage"), QStringLiteral("man mage")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mage"), QStringLiteral("woman mage")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA"), QStringLiteral("fairy"), QStringLiteral("fairy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man fairy"), QStringLiteral("man fairy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman fairy"), QStringLiteral("woman fairy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB"), QStringLiteral("vampire"), QStringLiteral("vampire")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man vampire"), QStringLiteral("man vampire")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman vampire"), QStringLiteral("woman vampire")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC"), QStringLiteral("merperson"), QStringLiteral("merperson")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("merman"), QStringLiteral("merman")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("mermaid"), QStringLiteral("mermaid")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD"), QStringLiteral("elf"), QStringLiteral("elf")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man elf"), QStringLiteral("man elf")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman elf"), QStringLiteral("woman elf")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DE"), QStringLiteral("genie"), QStringLiteral("genie")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man genie"), QStringLiteral("man genie")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman genie"), QStringLiteral("woman genie")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DF"), QStringLiteral("zombie"), QStringLiteral("zombie")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man zombie"), QStringLiteral("man zombie")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman zombie"), QStringLiteral("woman zombie")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CC"), QStringLiteral("troll"), QStringLiteral("troll")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486"), QStringLiteral("massage"), QStringLiteral("person getting massage")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting massage"), QStringLiteral("man getting massage")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting massage"), QStringLiteral("woman getting massage")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487"), QStringLiteral("haircut"), QStringLiteral("person getting haircut")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting haircut"), QStringLiteral("man getting haircut")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting haircut"), QStringLiteral("woman getting haircut")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6"), QStringLiteral("walking"), QStringLiteral("person walking")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man walking"), QStringLiteral("man walking")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman walking"), QStringLiteral("woman walking")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD"), QStringLiteral("person standing"), QStringLiteral("person standing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man standing"), QStringLiteral("man standing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman standing"), QStringLiteral("woman standing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE"), QStringLiteral("person kneeling"), QStringLiteral("person kneeling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man kneeling"), QStringLiteral("man kneeling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman kneeling"), QStringLiteral("woman kneeling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F9AF"), QStringLiteral("person with white cane"), QStringLiteral("person with white cane")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F9AF"), QStringLiteral("man with white cane"), QStringLiteral("man with white cane")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F9AF"), QStringLiteral("woman with white cane"), QStringLiteral("woman with white cane")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F9BC"), QStringLiteral("person in motorized wheelchair"), QStringLiteral("person in motorized wheelchair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F9BC"), QStringLiteral("man in motorized wheelchair"), QStringLiteral("man in motorized wheelchair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F9BC"), QStringLiteral("woman in motorized wheelchair"), QStringLiteral("woman in motorized wheelchair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F9BD"), QStringLiteral("person in manual wheelchair"), QStringLiteral("person in manual wheelchair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F9BD"), QStringLiteral("man in manual wheelchair"), QStringLiteral("man in manual wheelchair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F9BD"), QStringLiteral("woman in manual wheelchair"), QStringLiteral("woman in manual wheelchair")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3"), QStringLiteral("runner"), QStringLiteral("person running")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man running"), QStringLiteral("man running")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman running"), QStringLiteral("woman running")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F483"), QStringLiteral("dancer"), QStringLiteral("woman dancing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F57A"), QStringLiteral("man_dancing"), QStringLiteral("man dancing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F574\U0000FE0F"), QStringLiteral("person in suit levitating"), QStringLiteral("person in suit levitating")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46F"), QStringLiteral("dancers"), QStringLiteral("people with bunny ears")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46F\U0000200D\U00002642\U0000FE0F"), QStringLiteral("men with bunny ears"), QStringLiteral("men with bunny ears")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46F\U0000200D\U00002640\U0000FE0F"), QStringLiteral("women with bunny ears"), QStringLiteral("women with bunny ears")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6"), QStringLiteral("person_in_steamy_room"), QStringLiteral("person in steamy room")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in steamy room"), QStringLiteral("man in steamy room")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in steamy room"), QStringLiteral("woman in steamy room")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7"), QStringLiteral("person_climbing"), QStringLiteral("person climbing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man climbing"), QStringLiteral("man climbing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman climbing"), QStringLiteral("woman climbing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93A"), QStringLiteral("fencer"), QStringLiteral("person fencing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C7"), QStringLiteral("horse_racing"), QStringLiteral("horse racing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F7\U0000FE0F"), QStringLiteral("skier"), QStringLiteral("skier")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C2"), QStringLiteral("snowboarder"), QStringLiteral("snowboarder")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0000FE0F"), QStringLiteral("person golfing"), QStringLiteral("person golfing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0000FE0F\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man golfing"), QStringLiteral("man golfing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0000FE0F\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman golfing"), QStringLiteral("woman golfing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4"), QStringLiteral("surfer"), QStringLiteral("person surfing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man surfing"), QStringLiteral("man surfing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman surfing"), QStringLiteral("woman surfing")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3"), QStringLiteral("rowboat"), QStringLiteral("person rowing boat")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man rowing boat"), QStringLiteral("man rowing boat")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman rowing boat"), QStringLiteral("woman rowing boat")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA"), QStringLiteral("swimmer"), QStringLiteral("person swimming")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man swimming"), QStringLiteral("man swimming")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman swimming"), QStringLiteral("woman swimming")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0000FE0F"), QStringLiteral("person bouncing ball"), QStringLiteral("person bouncing ball")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0000FE0F\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bouncing ball"), QStringLiteral("man bouncing ball")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0000FE0F\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bouncing ball"), QStringLiteral("woman bouncing ball")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0000FE0F"), QStringLiteral("person lifting weights"), QStringLiteral("person lifting weights")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0000FE0F\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man lifting weights"), QStringLiteral("man lifting weights")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0000FE0F\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman lifting weights"), QStringLiteral("woman lifting weights")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4"), QStringLiteral("bicyclist"), QStringLiteral("person biking")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man biking"), QStringLiteral("man biking")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman biking"), QStringLiteral("woman biking")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5"), QStringLiteral("mountain_bicyclist"), QStringLiteral("person mountain biking")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mountain biking"), QStringLiteral("man mountain biking")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mountain biking"), QStringLiteral("woman mountain biking")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938"), QStringLiteral("cartwheel"), QStringLiteral("person cartwheeling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man cartwheeling"), QStringLiteral("man cartwheeling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman cartwheeling"), QStringLiteral("woman cartwheeling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93C"), QStringLiteral("wrestlers"), QStringLiteral("people wrestling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93C\U0000200D\U00002642\U0000FE0F"), QStringLiteral("men wrestling"), QStringLiteral("men wrestling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93C\U0000200D\U00002640\U0000FE0F"), QStringLiteral("women wrestling"), QStringLiteral("women wrestling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D"), QStringLiteral("water_polo"), QStringLiteral("person playing water polo")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing water polo"), QStringLiteral("man playing water polo")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing water polo"), QStringLiteral("woman playing water polo")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E"), QStringLiteral("handball"), QStringLiteral("person playing handball")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing handball"), QStringLiteral("man playing handball")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing handball"), QStringLiteral("woman playing handball")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939"), QStringLiteral("juggling"), QStringLiteral("person juggling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man juggling"), QStringLiteral("man juggling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman juggling"), QStringLiteral("woman juggling")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8"), QStringLiteral("person_in_lotus_position"), QStringLiteral("person in lotus position")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in lotus position"), QStringLiteral("man in lotus position")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in lotus position"), QStringLiteral("woman in lotus position")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C0"), QStringLiteral("bath"), QStringLiteral("person taking bath")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CC"), QStringLiteral("sleeping_accommodation"), QStringLiteral("person in bed")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0000200D\U0001F91D\U0000200D\U0001F9D1"), QStringLiteral("people holding hands"), QStringLiteral("people holding hands")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46D"), QStringLiteral("two_women_holding_hands"), QStringLiteral("women holding hands")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46B"), QStringLiteral("couple"), QStringLiteral("woman and man holding hands")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46C"), QStringLiteral("two_men_holding_hands"), QStringLiteral("men holding hands")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48F"), QStringLiteral("couplekiss"), QStringLiteral("kiss")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468"), QStringLiteral("kiss: woman, man"), QStringLiteral("kiss: woman, man")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468"), QStringLiteral("kiss: man, man"), QStringLiteral("kiss: man, man")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469"), QStringLiteral("kiss: woman, woman"), QStringLiteral("kiss: woman, woman")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F491"), QStringLiteral("couple_with_heart"), QStringLiteral("couple with heart")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468"), QStringLiteral("couple with heart: woman, man"), QStringLiteral("couple with heart: woman, man")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468"), QStringLiteral("couple with heart: man, man"), QStringLiteral("couple with heart: man, man")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469"), QStringLiteral("couple with heart: woman, woman"), QStringLiteral("couple with heart: woman, woman")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46A"), QStringLiteral("family"), QStringLiteral("family")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F469\U0000200D\U0001F466"), QStringLiteral("family: man, woman, boy"), QStringLiteral("family: man, woman, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F469\U0000200D\U0001F467"), QStringLiteral("family: man, woman, girl"), QStringLiteral("family: man, woman, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F469\U0000200D\U0001F467\U0000200D\U0001F466"), QStringLiteral("family: man, woman, girl, boy"), QStringLiteral("family: man, woman, girl, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F469\U0000200D\U0001F466\U0000200D\U0001F466"), QStringLiteral("family: man, woman, boy, boy"), QStringLiteral("family: man, woman, boy, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F469\U0000200D\U0001F467\U0000200D\U0001F467"), QStringLiteral("family: man, woman, girl, girl"), QStringLiteral("family: man, woman, girl, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F468\U0000200D\U0001F466"), QStringLiteral("family: man, man, boy"), QStringLiteral("family: man, man, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F468\U0000200D\U0001F467"), QStringLiteral("family: man, man, girl"), QStringLiteral("family: man, man, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F468\U0000200D\U0001F467\U0000200D\U0001F466"), QStringLiteral("family: man, man, girl, boy"), QStringLiteral("family: man, man, girl, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F468\U0000200D\U0001F466\U0000200D\U0001F466"), QStringLiteral("family: man, man, boy, boy"), QStringLiteral("family: man, man, boy, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F468\U0000200D\U0001F467\U0000200D\U0001F467"), QStringLiteral("family: man, man, girl, girl"), QStringLiteral("family: man, man, girl, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F469\U0000200D\U0001F466"), QStringLiteral("family: woman, woman, boy"), QStringLiteral("family: woman, woman, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F469\U0000200D\U0001F467"), QStringLiteral("family: woman, woman, girl"), QStringLiteral("family: woman, woman, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F469\U0000200D\U0001F467\U0000200D\U0001F466"), QStringLiteral("family: woman, woman, girl, boy"), QStringLiteral("family: woman, woman, girl, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F469\U0000200D\U0001F466\U0000200D\U0001F466"), QStringLiteral("family: woman, woman, boy, boy"), QStringLiteral("family: woman, woman, boy, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F469\U0000200D\U0001F467\U0000200D\U0001F467"), QStringLiteral("family: woman, woman, girl, girl"), QStringLiteral("family: woman, woman, girl, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F466"), QStringLiteral("family: man, boy"), QStringLiteral("family: man, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F466\U0000200D\U0001F466"), QStringLiteral("family: man, boy, boy"), QStringLiteral("family: man, boy, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F467"), QStringLiteral("family: man, girl"), QStringLiteral("family: man, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F467\U0000200D\U0001F466"), QStringLiteral("family: man, girl, boy"), QStringLiteral("family: man, girl, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0000200D\U0001F467\U0000200D\U0001F467"), QStringLiteral("family: man, girl, girl"), QStringLiteral("family: man, girl, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F466"), QStringLiteral("family: woman, boy"), QStringLiteral("family: woman, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F466\U0000200D\U0001F466"), QStringLiteral("family: woman, boy, boy"), QStringLiteral("family: woman, boy, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F467"), QStringLiteral("family: woman, girl"), QStringLiteral("family: woman, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F467\U0000200D\U0001F466"), QStringLiteral("family: woman, girl, boy"), QStringLiteral("family: woman, girl, boy")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0000200D\U0001F467\U0000200D\U0001F467"), QStringLiteral("family: woman, girl, girl"), QStringLiteral("family: woman, girl, girl")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5E3\U0000FE0F"), QStringLiteral("speaking head"), QStringLiteral("speaking head")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F464"), QStringLiteral("bust_in_silhouette"), QStringLiteral("bust in silhouette")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F465"), QStringLiteral("busts_in_silhouette"), QStringLiteral("busts in silhouette")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC2"), QStringLiteral("people hugging"), QStringLiteral("people hugging")}));
-_emojis[People].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F463"), QStringLiteral("footprints"), QStringLiteral("footprints")}));
-_emojis[Component].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B0"), QStringLiteral("red_haired"), QStringLiteral("red hair")}));
-_emojis[Component].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B1"), QStringLiteral("curly_haired"), QStringLiteral("curly hair")}));
-_emojis[Component].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B3"), QStringLiteral("white_haired"), QStringLiteral("white hair")}));
-_emojis[Component].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B2"), QStringLiteral("bald"), QStringLiteral("bald")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F435"), QStringLiteral("monkey_face"), QStringLiteral("monkey face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F412"), QStringLiteral("monkey"), QStringLiteral("monkey")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F98D"), QStringLiteral("gorilla"), QStringLiteral("gorilla")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A7"), QStringLiteral("orangutan"), QStringLiteral("orangutan")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F436"), QStringLiteral("dog"), QStringLiteral("dog face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F415"), QStringLiteral("dog2"), QStringLiteral("dog")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9AE"), QStringLiteral("guide dog"), QStringLiteral("guide dog")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F415\U0000200D\U0001F9BA"), QStringLiteral("service dog"), QStringLiteral("service dog")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F429"), QStringLiteral("poodle"), QStringLiteral("poodle")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F43A"), QStringLiteral("wolf"), QStringLiteral("wolf")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F98A"), QStringLiteral("fox"), QStringLiteral("fox")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F99D"), QStringLiteral("raccoon"), QStringLiteral("raccoon")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F431"), QStringLiteral("cat"), QStringLiteral("cat face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F408"), QStringLiteral("cat2"), QStringLiteral("cat")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F408\U0000200D\U00002B1B"), QStringLiteral("black cat"), QStringLiteral("black cat")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F981"), QStringLiteral("lion_face"), QStringLiteral("lion")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F42F"), QStringLiteral("tiger"), QStringLiteral("tiger face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F405"), QStringLiteral("tiger2"), QStringLiteral("tiger")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F406"), QStringLiteral("leopard"), QStringLiteral("leopard")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F434"), QStringLiteral("horse"), QStringLiteral("horse face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F40E"), QStringLiteral("racehorse"), QStringLiteral("horse")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F984"), QStringLiteral("unicorn"), QStringLiteral("unicorn")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F993"), QStringLiteral("zebra"), QStringLiteral("zebra")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F98C"), QStringLiteral("deer"), QStringLiteral("deer")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9AC"), QStringLiteral("bison"), QStringLiteral("bison")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F42E"), QStringLiteral("cow"), QStringLiteral("cow face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F402"), QStringLiteral("ox"), QStringLiteral("ox")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F403"), QStringLiteral("water_buffalo"), QStringLiteral("water buffalo")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F404"), QStringLiteral("cow2"), QStringLiteral("cow")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F437"), QStringLiteral("pig"), QStringLiteral("pig face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F416"), QStringLiteral("pig2"), QStringLiteral("pig")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F417"), QStringLiteral("boar"), QStringLiteral("boar")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F43D"), QStringLiteral("pig_nose"), QStringLiteral("pig nose")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F40F"), QStringLiteral("ram"), QStringLiteral("ram")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F411"), QStringLiteral("sheep"), QStringLiteral("ewe")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F410"), QStringLiteral("goat"), QStringLiteral("goat")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F42A"), QStringLiteral("dromedary_camel"), QStringLiteral("camel")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F42B"), QStringLiteral("camel"), QStringLiteral("two-hump camel")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F999"), QStringLiteral("llama"), QStringLiteral("llama")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F992"), QStringLiteral("giraffe"), QStringLiteral("giraffe")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F418"), QStringLiteral("elephant"), QStringLiteral("elephant")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A3"), QStringLiteral("mammoth"), QStringLiteral("mammoth")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F98F"), QStringLiteral("rhino"), QStringLiteral("rhinoceros")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F99B"), QStringLiteral("hippopotamus"), QStringLiteral("hippopotamus")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F42D"), QStringLiteral("mouse"), QStringLiteral("mouse face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F401"), QStringLiteral("mouse2"), QStringLiteral("mouse")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F400"), QStringLiteral("rat"), QStringLiteral("rat")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F439"), QStringLiteral("hamster"), QStringLiteral("hamster")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F430"), QStringLiteral("rabbit"), QStringLiteral("rabbit face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F407"), QStringLiteral("rabbit2"), QStringLiteral("rabbit")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F43F\U0000FE0F"), QStringLiteral("chipmunk"), QStringLiteral("chipmunk")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9AB"), QStringLiteral("beaver"), QStringLiteral("beaver")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F994"), QStringLiteral("hedgehog"), QStringLiteral("hedgehog")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F987"), QStringLiteral("bat"), QStringLiteral("bat")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F43B"), QStringLiteral("bear"), QStringLiteral("bear")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F43B\U0000200D\U00002744\U0000FE0F"), QStringLiteral("polar bear"), QStringLiteral("polar bear")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F428"), QStringLiteral("koala"), QStringLiteral("koala")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F43C"), QStringLiteral("panda_face"), QStringLiteral("panda")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A5"), QStringLiteral("sloth"), QStringLiteral("sloth")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A6"), QStringLiteral("otter"), QStringLiteral("otter")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A8"), QStringLiteral("skunk"), QStringLiteral("skunk")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F998"), QStringLiteral("kangaroo"), QStringLiteral("kangaroo")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A1"), QStringLiteral("badger"), QStringLiteral("badger")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F43E"), QStringLiteral("feet"), QStringLiteral("paw prints")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F983"), QStringLiteral("turkey"), QStringLiteral("turkey")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F414"), QStringLiteral("chicken"), QStringLiteral("chicken")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F413"), QStringLiteral("rooster"), QStringLiteral("rooster")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F423"), QStringLiteral("hatching_chick"), QStringLiteral("hatching chick")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F424"), QStringLiteral("baby_chick"), QStringLiteral("baby chick")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F425"), QStringLiteral("hatched_chick"), QStringLiteral("front-facing baby chick")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F426"), QStringLiteral("bird"), QStringLiteral("bird")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F427"), QStringLiteral("penguin"), QStringLiteral("penguin")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F54A\U0000FE0F"), QStringLiteral("dove"), QStringLiteral("dove")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F985"), QStringLiteral("eagle"), QStringLiteral("eagle")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F986"), QStringLiteral("duck"), QStringLiteral("duck")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A2"), QStringLiteral("swan"), QStringLiteral("swan")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F989"), QStringLiteral("owl"), QStringLiteral("owl")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A4"), QStringLiteral("dodo"), QStringLiteral("dodo")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB6"), QStringLiteral("feather"), QStringLiteral("feather")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A9"), QStringLiteral("flamingo"), QStringLiteral("flamingo")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F99A"), QStringLiteral("peacock"), QStringLiteral("peacock")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F99C"), QStringLiteral("parrot"), QStringLiteral("parrot")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F438"), QStringLiteral("frog"), QStringLiteral("frog")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F40A"), QStringLiteral("crocodile"), QStringLiteral("crocodile")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F422"), QStringLiteral("turtle"), QStringLiteral("turtle")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F98E"), QStringLiteral("lizard"), QStringLiteral("lizard")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F40D"), QStringLiteral("snake"), QStringLiteral("snake")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F432"), QStringLiteral("dragon_face"), QStringLiteral("dragon face")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F409"), QStringLiteral("dragon"), QStringLiteral("dragon")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F995"), QStringLiteral("sauropod"), QStringLiteral("sauropod")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F996"), QStringLiteral("t_rex"), QStringLiteral("T-Rex")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F433"), QStringLiteral("whale"), QStringLiteral("spouting whale")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F40B"), QStringLiteral("whale2"), QStringLiteral("whale")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F42C"), QStringLiteral("dolphin"), QStringLiteral("dolphin")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9AD"), QStringLiteral("seal"), QStringLiteral("seal")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F41F"), QStringLiteral("fish"), QStringLiteral("fish")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F420"), QStringLiteral("tropical_fish"), QStringLiteral("tropical fish")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F421"), QStringLiteral("blowfish"), QStringLiteral("blowfish")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F988"), QStringLiteral("shark"), QStringLiteral("shark")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F419"), QStringLiteral("octopus"), QStringLiteral("octopus")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F41A"), QStringLiteral("shell"), QStringLiteral("spiral shell")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB8"), QStringLiteral("coral"), QStringLiteral("coral")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F40C"), QStringLiteral("snail"), QStringLiteral("snail")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F98B"), QStringLiteral("butterfly"), QStringLiteral("butterfly")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F41B"), QStringLiteral("bug"), QStringLiteral("bug")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F41C"), QStringLiteral("ant"), QStringLiteral("ant")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F41D"), QStringLiteral("bee"), QStringLiteral("honeybee")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB2"), QStringLiteral("beetle"), QStringLiteral("beetle")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F41E"), QStringLiteral("beetle"), QStringLiteral("lady beetle")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F997"), QStringLiteral("cricket"), QStringLiteral("cricket")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB3"), QStringLiteral("cockroach"), QStringLiteral("cockroach")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F577\U0000FE0F"), QStringLiteral("spider"), QStringLiteral("spider")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F578\U0000FE0F"), QStringLiteral("spider web"), QStringLiteral("spider web")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F982"), QStringLiteral("scorpion"), QStringLiteral("scorpion")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F99F"), QStringLiteral("mosquito"), QStringLiteral("mosquito")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB0"), QStringLiteral("fly"), QStringLiteral("fly")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB1"), QStringLiteral("worm"), QStringLiteral("worm")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9A0"), QStringLiteral("microbe"), QStringLiteral("microbe")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F490"), QStringLiteral("bouquet"), QStringLiteral("bouquet")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F338"), QStringLiteral("cherry_blossom"), QStringLiteral("cherry blossom")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AE"), QStringLiteral("white_flower"), QStringLiteral("white flower")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB7"), QStringLiteral("lotus"), QStringLiteral("lotus")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F5\U0000FE0F"), QStringLiteral("rosette"), QStringLiteral("rosette")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F339"), QStringLiteral("rose"), QStringLiteral("rose")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F940"), QStringLiteral("wilted_rose"), QStringLiteral("wilted flower")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F33A"), QStringLiteral("hibiscus"), QStringLiteral("hibiscus")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F33B"), QStringLiteral("sunflower"), QStringLiteral("sunflower")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F33C"), QStringLiteral("blossom"), QStringLiteral("blossom")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F337"), QStringLiteral("tulip"), QStringLiteral("tulip")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F331"), QStringLiteral("seedling"), QStringLiteral("seedling")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB4"), QStringLiteral("potted plant"), QStringLiteral("potted plant")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F332"), QStringLiteral("evergreen_tree"), QStringLiteral("evergreen tree")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F333"), QStringLiteral("deciduous_tree"), QStringLiteral("deciduous tree")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F334"), QStringLiteral("palm_tree"), QStringLiteral("palm tree")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F335"), QStringLiteral("cactus"), QStringLiteral("cactus")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F33E"), QStringLiteral("ear_of_rice"), QStringLiteral("sheaf of rice")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F33F"), QStringLiteral("herb"), QStringLiteral("herb")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002618\U0000FE0F"), QStringLiteral("shamrock"), QStringLiteral("shamrock")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F340"), QStringLiteral("four_leaf_clover"), QStringLiteral("four leaf clover")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F341"), QStringLiteral("maple_leaf"), QStringLiteral("maple leaf")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F342"), QStringLiteral("fallen_leaf"), QStringLiteral("fallen leaf")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F343"), QStringLiteral("leaves"), QStringLiteral("leaf fluttering in wind")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB9"), QStringLiteral("empty nest"), QStringLiteral("empty nest")}));
-_emojis[Nature].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FABA"), QStringLiteral("nest with eggs"), QStringLiteral("nest with eggs")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F347"), QStringLiteral("grapes"), QStringLiteral("grapes")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F348"), QStringLiteral("melon"), QStringLiteral("melon")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F349"), QStringLiteral("watermelon"), QStringLiteral("watermelon")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F34A"), QStringLiteral("tangerine"), QStringLiteral("tangerine")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F34B"), QStringLiteral("lemon"), QStringLiteral("lemon")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F34C"), QStringLiteral("banana"), QStringLiteral("banana")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F34D"), QStringLiteral("pineapple"), QStringLiteral("pineapple")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F96D"), QStringLiteral("mango"), QStringLiteral("mango")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F34E"), QStringLiteral("apple"), QStringLiteral("red apple")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F34F"), QStringLiteral("green_apple"), QStringLiteral("green apple")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F350"), QStringLiteral("pear"), QStringLiteral("pear")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F351"), QStringLiteral("peach"), QStringLiteral("peach")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F352"), QStringLiteral("cherries"), QStringLiteral("cherries")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F353"), QStringLiteral("strawberry"), QStringLiteral("strawberry")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD0"), QStringLiteral("blueberries"), QStringLiteral("blueberries")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F95D"), QStringLiteral("kiwi"), QStringLiteral("kiwi fruit")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F345"), QStringLiteral("tomato"), QStringLiteral("tomato")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD2"), QStringLiteral("olive"), QStringLiteral("olive")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F965"), QStringLiteral("coconut"), QStringLiteral("coconut")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F951"), QStringLiteral("avocado"), QStringLiteral("avocado")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F346"), QStringLiteral("eggplant"), QStringLiteral("eggplant")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F954"), QStringLiteral("potato"), QStringLiteral("potato")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F955"), QStringLiteral("carrot"), QStringLiteral("carrot")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F33D"), QStringLiteral("corn"), QStringLiteral("ear of corn")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F336\U0000FE0F"), QStringLiteral("hot pepper"), QStringLiteral("hot pepper")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD1"), QStringLiteral("bell pepper"), QStringLiteral("bell pepper")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F952"), QStringLiteral("cucumber"), QStringLiteral("cucumber")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F96C"), QStringLiteral("leafy_green"), QStringLiteral("leafy green")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F966"), QStringLiteral("broccoli"), QStringLiteral("broccoli")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C4"), QStringLiteral("garlic"), QStringLiteral("garlic")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C5"), QStringLiteral("onion"), QStringLiteral("onion")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F344"), QStringLiteral("mushroom"), QStringLiteral("mushroom")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F95C"), QStringLiteral("peanuts"), QStringLiteral("peanuts")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD8"), QStringLiteral("beans"), QStringLiteral("beans")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F330"), QStringLiteral("chestnut"), QStringLiteral("chestnut")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F35E"), QStringLiteral("bread"), QStringLiteral("bread")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F950"), QStringLiteral("croissant"), QStringLiteral("croissant")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F956"), QStringLiteral("french_bread"), QStringLiteral("baguette bread")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD3"), QStringLiteral("flatbread"), QStringLiteral("flatbread")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F968"), QStringLiteral("pretzel"), QStringLiteral("pretzel")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F96F"), QStringLiteral("bagel"), QStringLiteral("bagel")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F95E"), QStringLiteral("pancakes"), QStringLiteral("pancakes")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C7"), QStringLiteral("waffle"), QStringLiteral("waffle")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C0"), QStringLiteral("cheese"), QStringLiteral("cheese wedge")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F356"), QStringLiteral("meat_on_bone"), QStringLiteral("meat on bone")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F357"), QStringLiteral("poultry_leg"), QStringLiteral("poultry leg")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F969"), QStringLiteral("cut_of_meat"), QStringLiteral("cut of meat")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F953"), QStringLiteral("bacon"), QStringLiteral("bacon")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F354"), QStringLiteral("hamburger"), QStringLiteral("hamburger")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F35F"), QStringLiteral("fries"), QStringLiteral("french fries")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F355"), QStringLiteral("pizza"), QStringLiteral("pizza")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F32D"), QStringLiteral("hotdog"), QStringLiteral("hot dog")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F96A"), QStringLiteral("sandwich"), QStringLiteral("sandwich")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F32E"), QStringLiteral("taco"), QStringLiteral("taco")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F32F"), QStringLiteral("burrito"), QStringLiteral("burrito")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD4"), QStringLiteral("tamale"), QStringLiteral("tamale")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F959"), QStringLiteral("stuffed_flatbread"), QStringLiteral("stuffed flatbread")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C6"), QStringLiteral("falafel"), QStringLiteral("falafel")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F95A"), QStringLiteral("egg"), QStringLiteral("egg")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F373"), QStringLiteral("cooking"), QStringLiteral("cooking")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F958"), QStringLiteral("shallow_pan_of_food"), QStringLiteral("shallow pan of food")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F372"), QStringLiteral("stew"), QStringLiteral("pot of food")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD5"), QStringLiteral("fondue"), QStringLiteral("fondue")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F963"), QStringLiteral("bowl_with_spoon"), QStringLiteral("bowl with spoon")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F957"), QStringLiteral("salad"), QStringLiteral("green salad")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F37F"), QStringLiteral("popcorn"), QStringLiteral("popcorn")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C8"), QStringLiteral("butter"), QStringLiteral("butter")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C2"), QStringLiteral("salt"), QStringLiteral("salt")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F96B"), QStringLiteral("canned_food"), QStringLiteral("canned food")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F371"), QStringLiteral("bento"), QStringLiteral("bento box")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F358"), QStringLiteral("rice_cracker"), QStringLiteral("rice cracker")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F359"), QStringLiteral("rice_ball"), QStringLiteral("rice ball")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F35A"), QStringLiteral("rice"), QStringLiteral("cooked rice")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F35B"), QStringLiteral("curry"), QStringLiteral("curry rice")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F35C"), QStringLiteral("ramen"), QStringLiteral("steaming bowl")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F35D"), QStringLiteral("spaghetti"), QStringLiteral("spaghetti")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F360"), QStringLiteral("sweet_potato"), QStringLiteral("roasted sweet potato")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F362"), QStringLiteral("oden"), QStringLiteral("oden")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F363"), QStringLiteral("sushi"), QStringLiteral("sushi")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F364"), QStringLiteral("fried_shrimp"), QStringLiteral("fried shrimp")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F365"), QStringLiteral("fish_cake"), QStringLiteral("fish cake with swirl")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F96E"), QStringLiteral("moon_cake"), QStringLiteral("moon cake")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F361"), QStringLiteral("dango"), QStringLiteral("dango")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F95F"), QStringLiteral("dumpling"), QStringLiteral("dumpling")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F960"), QStringLiteral("fortune_cookie"), QStringLiteral("fortune cookie")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F961"), QStringLiteral("takeout_box"), QStringLiteral("takeout box")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F980"), QStringLiteral("crab"), QStringLiteral("crab")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F99E"), QStringLiteral("lobster"), QStringLiteral("lobster")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F990"), QStringLiteral("shrimp"), QStringLiteral("shrimp")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F991"), QStringLiteral("squid"), QStringLiteral("squid")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9AA"), QStringLiteral("oyster"), QStringLiteral("oyster")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F366"), QStringLiteral("icecream"), QStringLiteral("soft ice cream")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F367"), QStringLiteral("shaved_ice"), QStringLiteral("shaved ice")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F368"), QStringLiteral("ice_cream"), QStringLiteral("ice cream")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F369"), QStringLiteral("doughnut"), QStringLiteral("doughnut")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F36A"), QStringLiteral("cookie"), QStringLiteral("cookie")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F382"), QStringLiteral("birthday"), QStringLiteral("birthday cake")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F370"), QStringLiteral("cake"), QStringLiteral("shortcake")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C1"), QStringLiteral("cupcake"), QStringLiteral("cupcake")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F967"), QStringLiteral("pie"), QStringLiteral("pie")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F36B"), QStringLiteral("chocolate_bar"), QStringLiteral("chocolate bar")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F36C"), QStringLiteral("candy"), QStringLiteral("candy")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F36D"), QStringLiteral("lollipop"), QStringLiteral("lollipop")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F36E"), QStringLiteral("custard"), QStringLiteral("custard")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F36F"), QStringLiteral("honey_pot"), QStringLiteral("honey pot")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F37C"), QStringLiteral("baby_bottle"), QStringLiteral("baby bottle")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F95B"), QStringLiteral("milk"), QStringLiteral("glass of milk")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002615"), QStringLiteral("coffee"), QStringLiteral("hot beverage")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD6"), QStringLiteral("teapot"), QStringLiteral("teapot")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F375"), QStringLiteral("tea"), QStringLiteral("teacup without handle")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F376"), QStringLiteral("sake"), QStringLiteral("sake")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F37E"), QStringLiteral("champagne"), QStringLiteral("bottle with popping cork")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F377"), QStringLiteral("wine_glass"), QStringLiteral("wine glass")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F378"), QStringLiteral("cocktail"), QStringLiteral("cocktail glass")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F379"), QStringLiteral("tropical_drink"), QStringLiteral("tropical drink")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F37A"), QStringLiteral("beer"), QStringLiteral("beer mug")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F37B"), QStringLiteral("beers"), QStringLiteral("clinking beer mugs")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F942"), QStringLiteral("champagne_glass"), QStringLiteral("clinking glasses")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F943"), QStringLiteral("tumbler_glass"), QStringLiteral("tumbler glass")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD7"), QStringLiteral("pouring liquid"), QStringLiteral("pouring liquid")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F964"), QStringLiteral("cup_with_straw"), QStringLiteral("cup with straw")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CB"), QStringLiteral("bubble tea"), QStringLiteral("bubble tea")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C3"), QStringLiteral("beverage box"), QStringLiteral("beverage box")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9C9"), QStringLiteral("mate"), QStringLiteral("mate")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CA"), QStringLiteral("ice"), QStringLiteral("ice")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F962"), QStringLiteral("chopsticks"), QStringLiteral("chopsticks")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F37D\U0000FE0F"), QStringLiteral("fork and knife with plate"), QStringLiteral("fork and knife with plate")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F374"), QStringLiteral("fork_and_knife"), QStringLiteral("fork and knife")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F944"), QStringLiteral("spoon"), QStringLiteral("spoon")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F52A"), QStringLiteral("knife"), QStringLiteral("kitchen knife")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAD9"), QStringLiteral("jar"), QStringLiteral("jar")}));
-_emojis[Food].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3FA"), QStringLiteral("amphora"), QStringLiteral("amphora")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F30D"), QStringLiteral("earth_africa"), QStringLiteral("globe showing Europe-Africa")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F30E"), QStringLiteral("earth_americas"), QStringLiteral("globe showing Americas")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F30F"), QStringLiteral("earth_asia"), QStringLiteral("globe showing Asia-Australia")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F310"), QStringLiteral("globe_with_meridians"), QStringLiteral("globe with meridians")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5FA\U0000FE0F"), QStringLiteral("world map"), QStringLiteral("world map")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5FE"), QStringLiteral("japan"), QStringLiteral("map of Japan")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9ED"), QStringLiteral("compass"), QStringLiteral("compass")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D4\U0000FE0F"), QStringLiteral("snow-capped mountain"), QStringLiteral("snow-capped mountain")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F0\U0000FE0F"), QStringLiteral("mountain"), QStringLiteral("mountain")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F30B"), QStringLiteral("volcano"), QStringLiteral("volcano")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5FB"), QStringLiteral("mount_fuji"), QStringLiteral("mount fuji")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D5\U0000FE0F"), QStringLiteral("camping"), QStringLiteral("camping")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D6\U0000FE0F"), QStringLiteral("beach with umbrella"), QStringLiteral("beach with umbrella")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3DC\U0000FE0F"), QStringLiteral("desert"), QStringLiteral("desert")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3DD\U0000FE0F"), QStringLiteral("desert island"), QStringLiteral("desert island")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3DE\U0000FE0F"), QStringLiteral("national park"), QStringLiteral("national park")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3DF\U0000FE0F"), QStringLiteral("stadium"), QStringLiteral("stadium")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3DB\U0000FE0F"), QStringLiteral("classical building"), QStringLiteral("classical building")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D7\U0000FE0F"), QStringLiteral("building construction"), QStringLiteral("building construction")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F1"), QStringLiteral("bricks"), QStringLiteral("brick")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA8"), QStringLiteral("rock"), QStringLiteral("rock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAB5"), QStringLiteral("wood"), QStringLiteral("wood")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6D6"), QStringLiteral("hut"), QStringLiteral("hut")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D8\U0000FE0F"), QStringLiteral("houses"), QStringLiteral("houses")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3DA\U0000FE0F"), QStringLiteral("derelict house"), QStringLiteral("derelict house")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E0"), QStringLiteral("house"), QStringLiteral("house")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E1"), QStringLiteral("house_with_garden"), QStringLiteral("house with garden")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E2"), QStringLiteral("office"), QStringLiteral("office building")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E3"), QStringLiteral("post_office"), QStringLiteral("Japanese post office")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E4"), QStringLiteral("european_post_office"), QStringLiteral("post office")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E5"), QStringLiteral("hospital"), QStringLiteral("hospital")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E6"), QStringLiteral("bank"), QStringLiteral("bank")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E8"), QStringLiteral("hotel"), QStringLiteral("hotel")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E9"), QStringLiteral("love_hotel"), QStringLiteral("love hotel")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3EA"), QStringLiteral("convenience_store"), QStringLiteral("convenience store")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3EB"), QStringLiteral("school"), QStringLiteral("school")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3EC"), QStringLiteral("department_store"), QStringLiteral("department store")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3ED"), QStringLiteral("factory"), QStringLiteral("factory")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3EF"), QStringLiteral("japanese_castle"), QStringLiteral("Japanese castle")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F0"), QStringLiteral("european_castle"), QStringLiteral("castle")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F492"), QStringLiteral("wedding"), QStringLiteral("wedding")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5FC"), QStringLiteral("tokyo_tower"), QStringLiteral("Tokyo tower")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5FD"), QStringLiteral("statue_of_liberty"), QStringLiteral("Statue of Liberty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026EA"), QStringLiteral("church"), QStringLiteral("church")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F54C"), QStringLiteral("mosque"), QStringLiteral("mosque")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6D5"), QStringLiteral("hindu temple"), QStringLiteral("hindu temple")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F54D"), QStringLiteral("synagogue"), QStringLiteral("synagogue")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026E9\U0000FE0F"), QStringLiteral("shinto shrine"), QStringLiteral("shinto shrine")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F54B"), QStringLiteral("kaaba"), QStringLiteral("kaaba")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F2"), QStringLiteral("fountain"), QStringLiteral("fountain")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026FA"), QStringLiteral("tent"), QStringLiteral("tent")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F301"), QStringLiteral("foggy"), QStringLiteral("foggy")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F303"), QStringLiteral("night_with_stars"), QStringLiteral("night with stars")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D9\U0000FE0F"), QStringLiteral("cityscape"), QStringLiteral("cityscape")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F304"), QStringLiteral("sunrise_over_mountains"), QStringLiteral("sunrise over mountains")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F305"), QStringLiteral("sunrise"), QStringLiteral("sunrise")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F306"), QStringLiteral("city_dusk"), QStringLiteral("cityscape at dusk")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F307"), QStringLiteral("city_sunset"), QStringLiteral("sunset")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F309"), QStringLiteral("bridge_at_night"), QStringLiteral("bridge at night")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002668\U0000FE0F"), QStringLiteral("hot springs"), QStringLiteral("hot springs")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A0"), QStringLiteral("carousel_horse"), QStringLiteral("carousel horse")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6DD"), QStringLiteral("playground slide"), QStringLiteral("playground slide")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A1"), QStringLiteral("ferris_wheel"), QStringLiteral("ferris wheel")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A2"), QStringLiteral("roller_coaster"), QStringLiteral("roller coaster")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F488"), QStringLiteral("barber"), QStringLiteral("barber pole")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3AA"), QStringLiteral("circus_tent"), QStringLiteral("circus tent")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F682"), QStringLiteral("steam_locomotive"), QStringLiteral("locomotive")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F683"), QStringLiteral("railway_car"), QStringLiteral("railway car")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F684"), QStringLiteral("bullettrain_side"), QStringLiteral("high-speed train")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F685"), QStringLiteral("bullettrain_front"), QStringLiteral("bullet train")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F686"), QStringLiteral("train2"), QStringLiteral("train")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F687"), QStringLiteral("metro"), QStringLiteral("metro")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F688"), QStringLiteral("light_rail"), QStringLiteral("light rail")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F689"), QStringLiteral("station"), QStringLiteral("station")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F68A"), QStringLiteral("tram"), QStringLiteral("tram")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F69D"), QStringLiteral("monorail"), QStringLiteral("monorail")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F69E"), QStringLiteral("mountain_railway"), QStringLiteral("mountain railway")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F68B"), QStringLiteral("train"), QStringLiteral("tram car")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F68C"), QStringLiteral("bus"), QStringLiteral("bus")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F68D"), QStringLiteral("oncoming_bus"), QStringLiteral("oncoming bus")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F68E"), QStringLiteral("trolleybus"), QStringLiteral("trolleybus")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F690"), QStringLiteral("minibus"), QStringLiteral("minibus")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F691"), QStringLiteral("ambulance"), QStringLiteral("ambulance")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F692"), QStringLiteral("fire_engine"), QStringLiteral("fire engine")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F693"), QStringLiteral("police_car"), QStringLiteral("police car")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F694"), QStringLiteral("oncoming_police_car"), QStringLiteral("oncoming police car")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F695"), QStringLiteral("taxi"), QStringLiteral("taxi")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F696"), QStringLiteral("oncoming_taxi"), QStringLiteral("oncoming taxi")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F697"), QStringLiteral("red_car"), QStringLiteral("automobile")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F698"), QStringLiteral("oncoming_automobile"), QStringLiteral("oncoming automobile")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F699"), QStringLiteral("blue_car"), QStringLiteral("sport utility vehicle")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6FB"), QStringLiteral("pickup truck"), QStringLiteral("pickup truck")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F69A"), QStringLiteral("truck"), QStringLiteral("delivery truck")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F69B"), QStringLiteral("articulated_lorry"), QStringLiteral("articulated lorry")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F69C"), QStringLiteral("tractor"), QStringLiteral("tractor")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CE\U0000FE0F"), QStringLiteral("racing car"), QStringLiteral("racing car")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CD\U0000FE0F"), QStringLiteral("motorcycle"), QStringLiteral("motorcycle")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6F5"), QStringLiteral("motor_scooter"), QStringLiteral("motor scooter")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BD"), QStringLiteral("manual wheelchair"), QStringLiteral("manual wheelchair")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BC"), QStringLiteral("motorized wheelchair"), QStringLiteral("motorized wheelchair")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6FA"), QStringLiteral("auto rickshaw"), QStringLiteral("auto rickshaw")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B2"), QStringLiteral("bike"), QStringLiteral("bicycle")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6F4"), QStringLiteral("scooter"), QStringLiteral("kick scooter")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6F9"), QStringLiteral("skateboard"), QStringLiteral("skateboard")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6FC"), QStringLiteral("roller skate"), QStringLiteral("roller skate")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F68F"), QStringLiteral("busstop"), QStringLiteral("bus stop")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6E3\U0000FE0F"), QStringLiteral("motorway"), QStringLiteral("motorway")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6E4\U0000FE0F"), QStringLiteral("railway track"), QStringLiteral("railway track")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6E2\U0000FE0F"), QStringLiteral("oil drum"), QStringLiteral("oil drum")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026FD"), QStringLiteral("fuelpump"), QStringLiteral("fuel pump")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6DE"), QStringLiteral("wheel"), QStringLiteral("wheel")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A8"), QStringLiteral("rotating_light"), QStringLiteral("police car light")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A5"), QStringLiteral("traffic_light"), QStringLiteral("horizontal traffic light")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A6"), QStringLiteral("vertical_traffic_light"), QStringLiteral("vertical traffic light")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6D1"), QStringLiteral("octagonal_sign"), QStringLiteral("stop sign")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A7"), QStringLiteral("construction"), QStringLiteral("construction")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002693"), QStringLiteral("anchor"), QStringLiteral("anchor")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6DF"), QStringLiteral("ring buoy"), QStringLiteral("ring buoy")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F5"), QStringLiteral("sailboat"), QStringLiteral("sailboat")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6F6"), QStringLiteral("canoe"), QStringLiteral("canoe")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A4"), QStringLiteral("speedboat"), QStringLiteral("speedboat")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6F3\U0000FE0F"), QStringLiteral("passenger ship"), QStringLiteral("passenger ship")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F4\U0000FE0F"), QStringLiteral("ferry"), QStringLiteral("ferry")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6E5\U0000FE0F"), QStringLiteral("motor boat"), QStringLiteral("motor boat")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A2"), QStringLiteral("ship"), QStringLiteral("ship")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002708\U0000FE0F"), QStringLiteral("airplane"), QStringLiteral("airplane")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6E9\U0000FE0F"), QStringLiteral("small airplane"), QStringLiteral("small airplane")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6EB"), QStringLiteral("airplane_departure"), QStringLiteral("airplane departure")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6EC"), QStringLiteral("airplane_arriving"), QStringLiteral("airplane arrival")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA82"), QStringLiteral("parachute"), QStringLiteral("parachute")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4BA"), QStringLiteral("seat"), QStringLiteral("seat")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F681"), QStringLiteral("helicopter"), QStringLiteral("helicopter")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F69F"), QStringLiteral("suspension_railway"), QStringLiteral("suspension railway")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A0"), QStringLiteral("mountain_cableway"), QStringLiteral("mountain cableway")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A1"), QStringLiteral("aerial_tramway"), QStringLiteral("aerial tramway")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6F0\U0000FE0F"), QStringLiteral("satellite"), QStringLiteral("satellite")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F680"), QStringLiteral("rocket"), QStringLiteral("rocket")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6F8"), QStringLiteral("flying_saucer"), QStringLiteral("flying saucer")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CE\U0000FE0F"), QStringLiteral("bellhop bell"), QStringLiteral("bellhop bell")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F3"), QStringLiteral("luggage"), QStringLiteral("luggage")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000231B"), QStringLiteral("hourglass"), QStringLiteral("hourglass done")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023F3"), QStringLiteral("hourglass_flowing_sand"), QStringLiteral("hourglass not done")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000231A"), QStringLiteral("watch"), QStringLiteral("watch")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023F0"), QStringLiteral("alarm_clock"), QStringLiteral("alarm clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023F1\U0000FE0F"), QStringLiteral("stopwatch"), QStringLiteral("stopwatch")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023F2\U0000FE0F"), QStringLiteral("timer clock"), QStringLiteral("timer clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F570\U0000FE0F"), QStringLiteral("mantelpiece clock"), QStringLiteral("mantelpiece clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F55B"), QStringLiteral("clock12"), QStringLiteral("twelve o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F567"), QStringLiteral("clock1230"), QStringLiteral("twelve-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F550"), QStringLiteral("clock1"), QStringLiteral("one o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F55C"), QStringLiteral("clock130"), QStringLiteral("one-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F551"), QStringLiteral("clock2"), QStringLiteral("two o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F55D"), QStringLiteral("clock230"), QStringLiteral("two-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F552"), QStringLiteral("clock3"), QStringLiteral("three o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F55E"), QStringLiteral("clock330"), QStringLiteral("three-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F553"), QStringLiteral("clock4"), QStringLiteral("four o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F55F"), QStringLiteral("clock430"), QStringLiteral("four-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F554"), QStringLiteral("clock5"), QStringLiteral("five o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F560"), QStringLiteral("clock530"), QStringLiteral("five-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F555"), QStringLiteral("clock6"), QStringLiteral("six o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F561"), QStringLiteral("clock630"), QStringLiteral("six-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F556"), QStringLiteral("clock7"), QStringLiteral("seven o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F562"), QStringLiteral("clock730"), QStringLiteral("seven-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F557"), QStringLiteral("clock8"), QStringLiteral("eight o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F563"), QStringLiteral("clock830"), QStringLiteral("eight-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F558"), QStringLiteral("clock9"), QStringLiteral("nine o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F564"), QStringLiteral("clock930"), QStringLiteral("nine-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F559"), QStringLiteral("clock10"), QStringLiteral("ten o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F565"), QStringLiteral("clock1030"), QStringLiteral("ten-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F55A"), QStringLiteral("clock11"), QStringLiteral("eleven o’clock")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F566"), QStringLiteral("clock1130"), QStringLiteral("eleven-thirty")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F311"), QStringLiteral("new_moon"), QStringLiteral("new moon")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F312"), QStringLiteral("waxing_crescent_moon"), QStringLiteral("waxing crescent moon")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F313"), QStringLiteral("first_quarter_moon"), QStringLiteral("first quarter moon")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F314"), QStringLiteral("waxing_gibbous_moon"), QStringLiteral("waxing gibbous moon")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F315"), QStringLiteral("full_moon"), QStringLiteral("full moon")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F316"), QStringLiteral("waning_gibbous_moon"), QStringLiteral("waning gibbous moon")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F317"), QStringLiteral("last_quarter_moon"), QStringLiteral("last quarter moon")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F318"), QStringLiteral("waning_crescent_moon"), QStringLiteral("waning crescent moon")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F319"), QStringLiteral("crescent_moon"), QStringLiteral("crescent moon")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F31A"), QStringLiteral("new_moon_with_face"), QStringLiteral("new moon face")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F31B"), QStringLiteral("first_quarter_moon_with_face"), QStringLiteral("first quarter moon face")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F31C"), QStringLiteral("last_quarter_moon_with_face"), QStringLiteral("last quarter moon face")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F321\U0000FE0F"), QStringLiteral("thermometer"), QStringLiteral("thermometer")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002600\U0000FE0F"), QStringLiteral("sun"), QStringLiteral("sun")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F31D"), QStringLiteral("full_moon_with_face"), QStringLiteral("full moon face")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F31E"), QStringLiteral("sun_with_face"), QStringLiteral("sun with face")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA90"), QStringLiteral("ringed planet"), QStringLiteral("ringed planet")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002B50"), QStringLiteral("star"), QStringLiteral("star")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F31F"), QStringLiteral("star2"), QStringLiteral("glowing star")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F320"), QStringLiteral("stars"), QStringLiteral("shooting star")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F30C"), QStringLiteral("milky_way"), QStringLiteral("milky way")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002601\U0000FE0F"), QStringLiteral("cloud"), QStringLiteral("cloud")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026C5"), QStringLiteral("partly_sunny"), QStringLiteral("sun behind cloud")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026C8\U0000FE0F"), QStringLiteral("cloud with lightning and rain"), QStringLiteral("cloud with lightning and rain")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F324\U0000FE0F"), QStringLiteral("sun behind small cloud"), QStringLiteral("sun behind small cloud")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F325\U0000FE0F"), QStringLiteral("sun behind large cloud"), QStringLiteral("sun behind large cloud")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F326\U0000FE0F"), QStringLiteral("sun behind rain cloud"), QStringLiteral("sun behind rain cloud")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F327\U0000FE0F"), QStringLiteral("cloud with rain"), QStringLiteral("cloud with rain")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F328\U0000FE0F"), QStringLiteral("cloud with snow"), QStringLiteral("cloud with snow")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F329\U0000FE0F"), QStringLiteral("cloud with lightning"), QStringLiteral("cloud with lightning")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F32A\U0000FE0F"), QStringLiteral("tornado"), QStringLiteral("tornado")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F32B\U0000FE0F"), QStringLiteral("fog"), QStringLiteral("fog")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F32C\U0000FE0F"), QStringLiteral("wind face"), QStringLiteral("wind face")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F300"), QStringLiteral("cyclone"), QStringLiteral("cyclone")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F308"), QStringLiteral("rainbow"), QStringLiteral("rainbow")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F302"), QStringLiteral("closed_umbrella"), QStringLiteral("closed umbrella")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002602\U0000FE0F"), QStringLiteral("umbrella"), QStringLiteral("umbrella")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002614"), QStringLiteral("umbrella"), QStringLiteral("umbrella with rain drops")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F1\U0000FE0F"), QStringLiteral("umbrella on ground"), QStringLiteral("umbrella on ground")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026A1"), QStringLiteral("zap"), QStringLiteral("high voltage")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002744\U0000FE0F"), QStringLiteral("snowflake"), QStringLiteral("snowflake")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002603\U0000FE0F"), QStringLiteral("snowman"), QStringLiteral("snowman")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026C4"), QStringLiteral("snowman"), QStringLiteral("snowman without snow")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002604\U0000FE0F"), QStringLiteral("comet"), QStringLiteral("comet")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F525"), QStringLiteral("fire"), QStringLiteral("fire")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A7"), QStringLiteral("droplet"), QStringLiteral("droplet")}));
-_emojis[Travel].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F30A"), QStringLiteral("ocean"), QStringLiteral("water wave")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F383"), QStringLiteral("jack_o_lantern"), QStringLiteral("jack-o-lantern")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F384"), QStringLiteral("christmas_tree"), QStringLiteral("Christmas tree")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F386"), QStringLiteral("fireworks"), QStringLiteral("fireworks")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F387"), QStringLiteral("sparkler"), QStringLiteral("sparkler")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E8"), QStringLiteral("firecracker"), QStringLiteral("firecracker")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002728"), QStringLiteral("sparkles"), QStringLiteral("sparkles")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F388"), QStringLiteral("balloon"), QStringLiteral("balloon")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F389"), QStringLiteral("tada"), QStringLiteral("party popper")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F38A"), QStringLiteral("confetti_ball"), QStringLiteral("confetti ball")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F38B"), QStringLiteral("tanabata_tree"), QStringLiteral("tanabata tree")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F38D"), QStringLiteral("bamboo"), QStringLiteral("pine decoration")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F38E"), QStringLiteral("dolls"), QStringLiteral("Japanese dolls")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F38F"), QStringLiteral("flags"), QStringLiteral("carp streamer")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F390"), QStringLiteral("wind_chime"), QStringLiteral("wind chime")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F391"), QStringLiteral("rice_scene"), QStringLiteral("moon viewing ceremony")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E7"), QStringLiteral("red_envelope"), QStringLiteral("red envelope")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F380"), QStringLiteral("ribbon"), QStringLiteral("ribbon")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F381"), QStringLiteral("gift"), QStringLiteral("wrapped gift")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F397\U0000FE0F"), QStringLiteral("reminder ribbon"), QStringLiteral("reminder ribbon")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F39F\U0000FE0F"), QStringLiteral("admission tickets"), QStringLiteral("admission tickets")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3AB"), QStringLiteral("ticket"), QStringLiteral("ticket")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F396\U0000FE0F"), QStringLiteral("military medal"), QStringLiteral("military medal")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C6"), QStringLiteral("trophy"), QStringLiteral("trophy")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C5"), QStringLiteral("medal"), QStringLiteral("sports medal")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F947"), QStringLiteral("first_place"), QStringLiteral("1st place medal")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F948"), QStringLiteral("second_place"), QStringLiteral("2nd place medal")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F949"), QStringLiteral("third_place"), QStringLiteral("3rd place medal")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026BD"), QStringLiteral("soccer"), QStringLiteral("soccer ball")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026BE"), QStringLiteral("baseball"), QStringLiteral("baseball")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F94E"), QStringLiteral("softball"), QStringLiteral("softball")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C0"), QStringLiteral("basketball"), QStringLiteral("basketball")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D0"), QStringLiteral("volleyball"), QStringLiteral("volleyball")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C8"), QStringLiteral("football"), QStringLiteral("american football")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C9"), QStringLiteral("rugby_football"), QStringLiteral("rugby football")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3BE"), QStringLiteral("tennis"), QStringLiteral("tennis")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F94F"), QStringLiteral("flying_disc"), QStringLiteral("flying disc")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B3"), QStringLiteral("bowling"), QStringLiteral("bowling")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CF"), QStringLiteral("cricket game"), QStringLiteral("cricket game")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D1"), QStringLiteral("field_hockey"), QStringLiteral("field hockey")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D2"), QStringLiteral("hockey"), QStringLiteral("ice hockey")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F94D"), QStringLiteral("lacrosse"), QStringLiteral("lacrosse")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3D3"), QStringLiteral("ping_pong"), QStringLiteral("ping pong")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F8"), QStringLiteral("badminton"), QStringLiteral("badminton")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F94A"), QStringLiteral("boxing_glove"), QStringLiteral("boxing glove")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F94B"), QStringLiteral("martial_arts_uniform"), QStringLiteral("martial arts uniform")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F945"), QStringLiteral("goal"), QStringLiteral("goal net")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F3"), QStringLiteral("golf"), QStringLiteral("flag in hole")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F8\U0000FE0F"), QStringLiteral("ice skate"), QStringLiteral("ice skate")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A3"), QStringLiteral("fishing_pole_and_fish"), QStringLiteral("fishing pole")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93F"), QStringLiteral("diving mask"), QStringLiteral("diving mask")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3BD"), QStringLiteral("running_shirt_with_sash"), QStringLiteral("running shirt")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3BF"), QStringLiteral("ski"), QStringLiteral("skis")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6F7"), QStringLiteral("sled"), QStringLiteral("sled")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F94C"), QStringLiteral("curling_stone"), QStringLiteral("curling stone")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3AF"), QStringLiteral("dart"), QStringLiteral("bullseye")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA80"), QStringLiteral("yo-yo"), QStringLiteral("yo-yo")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA81"), QStringLiteral("kite"), QStringLiteral("kite")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B1"), QStringLiteral("8ball"), QStringLiteral("pool 8 ball")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F52E"), QStringLiteral("crystal_ball"), QStringLiteral("crystal ball")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA84"), QStringLiteral("magic wand"), QStringLiteral("magic wand")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9FF"), QStringLiteral("nazar_amulet"), QStringLiteral("nazar amulet")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAAC"), QStringLiteral("hamsa"), QStringLiteral("hamsa")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3AE"), QStringLiteral("video_game"), QStringLiteral("video game")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F579\U0000FE0F"), QStringLiteral("joystick"), QStringLiteral("joystick")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B0"), QStringLiteral("slot_machine"), QStringLiteral("slot machine")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B2"), QStringLiteral("game_die"), QStringLiteral("game die")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E9"), QStringLiteral("jigsaw"), QStringLiteral("puzzle piece")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F8"), QStringLiteral("teddy_bear"), QStringLiteral("teddy bear")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA85"), QStringLiteral("piñata"), QStringLiteral("piñata")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA9"), QStringLiteral("mirror ball"), QStringLiteral("mirror ball")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA86"), QStringLiteral("nesting dolls"), QStringLiteral("nesting dolls")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002660\U0000FE0F"), QStringLiteral("spade suit"), QStringLiteral("spade suit")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002665\U0000FE0F"), QStringLiteral("heart suit"), QStringLiteral("heart suit")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002666\U0000FE0F"), QStringLiteral("diamond suit"), QStringLiteral("diamond suit")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002663\U0000FE0F"), QStringLiteral("club suit"), QStringLiteral("club suit")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000265F\U0000FE0F"), QStringLiteral("chess pawn"), QStringLiteral("chess pawn")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F0CF"), QStringLiteral("black_joker"), QStringLiteral("joker")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F004"), QStringLiteral("mahjong"), QStringLiteral("mahjong red dragon")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B4"), QStringLiteral("flower_playing_cards"), QStringLiteral("flower playing cards")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3AD"), QStringLiteral("performing_arts"), QStringLiteral("performing arts")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5BC\U0000FE0F"), QStringLiteral("framed picture"), QStringLiteral("framed picture")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A8"), QStringLiteral("art"), QStringLiteral("artist palette")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F5"), QStringLiteral("thread"), QStringLiteral("thread")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA1"), QStringLiteral("sewing needle"), QStringLiteral("sewing needle")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F6"), QStringLiteral("yarn"), QStringLiteral("yarn")}));
-_emojis[Activities].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA2"), QStringLiteral("knot"), QStringLiteral("knot")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F453"), QStringLiteral("eyeglasses"), QStringLiteral("glasses")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F576\U0000FE0F"), QStringLiteral("sunglasses"), QStringLiteral("sunglasses")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F97D"), QStringLiteral("goggles"), QStringLiteral("goggles")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F97C"), QStringLiteral("lab_coat"), QStringLiteral("lab coat")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BA"), QStringLiteral("safety vest"), QStringLiteral("safety vest")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F454"), QStringLiteral("necktie"), QStringLiteral("necktie")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F455"), QStringLiteral("shirt"), QStringLiteral("t-shirt")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F456"), QStringLiteral("jeans"), QStringLiteral("jeans")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E3"), QStringLiteral("scarf"), QStringLiteral("scarf")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E4"), QStringLiteral("gloves"), QStringLiteral("gloves")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E5"), QStringLiteral("coat"), QStringLiteral("coat")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E6"), QStringLiteral("socks"), QStringLiteral("socks")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F457"), QStringLiteral("dress"), QStringLiteral("dress")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F458"), QStringLiteral("kimono"), QStringLiteral("kimono")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F97B"), QStringLiteral("sari"), QStringLiteral("sari")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA71"), QStringLiteral("one-piece swimsuit"), QStringLiteral("one-piece swimsuit")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA72"), QStringLiteral("briefs"), QStringLiteral("briefs")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA73"), QStringLiteral("shorts"), QStringLiteral("shorts")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F459"), QStringLiteral("bikini"), QStringLiteral("bikini")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F45A"), QStringLiteral("womans_clothes"), QStringLiteral("woman’s clothes")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F45B"), QStringLiteral("purse"), QStringLiteral("purse")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F45C"), QStringLiteral("handbag"), QStringLiteral("handbag")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F45D"), QStringLiteral("pouch"), QStringLiteral("clutch bag")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CD\U0000FE0F"), QStringLiteral("shopping bags"), QStringLiteral("shopping bags")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F392"), QStringLiteral("school_satchel"), QStringLiteral("backpack")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA74"), QStringLiteral("thong sandal"), QStringLiteral("thong sandal")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F45E"), QStringLiteral("mans_shoe"), QStringLiteral("man’s shoe")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F45F"), QStringLiteral("athletic_shoe"), QStringLiteral("running shoe")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F97E"), QStringLiteral("hiking_boot"), QStringLiteral("hiking boot")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F97F"), QStringLiteral("womans_flat_shoe"), QStringLiteral("flat shoe")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F460"), QStringLiteral("high_heel"), QStringLiteral("high-heeled shoe")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F461"), QStringLiteral("sandal"), QStringLiteral("woman’s sandal")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA70"), QStringLiteral("ballet shoes"), QStringLiteral("ballet shoes")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F462"), QStringLiteral("boot"), QStringLiteral("woman’s boot")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F451"), QStringLiteral("crown"), QStringLiteral("crown")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F452"), QStringLiteral("womans_hat"), QStringLiteral("woman’s hat")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A9"), QStringLiteral("tophat"), QStringLiteral("top hat")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F393"), QStringLiteral("mortar_board"), QStringLiteral("graduation cap")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9E2"), QStringLiteral("billed_cap"), QStringLiteral("billed cap")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA96"), QStringLiteral("military helmet"), QStringLiteral("military helmet")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026D1\U0000FE0F"), QStringLiteral("rescue worker’s helmet"), QStringLiteral("rescue worker’s helmet")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4FF"), QStringLiteral("prayer_beads"), QStringLiteral("prayer beads")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F484"), QStringLiteral("lipstick"), QStringLiteral("lipstick")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48D"), QStringLiteral("ring"), QStringLiteral("ring")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48E"), QStringLiteral("gem"), QStringLiteral("gem stone")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F507"), QStringLiteral("mute"), QStringLiteral("muted speaker")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F508"), QStringLiteral("speaker"), QStringLiteral("speaker low volume")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F509"), QStringLiteral("sound"), QStringLiteral("speaker medium volume")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F50A"), QStringLiteral("loud_sound"), QStringLiteral("speaker high volume")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E2"), QStringLiteral("loudspeaker"), QStringLiteral("loudspeaker")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E3"), QStringLiteral("mega"), QStringLiteral("megaphone")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4EF"), QStringLiteral("postal_horn"), QStringLiteral("postal horn")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F514"), QStringLiteral("bell"), QStringLiteral("bell")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F515"), QStringLiteral("no_bell"), QStringLiteral("bell with slash")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3BC"), QStringLiteral("musical_score"), QStringLiteral("musical score")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B5"), QStringLiteral("musical_note"), QStringLiteral("musical note")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B6"), QStringLiteral("notes"), QStringLiteral("musical notes")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F399\U0000FE0F"), QStringLiteral("studio microphone"), QStringLiteral("studio microphone")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F39A\U0000FE0F"), QStringLiteral("level slider"), QStringLiteral("level slider")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F39B\U0000FE0F"), QStringLiteral("control knobs"), QStringLiteral("control knobs")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A4"), QStringLiteral("microphone"), QStringLiteral("microphone")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A7"), QStringLiteral("headphones"), QStringLiteral("headphone")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4FB"), QStringLiteral("radio"), QStringLiteral("radio")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B7"), QStringLiteral("saxophone"), QStringLiteral("saxophone")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA97"), QStringLiteral("accordion"), QStringLiteral("accordion")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B8"), QStringLiteral("guitar"), QStringLiteral("guitar")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3B9"), QStringLiteral("musical_keyboard"), QStringLiteral("musical keyboard")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3BA"), QStringLiteral("trumpet"), QStringLiteral("trumpet")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3BB"), QStringLiteral("violin"), QStringLiteral("violin")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA95"), QStringLiteral("banjo"), QStringLiteral("banjo")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F941"), QStringLiteral("drum"), QStringLiteral("drum")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA98"), QStringLiteral("long drum"), QStringLiteral("long drum")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F1"), QStringLiteral("iphone"), QStringLiteral("mobile phone")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F2"), QStringLiteral("calling"), QStringLiteral("mobile phone with arrow")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000260E\U0000FE0F"), QStringLiteral("telephone"), QStringLiteral("telephone")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4DE"), QStringLiteral("telephone_receiver"), QStringLiteral("telephone receiver")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4DF"), QStringLiteral("pager"), QStringLiteral("pager")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E0"), QStringLiteral("fax"), QStringLiteral("fax machine")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F50B"), QStringLiteral("battery"), QStringLiteral("battery")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAAB"), QStringLiteral("low battery"), QStringLiteral("low battery")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F50C"), QStringLiteral("electric_plug"), QStringLiteral("electric plug")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4BB"), QStringLiteral("computer"), QStringLiteral("laptop")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5A5\U0000FE0F"), QStringLiteral("desktop computer"), QStringLiteral("desktop computer")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5A8\U0000FE0F"), QStringLiteral("printer"), QStringLiteral("printer")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002328\U0000FE0F"), QStringLiteral("keyboard"), QStringLiteral("keyboard")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5B1\U0000FE0F"), QStringLiteral("computer mouse"), QStringLiteral("computer mouse")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5B2\U0000FE0F"), QStringLiteral("trackball"), QStringLiteral("trackball")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4BD"), QStringLiteral("minidisc"), QStringLiteral("computer disk")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4BE"), QStringLiteral("floppy_disk"), QStringLiteral("floppy disk")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4BF"), QStringLiteral("cd"), QStringLiteral("optical disk")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C0"), QStringLiteral("dvd"), QStringLiteral("dvd")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9EE"), QStringLiteral("abacus"), QStringLiteral("abacus")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A5"), QStringLiteral("movie_camera"), QStringLiteral("movie camera")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F39E\U0000FE0F"), QStringLiteral("film frames"), QStringLiteral("film frames")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4FD\U0000FE0F"), QStringLiteral("film projector"), QStringLiteral("film projector")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3AC"), QStringLiteral("clapper"), QStringLiteral("clapper board")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4FA"), QStringLiteral("tv"), QStringLiteral("television")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F7"), QStringLiteral("camera"), QStringLiteral("camera")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F8"), QStringLiteral("camera_with_flash"), QStringLiteral("camera with flash")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F9"), QStringLiteral("video_camera"), QStringLiteral("video camera")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4FC"), QStringLiteral("vhs"), QStringLiteral("videocassette")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F50D"), QStringLiteral("mag"), QStringLiteral("magnifying glass tilted left")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F50E"), QStringLiteral("mag_right"), QStringLiteral("magnifying glass tilted right")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F56F\U0000FE0F"), QStringLiteral("candle"), QStringLiteral("candle")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A1"), QStringLiteral("bulb"), QStringLiteral("light bulb")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F526"), QStringLiteral("flashlight"), QStringLiteral("flashlight")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3EE"), QStringLiteral("izakaya_lantern"), QStringLiteral("red paper lantern")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA94"), QStringLiteral("diya lamp"), QStringLiteral("diya lamp")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D4"), QStringLiteral("notebook_with_decorative_cover"), QStringLiteral("notebook with decorative cover")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D5"), QStringLiteral("closed_book"), QStringLiteral("closed book")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D6"), QStringLiteral("book"), QStringLiteral("open book")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D7"), QStringLiteral("green_book"), QStringLiteral("green book")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D8"), QStringLiteral("blue_book"), QStringLiteral("blue book")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D9"), QStringLiteral("orange_book"), QStringLiteral("orange book")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4DA"), QStringLiteral("books"), QStringLiteral("books")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D3"), QStringLiteral("notebook"), QStringLiteral("notebook")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D2"), QStringLiteral("ledger"), QStringLiteral("ledger")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C3"), QStringLiteral("page_with_curl"), QStringLiteral("page with curl")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4DC"), QStringLiteral("scroll"), QStringLiteral("scroll")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C4"), QStringLiteral("page_facing_up"), QStringLiteral("page facing up")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F0"), QStringLiteral("newspaper"), QStringLiteral("newspaper")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5DE\U0000FE0F"), QStringLiteral("rolled-up newspaper"), QStringLiteral("rolled-up newspaper")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D1"), QStringLiteral("bookmark_tabs"), QStringLiteral("bookmark tabs")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F516"), QStringLiteral("bookmark"), QStringLiteral("bookmark")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F7\U0000FE0F"), QStringLiteral("label"), QStringLiteral("label")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B0"), QStringLiteral("moneybag"), QStringLiteral("money bag")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA99"), QStringLiteral("coin"), QStringLiteral("coin")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B4"), QStringLiteral("yen"), QStringLiteral("yen banknote")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B5"), QStringLiteral("dollar"), QStringLiteral("dollar banknote")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B6"), QStringLiteral("euro"), QStringLiteral("euro banknote")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B7"), QStringLiteral("pound"), QStringLiteral("pound banknote")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B8"), QStringLiteral("money_with_wings"), QStringLiteral("money with wings")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B3"), QStringLiteral("credit_card"), QStringLiteral("credit card")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9FE"), QStringLiteral("receipt"), QStringLiteral("receipt")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B9"), QStringLiteral("chart"), QStringLiteral("chart increasing with yen")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002709\U0000FE0F"), QStringLiteral("envelope"), QStringLiteral("envelope")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E7"), QStringLiteral("e-mail"), QStringLiteral("e-mail")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E8"), QStringLiteral("incoming_envelope"), QStringLiteral("incoming envelope")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E9"), QStringLiteral("envelope_with_arrow"), QStringLiteral("envelope with arrow")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E4"), QStringLiteral("outbox_tray"), QStringLiteral("outbox tray")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E5"), QStringLiteral("inbox_tray"), QStringLiteral("inbox tray")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E6"), QStringLiteral("package"), QStringLiteral("package")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4EB"), QStringLiteral("mailbox"), QStringLiteral("closed mailbox with raised flag")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4EA"), QStringLiteral("mailbox_closed"), QStringLiteral("closed mailbox with lowered flag")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4EC"), QStringLiteral("mailbox_with_mail"), QStringLiteral("open mailbox with raised flag")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4ED"), QStringLiteral("mailbox_with_no_mail"), QStringLiteral("open mailbox with lowered flag")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4EE"), QStringLiteral("postbox"), QStringLiteral("postbox")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5F3\U0000FE0F"), QStringLiteral("ballot box with ballot"), QStringLiteral("ballot box with ballot")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270F\U0000FE0F"), QStringLiteral("pencil"), QStringLiteral("pencil")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002712\U0000FE0F"), QStringLiteral("black nib"), QStringLiteral("black nib")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F58B\U0000FE0F"), QStringLiteral("fountain pen"), QStringLiteral("fountain pen")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F58A\U0000FE0F"), QStringLiteral("pen"), QStringLiteral("pen")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F58C\U0000FE0F"), QStringLiteral("paintbrush"), QStringLiteral("paintbrush")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F58D\U0000FE0F"), QStringLiteral("crayon"), QStringLiteral("crayon")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4DD"), QStringLiteral("pencil"), QStringLiteral("memo")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4BC"), QStringLiteral("briefcase"), QStringLiteral("briefcase")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C1"), QStringLiteral("file_folder"), QStringLiteral("file folder")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C2"), QStringLiteral("open_file_folder"), QStringLiteral("open file folder")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5C2\U0000FE0F"), QStringLiteral("card index dividers"), QStringLiteral("card index dividers")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C5"), QStringLiteral("date"), QStringLiteral("calendar")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C6"), QStringLiteral("calendar"), QStringLiteral("tear-off calendar")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5D2\U0000FE0F"), QStringLiteral("spiral notepad"), QStringLiteral("spiral notepad")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5D3\U0000FE0F"), QStringLiteral("spiral calendar"), QStringLiteral("spiral calendar")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C7"), QStringLiteral("card_index"), QStringLiteral("card index")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C8"), QStringLiteral("chart_with_upwards_trend"), QStringLiteral("chart increasing")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4C9"), QStringLiteral("chart_with_downwards_trend"), QStringLiteral("chart decreasing")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4CA"), QStringLiteral("bar_chart"), QStringLiteral("bar chart")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4CB"), QStringLiteral("clipboard"), QStringLiteral("clipboard")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4CC"), QStringLiteral("pushpin"), QStringLiteral("pushpin")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4CD"), QStringLiteral("round_pushpin"), QStringLiteral("round pushpin")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4CE"), QStringLiteral("paperclip"), QStringLiteral("paperclip")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F587\U0000FE0F"), QStringLiteral("linked paperclips"), QStringLiteral("linked paperclips")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4CF"), QStringLiteral("straight_ruler"), QStringLiteral("straight ruler")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4D0"), QStringLiteral("triangular_ruler"), QStringLiteral("triangular ruler")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002702\U0000FE0F"), QStringLiteral("scissors"), QStringLiteral("scissors")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5C3\U0000FE0F"), QStringLiteral("card file box"), QStringLiteral("card file box")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5C4\U0000FE0F"), QStringLiteral("file cabinet"), QStringLiteral("file cabinet")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5D1\U0000FE0F"), QStringLiteral("wastebasket"), QStringLiteral("wastebasket")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F512"), QStringLiteral("lock"), QStringLiteral("locked")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F513"), QStringLiteral("unlock"), QStringLiteral("unlocked")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F50F"), QStringLiteral("lock_with_ink_pen"), QStringLiteral("locked with pen")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F510"), QStringLiteral("closed_lock_with_key"), QStringLiteral("locked with key")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F511"), QStringLiteral("key"), QStringLiteral("key")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5DD\U0000FE0F"), QStringLiteral("old key"), QStringLiteral("old key")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F528"), QStringLiteral("hammer"), QStringLiteral("hammer")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA93"), QStringLiteral("axe"), QStringLiteral("axe")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026CF\U0000FE0F"), QStringLiteral("pick"), QStringLiteral("pick")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002692\U0000FE0F"), QStringLiteral("hammer and pick"), QStringLiteral("hammer and pick")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6E0\U0000FE0F"), QStringLiteral("hammer and wrench"), QStringLiteral("hammer and wrench")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5E1\U0000FE0F"), QStringLiteral("dagger"), QStringLiteral("dagger")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002694\U0000FE0F"), QStringLiteral("crossed swords"), QStringLiteral("crossed swords")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F52B"), QStringLiteral("gun"), QStringLiteral("water pistol")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA83"), QStringLiteral("boomerang"), QStringLiteral("boomerang")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F9"), QStringLiteral("bow_and_arrow"), QStringLiteral("bow and arrow")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6E1\U0000FE0F"), QStringLiteral("shield"), QStringLiteral("shield")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA9A"), QStringLiteral("carpentry saw"), QStringLiteral("carpentry saw")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F527"), QStringLiteral("wrench"), QStringLiteral("wrench")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA9B"), QStringLiteral("screwdriver"), QStringLiteral("screwdriver")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F529"), QStringLiteral("nut_and_bolt"), QStringLiteral("nut and bolt")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002699\U0000FE0F"), QStringLiteral("gear"), QStringLiteral("gear")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5DC\U0000FE0F"), QStringLiteral("clamp"), QStringLiteral("clamp")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002696\U0000FE0F"), QStringLiteral("balance scale"), QStringLiteral("balance scale")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9AF"), QStringLiteral("white cane"), QStringLiteral("white cane")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F517"), QStringLiteral("link"), QStringLiteral("link")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026D3\U0000FE0F"), QStringLiteral("chains"), QStringLiteral("chains")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA9D"), QStringLiteral("hook"), QStringLiteral("hook")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F0"), QStringLiteral("toolbox"), QStringLiteral("toolbox")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F2"), QStringLiteral("magnet"), QStringLiteral("magnet")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA9C"), QStringLiteral("ladder"), QStringLiteral("ladder")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002697\U0000FE0F"), QStringLiteral("alembic"), QStringLiteral("alembic")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9EA"), QStringLiteral("test_tube"), QStringLiteral("test tube")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9EB"), QStringLiteral("petri_dish"), QStringLiteral("petri dish")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9EC"), QStringLiteral("dna"), QStringLiteral("dna")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F52C"), QStringLiteral("microscope"), QStringLiteral("microscope")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F52D"), QStringLiteral("telescope"), QStringLiteral("telescope")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4E1"), QStringLiteral("satellite"), QStringLiteral("satellite antenna")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F489"), QStringLiteral("syringe"), QStringLiteral("syringe")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA78"), QStringLiteral("drop of blood"), QStringLiteral("drop of blood")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48A"), QStringLiteral("pill"), QStringLiteral("pill")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA79"), QStringLiteral("adhesive bandage"), QStringLiteral("adhesive bandage")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA7C"), QStringLiteral("crutch"), QStringLiteral("crutch")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA7A"), QStringLiteral("stethoscope"), QStringLiteral("stethoscope")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA7B"), QStringLiteral("x-ray"), QStringLiteral("x-ray")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6AA"), QStringLiteral("door"), QStringLiteral("door")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6D7"), QStringLiteral("elevator"), QStringLiteral("elevator")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA9E"), QStringLiteral("mirror"), QStringLiteral("mirror")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA9F"), QStringLiteral("window"), QStringLiteral("window")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CF\U0000FE0F"), QStringLiteral("bed"), QStringLiteral("bed")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CB\U0000FE0F"), QStringLiteral("couch and lamp"), QStringLiteral("couch and lamp")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA91"), QStringLiteral("chair"), QStringLiteral("chair")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6BD"), QStringLiteral("toilet"), QStringLiteral("toilet")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA0"), QStringLiteral("plunger"), QStringLiteral("plunger")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6BF"), QStringLiteral("shower"), QStringLiteral("shower")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C1"), QStringLiteral("bathtub"), QStringLiteral("bathtub")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA4"), QStringLiteral("mouse trap"), QStringLiteral("mouse trap")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FA92"), QStringLiteral("razor"), QStringLiteral("razor")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F4"), QStringLiteral("squeeze_bottle"), QStringLiteral("lotion bottle")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F7"), QStringLiteral("safety_pin"), QStringLiteral("safety pin")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9F9"), QStringLiteral("broom"), QStringLiteral("broom")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9FA"), QStringLiteral("basket"), QStringLiteral("basket")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9FB"), QStringLiteral("roll_of_paper"), QStringLiteral("roll of paper")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA3"), QStringLiteral("bucket"), QStringLiteral("bucket")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9FC"), QStringLiteral("soap"), QStringLiteral("soap")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAE7"), QStringLiteral("bubbles"), QStringLiteral("bubbles")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA5"), QStringLiteral("toothbrush"), QStringLiteral("toothbrush")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9FD"), QStringLiteral("sponge"), QStringLiteral("sponge")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9EF"), QStringLiteral("fire_extinguisher"), QStringLiteral("fire extinguisher")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6D2"), QStringLiteral("shopping_cart"), QStringLiteral("shopping cart")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6AC"), QStringLiteral("smoking"), QStringLiteral("cigarette")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026B0\U0000FE0F"), QStringLiteral("coffin"), QStringLiteral("coffin")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA6"), QStringLiteral("headstone"), QStringLiteral("headstone")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026B1\U0000FE0F"), QStringLiteral("funeral urn"), QStringLiteral("funeral urn")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F5FF"), QStringLiteral("moyai"), QStringLiteral("moai")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAA7"), QStringLiteral("placard"), QStringLiteral("placard")}));
-_emojis[Objects].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAAA"), QStringLiteral("identification card"), QStringLiteral("identification card")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3E7"), QStringLiteral("atm"), QStringLiteral("ATM sign")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6AE"), QStringLiteral("put_litter_in_its_place"), QStringLiteral("litter in bin sign")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B0"), QStringLiteral("potable_water"), QStringLiteral("potable water")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000267F"), QStringLiteral("wheelchair"), QStringLiteral("wheelchair symbol")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B9"), QStringLiteral("mens"), QStringLiteral("men’s room")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6BA"), QStringLiteral("womens"), QStringLiteral("women’s room")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6BB"), QStringLiteral("restroom"), QStringLiteral("restroom")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6BC"), QStringLiteral("baby_symbol"), QStringLiteral("baby symbol")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6BE"), QStringLiteral("wc"), QStringLiteral("water closet")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C2"), QStringLiteral("passport_control"), QStringLiteral("passport control")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C3"), QStringLiteral("customs"), QStringLiteral("customs")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C4"), QStringLiteral("baggage_claim"), QStringLiteral("baggage claim")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C5"), QStringLiteral("left_luggage"), QStringLiteral("left luggage")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026A0\U0000FE0F"), QStringLiteral("warning"), QStringLiteral("warning")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B8"), QStringLiteral("children_crossing"), QStringLiteral("children crossing")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026D4"), QStringLiteral("no_entry"), QStringLiteral("no entry")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6AB"), QStringLiteral("no_entry_sign"), QStringLiteral("prohibited")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B3"), QStringLiteral("no_bicycles"), QStringLiteral("no bicycles")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6AD"), QStringLiteral("no_smoking"), QStringLiteral("no smoking")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6AF"), QStringLiteral("do_not_litter"), QStringLiteral("no littering")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B1"), QStringLiteral("non-potable_water"), QStringLiteral("non-potable water")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B7"), QStringLiteral("no_pedestrians"), QStringLiteral("no pedestrians")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F5"), QStringLiteral("no_mobile_phones"), QStringLiteral("no mobile phones")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F51E"), QStringLiteral("underage"), QStringLiteral("no one under eighteen")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002622\U0000FE0F"), QStringLiteral("radioactive"), QStringLiteral("radioactive")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002623\U0000FE0F"), QStringLiteral("biohazard"), QStringLiteral("biohazard")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002B06\U0000FE0F"), QStringLiteral("up arrow"), QStringLiteral("up arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002197\U0000FE0F"), QStringLiteral("up-right arrow"), QStringLiteral("up-right arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000027A1\U0000FE0F"), QStringLiteral("right arrow"), QStringLiteral("right arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002198\U0000FE0F"), QStringLiteral("down-right arrow"), QStringLiteral("down-right arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002B07\U0000FE0F"), QStringLiteral("down arrow"), QStringLiteral("down arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002199\U0000FE0F"), QStringLiteral("down-left arrow"), QStringLiteral("down-left arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002B05\U0000FE0F"), QStringLiteral("left arrow"), QStringLiteral("left arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002196\U0000FE0F"), QStringLiteral("up-left arrow"), QStringLiteral("up-left arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002195\U0000FE0F"), QStringLiteral("up-down arrow"), QStringLiteral("up-down arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002194\U0000FE0F"), QStringLiteral("left-right arrow"), QStringLiteral("left-right arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000021A9\U0000FE0F"), QStringLiteral("right arrow curving left"), QStringLiteral("right arrow curving left")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000021AA\U0000FE0F"), QStringLiteral("left arrow curving right"), QStringLiteral("left arrow curving right")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002934\U0000FE0F"), QStringLiteral("right arrow curving up"), QStringLiteral("right arrow curving up")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002935\U0000FE0F"), QStringLiteral("right arrow curving down"), QStringLiteral("right arrow curving down")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F503"), QStringLiteral("arrows_clockwise"), QStringLiteral("clockwise vertical arrows")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F504"), QStringLiteral("arrows_counterclockwise"), QStringLiteral("counterclockwise arrows button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F519"), QStringLiteral("back"), QStringLiteral("BACK arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F51A"), QStringLiteral("end"), QStringLiteral("END arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F51B"), QStringLiteral("on"), QStringLiteral("ON! arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F51C"), QStringLiteral("soon"), QStringLiteral("SOON arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F51D"), QStringLiteral("top"), QStringLiteral("TOP arrow")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6D0"), QStringLiteral("place_of_worship"), QStringLiteral("place of worship")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000269B\U0000FE0F"), QStringLiteral("atom symbol"), QStringLiteral("atom symbol")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F549\U0000FE0F"), QStringLiteral("om"), QStringLiteral("om")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002721\U0000FE0F"), QStringLiteral("star of David"), QStringLiteral("star of David")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002638\U0000FE0F"), QStringLiteral("wheel of dharma"), QStringLiteral("wheel of dharma")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000262F\U0000FE0F"), QStringLiteral("yin yang"), QStringLiteral("yin yang")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000271D\U0000FE0F"), QStringLiteral("latin cross"), QStringLiteral("latin cross")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002626\U0000FE0F"), QStringLiteral("orthodox cross"), QStringLiteral("orthodox cross")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000262A\U0000FE0F"), QStringLiteral("star and crescent"), QStringLiteral("star and crescent")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000262E\U0000FE0F"), QStringLiteral("peace symbol"), QStringLiteral("peace symbol")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F54E"), QStringLiteral("menorah"), QStringLiteral("menorah")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F52F"), QStringLiteral("six_pointed_star"), QStringLiteral("dotted six-pointed star")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002648"), QStringLiteral("aries"), QStringLiteral("Aries")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002649"), QStringLiteral("taurus"), QStringLiteral("Taurus")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000264A"), QStringLiteral("gemini"), QStringLiteral("Gemini")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000264B"), QStringLiteral("cancer"), QStringLiteral("Cancer")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000264C"), QStringLiteral("leo"), QStringLiteral("Leo")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000264D"), QStringLiteral("virgo"), QStringLiteral("Virgo")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000264E"), QStringLiteral("libra"), QStringLiteral("Libra")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000264F"), QStringLiteral("scorpius"), QStringLiteral("Scorpio")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002650"), QStringLiteral("sagittarius"), QStringLiteral("Sagittarius")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002651"), QStringLiteral("capricorn"), QStringLiteral("Capricorn")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002652"), QStringLiteral("aquarius"), QStringLiteral("Aquarius")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002653"), QStringLiteral("pisces"), QStringLiteral("Pisces")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026CE"), QStringLiteral("ophiuchus"), QStringLiteral("Ophiuchus")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F500"), QStringLiteral("twisted_rightwards_arrows"), QStringLiteral("shuffle tracks button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F501"), QStringLiteral("repeat"), QStringLiteral("repeat button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F502"), QStringLiteral("repeat_one"), QStringLiteral("repeat single button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000025B6\U0000FE0F"), QStringLiteral("play button"), QStringLiteral("play button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023E9"), QStringLiteral("fast_forward"), QStringLiteral("fast-forward button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023ED\U0000FE0F"), QStringLiteral("next track button"), QStringLiteral("next track button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023EF\U0000FE0F"), QStringLiteral("play or pause button"), QStringLiteral("play or pause button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000025C0\U0000FE0F"), QStringLiteral("reverse button"), QStringLiteral("reverse button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023EA"), QStringLiteral("rewind"), QStringLiteral("fast reverse button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023EE\U0000FE0F"), QStringLiteral("last track button"), QStringLiteral("last track button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F53C"), QStringLiteral("arrow_up_small"), QStringLiteral("upwards button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023EB"), QStringLiteral("arrow_double_up"), QStringLiteral("fast up button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F53D"), QStringLiteral("arrow_down_small"), QStringLiteral("downwards button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023EC"), QStringLiteral("arrow_double_down"), QStringLiteral("fast down button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023F8\U0000FE0F"), QStringLiteral("pause button"), QStringLiteral("pause button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023F9\U0000FE0F"), QStringLiteral("stop button"), QStringLiteral("stop button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023FA\U0000FE0F"), QStringLiteral("record button"), QStringLiteral("record button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000023CF\U0000FE0F"), QStringLiteral("eject button"), QStringLiteral("eject button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3A6"), QStringLiteral("cinema"), QStringLiteral("cinema")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F505"), QStringLiteral("low_brightness"), QStringLiteral("dim button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F506"), QStringLiteral("high_brightness"), QStringLiteral("bright button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F6"), QStringLiteral("signal_strength"), QStringLiteral("antenna bars")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F3"), QStringLiteral("vibration_mode"), QStringLiteral("vibration mode")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4F4"), QStringLiteral("mobile_phone_off"), QStringLiteral("mobile phone off")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002640\U0000FE0F"), QStringLiteral("female sign"), QStringLiteral("female sign")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002642\U0000FE0F"), QStringLiteral("male sign"), QStringLiteral("male sign")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026A7\U0000FE0F"), QStringLiteral("transgender symbol"), QStringLiteral("transgender symbol")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002716\U0000FE0F"), QStringLiteral("multiply"), QStringLiteral("multiply")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002795"), QStringLiteral("heavy_plus_sign"), QStringLiteral("plus")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002796"), QStringLiteral("heavy_minus_sign"), QStringLiteral("minus")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002797"), QStringLiteral("heavy_division_sign"), QStringLiteral("divide")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7F0"), QStringLiteral("heavy equals sign"), QStringLiteral("heavy equals sign")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000267E\U0000FE0F"), QStringLiteral("infinity"), QStringLiteral("infinity")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000203C\U0000FE0F"), QStringLiteral("double exclamation mark"), QStringLiteral("double exclamation mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002049\U0000FE0F"), QStringLiteral("exclamation question mark"), QStringLiteral("exclamation question mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002753"), QStringLiteral("question"), QStringLiteral("red question mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002754"), QStringLiteral("grey_question"), QStringLiteral("white question mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002755"), QStringLiteral("grey_exclamation"), QStringLiteral("white exclamation mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002757"), QStringLiteral("exclamation"), QStringLiteral("red exclamation mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00003030\U0000FE0F"), QStringLiteral("wavy dash"), QStringLiteral("wavy dash")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B1"), QStringLiteral("currency_exchange"), QStringLiteral("currency exchange")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4B2"), QStringLiteral("heavy_dollar_sign"), QStringLiteral("heavy dollar sign")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002695\U0000FE0F"), QStringLiteral("medical symbol"), QStringLiteral("medical symbol")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000267B\U0000FE0F"), QStringLiteral("recycling symbol"), QStringLiteral("recycling symbol")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000269C\U0000FE0F"), QStringLiteral("fleur-de-lis"), QStringLiteral("fleur-de-lis")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F531"), QStringLiteral("trident"), QStringLiteral("trident emblem")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4DB"), QStringLiteral("name_badge"), QStringLiteral("name badge")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F530"), QStringLiteral("beginner"), QStringLiteral("Japanese symbol for beginner")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002B55"), QStringLiteral("o"), QStringLiteral("hollow red circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002705"), QStringLiteral("white_check_mark"), QStringLiteral("check mark button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002611\U0000FE0F"), QStringLiteral("check box with check"), QStringLiteral("check box with check")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002714\U0000FE0F"), QStringLiteral("check mark"), QStringLiteral("check mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000274C"), QStringLiteral("x"), QStringLiteral("cross mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000274E"), QStringLiteral("negative_squared_cross_mark"), QStringLiteral("cross mark button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000027B0"), QStringLiteral("curly_loop"), QStringLiteral("curly loop")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000027BF"), QStringLiteral("loop"), QStringLiteral("double curly loop")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000303D\U0000FE0F"), QStringLiteral("part alternation mark"), QStringLiteral("part alternation mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002733\U0000FE0F"), QStringLiteral("eight-spoked asterisk"), QStringLiteral("eight-spoked asterisk")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002734\U0000FE0F"), QStringLiteral("eight-pointed star"), QStringLiteral("eight-pointed star")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002747\U0000FE0F"), QStringLiteral("sparkle"), QStringLiteral("sparkle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000000A9\U0000FE0F"), QStringLiteral("copyright"), QStringLiteral("copyright")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000000AE\U0000FE0F"), QStringLiteral("registered"), QStringLiteral("registered")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002122\U0000FE0F"), QStringLiteral("trade mark"), QStringLiteral("trade mark")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000023\U0000FE0F\U000020E3"), QStringLiteral("keycap: #"), QStringLiteral("keycap: #")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0000002A\U0000FE0F\U000020E3"), QStringLiteral("keycap: *"), QStringLiteral("keycap: *")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000030\U0000FE0F\U000020E3"), QStringLiteral("keycap: 0"), QStringLiteral("keycap: 0")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000031\U0000FE0F\U000020E3"), QStringLiteral("keycap: 1"), QStringLiteral("keycap: 1")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000032\U0000FE0F\U000020E3"), QStringLiteral("keycap: 2"), QStringLiteral("keycap: 2")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000033\U0000FE0F\U000020E3"), QStringLiteral("keycap: 3"), QStringLiteral("keycap: 3")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000034\U0000FE0F\U000020E3"), QStringLiteral("keycap: 4"), QStringLiteral("keycap: 4")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000035\U0000FE0F\U000020E3"), QStringLiteral("keycap: 5"), QStringLiteral("keycap: 5")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000036\U0000FE0F\U000020E3"), QStringLiteral("keycap: 6"), QStringLiteral("keycap: 6")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000037\U0000FE0F\U000020E3"), QStringLiteral("keycap: 7"), QStringLiteral("keycap: 7")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000038\U0000FE0F\U000020E3"), QStringLiteral("keycap: 8"), QStringLiteral("keycap: 8")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00000039\U0000FE0F\U000020E3"), QStringLiteral("keycap: 9"), QStringLiteral("keycap: 9")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F51F"), QStringLiteral("ten"), QStringLiteral("keycap: 10")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F520"), QStringLiteral("capital_abcd"), QStringLiteral("input latin uppercase")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F521"), QStringLiteral("abcd"), QStringLiteral("input latin lowercase")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F522"), QStringLiteral("1234"), QStringLiteral("input numbers")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F523"), QStringLiteral("symbols"), QStringLiteral("input symbols")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F524"), QStringLiteral("abc"), QStringLiteral("input latin letters")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F170\U0000FE0F"), QStringLiteral("A button (blood type)"), QStringLiteral("A button (blood type)")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F18E"), QStringLiteral("ab"), QStringLiteral("AB button (blood type)")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F171\U0000FE0F"), QStringLiteral("B button (blood type)"), QStringLiteral("B button (blood type)")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F191"), QStringLiteral("cl"), QStringLiteral("CL button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F192"), QStringLiteral("cool"), QStringLiteral("COOL button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F193"), QStringLiteral("free"), QStringLiteral("FREE button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002139\U0000FE0F"), QStringLiteral("information"), QStringLiteral("information")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F194"), QStringLiteral("id"), QStringLiteral("ID button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000024C2\U0000FE0F"), QStringLiteral("circled M"), QStringLiteral("circled M")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F195"), QStringLiteral("new"), QStringLiteral("NEW button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F196"), QStringLiteral("ng"), QStringLiteral("NG button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F17E\U0000FE0F"), QStringLiteral("O button (blood type)"), QStringLiteral("O button (blood type)")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F197"), QStringLiteral("ok"), QStringLiteral("OK button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F17F\U0000FE0F"), QStringLiteral("P button"), QStringLiteral("P button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F198"), QStringLiteral("sos"), QStringLiteral("SOS button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F199"), QStringLiteral("up"), QStringLiteral("UP! button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F19A"), QStringLiteral("vs"), QStringLiteral("VS button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F201"), QStringLiteral("koko"), QStringLiteral("Japanese “here” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F202\U0000FE0F"), QStringLiteral("Japanese “service charge” button"), QStringLiteral("Japanese “service charge” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F237\U0000FE0F"), QStringLiteral("Japanese “monthly amount” button"), QStringLiteral("Japanese “monthly amount” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F236"), QStringLiteral("u6709"), QStringLiteral("Japanese “not free of charge” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F22F"), QStringLiteral("u6307"), QStringLiteral("Japanese “reserved” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F250"), QStringLiteral("ideograph_advantage"), QStringLiteral("Japanese “bargain” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F239"), QStringLiteral("u5272"), QStringLiteral("Japanese “discount” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F21A"), QStringLiteral("u7121"), QStringLiteral("Japanese “free of charge” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F232"), QStringLiteral("u7981"), QStringLiteral("Japanese “prohibited” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F251"), QStringLiteral("accept"), QStringLiteral("Japanese “acceptable” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F238"), QStringLiteral("u7533"), QStringLiteral("Japanese “application” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F234"), QStringLiteral("u5408"), QStringLiteral("Japanese “passing grade” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F233"), QStringLiteral("u7a7a"), QStringLiteral("Japanese “vacancy” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00003297\U0000FE0F"), QStringLiteral("Japanese “congratulations” button"), QStringLiteral("Japanese “congratulations” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00003299\U0000FE0F"), QStringLiteral("Japanese “secret” button"), QStringLiteral("Japanese “secret” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F23A"), QStringLiteral("u55b6"), QStringLiteral("Japanese “open for business” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F235"), QStringLiteral("u6e80"), QStringLiteral("Japanese “no vacancy” button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F534"), QStringLiteral("red_circle"), QStringLiteral("red circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E0"), QStringLiteral("orange circle"), QStringLiteral("orange circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E1"), QStringLiteral("yellow circle"), QStringLiteral("yellow circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E2"), QStringLiteral("green circle"), QStringLiteral("green circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F535"), QStringLiteral("blue_circle"), QStringLiteral("blue circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E3"), QStringLiteral("purple circle"), QStringLiteral("purple circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E4"), QStringLiteral("brown circle"), QStringLiteral("brown circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026AB"), QStringLiteral("black_circle"), QStringLiteral("black circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000026AA"), QStringLiteral("white_circle"), QStringLiteral("white circle")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E5"), QStringLiteral("red square"), QStringLiteral("red square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E7"), QStringLiteral("orange square"), QStringLiteral("orange square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E8"), QStringLiteral("yellow square"), QStringLiteral("yellow square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E9"), QStringLiteral("green square"), QStringLiteral("green square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7E6"), QStringLiteral("blue square"), QStringLiteral("blue square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7EA"), QStringLiteral("purple square"), QStringLiteral("purple square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F7EB"), QStringLiteral("brown square"), QStringLiteral("brown square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002B1B"), QStringLiteral("black_large_square"), QStringLiteral("black large square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U00002B1C"), QStringLiteral("white_large_square"), QStringLiteral("white large square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000025FC\U0000FE0F"), QStringLiteral("black medium square"), QStringLiteral("black medium square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000025FB\U0000FE0F"), QStringLiteral("white medium square"), QStringLiteral("white medium square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000025FE"), QStringLiteral("black_medium_small_square"), QStringLiteral("black medium-small square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000025FD"), QStringLiteral("white_medium_small_square"), QStringLiteral("white medium-small square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000025AA\U0000FE0F"), QStringLiteral("black small square"), QStringLiteral("black small square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U000025AB\U0000FE0F"), QStringLiteral("white small square"), QStringLiteral("white small square")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F536"), QStringLiteral("large_orange_diamond"), QStringLiteral("large orange diamond")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F537"), QStringLiteral("large_blue_diamond"), QStringLiteral("large blue diamond")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F538"), QStringLiteral("small_orange_diamond"), QStringLiteral("small orange diamond")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F539"), QStringLiteral("small_blue_diamond"), QStringLiteral("small blue diamond")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F53A"), QStringLiteral("small_red_triangle"), QStringLiteral("red triangle pointed up")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F53B"), QStringLiteral("small_red_triangle_down"), QStringLiteral("red triangle pointed down")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4A0"), QStringLiteral("diamond_shape_with_a_dot_inside"), QStringLiteral("diamond with a dot")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F518"), QStringLiteral("radio_button"), QStringLiteral("radio button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F533"), QStringLiteral("white_square_button"), QStringLiteral("white square button")}));
-_emojis[Symbols].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F532"), QStringLiteral("black_square_button"), QStringLiteral("black square button")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C1"), QStringLiteral("checkered_flag"), QStringLiteral("chequered flag")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A9"), QStringLiteral("triangular_flag_on_post"), QStringLiteral("triangular flag")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F38C"), QStringLiteral("crossed_flags"), QStringLiteral("crossed flags")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F4"), QStringLiteral("flag_black"), QStringLiteral("black flag")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F3\U0000FE0F"), QStringLiteral("white flag"), QStringLiteral("white flag")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F3\U0000FE0F\U0000200D\U0001F308"), QStringLiteral("rainbow flag"), QStringLiteral("rainbow flag")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F3\U0000FE0F\U0000200D\U000026A7\U0000FE0F"), QStringLiteral("transgender flag"), QStringLiteral("transgender flag")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F4\U0000200D\U00002620\U0000FE0F"), QStringLiteral("pirate flag"), QStringLiteral("pirate flag")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1E8"), QStringLiteral("flag_ac"), QStringLiteral("Flag of Ascension Island")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1E9"), QStringLiteral("flag_ad"), QStringLiteral("Flag of Andorra")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1EA"), QStringLiteral("flag_ae"), QStringLiteral("Flag of United Arab Emirates")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1EB"), QStringLiteral("flag_af"), QStringLiteral("Flag of Afghanistan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1EC"), QStringLiteral("flag_ag"), QStringLiteral("Flag of Antigua & Barbuda")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1EE"), QStringLiteral("flag_ai"), QStringLiteral("Flag of Anguilla")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1F1"), QStringLiteral("flag_al"), QStringLiteral("Flag of Albania")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1F2"), QStringLiteral("flag_am"), QStringLiteral("Flag of Armenia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1F4"), QStringLiteral("flag_ao"), QStringLiteral("Flag of Angola")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1F6"), QStringLiteral("flag_aq"), QStringLiteral("Flag of Antarctica")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1F7"), QStringLiteral("flag_ar"), QStringLiteral("Flag of Argentina")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1F8"), QStringLiteral("flag_as"), QStringLiteral("Flag of American Samoa")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1F9"), QStringLiteral("flag_at"), QStringLiteral("Flag of Austria")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1FA"), QStringLiteral("flag_au"), QStringLiteral("Flag of Australia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1FC"), QStringLiteral("flag_aw"), QStringLiteral("Flag of Aruba")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1FD"), QStringLiteral("flag_ax"), QStringLiteral("Flag of Åland Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E6\U0001F1FF"), QStringLiteral("flag_az"), QStringLiteral("Flag of Azerbaijan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1E6"), QStringLiteral("flag_ba"), QStringLiteral("Flag of Bosnia & Herzegovina")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1E7"), QStringLiteral("flag_bb"), QStringLiteral("Flag of Barbados")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1E9"), QStringLiteral("flag_bd"), QStringLiteral("Flag of Bangladesh")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1EA"), QStringLiteral("flag_be"), QStringLiteral("Flag of Belgium")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1EB"), QStringLiteral("flag_bf"), QStringLiteral("Flag of Burkina Faso")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1EC"), QStringLiteral("flag_bg"), QStringLiteral("Flag of Bulgaria")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1ED"), QStringLiteral("flag_bh"), QStringLiteral("Flag of Bahrain")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1EE"), QStringLiteral("flag_bi"), QStringLiteral("Flag of Burundi")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1EF"), QStringLiteral("flag_bj"), QStringLiteral("Flag of Benin")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1F1"), QStringLiteral("flag_bl"), QStringLiteral("Flag of St. Barthélemy")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1F2"), QStringLiteral("flag_bm"), QStringLiteral("Flag of Bermuda")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1F3"), QStringLiteral("flag_bn"), QStringLiteral("Flag of Brunei")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1F4"), QStringLiteral("flag_bo"), QStringLiteral("Flag of Bolivia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1F6"), QStringLiteral("flag_bq"), QStringLiteral("Flag of Caribbean Netherlands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1F7"), QStringLiteral("flag_br"), QStringLiteral("Flag of Brazil")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1F8"), QStringLiteral("flag_bs"), QStringLiteral("Flag of Bahamas")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1F9"), QStringLiteral("flag_bt"), QStringLiteral("Flag of Bhutan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1FB"), QStringLiteral("flag_bv"), QStringLiteral("Flag of Bouvet Island")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1FC"), QStringLiteral("flag_bw"), QStringLiteral("Flag of Botswana")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1FE"), QStringLiteral("flag_by"), QStringLiteral("Flag of Belarus")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E7\U0001F1FF"), QStringLiteral("flag_bz"), QStringLiteral("Flag of Belize")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1E6"), QStringLiteral("flag_ca"), QStringLiteral("Flag of Canada")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1E8"), QStringLiteral("flag_cc"), QStringLiteral("Flag of Cocos (Keeling) Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1E9"), QStringLiteral("flag_cd"), QStringLiteral("Flag of Congo - Kinshasa")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1EB"), QStringLiteral("flag_cf"), QStringLiteral("Flag of Central African Republic")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1EC"), QStringLiteral("flag_cg"), QStringLiteral("Flag of Congo - Brazzaville")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1ED"), QStringLiteral("flag_ch"), QStringLiteral("Flag of Switzerland")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1EE"), QStringLiteral("flag_ci"), QStringLiteral("Flag of Côte d’Ivoire")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1F0"), QStringLiteral("flag_ck"), QStringLiteral("Flag of Cook Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1F1"), QStringLiteral("flag_cl"), QStringLiteral("Flag of Chile")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1F2"), QStringLiteral("flag_cm"), QStringLiteral("Flag of Cameroon")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1F3"), QStringLiteral("flag_cn"), QStringLiteral("Flag of China")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1F4"), QStringLiteral("flag_co"), QStringLiteral("Flag of Colombia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1F5"), QStringLiteral("flag_cp"), QStringLiteral("Flag of Clipperton Island")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1F7"), QStringLiteral("flag_cr"), QStringLiteral("Flag of Costa Rica")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1FA"), QStringLiteral("flag_cu"), QStringLiteral("Flag of Cuba")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1FB"), QStringLiteral("flag_cv"), QStringLiteral("Flag of Cape Verde")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1FC"), QStringLiteral("flag_cw"), QStringLiteral("Flag of Curaçao")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1FD"), QStringLiteral("flag_cx"), QStringLiteral("Flag of Christmas Island")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1FE"), QStringLiteral("flag_cy"), QStringLiteral("Flag of Cyprus")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E8\U0001F1FF"), QStringLiteral("flag_cz"), QStringLiteral("Flag of Czechia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E9\U0001F1EA"), QStringLiteral("flag_de"), QStringLiteral("Flag of Germany")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E9\U0001F1EC"), QStringLiteral("flag_dg"), QStringLiteral("Flag of Diego Garcia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E9\U0001F1EF"), QStringLiteral("flag_dj"), QStringLiteral("Flag of Djibouti")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E9\U0001F1F0"), QStringLiteral("flag_dk"), QStringLiteral("Flag of Denmark")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E9\U0001F1F2"), QStringLiteral("flag_dm"), QStringLiteral("Flag of Dominica")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E9\U0001F1F4"), QStringLiteral("flag_do"), QStringLiteral("Flag of Dominican Republic")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1E9\U0001F1FF"), QStringLiteral("flag_dz"), QStringLiteral("Flag of Algeria")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EA\U0001F1E6"), QStringLiteral("flag_ea"), QStringLiteral("Flag of Ceuta & Melilla")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EA\U0001F1E8"), QStringLiteral("flag_ec"), QStringLiteral("Flag of Ecuador")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EA\U0001F1EA"), QStringLiteral("flag_ee"), QStringLiteral("Flag of Estonia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EA\U0001F1EC"), QStringLiteral("flag_eg"), QStringLiteral("Flag of Egypt")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EA\U0001F1ED"), QStringLiteral("flag_eh"), QStringLiteral("Flag of Western Sahara")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EA\U0001F1F7"), QStringLiteral("flag_er"), QStringLiteral("Flag of Eritrea")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EA\U0001F1F8"), QStringLiteral("flag_es"), QStringLiteral("Flag of Spain")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EA\U0001F1F9"), QStringLiteral("flag_et"), QStringLiteral("Flag of Ethiopia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EA\U0001F1FA"), QStringLiteral("flag_eu"), QStringLiteral("Flag of European Union")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EB\U0001F1EE"), QStringLiteral("flag_fi"), QStringLiteral("Flag of Finland")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EB\U0001F1EF"), QStringLiteral("flag_fj"), QStringLiteral("Flag of Fiji")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EB\U0001F1F0"), QStringLiteral("flag_fk"), QStringLiteral("Flag of Falkland Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EB\U0001F1F2"), QStringLiteral("flag_fm"), QStringLiteral("Flag of Micronesia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EB\U0001F1F4"), QStringLiteral("flag_fo"), QStringLiteral("Flag of Faroe Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EB\U0001F1F7"), QStringLiteral("flag_fr"), QStringLiteral("Flag of France")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1E6"), QStringLiteral("flag_ga"), QStringLiteral("Flag of Gabon")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1E7"), QStringLiteral("flag_gb"), QStringLiteral("Flag of United Kingdom")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1E9"), QStringLiteral("flag_gd"), QStringLiteral("Flag of Grenada")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1EA"), QStringLiteral("flag_ge"), QStringLiteral("Flag of Georgia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1EB"), QStringLiteral("flag_gf"), QStringLiteral("Flag of French Guiana")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1EC"), QStringLiteral("flag_gg"), QStringLiteral("Flag of Guernsey")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1ED"), QStringLiteral("flag_gh"), QStringLiteral("Flag of Ghana")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1EE"), QStringLiteral("flag_gi"), QStringLiteral("Flag of Gibraltar")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1F1"), QStringLiteral("flag_gl"), QStringLiteral("Flag of Greenland")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1F2"), QStringLiteral("flag_gm"), QStringLiteral("Flag of Gambia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1F3"), QStringLiteral("flag_gn"), QStringLiteral("Flag of Guinea")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1F5"), QStringLiteral("flag_gp"), QStringLiteral("Flag of Guadeloupe")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1F6"), QStringLiteral("flag_gq"), QStringLiteral("Flag of Equatorial Guinea")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1F7"), QStringLiteral("flag_gr"), QStringLiteral("Flag of Greece")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1F8"), QStringLiteral("flag_gs"), QStringLiteral("Flag of South Georgia & South Sandwich Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1F9"), QStringLiteral("flag_gt"), QStringLiteral("Flag of Guatemala")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1FA"), QStringLiteral("flag_gu"), QStringLiteral("Flag of Guam")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1FC"), QStringLiteral("flag_gw"), QStringLiteral("Flag of Guinea-Bissau")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EC\U0001F1FE"), QStringLiteral("flag_gy"), QStringLiteral("Flag of Guyana")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1ED\U0001F1F0"), QStringLiteral("flag_hk"), QStringLiteral("Flag of Hong Kong SAR China")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1ED\U0001F1F2"), QStringLiteral("flag_hm"), QStringLiteral("Flag of Heard & McDonald Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1ED\U0001F1F3"), QStringLiteral("flag_hn"), QStringLiteral("Flag of Honduras")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1ED\U0001F1F7"), QStringLiteral("flag_hr"), QStringLiteral("Flag of Croatia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1ED\U0001F1F9"), QStringLiteral("flag_ht"), QStringLiteral("Flag of Haiti")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1ED\U0001F1FA"), QStringLiteral("flag_hu"), QStringLiteral("Flag of Hungary")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1E8"), QStringLiteral("flag_ic"), QStringLiteral("Flag of Canary Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1E9"), QStringLiteral("flag_id"), QStringLiteral("Flag of Indonesia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1EA"), QStringLiteral("flag_ie"), QStringLiteral("Flag of Ireland")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1F1"), QStringLiteral("flag_il"), QStringLiteral("Flag of Israel")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1F2"), QStringLiteral("flag_im"), QStringLiteral("Flag of Isle of Man")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1F3"), QStringLiteral("flag_in"), QStringLiteral("Flag of India")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1F4"), QStringLiteral("flag_io"), QStringLiteral("Flag of British Indian Ocean Territory")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1F6"), QStringLiteral("flag_iq"), QStringLiteral("Flag of Iraq")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1F7"), QStringLiteral("flag_ir"), QStringLiteral("Flag of Iran")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1F8"), QStringLiteral("flag_is"), QStringLiteral("Flag of Iceland")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EE\U0001F1F9"), QStringLiteral("flag_it"), QStringLiteral("Flag of Italy")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EF\U0001F1EA"), QStringLiteral("flag_je"), QStringLiteral("Flag of Jersey")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EF\U0001F1F2"), QStringLiteral("flag_jm"), QStringLiteral("Flag of Jamaica")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EF\U0001F1F4"), QStringLiteral("flag_jo"), QStringLiteral("Flag of Jordan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1EF\U0001F1F5"), QStringLiteral("flag_jp"), QStringLiteral("Flag of Japan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1EA"), QStringLiteral("flag_ke"), QStringLiteral("Flag of Kenya")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1EC"), QStringLiteral("flag_kg"), QStringLiteral("Flag of Kyrgyzstan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1ED"), QStringLiteral("flag_kh"), QStringLiteral("Flag of Cambodia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1EE"), QStringLiteral("flag_ki"), QStringLiteral("Flag of Kiribati")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1F2"), QStringLiteral("flag_km"), QStringLiteral("Flag of Comoros")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1F3"), QStringLiteral("flag_kn"), QStringLiteral("Flag of St. Kitts & Nevis")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1F5"), QStringLiteral("flag_kp"), QStringLiteral("Flag of North Korea")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1F7"), QStringLiteral("flag_kr"), QStringLiteral("Flag of South Korea")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1FC"), QStringLiteral("flag_kw"), QStringLiteral("Flag of Kuwait")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1FE"), QStringLiteral("flag_ky"), QStringLiteral("Flag of Cayman Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F0\U0001F1FF"), QStringLiteral("flag_kz"), QStringLiteral("Flag of Kazakhstan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1E6"), QStringLiteral("flag_la"), QStringLiteral("Flag of Laos")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1E7"), QStringLiteral("flag_lb"), QStringLiteral("Flag of Lebanon")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1E8"), QStringLiteral("flag_lc"), QStringLiteral("Flag of St. Lucia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1EE"), QStringLiteral("flag_li"), QStringLiteral("Flag of Liechtenstein")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1F0"), QStringLiteral("flag_lk"), QStringLiteral("Flag of Sri Lanka")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1F7"), QStringLiteral("flag_lr"), QStringLiteral("Flag of Liberia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1F8"), QStringLiteral("flag_ls"), QStringLiteral("Flag of Lesotho")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1F9"), QStringLiteral("flag_lt"), QStringLiteral("Flag of Lithuania")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1FA"), QStringLiteral("flag_lu"), QStringLiteral("Flag of Luxembourg")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1FB"), QStringLiteral("flag_lv"), QStringLiteral("Flag of Latvia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F1\U0001F1FE"), QStringLiteral("flag_ly"), QStringLiteral("Flag of Libya")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1E6"), QStringLiteral("flag_ma"), QStringLiteral("Flag of Morocco")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1E8"), QStringLiteral("flag_mc"), QStringLiteral("Flag of Monaco")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1E9"), QStringLiteral("flag_md"), QStringLiteral("Flag of Moldova")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1EA"), QStringLiteral("flag_me"), QStringLiteral("Flag of Montenegro")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1EB"), QStringLiteral("flag_mf"), QStringLiteral("Flag of St. Martin")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1EC"), QStringLiteral("flag_mg"), QStringLiteral("Flag of Madagascar")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1ED"), QStringLiteral("flag_mh"), QStringLiteral("Flag of Marshall Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F0"), QStringLiteral("flag_mk"), QStringLiteral("Flag of North Macedonia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F1"), QStringLiteral("flag_ml"), QStringLiteral("Flag of Mali")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F2"), QStringLiteral("flag_mm"), QStringLiteral("Flag of Myanmar (Burma)")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F3"), QStringLiteral("flag_mn"), QStringLiteral("Flag of Mongolia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F4"), QStringLiteral("flag_mo"), QStringLiteral("Flag of Macao SAR China")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F5"), QStringLiteral("flag_mp"), QStringLiteral("Flag of Northern Mariana Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F6"), QStringLiteral("flag_mq"), QStringLiteral("Flag of Martinique")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F7"), QStringLiteral("flag_mr"), QStringLiteral("Flag of Mauritania")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F8"), QStringLiteral("flag_ms"), QStringLiteral("Flag of Montserrat")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1F9"), QStringLiteral("flag_mt"), QStringLiteral("Flag of Malta")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1FA"), QStringLiteral("flag_mu"), QStringLiteral("Flag of Mauritius")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1FB"), QStringLiteral("flag_mv"), QStringLiteral("Flag of Maldives")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1FC"), QStringLiteral("flag_mw"), QStringLiteral("Flag of Malawi")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1FD"), QStringLiteral("flag_mx"), QStringLiteral("Flag of Mexico")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1FE"), QStringLiteral("flag_my"), QStringLiteral("Flag of Malaysia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F2\U0001F1FF"), QStringLiteral("flag_mz"), QStringLiteral("Flag of Mozambique")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1E6"), QStringLiteral("flag_na"), QStringLiteral("Flag of Namibia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1E8"), QStringLiteral("flag_nc"), QStringLiteral("Flag of New Caledonia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1EA"), QStringLiteral("flag_ne"), QStringLiteral("Flag of Niger")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1EB"), QStringLiteral("flag_nf"), QStringLiteral("Flag of Norfolk Island")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1EC"), QStringLiteral("flag_ng"), QStringLiteral("Flag of Nigeria")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1EE"), QStringLiteral("flag_ni"), QStringLiteral("Flag of Nicaragua")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1F1"), QStringLiteral("flag_nl"), QStringLiteral("Flag of Netherlands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1F4"), QStringLiteral("flag_no"), QStringLiteral("Flag of Norway")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1F5"), QStringLiteral("flag_np"), QStringLiteral("Flag of Nepal")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1F7"), QStringLiteral("flag_nr"), QStringLiteral("Flag of Nauru")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1FA"), QStringLiteral("flag_nu"), QStringLiteral("Flag of Niue")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F3\U0001F1FF"), QStringLiteral("flag_nz"), QStringLiteral("Flag of New Zealand")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F4\U0001F1F2"), QStringLiteral("flag_om"), QStringLiteral("Flag of Oman")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1E6"), QStringLiteral("flag_pa"), QStringLiteral("Flag of Panama")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1EA"), QStringLiteral("flag_pe"), QStringLiteral("Flag of Peru")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1EB"), QStringLiteral("flag_pf"), QStringLiteral("Flag of French Polynesia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1EC"), QStringLiteral("flag_pg"), QStringLiteral("Flag of Papua New Guinea")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1ED"), QStringLiteral("flag_ph"), QStringLiteral("Flag of Philippines")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1F0"), QStringLiteral("flag_pk"), QStringLiteral("Flag of Pakistan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1F1"), QStringLiteral("flag_pl"), QStringLiteral("Flag of Poland")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1F2"), QStringLiteral("flag_pm"), QStringLiteral("Flag of St. Pierre & Miquelon")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1F3"), QStringLiteral("flag_pn"), QStringLiteral("Flag of Pitcairn Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1F7"), QStringLiteral("flag_pr"), QStringLiteral("Flag of Puerto Rico")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1F8"), QStringLiteral("flag_ps"), QStringLiteral("Flag of Palestinian Territories")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1F9"), QStringLiteral("flag_pt"), QStringLiteral("Flag of Portugal")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1FC"), QStringLiteral("flag_pw"), QStringLiteral("Flag of Palau")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F5\U0001F1FE"), QStringLiteral("flag_py"), QStringLiteral("Flag of Paraguay")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F6\U0001F1E6"), QStringLiteral("flag_qa"), QStringLiteral("Flag of Qatar")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F7\U0001F1EA"), QStringLiteral("flag_re"), QStringLiteral("Flag of Réunion")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F7\U0001F1F4"), QStringLiteral("flag_ro"), QStringLiteral("Flag of Romania")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F7\U0001F1F8"), QStringLiteral("flag_rs"), QStringLiteral("Flag of Serbia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F7\U0001F1FA"), QStringLiteral("flag_ru"), QStringLiteral("Flag of Russia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F7\U0001F1FC"), QStringLiteral("flag_rw"), QStringLiteral("Flag of Rwanda")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1E6"), QStringLiteral("flag_sa"), QStringLiteral("Flag of Saudi Arabia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1E7"), QStringLiteral("flag_sb"), QStringLiteral("Flag of Solomon Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1E8"), QStringLiteral("flag_sc"), QStringLiteral("Flag of Seychelles")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1E9"), QStringLiteral("flag_sd"), QStringLiteral("Flag of Sudan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1EA"), QStringLiteral("flag_se"), QStringLiteral("Flag of Sweden")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1EC"), QStringLiteral("flag_sg"), QStringLiteral("Flag of Singapore")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1ED"), QStringLiteral("flag_sh"), QStringLiteral("Flag of St. Helena")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1EE"), QStringLiteral("flag_si"), QStringLiteral("Flag of Slovenia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1EF"), QStringLiteral("flag_sj"), QStringLiteral("Flag of Svalbard & Jan Mayen")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1F0"), QStringLiteral("flag_sk"), QStringLiteral("Flag of Slovakia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1F1"), QStringLiteral("flag_sl"), QStringLiteral("Flag of Sierra Leone")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1F2"), QStringLiteral("flag_sm"), QStringLiteral("Flag of San Marino")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1F3"), QStringLiteral("flag_sn"), QStringLiteral("Flag of Senegal")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1F4"), QStringLiteral("flag_so"), QStringLiteral("Flag of Somalia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1F7"), QStringLiteral("flag_sr"), QStringLiteral("Flag of Suriname")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1F8"), QStringLiteral("flag_ss"), QStringLiteral("Flag of South Sudan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1F9"), QStringLiteral("flag_st"), QStringLiteral("Flag of São Tomé & Príncipe")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1FB"), QStringLiteral("flag_sv"), QStringLiteral("Flag of El Salvador")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1FD"), QStringLiteral("flag_sx"), QStringLiteral("Flag of Sint Maarten")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1FE"), QStringLiteral("flag_sy"), QStringLiteral("Flag of Syria")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F8\U0001F1FF"), QStringLiteral("flag_sz"), QStringLiteral("Flag of Eswatini")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1E6"), QStringLiteral("flag_ta"), QStringLiteral("Flag of Tristan da Cunha")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1E8"), QStringLiteral("flag_tc"), QStringLiteral("Flag of Turks & Caicos Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1E9"), QStringLiteral("flag_td"), QStringLiteral("Flag of Chad")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1EB"), QStringLiteral("flag_tf"), QStringLiteral("Flag of French Southern Territories")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1EC"), QStringLiteral("flag_tg"), QStringLiteral("Flag of Togo")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1ED"), QStringLiteral("flag_th"), QStringLiteral("Flag of Thailand")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1EF"), QStringLiteral("flag_tj"), QStringLiteral("Flag of Tajikistan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1F0"), QStringLiteral("flag_tk"), QStringLiteral("Flag of Tokelau")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1F1"), QStringLiteral("flag_tl"), QStringLiteral("Flag of Timor-Leste")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1F2"), QStringLiteral("flag_tm"), QStringLiteral("Flag of Turkmenistan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1F3"), QStringLiteral("flag_tn"), QStringLiteral("Flag of Tunisia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1F4"), QStringLiteral("flag_to"), QStringLiteral("Flag of Tonga")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1F7"), QStringLiteral("flag_tr"), QStringLiteral("Flag of Turkey")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1F9"), QStringLiteral("flag_tt"), QStringLiteral("Flag of Trinidad & Tobago")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1FB"), QStringLiteral("flag_tv"), QStringLiteral("Flag of Tuvalu")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1FC"), QStringLiteral("flag_tw"), QStringLiteral("Flag of Taiwan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1F9\U0001F1FF"), QStringLiteral("flag_tz"), QStringLiteral("Flag of Tanzania")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FA\U0001F1E6"), QStringLiteral("flag_ua"), QStringLiteral("Flag of Ukraine")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FA\U0001F1EC"), QStringLiteral("flag_ug"), QStringLiteral("Flag of Uganda")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FA\U0001F1F2"), QStringLiteral("flag_um"), QStringLiteral("Flag of U.S. Outlying Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FA\U0001F1F3"), QStringLiteral("united_nations"), QStringLiteral("Flag of United Nations")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FA\U0001F1F8"), QStringLiteral("flag_us"), QStringLiteral("Flag of United States")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FA\U0001F1FE"), QStringLiteral("flag_uy"), QStringLiteral("Flag of Uruguay")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FA\U0001F1FF"), QStringLiteral("flag_uz"), QStringLiteral("Flag of Uzbekistan")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FB\U0001F1E6"), QStringLiteral("flag_va"), QStringLiteral("Flag of Vatican City")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FB\U0001F1E8"), QStringLiteral("flag_vc"), QStringLiteral("Flag of St. Vincent & Grenadines")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FB\U0001F1EA"), QStringLiteral("flag_ve"), QStringLiteral("Flag of Venezuela")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FB\U0001F1EC"), QStringLiteral("flag_vg"), QStringLiteral("Flag of British Virgin Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FB\U0001F1EE"), QStringLiteral("flag_vi"), QStringLiteral("Flag of U.S. Virgin Islands")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FB\U0001F1F3"), QStringLiteral("flag_vn"), QStringLiteral("Flag of Vietnam")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FB\U0001F1FA"), QStringLiteral("flag_vu"), QStringLiteral("Flag of Vanuatu")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FC\U0001F1EB"), QStringLiteral("flag_wf"), QStringLiteral("Flag of Wallis & Futuna")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FC\U0001F1F8"), QStringLiteral("flag_ws"), QStringLiteral("Flag of Samoa")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FD\U0001F1F0"), QStringLiteral("flag_xk"), QStringLiteral("Flag of Kosovo")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FE\U0001F1EA"), QStringLiteral("flag_ye"), QStringLiteral("Flag of Yemen")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FE\U0001F1F9"), QStringLiteral("flag_yt"), QStringLiteral("Flag of Mayotte")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FF\U0001F1E6"), QStringLiteral("flag_za"), QStringLiteral("Flag of South Africa")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FF\U0001F1F2"), QStringLiteral("flag_zm"), QStringLiteral("Flag of Zambia")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F1FF\U0001F1FC"), QStringLiteral("flag_zw"), QStringLiteral("Flag of Zimbabwe")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F4\U000E0067\U000E0062\U000E0065\U000E006E\U000E0067\U000E007F"), QStringLiteral("england"), QStringLiteral("Flag of England")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F4\U000E0067\U000E0062\U000E0073\U000E0063\U000E0074\U000E007F"), QStringLiteral("scotland"), QStringLiteral("Flag of Scotland")}));
-_emojis[Flags].append(QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3F4\U000E0067\U000E0062\U000E0077\U000E006C\U000E0073\U000E007F"), QStringLiteral("wales"), QStringLiteral("Flag of Wales")}));
+constexpr EmojiData smileysEmojis[] = {
+{"\U0001F600", "grinning", "grinning face"},
+{"\U0001F603", "smiley", "grinning face with big eyes"},
+{"\U0001F604", "smile", "grinning face with smiling eyes"},
+{"\U0001F601", "grin", "beaming face with smiling eyes"},
+{"\U0001F606", "laughing", "grinning squinting face"},
+{"\U0001F605", "sweat_smile", "grinning face with sweat"},
+{"\U0001F923", "rofl", "rolling on the floor laughing"},
+{"\U0001F602", "joy", "face with tears of joy"},
+{"\U0001F642", "slight_smile", "slightly smiling face"},
+{"\U0001F643", "upside_down", "upside-down face"},
+{"\U0001FAE0", "melting face", "melting face"},
+{"\U0001F609", "wink", "winking face"},
+{"\U0001F60A", "blush", "smiling face with smiling eyes"},
+{"\U0001F607", "innocent", "smiling face with halo"},
+{"\U0001F970", "smiling_face_with_3_hearts", "smiling face with hearts"},
+{"\U0001F60D", "heart_eyes", "smiling face with heart-eyes"},
+{"\U0001F929", "star_struck", "star-struck"},
+{"\U0001F618", "kissing_heart", "face blowing a kiss"},
+{"\U0001F617", "kissing", "kissing face"},
+{"\U0000263A\U0000FE0F", "smiling face", "smiling face"},
+{"\U0001F61A", "kissing_closed_eyes", "kissing face with closed eyes"},
+{"\U0001F619", "kissing_smiling_eyes", "kissing face with smiling eyes"},
+{"\U0001F972", "smiling face with tear", "smiling face with tear"},
+{"\U0001F60B", "yum", "face savoring food"},
+{"\U0001F61B", "stuck_out_tongue", "face with tongue"},
+{"\U0001F61C", "stuck_out_tongue_winking_eye", "winking face with tongue"},
+{"\U0001F92A", "zany_face", "zany face"},
+{"\U0001F61D", "stuck_out_tongue_closed_eyes", "squinting face with tongue"},
+{"\U0001F911", "money_mouth", "money-mouth face"},
+{"\U0001F917", "hugging", "smiling face with open hands"},
+{"\U0001F92D", "face_with_hand_over_mouth", "face with hand over mouth"},
+{"\U0001FAE2", "face with open eyes and hand over mouth", "face with open eyes and hand over mouth"},
+{"\U0001FAE3", "face with peeking eye", "face with peeking eye"},
+{"\U0001F92B", "shushing_face", "shushing face"},
+{"\U0001F914", "thinking", "thinking face"},
+{"\U0001FAE1", "saluting face", "saluting face"},
+{"\U0001F910", "zipper_mouth", "zipper-mouth face"},
+{"\U0001F928", "face_with_raised_eyebrow", "face with raised eyebrow"},
+{"\U0001F610", "neutral_face", "neutral face"},
+{"\U0001F611", "expressionless", "expressionless face"},
+{"\U0001F636", "no_mouth", "face without mouth"},
+{"\U0001FAE5", "dotted line face", "dotted line face"},
+{"\U0001F636\U0000200D\U0001F32B\U0000FE0F", "face in clouds", "face in clouds"},
+{"\U0001F60F", "smirk", "smirking face"},
+{"\U0001F612", "unamused", "unamused face"},
+{"\U0001F644", "rolling_eyes", "face with rolling eyes"},
+{"\U0001F62C", "grimacing", "grimacing face"},
+{"\U0001F62E\U0000200D\U0001F4A8", "face exhaling", "face exhaling"},
+{"\U0001F925", "lying_face", "lying face"},
+{"\U0001F60C", "relieved", "relieved face"},
+{"\U0001F614", "pensive", "pensive face"},
+{"\U0001F62A", "sleepy", "sleepy face"},
+{"\U0001F924", "drooling_face", "drooling face"},
+{"\U0001F634", "sleeping", "sleeping face"},
+{"\U0001F637", "mask", "face with medical mask"},
+{"\U0001F912", "thermometer_face", "face with thermometer"},
+{"\U0001F915", "head_bandage", "face with head-bandage"},
+{"\U0001F922", "nauseated_face", "nauseated face"},
+{"\U0001F92E", "face_vomiting", "face vomiting"},
+{"\U0001F927", "sneezing_face", "sneezing face"},
+{"\U0001F975", "hot_face", "hot face"},
+{"\U0001F976", "cold_face", "cold face"},
+{"\U0001F974", "woozy_face", "woozy face"},
+{"\U0001F635", "dizzy_face", "face with crossed-out eyes"},
+{"\U0001F635\U0000200D\U0001F4AB", "face with spiral eyes", "face with spiral eyes"},
+{"\U0001F92F", "exploding_head", "exploding head"},
+{"\U0001F920", "cowboy", "cowboy hat face"},
+{"\U0001F973", "partying_face", "partying face"},
+{"\U0001F978", "disguised face", "disguised face"},
+{"\U0001F60E", "sunglasses", "smiling face with sunglasses"},
+{"\U0001F913", "nerd", "nerd face"},
+{"\U0001F9D0", "face_with_monocle", "face with monocle"},
+{"\U0001F615", "confused", "confused face"},
+{"\U0001FAE4", "face with diagonal mouth", "face with diagonal mouth"},
+{"\U0001F61F", "worried", "worried face"},
+{"\U0001F641", "slight_frown", "slightly frowning face"},
+{"\U00002639\U0000FE0F", "frowning face", "frowning face"},
+{"\U0001F62E", "open_mouth", "face with open mouth"},
+{"\U0001F62F", "hushed", "hushed face"},
+{"\U0001F632", "astonished", "astonished face"},
+{"\U0001F633", "flushed", "flushed face"},
+{"\U0001F97A", "pleading_face", "pleading face"},
+{"\U0001F979", "face holding back tears", "face holding back tears"},
+{"\U0001F626", "frowning", "frowning face with open mouth"},
+{"\U0001F627", "anguished", "anguished face"},
+{"\U0001F628", "fearful", "fearful face"},
+{"\U0001F630", "cold_sweat", "anxious face with sweat"},
+{"\U0001F625", "disappointed_relieved", "sad but relieved face"},
+{"\U0001F622", "cry", "crying face"},
+{"\U0001F62D", "sob", "loudly crying face"},
+{"\U0001F631", "scream", "face screaming in fear"},
+{"\U0001F616", "confounded", "confounded face"},
+{"\U0001F623", "persevere", "persevering face"},
+{"\U0001F61E", "disappointed", "disappointed face"},
+{"\U0001F613", "sweat", "downcast face with sweat"},
+{"\U0001F629", "weary", "weary face"},
+{"\U0001F62B", "tired_face", "tired face"},
+{"\U0001F971", "yawning face", "yawning face"},
+{"\U0001F624", "triumph", "face with steam from nose"},
+{"\U0001F621", "rage", "pouting face"},
+{"\U0001F620", "angry", "angry face"},
+{"\U0001F92C", "face_with_symbols_over_mouth", "face with symbols on mouth"},
+{"\U0001F608", "smiling_imp", "smiling face with horns"},
+{"\U0001F47F", "imp", "angry face with horns"},
+{"\U0001F480", "skull", "skull"},
+{"\U00002620\U0000FE0F", "skull and crossbones", "skull and crossbones"},
+{"\U0001F4A9", "poop", "pile of poo"},
+{"\U0001F921", "clown", "clown face"},
+{"\U0001F479", "japanese_ogre", "ogre"},
+{"\U0001F47A", "japanese_goblin", "goblin"},
+{"\U0001F47B", "ghost", "ghost"},
+{"\U0001F47D", "alien", "alien"},
+{"\U0001F47E", "space_invader", "alien monster"},
+{"\U0001F916", "robot", "robot"},
+{"\U0001F63A", "smiley_cat", "grinning cat"},
+{"\U0001F638", "smile_cat", "grinning cat with smiling eyes"},
+{"\U0001F639", "joy_cat", "cat with tears of joy"},
+{"\U0001F63B", "heart_eyes_cat", "smiling cat with heart-eyes"},
+{"\U0001F63C", "smirk_cat", "cat with wry smile"},
+{"\U0001F63D", "kissing_cat", "kissing cat"},
+{"\U0001F640", "scream_cat", "weary cat"},
+{"\U0001F63F", "crying_cat_face", "crying cat"},
+{"\U0001F63E", "pouting_cat", "pouting cat"},
+{"\U0001F648", "see_no_evil", "see-no-evil monkey"},
+{"\U0001F649", "hear_no_evil", "hear-no-evil monkey"},
+{"\U0001F64A", "speak_no_evil", "speak-no-evil monkey"},
+{"\U0001F48B", "kiss", "kiss mark"},
+{"\U0001F48C", "love_letter", "love letter"},
+{"\U0001F498", "cupid", "heart with arrow"},
+{"\U0001F49D", "gift_heart", "heart with ribbon"},
+{"\U0001F496", "sparkling_heart", "sparkling heart"},
+{"\U0001F497", "heartpulse", "growing heart"},
+{"\U0001F493", "heartbeat", "beating heart"},
+{"\U0001F49E", "revolving_hearts", "revolving hearts"},
+{"\U0001F495", "two_hearts", "two hearts"},
+{"\U0001F49F", "heart_decoration", "heart decoration"},
+{"\U00002763\U0000FE0F", "heart exclamation", "heart exclamation"},
+{"\U0001F494", "broken_heart", "broken heart"},
+{"\U00002764\U0000FE0F\U0000200D\U0001F525", "heart on fire", "heart on fire"},
+{"\U00002764\U0000FE0F\U0000200D\U0001FA79", "mending heart", "mending heart"},
+{"\U00002764\U0000FE0F", "red heart", "red heart"},
+{"\U0001F9E1", "orange_heart", "orange heart"},
+{"\U0001F49B", "yellow_heart", "yellow heart"},
+{"\U0001F49A", "green_heart", "green heart"},
+{"\U0001F499", "blue_heart", "blue heart"},
+{"\U0001F49C", "purple_heart", "purple heart"},
+{"\U0001F90E", "brown heart", "brown heart"},
+{"\U0001F5A4", "black_heart", "black heart"},
+{"\U0001F90D", "white heart", "white heart"},
+{"\U0001F4AF", "100", "hundred points"},
+{"\U0001F4A2", "anger", "anger symbol"},
+{"\U0001F4A5", "boom", "collision"},
+{"\U0001F4AB", "dizzy", "dizzy"},
+{"\U0001F4A6", "sweat_drops", "sweat droplets"},
+{"\U0001F4A8", "dash", "dashing away"},
+{"\U0001F573\U0000FE0F", "hole", "hole"},
+{"\U0001F4A3", "bomb", "bomb"},
+{"\U0001F4AC", "speech_balloon", "speech balloon"},
+{"\U0001F441\U0000FE0F\U0000200D\U0001F5E8\U0000FE0F", "eye in speech bubble", "eye in speech bubble"},
+{"\U0001F5E8\U0000FE0F", "left speech bubble", "left speech bubble"},
+{"\U0001F5EF\U0000FE0F", "right anger bubble", "right anger bubble"},
+{"\U0001F4AD", "thought_balloon", "thought balloon"},
+{"\U0001F4A4", "zzz", "zzz"},
+};
+constexpr EmojiData peopleEmojis[] = {
+{"\U0001F44B", "wave", "waving hand"},
+{"\U0001F91A", "raised_back_of_hand", "raised back of hand"},
+{"\U0001F590\U0000FE0F", "hand with fingers splayed", "hand with fingers splayed"},
+{"\U0000270B", "raised_hand", "raised hand"},
+{"\U0001F596", "vulcan", "vulcan salute"},
+{"\U0001FAF1", "rightwards hand", "rightwards hand"},
+{"\U0001FAF2", "leftwards hand", "leftwards hand"},
+{"\U0001FAF3", "palm down hand", "palm down hand"},
+{"\U0001FAF4", "palm up hand", "palm up hand"},
+{"\U0001F44C", "ok_hand", "OK hand"},
+{"\U0001F90C", "pinched fingers", "pinched fingers"},
+{"\U0001F90F", "pinching hand", "pinching hand"},
+{"\U0000270C\U0000FE0F", "victory hand", "victory hand"},
+{"\U0001F91E", "fingers_crossed", "crossed fingers"},
+{"\U0001FAF0", "hand with index finger and thumb crossed", "hand with index finger and thumb crossed"},
+{"\U0001F91F", "love_you_gesture", "love-you gesture"},
+{"\U0001F918", "metal", "sign of the horns"},
+{"\U0001F919", "call_me", "call me hand"},
+{"\U0001F448", "point_left", "backhand index pointing left"},
+{"\U0001F449", "point_right", "backhand index pointing right"},
+{"\U0001F446", "point_up_2", "backhand index pointing up"},
+{"\U0001F595", "middle_finger", "middle finger"},
+{"\U0001F447", "point_down", "backhand index pointing down"},
+{"\U0000261D\U0000FE0F", "index pointing up", "index pointing up"},
+{"\U0001FAF5", "index pointing at the viewer", "index pointing at the viewer"},
+{"\U0001F44D", "thumbsup", "thumbs up"},
+{"\U0001F44E", "thumbsdown", "thumbs down"},
+{"\U0000270A", "fist", "raised fist"},
+{"\U0001F44A", "punch", "oncoming fist"},
+{"\U0001F91B", "left_facing_fist", "left-facing fist"},
+{"\U0001F91C", "right_facing_fist", "right-facing fist"},
+{"\U0001F44F", "clap", "clapping hands"},
+{"\U0001F64C", "raised_hands", "raising hands"},
+{"\U0001FAF6", "heart hands", "heart hands"},
+{"\U0001F450", "open_hands", "open hands"},
+{"\U0001F932", "palms_up_together", "palms up together"},
+{"\U0001F91D", "handshake", "handshake"},
+{"\U0001F64F", "pray", "folded hands"},
+{"\U0000270D\U0000FE0F", "writing hand", "writing hand"},
+{"\U0001F485", "nail_care", "nail polish"},
+{"\U0001F933", "selfie", "selfie"},
+{"\U0001F4AA", "muscle", "flexed biceps"},
+{"\U0001F9BE", "mechanical arm", "mechanical arm"},
+{"\U0001F9BF", "mechanical leg", "mechanical leg"},
+{"\U0001F9B5", "leg", "leg"},
+{"\U0001F9B6", "foot", "foot"},
+{"\U0001F442", "ear", "ear"},
+{"\U0001F9BB", "ear with hearing aid", "ear with hearing aid"},
+{"\U0001F443", "nose", "nose"},
+{"\U0001F9E0", "brain", "brain"},
+{"\U0001FAC0", "anatomical heart", "anatomical heart"},
+{"\U0001FAC1", "lungs", "lungs"},
+{"\U0001F9B7", "tooth", "tooth"},
+{"\U0001F9B4", "bone", "bone"},
+{"\U0001F440", "eyes", "eyes"},
+{"\U0001F441\U0000FE0F", "eye", "eye"},
+{"\U0001F445", "tongue", "tongue"},
+{"\U0001F444", "lips", "mouth"},
+{"\U0001FAE6", "biting lip", "biting lip"},
+{"\U0001F476", "baby", "baby"},
+{"\U0001F9D2", "child", "child"},
+{"\U0001F466", "boy", "boy"},
+{"\U0001F467", "girl", "girl"},
+{"\U0001F9D1", "adult", "person"},
+{"\U0001F471", "person_with_blond_hair", "person: blond hair"},
+{"\U0001F468", "man", "man"},
+{"\U0001F9D4", "bearded_person", "person: beard"},
+{"\U0001F9D4\U0000200D\U00002642\U0000FE0F", "man: beard", "man: beard"},
+{"\U0001F9D4\U0000200D\U00002640\U0000FE0F", "woman: beard", "woman: beard"},
+{"\U0001F468\U0000200D\U0001F9B0", "man: red hair", "man: red hair"},
+{"\U0001F468\U0000200D\U0001F9B1", "man: curly hair", "man: curly hair"},
+{"\U0001F468\U0000200D\U0001F9B3", "man: white hair", "man: white hair"},
+{"\U0001F468\U0000200D\U0001F9B2", "man: bald", "man: bald"},
+{"\U0001F469", "woman", "woman"},
+{"\U0001F469\U0000200D\U0001F9B0", "woman: red hair", "woman: red hair"},
+{"\U0001F9D1\U0000200D\U0001F9B0", "person: red hair", "person: red hair"},
+{"\U0001F469\U0000200D\U0001F9B1", "woman: curly hair", "woman: curly hair"},
+{"\U0001F9D1\U0000200D\U0001F9B1", "person: curly hair", "person: curly hair"},
+{"\U0001F469\U0000200D\U0001F9B3", "woman: white hair", "woman: white hair"},
+{"\U0001F9D1\U0000200D\U0001F9B3", "person: white hair", "person: white hair"},
+{"\U0001F469\U0000200D\U0001F9B2", "woman: bald", "woman: bald"},
+{"\U0001F9D1\U0000200D\U0001F9B2", "person: bald", "person: bald"},
+{"\U0001F471\U0000200D\U00002640\U0000FE0F", "woman: blond hair", "woman: blond hair"},
+{"\U0001F471\U0000200D\U00002642\U0000FE0F", "man: blond hair", "man: blond hair"},
+{"\U0001F9D3", "older_adult", "older person"},
+{"\U0001F474", "older_man", "old man"},
+{"\U0001F475", "older_woman", "old woman"},
+{"\U0001F64D", "person_frowning", "person frowning"},
+{"\U0001F64D\U0000200D\U00002642\U0000FE0F", "man frowning", "man frowning"},
+{"\U0001F64D\U0000200D\U00002640\U0000FE0F", "woman frowning", "woman frowning"},
+{"\U0001F64E", "person_with_pouting_face", "person pouting"},
+{"\U0001F64E\U0000200D\U00002642\U0000FE0F", "man pouting", "man pouting"},
+{"\U0001F64E\U0000200D\U00002640\U0000FE0F", "woman pouting", "woman pouting"},
+{"\U0001F645", "no_good", "person gesturing NO"},
+{"\U0001F645\U0000200D\U00002642\U0000FE0F", "man gesturing NO", "man gesturing NO"},
+{"\U0001F645\U0000200D\U00002640\U0000FE0F", "woman gesturing NO", "woman gesturing NO"},
+{"\U0001F646", "ok_woman", "person gesturing OK"},
+{"\U0001F646\U0000200D\U00002642\U0000FE0F", "man gesturing OK", "man gesturing OK"},
+{"\U0001F646\U0000200D\U00002640\U0000FE0F", "woman gesturing OK", "woman gesturing OK"},
+{"\U0001F481", "information_desk_person", "person tipping hand"},
+{"\U0001F481\U0000200D\U00002642\U0000FE0F", "man tipping hand", "man tipping hand"},
+{"\U0001F481\U0000200D\U00002640\U0000FE0F", "woman tipping hand", "woman tipping hand"},
+{"\U0001F64B", "raising_hand", "person raising hand"},
+{"\U0001F64B\U0000200D\U00002642\U0000FE0F", "man raising hand", "man raising hand"},
+{"\U0001F64B\U0000200D\U00002640\U0000FE0F", "woman raising hand", "woman raising hand"},
+{"\U0001F9CF", "deaf person", "deaf person"},
+{"\U0001F9CF\U0000200D\U00002642\U0000FE0F", "deaf man", "deaf man"},
+{"\U0001F9CF\U0000200D\U00002640\U0000FE0F", "deaf woman", "deaf woman"},
+{"\U0001F647", "bow", "person bowing"},
+{"\U0001F647\U0000200D\U00002642\U0000FE0F", "man bowing", "man bowing"},
+{"\U0001F647\U0000200D\U00002640\U0000FE0F", "woman bowing", "woman bowing"},
+{"\U0001F926", "face_palm", "person facepalming"},
+{"\U0001F926\U0000200D\U00002642\U0000FE0F", "man facepalming", "man facepalming"},
+{"\U0001F926\U0000200D\U00002640\U0000FE0F", "woman facepalming", "woman facepalming"},
+{"\U0001F937", "shrug", "person shrugging"},
+{"\U0001F937\U0000200D\U00002642\U0000FE0F", "man shrugging", "man shrugging"},
+{"\U0001F937\U0000200D\U00002640\U0000FE0F", "woman shrugging", "woman shrugging"},
+{"\U0001F9D1\U0000200D\U00002695\U0000FE0F", "health worker", "health worker"},
+{"\U0001F468\U0000200D\U00002695\U0000FE0F", "man health worker", "man health worker"},
+{"\U0001F469\U0000200D\U00002695\U0000FE0F", "woman health worker", "woman health worker"},
+{"\U0001F9D1\U0000200D\U0001F393", "student", "student"},
+{"\U0001F468\U0000200D\U0001F393", "man student", "man student"},
+{"\U0001F469\U0000200D\U0001F393", "woman student", "woman student"},
+{"\U0001F9D1\U0000200D\U0001F3EB", "teacher", "teacher"},
+{"\U0001F468\U0000200D\U0001F3EB", "man teacher", "man teacher"},
+{"\U0001F469\U0000200D\U0001F3EB", "woman teacher", "woman teacher"},
+{"\U0001F9D1\U0000200D\U00002696\U0000FE0F", "judge", "judge"},
+{"\U0001F468\U0000200D\U00002696\U0000FE0F", "man judge", "man judge"},
+{"\U0001F469\U0000200D\U00002696\U0000FE0F", "woman judge", "woman judge"},
+{"\U0001F9D1\U0000200D\U0001F33E", "farmer", "farmer"},
+{"\U0001F468\U0000200D\U0001F33E", "man farmer", "man farmer"},
+{"\U0001F469\U0000200D\U0001F33E", "woman farmer", "woman farmer"},
+{"\U0001F9D1\U0000200D\U0001F373", "cook", "cook"},
+{"\U0001F468\U0000200D\U0001F373", "man cook", "man cook"},
+{"\U0001F469\U0000200D\U0001F373", "woman cook", "woman cook"},
+{"\U0001F9D1\U0000200D\U0001F527", "mechanic", "mechanic"},
+{"\U0001F468\U0000200D\U0001F527", "man mechanic", "man mechanic"},
+{"\U0001F469\U0000200D\U0001F527", "woman mechanic", "woman mechanic"},
+{"\U0001F9D1\U0000200D\U0001F3ED", "factory worker", "factory worker"},
+{"\U0001F468\U0000200D\U0001F3ED", "man factory worker", "man factory worker"},
+{"\U0001F469\U0000200D\U0001F3ED", "woman factory worker", "woman factory worker"},
+{"\U0001F9D1\U0000200D\U0001F4BC", "office worker", "office worker"},
+{"\U0001F468\U0000200D\U0001F4BC", "man office worker", "man office worker"},
+{"\U0001F469\U0000200D\U0001F4BC", "woman office worker", "woman office worker"},
+{"\U0001F9D1\U0000200D\U0001F52C", "scientist", "scientist"},
+{"\U0001F468\U0000200D\U0001F52C", "man scientist", "man scientist"},
+{"\U0001F469\U0000200D\U0001F52C", "woman scientist", "woman scientist"},
+{"\U0001F9D1\U0000200D\U0001F4BB", "technologist", "technologist"},
+{"\U0001F468\U0000200D\U0001F4BB", "man technologist", "man technologist"},
+{"\U0001F469\U0000200D\U0001F4BB", "woman technologist", "woman technologist"},
+{"\U0001F9D1\U0000200D\U0001F3A4", "singer", "singer"},
+{"\U0001F468\U0000200D\U0001F3A4", "man singer", "man singer"},
+{"\U0001F469\U0000200D\U0001F3A4", "woman singer", "woman singer"},
+{"\U0001F9D1\U0000200D\U0001F3A8", "artist", "artist"},
+{"\U0001F468\U0000200D\U0001F3A8", "man artist", "man artist"},
+{"\U0001F469\U0000200D\U0001F3A8", "woman artist", "woman artist"},
+{"\U0001F9D1\U0000200D\U00002708\U0000FE0F", "pilot", "pilot"},
+{"\U0001F468\U0000200D\U00002708\U0000FE0F", "man pilot", "man pilot"},
+{"\U0001F469\U0000200D\U00002708\U0000FE0F", "woman pilot", "woman pilot"},
+{"\U0001F9D1\U0000200D\U0001F680", "astronaut", "astronaut"},
+{"\U0001F468\U0000200D\U0001F680", "man astronaut", "man astronaut"},
+{"\U0001F469\U0000200D\U0001F680", "woman astronaut", "woman astronaut"},
+{"\U0001F9D1\U0000200D\U0001F692", "firefighter", "firefighter"},
+{"\U0001F468\U0000200D\U0001F692", "man firefighter", "man firefighter"},
+{"\U0001F469\U0000200D\U0001F692", "woman firefighter", "woman firefighter"},
+{"\U0001F46E", "cop", "police officer"},
+{"\U0001F46E\U0000200D\U00002642\U0000FE0F", "man police officer", "man police officer"},
+{"\U0001F46E\U0000200D\U00002640\U0000FE0F", "woman police officer", "woman police officer"},
+{"\U0001F575\U0000FE0F", "detective", "detective"},
+{"\U0001F575\U0000FE0F\U0000200D\U00002642\U0000FE0F", "man detective", "man detective"},
+{"\U0001F575\U0000FE0F\U0000200D\U00002640\U0000FE0F", "woman detective", "woman detective"},
+{"\U0001F482", "guardsman", "guard"},
+{"\U0001F482\U0000200D\U00002642\U0000FE0F", "man guard", "man guard"},
+{"\U0001F482\U0000200D\U00002640\U0000FE0F", "woman guard", "woman guard"},
+{"\U0001F977", "ninja", "ninja"},
+{"\U0001F477", "construction_worker", "construction worker"},
+{"\U0001F477\U0000200D\U00002642\U0000FE0F", "man construction worker", "man construction worker"},
+{"\U0001F477\U0000200D\U00002640\U0000FE0F", "woman construction worker", "woman construction worker"},
+{"\U0001FAC5", "person with crown", "person with crown"},
+{"\U0001F934", "prince", "prince"},
+{"\U0001F478", "princess", "princess"},
+{"\U0001F473", "man_with_turban", "person wearing turban"},
+{"\U0001F473\U0000200D\U00002642\U0000FE0F", "man wearing turban", "man wearing turban"},
+{"\U0001F473\U0000200D\U00002640\U0000FE0F", "woman wearing turban", "woman wearing turban"},
+{"\U0001F472", "man_with_gua_pi_mao", "person with skullcap"},
+{"\U0001F9D5", "woman_with_headscarf", "woman with headscarf"},
+{"\U0001F935", "man_in_tuxedo", "person in tuxedo"},
+{"\U0001F935\U0000200D\U00002642\U0000FE0F", "man in tuxedo", "man in tuxedo"},
+{"\U0001F935\U0000200D\U00002640\U0000FE0F", "woman in tuxedo", "woman in tuxedo"},
+{"\U0001F470", "bride_with_veil", "person with veil"},
+{"\U0001F470\U0000200D\U00002642\U0000FE0F", "man with veil", "man with veil"},
+{"\U0001F470\U0000200D\U00002640\U0000FE0F", "woman with veil", "woman with veil"},
+{"\U0001F930", "pregnant_woman", "pregnant woman"},
+{"\U0001FAC3", "pregnant man", "pregnant man"},
+{"\U0001FAC4", "pregnant person", "pregnant person"},
+{"\U0001F931", "breast_feeding", "breast-feeding"},
+{"\U0001F469\U0000200D\U0001F37C", "woman feeding baby", "woman feeding baby"},
+{"\U0001F468\U0000200D\U0001F37C", "man feeding baby", "man feeding baby"},
+{"\U0001F9D1\U0000200D\U0001F37C", "person feeding baby", "person feeding baby"},
+{"\U0001F47C", "angel", "baby angel"},
+{"\U0001F385", "santa", "Santa Claus"},
+{"\U0001F936", "mrs_claus", "Mrs. Claus"},
+{"\U0001F9D1\U0000200D\U0001F384", "mx claus", "mx claus"},
+{"\U0001F9B8", "superhero", "superhero"},
+{"\U0001F9B8\U0000200D\U00002642\U0000FE0F", "man superhero", "man superhero"},
+{"\U0001F9B8\U0000200D\U00002640\U0000FE0F", "woman superhero", "woman superhero"},
+{"\U0001F9B9", "supervillain", "supervillain"},
+{"\U0001F9B9\U0000200D\U00002642\U0000FE0F", "man supervillain", "man supervillain"},
+{"\U0001F9B9\U0000200D\U00002640\U0000FE0F", "woman supervillain", "woman supervillain"},
+{"\U0001F9D9", "mage", "mage"},
+{"\U0001F9D9\U0000200D\U00002642\U0000FE0F", "man mage", "man mage"},
+{"\U0001F9D9\U0000200D\U00002640\U0000FE0F", "woman mage", "woman mage"},
+{"\U0001F9DA", "fairy", "fairy"},
+{"\U0001F9DA\U0000200D\U00002642\U0000FE0F", "man fairy", "man fairy"},
+{"\U0001F9DA\U0000200D\U00002640\U0000FE0F", "woman fairy", "woman fairy"},
+{"\U0001F9DB", "vampire", "vampire"},
+{"\U0001F9DB\U0000200D\U00002642\U0000FE0F", "man vampire", "man vampire"},
+{"\U0001F9DB\U0000200D\U00002640\U0000FE0F", "woman vampire", "woman vampire"},
+{"\U0001F9DC", "merperson", "merperson"},
+{"\U0001F9DC\U0000200D\U00002642\U0000FE0F", "merman", "merman"},
+{"\U0001F9DC\U0000200D\U00002640\U0000FE0F", "mermaid", "mermaid"},
+{"\U0001F9DD", "elf", "elf"},
+{"\U0001F9DD\U0000200D\U00002642\U0000FE0F", "man elf", "man elf"},
+{"\U0001F9DD\U0000200D\U00002640\U0000FE0F", "woman elf", "woman elf"},
+{"\U0001F9DE", "genie", "genie"},
+{"\U0001F9DE\U0000200D\U00002642\U0000FE0F", "man genie", "man genie"},
+{"\U0001F9DE\U0000200D\U00002640\U0000FE0F", "woman genie", "woman genie"},
+{"\U0001F9DF", "zombie", "zombie"},
+{"\U0001F9DF\U0000200D\U00002642\U0000FE0F", "man zombie", "man zombie"},
+{"\U0001F9DF\U0000200D\U00002640\U0000FE0F", "woman zombie", "woman zombie"},
+{"\U0001F9CC", "troll", "troll"},
+{"\U0001F486", "massage", "person getting massage"},
+{"\U0001F486\U0000200D\U00002642\U0000FE0F", "man getting massage", "man getting massage"},
+{"\U0001F486\U0000200D\U00002640\U0000FE0F", "woman getting massage", "woman getting massage"},
+{"\U0001F487", "haircut", "person getting haircut"},
+{"\U0001F487\U0000200D\U00002642\U0000FE0F", "man getting haircut", "man getting haircut"},
+{"\U0001F487\U0000200D\U00002640\U0000FE0F", "woman getting haircut", "woman getting haircut"},
+{"\U0001F6B6", "walking", "person walking"},
+{"\U0001F6B6\U0000200D\U00002642\U0000FE0F", "man walking", "man walking"},
+{"\U0001F6B6\U0000200D\U00002640\U0000FE0F", "woman walking", "woman walking"},
+{"\U0001F9CD", "person standing", "person standing"},
+{"\U0001F9CD\U0000200D\U00002642\U0000FE0F", "man standing", "man standing"},
+{"\U0001F9CD\U0000200D\U00002640\U0000FE0F", "woman standing", "woman standing"},
+{"\U0001F9CE", "person kneeling", "person kneeling"},
+{"\U0001F9CE\U0000200D\U00002642\U0000FE0F", "man kneeling", "man kneeling"},
+{"\U0001F9CE\U0000200D\U00002640\U0000FE0F", "woman kneeling", "woman kneeling"},
+{"\U0001F9D1\U0000200D\U0001F9AF", "person with white cane", "person with white cane"},
+{"\U0001F468\U0000200D\U0001F9AF", "man with white cane", "man with white cane"},
+{"\U0001F469\U0000200D\U0001F9AF", "woman with white cane", "woman with white cane"},
+{"\U0001F9D1\U0000200D\U0001F9BC", "person in motorized wheelchair", "person in motorized wheelchair"},
+{"\U0001F468\U0000200D\U0001F9BC", "man in motorized wheelchair", "man in motorized wheelchair"},
+{"\U0001F469\U0000200D\U0001F9BC", "woman in motorized wheelchair", "woman in motorized wheelchair"},
+{"\U0001F9D1\U0000200D\U0001F9BD", "person in manual wheelchair", "person in manual wheelchair"},
+{"\U0001F468\U0000200D\U0001F9BD", "man in manual wheelchair", "man in manual wheelchair"},
+{"\U0001F469\U0000200D\U0001F9BD", "woman in manual wheelchair", "woman in manual wheelchair"},
+{"\U0001F3C3", "runner", "person running"},
+{"\U0001F3C3\U0000200D\U00002642\U0000FE0F", "man running", "man running"},
+{"\U0001F3C3\U0000200D\U00002640\U0000FE0F", "woman running", "woman running"},
+{"\U0001F483", "dancer", "woman dancing"},
+{"\U0001F57A", "man_dancing", "man dancing"},
+{"\U0001F574\U0000FE0F", "person in suit levitating", "person in suit levitating"},
+{"\U0001F46F", "dancers", "people with bunny ears"},
+{"\U0001F46F\U0000200D\U00002642\U0000FE0F", "men with bunny ears", "men with bunny ears"},
+{"\U0001F46F\U0000200D\U00002640\U0000FE0F", "women with bunny ears", "women with bunny ears"},
+{"\U0001F9D6", "person_in_steamy_room", "person in steamy room"},
+{"\U0001F9D6\U0000200D\U00002642\U0000FE0F", "man in steamy room", "man in steamy room"},
+{"\U0001F9D6\U0000200D\U00002640\U0000FE0F", "woman in steamy room", "woman in steamy room"},
+{"\U0001F9D7", "person_climbing", "person climbing"},
+{"\U0001F9D7\U0000200D\U00002642\U0000FE0F", "man climbing", "man climbing"},
+{"\U0001F9D7\U0000200D\U00002640\U0000FE0F", "woman climbing", "woman climbing"},
+{"\U0001F93A", "fencer", "person fencing"},
+{"\U0001F3C7", "horse_racing", "horse racing"},
+{"\U000026F7\U0000FE0F", "skier", "skier"},
+{"\U0001F3C2", "snowboarder", "snowboarder"},
+{"\U0001F3CC\U0000FE0F", "person golfing", "person golfing"},
+{"\U0001F3CC\U0000FE0F\U0000200D\U00002642\U0000FE0F", "man golfing", "man golfing"},
+{"\U0001F3CC\U0000FE0F\U0000200D\U00002640\U0000FE0F", "woman golfing", "woman golfing"},
+{"\U0001F3C4", "surfer", "person surfing"},
+{"\U0001F3C4\U0000200D\U00002642\U0000FE0F", "man surfing", "man surfing"},
+{"\U0001F3C4\U0000200D\U00002640\U0000FE0F", "woman surfing", "woman surfing"},
+{"\U0001F6A3", "rowboat", "person rowing boat"},
+{"\U0001F6A3\U0000200D\U00002642\U0000FE0F", "man rowing boat", "man rowing boat"},
+{"\U0001F6A3\U0000200D\U00002640\U0000FE0F", "woman rowing boat", "woman rowing boat"},
+{"\U0001F3CA", "swimmer", "person swimming"},
+{"\U0001F3CA\U0000200D\U00002642\U0000FE0F", "man swimming", "man swimming"},
+{"\U0001F3CA\U0000200D\U00002640\U0000FE0F", "woman swimming", "woman swimming"},
+{"\U000026F9\U0000FE0F", "person bouncing ball", "person bouncing ball"},
+{"\U000026F9\U0000FE0F\U0000200D\U00002642\U0000FE0F", "man bouncing ball", "man bouncing ball"},
+{"\U000026F9\U0000FE0F\U0000200D\U00002640\U0000FE0F", "woman bouncing ball", "woman bouncing ball"},
+{"\U0001F3CB\U0000FE0F", "person lifting weights", "person lifting weights"},
+{"\U0001F3CB\U0000FE0F\U0000200D\U00002642\U0000FE0F", "man lifting weights", "man lifting weights"},
+{"\U0001F3CB\U0000FE0F\U0000200D\U00002640\U0000FE0F", "woman lifting weights", "woman lifting weights"},
+{"\U0001F6B4", "bicyclist", "person biking"},
+{"\U0001F6B4\U0000200D\U00002642\U0000FE0F", "man biking", "man biking"},
+{"\U0001F6B4\U0000200D\U00002640\U0000FE0F", "woman biking", "woman biking"},
+{"\U0001F6B5", "mountain_bicyclist", "person mountain biking"},
+{"\U0001F6B5\U0000200D\U00002642\U0000FE0F", "man mountain biking", "man mountain biking"},
+{"\U0001F6B5\U0000200D\U00002640\U0000FE0F", "woman mountain biking", "woman mountain biking"},
+{"\U0001F938", "cartwheel", "person cartwheeling"},
+{"\U0001F938\U0000200D\U00002642\U0000FE0F", "man cartwheeling", "man cartwheeling"},
+{"\U0001F938\U0000200D\U00002640\U0000FE0F", "woman cartwheeling", "woman cartwheeling"},
+{"\U0001F93C", "wrestlers", "people wrestling"},
+{"\U0001F93C\U0000200D\U00002642\U0000FE0F", "men wrestling", "men wrestling"},
+{"\U0001F93C\U0000200D\U00002640\U0000FE0F", "women wrestling", "women wrestling"},
+{"\U0001F93D", "water_polo", "person playing water polo"},
+{"\U0001F93D\U0000200D\U00002642\U0000FE0F", "man playing water polo", "man playing water polo"},
+{"\U0001F93D\U0000200D\U00002640\U0000FE0F", "woman playing water polo", "woman playing water polo"},
+{"\U0001F93E", "handball", "person playing handball"},
+{"\U0001F93E\U0000200D\U00002642\U0000FE0F", "man playing handball", "man playing handball"},
+{"\U0001F93E\U0000200D\U00002640\U0000FE0F", "woman playing handball", "woman playing handball"},
+{"\U0001F939", "juggling", "person juggling"},
+{"\U0001F939\U0000200D\U00002642\U0000FE0F", "man juggling", "man juggling"},
+{"\U0001F939\U0000200D\U00002640\U0000FE0F", "woman juggling", "woman juggling"},
+{"\U0001F9D8", "person_in_lotus_position", "person in lotus position"},
+{"\U0001F9D8\U0000200D\U00002642\U0000FE0F", "man in lotus position", "man in lotus position"},
+{"\U0001F9D8\U0000200D\U00002640\U0000FE0F", "woman in lotus position", "woman in lotus position"},
+{"\U0001F6C0", "bath", "person taking bath"},
+{"\U0001F6CC", "sleeping_accommodation", "person in bed"},
+{"\U0001F9D1\U0000200D\U0001F91D\U0000200D\U0001F9D1", "people holding hands", "people holding hands"},
+{"\U0001F46D", "two_women_holding_hands", "women holding hands"},
+{"\U0001F46B", "couple", "woman and man holding hands"},
+{"\U0001F46C", "two_men_holding_hands", "men holding hands"},
+{"\U0001F48F", "couplekiss", "kiss"},
+{"\U0001F469\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468", "kiss: woman, man", "kiss: woman, man"},
+{"\U0001F468\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468", "kiss: man, man", "kiss: man, man"},
+{"\U0001F469\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469", "kiss: woman, woman", "kiss: woman, woman"},
+{"\U0001F491", "couple_with_heart", "couple with heart"},
+{"\U0001F469\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468", "couple with heart: woman, man", "couple with heart: woman, man"},
+{"\U0001F468\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468", "couple with heart: man, man", "couple with heart: man, man"},
+{"\U0001F469\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469", "couple with heart: woman, woman", "couple with heart: woman, woman"},
+{"\U0001F46A", "family", "family"},
+{"\U0001F468\U0000200D\U0001F469\U0000200D\U0001F466", "family: man, woman, boy", "family: man, woman, boy"},
+{"\U0001F468\U0000200D\U0001F469\U0000200D\U0001F467", "family: man, woman, girl", "family: man, woman, girl"},
+{"\U0001F468\U0000200D\U0001F469\U0000200D\U0001F467\U0000200D\U0001F466", "family: man, woman, girl, boy", "family: man, woman, girl, boy"},
+{"\U0001F468\U0000200D\U0001F469\U0000200D\U0001F466\U0000200D\U0001F466", "family: man, woman, boy, boy", "family: man, woman, boy, boy"},
+{"\U0001F468\U0000200D\U0001F469\U0000200D\U0001F467\U0000200D\U0001F467", "family: man, woman, girl, girl", "family: man, woman, girl, girl"},
+{"\U0001F468\U0000200D\U0001F468\U0000200D\U0001F466", "family: man, man, boy", "family: man, man, boy"},
+{"\U0001F468\U0000200D\U0001F468\U0000200D\U0001F467", "family: man, man, girl", "family: man, man, girl"},
+{"\U0001F468\U0000200D\U0001F468\U0000200D\U0001F467\U0000200D\U0001F466", "family: man, man, girl, boy", "family: man, man, girl, boy"},
+{"\U0001F468\U0000200D\U0001F468\U0000200D\U0001F466\U0000200D\U0001F466", "family: man, man, boy, boy", "family: man, man, boy, boy"},
+{"\U0001F468\U0000200D\U0001F468\U0000200D\U0001F467\U0000200D\U0001F467", "family: man, man, girl, girl", "family: man, man, girl, girl"},
+{"\U0001F469\U0000200D\U0001F469\U0000200D\U0001F466", "family: woman, woman, boy", "family: woman, woman, boy"},
+{"\U0001F469\U0000200D\U0001F469\U0000200D\U0001F467", "family: woman, woman, girl", "family: woman, woman, girl"},
+{"\U0001F469\U0000200D\U0001F469\U0000200D\U0001F467\U0000200D\U0001F466", "family: woman, woman, girl, boy", "family: woman, woman, girl, boy"},
+{"\U0001F469\U0000200D\U0001F469\U0000200D\U0001F466\U0000200D\U0001F466", "family: woman, woman, boy, boy", "family: woman, woman, boy, boy"},
+{"\U0001F469\U0000200D\U0001F469\U0000200D\U0001F467\U0000200D\U0001F467", "family: woman, woman, girl, girl", "family: woman, woman, girl, girl"},
+{"\U0001F468\U0000200D\U0001F466", "family: man, boy", "family: man, boy"},
+{"\U0001F468\U0000200D\U0001F466\U0000200D\U0001F466", "family: man, boy, boy", "family: man, boy, boy"},
+{"\U0001F468\U0000200D\U0001F467", "family: man, girl", "family: man, girl"},
+{"\U0001F468\U0000200D\U0001F467\U0000200D\U0001F466", "family: man, girl, boy", "family: man, girl, boy"},
+{"\U0001F468\U0000200D\U0001F467\U0000200D\U0001F467", "family: man, girl, girl", "family: man, girl, girl"},
+{"\U0001F469\U0000200D\U0001F466", "family: woman, boy", "family: woman, boy"},
+{"\U0001F469\U0000200D\U0001F466\U0000200D\U0001F466", "family: woman, boy, boy", "family: woman, boy, boy"},
+{"\U0001F469\U0000200D\U0001F467", "family: woman, girl", "family: woman, girl"},
+{"\U0001F469\U0000200D\U0001F467\U0000200D\U0001F466", "family: woman, girl, boy", "family: woman, girl, boy"},
+{"\U0001F469\U0000200D\U0001F467\U0000200D\U0001F467", "family: woman, girl, girl", "family: woman, girl, girl"},
+{"\U0001F5E3\U0000FE0F", "speaking head", "speaking head"},
+{"\U0001F464", "bust_in_silhouette", "bust in silhouette"},
+{"\U0001F465", "busts_in_silhouette", "busts in silhouette"},
+{"\U0001FAC2", "people hugging", "people hugging"},
+{"\U0001F463", "footprints", "footprints"},
+};
+constexpr EmojiData componentEmojis[] = {
+{"\U0001F9B0", "red_haired", "red hair"},
+{"\U0001F9B1", "curly_haired", "curly hair"},
+{"\U0001F9B3", "white_haired", "white hair"},
+{"\U0001F9B2", "bald", "bald"},
+};
+constexpr EmojiData natureEmojis[] = {
+{"\U0001F435", "monkey_face", "monkey face"},
+{"\U0001F412", "monkey", "monkey"},
+{"\U0001F98D", "gorilla", "gorilla"},
+{"\U0001F9A7", "orangutan", "orangutan"},
+{"\U0001F436", "dog", "dog face"},
+{"\U0001F415", "dog2", "dog"},
+{"\U0001F9AE", "guide dog", "guide dog"},
+{"\U0001F415\U0000200D\U0001F9BA", "service dog", "service dog"},
+{"\U0001F429", "poodle", "poodle"},
+{"\U0001F43A", "wolf", "wolf"},
+{"\U0001F98A", "fox", "fox"},
+{"\U0001F99D", "raccoon", "raccoon"},
+{"\U0001F431", "cat", "cat face"},
+{"\U0001F408", "cat2", "cat"},
+{"\U0001F408\U0000200D\U00002B1B", "black cat", "black cat"},
+{"\U0001F981", "lion_face", "lion"},
+{"\U0001F42F", "tiger", "tiger face"},
+{"\U0001F405", "tiger2", "tiger"},
+{"\U0001F406", "leopard", "leopard"},
+{"\U0001F434", "horse", "horse face"},
+{"\U0001F40E", "racehorse", "horse"},
+{"\U0001F984", "unicorn", "unicorn"},
+{"\U0001F993", "zebra", "zebra"},
+{"\U0001F98C", "deer", "deer"},
+{"\U0001F9AC", "bison", "bison"},
+{"\U0001F42E", "cow", "cow face"},
+{"\U0001F402", "ox", "ox"},
+{"\U0001F403", "water_buffalo", "water buffalo"},
+{"\U0001F404", "cow2", "cow"},
+{"\U0001F437", "pig", "pig face"},
+{"\U0001F416", "pig2", "pig"},
+{"\U0001F417", "boar", "boar"},
+{"\U0001F43D", "pig_nose", "pig nose"},
+{"\U0001F40F", "ram", "ram"},
+{"\U0001F411", "sheep", "ewe"},
+{"\U0001F410", "goat", "goat"},
+{"\U0001F42A", "dromedary_camel", "camel"},
+{"\U0001F42B", "camel", "two-hump camel"},
+{"\U0001F999", "llama", "llama"},
+{"\U0001F992", "giraffe", "giraffe"},
+{"\U0001F418", "elephant", "elephant"},
+{"\U0001F9A3", "mammoth", "mammoth"},
+{"\U0001F98F", "rhino", "rhinoceros"},
+{"\U0001F99B", "hippopotamus", "hippopotamus"},
+{"\U0001F42D", "mouse", "mouse face"},
+{"\U0001F401", "mouse2", "mouse"},
+{"\U0001F400", "rat", "rat"},
+{"\U0001F439", "hamster", "hamster"},
+{"\U0001F430", "rabbit", "rabbit face"},
+{"\U0001F407", "rabbit2", "rabbit"},
+{"\U0001F43F\U0000FE0F", "chipmunk", "chipmunk"},
+{"\U0001F9AB", "beaver", "beaver"},
+{"\U0001F994", "hedgehog", "hedgehog"},
+{"\U0001F987", "bat", "bat"},
+{"\U0001F43B", "bear", "bear"},
+{"\U0001F43B\U0000200D\U00002744\U0000FE0F", "polar bear", "polar bear"},
+{"\U0001F428", "koala", "koala"},
+{"\U0001F43C", "panda_face", "panda"},
+{"\U0001F9A5", "sloth", "sloth"},
+{"\U0001F9A6", "otter", "otter"},
+{"\U0001F9A8", "skunk", "skunk"},
+{"\U0001F998", "kangaroo", "kangaroo"},
+{"\U0001F9A1", "badger", "badger"},
+{"\U0001F43E", "feet", "paw prints"},
+{"\U0001F983", "turkey", "turkey"},
+{"\U0001F414", "chicken", "chicken"},
+{"\U0001F413", "rooster", "rooster"},
+{"\U0001F423", "hatching_chick", "hatching chick"},
+{"\U0001F424", "baby_chick", "baby chick"},
+{"\U0001F425", "hatched_chick", "front-facing baby chick"},
+{"\U0001F426", "bird", "bird"},
+{"\U0001F427", "penguin", "penguin"},
+{"\U0001F54A\U0000FE0F", "dove", "dove"},
+{"\U0001F985", "eagle", "eagle"},
+{"\U0001F986", "duck", "duck"},
+{"\U0001F9A2", "swan", "swan"},
+{"\U0001F989", "owl", "owl"},
+{"\U0001F9A4", "dodo", "dodo"},
+{"\U0001FAB6", "feather", "feather"},
+{"\U0001F9A9", "flamingo", "flamingo"},
+{"\U0001F99A", "peacock", "peacock"},
+{"\U0001F99C", "parrot", "parrot"},
+{"\U0001F438", "frog", "frog"},
+{"\U0001F40A", "crocodile", "crocodile"},
+{"\U0001F422", "turtle", "turtle"},
+{"\U0001F98E", "lizard", "lizard"},
+{"\U0001F40D", "snake", "snake"},
+{"\U0001F432", "dragon_face", "dragon face"},
+{"\U0001F409", "dragon", "dragon"},
+{"\U0001F995", "sauropod", "sauropod"},
+{"\U0001F996", "t_rex", "T-Rex"},
+{"\U0001F433", "whale", "spouting whale"},
+{"\U0001F40B", "whale2", "whale"},
+{"\U0001F42C", "dolphin", "dolphin"},
+{"\U0001F9AD", "seal", "seal"},
+{"\U0001F41F", "fish", "fish"},
+{"\U0001F420", "tropical_fish", "tropical fish"},
+{"\U0001F421", "blowfish", "blowfish"},
+{"\U0001F988", "shark", "shark"},
+{"\U0001F419", "octopus", "octopus"},
+{"\U0001F41A", "shell", "spiral shell"},
+{"\U0001FAB8", "coral", "coral"},
+{"\U0001F40C", "snail", "snail"},
+{"\U0001F98B", "butterfly", "butterfly"},
+{"\U0001F41B", "bug", "bug"},
+{"\U0001F41C", "ant", "ant"},
+{"\U0001F41D", "bee", "honeybee"},
+{"\U0001FAB2", "beetle", "beetle"},
+{"\U0001F41E", "beetle", "lady beetle"},
+{"\U0001F997", "cricket", "cricket"},
+{"\U0001FAB3", "cockroach", "cockroach"},
+{"\U0001F577\U0000FE0F", "spider", "spider"},
+{"\U0001F578\U0000FE0F", "spider web", "spider web"},
+{"\U0001F982", "scorpion", "scorpion"},
+{"\U0001F99F", "mosquito", "mosquito"},
+{"\U0001FAB0", "fly", "fly"},
+{"\U0001FAB1", "worm", "worm"},
+{"\U0001F9A0", "microbe", "microbe"},
+{"\U0001F490", "bouquet", "bouquet"},
+{"\U0001F338", "cherry_blossom", "cherry blossom"},
+{"\U0001F4AE", "white_flower", "white flower"},
+{"\U0001FAB7", "lotus", "lotus"},
+{"\U0001F3F5\U0000FE0F", "rosette", "rosette"},
+{"\U0001F339", "rose", "rose"},
+{"\U0001F940", "wilted_rose", "wilted flower"},
+{"\U0001F33A", "hibiscus", "hibiscus"},
+{"\U0001F33B", "sunflower", "sunflower"},
+{"\U0001F33C", "blossom", "blossom"},
+{"\U0001F337", "tulip", "tulip"},
+{"\U0001F331", "seedling", "seedling"},
+{"\U0001FAB4", "potted plant", "potted plant"},
+{"\U0001F332", "evergreen_tree", "evergreen tree"},
+{"\U0001F333", "deciduous_tree", "deciduous tree"},
+{"\U0001F334", "palm_tree", "palm tree"},
+{"\U0001F335", "cactus", "cactus"},
+{"\U0001F33E", "ear_of_rice", "sheaf of rice"},
+{"\U0001F33F", "herb", "herb"},
+{"\U00002618\U0000FE0F", "shamrock", "shamrock"},
+{"\U0001F340", "four_leaf_clover", "four leaf clover"},
+{"\U0001F341", "maple_leaf", "maple leaf"},
+{"\U0001F342", "fallen_leaf", "fallen leaf"},
+{"\U0001F343", "leaves", "leaf fluttering in wind"},
+{"\U0001FAB9", "empty nest", "empty nest"},
+{"\U0001FABA", "nest with eggs", "nest with eggs"},
+};
+constexpr EmojiData foodEmojis[] = {
+{"\U0001F347", "grapes", "grapes"},
+{"\U0001F348", "melon", "melon"},
+{"\U0001F349", "watermelon", "watermelon"},
+{"\U0001F34A", "tangerine", "tangerine"},
+{"\U0001F34B", "lemon", "lemon"},
+{"\U0001F34C", "banana", "banana"},
+{"\U0001F34D", "pineapple", "pineapple"},
+{"\U0001F96D", "mango", "mango"},
+{"\U0001F34E", "apple", "red apple"},
+{"\U0001F34F", "green_apple", "green apple"},
+{"\U0001F350", "pear", "pear"},
+{"\U0001F351", "peach", "peach"},
+{"\U0001F352", "cherries", "cherries"},
+{"\U0001F353", "strawberry", "strawberry"},
+{"\U0001FAD0", "blueberries", "blueberries"},
+{"\U0001F95D", "kiwi", "kiwi fruit"},
+{"\U0001F345", "tomato", "tomato"},
+{"\U0001FAD2", "olive", "olive"},
+{"\U0001F965", "coconut", "coconut"},
+{"\U0001F951", "avocado", "avocado"},
+{"\U0001F346", "eggplant", "eggplant"},
+{"\U0001F954", "potato", "potato"},
+{"\U0001F955", "carrot", "carrot"},
+{"\U0001F33D", "corn", "ear of corn"},
+{"\U0001F336\U0000FE0F", "hot pepper", "hot pepper"},
+{"\U0001FAD1", "bell pepper", "bell pepper"},
+{"\U0001F952", "cucumber", "cucumber"},
+{"\U0001F96C", "leafy_green", "leafy green"},
+{"\U0001F966", "broccoli", "broccoli"},
+{"\U0001F9C4", "garlic", "garlic"},
+{"\U0001F9C5", "onion", "onion"},
+{"\U0001F344", "mushroom", "mushroom"},
+{"\U0001F95C", "peanuts", "peanuts"},
+{"\U0001FAD8", "beans", "beans"},
+{"\U0001F330", "chestnut", "chestnut"},
+{"\U0001F35E", "bread", "bread"},
+{"\U0001F950", "croissant", "croissant"},
+{"\U0001F956", "french_bread", "baguette bread"},
+{"\U0001FAD3", "flatbread", "flatbread"},
+{"\U0001F968", "pretzel", "pretzel"},
+{"\U0001F96F", "bagel", "bagel"},
+{"\U0001F95E", "pancakes", "pancakes"},
+{"\U0001F9C7", "waffle", "waffle"},
+{"\U0001F9C0", "cheese", "cheese wedge"},
+{"\U0001F356", "meat_on_bone", "meat on bone"},
+{"\U0001F357", "poultry_leg", "poultry leg"},
+{"\U0001F969", "cut_of_meat", "cut of meat"},
+{"\U0001F953", "bacon", "bacon"},
+{"\U0001F354", "hamburger", "hamburger"},
+{"\U0001F35F", "fries", "french fries"},
+{"\U0001F355", "pizza", "pizza"},
+{"\U0001F32D", "hotdog", "hot dog"},
+{"\U0001F96A", "sandwich", "sandwich"},
+{"\U0001F32E", "taco", "taco"},
+{"\U0001F32F", "burrito", "burrito"},
+{"\U0001FAD4", "tamale", "tamale"},
+{"\U0001F959", "stuffed_flatbread", "stuffed flatbread"},
+{"\U0001F9C6", "falafel", "falafel"},
+{"\U0001F95A", "egg", "egg"},
+{"\U0001F373", "cooking", "cooking"},
+{"\U0001F958", "shallow_pan_of_food", "shallow pan of food"},
+{"\U0001F372", "stew", "pot of food"},
+{"\U0001FAD5", "fondue", "fondue"},
+{"\U0001F963", "bowl_with_spoon", "bowl with spoon"},
+{"\U0001F957", "salad", "green salad"},
+{"\U0001F37F", "popcorn", "popcorn"},
+{"\U0001F9C8", "butter", "butter"},
+{"\U0001F9C2", "salt", "salt"},
+{"\U0001F96B", "canned_food", "canned food"},
+{"\U0001F371", "bento", "bento box"},
+{"\U0001F358", "rice_cracker", "rice cracker"},
+{"\U0001F359", "rice_ball", "rice ball"},
+{"\U0001F35A", "rice", "cooked rice"},
+{"\U0001F35B", "curry", "curry rice"},
+{"\U0001F35C", "ramen", "steaming bowl"},
+{"\U0001F35D", "spaghetti", "spaghetti"},
+{"\U0001F360", "sweet_potato", "roasted sweet potato"},
+{"\U0001F362", "oden", "oden"},
+{"\U0001F363", "sushi", "sushi"},
+{"\U0001F364", "fried_shrimp", "fried shrimp"},
+{"\U0001F365", "fish_cake", "fish cake with swirl"},
+{"\U0001F96E", "moon_cake", "moon cake"},
+{"\U0001F361", "dango", "dango"},
+{"\U0001F95F", "dumpling", "dumpling"},
+{"\U0001F960", "fortune_cookie", "fortune cookie"},
+{"\U0001F961", "takeout_box", "takeout box"},
+{"\U0001F980", "crab", "crab"},
+{"\U0001F99E", "lobster", "lobster"},
+{"\U0001F990", "shrimp", "shrimp"},
+{"\U0001F991", "squid", "squid"},
+{"\U0001F9AA", "oyster", "oyster"},
+{"\U0001F366", "icecream", "soft ice cream"},
+{"\U0001F367", "shaved_ice", "shaved ice"},
+{"\U0001F368", "ice_cream", "ice cream"},
+{"\U0001F369", "doughnut", "doughnut"},
+{"\U0001F36A", "cookie", "cookie"},
+{"\U0001F382", "birthday", "birthday cake"},
+{"\U0001F370", "cake", "shortcake"},
+{"\U0001F9C1", "cupcake", "cupcake"},
+{"\U0001F967", "pie", "pie"},
+{"\U0001F36B", "chocolate_bar", "chocolate bar"},
+{"\U0001F36C", "candy", "candy"},
+{"\U0001F36D", "lollipop", "lollipop"},
+{"\U0001F36E", "custard", "custard"},
+{"\U0001F36F", "honey_pot", "honey pot"},
+{"\U0001F37C", "baby_bottle", "baby bottle"},
+{"\U0001F95B", "milk", "glass of milk"},
+{"\U00002615", "coffee", "hot beverage"},
+{"\U0001FAD6", "teapot", "teapot"},
+{"\U0001F375", "tea", "teacup without handle"},
+{"\U0001F376", "sake", "sake"},
+{"\U0001F37E", "champagne", "bottle with popping cork"},
+{"\U0001F377", "wine_glass", "wine glass"},
+{"\U0001F378", "cocktail", "cocktail glass"},
+{"\U0001F379", "tropical_drink", "tropical drink"},
+{"\U0001F37A", "beer", "beer mug"},
+{"\U0001F37B", "beers", "clinking beer mugs"},
+{"\U0001F942", "champagne_glass", "clinking glasses"},
+{"\U0001F943", "tumbler_glass", "tumbler glass"},
+{"\U0001FAD7", "pouring liquid", "pouring liquid"},
+{"\U0001F964", "cup_with_straw", "cup with straw"},
+{"\U0001F9CB", "bubble tea", "bubble tea"},
+{"\U0001F9C3", "beverage box", "beverage box"},
+{"\U0001F9C9", "mate", "mate"},
+{"\U0001F9CA", "ice", "ice"},
+{"\U0001F962", "chopsticks", "chopsticks"},
+{"\U0001F37D\U0000FE0F", "fork and knife with plate", "fork and knife with plate"},
+{"\U0001F374", "fork_and_knife", "fork and knife"},
+{"\U0001F944", "spoon", "spoon"},
+{"\U0001F52A", "knife", "kitchen knife"},
+{"\U0001FAD9", "jar", "jar"},
+{"\U0001F3FA", "amphora", "amphora"},
+};
+constexpr EmojiData travelEmojis[] = {
+{"\U0001F30D", "earth_africa", "globe showing Europe-Africa"},
+{"\U0001F30E", "earth_americas", "globe showing Americas"},
+{"\U0001F30F", "earth_asia", "globe showing Asia-Australia"},
+{"\U0001F310", "globe_with_meridians", "globe with meridians"},
+{"\U0001F5FA\U0000FE0F", "world map", "world map"},
+{"\U0001F5FE", "japan", "map of Japan"},
+{"\U0001F9ED", "compass", "compass"},
+{"\U0001F3D4\U0000FE0F", "snow-capped mountain", "snow-capped mountain"},
+{"\U000026F0\U0000FE0F", "mountain", "mountain"},
+{"\U0001F30B", "volcano", "volcano"},
+{"\U0001F5FB", "mount_fuji", "mount fuji"},
+{"\U0001F3D5\U0000FE0F", "camping", "camping"},
+{"\U0001F3D6\U0000FE0F", "beach with umbrella", "beach with umbrella"},
+{"\U0001F3DC\U0000FE0F", "desert", "desert"},
+{"\U0001F3DD\U0000FE0F", "desert island", "desert island"},
+{"\U0001F3DE\U0000FE0F", "national park", "national park"},
+{"\U0001F3DF\U0000FE0F", "stadium", "stadium"},
+{"\U0001F3DB\U0000FE0F", "classical building", "classical building"},
+{"\U0001F3D7\U0000FE0F", "building construction", "building construction"},
+{"\U0001F9F1", "bricks", "brick"},
+{"\U0001FAA8", "rock", "rock"},
+{"\U0001FAB5", "wood", "wood"},
+{"\U0001F6D6", "hut", "hut"},
+{"\U0001F3D8\U0000FE0F", "houses", "houses"},
+{"\U0001F3DA\U0000FE0F", "derelict house", "derelict house"},
+{"\U0001F3E0", "house", "house"},
+{"\U0001F3E1", "house_with_garden", "house with garden"},
+{"\U0001F3E2", "office", "office building"},
+{"\U0001F3E3", "post_office", "Japanese post office"},
+{"\U0001F3E4", "european_post_office", "post office"},
+{"\U0001F3E5", "hospital", "hospital"},
+{"\U0001F3E6", "bank", "bank"},
+{"\U0001F3E8", "hotel", "hotel"},
+{"\U0001F3E9", "love_hotel", "love hotel"},
+{"\U0001F3EA", "convenience_store", "convenience store"},
+{"\U0001F3EB", "school", "school"},
+{"\U0001F3EC", "department_store", "department store"},
+{"\U0001F3ED", "factory", "factory"},
+{"\U0001F3EF", "japanese_castle", "Japanese castle"},
+{"\U0001F3F0", "european_castle", "castle"},
+{"\U0001F492", "wedding", "wedding"},
+{"\U0001F5FC", "tokyo_tower", "Tokyo tower"},
+{"\U0001F5FD", "statue_of_liberty", "Statue of Liberty"},
+{"\U000026EA", "church", "church"},
+{"\U0001F54C", "mosque", "mosque"},
+{"\U0001F6D5", "hindu temple", "hindu temple"},
+{"\U0001F54D", "synagogue", "synagogue"},
+{"\U000026E9\U0000FE0F", "shinto shrine", "shinto shrine"},
+{"\U0001F54B", "kaaba", "kaaba"},
+{"\U000026F2", "fountain", "fountain"},
+{"\U000026FA", "tent", "tent"},
+{"\U0001F301", "foggy", "foggy"},
+{"\U0001F303", "night_with_stars", "night with stars"},
+{"\U0001F3D9\U0000FE0F", "cityscape", "cityscape"},
+{"\U0001F304", "sunrise_over_mountains", "sunrise over mountains"},
+{"\U0001F305", "sunrise", "sunrise"},
+{"\U0001F306", "city_dusk", "cityscape at dusk"},
+{"\U0001F307", "city_sunset", "sunset"},
+{"\U0001F309", "bridge_at_night", "bridge at night"},
+{"\U00002668\U0000FE0F", "hot springs", "hot springs"},
+{"\U0001F3A0", "carousel_horse", "carousel horse"},
+{"\U0001F6DD", "playground slide", "playground slide"},
+{"\U0001F3A1", "ferris_wheel", "ferris wheel"},
+{"\U0001F3A2", "roller_coaster", "roller coaster"},
+{"\U0001F488", "barber", "barber pole"},
+{"\U0001F3AA", "circus_tent", "circus tent"},
+{"\U0001F682", "steam_locomotive", "locomotive"},
+{"\U0001F683", "railway_car", "railway car"},
+{"\U0001F684", "bullettrain_side", "high-speed train"},
+{"\U0001F685", "bullettrain_front", "bullet train"},
+{"\U0001F686", "train2", "train"},
+{"\U0001F687", "metro", "metro"},
+{"\U0001F688", "light_rail", "light rail"},
+{"\U0001F689", "station", "station"},
+{"\U0001F68A", "tram", "tram"},
+{"\U0001F69D", "monorail", "monorail"},
+{"\U0001F69E", "mountain_railway", "mountain railway"},
+{"\U0001F68B", "train", "tram car"},
+{"\U0001F68C", "bus", "bus"},
+{"\U0001F68D", "oncoming_bus", "oncoming bus"},
+{"\U0001F68E", "trolleybus", "trolleybus"},
+{"\U0001F690", "minibus", "minibus"},
+{"\U0001F691", "ambulance", "ambulance"},
+{"\U0001F692", "fire_engine", "fire engine"},
+{"\U0001F693", "police_car", "police car"},
+{"\U0001F694", "oncoming_police_car", "oncoming police car"},
+{"\U0001F695", "taxi", "taxi"},
+{"\U0001F696", "oncoming_taxi", "oncoming taxi"},
+{"\U0001F697", "red_car", "automobile"},
+{"\U0001F698", "oncoming_automobile", "oncoming automobile"},
+{"\U0001F699", "blue_car", "sport utility vehicle"},
+{"\U0001F6FB", "pickup truck", "pickup truck"},
+{"\U0001F69A", "truck", "delivery truck"},
+{"\U0001F69B", "articulated_lorry", "articulated lorry"},
+{"\U0001F69C", "tractor", "tractor"},
+{"\U0001F3CE\U0000FE0F", "racing car", "racing car"},
+{"\U0001F3CD\U0000FE0F", "motorcycle", "motorcycle"},
+{"\U0001F6F5", "motor_scooter", "motor scooter"},
+{"\U0001F9BD", "manual wheelchair", "manual wheelchair"},
+{"\U0001F9BC", "motorized wheelchair", "motorized wheelchair"},
+{"\U0001F6FA", "auto rickshaw", "auto rickshaw"},
+{"\U0001F6B2", "bike", "bicycle"},
+{"\U0001F6F4", "scooter", "kick scooter"},
+{"\U0001F6F9", "skateboard", "skateboard"},
+{"\U0001F6FC", "roller skate", "roller skate"},
+{"\U0001F68F", "busstop", "bus stop"},
+{"\U0001F6E3\U0000FE0F", "motorway", "motorway"},
+{"\U0001F6E4\U0000FE0F", "railway track", "railway track"},
+{"\U0001F6E2\U0000FE0F", "oil drum", "oil drum"},
+{"\U000026FD", "fuelpump", "fuel pump"},
+{"\U0001F6DE", "wheel", "wheel"},
+{"\U0001F6A8", "rotating_light", "police car light"},
+{"\U0001F6A5", "traffic_light", "horizontal traffic light"},
+{"\U0001F6A6", "vertical_traffic_light", "vertical traffic light"},
+{"\U0001F6D1", "octagonal_sign", "stop sign"},
+{"\U0001F6A7", "construction", "construction"},
+{"\U00002693", "anchor", "anchor"},
+{"\U0001F6DF", "ring buoy", "ring buoy"},
+{"\U000026F5", "sailboat", "sailboat"},
+{"\U0001F6F6", "canoe", "canoe"},
+{"\U0001F6A4", "speedboat", "speedboat"},
+{"\U0001F6F3\U0000FE0F", "passenger ship", "passenger ship"},
+{"\U000026F4\U0000FE0F", "ferry", "ferry"},
+{"\U0001F6E5\U0000FE0F", "motor boat", "motor boat"},
+{"\U0001F6A2", "ship", "ship"},
+{"\U00002708\U0000FE0F", "airplane", "airplane"},
+{"\U0001F6E9\U0000FE0F", "small airplane", "small airplane"},
+{"\U0001F6EB", "airplane_departure", "airplane departure"},
+{"\U0001F6EC", "airplane_arriving", "airplane arrival"},
+{"\U0001FA82", "parachute", "parachute"},
+{"\U0001F4BA", "seat", "seat"},
+{"\U0001F681", "helicopter", "helicopter"},
+{"\U0001F69F", "suspension_railway", "suspension railway"},
+{"\U0001F6A0", "mountain_cableway", "mountain cableway"},
+{"\U0001F6A1", "aerial_tramway", "aerial tramway"},
+{"\U0001F6F0\U0000FE0F", "satellite", "satellite"},
+{"\U0001F680", "rocket", "rocket"},
+{"\U0001F6F8", "flying_saucer", "flying saucer"},
+{"\U0001F6CE\U0000FE0F", "bellhop bell", "bellhop bell"},
+{"\U0001F9F3", "luggage", "luggage"},
+{"\U0000231B", "hourglass", "hourglass done"},
+{"\U000023F3", "hourglass_flowing_sand", "hourglass not done"},
+{"\U0000231A", "watch", "watch"},
+{"\U000023F0", "alarm_clock", "alarm clock"},
+{"\U000023F1\U0000FE0F", "stopwatch", "stopwatch"},
+{"\U000023F2\U0000FE0F", "timer clock", "timer clock"},
+{"\U0001F570\U0000FE0F", "mantelpiece clock", "mantelpiece clock"},
+{"\U0001F55B", "clock12", "twelve o’clock"},
+{"\U0001F567", "clock1230", "twelve-thirty"},
+{"\U0001F550", "clock1", "one o’clock"},
+{"\U0001F55C", "clock130", "one-thirty"},
+{"\U0001F551", "clock2", "two o’clock"},
+{"\U0001F55D", "clock230", "two-thirty"},
+{"\U0001F552", "clock3", "three o’clock"},
+{"\U0001F55E", "clock330", "three-thirty"},
+{"\U0001F553", "clock4", "four o’clock"},
+{"\U0001F55F", "clock430", "four-thirty"},
+{"\U0001F554", "clock5", "five o’clock"},
+{"\U0001F560", "clock530", "five-thirty"},
+{"\U0001F555", "clock6", "six o’clock"},
+{"\U0001F561", "clock630", "six-thirty"},
+{"\U0001F556", "clock7", "seven o’clock"},
+{"\U0001F562", "clock730", "seven-thirty"},
+{"\U0001F557", "clock8", "eight o’clock"},
+{"\U0001F563", "clock830", "eight-thirty"},
+{"\U0001F558", "clock9", "nine o’clock"},
+{"\U0001F564", "clock930", "nine-thirty"},
+{"\U0001F559", "clock10", "ten o’clock"},
+{"\U0001F565", "clock1030", "ten-thirty"},
+{"\U0001F55A", "clock11", "eleven o’clock"},
+{"\U0001F566", "clock1130", "eleven-thirty"},
+{"\U0001F311", "new_moon", "new moon"},
+{"\U0001F312", "waxing_crescent_moon", "waxing crescent moon"},
+{"\U0001F313", "first_quarter_moon", "first quarter moon"},
+{"\U0001F314", "waxing_gibbous_moon", "waxing gibbous moon"},
+{"\U0001F315", "full_moon", "full moon"},
+{"\U0001F316", "waning_gibbous_moon", "waning gibbous moon"},
+{"\U0001F317", "last_quarter_moon", "last quarter moon"},
+{"\U0001F318", "waning_crescent_moon", "waning crescent moon"},
+{"\U0001F319", "crescent_moon", "crescent moon"},
+{"\U0001F31A", "new_moon_with_face", "new moon face"},
+{"\U0001F31B", "first_quarter_moon_with_face", "first quarter moon face"},
+{"\U0001F31C", "last_quarter_moon_with_face", "last quarter moon face"},
+{"\U0001F321\U0000FE0F", "thermometer", "thermometer"},
+{"\U00002600\U0000FE0F", "sun", "sun"},
+{"\U0001F31D", "full_moon_with_face", "full moon face"},
+{"\U0001F31E", "sun_with_face", "sun with face"},
+{"\U0001FA90", "ringed planet", "ringed planet"},
+{"\U00002B50", "star", "star"},
+{"\U0001F31F", "star2", "glowing star"},
+{"\U0001F320", "stars", "shooting star"},
+{"\U0001F30C", "milky_way", "milky way"},
+{"\U00002601\U0000FE0F", "cloud", "cloud"},
+{"\U000026C5", "partly_sunny", "sun behind cloud"},
+{"\U000026C8\U0000FE0F", "cloud with lightning and rain", "cloud with lightning and rain"},
+{"\U0001F324\U0000FE0F", "sun behind small cloud", "sun behind small cloud"},
+{"\U0001F325\U0000FE0F", "sun behind large cloud", "sun behind large cloud"},
+{"\U0001F326\U0000FE0F", "sun behind rain cloud", "sun behind rain cloud"},
+{"\U0001F327\U0000FE0F", "cloud with rain", "cloud with rain"},
+{"\U0001F328\U0000FE0F", "cloud with snow", "cloud with snow"},
+{"\U0001F329\U0000FE0F", "cloud with lightning", "cloud with lightning"},
+{"\U0001F32A\U0000FE0F", "tornado", "tornado"},
+{"\U0001F32B\U0000FE0F", "fog", "fog"},
+{"\U0001F32C\U0000FE0F", "wind face", "wind face"},
+{"\U0001F300", "cyclone", "cyclone"},
+{"\U0001F308", "rainbow", "rainbow"},
+{"\U0001F302", "closed_umbrella", "closed umbrella"},
+{"\U00002602\U0000FE0F", "umbrella", "umbrella"},
+{"\U00002614", "umbrella", "umbrella with rain drops"},
+{"\U000026F1\U0000FE0F", "umbrella on ground", "umbrella on ground"},
+{"\U000026A1", "zap", "high voltage"},
+{"\U00002744\U0000FE0F", "snowflake", "snowflake"},
+{"\U00002603\U0000FE0F", "snowman", "snowman"},
+{"\U000026C4", "snowman", "snowman without snow"},
+{"\U00002604\U0000FE0F", "comet", "comet"},
+{"\U0001F525", "fire", "fire"},
+{"\U0001F4A7", "droplet", "droplet"},
+{"\U0001F30A", "ocean", "water wave"},
+};
+constexpr EmojiData activitiesEmojis[] = {
+{"\U0001F383", "jack_o_lantern", "jack-o-lantern"},
+{"\U0001F384", "christmas_tree", "Christmas tree"},
+{"\U0001F386", "fireworks", "fireworks"},
+{"\U0001F387", "sparkler", "sparkler"},
+{"\U0001F9E8", "firecracker", "firecracker"},
+{"\U00002728", "sparkles", "sparkles"},
+{"\U0001F388", "balloon", "balloon"},
+{"\U0001F389", "tada", "party popper"},
+{"\U0001F38A", "confetti_ball", "confetti ball"},
+{"\U0001F38B", "tanabata_tree", "tanabata tree"},
+{"\U0001F38D", "bamboo", "pine decoration"},
+{"\U0001F38E", "dolls", "Japanese dolls"},
+{"\U0001F38F", "flags", "carp streamer"},
+{"\U0001F390", "wind_chime", "wind chime"},
+{"\U0001F391", "rice_scene", "moon viewing ceremony"},
+{"\U0001F9E7", "red_envelope", "red envelope"},
+{"\U0001F380", "ribbon", "ribbon"},
+{"\U0001F381", "gift", "wrapped gift"},
+{"\U0001F397\U0000FE0F", "reminder ribbon", "reminder ribbon"},
+{"\U0001F39F\U0000FE0F", "admission tickets", "admission tickets"},
+{"\U0001F3AB", "ticket", "ticket"},
+{"\U0001F396\U0000FE0F", "military medal", "military medal"},
+{"\U0001F3C6", "trophy", "trophy"},
+{"\U0001F3C5", "medal", "sports medal"},
+{"\U0001F947", "first_place", "1st place medal"},
+{"\U0001F948", "second_place", "2nd place medal"},
+{"\U0001F949", "third_place", "3rd place medal"},
+{"\U000026BD", "soccer", "soccer ball"},
+{"\U000026BE", "baseball", "baseball"},
+{"\U0001F94E", "softball", "softball"},
+{"\U0001F3C0", "basketball", "basketball"},
+{"\U0001F3D0", "volleyball", "volleyball"},
+{"\U0001F3C8", "football", "american football"},
+{"\U0001F3C9", "rugby_football", "rugby football"},
+{"\U0001F3BE", "tennis", "tennis"},
+{"\U0001F94F", "flying_disc", "flying disc"},
+{"\U0001F3B3", "bowling", "bowling"},
+{"\U0001F3CF", "cricket game", "cricket game"},
+{"\U0001F3D1", "field_hockey", "field hockey"},
+{"\U0001F3D2", "hockey", "ice hockey"},
+{"\U0001F94D", "lacrosse", "lacrosse"},
+{"\U0001F3D3", "ping_pong", "ping pong"},
+{"\U0001F3F8", "badminton", "badminton"},
+{"\U0001F94A", "boxing_glove", "boxing glove"},
+{"\U0001F94B", "martial_arts_uniform", "martial arts uniform"},
+{"\U0001F945", "goal", "goal net"},
+{"\U000026F3", "golf", "flag in hole"},
+{"\U000026F8\U0000FE0F", "ice skate", "ice skate"},
+{"\U0001F3A3", "fishing_pole_and_fish", "fishing pole"},
+{"\U0001F93F", "diving mask", "diving mask"},
+{"\U0001F3BD", "running_shirt_with_sash", "running shirt"},
+{"\U0001F3BF", "ski", "skis"},
+{"\U0001F6F7", "sled", "sled"},
+{"\U0001F94C", "curling_stone", "curling stone"},
+{"\U0001F3AF", "dart", "bullseye"},
+{"\U0001FA80", "yo-yo", "yo-yo"},
+{"\U0001FA81", "kite", "kite"},
+{"\U0001F3B1", "8ball", "pool 8 ball"},
+{"\U0001F52E", "crystal_ball", "crystal ball"},
+{"\U0001FA84", "magic wand", "magic wand"},
+{"\U0001F9FF", "nazar_amulet", "nazar amulet"},
+{"\U0001FAAC", "hamsa", "hamsa"},
+{"\U0001F3AE", "video_game", "video game"},
+{"\U0001F579\U0000FE0F", "joystick", "joystick"},
+{"\U0001F3B0", "slot_machine", "slot machine"},
+{"\U0001F3B2", "game_die", "game die"},
+{"\U0001F9E9", "jigsaw", "puzzle piece"},
+{"\U0001F9F8", "teddy_bear", "teddy bear"},
+{"\U0001FA85", "piñata", "piñata"},
+{"\U0001FAA9", "mirror ball", "mirror ball"},
+{"\U0001FA86", "nesting dolls", "nesting dolls"},
+{"\U00002660\U0000FE0F", "spade suit", "spade suit"},
+{"\U00002665\U0000FE0F", "heart suit", "heart suit"},
+{"\U00002666\U0000FE0F", "diamond suit", "diamond suit"},
+{"\U00002663\U0000FE0F", "club suit", "club suit"},
+{"\U0000265F\U0000FE0F", "chess pawn", "chess pawn"},
+{"\U0001F0CF", "black_joker", "joker"},
+{"\U0001F004", "mahjong", "mahjong red dragon"},
+{"\U0001F3B4", "flower_playing_cards", "flower playing cards"},
+{"\U0001F3AD", "performing_arts", "performing arts"},
+{"\U0001F5BC\U0000FE0F", "framed picture", "framed picture"},
+{"\U0001F3A8", "art", "artist palette"},
+{"\U0001F9F5", "thread", "thread"},
+{"\U0001FAA1", "sewing needle", "sewing needle"},
+{"\U0001F9F6", "yarn", "yarn"},
+{"\U0001FAA2", "knot", "knot"},
+};
+constexpr EmojiData objectsEmojis[] = {
+{"\U0001F453", "eyeglasses", "glasses"},
+{"\U0001F576\U0000FE0F", "sunglasses", "sunglasses"},
+{"\U0001F97D", "goggles", "goggles"},
+{"\U0001F97C", "lab_coat", "lab coat"},
+{"\U0001F9BA", "safety vest", "safety vest"},
+{"\U0001F454", "necktie", "necktie"},
+{"\U0001F455", "shirt", "t-shirt"},
+{"\U0001F456", "jeans", "jeans"},
+{"\U0001F9E3", "scarf", "scarf"},
+{"\U0001F9E4", "gloves", "gloves"},
+{"\U0001F9E5", "coat", "coat"},
+{"\U0001F9E6", "socks", "socks"},
+{"\U0001F457", "dress", "dress"},
+{"\U0001F458", "kimono", "kimono"},
+{"\U0001F97B", "sari", "sari"},
+{"\U0001FA71", "one-piece swimsuit", "one-piece swimsuit"},
+{"\U0001FA72", "briefs", "briefs"},
+{"\U0001FA73", "shorts", "shorts"},
+{"\U0001F459", "bikini", "bikini"},
+{"\U0001F45A", "womans_clothes", "woman’s clothes"},
+{"\U0001F45B", "purse", "purse"},
+{"\U0001F45C", "handbag", "handbag"},
+{"\U0001F45D", "pouch", "clutch bag"},
+{"\U0001F6CD\U0000FE0F", "shopping bags", "shopping bags"},
+{"\U0001F392", "school_satchel", "backpack"},
+{"\U0001FA74", "thong sandal", "thong sandal"},
+{"\U0001F45E", "mans_shoe", "man’s shoe"},
+{"\U0001F45F", "athletic_shoe", "running shoe"},
+{"\U0001F97E", "hiking_boot", "hiking boot"},
+{"\U0001F97F", "womans_flat_shoe", "flat shoe"},
+{"\U0001F460", "high_heel", "high-heeled shoe"},
+{"\U0001F461", "sandal", "woman’s sandal"},
+{"\U0001FA70", "ballet shoes", "ballet shoes"},
+{"\U0001F462", "boot", "woman’s boot"},
+{"\U0001F451", "crown", "crown"},
+{"\U0001F452", "womans_hat", "woman’s hat"},
+{"\U0001F3A9", "tophat", "top hat"},
+{"\U0001F393", "mortar_board", "graduation cap"},
+{"\U0001F9E2", "billed_cap", "billed cap"},
+{"\U0001FA96", "military helmet", "military helmet"},
+{"\U000026D1\U0000FE0F", "rescue worker’s helmet", "rescue worker’s helmet"},
+{"\U0001F4FF", "prayer_beads", "prayer beads"},
+{"\U0001F484", "lipstick", "lipstick"},
+{"\U0001F48D", "ring", "ring"},
+{"\U0001F48E", "gem", "gem stone"},
+{"\U0001F507", "mute", "muted speaker"},
+{"\U0001F508", "speaker", "speaker low volume"},
+{"\U0001F509", "sound", "speaker medium volume"},
+{"\U0001F50A", "loud_sound", "speaker high volume"},
+{"\U0001F4E2", "loudspeaker", "loudspeaker"},
+{"\U0001F4E3", "mega", "megaphone"},
+{"\U0001F4EF", "postal_horn", "postal horn"},
+{"\U0001F514", "bell", "bell"},
+{"\U0001F515", "no_bell", "bell with slash"},
+{"\U0001F3BC", "musical_score", "musical score"},
+{"\U0001F3B5", "musical_note", "musical note"},
+{"\U0001F3B6", "notes", "musical notes"},
+{"\U0001F399\U0000FE0F", "studio microphone", "studio microphone"},
+{"\U0001F39A\U0000FE0F", "level slider", "level slider"},
+{"\U0001F39B\U0000FE0F", "control knobs", "control knobs"},
+{"\U0001F3A4", "microphone", "microphone"},
+{"\U0001F3A7", "headphones", "headphone"},
+{"\U0001F4FB", "radio", "radio"},
+{"\U0001F3B7", "saxophone", "saxophone"},
+{"\U0001FA97", "accordion", "accordion"},
+{"\U0001F3B8", "guitar", "guitar"},
+{"\U0001F3B9", "musical_keyboard", "musical keyboard"},
+{"\U0001F3BA", "trumpet", "trumpet"},
+{"\U0001F3BB", "violin", "violin"},
+{"\U0001FA95", "banjo", "banjo"},
+{"\U0001F941", "drum", "drum"},
+{"\U0001FA98", "long drum", "long drum"},
+{"\U0001F4F1", "iphone", "mobile phone"},
+{"\U0001F4F2", "calling", "mobile phone with arrow"},
+{"\U0000260E\U0000FE0F", "telephone", "telephone"},
+{"\U0001F4DE", "telephone_receiver", "telephone receiver"},
+{"\U0001F4DF", "pager", "pager"},
+{"\U0001F4E0", "fax", "fax machine"},
+{"\U0001F50B", "battery", "battery"},
+{"\U0001FAAB", "low battery", "low battery"},
+{"\U0001F50C", "electric_plug", "electric plug"},
+{"\U0001F4BB", "computer", "laptop"},
+{"\U0001F5A5\U0000FE0F", "desktop computer", "desktop computer"},
+{"\U0001F5A8\U0000FE0F", "printer", "printer"},
+{"\U00002328\U0000FE0F", "keyboard", "keyboard"},
+{"\U0001F5B1\U0000FE0F", "computer mouse", "computer mouse"},
+{"\U0001F5B2\U0000FE0F", "trackball", "trackball"},
+{"\U0001F4BD", "minidisc", "computer disk"},
+{"\U0001F4BE", "floppy_disk", "floppy disk"},
+{"\U0001F4BF", "cd", "optical disk"},
+{"\U0001F4C0", "dvd", "dvd"},
+{"\U0001F9EE", "abacus", "abacus"},
+{"\U0001F3A5", "movie_camera", "movie camera"},
+{"\U0001F39E\U0000FE0F", "film frames", "film frames"},
+{"\U0001F4FD\U0000FE0F", "film projector", "film projector"},
+{"\U0001F3AC", "clapper", "clapper board"},
+{"\U0001F4FA", "tv", "television"},
+{"\U0001F4F7", "camera", "camera"},
+{"\U0001F4F8", "camera_with_flash", "camera with flash"},
+{"\U0001F4F9", "video_camera", "video camera"},
+{"\U0001F4FC", "vhs", "videocassette"},
+{"\U0001F50D", "mag", "magnifying glass tilted left"},
+{"\U0001F50E", "mag_right", "magnifying glass tilted right"},
+{"\U0001F56F\U0000FE0F", "candle", "candle"},
+{"\U0001F4A1", "bulb", "light bulb"},
+{"\U0001F526", "flashlight", "flashlight"},
+{"\U0001F3EE", "izakaya_lantern", "red paper lantern"},
+{"\U0001FA94", "diya lamp", "diya lamp"},
+{"\U0001F4D4", "notebook_with_decorative_cover", "notebook with decorative cover"},
+{"\U0001F4D5", "closed_book", "closed book"},
+{"\U0001F4D6", "book", "open book"},
+{"\U0001F4D7", "green_book", "green book"},
+{"\U0001F4D8", "blue_book", "blue book"},
+{"\U0001F4D9", "orange_book", "orange book"},
+{"\U0001F4DA", "books", "books"},
+{"\U0001F4D3", "notebook", "notebook"},
+{"\U0001F4D2", "ledger", "ledger"},
+{"\U0001F4C3", "page_with_curl", "page with curl"},
+{"\U0001F4DC", "scroll", "scroll"},
+{"\U0001F4C4", "page_facing_up", "page facing up"},
+{"\U0001F4F0", "newspaper", "newspaper"},
+{"\U0001F5DE\U0000FE0F", "rolled-up newspaper", "rolled-up newspaper"},
+{"\U0001F4D1", "bookmark_tabs", "bookmark tabs"},
+{"\U0001F516", "bookmark", "bookmark"},
+{"\U0001F3F7\U0000FE0F", "label", "label"},
+{"\U0001F4B0", "moneybag", "money bag"},
+{"\U0001FA99", "coin", "coin"},
+{"\U0001F4B4", "yen", "yen banknote"},
+{"\U0001F4B5", "dollar", "dollar banknote"},
+{"\U0001F4B6", "euro", "euro banknote"},
+{"\U0001F4B7", "pound", "pound banknote"},
+{"\U0001F4B8", "money_with_wings", "money with wings"},
+{"\U0001F4B3", "credit_card", "credit card"},
+{"\U0001F9FE", "receipt", "receipt"},
+{"\U0001F4B9", "chart", "chart increasing with yen"},
+{"\U00002709\U0000FE0F", "envelope", "envelope"},
+{"\U0001F4E7", "e-mail", "e-mail"},
+{"\U0001F4E8", "incoming_envelope", "incoming envelope"},
+{"\U0001F4E9", "envelope_with_arrow", "envelope with arrow"},
+{"\U0001F4E4", "outbox_tray", "outbox tray"},
+{"\U0001F4E5", "inbox_tray", "inbox tray"},
+{"\U0001F4E6", "package", "package"},
+{"\U0001F4EB", "mailbox", "closed mailbox with raised flag"},
+{"\U0001F4EA", "mailbox_closed", "closed mailbox with lowered flag"},
+{"\U0001F4EC", "mailbox_with_mail", "open mailbox with raised flag"},
+{"\U0001F4ED", "mailbox_with_no_mail", "open mailbox with lowered flag"},
+{"\U0001F4EE", "postbox", "postbox"},
+{"\U0001F5F3\U0000FE0F", "ballot box with ballot", "ballot box with ballot"},
+{"\U0000270F\U0000FE0F", "pencil", "pencil"},
+{"\U00002712\U0000FE0F", "black nib", "black nib"},
+{"\U0001F58B\U0000FE0F", "fountain pen", "fountain pen"},
+{"\U0001F58A\U0000FE0F", "pen", "pen"},
+{"\U0001F58C\U0000FE0F", "paintbrush", "paintbrush"},
+{"\U0001F58D\U0000FE0F", "crayon", "crayon"},
+{"\U0001F4DD", "pencil", "memo"},
+{"\U0001F4BC", "briefcase", "briefcase"},
+{"\U0001F4C1", "file_folder", "file folder"},
+{"\U0001F4C2", "open_file_folder", "open file folder"},
+{"\U0001F5C2\U0000FE0F", "card index dividers", "card index dividers"},
+{"\U0001F4C5", "date", "calendar"},
+{"\U0001F4C6", "calendar", "tear-off calendar"},
+{"\U0001F5D2\U0000FE0F", "spiral notepad", "spiral notepad"},
+{"\U0001F5D3\U0000FE0F", "spiral calendar", "spiral calendar"},
+{"\U0001F4C7", "card_index", "card index"},
+{"\U0001F4C8", "chart_with_upwards_trend", "chart increasing"},
+{"\U0001F4C9", "chart_with_downwards_trend", "chart decreasing"},
+{"\U0001F4CA", "bar_chart", "bar chart"},
+{"\U0001F4CB", "clipboard", "clipboard"},
+{"\U0001F4CC", "pushpin", "pushpin"},
+{"\U0001F4CD", "round_pushpin", "round pushpin"},
+{"\U0001F4CE", "paperclip", "paperclip"},
+{"\U0001F587\U0000FE0F", "linked paperclips", "linked paperclips"},
+{"\U0001F4CF", "straight_ruler", "straight ruler"},
+{"\U0001F4D0", "triangular_ruler", "triangular ruler"},
+{"\U00002702\U0000FE0F", "scissors", "scissors"},
+{"\U0001F5C3\U0000FE0F", "card file box", "card file box"},
+{"\U0001F5C4\U0000FE0F", "file cabinet", "file cabinet"},
+{"\U0001F5D1\U0000FE0F", "wastebasket", "wastebasket"},
+{"\U0001F512", "lock", "locked"},
+{"\U0001F513", "unlock", "unlocked"},
+{"\U0001F50F", "lock_with_ink_pen", "locked with pen"},
+{"\U0001F510", "closed_lock_with_key", "locked with key"},
+{"\U0001F511", "key", "key"},
+{"\U0001F5DD\U0000FE0F", "old key", "old key"},
+{"\U0001F528", "hammer", "hammer"},
+{"\U0001FA93", "axe", "axe"},
+{"\U000026CF\U0000FE0F", "pick", "pick"},
+{"\U00002692\U0000FE0F", "hammer and pick", "hammer and pick"},
+{"\U0001F6E0\U0000FE0F", "hammer and wrench", "hammer and wrench"},
+{"\U0001F5E1\U0000FE0F", "dagger", "dagger"},
+{"\U00002694\U0000FE0F", "crossed swords", "crossed swords"},
+{"\U0001F52B", "gun", "water pistol"},
+{"\U0001FA83", "boomerang", "boomerang"},
+{"\U0001F3F9", "bow_and_arrow", "bow and arrow"},
+{"\U0001F6E1\U0000FE0F", "shield", "shield"},
+{"\U0001FA9A", "carpentry saw", "carpentry saw"},
+{"\U0001F527", "wrench", "wrench"},
+{"\U0001FA9B", "screwdriver", "screwdriver"},
+{"\U0001F529", "nut_and_bolt", "nut and bolt"},
+{"\U00002699\U0000FE0F", "gear", "gear"},
+{"\U0001F5DC\U0000FE0F", "clamp", "clamp"},
+{"\U00002696\U0000FE0F", "balance scale", "balance scale"},
+{"\U0001F9AF", "white cane", "white cane"},
+{"\U0001F517", "link", "link"},
+{"\U000026D3\U0000FE0F", "chains", "chains"},
+{"\U0001FA9D", "hook", "hook"},
+{"\U0001F9F0", "toolbox", "toolbox"},
+{"\U0001F9F2", "magnet", "magnet"},
+{"\U0001FA9C", "ladder", "ladder"},
+{"\U00002697\U0000FE0F", "alembic", "alembic"},
+{"\U0001F9EA", "test_tube", "test tube"},
+{"\U0001F9EB", "petri_dish", "petri dish"},
+{"\U0001F9EC", "dna", "dna"},
+{"\U0001F52C", "microscope", "microscope"},
+{"\U0001F52D", "telescope", "telescope"},
+{"\U0001F4E1", "satellite", "satellite antenna"},
+{"\U0001F489", "syringe", "syringe"},
+{"\U0001FA78", "drop of blood", "drop of blood"},
+{"\U0001F48A", "pill", "pill"},
+{"\U0001FA79", "adhesive bandage", "adhesive bandage"},
+{"\U0001FA7C", "crutch", "crutch"},
+{"\U0001FA7A", "stethoscope", "stethoscope"},
+{"\U0001FA7B", "x-ray", "x-ray"},
+{"\U0001F6AA", "door", "door"},
+{"\U0001F6D7", "elevator", "elevator"},
+{"\U0001FA9E", "mirror", "mirror"},
+{"\U0001FA9F", "window", "window"},
+{"\U0001F6CF\U0000FE0F", "bed", "bed"},
+{"\U0001F6CB\U0000FE0F", "couch and lamp", "couch and lamp"},
+{"\U0001FA91", "chair", "chair"},
+{"\U0001F6BD", "toilet", "toilet"},
+{"\U0001FAA0", "plunger", "plunger"},
+{"\U0001F6BF", "shower", "shower"},
+{"\U0001F6C1", "bathtub", "bathtub"},
+{"\U0001FAA4", "mouse trap", "mouse trap"},
+{"\U0001FA92", "razor", "razor"},
+{"\U0001F9F4", "squeeze_bottle", "lotion bottle"},
+{"\U0001F9F7", "safety_pin", "safety pin"},
+{"\U0001F9F9", "broom", "broom"},
+{"\U0001F9FA", "basket", "basket"},
+{"\U0001F9FB", "roll_of_paper", "roll of paper"},
+{"\U0001FAA3", "bucket", "bucket"},
+{"\U0001F9FC", "soap", "soap"},
+{"\U0001FAE7", "bubbles", "bubbles"},
+{"\U0001FAA5", "toothbrush", "toothbrush"},
+{"\U0001F9FD", "sponge", "sponge"},
+{"\U0001F9EF", "fire_extinguisher", "fire extinguisher"},
+{"\U0001F6D2", "shopping_cart", "shopping cart"},
+{"\U0001F6AC", "smoking", "cigarette"},
+{"\U000026B0\U0000FE0F", "coffin", "coffin"},
+{"\U0001FAA6", "headstone", "headstone"},
+{"\U000026B1\U0000FE0F", "funeral urn", "funeral urn"},
+{"\U0001F5FF", "moyai", "moai"},
+{"\U0001FAA7", "placard", "placard"},
+{"\U0001FAAA", "identification card", "identification card"},
+};
+constexpr EmojiData symbolsEmojis[] = {
+{"\U0001F3E7", "atm", "ATM sign"},
+{"\U0001F6AE", "put_litter_in_its_place", "litter in bin sign"},
+{"\U0001F6B0", "potable_water", "potable water"},
+{"\U0000267F", "wheelchair", "wheelchair symbol"},
+{"\U0001F6B9", "mens", "men’s room"},
+{"\U0001F6BA", "womens", "women’s room"},
+{"\U0001F6BB", "restroom", "restroom"},
+{"\U0001F6BC", "baby_symbol", "baby symbol"},
+{"\U0001F6BE", "wc", "water closet"},
+{"\U0001F6C2", "passport_control", "passport control"},
+{"\U0001F6C3", "customs", "customs"},
+{"\U0001F6C4", "baggage_claim", "baggage claim"},
+{"\U0001F6C5", "left_luggage", "left luggage"},
+{"\U000026A0\U0000FE0F", "warning", "warning"},
+{"\U0001F6B8", "children_crossing", "children crossing"},
+{"\U000026D4", "no_entry", "no entry"},
+{"\U0001F6AB", "no_entry_sign", "prohibited"},
+{"\U0001F6B3", "no_bicycles", "no bicycles"},
+{"\U0001F6AD", "no_smoking", "no smoking"},
+{"\U0001F6AF", "do_not_litter", "no littering"},
+{"\U0001F6B1", "non-potable_water", "non-potable water"},
+{"\U0001F6B7", "no_pedestrians", "no pedestrians"},
+{"\U0001F4F5", "no_mobile_phones", "no mobile phones"},
+{"\U0001F51E", "underage", "no one under eighteen"},
+{"\U00002622\U0000FE0F", "radioactive", "radioactive"},
+{"\U00002623\U0000FE0F", "biohazard", "biohazard"},
+{"\U00002B06\U0000FE0F", "up arrow", "up arrow"},
+{"\U00002197\U0000FE0F", "up-right arrow", "up-right arrow"},
+{"\U000027A1\U0000FE0F", "right arrow", "right arrow"},
+{"\U00002198\U0000FE0F", "down-right arrow", "down-right arrow"},
+{"\U00002B07\U0000FE0F", "down arrow", "down arrow"},
+{"\U00002199\U0000FE0F", "down-left arrow", "down-left arrow"},
+{"\U00002B05\U0000FE0F", "left arrow", "left arrow"},
+{"\U00002196\U0000FE0F", "up-left arrow", "up-left arrow"},
+{"\U00002195\U0000FE0F", "up-down arrow", "up-down arrow"},
+{"\U00002194\U0000FE0F", "left-right arrow", "left-right arrow"},
+{"\U000021A9\U0000FE0F", "right arrow curving left", "right arrow curving left"},
+{"\U000021AA\U0000FE0F", "left arrow curving right", "left arrow curving right"},
+{"\U00002934\U0000FE0F", "right arrow curving up", "right arrow curving up"},
+{"\U00002935\U0000FE0F", "right arrow curving down", "right arrow curving down"},
+{"\U0001F503", "arrows_clockwise", "clockwise vertical arrows"},
+{"\U0001F504", "arrows_counterclockwise", "counterclockwise arrows button"},
+{"\U0001F519", "back", "BACK arrow"},
+{"\U0001F51A", "end", "END arrow"},
+{"\U0001F51B", "on", "ON! arrow"},
+{"\U0001F51C", "soon", "SOON arrow"},
+{"\U0001F51D", "top", "TOP arrow"},
+{"\U0001F6D0", "place_of_worship", "place of worship"},
+{"\U0000269B\U0000FE0F", "atom symbol", "atom symbol"},
+{"\U0001F549\U0000FE0F", "om", "om"},
+{"\U00002721\U0000FE0F", "star of David", "star of David"},
+{"\U00002638\U0000FE0F", "wheel of dharma", "wheel of dharma"},
+{"\U0000262F\U0000FE0F", "yin yang", "yin yang"},
+{"\U0000271D\U0000FE0F", "latin cross", "latin cross"},
+{"\U00002626\U0000FE0F", "orthodox cross", "orthodox cross"},
+{"\U0000262A\U0000FE0F", "star and crescent", "star and crescent"},
+{"\U0000262E\U0000FE0F", "peace symbol", "peace symbol"},
+{"\U0001F54E", "menorah", "menorah"},
+{"\U0001F52F", "six_pointed_star", "dotted six-pointed star"},
+{"\U00002648", "aries", "Aries"},
+{"\U00002649", "taurus", "Taurus"},
+{"\U0000264A", "gemini", "Gemini"},
+{"\U0000264B", "cancer", "Cancer"},
+{"\U0000264C", "leo", "Leo"},
+{"\U0000264D", "virgo", "Virgo"},
+{"\U0000264E", "libra", "Libra"},
+{"\U0000264F", "scorpius", "Scorpio"},
+{"\U00002650", "sagittarius", "Sagittarius"},
+{"\U00002651", "capricorn", "Capricorn"},
+{"\U00002652", "aquarius", "Aquarius"},
+{"\U00002653", "pisces", "Pisces"},
+{"\U000026CE", "ophiuchus", "Ophiuchus"},
+{"\U0001F500", "twisted_rightwards_arrows", "shuffle tracks button"},
+{"\U0001F501", "repeat", "repeat button"},
+{"\U0001F502", "repeat_one", "repeat single button"},
+{"\U000025B6\U0000FE0F", "play button", "play button"},
+{"\U000023E9", "fast_forward", "fast-forward button"},
+{"\U000023ED\U0000FE0F", "next track button", "next track button"},
+{"\U000023EF\U0000FE0F", "play or pause button", "play or pause button"},
+{"\U000025C0\U0000FE0F", "reverse button", "reverse button"},
+{"\U000023EA", "rewind", "fast reverse button"},
+{"\U000023EE\U0000FE0F", "last track button", "last track button"},
+{"\U0001F53C", "arrow_up_small", "upwards button"},
+{"\U000023EB", "arrow_double_up", "fast up button"},
+{"\U0001F53D", "arrow_down_small", "downwards button"},
+{"\U000023EC", "arrow_double_down", "fast down button"},
+{"\U000023F8\U0000FE0F", "pause button", "pause button"},
+{"\U000023F9\U0000FE0F", "stop button", "stop button"},
+{"\U000023FA\U0000FE0F", "record button", "record button"},
+{"\U000023CF\U0000FE0F", "eject button", "eject button"},
+{"\U0001F3A6", "cinema", "cinema"},
+{"\U0001F505", "low_brightness", "dim button"},
+{"\U0001F506", "high_brightness", "bright button"},
+{"\U0001F4F6", "signal_strength", "antenna bars"},
+{"\U0001F4F3", "vibration_mode", "vibration mode"},
+{"\U0001F4F4", "mobile_phone_off", "mobile phone off"},
+{"\U00002640\U0000FE0F", "female sign", "female sign"},
+{"\U00002642\U0000FE0F", "male sign", "male sign"},
+{"\U000026A7\U0000FE0F", "transgender symbol", "transgender symbol"},
+{"\U00002716\U0000FE0F", "multiply", "multiply"},
+{"\U00002795", "heavy_plus_sign", "plus"},
+{"\U00002796", "heavy_minus_sign", "minus"},
+{"\U00002797", "heavy_division_sign", "divide"},
+{"\U0001F7F0", "heavy equals sign", "heavy equals sign"},
+{"\U0000267E\U0000FE0F", "infinity", "infinity"},
+{"\U0000203C\U0000FE0F", "double exclamation mark", "double exclamation mark"},
+{"\U00002049\U0000FE0F", "exclamation question mark", "exclamation question mark"},
+{"\U00002753", "question", "red question mark"},
+{"\U00002754", "grey_question", "white question mark"},
+{"\U00002755", "grey_exclamation", "white exclamation mark"},
+{"\U00002757", "exclamation", "red exclamation mark"},
+{"\U00003030\U0000FE0F", "wavy dash", "wavy dash"},
+{"\U0001F4B1", "currency_exchange", "currency exchange"},
+{"\U0001F4B2", "heavy_dollar_sign", "heavy dollar sign"},
+{"\U00002695\U0000FE0F", "medical symbol", "medical symbol"},
+{"\U0000267B\U0000FE0F", "recycling symbol", "recycling symbol"},
+{"\U0000269C\U0000FE0F", "fleur-de-lis", "fleur-de-lis"},
+{"\U0001F531", "trident", "trident emblem"},
+{"\U0001F4DB", "name_badge", "name badge"},
+{"\U0001F530", "beginner", "Japanese symbol for beginner"},
+{"\U00002B55", "o", "hollow red circle"},
+{"\U00002705", "white_check_mark", "check mark button"},
+{"\U00002611\U0000FE0F", "check box with check", "check box with check"},
+{"\U00002714\U0000FE0F", "check mark", "check mark"},
+{"\U0000274C", "x", "cross mark"},
+{"\U0000274E", "negative_squared_cross_mark", "cross mark button"},
+{"\U000027B0", "curly_loop", "curly loop"},
+{"\U000027BF", "loop", "double curly loop"},
+{"\U0000303D\U0000FE0F", "part alternation mark", "part alternation mark"},
+{"\U00002733\U0000FE0F", "eight-spoked asterisk", "eight-spoked asterisk"},
+{"\U00002734\U0000FE0F", "eight-pointed star", "eight-pointed star"},
+{"\U00002747\U0000FE0F", "sparkle", "sparkle"},
+{"\U000000A9\U0000FE0F", "copyright", "copyright"},
+{"\U000000AE\U0000FE0F", "registered", "registered"},
+{"\U00002122\U0000FE0F", "trade mark", "trade mark"},
+{"\U00000023\U0000FE0F\U000020E3", "keycap: #", "keycap: #"},
+{"\U0000002A\U0000FE0F\U000020E3", "keycap: *", "keycap: *"},
+{"\U00000030\U0000FE0F\U000020E3", "keycap: 0", "keycap: 0"},
+{"\U00000031\U0000FE0F\U000020E3", "keycap: 1", "keycap: 1"},
+{"\U00000032\U0000FE0F\U000020E3", "keycap: 2", "keycap: 2"},
+{"\U00000033\U0000FE0F\U000020E3", "keycap: 3", "keycap: 3"},
+{"\U00000034\U0000FE0F\U000020E3", "keycap: 4", "keycap: 4"},
+{"\U00000035\U0000FE0F\U000020E3", "keycap: 5", "keycap: 5"},
+{"\U00000036\U0000FE0F\U000020E3", "keycap: 6", "keycap: 6"},
+{"\U00000037\U0000FE0F\U000020E3", "keycap: 7", "keycap: 7"},
+{"\U00000038\U0000FE0F\U000020E3", "keycap: 8", "keycap: 8"},
+{"\U00000039\U0000FE0F\U000020E3", "keycap: 9", "keycap: 9"},
+{"\U0001F51F", "ten", "keycap: 10"},
+{"\U0001F520", "capital_abcd", "input latin uppercase"},
+{"\U0001F521", "abcd", "input latin lowercase"},
+{"\U0001F522", "1234", "input numbers"},
+{"\U0001F523", "symbols", "input symbols"},
+{"\U0001F524", "abc", "input latin letters"},
+{"\U0001F170\U0000FE0F", "A button (blood type)", "A button (blood type)"},
+{"\U0001F18E", "ab", "AB button (blood type)"},
+{"\U0001F171\U0000FE0F", "B button (blood type)", "B button (blood type)"},
+{"\U0001F191", "cl", "CL button"},
+{"\U0001F192", "cool", "COOL button"},
+{"\U0001F193", "free", "FREE button"},
+{"\U00002139\U0000FE0F", "information", "information"},
+{"\U0001F194", "id", "ID button"},
+{"\U000024C2\U0000FE0F", "circled M", "circled M"},
+{"\U0001F195", "new", "NEW button"},
+{"\U0001F196", "ng", "NG button"},
+{"\U0001F17E\U0000FE0F", "O button (blood type)", "O button (blood type)"},
+{"\U0001F197", "ok", "OK button"},
+{"\U0001F17F\U0000FE0F", "P button", "P button"},
+{"\U0001F198", "sos", "SOS button"},
+{"\U0001F199", "up", "UP! button"},
+{"\U0001F19A", "vs", "VS button"},
+{"\U0001F201", "koko", "Japanese “here” button"},
+{"\U0001F202\U0000FE0F", "Japanese “service charge” button", "Japanese “service charge” button"},
+{"\U0001F237\U0000FE0F", "Japanese “monthly amount” button", "Japanese “monthly amount” button"},
+{"\U0001F236", "u6709", "Japanese “not free of charge” button"},
+{"\U0001F22F", "u6307", "Japanese “reserved” button"},
+{"\U0001F250", "ideograph_advantage", "Japanese “bargain” button"},
+{"\U0001F239", "u5272", "Japanese “discount” button"},
+{"\U0001F21A", "u7121", "Japanese “free of charge” button"},
+{"\U0001F232", "u7981", "Japanese “prohibited” button"},
+{"\U0001F251", "accept", "Japanese “acceptable” button"},
+{"\U0001F238", "u7533", "Japanese “application” button"},
+{"\U0001F234", "u5408", "Japanese “passing grade” button"},
+{"\U0001F233", "u7a7a", "Japanese “vacancy” button"},
+{"\U00003297\U0000FE0F", "Japanese “congratulations” button", "Japanese “congratulations” button"},
+{"\U00003299\U0000FE0F", "Japanese “secret” button", "Japanese “secret” button"},
+{"\U0001F23A", "u55b6", "Japanese “open for business” button"},
+{"\U0001F235", "u6e80", "Japanese “no vacancy” button"},
+{"\U0001F534", "red_circle", "red circle"},
+{"\U0001F7E0", "orange circle", "orange circle"},
+{"\U0001F7E1", "yellow circle", "yellow circle"},
+{"\U0001F7E2", "green circle", "green circle"},
+{"\U0001F535", "blue_circle", "blue circle"},
+{"\U0001F7E3", "purple circle", "purple circle"},
+{"\U0001F7E4", "brown circle", "brown circle"},
+{"\U000026AB", "black_circle", "black circle"},
+{"\U000026AA", "white_circle", "white circle"},
+{"\U0001F7E5", "red square", "red square"},
+{"\U0001F7E7", "orange square", "orange square"},
+{"\U0001F7E8", "yellow square", "yellow square"},
+{"\U0001F7E9", "green square", "green square"},
+{"\U0001F7E6", "blue square", "blue square"},
+{"\U0001F7EA", "purple square", "purple square"},
+{"\U0001F7EB", "brown square", "brown square"},
+{"\U00002B1B", "black_large_square", "black large square"},
+{"\U00002B1C", "white_large_square", "white large square"},
+{"\U000025FC\U0000FE0F", "black medium square", "black medium square"},
+{"\U000025FB\U0000FE0F", "white medium square", "white medium square"},
+{"\U000025FE", "black_medium_small_square", "black medium-small square"},
+{"\U000025FD", "white_medium_small_square", "white medium-small square"},
+{"\U000025AA\U0000FE0F", "black small square", "black small square"},
+{"\U000025AB\U0000FE0F", "white small square", "white small square"},
+{"\U0001F536", "large_orange_diamond", "large orange diamond"},
+{"\U0001F537", "large_blue_diamond", "large blue diamond"},
+{"\U0001F538", "small_orange_diamond", "small orange diamond"},
+{"\U0001F539", "small_blue_diamond", "small blue diamond"},
+{"\U0001F53A", "small_red_triangle", "red triangle pointed up"},
+{"\U0001F53B", "small_red_triangle_down", "red triangle pointed down"},
+{"\U0001F4A0", "diamond_shape_with_a_dot_inside", "diamond with a dot"},
+{"\U0001F518", "radio_button", "radio button"},
+{"\U0001F533", "white_square_button", "white square button"},
+{"\U0001F532", "black_square_button", "black square button"},
+};
+constexpr EmojiData flagsEmojis[] = {
+{"\U0001F3C1", "checkered_flag", "chequered flag"},
+{"\U0001F6A9", "triangular_flag_on_post", "triangular flag"},
+{"\U0001F38C", "crossed_flags", "crossed flags"},
+{"\U0001F3F4", "flag_black", "black flag"},
+{"\U0001F3F3\U0000FE0F", "white flag", "white flag"},
+{"\U0001F3F3\U0000FE0F\U0000200D\U0001F308", "rainbow flag", "rainbow flag"},
+{"\U0001F3F3\U0000FE0F\U0000200D\U000026A7\U0000FE0F", "transgender flag", "transgender flag"},
+{"\U0001F3F4\U0000200D\U00002620\U0000FE0F", "pirate flag", "pirate flag"},
+{"\U0001F1E6\U0001F1E8", "flag_ac", "Flag of Ascension Island"},
+{"\U0001F1E6\U0001F1E9", "flag_ad", "Flag of Andorra"},
+{"\U0001F1E6\U0001F1EA", "flag_ae", "Flag of United Arab Emirates"},
+{"\U0001F1E6\U0001F1EB", "flag_af", "Flag of Afghanistan"},
+{"\U0001F1E6\U0001F1EC", "flag_ag", "Flag of Antigua & Barbuda"},
+{"\U0001F1E6\U0001F1EE", "flag_ai", "Flag of Anguilla"},
+{"\U0001F1E6\U0001F1F1", "flag_al", "Flag of Albania"},
+{"\U0001F1E6\U0001F1F2", "flag_am", "Flag of Armenia"},
+{"\U0001F1E6\U0001F1F4", "flag_ao", "Flag of Angola"},
+{"\U0001F1E6\U0001F1F6", "flag_aq", "Flag of Antarctica"},
+{"\U0001F1E6\U0001F1F7", "flag_ar", "Flag of Argentina"},
+{"\U0001F1E6\U0001F1F8", "flag_as", "Flag of American Samoa"},
+{"\U0001F1E6\U0001F1F9", "flag_at", "Flag of Austria"},
+{"\U0001F1E6\U0001F1FA", "flag_au", "Flag of Australia"},
+{"\U0001F1E6\U0001F1FC", "flag_aw", "Flag of Aruba"},
+{"\U0001F1E6\U0001F1FD", "flag_ax", "Flag of Åland Islands"},
+{"\U0001F1E6\U0001F1FF", "flag_az", "Flag of Azerbaijan"},
+{"\U0001F1E7\U0001F1E6", "flag_ba", "Flag of Bosnia & Herzegovina"},
+{"\U0001F1E7\U0001F1E7", "flag_bb", "Flag of Barbados"},
+{"\U0001F1E7\U0001F1E9", "flag_bd", "Flag of Bangladesh"},
+{"\U0001F1E7\U0001F1EA", "flag_be", "Flag of Belgium"},
+{"\U0001F1E7\U0001F1EB", "flag_bf", "Flag of Burkina Faso"},
+{"\U0001F1E7\U0001F1EC", "flag_bg", "Flag of Bulgaria"},
+{"\U0001F1E7\U0001F1ED", "flag_bh", "Flag of Bahrain"},
+{"\U0001F1E7\U0001F1EE", "flag_bi", "Flag of Burundi"},
+{"\U0001F1E7\U0001F1EF", "flag_bj", "Flag of Benin"},
+{"\U0001F1E7\U0001F1F1", "flag_bl", "Flag of St. Barthélemy"},
+{"\U0001F1E7\U0001F1F2", "flag_bm", "Flag of Bermuda"},
+{"\U0001F1E7\U0001F1F3", "flag_bn", "Flag of Brunei"},
+{"\U0001F1E7\U0001F1F4", "flag_bo", "Flag of Bolivia"},
+{"\U0001F1E7\U0001F1F6", "flag_bq", "Flag of Caribbean Netherlands"},
+{"\U0001F1E7\U0001F1F7", "flag_br", "Flag of Brazil"},
+{"\U0001F1E7\U0001F1F8", "flag_bs", "Flag of Bahamas"},
+{"\U0001F1E7\U0001F1F9", "flag_bt", "Flag of Bhutan"},
+{"\U0001F1E7\U0001F1FB", "flag_bv", "Flag of Bouvet Island"},
+{"\U0001F1E7\U0001F1FC", "flag_bw", "Flag of Botswana"},
+{"\U0001F1E7\U0001F1FE", "flag_by", "Flag of Belarus"},
+{"\U0001F1E7\U0001F1FF", "flag_bz", "Flag of Belize"},
+{"\U0001F1E8\U0001F1E6", "flag_ca", "Flag of Canada"},
+{"\U0001F1E8\U0001F1E8", "flag_cc", "Flag of Cocos (Keeling) Islands"},
+{"\U0001F1E8\U0001F1E9", "flag_cd", "Flag of Congo - Kinshasa"},
+{"\U0001F1E8\U0001F1EB", "flag_cf", "Flag of Central African Republic"},
+{"\U0001F1E8\U0001F1EC", "flag_cg", "Flag of Congo - Brazzaville"},
+{"\U0001F1E8\U0001F1ED", "flag_ch", "Flag of Switzerland"},
+{"\U0001F1E8\U0001F1EE", "flag_ci", "Flag of Côte d’Ivoire"},
+{"\U0001F1E8\U0001F1F0", "flag_ck", "Flag of Cook Islands"},
+{"\U0001F1E8\U0001F1F1", "flag_cl", "Flag of Chile"},
+{"\U0001F1E8\U0001F1F2", "flag_cm", "Flag of Cameroon"},
+{"\U0001F1E8\U0001F1F3", "flag_cn", "Flag of China"},
+{"\U0001F1E8\U0001F1F4", "flag_co", "Flag of Colombia"},
+{"\U0001F1E8\U0001F1F5", "flag_cp", "Flag of Clipperton Island"},
+{"\U0001F1E8\U0001F1F7", "flag_cr", "Flag of Costa Rica"},
+{"\U0001F1E8\U0001F1FA", "flag_cu", "Flag of Cuba"},
+{"\U0001F1E8\U0001F1FB", "flag_cv", "Flag of Cape Verde"},
+{"\U0001F1E8\U0001F1FC", "flag_cw", "Flag of Curaçao"},
+{"\U0001F1E8\U0001F1FD", "flag_cx", "Flag of Christmas Island"},
+{"\U0001F1E8\U0001F1FE", "flag_cy", "Flag of Cyprus"},
+{"\U0001F1E8\U0001F1FF", "flag_cz", "Flag of Czechia"},
+{"\U0001F1E9\U0001F1EA", "flag_de", "Flag of Germany"},
+{"\U0001F1E9\U0001F1EC", "flag_dg", "Flag of Diego Garcia"},
+{"\U0001F1E9\U0001F1EF", "flag_dj", "Flag of Djibouti"},
+{"\U0001F1E9\U0001F1F0", "flag_dk", "Flag of Denmark"},
+{"\U0001F1E9\U0001F1F2", "flag_dm", "Flag of Dominica"},
+{"\U0001F1E9\U0001F1F4", "flag_do", "Flag of Dominican Republic"},
+{"\U0001F1E9\U0001F1FF", "flag_dz", "Flag of Algeria"},
+{"\U0001F1EA\U0001F1E6", "flag_ea", "Flag of Ceuta & Melilla"},
+{"\U0001F1EA\U0001F1E8", "flag_ec", "Flag of Ecuador"},
+{"\U0001F1EA\U0001F1EA", "flag_ee", "Flag of Estonia"},
+{"\U0001F1EA\U0001F1EC", "flag_eg", "Flag of Egypt"},
+{"\U0001F1EA\U0001F1ED", "flag_eh", "Flag of Western Sahara"},
+{"\U0001F1EA\U0001F1F7", "flag_er", "Flag of Eritrea"},
+{"\U0001F1EA\U0001F1F8", "flag_es", "Flag of Spain"},
+{"\U0001F1EA\U0001F1F9", "flag_et", "Flag of Ethiopia"},
+{"\U0001F1EA\U0001F1FA", "flag_eu", "Flag of European Union"},
+{"\U0001F1EB\U0001F1EE", "flag_fi", "Flag of Finland"},
+{"\U0001F1EB\U0001F1EF", "flag_fj", "Flag of Fiji"},
+{"\U0001F1EB\U0001F1F0", "flag_fk", "Flag of Falkland Islands"},
+{"\U0001F1EB\U0001F1F2", "flag_fm", "Flag of Micronesia"},
+{"\U0001F1EB\U0001F1F4", "flag_fo", "Flag of Faroe Islands"},
+{"\U0001F1EB\U0001F1F7", "flag_fr", "Flag of France"},
+{"\U0001F1EC\U0001F1E6", "flag_ga", "Flag of Gabon"},
+{"\U0001F1EC\U0001F1E7", "flag_gb", "Flag of United Kingdom"},
+{"\U0001F1EC\U0001F1E9", "flag_gd", "Flag of Grenada"},
+{"\U0001F1EC\U0001F1EA", "flag_ge", "Flag of Georgia"},
+{"\U0001F1EC\U0001F1EB", "flag_gf", "Flag of French Guiana"},
+{"\U0001F1EC\U0001F1EC", "flag_gg", "Flag of Guernsey"},
+{"\U0001F1EC\U0001F1ED", "flag_gh", "Flag of Ghana"},
+{"\U0001F1EC\U0001F1EE", "flag_gi", "Flag of Gibraltar"},
+{"\U0001F1EC\U0001F1F1", "flag_gl", "Flag of Greenland"},
+{"\U0001F1EC\U0001F1F2", "flag_gm", "Flag of Gambia"},
+{"\U0001F1EC\U0001F1F3", "flag_gn", "Flag of Guinea"},
+{"\U0001F1EC\U0001F1F5", "flag_gp", "Flag of Guadeloupe"},
+{"\U0001F1EC\U0001F1F6", "flag_gq", "Flag of Equatorial Guinea"},
+{"\U0001F1EC\U0001F1F7", "flag_gr", "Flag of Greece"},
+{"\U0001F1EC\U0001F1F8", "flag_gs", "Flag of South Georgia & South Sandwich Islands"},
+{"\U0001F1EC\U0001F1F9", "flag_gt", "Flag of Guatemala"},
+{"\U0001F1EC\U0001F1FA", "flag_gu", "Flag of Guam"},
+{"\U0001F1EC\U0001F1FC", "flag_gw", "Flag of Guinea-Bissau"},
+{"\U0001F1EC\U0001F1FE", "flag_gy", "Flag of Guyana"},
+{"\U0001F1ED\U0001F1F0", "flag_hk", "Flag of Hong Kong SAR China"},
+{"\U0001F1ED\U0001F1F2", "flag_hm", "Flag of Heard & McDonald Islands"},
+{"\U0001F1ED\U0001F1F3", "flag_hn", "Flag of Honduras"},
+{"\U0001F1ED\U0001F1F7", "flag_hr", "Flag of Croatia"},
+{"\U0001F1ED\U0001F1F9", "flag_ht", "Flag of Haiti"},
+{"\U0001F1ED\U0001F1FA", "flag_hu", "Flag of Hungary"},
+{"\U0001F1EE\U0001F1E8", "flag_ic", "Flag of Canary Islands"},
+{"\U0001F1EE\U0001F1E9", "flag_id", "Flag of Indonesia"},
+{"\U0001F1EE\U0001F1EA", "flag_ie", "Flag of Ireland"},
+{"\U0001F1EE\U0001F1F1", "flag_il", "Flag of Israel"},
+{"\U0001F1EE\U0001F1F2", "flag_im", "Flag of Isle of Man"},
+{"\U0001F1EE\U0001F1F3", "flag_in", "Flag of India"},
+{"\U0001F1EE\U0001F1F4", "flag_io", "Flag of British Indian Ocean Territory"},
+{"\U0001F1EE\U0001F1F6", "flag_iq", "Flag of Iraq"},
+{"\U0001F1EE\U0001F1F7", "flag_ir", "Flag of Iran"},
+{"\U0001F1EE\U0001F1F8", "flag_is", "Flag of Iceland"},
+{"\U0001F1EE\U0001F1F9", "flag_it", "Flag of Italy"},
+{"\U0001F1EF\U0001F1EA", "flag_je", "Flag of Jersey"},
+{"\U0001F1EF\U0001F1F2", "flag_jm", "Flag of Jamaica"},
+{"\U0001F1EF\U0001F1F4", "flag_jo", "Flag of Jordan"},
+{"\U0001F1EF\U0001F1F5", "flag_jp", "Flag of Japan"},
+{"\U0001F1F0\U0001F1EA", "flag_ke", "Flag of Kenya"},
+{"\U0001F1F0\U0001F1EC", "flag_kg", "Flag of Kyrgyzstan"},
+{"\U0001F1F0\U0001F1ED", "flag_kh", "Flag of Cambodia"},
+{"\U0001F1F0\U0001F1EE", "flag_ki", "Flag of Kiribati"},
+{"\U0001F1F0\U0001F1F2", "flag_km", "Flag of Comoros"},
+{"\U0001F1F0\U0001F1F3", "flag_kn", "Flag of St. Kitts & Nevis"},
+{"\U0001F1F0\U0001F1F5", "flag_kp", "Flag of North Korea"},
+{"\U0001F1F0\U0001F1F7", "flag_kr", "Flag of South Korea"},
+{"\U0001F1F0\U0001F1FC", "flag_kw", "Flag of Kuwait"},
+{"\U0001F1F0\U0001F1FE", "flag_ky", "Flag of Cayman Islands"},
+{"\U0001F1F0\U0001F1FF", "flag_kz", "Flag of Kazakhstan"},
+{"\U0001F1F1\U0001F1E6", "flag_la", "Flag of Laos"},
+{"\U0001F1F1\U0001F1E7", "flag_lb", "Flag of Lebanon"},
+{"\U0001F1F1\U0001F1E8", "flag_lc", "Flag of St. Lucia"},
+{"\U0001F1F1\U0001F1EE", "flag_li", "Flag of Liechtenstein"},
+{"\U0001F1F1\U0001F1F0", "flag_lk", "Flag of Sri Lanka"},
+{"\U0001F1F1\U0001F1F7", "flag_lr", "Flag of Liberia"},
+{"\U0001F1F1\U0001F1F8", "flag_ls", "Flag of Lesotho"},
+{"\U0001F1F1\U0001F1F9", "flag_lt", "Flag of Lithuania"},
+{"\U0001F1F1\U0001F1FA", "flag_lu", "Flag of Luxembourg"},
+{"\U0001F1F1\U0001F1FB", "flag_lv", "Flag of Latvia"},
+{"\U0001F1F1\U0001F1FE", "flag_ly", "Flag of Libya"},
+{"\U0001F1F2\U0001F1E6", "flag_ma", "Flag of Morocco"},
+{"\U0001F1F2\U0001F1E8", "flag_mc", "Flag of Monaco"},
+{"\U0001F1F2\U0001F1E9", "flag_md", "Flag of Moldova"},
+{"\U0001F1F2\U0001F1EA", "flag_me", "Flag of Montenegro"},
+{"\U0001F1F2\U0001F1EB", "flag_mf", "Flag of St. Martin"},
+{"\U0001F1F2\U0001F1EC", "flag_mg", "Flag of Madagascar"},
+{"\U0001F1F2\U0001F1ED", "flag_mh", "Flag of Marshall Islands"},
+{"\U0001F1F2\U0001F1F0", "flag_mk", "Flag of North Macedonia"},
+{"\U0001F1F2\U0001F1F1", "flag_ml", "Flag of Mali"},
+{"\U0001F1F2\U0001F1F2", "flag_mm", "Flag of Myanmar (Burma)"},
+{"\U0001F1F2\U0001F1F3", "flag_mn", "Flag of Mongolia"},
+{"\U0001F1F2\U0001F1F4", "flag_mo", "Flag of Macao SAR China"},
+{"\U0001F1F2\U0001F1F5", "flag_mp", "Flag of Northern Mariana Islands"},
+{"\U0001F1F2\U0001F1F6", "flag_mq", "Flag of Martinique"},
+{"\U0001F1F2\U0001F1F7", "flag_mr", "Flag of Mauritania"},
+{"\U0001F1F2\U0001F1F8", "flag_ms", "Flag of Montserrat"},
+{"\U0001F1F2\U0001F1F9", "flag_mt", "Flag of Malta"},
+{"\U0001F1F2\U0001F1FA", "flag_mu", "Flag of Mauritius"},
+{"\U0001F1F2\U0001F1FB", "flag_mv", "Flag of Maldives"},
+{"\U0001F1F2\U0001F1FC", "flag_mw", "Flag of Malawi"},
+{"\U0001F1F2\U0001F1FD", "flag_mx", "Flag of Mexico"},
+{"\U0001F1F2\U0001F1FE", "flag_my", "Flag of Malaysia"},
+{"\U0001F1F2\U0001F1FF", "flag_mz", "Flag of Mozambique"},
+{"\U0001F1F3\U0001F1E6", "flag_na", "Flag of Namibia"},
+{"\U0001F1F3\U0001F1E8", "flag_nc", "Flag of New Caledonia"},
+{"\U0001F1F3\U0001F1EA", "flag_ne", "Flag of Niger"},
+{"\U0001F1F3\U0001F1EB", "flag_nf", "Flag of Norfolk Island"},
+{"\U0001F1F3\U0001F1EC", "flag_ng", "Flag of Nigeria"},
+{"\U0001F1F3\U0001F1EE", "flag_ni", "Flag of Nicaragua"},
+{"\U0001F1F3\U0001F1F1", "flag_nl", "Flag of Netherlands"},
+{"\U0001F1F3\U0001F1F4", "flag_no", "Flag of Norway"},
+{"\U0001F1F3\U0001F1F5", "flag_np", "Flag of Nepal"},
+{"\U0001F1F3\U0001F1F7", "flag_nr", "Flag of Nauru"},
+{"\U0001F1F3\U0001F1FA", "flag_nu", "Flag of Niue"},
+{"\U0001F1F3\U0001F1FF", "flag_nz", "Flag of New Zealand"},
+{"\U0001F1F4\U0001F1F2", "flag_om", "Flag of Oman"},
+{"\U0001F1F5\U0001F1E6", "flag_pa", "Flag of Panama"},
+{"\U0001F1F5\U0001F1EA", "flag_pe", "Flag of Peru"},
+{"\U0001F1F5\U0001F1EB", "flag_pf", "Flag of French Polynesia"},
+{"\U0001F1F5\U0001F1EC", "flag_pg", "Flag of Papua New Guinea"},
+{"\U0001F1F5\U0001F1ED", "flag_ph", "Flag of Philippines"},
+{"\U0001F1F5\U0001F1F0", "flag_pk", "Flag of Pakistan"},
+{"\U0001F1F5\U0001F1F1", "flag_pl", "Flag of Poland"},
+{"\U0001F1F5\U0001F1F2", "flag_pm", "Flag of St. Pierre & Miquelon"},
+{"\U0001F1F5\U0001F1F3", "flag_pn", "Flag of Pitcairn Islands"},
+{"\U0001F1F5\U0001F1F7", "flag_pr", "Flag of Puerto Rico"},
+{"\U0001F1F5\U0001F1F8", "flag_ps", "Flag of Palestinian Territories"},
+{"\U0001F1F5\U0001F1F9", "flag_pt", "Flag of Portugal"},
+{"\U0001F1F5\U0001F1FC", "flag_pw", "Flag of Palau"},
+{"\U0001F1F5\U0001F1FE", "flag_py", "Flag of Paraguay"},
+{"\U0001F1F6\U0001F1E6", "flag_qa", "Flag of Qatar"},
+{"\U0001F1F7\U0001F1EA", "flag_re", "Flag of Réunion"},
+{"\U0001F1F7\U0001F1F4", "flag_ro", "Flag of Romania"},
+{"\U0001F1F7\U0001F1F8", "flag_rs", "Flag of Serbia"},
+{"\U0001F1F7\U0001F1FA", "flag_ru", "Flag of Russia"},
+{"\U0001F1F7\U0001F1FC", "flag_rw", "Flag of Rwanda"},
+{"\U0001F1F8\U0001F1E6", "flag_sa", "Flag of Saudi Arabia"},
+{"\U0001F1F8\U0001F1E7", "flag_sb", "Flag of Solomon Islands"},
+{"\U0001F1F8\U0001F1E8", "flag_sc", "Flag of Seychelles"},
+{"\U0001F1F8\U0001F1E9", "flag_sd", "Flag of Sudan"},
+{"\U0001F1F8\U0001F1EA", "flag_se", "Flag of Sweden"},
+{"\U0001F1F8\U0001F1EC", "flag_sg", "Flag of Singapore"},
+{"\U0001F1F8\U0001F1ED", "flag_sh", "Flag of St. Helena"},
+{"\U0001F1F8\U0001F1EE", "flag_si", "Flag of Slovenia"},
+{"\U0001F1F8\U0001F1EF", "flag_sj", "Flag of Svalbard & Jan Mayen"},
+{"\U0001F1F8\U0001F1F0", "flag_sk", "Flag of Slovakia"},
+{"\U0001F1F8\U0001F1F1", "flag_sl", "Flag of Sierra Leone"},
+{"\U0001F1F8\U0001F1F2", "flag_sm", "Flag of San Marino"},
+{"\U0001F1F8\U0001F1F3", "flag_sn", "Flag of Senegal"},
+{"\U0001F1F8\U0001F1F4", "flag_so", "Flag of Somalia"},
+{"\U0001F1F8\U0001F1F7", "flag_sr", "Flag of Suriname"},
+{"\U0001F1F8\U0001F1F8", "flag_ss", "Flag of South Sudan"},
+{"\U0001F1F8\U0001F1F9", "flag_st", "Flag of São Tomé & Príncipe"},
+{"\U0001F1F8\U0001F1FB", "flag_sv", "Flag of El Salvador"},
+{"\U0001F1F8\U0001F1FD", "flag_sx", "Flag of Sint Maarten"},
+{"\U0001F1F8\U0001F1FE", "flag_sy", "Flag of Syria"},
+{"\U0001F1F8\U0001F1FF", "flag_sz", "Flag of Eswatini"},
+{"\U0001F1F9\U0001F1E6", "flag_ta", "Flag of Tristan da Cunha"},
+{"\U0001F1F9\U0001F1E8", "flag_tc", "Flag of Turks & Caicos Islands"},
+{"\U0001F1F9\U0001F1E9", "flag_td", "Flag of Chad"},
+{"\U0001F1F9\U0001F1EB", "flag_tf", "Flag of French Southern Territories"},
+{"\U0001F1F9\U0001F1EC", "flag_tg", "Flag of Togo"},
+{"\U0001F1F9\U0001F1ED", "flag_th", "Flag of Thailand"},
+{"\U0001F1F9\U0001F1EF", "flag_tj", "Flag of Tajikistan"},
+{"\U0001F1F9\U0001F1F0", "flag_tk", "Flag of Tokelau"},
+{"\U0001F1F9\U0001F1F1", "flag_tl", "Flag of Timor-Leste"},
+{"\U0001F1F9\U0001F1F2", "flag_tm", "Flag of Turkmenistan"},
+{"\U0001F1F9\U0001F1F3", "flag_tn", "Flag of Tunisia"},
+{"\U0001F1F9\U0001F1F4", "flag_to", "Flag of Tonga"},
+{"\U0001F1F9\U0001F1F7", "flag_tr", "Flag of Turkey"},
+{"\U0001F1F9\U0001F1F9", "flag_tt", "Flag of Trinidad & Tobago"},
+{"\U0001F1F9\U0001F1FB", "flag_tv", "Flag of Tuvalu"},
+{"\U0001F1F9\U0001F1FC", "flag_tw", "Flag of Taiwan"},
+{"\U0001F1F9\U0001F1FF", "flag_tz", "Flag of Tanzania"},
+{"\U0001F1FA\U0001F1E6", "flag_ua", "Flag of Ukraine"},
+{"\U0001F1FA\U0001F1EC", "flag_ug", "Flag of Uganda"},
+{"\U0001F1FA\U0001F1F2", "flag_um", "Flag of U.S. Outlying Islands"},
+{"\U0001F1FA\U0001F1F3", "united_nations", "Flag of United Nations"},
+{"\U0001F1FA\U0001F1F8", "flag_us", "Flag of United States"},
+{"\U0001F1FA\U0001F1FE", "flag_uy", "Flag of Uruguay"},
+{"\U0001F1FA\U0001F1FF", "flag_uz", "Flag of Uzbekistan"},
+{"\U0001F1FB\U0001F1E6", "flag_va", "Flag of Vatican City"},
+{"\U0001F1FB\U0001F1E8", "flag_vc", "Flag of St. Vincent & Grenadines"},
+{"\U0001F1FB\U0001F1EA", "flag_ve", "Flag of Venezuela"},
+{"\U0001F1FB\U0001F1EC", "flag_vg", "Flag of British Virgin Islands"},
+{"\U0001F1FB\U0001F1EE", "flag_vi", "Flag of U.S. Virgin Islands"},
+{"\U0001F1FB\U0001F1F3", "flag_vn", "Flag of Vietnam"},
+{"\U0001F1FB\U0001F1FA", "flag_vu", "Flag of Vanuatu"},
+{"\U0001F1FC\U0001F1EB", "flag_wf", "Flag of Wallis & Futuna"},
+{"\U0001F1FC\U0001F1F8", "flag_ws", "Flag of Samoa"},
+{"\U0001F1FD\U0001F1F0", "flag_xk", "Flag of Kosovo"},
+{"\U0001F1FE\U0001F1EA", "flag_ye", "Flag of Yemen"},
+{"\U0001F1FE\U0001F1F9", "flag_yt", "Flag of Mayotte"},
+{"\U0001F1FF\U0001F1E6", "flag_za", "Flag of South Africa"},
+{"\U0001F1FF\U0001F1F2", "flag_zm", "Flag of Zambia"},
+{"\U0001F1FF\U0001F1FC", "flag_zw", "Flag of Zimbabwe"},
+{"\U0001F3F4\U000E0067\U000E0062\U000E0065\U000E006E\U000E0067\U000E007F", "england", "Flag of England"},
+{"\U0001F3F4\U000E0067\U000E0062\U000E0073\U000E0063\U000E0074\U000E007F", "scotland", "Flag of Scotland"},
+{"\U0001F3F4\U000E0067\U000E0062\U000E0077\U000E006C\U000E0073\U000E007F", "wales", "Flag of Wales"},
+};
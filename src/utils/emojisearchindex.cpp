@@ -0,0 +1,204 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "utils/emojisearchindex.h"
+
+#include <algorithm>
+
+namespace
+{
+// How well an emoji matched a query, lower is better
+enum Rank {
+    ExactMatch,
+    ShortNamePrefix,
+    WordPrefix,
+    Substring,
+};
+
+bool isSeparator(QChar c)
+{
+    return c == u'_' || c == u' ' || c == u'-' || c == u':' || c == u'\n';
+}
+
+QList<QStringView> words(QStringView text)
+{
+    QList<QStringView> result;
+    qsizetype start = 0;
+    for (qsizetype i = 0; i <= text.size(); i++) {
+        if (i == text.size() || isSeparator(text[i])) {
+            if (i > start) {
+                result.push_back(text.sliced(start, i - start));
+            }
+            start = i + 1;
+        }
+    }
+    return result;
+}
+}
+
+void EmojiSearchIndex::add(const QString &shortName, const QString &description, const QVariant &value)
+{
+    QString text = shortName.toLower();
+    if (!description.isEmpty()) {
+        text += u'\n' + description.toLower();
+    }
+
+    if (!m_byShortName.contains(shortName)) {
+        m_byShortName.insert(shortName, m_entries.size());
+    }
+    m_entries.push_back(Entry{shortName, std::move(text), value});
+}
+
+void EmojiSearchIndex::build()
+{
+    m_words.clear();
+    m_trigrams.clear();
+
+    for (qsizetype i = 0; i < m_entries.size(); i++) {
+        const QString &text = m_entries[i].text;
+        const QStringView shortName = QStringView(text).left(m_entries[i].shortName.size());
+
+        // The whole short name is a "word" too, so "thumbs_u" still matches "thumbs_up" as a prefix
+        m_words.push_back({shortName.toString(), i});
+        for (const QStringView word : words(text)) {
+            if (word.size() != shortName.size() || word.data() != shortName.data()) {
+                m_words.push_back({word.toString(), i});
+            }
+        }
+
+        for (qsizetype position = 0; position + 3 <= text.size(); position++) {
+            auto &entries = m_trigrams[trigram(text, position)];
+            if (entries.isEmpty() || entries.constLast() != i) {
+                entries.push_back(i);
+            }
+        }
+    }
+
+    std::sort(m_words.begin(), m_words.end());
+}
+
+QVariantList EmojiSearchIndex::search(QStringView query, const QSet<QString> &boosted) const
+{
+    const QString needle = query.trimmed().toString().toLower();
+    if (needle.isEmpty()) {
+        return values();
+    }
+
+    QHash<qsizetype, Rank> ranks;
+    const auto match = [&ranks](qsizetype entry, Rank rank) {
+        const auto it = ranks.find(entry);
+        if (it == ranks.end()) {
+            ranks.insert(entry, rank);
+        } else if (rank < *it) {
+            *it = rank;
+        }
+    };
+
+    // Prefix matches from the sorted word table
+    auto it = std::lower_bound(m_words.cbegin(), m_words.cend(), needle, [](const std::pair<QString, qsizetype> &word, const QString &needle) {
+        return word.first < needle;
+    });
+    for (; it != m_words.cend() && it->first.startsWith(needle); ++it) {
+        const Entry &entry = m_entries[it->second];
+        const bool isShortName = it->first.size() == entry.shortName.size() && entry.text.startsWith(it->first);
+        if (isShortName) {
+            match(it->second, it->first.size() == needle.size() ? ExactMatch : ShortNamePrefix);
+        } else {
+            match(it->second, WordPrefix);
+        }
+    }
+
+    // Substring matches, narrowed down to the entries that contain every trigram of the query
+    if (needle.size() >= 3) {
+        QList<qsizetype> candidates;
+        for (qsizetype position = 0; position + 3 <= needle.size(); position++) {
+            const auto postings = m_trigrams.constFind(trigram(needle, position));
+            if (postings == m_trigrams.cend()) {
+                candidates.clear();
+                break;
+            }
+
+            if (position == 0) {
+                candidates = *postings;
+            } else {
+                QList<qsizetype> intersection;
+                std::set_intersection(candidates.cbegin(), candidates.cend(), postings->cbegin(), postings->cend(), std::back_inserter(intersection));
+                candidates = std::move(intersection);
+            }
+
+            if (candidates.isEmpty()) {
+                break;
+            }
+        }
+
+        for (const qsizetype candidate : std::as_const(candidates)) {
+            if (m_entries[candidate].text.contains(needle)) {
+                match(candidate, Substring);
+            }
+        }
+    } else {
+        // Trigrams can't help with one or two characters, but the lowercase text still saves us from folding case each time
+        for (qsizetype i = 0; i < m_entries.size(); i++) {
+            if (m_entries[i].text.contains(needle)) {
+                match(i, Substring);
+            }
+        }
+    }
+
+    QList<std::pair<qsizetype, Rank>> results;
+    results.reserve(ranks.size());
+    for (auto it = ranks.cbegin(); it != ranks.cend(); ++it) {
+        results.push_back({it.key(), it.value()});
+    }
+
+    std::sort(results.begin(), results.end(), [this, &boosted](const auto &left, const auto &right) {
+        if (left.second != right.second) {
+            return left.second < right.second;
+        }
+        const bool leftBoosted = boosted.contains(m_entries[left.first].shortName);
+        const bool rightBoosted = boosted.contains(m_entries[right.first].shortName);
+        if (leftBoosted != rightBoosted) {
+            return leftBoosted;
+        }
+        return left.first < right.first;
+    });
+
+    QVariantList list;
+    list.reserve(results.size());
+    for (const auto &[entry, rank] : std::as_const(results)) {
+        list.push_back(m_entries[entry].value);
+    }
+
+    return list;
+}
+
+QVariant EmojiSearchIndex::find(const QString &shortName) const
+{
+    const auto it = m_byShortName.constFind(shortName);
+    if (it == m_byShortName.cend()) {
+        return {};
+    }
+
+    return m_entries[*it].value;
+}
+
+QVariantList EmojiSearchIndex::values() const
+{
+    QVariantList list;
+    list.reserve(m_entries.size());
+    for (const auto &entry : m_entries) {
+        list.push_back(entry.value);
+    }
+
+    return list;
+}
+
+qsizetype EmojiSearchIndex::size() const
+{
+    return m_entries.size();
+}
+
+quint64 EmojiSearchIndex::trigram(QStringView text, qsizetype position)
+{
+    return quint64(text[position].unicode()) << 32 | quint64(text[position + 1].unicode()) << 16 | quint64(text[position + 2].unicode());
+}
@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QSet>
+#include <QVariant>
+
+/**
+ * @brief A search index over emoji short names and descriptions.
+ *
+ * Every word of an emoji's short name and description is kept in a sorted table for prefix lookups, and every trigram of them in an inverted index for
+ * substring lookups. This avoids touching each emoji on every keystroke, which matters for instances with thousands of custom emoji.
+ */
+class EmojiSearchIndex
+{
+public:
+    /**
+     * @brief Adds an emoji to the index. @p value is what's returned by search() and find().
+     */
+    void add(const QString &shortName, const QString &description, const QVariant &value);
+
+    /**
+     * @brief Builds the lookup tables, must be called after adding all emoji and before searching.
+     */
+    void build();
+
+    /**
+     * @return The emoji whose short name or description contains @p query, case-insensitively. Exact short name matches come first, then short
+     * names starting with the query, then words starting with the query, then everything else. Within each group, emoji in @p boosted (like recently
+     * used ones) are ranked first, otherwise the order they were added in is kept.
+     */
+    QVariantList search(QStringView query, const QSet<QString> &boosted = {}) const;
+
+    /**
+     * @return The emoji with the short name @p shortName, or an invalid QVariant if there's none.
+     */
+    QVariant find(const QString &shortName) const;
+
+    /**
+     * @return Every emoji in the order they were added.
+     */
+    QVariantList values() const;
+
+    /**
+     * @return The number of emoji in the index.
+     */
+    qsizetype size() const;
+
+private:
+    struct Entry {
+        QString shortName;
+        QString text; // Lowercase short name and description, searched for substrings
+        QVariant value;
+    };
+
+    static quint64 trigram(QStringView text, qsizetype position);
+
+    QList<Entry> m_entries;
+    QHash<QString, qsizetype> m_byShortName;
+    QList<std::pair<QString, qsizetype>> m_words; // Lowercase words, sorted
+    QHash<quint64, QList<qsizetype>> m_trigrams; // Entries containing each trigram, in ascending order
+};
@@ -2,8 +2,39 @@
 // SPDX-License-Identifier: LGPL-2.0-or-later
 
 #include "utils/emojitones.h"
-#include "utils/emojimodel.h"
+#include "utils/emojilistmodel.h"
 
-QMultiHash<QString, QVariant> EmojiTones::_tones = {
+#include <algorithm>
+#include <string_view>
+
+namespace
+{
 #include "utils/emojitones_data.h"
+
+// The base of a tone is its description up to the colon, e.g. "waving hand" for "waving hand: light skin tone"
+std::string_view baseOf(const EmojiData &tone)
+{
+    const std::string_view description(tone.description);
+    return description.substr(0, description.find(':'));
+}
+
+// The table is sorted by base, byte-wise
+struct CompareBase {
+    bool operator()(const EmojiData &tone, std::string_view base) const
+    {
+        return baseOf(tone) < base;
+    }
+    bool operator()(std::string_view base, const EmojiData &tone) const
+    {
+        return base < baseOf(tone);
+    }
 };
+}
+
+std::pair<const EmojiData *, qsizetype> EmojiTones::tones(QStringView base)
+{
+    const QByteArray key = base.toUtf8();
+    const auto [first, last] = std::equal_range(std::cbegin(emojiTones), std::cend(emojiTones), std::string_view(key.constData(), key.size()), CompareBase{});
+
+    return {first, last - first};
+}
@@ -3,19 +3,26 @@
 
 #pragma once
 
-#include <QVariant>
+#include <QStringView>
+
+#include <utility>
+
+struct EmojiData;
 
 /**
  * @class EmojiTones
  *
- * This class provides a _tones variable with the available emoji tones to EmojiModel.
+ * This class provides the available emoji tones to EmojiModel.
  *
  * @sa EmojiModel
  */
 class EmojiTones
 {
-private:
-    static QMultiHash<QString, QVariant> _tones;
-
-    friend class EmojiModel;
+public:
+    /**
+     * @brief Looks up the skin tone variants of an emoji.
+     * @param base The description of the base emoji, e.g. "waving hand".
+     * @return A pointer to the first variant in a static table and the number of variants, or zero if there are none.
+     */
+    static std::pair<const EmojiData *, qsizetype> tones(QStringView base);
 };
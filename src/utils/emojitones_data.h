@@ -2,1783 +2,1785 @@
 // SPDX-License-Identifier: LGPL-2.0-or-later
 // This file is auto-generated. All changes will be lost. See tools/update-emojis.py
 // clang-format off
-{QStringLiteral("waving hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44B\U0001F3FB"), QStringLiteral("wave_tone1"), QStringLiteral("waving hand: light skin tone")})},
-{QStringLiteral("waving hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44B\U0001F3FC"), QStringLiteral("wave_tone2"), QStringLiteral("waving hand: medium-light skin tone")})},
-{QStringLiteral("waving hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44B\U0001F3FD"), QStringLiteral("wave_tone3"), QStringLiteral("waving hand: medium skin tone")})},
-{QStringLiteral("waving hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44B\U0001F3FE"), QStringLiteral("wave_tone4"), QStringLiteral("waving hand: medium-dark skin tone")})},
-{QStringLiteral("waving hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44B\U0001F3FF"), QStringLiteral("wave_tone5"), QStringLiteral("waving hand: dark skin tone")})},
-{QStringLiteral("raised back of hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91A\U0001F3FB"), QStringLiteral("raised_back_of_hand_tone1"), QStringLiteral("raised back of hand: light skin tone")})},
-{QStringLiteral("raised back of hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91A\U0001F3FC"), QStringLiteral("raised_back_of_hand_tone2"), QStringLiteral("raised back of hand: medium-light skin tone")})},
-{QStringLiteral("raised back of hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91A\U0001F3FD"), QStringLiteral("raised_back_of_hand_tone3"), QStringLiteral("raised back of hand: medium skin tone")})},
-{QStringLiteral("raised back of hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91A\U0001F3FE"), QStringLiteral("raised_back_of_hand_tone4"), QStringLiteral("raised back of hand: medium-dark skin tone")})},
-{QStringLiteral("raised back of hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91A\U0001F3FF"), QStringLiteral("raised_back_of_hand_tone5"), QStringLiteral("raised back of hand: dark skin tone")})},
-{QStringLiteral("hand with fingers splayed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F590\U0001F3FB"), QStringLiteral("hand_splayed_tone1"), QStringLiteral("hand with fingers splayed: light skin tone")})},
-{QStringLiteral("hand with fingers splayed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F590\U0001F3FC"), QStringLiteral("hand_splayed_tone2"), QStringLiteral("hand with fingers splayed: medium-light skin tone")})},
-{QStringLiteral("hand with fingers splayed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F590\U0001F3FD"), QStringLiteral("hand_splayed_tone3"), QStringLiteral("hand with fingers splayed: medium skin tone")})},
-{QStringLiteral("hand with fingers splayed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F590\U0001F3FE"), QStringLiteral("hand_splayed_tone4"), QStringLiteral("hand with fingers splayed: medium-dark skin tone")})},
-{QStringLiteral("hand with fingers splayed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F590\U0001F3FF"), QStringLiteral("hand_splayed_tone5"), QStringLiteral("hand with fingers splayed: dark skin tone")})},
-{QStringLiteral("raised hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270B\U0001F3FB"), QStringLiteral("raised_hand_tone1"), QStringLiteral("raised hand: light skin tone")})},
-{QStringLiteral("raised hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270B\U0001F3FC"), QStringLiteral("raised_hand_tone2"), QStringLiteral("raised hand: medium-light skin tone")})},
-{QStringLiteral("raised hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270B\U0001F3FD"), QStringLiteral("raised_hand_tone3"), QStringLiteral("raised hand: medium skin tone")})},
-{QStringLiteral("raised hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270B\U0001F3FE"), QStringLiteral("raised_hand_tone4"), QStringLiteral("raised hand: medium-dark skin tone")})},
-{QStringLiteral("raised hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270B\U0001F3FF"), QStringLiteral("raised_hand_tone5"), QStringLiteral("raised hand: dark skin tone")})},
-{QStringLiteral("vulcan salute"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F596\U0001F3FB"), QStringLiteral("vulcan_tone1"), QStringLiteral("vulcan salute: light skin tone")})},
-{QStringLiteral("vulcan salute"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F596\U0001F3FC"), QStringLiteral("vulcan_tone2"), QStringLiteral("vulcan salute: medium-light skin tone")})},
-{QStringLiteral("vulcan salute"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F596\U0001F3FD"), QStringLiteral("vulcan_tone3"), QStringLiteral("vulcan salute: medium skin tone")})},
-{QStringLiteral("vulcan salute"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F596\U0001F3FE"), QStringLiteral("vulcan_tone4"), QStringLiteral("vulcan salute: medium-dark skin tone")})},
-{QStringLiteral("vulcan salute"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F596\U0001F3FF"), QStringLiteral("vulcan_tone5"), QStringLiteral("vulcan salute: dark skin tone")})},
-{QStringLiteral("rightwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FB"), QStringLiteral("rightwards hand: light skin tone"), QStringLiteral("rightwards hand: light skin tone")})},
-{QStringLiteral("rightwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FC"), QStringLiteral("rightwards hand: medium-light skin tone"), QStringLiteral("rightwards hand: medium-light skin tone")})},
-{QStringLiteral("rightwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FD"), QStringLiteral("rightwards hand: medium skin tone"), QStringLiteral("rightwards hand: medium skin tone")})},
-{QStringLiteral("rightwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FE"), QStringLiteral("rightwards hand: medium-dark skin tone"), QStringLiteral("rightwards hand: medium-dark skin tone")})},
-{QStringLiteral("rightwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FF"), QStringLiteral("rightwards hand: dark skin tone"), QStringLiteral("rightwards hand: dark skin tone")})},
-{QStringLiteral("leftwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF2\U0001F3FB"), QStringLiteral("leftwards hand: light skin tone"), QStringLiteral("leftwards hand: light skin tone")})},
-{QStringLiteral("leftwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF2\U0001F3FC"), QStringLiteral("leftwards hand: medium-light skin tone"), QStringLiteral("leftwards hand: medium-light skin tone")})},
-{QStringLiteral("leftwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF2\U0001F3FD"), QStringLiteral("leftwards hand: medium skin tone"), QStringLiteral("leftwards hand: medium skin tone")})},
-{QStringLiteral("leftwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF2\U0001F3FE"), QStringLiteral("leftwards hand: medium-dark skin tone"), QStringLiteral("leftwards hand: medium-dark skin tone")})},
-{QStringLiteral("leftwards hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF2\U0001F3FF"), QStringLiteral("leftwards hand: dark skin tone"), QStringLiteral("leftwards hand: dark skin tone")})},
-{QStringLiteral("palm down hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF3\U0001F3FB"), QStringLiteral("palm down hand: light skin tone"), QStringLiteral("palm down hand: light skin tone")})},
-{QStringLiteral("palm down hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF3\U0001F3FC"), QStringLiteral("palm down hand: medium-light skin tone"), QStringLiteral("palm down hand: medium-light skin tone")})},
-{QStringLiteral("palm down hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF3\U0001F3FD"), QStringLiteral("palm down hand: medium skin tone"), QStringLiteral("palm down hand: medium skin tone")})},
-{QStringLiteral("palm down hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF3\U0001F3FE"), QStringLiteral("palm down hand: medium-dark skin tone"), QStringLiteral("palm down hand: medium-dark skin tone")})},
-{QStringLiteral("palm down hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF3\U0001F3FF"), QStringLiteral("palm down hand: dark skin tone"), QStringLiteral("palm down hand: dark skin tone")})},
-{QStringLiteral("palm up hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF4\U0001F3FB"), QStringLiteral("palm up hand: light skin tone"), QStringLiteral("palm up hand: light skin tone")})},
-{QStringLiteral("palm up hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF4\U0001F3FC"), QStringLiteral("palm up hand: medium-light skin tone"), QStringLiteral("palm up hand: medium-light skin tone")})},
-{QStringLiteral("palm up hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF4\U0001F3FD"), QStringLiteral("palm up hand: medium skin tone"), QStringLiteral("palm up hand: medium skin tone")})},
-{QStringLiteral("palm up hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF4\U0001F3FE"), QStringLiteral("palm up hand: medium-dark skin tone"), QStringLiteral("palm up hand: medium-dark skin tone")})},
-{QStringLiteral("palm up hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF4\U0001F3FF"), QStringLiteral("palm up hand: dark skin tone"), QStringLiteral("palm up hand: dark skin tone")})},
-{QStringLiteral("OK hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44C\U0001F3FB"), QStringLiteral("ok_hand_tone1"), QStringLiteral("OK hand: light skin tone")})},
-{QStringLiteral("OK hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44C\U0001F3FC"), QStringLiteral("ok_hand_tone2"), QStringLiteral("OK hand: medium-light skin tone")})},
-{QStringLiteral("OK hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44C\U0001F3FD"), QStringLiteral("ok_hand_tone3"), QStringLiteral("OK hand: medium skin tone")})},
-{QStringLiteral("OK hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44C\U0001F3FE"), QStringLiteral("ok_hand_tone4"), QStringLiteral("OK hand: medium-dark skin tone")})},
-{QStringLiteral("OK hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44C\U0001F3FF"), QStringLiteral("ok_hand_tone5"), QStringLiteral("OK hand: dark skin tone")})},
-{QStringLiteral("pinched fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90C\U0001F3FB"), QStringLiteral("pinched fingers: light skin tone"), QStringLiteral("pinched fingers: light skin tone")})},
-{QStringLiteral("pinched fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90C\U0001F3FC"), QStringLiteral("pinched fingers: medium-light skin tone"), QStringLiteral("pinched fingers: medium-light skin tone")})},
-{QStringLiteral("pinched fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90C\U0001F3FD"), QStringLiteral("pinched fingers: medium skin tone"), QStringLiteral("pinched fingers: medium skin tone")})},
-{QStringLiteral("pinched fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90C\U0001F3FE"), QStringLiteral("pinched fingers: medium-dark skin tone"), QStringLiteral("pinched fingers: medium-dark skin tone")})},
-{QStringLiteral("pinched fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90C\U0001F3FF"), QStringLiteral("pinched fingers: dark skin tone"), QStringLiteral("pinched fingers: dark skin tone")})},
-{QStringLiteral("pinching hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90F\U0001F3FB"), QStringLiteral("pinching hand: light skin tone"), QStringLiteral("pinching hand: light skin tone")})},
-{QStringLiteral("pinching hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90F\U0001F3FC"), QStringLiteral("pinching hand: medium-light skin tone"), QStringLiteral("pinching hand: medium-light skin tone")})},
-{QStringLiteral("pinching hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90F\U0001F3FD"), QStringLiteral("pinching hand: medium skin tone"), QStringLiteral("pinching hand: medium skin tone")})},
-{QStringLiteral("pinching hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90F\U0001F3FE"), QStringLiteral("pinching hand: medium-dark skin tone"), QStringLiteral("pinching hand: medium-dark skin tone")})},
-{QStringLiteral("pinching hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F90F\U0001F3FF"), QStringLiteral("pinching hand: dark skin tone"), QStringLiteral("pinching hand: dark skin tone")})},
-{QStringLiteral("victory hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270C\U0001F3FB"), QStringLiteral("v_tone1"), QStringLiteral("victory hand: light skin tone")})},
-{QStringLiteral("victory hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270C\U0001F3FC"), QStringLiteral("v_tone2"), QStringLiteral("victory hand: medium-light skin tone")})},
-{QStringLiteral("victory hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270C\U0001F3FD"), QStringLiteral("v_tone3"), QStringLiteral("victory hand: medium skin tone")})},
-{QStringLiteral("victory hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270C\U0001F3FE"), QStringLiteral("v_tone4"), QStringLiteral("victory hand: medium-dark skin tone")})},
-{QStringLiteral("victory hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270C\U0001F3FF"), QStringLiteral("v_tone5"), QStringLiteral("victory hand: dark skin tone")})},
-{QStringLiteral("crossed fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91E\U0001F3FB"), QStringLiteral("fingers_crossed_tone1"), QStringLiteral("crossed fingers: light skin tone")})},
-{QStringLiteral("crossed fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91E\U0001F3FC"), QStringLiteral("fingers_crossed_tone2"), QStringLiteral("crossed fingers: medium-light skin tone")})},
-{QStringLiteral("crossed fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91E\U0001F3FD"), QStringLiteral("fingers_crossed_tone3"), QStringLiteral("crossed fingers: medium skin tone")})},
-{QStringLiteral("crossed fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91E\U0001F3FE"), QStringLiteral("fingers_crossed_tone4"), QStringLiteral("crossed fingers: medium-dark skin tone")})},
-{QStringLiteral("crossed fingers"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91E\U0001F3FF"), QStringLiteral("fingers_crossed_tone5"), QStringLiteral("crossed fingers: dark skin tone")})},
-{QStringLiteral("hand with index finger and thumb crossed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF0\U0001F3FB"), QStringLiteral("hand with index finger and thumb crossed: light skin tone"), QStringLiteral("hand with index finger and thumb crossed: light skin tone")})},
-{QStringLiteral("hand with index finger and thumb crossed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF0\U0001F3FC"), QStringLiteral("hand with index finger and thumb crossed: medium-light skin tone"), QStringLiteral("hand with index finger and thumb crossed: medium-light skin tone")})},
-{QStringLiteral("hand with index finger and thumb crossed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF0\U0001F3FD"), QStringLiteral("hand with index finger and thumb crossed: medium skin tone"), QStringLiteral("hand with index finger and thumb crossed: medium skin tone")})},
-{QStringLiteral("hand with index finger and thumb crossed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF0\U0001F3FE"), QStringLiteral("hand with index finger and thumb crossed: medium-dark skin tone"), QStringLiteral("hand with index finger and thumb crossed: medium-dark skin tone")})},
-{QStringLiteral("hand with index finger and thumb crossed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF0\U0001F3FF"), QStringLiteral("hand with index finger and thumb crossed: dark skin tone"), QStringLiteral("hand with index finger and thumb crossed: dark skin tone")})},
-{QStringLiteral("love-you gesture"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91F\U0001F3FB"), QStringLiteral("love_you_gesture_tone1"), QStringLiteral("love-you gesture: light skin tone")})},
-{QStringLiteral("love-you gesture"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91F\U0001F3FC"), QStringLiteral("love_you_gesture_tone2"), QStringLiteral("love-you gesture: medium-light skin tone")})},
-{QStringLiteral("love-you gesture"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91F\U0001F3FD"), QStringLiteral("love_you_gesture_tone3"), QStringLiteral("love-you gesture: medium skin tone")})},
-{QStringLiteral("love-you gesture"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91F\U0001F3FE"), QStringLiteral("love_you_gesture_tone4"), QStringLiteral("love-you gesture: medium-dark skin tone")})},
-{QStringLiteral("love-you gesture"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91F\U0001F3FF"), QStringLiteral("love_you_gesture_tone5"), QStringLiteral("love-you gesture: dark skin tone")})},
-{QStringLiteral("sign of the horns"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F918\U0001F3FB"), QStringLiteral("metal_tone1"), QStringLiteral("sign of the horns: light skin tone")})},
-{QStringLiteral("sign of the horns"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F918\U0001F3FC"), QStringLiteral("metal_tone2"), QStringLiteral("sign of the horns: medium-light skin tone")})},
-{QStringLiteral("sign of the horns"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F918\U0001F3FD"), QStringLiteral("metal_tone3"), QStringLiteral("sign of the horns: medium skin tone")})},
-{QStringLiteral("sign of the horns"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F918\U0001F3FE"), QStringLiteral("metal_tone4"), QStringLiteral("sign of the horns: medium-dark skin tone")})},
-{QStringLiteral("sign of the horns"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F918\U0001F3FF"), QStringLiteral("metal_tone5"), QStringLiteral("sign of the horns: dark skin tone")})},
-{QStringLiteral("call me hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F919\U0001F3FB"), QStringLiteral("call_me_tone1"), QStringLiteral("call me hand: light skin tone")})},
-{QStringLiteral("call me hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F919\U0001F3FC"), QStringLiteral("call_me_tone2"), QStringLiteral("call me hand: medium-light skin tone")})},
-{QStringLiteral("call me hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F919\U0001F3FD"), QStringLiteral("call_me_tone3"), QStringLiteral("call me hand: medium skin tone")})},
-{QStringLiteral("call me hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F919\U0001F3FE"), QStringLiteral("call_me_tone4"), QStringLiteral("call me hand: medium-dark skin tone")})},
-{QStringLiteral("call me hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F919\U0001F3FF"), QStringLiteral("call_me_tone5"), QStringLiteral("call me hand: dark skin tone")})},
-{QStringLiteral("backhand index pointing left"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F448\U0001F3FB"), QStringLiteral("point_left_tone1"), QStringLiteral("backhand index pointing left: light skin tone")})},
-{QStringLiteral("backhand index pointing left"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F448\U0001F3FC"), QStringLiteral("point_left_tone2"), QStringLiteral("backhand index pointing left: medium-light skin tone")})},
-{QStringLiteral("backhand index pointing left"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F448\U0001F3FD"), QStringLiteral("point_left_tone3"), QStringLiteral("backhand index pointing left: medium skin tone")})},
-{QStringLiteral("backhand index pointing left"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F448\U0001F3FE"), QStringLiteral("point_left_tone4"), QStringLiteral("backhand index pointing left: medium-dark skin tone")})},
-{QStringLiteral("backhand index pointing left"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F448\U0001F3FF"), QStringLiteral("point_left_tone5"), QStringLiteral("backhand index pointing left: dark skin tone")})},
-{QStringLiteral("backhand index pointing right"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F449\U0001F3FB"), QStringLiteral("point_right_tone1"), QStringLiteral("backhand index pointing right: light skin tone")})},
-{QStringLiteral("backhand index pointing right"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F449\U0001F3FC"), QStringLiteral("point_right_tone2"), QStringLiteral("backhand index pointing right: medium-light skin tone")})},
-{QStringLiteral("backhand index pointing right"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F449\U0001F3FD"), QStringLiteral("point_right_tone3"), QStringLiteral("backhand index pointing right: medium skin tone")})},
-{QStringLiteral("backhand index pointing right"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F449\U0001F3FE"), QStringLiteral("point_right_tone4"), QStringLiteral("backhand index pointing right: medium-dark skin tone")})},
-{QStringLiteral("backhand index pointing right"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F449\U0001F3FF"), QStringLiteral("point_right_tone5"), QStringLiteral("backhand index pointing right: dark skin tone")})},
-{QStringLiteral("backhand index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F446\U0001F3FB"), QStringLiteral("point_up_2_tone1"), QStringLiteral("backhand index pointing up: light skin tone")})},
-{QStringLiteral("backhand index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F446\U0001F3FC"), QStringLiteral("point_up_2_tone2"), QStringLiteral("backhand index pointing up: medium-light skin tone")})},
-{QStringLiteral("backhand index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F446\U0001F3FD"), QStringLiteral("point_up_2_tone3"), QStringLiteral("backhand index pointing up: medium skin tone")})},
-{QStringLiteral("backhand index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F446\U0001F3FE"), QStringLiteral("point_up_2_tone4"), QStringLiteral("backhand index pointing up: medium-dark skin tone")})},
-{QStringLiteral("backhand index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F446\U0001F3FF"), QStringLiteral("point_up_2_tone5"), QStringLiteral("backhand index pointing up: dark skin tone")})},
-{QStringLiteral("middle finger"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F595\U0001F3FB"), QStringLiteral("middle_finger_tone1"), QStringLiteral("middle finger: light skin tone")})},
-{QStringLiteral("middle finger"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F595\U0001F3FC"), QStringLiteral("middle_finger_tone2"), QStringLiteral("middle finger: medium-light skin tone")})},
-{QStringLiteral("middle finger"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F595\U0001F3FD"), QStringLiteral("middle_finger_tone3"), QStringLiteral("middle finger: medium skin tone")})},
-{QStringLiteral("middle finger"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F595\U0001F3FE"), QStringLiteral("middle_finger_tone4"), QStringLiteral("middle finger: medium-dark skin tone")})},
-{QStringLiteral("middle finger"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F595\U0001F3FF"), QStringLiteral("middle_finger_tone5"), QStringLiteral("middle finger: dark skin tone")})},
-{QStringLiteral("backhand index pointing down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F447\U0001F3FB"), QStringLiteral("point_down_tone1"), QStringLiteral("backhand index pointing down: light skin tone")})},
-{QStringLiteral("backhand index pointing down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F447\U0001F3FC"), QStringLiteral("point_down_tone2"), QStringLiteral("backhand index pointing down: medium-light skin tone")})},
-{QStringLiteral("backhand index pointing down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F447\U0001F3FD"), QStringLiteral("point_down_tone3"), QStringLiteral("backhand index pointing down: medium skin tone")})},
-{QStringLiteral("backhand index pointing down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F447\U0001F3FE"), QStringLiteral("point_down_tone4"), QStringLiteral("backhand index pointing down: medium-dark skin tone")})},
-{QStringLiteral("backhand index pointing down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F447\U0001F3FF"), QStringLiteral("point_down_tone5"), QStringLiteral("backhand index pointing down: dark skin tone")})},
-{QStringLiteral("index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000261D\U0001F3FB"), QStringLiteral("point_up_tone1"), QStringLiteral("index pointing up: light skin tone")})},
-{QStringLiteral("index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000261D\U0001F3FC"), QStringLiteral("point_up_tone2"), QStringLiteral("index pointing up: medium-light skin tone")})},
-{QStringLiteral("index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000261D\U0001F3FD"), QStringLiteral("point_up_tone3"), QStringLiteral("index pointing up: medium skin tone")})},
-{QStringLiteral("index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000261D\U0001F3FE"), QStringLiteral("point_up_tone4"), QStringLiteral("index pointing up: medium-dark skin tone")})},
-{QStringLiteral("index pointing up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000261D\U0001F3FF"), QStringLiteral("point_up_tone5"), QStringLiteral("index pointing up: dark skin tone")})},
-{QStringLiteral("index pointing at the viewer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF5\U0001F3FB"), QStringLiteral("index pointing at the viewer: light skin tone"), QStringLiteral("index pointing at the viewer: light skin tone")})},
-{QStringLiteral("index pointing at the viewer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF5\U0001F3FC"), QStringLiteral("index pointing at the viewer: medium-light skin tone"), QStringLiteral("index pointing at the viewer: medium-light skin tone")})},
-{QStringLiteral("index pointing at the viewer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF5\U0001F3FD"), QStringLiteral("index pointing at the viewer: medium skin tone"), QStringLiteral("index pointing at the viewer: medium skin tone")})},
-{QStringLiteral("index pointing at the viewer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF5\U0001F3FE"), QStringLiteral("index pointing at the viewer: medium-dark skin tone"), QStringLiteral("index pointing at the viewer: medium-dark skin tone")})},
-{QStringLiteral("index pointing at the viewer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF5\U0001F3FF"), QStringLiteral("index pointing at the viewer: dark skin tone"), QStringLiteral("index pointing at the viewer: dark skin tone")})},
-{QStringLiteral("thumbs up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44D\U0001F3FB"), QStringLiteral("thumbsup_tone1"), QStringLiteral("thumbs up: light skin tone")})},
-{QStringLiteral("thumbs up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44D\U0001F3FC"), QStringLiteral("thumbsup_tone2"), QStringLiteral("thumbs up: medium-light skin tone")})},
-{QStringLiteral("thumbs up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44D\U0001F3FD"), QStringLiteral("thumbsup_tone3"), QStringLiteral("thumbs up: medium skin tone")})},
-{QStringLiteral("thumbs up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44D\U0001F3FE"), QStringLiteral("thumbsup_tone4"), QStringLiteral("thumbs up: medium-dark skin tone")})},
-{QStringLiteral("thumbs up"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44D\U0001F3FF"), QStringLiteral("thumbsup_tone5"), QStringLiteral("thumbs up: dark skin tone")})},
-{QStringLiteral("thumbs down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44E\U0001F3FB"), QStringLiteral("thumbsdown_tone1"), QStringLiteral("thumbs down: light skin tone")})},
-{QStringLiteral("thumbs down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44E\U0001F3FC"), QStringLiteral("thumbsdown_tone2"), QStringLiteral("thumbs down: medium-light skin tone")})},
-{QStringLiteral("thumbs down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44E\U0001F3FD"), QStringLiteral("thumbsdown_tone3"), QStringLiteral("thumbs down: medium skin tone")})},
-{QStringLiteral("thumbs down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44E\U0001F3FE"), QStringLiteral("thumbsdown_tone4"), QStringLiteral("thumbs down: medium-dark skin tone")})},
-{QStringLiteral("thumbs down"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44E\U0001F3FF"), QStringLiteral("thumbsdown_tone5"), QStringLiteral("thumbs down: dark skin tone")})},
-{QStringLiteral("raised fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270A\U0001F3FB"), QStringLiteral("fist_tone1"), QStringLiteral("raised fist: light skin tone")})},
-{QStringLiteral("raised fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270A\U0001F3FC"), QStringLiteral("fist_tone2"), QStringLiteral("raised fist: medium-light skin tone")})},
-{QStringLiteral("raised fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270A\U0001F3FD"), QStringLiteral("fist_tone3"), QStringLiteral("raised fist: medium skin tone")})},
-{QStringLiteral("raised fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270A\U0001F3FE"), QStringLiteral("fist_tone4"), QStringLiteral("raised fist: medium-dark skin tone")})},
-{QStringLiteral("raised fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270A\U0001F3FF"), QStringLiteral("fist_tone5"), QStringLiteral("raised fist: dark skin tone")})},
-{QStringLiteral("oncoming fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44A\U0001F3FB"), QStringLiteral("punch_tone1"), QStringLiteral("oncoming fist: light skin tone")})},
-{QStringLiteral("oncoming fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44A\U0001F3FC"), QStringLiteral("punch_tone2"), QStringLiteral("oncoming fist: medium-light skin tone")})},
-{QStringLiteral("oncoming fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44A\U0001F3FD"), QStringLiteral("punch_tone3"), QStringLiteral("oncoming fist: medium skin tone")})},
-{QStringLiteral("oncoming fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44A\U0001F3FE"), QStringLiteral("punch_tone4"), QStringLiteral("oncoming fist: medium-dark skin tone")})},
-{QStringLiteral("oncoming fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44A\U0001F3FF"), QStringLiteral("punch_tone5"), QStringLiteral("oncoming fist: dark skin tone")})},
-{QStringLiteral("left-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91B\U0001F3FB"), QStringLiteral("left_facing_fist_tone1"), QStringLiteral("left-facing fist: light skin tone")})},
-{QStringLiteral("left-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91B\U0001F3FC"), QStringLiteral("left_facing_fist_tone2"), QStringLiteral("left-facing fist: medium-light skin tone")})},
-{QStringLiteral("left-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91B\U0001F3FD"), QStringLiteral("left_facing_fist_tone3"), QStringLiteral("left-facing fist: medium skin tone")})},
-{QStringLiteral("left-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91B\U0001F3FE"), QStringLiteral("left_facing_fist_tone4"), QStringLiteral("left-facing fist: medium-dark skin tone")})},
-{QStringLiteral("left-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91B\U0001F3FF"), QStringLiteral("left_facing_fist_tone5"), QStringLiteral("left-facing fist: dark skin tone")})},
-{QStringLiteral("right-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91C\U0001F3FB"), QStringLiteral("right_facing_fist_tone1"), QStringLiteral("right-facing fist: light skin tone")})},
-{QStringLiteral("right-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91C\U0001F3FC"), QStringLiteral("right_facing_fist_tone2"), QStringLiteral("right-facing fist: medium-light skin tone")})},
-{QStringLiteral("right-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91C\U0001F3FD"), QStringLiteral("right_facing_fist_tone3"), QStringLiteral("right-facing fist: medium skin tone")})},
-{QStringLiteral("right-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91C\U0001F3FE"), QStringLiteral("right_facing_fist_tone4"), QStringLiteral("right-facing fist: medium-dark skin tone")})},
-{QStringLiteral("right-facing fist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91C\U0001F3FF"), QStringLiteral("right_facing_fist_tone5"), QStringLiteral("right-facing fist: dark skin tone")})},
-{QStringLiteral("clapping hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44F\U0001F3FB"), QStringLiteral("clap_tone1"), QStringLiteral("clapping hands: light skin tone")})},
-{QStringLiteral("clapping hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44F\U0001F3FC"), QStringLiteral("clap_tone2"), QStringLiteral("clapping hands: medium-light skin tone")})},
-{QStringLiteral("clapping hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44F\U0001F3FD"), QStringLiteral("clap_tone3"), QStringLiteral("clapping hands: medium skin tone")})},
-{QStringLiteral("clapping hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44F\U0001F3FE"), QStringLiteral("clap_tone4"), QStringLiteral("clapping hands: medium-dark skin tone")})},
-{QStringLiteral("clapping hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F44F\U0001F3FF"), QStringLiteral("clap_tone5"), QStringLiteral("clapping hands: dark skin tone")})},
-{QStringLiteral("raising hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64C\U0001F3FB"), QStringLiteral("raised_hands_tone1"), QStringLiteral("raising hands: light skin tone")})},
-{QStringLiteral("raising hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64C\U0001F3FC"), QStringLiteral("raised_hands_tone2"), QStringLiteral("raising hands: medium-light skin tone")})},
-{QStringLiteral("raising hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64C\U0001F3FD"), QStringLiteral("raised_hands_tone3"), QStringLiteral("raising hands: medium skin tone")})},
-{QStringLiteral("raising hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64C\U0001F3FE"), QStringLiteral("raised_hands_tone4"), QStringLiteral("raising hands: medium-dark skin tone")})},
-{QStringLiteral("raising hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64C\U0001F3FF"), QStringLiteral("raised_hands_tone5"), QStringLiteral("raising hands: dark skin tone")})},
-{QStringLiteral("heart hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF6\U0001F3FB"), QStringLiteral("heart hands: light skin tone"), QStringLiteral("heart hands: light skin tone")})},
-{QStringLiteral("heart hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF6\U0001F3FC"), QStringLiteral("heart hands: medium-light skin tone"), QStringLiteral("heart hands: medium-light skin tone")})},
-{QStringLiteral("heart hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF6\U0001F3FD"), QStringLiteral("heart hands: medium skin tone"), QStringLiteral("heart hands: medium skin tone")})},
-{QStringLiteral("heart hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF6\U0001F3FE"), QStringLiteral("heart hands: medium-dark skin tone"), QStringLiteral("heart hands: medium-dark skin tone")})},
-{QStringLiteral("heart hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF6\U0001F3FF"), QStringLiteral("heart hands: dark skin tone"), QStringLiteral("heart hands: dark skin tone")})},
-{QStringLiteral("open hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F450\U0001F3FB"), QStringLiteral("open_hands_tone1"), QStringLiteral("open hands: light skin tone")})},
-{QStringLiteral("open hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F450\U0001F3FC"), QStringLiteral("open_hands_tone2"), QStringLiteral("open hands: medium-light skin tone")})},
-{QStringLiteral("open hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F450\U0001F3FD"), QStringLiteral("open_hands_tone3"), QStringLiteral("open hands: medium skin tone")})},
-{QStringLiteral("open hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F450\U0001F3FE"), QStringLiteral("open_hands_tone4"), QStringLiteral("open hands: medium-dark skin tone")})},
-{QStringLiteral("open hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F450\U0001F3FF"), QStringLiteral("open_hands_tone5"), QStringLiteral("open hands: dark skin tone")})},
-{QStringLiteral("palms up together"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F932\U0001F3FB"), QStringLiteral("palms_up_together_tone1"), QStringLiteral("palms up together: light skin tone")})},
-{QStringLiteral("palms up together"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F932\U0001F3FC"), QStringLiteral("palms_up_together_tone2"), QStringLiteral("palms up together: medium-light skin tone")})},
-{QStringLiteral("palms up together"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F932\U0001F3FD"), QStringLiteral("palms_up_together_tone3"), QStringLiteral("palms up together: medium skin tone")})},
-{QStringLiteral("palms up together"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F932\U0001F3FE"), QStringLiteral("palms_up_together_tone4"), QStringLiteral("palms up together: medium-dark skin tone")})},
-{QStringLiteral("palms up together"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F932\U0001F3FF"), QStringLiteral("palms_up_together_tone5"), QStringLiteral("palms up together: dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91D\U0001F3FB"), QStringLiteral("handshake: light skin tone"), QStringLiteral("handshake: light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91D\U0001F3FC"), QStringLiteral("handshake: medium-light skin tone"), QStringLiteral("handshake: medium-light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91D\U0001F3FD"), QStringLiteral("handshake: medium skin tone"), QStringLiteral("handshake: medium skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91D\U0001F3FE"), QStringLiteral("handshake: medium-dark skin tone"), QStringLiteral("handshake: medium-dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F91D\U0001F3FF"), QStringLiteral("handshake: dark skin tone"), QStringLiteral("handshake: dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FB\U0000200D\U0001FAF2\U0001F3FC"), QStringLiteral("handshake: light skin tone, medium-light skin tone"), QStringLiteral("handshake: light skin tone, medium-light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FB\U0000200D\U0001FAF2\U0001F3FD"), QStringLiteral("handshake: light skin tone, medium skin tone"), QStringLiteral("handshake: light skin tone, medium skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FB\U0000200D\U0001FAF2\U0001F3FE"), QStringLiteral("handshake: light skin tone, medium-dark skin tone"), QStringLiteral("handshake: light skin tone, medium-dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FB\U0000200D\U0001FAF2\U0001F3FF"), QStringLiteral("handshake: light skin tone, dark skin tone"), QStringLiteral("handshake: light skin tone, dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FC\U0000200D\U0001FAF2\U0001F3FB"), QStringLiteral("handshake: medium-light skin tone, light skin tone"), QStringLiteral("handshake: medium-light skin tone, light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FC\U0000200D\U0001FAF2\U0001F3FD"), QStringLiteral("handshake: medium-light skin tone, medium skin tone"), QStringLiteral("handshake: medium-light skin tone, medium skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FC\U0000200D\U0001FAF2\U0001F3FE"), QStringLiteral("handshake: medium-light skin tone, medium-dark skin tone"), QStringLiteral("handshake: medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FC\U0000200D\U0001FAF2\U0001F3FF"), QStringLiteral("handshake: medium-light skin tone, dark skin tone"), QStringLiteral("handshake: medium-light skin tone, dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FD\U0000200D\U0001FAF2\U0001F3FB"), QStringLiteral("handshake: medium skin tone, light skin tone"), QStringLiteral("handshake: medium skin tone, light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FD\U0000200D\U0001FAF2\U0001F3FC"), QStringLiteral("handshake: medium skin tone, medium-light skin tone"), QStringLiteral("handshake: medium skin tone, medium-light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FD\U0000200D\U0001FAF2\U0001F3FE"), QStringLiteral("handshake: medium skin tone, medium-dark skin tone"), QStringLiteral("handshake: medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FD\U0000200D\U0001FAF2\U0001F3FF"), QStringLiteral("handshake: medium skin tone, dark skin tone"), QStringLiteral("handshake: medium skin tone, dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FE\U0000200D\U0001FAF2\U0001F3FB"), QStringLiteral("handshake: medium-dark skin tone, light skin tone"), QStringLiteral("handshake: medium-dark skin tone, light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FE\U0000200D\U0001FAF2\U0001F3FC"), QStringLiteral("handshake: medium-dark skin tone, medium-light skin tone"), QStringLiteral("handshake: medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FE\U0000200D\U0001FAF2\U0001F3FD"), QStringLiteral("handshake: medium-dark skin tone, medium skin tone"), QStringLiteral("handshake: medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FE\U0000200D\U0001FAF2\U0001F3FF"), QStringLiteral("handshake: medium-dark skin tone, dark skin tone"), QStringLiteral("handshake: medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FF\U0000200D\U0001FAF2\U0001F3FB"), QStringLiteral("handshake: dark skin tone, light skin tone"), QStringLiteral("handshake: dark skin tone, light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FF\U0000200D\U0001FAF2\U0001F3FC"), QStringLiteral("handshake: dark skin tone, medium-light skin tone"), QStringLiteral("handshake: dark skin tone, medium-light skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FF\U0000200D\U0001FAF2\U0001F3FD"), QStringLiteral("handshake: dark skin tone, medium skin tone"), QStringLiteral("handshake: dark skin tone, medium skin tone")})},
-{QStringLiteral("handshake"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAF1\U0001F3FF\U0000200D\U0001FAF2\U0001F3FE"), QStringLiteral("handshake: dark skin tone, medium-dark skin tone"), QStringLiteral("handshake: dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("folded hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64F\U0001F3FB"), QStringLiteral("pray_tone1"), QStringLiteral("folded hands: light skin tone")})},
-{QStringLiteral("folded hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64F\U0001F3FC"), QStringLiteral("pray_tone2"), QStringLiteral("folded hands: medium-light skin tone")})},
-{QStringLiteral("folded hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64F\U0001F3FD"), QStringLiteral("pray_tone3"), QStringLiteral("folded hands: medium skin tone")})},
-{QStringLiteral("folded hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64F\U0001F3FE"), QStringLiteral("pray_tone4"), QStringLiteral("folded hands: medium-dark skin tone")})},
-{QStringLiteral("folded hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64F\U0001F3FF"), QStringLiteral("pray_tone5"), QStringLiteral("folded hands: dark skin tone")})},
-{QStringLiteral("writing hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270D\U0001F3FB"), QStringLiteral("writing_hand_tone1"), QStringLiteral("writing hand: light skin tone")})},
-{QStringLiteral("writing hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270D\U0001F3FC"), QStringLiteral("writing_hand_tone2"), QStringLiteral("writing hand: medium-light skin tone")})},
-{QStringLiteral("writing hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270D\U0001F3FD"), QStringLiteral("writing_hand_tone3"), QStringLiteral("writing hand: medium skin tone")})},
-{QStringLiteral("writing hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270D\U0001F3FE"), QStringLiteral("writing_hand_tone4"), QStringLiteral("writing hand: medium-dark skin tone")})},
-{QStringLiteral("writing hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0000270D\U0001F3FF"), QStringLiteral("writing_hand_tone5"), QStringLiteral("writing hand: dark skin tone")})},
-{QStringLiteral("nail polish"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F485\U0001F3FB"), QStringLiteral("nail_care_tone1"), QStringLiteral("nail polish: light skin tone")})},
-{QStringLiteral("nail polish"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F485\U0001F3FC"), QStringLiteral("nail_care_tone2"), QStringLiteral("nail polish: medium-light skin tone")})},
-{QStringLiteral("nail polish"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F485\U0001F3FD"), QStringLiteral("nail_care_tone3"), QStringLiteral("nail polish: medium skin tone")})},
-{QStringLiteral("nail polish"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F485\U0001F3FE"), QStringLiteral("nail_care_tone4"), QStringLiteral("nail polish: medium-dark skin tone")})},
-{QStringLiteral("nail polish"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F485\U0001F3FF"), QStringLiteral("nail_care_tone5"), QStringLiteral("nail polish: dark skin tone")})},
-{QStringLiteral("selfie"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F933\U0001F3FB"), QStringLiteral("selfie_tone1"), QStringLiteral("selfie: light skin tone")})},
-{QStringLiteral("selfie"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F933\U0001F3FC"), QStringLiteral("selfie_tone2"), QStringLiteral("selfie: medium-light skin tone")})},
-{QStringLiteral("selfie"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F933\U0001F3FD"), QStringLiteral("selfie_tone3"), QStringLiteral("selfie: medium skin tone")})},
-{QStringLiteral("selfie"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F933\U0001F3FE"), QStringLiteral("selfie_tone4"), QStringLiteral("selfie: medium-dark skin tone")})},
-{QStringLiteral("selfie"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F933\U0001F3FF"), QStringLiteral("selfie_tone5"), QStringLiteral("selfie: dark skin tone")})},
-{QStringLiteral("flexed biceps"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AA\U0001F3FB"), QStringLiteral("muscle_tone1"), QStringLiteral("flexed biceps: light skin tone")})},
-{QStringLiteral("flexed biceps"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AA\U0001F3FC"), QStringLiteral("muscle_tone2"), QStringLiteral("flexed biceps: medium-light skin tone")})},
-{QStringLiteral("flexed biceps"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AA\U0001F3FD"), QStringLiteral("muscle_tone3"), QStringLiteral("flexed biceps: medium skin tone")})},
-{QStringLiteral("flexed biceps"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AA\U0001F3FE"), QStringLiteral("muscle_tone4"), QStringLiteral("flexed biceps: medium-dark skin tone")})},
-{QStringLiteral("flexed biceps"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F4AA\U0001F3FF"), QStringLiteral("muscle_tone5"), QStringLiteral("flexed biceps: dark skin tone")})},
-{QStringLiteral("leg"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B5\U0001F3FB"), QStringLiteral("leg_tone1"), QStringLiteral("leg: light skin tone")})},
-{QStringLiteral("leg"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B5\U0001F3FC"), QStringLiteral("leg_tone2"), QStringLiteral("leg: medium-light skin tone")})},
-{QStringLiteral("leg"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B5\U0001F3FD"), QStringLiteral("leg_tone3"), QStringLiteral("leg: medium skin tone")})},
-{QStringLiteral("leg"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B5\U0001F3FE"), QStringLiteral("leg_tone4"), QStringLiteral("leg: medium-dark skin tone")})},
-{QStringLiteral("leg"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B5\U0001F3FF"), QStringLiteral("leg_tone5"), QStringLiteral("leg: dark skin tone")})},
-{QStringLiteral("foot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B6\U0001F3FB"), QStringLiteral("foot_tone1"), QStringLiteral("foot: light skin tone")})},
-{QStringLiteral("foot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B6\U0001F3FC"), QStringLiteral("foot_tone2"), QStringLiteral("foot: medium-light skin tone")})},
-{QStringLiteral("foot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B6\U0001F3FD"), QStringLiteral("foot_tone3"), QStringLiteral("foot: medium skin tone")})},
-{QStringLiteral("foot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B6\U0001F3FE"), QStringLiteral("foot_tone4"), QStringLiteral("foot: medium-dark skin tone")})},
-{QStringLiteral("foot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B6\U0001F3FF"), QStringLiteral("foot_tone5"), QStringLiteral("foot: dark skin tone")})},
-{QStringLiteral("ear"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F442\U0001F3FB"), QStringLiteral("ear_tone1"), QStringLiteral("ear: light skin tone")})},
-{QStringLiteral("ear"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F442\U0001F3FC"), QStringLiteral("ear_tone2"), QStringLiteral("ear: medium-light skin tone")})},
-{QStringLiteral("ear"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F442\U0001F3FD"), QStringLiteral("ear_tone3"), QStringLiteral("ear: medium skin tone")})},
-{QStringLiteral("ear"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F442\U0001F3FE"), QStringLiteral("ear_tone4"), QStringLiteral("ear: medium-dark skin tone")})},
-{QStringLiteral("ear"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F442\U0001F3FF"), QStringLiteral("ear_tone5"), QStringLiteral("ear: dark skin tone")})},
-{QStringLiteral("ear with hearing aid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BB\U0001F3FB"), QStringLiteral("ear with hearing aid: light skin tone"), QStringLiteral("ear with hearing aid: light skin tone")})},
-{QStringLiteral("ear with hearing aid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BB\U0001F3FC"), QStringLiteral("ear with hearing aid: medium-light skin tone"), QStringLiteral("ear with hearing aid: medium-light skin tone")})},
-{QStringLiteral("ear with hearing aid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BB\U0001F3FD"), QStringLiteral("ear with hearing aid: medium skin tone"), QStringLiteral("ear with hearing aid: medium skin tone")})},
-{QStringLiteral("ear with hearing aid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BB\U0001F3FE"), QStringLiteral("ear with hearing aid: medium-dark skin tone"), QStringLiteral("ear with hearing aid: medium-dark skin tone")})},
-{QStringLiteral("ear with hearing aid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9BB\U0001F3FF"), QStringLiteral("ear with hearing aid: dark skin tone"), QStringLiteral("ear with hearing aid: dark skin tone")})},
-{QStringLiteral("nose"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F443\U0001F3FB"), QStringLiteral("nose_tone1"), QStringLiteral("nose: light skin tone")})},
-{QStringLiteral("nose"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F443\U0001F3FC"), QStringLiteral("nose_tone2"), QStringLiteral("nose: medium-light skin tone")})},
-{QStringLiteral("nose"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F443\U0001F3FD"), QStringLiteral("nose_tone3"), QStringLiteral("nose: medium skin tone")})},
-{QStringLiteral("nose"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F443\U0001F3FE"), QStringLiteral("nose_tone4"), QStringLiteral("nose: medium-dark skin tone")})},
-{QStringLiteral("nose"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F443\U0001F3FF"), QStringLiteral("nose_tone5"), QStringLiteral("nose: dark skin tone")})},
-{QStringLiteral("baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F476\U0001F3FB"), QStringLiteral("baby_tone1"), QStringLiteral("baby: light skin tone")})},
-{QStringLiteral("baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F476\U0001F3FC"), QStringLiteral("baby_tone2"), QStringLiteral("baby: medium-light skin tone")})},
-{QStringLiteral("baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F476\U0001F3FD"), QStringLiteral("baby_tone3"), QStringLiteral("baby: medium skin tone")})},
-{QStringLiteral("baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F476\U0001F3FE"), QStringLiteral("baby_tone4"), QStringLiteral("baby: medium-dark skin tone")})},
-{QStringLiteral("baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F476\U0001F3FF"), QStringLiteral("baby_tone5"), QStringLiteral("baby: dark skin tone")})},
-{QStringLiteral("child"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D2\U0001F3FB"), QStringLiteral("child_tone1"), QStringLiteral("child: light skin tone")})},
-{QStringLiteral("child"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D2\U0001F3FC"), QStringLiteral("child_tone2"), QStringLiteral("child: medium-light skin tone")})},
-{QStringLiteral("child"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D2\U0001F3FD"), QStringLiteral("child_tone3"), QStringLiteral("child: medium skin tone")})},
-{QStringLiteral("child"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D2\U0001F3FE"), QStringLiteral("child_tone4"), QStringLiteral("child: medium-dark skin tone")})},
-{QStringLiteral("child"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D2\U0001F3FF"), QStringLiteral("child_tone5"), QStringLiteral("child: dark skin tone")})},
-{QStringLiteral("boy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F466\U0001F3FB"), QStringLiteral("boy_tone1"), QStringLiteral("boy: light skin tone")})},
-{QStringLiteral("boy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F466\U0001F3FC"), QStringLiteral("boy_tone2"), QStringLiteral("boy: medium-light skin tone")})},
-{QStringLiteral("boy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F466\U0001F3FD"), QStringLiteral("boy_tone3"), QStringLiteral("boy: medium skin tone")})},
-{QStringLiteral("boy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F466\U0001F3FE"), QStringLiteral("boy_tone4"), QStringLiteral("boy: medium-dark skin tone")})},
-{QStringLiteral("boy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F466\U0001F3FF"), QStringLiteral("boy_tone5"), QStringLiteral("boy: dark skin tone")})},
-{QStringLiteral("girl"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F467\U0001F3FB"), QStringLiteral("girl_tone1"), QStringLiteral("girl: light skin tone")})},
-{QStringLiteral("girl"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F467\U0001F3FC"), QStringLiteral("girl_tone2"), QStringLiteral("girl: medium-light skin tone")})},
-{QStringLiteral("girl"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F467\U0001F3FD"), QStringLiteral("girl_tone3"), QStringLiteral("girl: medium skin tone")})},
-{QStringLiteral("girl"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F467\U0001F3FE"), QStringLiteral("girl_tone4"), QStringLiteral("girl: medium-dark skin tone")})},
-{QStringLiteral("girl"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F467\U0001F3FF"), QStringLiteral("girl_tone5"), QStringLiteral("girl: dark skin tone")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB"), QStringLiteral("adult_tone1"), QStringLiteral("person: light skin tone")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC"), QStringLiteral("adult_tone2"), QStringLiteral("person: medium-light skin tone")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD"), QStringLiteral("adult_tone3"), QStringLiteral("person: medium skin tone")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE"), QStringLiteral("adult_tone4"), QStringLiteral("person: medium-dark skin tone")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF"), QStringLiteral("adult_tone5"), QStringLiteral("person: dark skin tone")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FB"), QStringLiteral("person_with_blond_hair_tone1"), QStringLiteral("person: light skin tone, blond hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FC"), QStringLiteral("person_with_blond_hair_tone2"), QStringLiteral("person: medium-light skin tone, blond hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FD"), QStringLiteral("person_with_blond_hair_tone3"), QStringLiteral("person: medium skin tone, blond hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FE"), QStringLiteral("person_with_blond_hair_tone4"), QStringLiteral("person: medium-dark skin tone, blond hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FF"), QStringLiteral("person_with_blond_hair_tone5"), QStringLiteral("person: dark skin tone, blond hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB"), QStringLiteral("man_tone1"), QStringLiteral("man: light skin tone")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC"), QStringLiteral("man_tone2"), QStringLiteral("man: medium-light skin tone")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD"), QStringLiteral("man_tone3"), QStringLiteral("man: medium skin tone")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE"), QStringLiteral("man_tone4"), QStringLiteral("man: medium-dark skin tone")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF"), QStringLiteral("man_tone5"), QStringLiteral("man: dark skin tone")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FB"), QStringLiteral("bearded_person_tone1"), QStringLiteral("person: light skin tone, beard")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FC"), QStringLiteral("bearded_person_tone2"), QStringLiteral("person: medium-light skin tone, beard")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FD"), QStringLiteral("bearded_person_tone3"), QStringLiteral("person: medium skin tone, beard")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FE"), QStringLiteral("bearded_person_tone4"), QStringLiteral("person: medium-dark skin tone, beard")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FF"), QStringLiteral("bearded_person_tone5"), QStringLiteral("person: dark skin tone, beard")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: light skin tone, beard"), QStringLiteral("man: light skin tone, beard")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: medium-light skin tone, beard"), QStringLiteral("man: medium-light skin tone, beard")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: medium skin tone, beard"), QStringLiteral("man: medium skin tone, beard")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: medium-dark skin tone, beard"), QStringLiteral("man: medium-dark skin tone, beard")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: dark skin tone, beard"), QStringLiteral("man: dark skin tone, beard")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: light skin tone, beard"), QStringLiteral("woman: light skin tone, beard")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: medium-light skin tone, beard"), QStringLiteral("woman: medium-light skin tone, beard")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: medium skin tone, beard"), QStringLiteral("woman: medium skin tone, beard")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: medium-dark skin tone, beard"), QStringLiteral("woman: medium-dark skin tone, beard")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D4\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: dark skin tone, beard"), QStringLiteral("woman: dark skin tone, beard")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F9B0"), QStringLiteral("man: light skin tone, red hair"), QStringLiteral("man: light skin tone, red hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F9B0"), QStringLiteral("man: medium-light skin tone, red hair"), QStringLiteral("man: medium-light skin tone, red hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F9B0"), QStringLiteral("man: medium skin tone, red hair"), QStringLiteral("man: medium skin tone, red hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F9B0"), QStringLiteral("man: medium-dark skin tone, red hair"), QStringLiteral("man: medium-dark skin tone, red hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F9B0"), QStringLiteral("man: dark skin tone, red hair"), QStringLiteral("man: dark skin tone, red hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F9B1"), QStringLiteral("man: light skin tone, curly hair"), QStringLiteral("man: light skin tone, curly hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F9B1"), QStringLiteral("man: medium-light skin tone, curly hair"), QStringLiteral("man: medium-light skin tone, curly hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F9B1"), QStringLiteral("man: medium skin tone, curly hair"), QStringLiteral("man: medium skin tone, curly hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F9B1"), QStringLiteral("man: medium-dark skin tone, curly hair"), QStringLiteral("man: medium-dark skin tone, curly hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F9B1"), QStringLiteral("man: dark skin tone, curly hair"), QStringLiteral("man: dark skin tone, curly hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F9B3"), QStringLiteral("man: light skin tone, white hair"), QStringLiteral("man: light skin tone, white hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F9B3"), QStringLiteral("man: medium-light skin tone, white hair"), QStringLiteral("man: medium-light skin tone, white hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F9B3"), QStringLiteral("man: medium skin tone, white hair"), QStringLiteral("man: medium skin tone, white hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F9B3"), QStringLiteral("man: medium-dark skin tone, white hair"), QStringLiteral("man: medium-dark skin tone, white hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F9B3"), QStringLiteral("man: dark skin tone, white hair"), QStringLiteral("man: dark skin tone, white hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F9B2"), QStringLiteral("man: light skin tone, bald"), QStringLiteral("man: light skin tone, bald")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F9B2"), QStringLiteral("man: medium-light skin tone, bald"), QStringLiteral("man: medium-light skin tone, bald")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F9B2"), QStringLiteral("man: medium skin tone, bald"), QStringLiteral("man: medium skin tone, bald")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F9B2"), QStringLiteral("man: medium-dark skin tone, bald"), QStringLiteral("man: medium-dark skin tone, bald")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F9B2"), QStringLiteral("man: dark skin tone, bald"), QStringLiteral("man: dark skin tone, bald")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB"), QStringLiteral("woman_tone1"), QStringLiteral("woman: light skin tone")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC"), QStringLiteral("woman_tone2"), QStringLiteral("woman: medium-light skin tone")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD"), QStringLiteral("woman_tone3"), QStringLiteral("woman: medium skin tone")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE"), QStringLiteral("woman_tone4"), QStringLiteral("woman: medium-dark skin tone")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF"), QStringLiteral("woman_tone5"), QStringLiteral("woman: dark skin tone")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F9B0"), QStringLiteral("woman: light skin tone, red hair"), QStringLiteral("woman: light skin tone, red hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F9B0"), QStringLiteral("woman: medium-light skin tone, red hair"), QStringLiteral("woman: medium-light skin tone, red hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F9B0"), QStringLiteral("woman: medium skin tone, red hair"), QStringLiteral("woman: medium skin tone, red hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F9B0"), QStringLiteral("woman: medium-dark skin tone, red hair"), QStringLiteral("woman: medium-dark skin tone, red hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F9B0"), QStringLiteral("woman: dark skin tone, red hair"), QStringLiteral("woman: dark skin tone, red hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F9B0"), QStringLiteral("person: light skin tone, red hair"), QStringLiteral("person: light skin tone, red hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F9B0"), QStringLiteral("person: medium-light skin tone, red hair"), QStringLiteral("person: medium-light skin tone, red hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F9B0"), QStringLiteral("person: medium skin tone, red hair"), QStringLiteral("person: medium skin tone, red hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F9B0"), QStringLiteral("person: medium-dark skin tone, red hair"), QStringLiteral("person: medium-dark skin tone, red hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F9B0"), QStringLiteral("person: dark skin tone, red hair"), QStringLiteral("person: dark skin tone, red hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F9B1"), QStringLiteral("woman: light skin tone, curly hair"), QStringLiteral("woman: light skin tone, curly hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F9B1"), QStringLiteral("woman: medium-light skin tone, curly hair"), QStringLiteral("woman: medium-light skin tone, curly hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F9B1"), QStringLiteral("woman: medium skin tone, curly hair"), QStringLiteral("woman: medium skin tone, curly hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F9B1"), QStringLiteral("woman: medium-dark skin tone, curly hair"), QStringLiteral("woman: medium-dark skin tone, curly hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F9B1"), QStringLiteral("woman: dark skin tone, curly hair"), QStringLiteral("woman: dark skin tone, curly hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F9B1"), QStringLiteral("person: light skin tone, curly hair"), QStringLiteral("person: light skin tone, curly hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F9B1"), QStringLiteral("person: medium-light skin tone, curly hair"), QStringLiteral("person: medium-light skin tone, curly hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F9B1"), QStringLiteral("person: medium skin tone, curly hair"), QStringLiteral("person: medium skin tone, curly hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F9B1"), QStringLiteral("person: medium-dark skin tone, curly hair"), QStringLiteral("person: medium-dark skin tone, curly hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F9B1"), QStringLiteral("person: dark skin tone, curly hair"), QStringLiteral("person: dark skin tone, curly hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F9B3"), QStringLiteral("woman: light skin tone, white hair"), QStringLiteral("woman: light skin tone, white hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F9B3"), QStringLiteral("woman: medium-light skin tone, white hair"), QStringLiteral("woman: medium-light skin tone, white hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F9B3"), QStringLiteral("woman: medium skin tone, white hair"), QStringLiteral("woman: medium skin tone, white hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F9B3"), QStringLiteral("woman: medium-dark skin tone, white hair"), QStringLiteral("woman: medium-dark skin tone, white hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F9B3"), QStringLiteral("woman: dark skin tone, white hair"), QStringLiteral("woman: dark skin tone, white hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F9B3"), QStringLiteral("person: light skin tone, white hair"), QStringLiteral("person: light skin tone, white hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F9B3"), QStringLiteral("person: medium-light skin tone, white hair"), QStringLiteral("person: medium-light skin tone, white hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F9B3"), QStringLiteral("person: medium skin tone, white hair"), QStringLiteral("person: medium skin tone, white hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F9B3"), QStringLiteral("person: medium-dark skin tone, white hair"), QStringLiteral("person: medium-dark skin tone, white hair")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F9B3"), QStringLiteral("person: dark skin tone, white hair"), QStringLiteral("person: dark skin tone, white hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F9B2"), QStringLiteral("woman: light skin tone, bald"), QStringLiteral("woman: light skin tone, bald")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F9B2"), QStringLiteral("woman: medium-light skin tone, bald"), QStringLiteral("woman: medium-light skin tone, bald")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F9B2"), QStringLiteral("woman: medium skin tone, bald"), QStringLiteral("woman: medium skin tone, bald")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F9B2"), QStringLiteral("woman: medium-dark skin tone, bald"), QStringLiteral("woman: medium-dark skin tone, bald")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F9B2"), QStringLiteral("woman: dark skin tone, bald"), QStringLiteral("woman: dark skin tone, bald")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F9B2"), QStringLiteral("person: light skin tone, bald"), QStringLiteral("person: light skin tone, bald")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F9B2"), QStringLiteral("person: medium-light skin tone, bald"), QStringLiteral("person: medium-light skin tone, bald")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F9B2"), QStringLiteral("person: medium skin tone, bald"), QStringLiteral("person: medium skin tone, bald")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F9B2"), QStringLiteral("person: medium-dark skin tone, bald"), QStringLiteral("person: medium-dark skin tone, bald")})},
-{QStringLiteral("person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F9B2"), QStringLiteral("person: dark skin tone, bald"), QStringLiteral("person: dark skin tone, bald")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: light skin tone, blond hair"), QStringLiteral("woman: light skin tone, blond hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: medium-light skin tone, blond hair"), QStringLiteral("woman: medium-light skin tone, blond hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: medium skin tone, blond hair"), QStringLiteral("woman: medium skin tone, blond hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: medium-dark skin tone, blond hair"), QStringLiteral("woman: medium-dark skin tone, blond hair")})},
-{QStringLiteral("woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman: dark skin tone, blond hair"), QStringLiteral("woman: dark skin tone, blond hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: light skin tone, blond hair"), QStringLiteral("man: light skin tone, blond hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: medium-light skin tone, blond hair"), QStringLiteral("man: medium-light skin tone, blond hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: medium skin tone, blond hair"), QStringLiteral("man: medium skin tone, blond hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: medium-dark skin tone, blond hair"), QStringLiteral("man: medium-dark skin tone, blond hair")})},
-{QStringLiteral("man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F471\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man: dark skin tone, blond hair"), QStringLiteral("man: dark skin tone, blond hair")})},
-{QStringLiteral("older person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D3\U0001F3FB"), QStringLiteral("older_adult_tone1"), QStringLiteral("older person: light skin tone")})},
-{QStringLiteral("older person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D3\U0001F3FC"), QStringLiteral("older_adult_tone2"), QStringLiteral("older person: medium-light skin tone")})},
-{QStringLiteral("older person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D3\U0001F3FD"), QStringLiteral("older_adult_tone3"), QStringLiteral("older person: medium skin tone")})},
-{QStringLiteral("older person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D3\U0001F3FE"), QStringLiteral("older_adult_tone4"), QStringLiteral("older person: medium-dark skin tone")})},
-{QStringLiteral("older person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D3\U0001F3FF"), QStringLiteral("older_adult_tone5"), QStringLiteral("older person: dark skin tone")})},
-{QStringLiteral("old man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F474\U0001F3FB"), QStringLiteral("older_man_tone1"), QStringLiteral("old man: light skin tone")})},
-{QStringLiteral("old man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F474\U0001F3FC"), QStringLiteral("older_man_tone2"), QStringLiteral("old man: medium-light skin tone")})},
-{QStringLiteral("old man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F474\U0001F3FD"), QStringLiteral("older_man_tone3"), QStringLiteral("old man: medium skin tone")})},
-{QStringLiteral("old man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F474\U0001F3FE"), QStringLiteral("older_man_tone4"), QStringLiteral("old man: medium-dark skin tone")})},
-{QStringLiteral("old man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F474\U0001F3FF"), QStringLiteral("older_man_tone5"), QStringLiteral("old man: dark skin tone")})},
-{QStringLiteral("old woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F475\U0001F3FB"), QStringLiteral("older_woman_tone1"), QStringLiteral("old woman: light skin tone")})},
-{QStringLiteral("old woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F475\U0001F3FC"), QStringLiteral("older_woman_tone2"), QStringLiteral("old woman: medium-light skin tone")})},
-{QStringLiteral("old woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F475\U0001F3FD"), QStringLiteral("older_woman_tone3"), QStringLiteral("old woman: medium skin tone")})},
-{QStringLiteral("old woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F475\U0001F3FE"), QStringLiteral("older_woman_tone4"), QStringLiteral("old woman: medium-dark skin tone")})},
-{QStringLiteral("old woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F475\U0001F3FF"), QStringLiteral("older_woman_tone5"), QStringLiteral("old woman: dark skin tone")})},
-{QStringLiteral("person frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FB"), QStringLiteral("person_frowning_tone1"), QStringLiteral("person frowning: light skin tone")})},
-{QStringLiteral("person frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FC"), QStringLiteral("person_frowning_tone2"), QStringLiteral("person frowning: medium-light skin tone")})},
-{QStringLiteral("person frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FD"), QStringLiteral("person_frowning_tone3"), QStringLiteral("person frowning: medium skin tone")})},
-{QStringLiteral("person frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FE"), QStringLiteral("person_frowning_tone4"), QStringLiteral("person frowning: medium-dark skin tone")})},
-{QStringLiteral("person frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FF"), QStringLiteral("person_frowning_tone5"), QStringLiteral("person frowning: dark skin tone")})},
-{QStringLiteral("man frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man frowning: light skin tone"), QStringLiteral("man frowning: light skin tone")})},
-{QStringLiteral("man frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man frowning: medium-light skin tone"), QStringLiteral("man frowning: medium-light skin tone")})},
-{QStringLiteral("man frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man frowning: medium skin tone"), QStringLiteral("man frowning: medium skin tone")})},
-{QStringLiteral("man frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man frowning: medium-dark skin tone"), QStringLiteral("man frowning: medium-dark skin tone")})},
-{QStringLiteral("man frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man frowning: dark skin tone"), QStringLiteral("man frowning: dark skin tone")})},
-{QStringLiteral("woman frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman frowning: light skin tone"), QStringLiteral("woman frowning: light skin tone")})},
-{QStringLiteral("woman frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman frowning: medium-light skin tone"), QStringLiteral("woman frowning: medium-light skin tone")})},
-{QStringLiteral("woman frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman frowning: medium skin tone"), QStringLiteral("woman frowning: medium skin tone")})},
-{QStringLiteral("woman frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman frowning: medium-dark skin tone"), QStringLiteral("woman frowning: medium-dark skin tone")})},
-{QStringLiteral("woman frowning"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64D\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman frowning: dark skin tone"), QStringLiteral("woman frowning: dark skin tone")})},
-{QStringLiteral("person pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FB"), QStringLiteral("person_with_pouting_face_tone1"), QStringLiteral("person pouting: light skin tone")})},
-{QStringLiteral("person pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FC"), QStringLiteral("person_with_pouting_face_tone2"), QStringLiteral("person pouting: medium-light skin tone")})},
-{QStringLiteral("person pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FD"), QStringLiteral("person_with_pouting_face_tone3"), QStringLiteral("person pouting: medium skin tone")})},
-{QStringLiteral("person pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FE"), QStringLiteral("person_with_pouting_face_tone4"), QStringLiteral("person pouting: medium-dark skin tone")})},
-{QStringLiteral("person pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FF"), QStringLiteral("person_with_pouting_face_tone5"), QStringLiteral("person pouting: dark skin tone")})},
-{QStringLiteral("man pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man pouting: light skin tone"), QStringLiteral("man pouting: light skin tone")})},
-{QStringLiteral("man pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man pouting: medium-light skin tone"), QStringLiteral("man pouting: medium-light skin tone")})},
-{QStringLiteral("man pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man pouting: medium skin tone"), QStringLiteral("man pouting: medium skin tone")})},
-{QStringLiteral("man pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man pouting: medium-dark skin tone"), QStringLiteral("man pouting: medium-dark skin tone")})},
-{QStringLiteral("man pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man pouting: dark skin tone"), QStringLiteral("man pouting: dark skin tone")})},
-{QStringLiteral("woman pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman pouting: light skin tone"), QStringLiteral("woman pouting: light skin tone")})},
-{QStringLiteral("woman pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman pouting: medium-light skin tone"), QStringLiteral("woman pouting: medium-light skin tone")})},
-{QStringLiteral("woman pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman pouting: medium skin tone"), QStringLiteral("woman pouting: medium skin tone")})},
-{QStringLiteral("woman pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman pouting: medium-dark skin tone"), QStringLiteral("woman pouting: medium-dark skin tone")})},
-{QStringLiteral("woman pouting"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64E\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman pouting: dark skin tone"), QStringLiteral("woman pouting: dark skin tone")})},
-{QStringLiteral("person gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FB"), QStringLiteral("no_good_tone1"), QStringLiteral("person gesturing NO: light skin tone")})},
-{QStringLiteral("person gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FC"), QStringLiteral("no_good_tone2"), QStringLiteral("person gesturing NO: medium-light skin tone")})},
-{QStringLiteral("person gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FD"), QStringLiteral("no_good_tone3"), QStringLiteral("person gesturing NO: medium skin tone")})},
-{QStringLiteral("person gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FE"), QStringLiteral("no_good_tone4"), QStringLiteral("person gesturing NO: medium-dark skin tone")})},
-{QStringLiteral("person gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FF"), QStringLiteral("no_good_tone5"), QStringLiteral("person gesturing NO: dark skin tone")})},
-{QStringLiteral("man gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing NO: light skin tone"), QStringLiteral("man gesturing NO: light skin tone")})},
-{QStringLiteral("man gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing NO: medium-light skin tone"), QStringLiteral("man gesturing NO: medium-light skin tone")})},
-{QStringLiteral("man gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing NO: medium skin tone"), QStringLiteral("man gesturing NO: medium skin tone")})},
-{QStringLiteral("man gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing NO: medium-dark skin tone"), QStringLiteral("man gesturing NO: medium-dark skin tone")})},
-{QStringLiteral("man gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing NO: dark skin tone"), QStringLiteral("man gesturing NO: dark skin tone")})},
-{QStringLiteral("woman gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing NO: light skin tone"), QStringLiteral("woman gesturing NO: light skin tone")})},
-{QStringLiteral("woman gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing NO: medium-light skin tone"), QStringLiteral("woman gesturing NO: medium-light skin tone")})},
-{QStringLiteral("woman gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing NO: medium skin tone"), QStringLiteral("woman gesturing NO: medium skin tone")})},
-{QStringLiteral("woman gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing NO: medium-dark skin tone"), QStringLiteral("woman gesturing NO: medium-dark skin tone")})},
-{QStringLiteral("woman gesturing NO"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F645\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing NO: dark skin tone"), QStringLiteral("woman gesturing NO: dark skin tone")})},
-{QStringLiteral("person gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FB"), QStringLiteral("ok_woman_tone1"), QStringLiteral("person gesturing OK: light skin tone")})},
-{QStringLiteral("person gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FC"), QStringLiteral("ok_woman_tone2"), QStringLiteral("person gesturing OK: medium-light skin tone")})},
-{QStringLiteral("person gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FD"), QStringLiteral("ok_woman_tone3"), QStringLiteral("person gesturing OK: medium skin tone")})},
-{QStringLiteral("person gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FE"), QStringLiteral("ok_woman_tone4"), QStringLiteral("person gesturing OK: medium-dark skin tone")})},
-{QStringLiteral("person gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FF"), QStringLiteral("ok_woman_tone5"), QStringLiteral("person gesturing OK: dark skin tone")})},
-{QStringLiteral("man gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing OK: light skin tone"), QStringLiteral("man gesturing OK: light skin tone")})},
-{QStringLiteral("man gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing OK: medium-light skin tone"), QStringLiteral("man gesturing OK: medium-light skin tone")})},
-{QStringLiteral("man gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing OK: medium skin tone"), QStringLiteral("man gesturing OK: medium skin tone")})},
-{QStringLiteral("man gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing OK: medium-dark skin tone"), QStringLiteral("man gesturing OK: medium-dark skin tone")})},
-{QStringLiteral("man gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man gesturing OK: dark skin tone"), QStringLiteral("man gesturing OK: dark skin tone")})},
-{QStringLiteral("woman gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing OK: light skin tone"), QStringLiteral("woman gesturing OK: light skin tone")})},
-{QStringLiteral("woman gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing OK: medium-light skin tone"), QStringLiteral("woman gesturing OK: medium-light skin tone")})},
-{QStringLiteral("woman gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing OK: medium skin tone"), QStringLiteral("woman gesturing OK: medium skin tone")})},
-{QStringLiteral("woman gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing OK: medium-dark skin tone"), QStringLiteral("woman gesturing OK: medium-dark skin tone")})},
-{QStringLiteral("woman gesturing OK"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F646\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman gesturing OK: dark skin tone"), QStringLiteral("woman gesturing OK: dark skin tone")})},
-{QStringLiteral("person tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FB"), QStringLiteral("information_desk_person_tone1"), QStringLiteral("person tipping hand: light skin tone")})},
-{QStringLiteral("person tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FC"), QStringLiteral("information_desk_person_tone2"), QStringLiteral("person tipping hand: medium-light skin tone")})},
-{QStringLiteral("person tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FD"), QStringLiteral("information_desk_person_tone3"), QStringLiteral("person tipping hand: medium skin tone")})},
-{QStringLiteral("person tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FE"), QStringLiteral("information_desk_person_tone4"), QStringLiteral("person tipping hand: medium-dark skin tone")})},
-{QStringLiteral("person tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FF"), QStringLiteral("information_desk_person_tone5"), QStringLiteral("person tipping hand: dark skin tone")})},
-{QStringLiteral("man tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man tipping hand: light skin tone"), QStringLiteral("man tipping hand: light skin tone")})},
-{QStringLiteral("man tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man tipping hand: medium-light skin tone"), QStringLiteral("man tipping hand: medium-light skin tone")})},
-{QStringLiteral("man tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man tipping hand: medium skin tone"), QStringLiteral("man tipping hand: medium skin tone")})},
-{QStringLiteral("man tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man tipping hand: medium-dark skin tone"), QStringLiteral("man tipping hand: medium-dark skin tone")})},
-{QStringLiteral("man tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man tipping hand: dark skin tone"), QStringLiteral("man tipping hand: dark skin tone")})},
-{QStringLiteral("woman tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman tipping hand: light skin tone"), QStringLiteral("woman tipping hand: light skin tone")})},
-{QStringLiteral("woman tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman tipping hand: medium-light skin tone"), QStringLiteral("woman tipping hand: medium-light skin tone")})},
-{QStringLiteral("woman tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman tipping hand: medium skin tone"), QStringLiteral("woman tipping hand: medium skin tone")})},
-{QStringLiteral("woman tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman tipping hand: medium-dark skin tone"), QStringLiteral("woman tipping hand: medium-dark skin tone")})},
-{QStringLiteral("woman tipping hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F481\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman tipping hand: dark skin tone"), QStringLiteral("woman tipping hand: dark skin tone")})},
-{QStringLiteral("person raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FB"), QStringLiteral("raising_hand_tone1"), QStringLiteral("person raising hand: light skin tone")})},
-{QStringLiteral("person raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FC"), QStringLiteral("raising_hand_tone2"), QStringLiteral("person raising hand: medium-light skin tone")})},
-{QStringLiteral("person raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FD"), QStringLiteral("raising_hand_tone3"), QStringLiteral("person raising hand: medium skin tone")})},
-{QStringLiteral("person raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FE"), QStringLiteral("raising_hand_tone4"), QStringLiteral("person raising hand: medium-dark skin tone")})},
-{QStringLiteral("person raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FF"), QStringLiteral("raising_hand_tone5"), QStringLiteral("person raising hand: dark skin tone")})},
-{QStringLiteral("man raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man raising hand: light skin tone"), QStringLiteral("man raising hand: light skin tone")})},
-{QStringLiteral("man raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man raising hand: medium-light skin tone"), QStringLiteral("man raising hand: medium-light skin tone")})},
-{QStringLiteral("man raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man raising hand: medium skin tone"), QStringLiteral("man raising hand: medium skin tone")})},
-{QStringLiteral("man raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man raising hand: medium-dark skin tone"), QStringLiteral("man raising hand: medium-dark skin tone")})},
-{QStringLiteral("man raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man raising hand: dark skin tone"), QStringLiteral("man raising hand: dark skin tone")})},
-{QStringLiteral("woman raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman raising hand: light skin tone"), QStringLiteral("woman raising hand: light skin tone")})},
-{QStringLiteral("woman raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman raising hand: medium-light skin tone"), QStringLiteral("woman raising hand: medium-light skin tone")})},
-{QStringLiteral("woman raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman raising hand: medium skin tone"), QStringLiteral("woman raising hand: medium skin tone")})},
-{QStringLiteral("woman raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman raising hand: medium-dark skin tone"), QStringLiteral("woman raising hand: medium-dark skin tone")})},
-{QStringLiteral("woman raising hand"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F64B\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman raising hand: dark skin tone"), QStringLiteral("woman raising hand: dark skin tone")})},
-{QStringLiteral("deaf person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FB"), QStringLiteral("deaf person: light skin tone"), QStringLiteral("deaf person: light skin tone")})},
-{QStringLiteral("deaf person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FC"), QStringLiteral("deaf person: medium-light skin tone"), QStringLiteral("deaf person: medium-light skin tone")})},
-{QStringLiteral("deaf person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FD"), QStringLiteral("deaf person: medium skin tone"), QStringLiteral("deaf person: medium skin tone")})},
-{QStringLiteral("deaf person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FE"), QStringLiteral("deaf person: medium-dark skin tone"), QStringLiteral("deaf person: medium-dark skin tone")})},
-{QStringLiteral("deaf person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FF"), QStringLiteral("deaf person: dark skin tone"), QStringLiteral("deaf person: dark skin tone")})},
-{QStringLiteral("deaf man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("deaf man: light skin tone"), QStringLiteral("deaf man: light skin tone")})},
-{QStringLiteral("deaf man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("deaf man: medium-light skin tone"), QStringLiteral("deaf man: medium-light skin tone")})},
-{QStringLiteral("deaf man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("deaf man: medium skin tone"), QStringLiteral("deaf man: medium skin tone")})},
-{QStringLiteral("deaf man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("deaf man: medium-dark skin tone"), QStringLiteral("deaf man: medium-dark skin tone")})},
-{QStringLiteral("deaf man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("deaf man: dark skin tone"), QStringLiteral("deaf man: dark skin tone")})},
-{QStringLiteral("deaf woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("deaf woman: light skin tone"), QStringLiteral("deaf woman: light skin tone")})},
-{QStringLiteral("deaf woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("deaf woman: medium-light skin tone"), QStringLiteral("deaf woman: medium-light skin tone")})},
-{QStringLiteral("deaf woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("deaf woman: medium skin tone"), QStringLiteral("deaf woman: medium skin tone")})},
-{QStringLiteral("deaf woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("deaf woman: medium-dark skin tone"), QStringLiteral("deaf woman: medium-dark skin tone")})},
-{QStringLiteral("deaf woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CF\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("deaf woman: dark skin tone"), QStringLiteral("deaf woman: dark skin tone")})},
-{QStringLiteral("person bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FB"), QStringLiteral("bow_tone1"), QStringLiteral("person bowing: light skin tone")})},
-{QStringLiteral("person bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FC"), QStringLiteral("bow_tone2"), QStringLiteral("person bowing: medium-light skin tone")})},
-{QStringLiteral("person bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FD"), QStringLiteral("bow_tone3"), QStringLiteral("person bowing: medium skin tone")})},
-{QStringLiteral("person bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FE"), QStringLiteral("bow_tone4"), QStringLiteral("person bowing: medium-dark skin tone")})},
-{QStringLiteral("person bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FF"), QStringLiteral("bow_tone5"), QStringLiteral("person bowing: dark skin tone")})},
-{QStringLiteral("man bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bowing: light skin tone"), QStringLiteral("man bowing: light skin tone")})},
-{QStringLiteral("man bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bowing: medium-light skin tone"), QStringLiteral("man bowing: medium-light skin tone")})},
-{QStringLiteral("man bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bowing: medium skin tone"), QStringLiteral("man bowing: medium skin tone")})},
-{QStringLiteral("man bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bowing: medium-dark skin tone"), QStringLiteral("man bowing: medium-dark skin tone")})},
-{QStringLiteral("man bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bowing: dark skin tone"), QStringLiteral("man bowing: dark skin tone")})},
-{QStringLiteral("woman bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bowing: light skin tone"), QStringLiteral("woman bowing: light skin tone")})},
-{QStringLiteral("woman bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bowing: medium-light skin tone"), QStringLiteral("woman bowing: medium-light skin tone")})},
-{QStringLiteral("woman bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bowing: medium skin tone"), QStringLiteral("woman bowing: medium skin tone")})},
-{QStringLiteral("woman bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bowing: medium-dark skin tone"), QStringLiteral("woman bowing: medium-dark skin tone")})},
-{QStringLiteral("woman bowing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F647\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bowing: dark skin tone"), QStringLiteral("woman bowing: dark skin tone")})},
-{QStringLiteral("person facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FB"), QStringLiteral("face_palm_tone1"), QStringLiteral("person facepalming: light skin tone")})},
-{QStringLiteral("person facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FC"), QStringLiteral("face_palm_tone2"), QStringLiteral("person facepalming: medium-light skin tone")})},
-{QStringLiteral("person facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FD"), QStringLiteral("face_palm_tone3"), QStringLiteral("person facepalming: medium skin tone")})},
-{QStringLiteral("person facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FE"), QStringLiteral("face_palm_tone4"), QStringLiteral("person facepalming: medium-dark skin tone")})},
-{QStringLiteral("person facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FF"), QStringLiteral("face_palm_tone5"), QStringLiteral("person facepalming: dark skin tone")})},
-{QStringLiteral("man facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man facepalming: light skin tone"), QStringLiteral("man facepalming: light skin tone")})},
-{QStringLiteral("man facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man facepalming: medium-light skin tone"), QStringLiteral("man facepalming: medium-light skin tone")})},
-{QStringLiteral("man facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man facepalming: medium skin tone"), QStringLiteral("man facepalming: medium skin tone")})},
-{QStringLiteral("man facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man facepalming: medium-dark skin tone"), QStringLiteral("man facepalming: medium-dark skin tone")})},
-{QStringLiteral("man facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man facepalming: dark skin tone"), QStringLiteral("man facepalming: dark skin tone")})},
-{QStringLiteral("woman facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman facepalming: light skin tone"), QStringLiteral("woman facepalming: light skin tone")})},
-{QStringLiteral("woman facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman facepalming: medium-light skin tone"), QStringLiteral("woman facepalming: medium-light skin tone")})},
-{QStringLiteral("woman facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman facepalming: medium skin tone"), QStringLiteral("woman facepalming: medium skin tone")})},
-{QStringLiteral("woman facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman facepalming: medium-dark skin tone"), QStringLiteral("woman facepalming: medium-dark skin tone")})},
-{QStringLiteral("woman facepalming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F926\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman facepalming: dark skin tone"), QStringLiteral("woman facepalming: dark skin tone")})},
-{QStringLiteral("person shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FB"), QStringLiteral("shrug_tone1"), QStringLiteral("person shrugging: light skin tone")})},
-{QStringLiteral("person shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FC"), QStringLiteral("shrug_tone2"), QStringLiteral("person shrugging: medium-light skin tone")})},
-{QStringLiteral("person shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FD"), QStringLiteral("shrug_tone3"), QStringLiteral("person shrugging: medium skin tone")})},
-{QStringLiteral("person shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FE"), QStringLiteral("shrug_tone4"), QStringLiteral("person shrugging: medium-dark skin tone")})},
-{QStringLiteral("person shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FF"), QStringLiteral("shrug_tone5"), QStringLiteral("person shrugging: dark skin tone")})},
-{QStringLiteral("man shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man shrugging: light skin tone"), QStringLiteral("man shrugging: light skin tone")})},
-{QStringLiteral("man shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man shrugging: medium-light skin tone"), QStringLiteral("man shrugging: medium-light skin tone")})},
-{QStringLiteral("man shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man shrugging: medium skin tone"), QStringLiteral("man shrugging: medium skin tone")})},
-{QStringLiteral("man shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man shrugging: medium-dark skin tone"), QStringLiteral("man shrugging: medium-dark skin tone")})},
-{QStringLiteral("man shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man shrugging: dark skin tone"), QStringLiteral("man shrugging: dark skin tone")})},
-{QStringLiteral("woman shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman shrugging: light skin tone"), QStringLiteral("woman shrugging: light skin tone")})},
-{QStringLiteral("woman shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman shrugging: medium-light skin tone"), QStringLiteral("woman shrugging: medium-light skin tone")})},
-{QStringLiteral("woman shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman shrugging: medium skin tone"), QStringLiteral("woman shrugging: medium skin tone")})},
-{QStringLiteral("woman shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman shrugging: medium-dark skin tone"), QStringLiteral("woman shrugging: medium-dark skin tone")})},
-{QStringLiteral("woman shrugging"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F937\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman shrugging: dark skin tone"), QStringLiteral("woman shrugging: dark skin tone")})},
-{QStringLiteral("health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002695\U0000FE0F"), QStringLiteral("health worker: light skin tone"), QStringLiteral("health worker: light skin tone")})},
-{QStringLiteral("health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002695\U0000FE0F"), QStringLiteral("health worker: medium-light skin tone"), QStringLiteral("health worker: medium-light skin tone")})},
-{QStringLiteral("health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002695\U0000FE0F"), QStringLiteral("health worker: medium skin tone"), QStringLiteral("health worker: medium skin tone")})},
-{QStringLiteral("health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002695\U0000FE0F"), QStringLiteral("health worker: medium-dark skin tone"), QStringLiteral("health worker: medium-dark skin tone")})},
-{QStringLiteral("health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002695\U0000FE0F"), QStringLiteral("health worker: dark skin tone"), QStringLiteral("health worker: dark skin tone")})},
-{QStringLiteral("man health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002695\U0000FE0F"), QStringLiteral("man health worker: light skin tone"), QStringLiteral("man health worker: light skin tone")})},
-{QStringLiteral("man health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002695\U0000FE0F"), QStringLiteral("man health worker: medium-light skin tone"), QStringLiteral("man health worker: medium-light skin tone")})},
-{QStringLiteral("man health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002695\U0000FE0F"), QStringLiteral("man health worker: medium skin tone"), QStringLiteral("man health worker: medium skin tone")})},
-{QStringLiteral("man health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002695\U0000FE0F"), QStringLiteral("man health worker: medium-dark skin tone"), QStringLiteral("man health worker: medium-dark skin tone")})},
-{QStringLiteral("man health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002695\U0000FE0F"), QStringLiteral("man health worker: dark skin tone"), QStringLiteral("man health worker: dark skin tone")})},
-{QStringLiteral("woman health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002695\U0000FE0F"), QStringLiteral("woman health worker: light skin tone"), QStringLiteral("woman health worker: light skin tone")})},
-{QStringLiteral("woman health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002695\U0000FE0F"), QStringLiteral("woman health worker: medium-light skin tone"), QStringLiteral("woman health worker: medium-light skin tone")})},
-{QStringLiteral("woman health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002695\U0000FE0F"), QStringLiteral("woman health worker: medium skin tone"), QStringLiteral("woman health worker: medium skin tone")})},
-{QStringLiteral("woman health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002695\U0000FE0F"), QStringLiteral("woman health worker: medium-dark skin tone"), QStringLiteral("woman health worker: medium-dark skin tone")})},
-{QStringLiteral("woman health worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002695\U0000FE0F"), QStringLiteral("woman health worker: dark skin tone"), QStringLiteral("woman health worker: dark skin tone")})},
-{QStringLiteral("student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F393"), QStringLiteral("student: light skin tone"), QStringLiteral("student: light skin tone")})},
-{QStringLiteral("student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F393"), QStringLiteral("student: medium-light skin tone"), QStringLiteral("student: medium-light skin tone")})},
-{QStringLiteral("student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F393"), QStringLiteral("student: medium skin tone"), QStringLiteral("student: medium skin tone")})},
-{QStringLiteral("student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F393"), QStringLiteral("student: medium-dark skin tone"), QStringLiteral("student: medium-dark skin tone")})},
-{QStringLiteral("student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F393"), QStringLiteral("student: dark skin tone"), QStringLiteral("student: dark skin tone")})},
-{QStringLiteral("man student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F393"), QStringLiteral("man student: light skin tone"), QStringLiteral("man student: light skin tone")})},
-{QStringLiteral("man student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F393"), QStringLiteral("man student: medium-light skin tone"), QStringLiteral("man student: medium-light skin tone")})},
-{QStringLiteral("man student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F393"), QStringLiteral("man student: medium skin tone"), QStringLiteral("man student: medium skin tone")})},
-{QStringLiteral("man student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F393"), QStringLiteral("man student: medium-dark skin tone"), QStringLiteral("man student: medium-dark skin tone")})},
-{QStringLiteral("man student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F393"), QStringLiteral("man student: dark skin tone"), QStringLiteral("man student: dark skin tone")})},
-{QStringLiteral("woman student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F393"), QStringLiteral("woman student: light skin tone"), QStringLiteral("woman student: light skin tone")})},
-{QStringLiteral("woman student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F393"), QStringLiteral("woman student: medium-light skin tone"), QStringLiteral("woman student: medium-light skin tone")})},
-{QStringLiteral("woman student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F393"), QStringLiteral("woman student: medium skin tone"), QStringLiteral("woman student: medium skin tone")})},
-{QStringLiteral("woman student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F393"), QStringLiteral("woman student: medium-dark skin tone"), QStringLiteral("woman student: medium-dark skin tone")})},
-{QStringLiteral("woman student"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F393"), QStringLiteral("woman student: dark skin tone"), QStringLiteral("woman student: dark skin tone")})},
-{QStringLiteral("teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F3EB"), QStringLiteral("teacher: light skin tone"), QStringLiteral("teacher: light skin tone")})},
-{QStringLiteral("teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F3EB"), QStringLiteral("teacher: medium-light skin tone"), QStringLiteral("teacher: medium-light skin tone")})},
-{QStringLiteral("teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F3EB"), QStringLiteral("teacher: medium skin tone"), QStringLiteral("teacher: medium skin tone")})},
-{QStringLiteral("teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F3EB"), QStringLiteral("teacher: medium-dark skin tone"), QStringLiteral("teacher: medium-dark skin tone")})},
-{QStringLiteral("teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F3EB"), QStringLiteral("teacher: dark skin tone"), QStringLiteral("teacher: dark skin tone")})},
-{QStringLiteral("man teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F3EB"), QStringLiteral("man teacher: light skin tone"), QStringLiteral("man teacher: light skin tone")})},
-{QStringLiteral("man teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F3EB"), QStringLiteral("man teacher: medium-light skin tone"), QStringLiteral("man teacher: medium-light skin tone")})},
-{QStringLiteral("man teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F3EB"), QStringLiteral("man teacher: medium skin tone"), QStringLiteral("man teacher: medium skin tone")})},
-{QStringLiteral("man teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F3EB"), QStringLiteral("man teacher: medium-dark skin tone"), QStringLiteral("man teacher: medium-dark skin tone")})},
-{QStringLiteral("man teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F3EB"), QStringLiteral("man teacher: dark skin tone"), QStringLiteral("man teacher: dark skin tone")})},
-{QStringLiteral("woman teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F3EB"), QStringLiteral("woman teacher: light skin tone"), QStringLiteral("woman teacher: light skin tone")})},
-{QStringLiteral("woman teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F3EB"), QStringLiteral("woman teacher: medium-light skin tone"), QStringLiteral("woman teacher: medium-light skin tone")})},
-{QStringLiteral("woman teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F3EB"), QStringLiteral("woman teacher: medium skin tone"), QStringLiteral("woman teacher: medium skin tone")})},
-{QStringLiteral("woman teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F3EB"), QStringLiteral("woman teacher: medium-dark skin tone"), QStringLiteral("woman teacher: medium-dark skin tone")})},
-{QStringLiteral("woman teacher"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F3EB"), QStringLiteral("woman teacher: dark skin tone"), QStringLiteral("woman teacher: dark skin tone")})},
-{QStringLiteral("judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002696\U0000FE0F"), QStringLiteral("judge: light skin tone"), QStringLiteral("judge: light skin tone")})},
-{QStringLiteral("judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002696\U0000FE0F"), QStringLiteral("judge: medium-light skin tone"), QStringLiteral("judge: medium-light skin tone")})},
-{QStringLiteral("judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002696\U0000FE0F"), QStringLiteral("judge: medium skin tone"), QStringLiteral("judge: medium skin tone")})},
-{QStringLiteral("judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002696\U0000FE0F"), QStringLiteral("judge: medium-dark skin tone"), QStringLiteral("judge: medium-dark skin tone")})},
-{QStringLiteral("judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002696\U0000FE0F"), QStringLiteral("judge: dark skin tone"), QStringLiteral("judge: dark skin tone")})},
-{QStringLiteral("man judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002696\U0000FE0F"), QStringLiteral("man judge: light skin tone"), QStringLiteral("man judge: light skin tone")})},
-{QStringLiteral("man judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002696\U0000FE0F"), QStringLiteral("man judge: medium-light skin tone"), QStringLiteral("man judge: medium-light skin tone")})},
-{QStringLiteral("man judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002696\U0000FE0F"), QStringLiteral("man judge: medium skin tone"), QStringLiteral("man judge: medium skin tone")})},
-{QStringLiteral("man judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002696\U0000FE0F"), QStringLiteral("man judge: medium-dark skin tone"), QStringLiteral("man judge: medium-dark skin tone")})},
-{QStringLiteral("man judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002696\U0000FE0F"), QStringLiteral("man judge: dark skin tone"), QStringLiteral("man judge: dark skin tone")})},
-{QStringLiteral("woman judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002696\U0000FE0F"), QStringLiteral("woman judge: light skin tone"), QStringLiteral("woman judge: light skin tone")})},
-{QStringLiteral("woman judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002696\U0000FE0F"), QStringLiteral("woman judge: medium-light skin tone"), QStringLiteral("woman judge: medium-light skin tone")})},
-{QStringLiteral("woman judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002696\U0000FE0F"), QStringLiteral("woman judge: medium skin tone"), QStringLiteral("woman judge: medium skin tone")})},
-{QStringLiteral("woman judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002696\U0000FE0F"), QStringLiteral("woman judge: medium-dark skin tone"), QStringLiteral("woman judge: medium-dark skin tone")})},
-{QStringLiteral("woman judge"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002696\U0000FE0F"), QStringLiteral("woman judge: dark skin tone"), QStringLiteral("woman judge: dark skin tone")})},
-{QStringLiteral("farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F33E"), QStringLiteral("farmer: light skin tone"), QStringLiteral("farmer: light skin tone")})},
-{QStringLiteral("farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F33E"), QStringLiteral("farmer: medium-light skin tone"), QStringLiteral("farmer: medium-light skin tone")})},
-{QStringLiteral("farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F33E"), QStringLiteral("farmer: medium skin tone"), QStringLiteral("farmer: medium skin tone")})},
-{QStringLiteral("farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F33E"), QStringLiteral("farmer: medium-dark skin tone"), QStringLiteral("farmer: medium-dark skin tone")})},
-{QStringLiteral("farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F33E"), QStringLiteral("farmer: dark skin tone"), QStringLiteral("farmer: dark skin tone")})},
-{QStringLiteral("man farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F33E"), QStringLiteral("man farmer: light skin tone"), QStringLiteral("man farmer: light skin tone")})},
-{QStringLiteral("man farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F33E"), QStringLiteral("man farmer: medium-light skin tone"), QStringLiteral("man farmer: medium-light skin tone")})},
-{QStringLiteral("man farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F33E"), QStringLiteral("man farmer: medium skin tone"), QStringLiteral("man farmer: medium skin tone")})},
-{QStringLiteral("man farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F33E"), QStringLiteral("man farmer: medium-dark skin tone"), QStringLiteral("man farmer: medium-dark skin tone")})},
-{QStringLiteral("man farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F33E"), QStringLiteral("man farmer: dark skin tone"), QStringLiteral("man farmer: dark skin tone")})},
-{QStringLiteral("woman farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F33E"), QStringLiteral("woman farmer: light skin tone"), QStringLiteral("woman farmer: light skin tone")})},
-{QStringLiteral("woman farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F33E"), QStringLiteral("woman farmer: medium-light skin tone"), QStringLiteral("woman farmer: medium-light skin tone")})},
-{QStringLiteral("woman farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F33E"), QStringLiteral("woman farmer: medium skin tone"), QStringLiteral("woman farmer: medium skin tone")})},
-{QStringLiteral("woman farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F33E"), QStringLiteral("woman farmer: medium-dark skin tone"), QStringLiteral("woman farmer: medium-dark skin tone")})},
-{QStringLiteral("woman farmer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F33E"), QStringLiteral("woman farmer: dark skin tone"), QStringLiteral("woman farmer: dark skin tone")})},
-{QStringLiteral("cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F373"), QStringLiteral("cook: light skin tone"), QStringLiteral("cook: light skin tone")})},
-{QStringLiteral("cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F373"), QStringLiteral("cook: medium-light skin tone"), QStringLiteral("cook: medium-light skin tone")})},
-{QStringLiteral("cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F373"), QStringLiteral("cook: medium skin tone"), QStringLiteral("cook: medium skin tone")})},
-{QStringLiteral("cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F373"), QStringLiteral("cook: medium-dark skin tone"), QStringLiteral("cook: medium-dark skin tone")})},
-{QStringLiteral("cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F373"), QStringLiteral("cook: dark skin tone"), QStringLiteral("cook: dark skin tone")})},
-{QStringLiteral("man cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F373"), QStringLiteral("man cook: light skin tone"), QStringLiteral("man cook: light skin tone")})},
-{QStringLiteral("man cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F373"), QStringLiteral("man cook: medium-light skin tone"), QStringLiteral("man cook: medium-light skin tone")})},
-{QStringLiteral("man cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F373"), QStringLiteral("man cook: medium skin tone"), QStringLiteral("man cook: medium skin tone")})},
-{QStringLiteral("man cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F373"), QStringLiteral("man cook: medium-dark skin tone"), QStringLiteral("man cook: medium-dark skin tone")})},
-{QStringLiteral("man cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F373"), QStringLiteral("man cook: dark skin tone"), QStringLiteral("man cook: dark skin tone")})},
-{QStringLiteral("woman cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F373"), QStringLiteral("woman cook: light skin tone"), QStringLiteral("woman cook: light skin tone")})},
-{QStringLiteral("woman cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F373"), QStringLiteral("woman cook: medium-light skin tone"), QStringLiteral("woman cook: medium-light skin tone")})},
-{QStringLiteral("woman cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F373"), QStringLiteral("woman cook: medium skin tone"), QStringLiteral("woman cook: medium skin tone")})},
-{QStringLiteral("woman cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F373"), QStringLiteral("woman cook: medium-dark skin tone"), QStringLiteral("woman cook: medium-dark skin tone")})},
-{QStringLiteral("woman cook"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F373"), QStringLiteral("woman cook: dark skin tone"), QStringLiteral("woman cook: dark skin tone")})},
-{QStringLiteral("mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F527"), QStringLiteral("mechanic: light skin tone"), QStringLiteral("mechanic: light skin tone")})},
-{QStringLiteral("mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F527"), QStringLiteral("mechanic: medium-light skin tone"), QStringLiteral("mechanic: medium-light skin tone")})},
-{QStringLiteral("mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F527"), QStringLiteral("mechanic: medium skin tone"), QStringLiteral("mechanic: medium skin tone")})},
-{QStringLiteral("mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F527"), QStringLiteral("mechanic: medium-dark skin tone"), QStringLiteral("mechanic: medium-dark skin tone")})},
-{QStringLiteral("mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F527"), QStringLiteral("mechanic: dark skin tone"), QStringLiteral("mechanic: dark skin tone")})},
-{QStringLiteral("man mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F527"), QStringLiteral("man mechanic: light skin tone"), QStringLiteral("man mechanic: light skin tone")})},
-{QStringLiteral("man mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F527"), QStringLiteral("man mechanic: medium-light skin tone"), QStringLiteral("man mechanic: medium-light skin tone")})},
-{QStringLiteral("man mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F527"), QStringLiteral("man mechanic: medium skin tone"), QStringLiteral("man mechanic: medium skin tone")})},
-{QStringLiteral("man mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F527"), QStringLiteral("man mechanic: medium-dark skin tone"), QStringLiteral("man mechanic: medium-dark skin tone")})},
-{QStringLiteral("man mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F527"), QStringLiteral("man mechanic: dark skin tone"), QStringLiteral("man mechanic: dark skin tone")})},
-{QStringLiteral("woman mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F527"), QStringLiteral("woman mechanic: light skin tone"), QStringLiteral("woman mechanic: light skin tone")})},
-{QStringLiteral("woman mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F527"), QStringLiteral("woman mechanic: medium-light skin tone"), QStringLiteral("woman mechanic: medium-light skin tone")})},
-{QStringLiteral("woman mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F527"), QStringLiteral("woman mechanic: medium skin tone"), QStringLiteral("woman mechanic: medium skin tone")})},
-{QStringLiteral("woman mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F527"), QStringLiteral("woman mechanic: medium-dark skin tone"), QStringLiteral("woman mechanic: medium-dark skin tone")})},
-{QStringLiteral("woman mechanic"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F527"), QStringLiteral("woman mechanic: dark skin tone"), QStringLiteral("woman mechanic: dark skin tone")})},
-{QStringLiteral("factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F3ED"), QStringLiteral("factory worker: light skin tone"), QStringLiteral("factory worker: light skin tone")})},
-{QStringLiteral("factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F3ED"), QStringLiteral("factory worker: medium-light skin tone"), QStringLiteral("factory worker: medium-light skin tone")})},
-{QStringLiteral("factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F3ED"), QStringLiteral("factory worker: medium skin tone"), QStringLiteral("factory worker: medium skin tone")})},
-{QStringLiteral("factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F3ED"), QStringLiteral("factory worker: medium-dark skin tone"), QStringLiteral("factory worker: medium-dark skin tone")})},
-{QStringLiteral("factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F3ED"), QStringLiteral("factory worker: dark skin tone"), QStringLiteral("factory worker: dark skin tone")})},
-{QStringLiteral("man factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F3ED"), QStringLiteral("man factory worker: light skin tone"), QStringLiteral("man factory worker: light skin tone")})},
-{QStringLiteral("man factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F3ED"), QStringLiteral("man factory worker: medium-light skin tone"), QStringLiteral("man factory worker: medium-light skin tone")})},
-{QStringLiteral("man factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F3ED"), QStringLiteral("man factory worker: medium skin tone"), QStringLiteral("man factory worker: medium skin tone")})},
-{QStringLiteral("man factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F3ED"), QStringLiteral("man factory worker: medium-dark skin tone"), QStringLiteral("man factory worker: medium-dark skin tone")})},
-{QStringLiteral("man factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F3ED"), QStringLiteral("man factory worker: dark skin tone"), QStringLiteral("man factory worker: dark skin tone")})},
-{QStringLiteral("woman factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F3ED"), QStringLiteral("woman factory worker: light skin tone"), QStringLiteral("woman factory worker: light skin tone")})},
-{QStringLiteral("woman factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F3ED"), QStringLiteral("woman factory worker: medium-light skin tone"), QStringLiteral("woman factory worker: medium-light skin tone")})},
-{QStringLiteral("woman factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F3ED"), QStringLiteral("woman factory worker: medium skin tone"), QStringLiteral("woman factory worker: medium skin tone")})},
-{QStringLiteral("woman factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F3ED"), QStringLiteral("woman factory worker: medium-dark skin tone"), QStringLiteral("woman factory worker: medium-dark skin tone")})},
-{QStringLiteral("woman factory worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F3ED"), QStringLiteral("woman factory worker: dark skin tone"), QStringLiteral("woman factory worker: dark skin tone")})},
-{QStringLiteral("office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F4BC"), QStringLiteral("office worker: light skin tone"), QStringLiteral("office worker: light skin tone")})},
-{QStringLiteral("office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F4BC"), QStringLiteral("office worker: medium-light skin tone"), QStringLiteral("office worker: medium-light skin tone")})},
-{QStringLiteral("office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F4BC"), QStringLiteral("office worker: medium skin tone"), QStringLiteral("office worker: medium skin tone")})},
-{QStringLiteral("office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F4BC"), QStringLiteral("office worker: medium-dark skin tone"), QStringLiteral("office worker: medium-dark skin tone")})},
-{QStringLiteral("office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F4BC"), QStringLiteral("office worker: dark skin tone"), QStringLiteral("office worker: dark skin tone")})},
-{QStringLiteral("man office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F4BC"), QStringLiteral("man office worker: light skin tone"), QStringLiteral("man office worker: light skin tone")})},
-{QStringLiteral("man office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F4BC"), QStringLiteral("man office worker: medium-light skin tone"), QStringLiteral("man office worker: medium-light skin tone")})},
-{QStringLiteral("man office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F4BC"), QStringLiteral("man office worker: medium skin tone"), QStringLiteral("man office worker: medium skin tone")})},
-{QStringLiteral("man office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F4BC"), QStringLiteral("man office worker: medium-dark skin tone"), QStringLiteral("man office worker: medium-dark skin tone")})},
-{QStringLiteral("man office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F4BC"), QStringLiteral("man office worker: dark skin tone"), QStringLiteral("man office worker: dark skin tone")})},
-{QStringLiteral("woman office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F4BC"), QStringLiteral("woman office worker: light skin tone"), QStringLiteral("woman office worker: light skin tone")})},
-{QStringLiteral("woman office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F4BC"), QStringLiteral("woman office worker: medium-light skin tone"), QStringLiteral("woman office worker: medium-light skin tone")})},
-{QStringLiteral("woman office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F4BC"), QStringLiteral("woman office worker: medium skin tone"), QStringLiteral("woman office worker: medium skin tone")})},
-{QStringLiteral("woman office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F4BC"), QStringLiteral("woman office worker: medium-dark skin tone"), QStringLiteral("woman office worker: medium-dark skin tone")})},
-{QStringLiteral("woman office worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F4BC"), QStringLiteral("woman office worker: dark skin tone"), QStringLiteral("woman office worker: dark skin tone")})},
-{QStringLiteral("scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F52C"), QStringLiteral("scientist: light skin tone"), QStringLiteral("scientist: light skin tone")})},
-{QStringLiteral("scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F52C"), QStringLiteral("scientist: medium-light skin tone"), QStringLiteral("scientist: medium-light skin tone")})},
-{QStringLiteral("scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F52C"), QStringLiteral("scientist: medium skin tone"), QStringLiteral("scientist: medium skin tone")})},
-{QStringLiteral("scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F52C"), QStringLiteral("scientist: medium-dark skin tone"), QStringLiteral("scientist: medium-dark skin tone")})},
-{QStringLiteral("scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F52C"), QStringLiteral("scientist: dark skin tone"), QStringLiteral("scientist: dark skin tone")})},
-{QStringLiteral("man scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F52C"), QStringLiteral("man scientist: light skin tone"), QStringLiteral("man scientist: light skin tone")})},
-{QStringLiteral("man scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F52C"), QStringLiteral("man scientist: medium-light skin tone"), QStringLiteral("man scientist: medium-light skin tone")})},
-{QStringLiteral("man scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F52C"), QStringLiteral("man scientist: medium skin tone"), QStringLiteral("man scientist: medium skin tone")})},
-{QStringLiteral("man scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F52C"), QStringLiteral("man scientist: medium-dark skin tone"), QStringLiteral("man scientist: medium-dark skin tone")})},
-{QStringLiteral("man scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F52C"), QStringLiteral("man scientist: dark skin tone"), QStringLiteral("man scientist: dark skin tone")})},
-{QStringLiteral("woman scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F52C"), QStringLiteral("woman scientist: light skin tone"), QStringLiteral("woman scientist: light skin tone")})},
-{QStringLiteral("woman scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F52C"), QStringLiteral("woman scientist: medium-light skin tone"), QStringLiteral("woman scientist: medium-light skin tone")})},
-{QStringLiteral("woman scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F52C"), QStringLiteral("woman scientist: medium skin tone"), QStringLiteral("woman scientist: medium skin tone")})},
-{QStringLiteral("woman scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F52C"), QStringLiteral("woman scientist: medium-dark skin tone"), QStringLiteral("woman scientist: medium-dark skin tone")})},
-{QStringLiteral("woman scientist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F52C"), QStringLiteral("woman scientist: dark skin tone"), QStringLiteral("woman scientist: dark skin tone")})},
-{QStringLiteral("technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F4BB"), QStringLiteral("technologist: light skin tone"), QStringLiteral("technologist: light skin tone")})},
-{QStringLiteral("technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F4BB"), QStringLiteral("technologist: medium-light skin tone"), QStringLiteral("technologist: medium-light skin tone")})},
-{QStringLiteral("technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F4BB"), QStringLiteral("technologist: medium skin tone"), QStringLiteral("technologist: medium skin tone")})},
-{QStringLiteral("technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F4BB"), QStringLiteral("technologist: medium-dark skin tone"), QStringLiteral("technologist: medium-dark skin tone")})},
-{QStringLiteral("technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F4BB"), QStringLiteral("technologist: dark skin tone"), QStringLiteral("technologist: dark skin tone")})},
-{QStringLiteral("man technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F4BB"), QStringLiteral("man technologist: light skin tone"), QStringLiteral("man technologist: light skin tone")})},
-{QStringLiteral("man technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F4BB"), QStringLiteral("man technologist: medium-light skin tone"), QStringLiteral("man technologist: medium-light skin tone")})},
-{QStringLiteral("man technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F4BB"), QStringLiteral("man technologist: medium skin tone"), QStringLiteral("man technologist: medium skin tone")})},
-{QStringLiteral("man technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F4BB"), QStringLiteral("man technologist: medium-dark skin tone"), QStringLiteral("man technologist: medium-dark skin tone")})},
-{QStringLiteral("man technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F4BB"), QStringLiteral("man technologist: dark skin tone"), QStringLiteral("man technologist: dark skin tone")})},
-{QStringLiteral("woman technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F4BB"), QStringLiteral("woman technologist: light skin tone"), QStringLiteral("woman technologist: light skin tone")})},
-{QStringLiteral("woman technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F4BB"), QStringLiteral("woman technologist: medium-light skin tone"), QStringLiteral("woman technologist: medium-light skin tone")})},
-{QStringLiteral("woman technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F4BB"), QStringLiteral("woman technologist: medium skin tone"), QStringLiteral("woman technologist: medium skin tone")})},
-{QStringLiteral("woman technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F4BB"), QStringLiteral("woman technologist: medium-dark skin tone"), QStringLiteral("woman technologist: medium-dark skin tone")})},
-{QStringLiteral("woman technologist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F4BB"), QStringLiteral("woman technologist: dark skin tone"), QStringLiteral("woman technologist: dark skin tone")})},
-{QStringLiteral("singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F3A4"), QStringLiteral("singer: light skin tone"), QStringLiteral("singer: light skin tone")})},
-{QStringLiteral("singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F3A4"), QStringLiteral("singer: medium-light skin tone"), QStringLiteral("singer: medium-light skin tone")})},
-{QStringLiteral("singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F3A4"), QStringLiteral("singer: medium skin tone"), QStringLiteral("singer: medium skin tone")})},
-{QStringLiteral("singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F3A4"), QStringLiteral("singer: medium-dark skin tone"), QStringLiteral("singer: medium-dark skin tone")})},
-{QStringLiteral("singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F3A4"), QStringLiteral("singer: dark skin tone"), QStringLiteral("singer: dark skin tone")})},
-{QStringLiteral("man singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F3A4"), QStringLiteral("man singer: light skin tone"), QStringLiteral("man singer: light skin tone")})},
-{QStringLiteral("man singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F3A4"), QStringLiteral("man singer: medium-light skin tone"), QStringLiteral("man singer: medium-light skin tone")})},
-{QStringLiteral("man singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F3A4"), QStringLiteral("man singer: medium skin tone"), QStringLiteral("man singer: medium skin tone")})},
-{QStringLiteral("man singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F3A4"), QStringLiteral("man singer: medium-dark skin tone"), QStringLiteral("man singer: medium-dark skin tone")})},
-{QStringLiteral("man singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F3A4"), QStringLiteral("man singer: dark skin tone"), QStringLiteral("man singer: dark skin tone")})},
-{QStringLiteral("woman singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F3A4"), QStringLiteral("woman singer: light skin tone"), QStringLiteral("woman singer: light skin tone")})},
-{QStringLiteral("woman singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F3A4"), QStringLiteral("woman singer: medium-light skin tone"), QStringLiteral("woman singer: medium-light skin tone")})},
-{QStringLiteral("woman singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F3A4"), QStringLiteral("woman singer: medium skin tone"), QStringLiteral("woman singer: medium skin tone")})},
-{QStringLiteral("woman singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F3A4"), QStringLiteral("woman singer: medium-dark skin tone"), QStringLiteral("woman singer: medium-dark skin tone")})},
-{QStringLiteral("woman singer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F3A4"), QStringLiteral("woman singer: dark skin tone"), QStringLiteral("woman singer: dark skin tone")})},
-{QStringLiteral("artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F3A8"), QStringLiteral("artist: light skin tone"), QStringLiteral("artist: light skin tone")})},
-{QStringLiteral("artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F3A8"), QStringLiteral("artist: medium-light skin tone"), QStringLiteral("artist: medium-light skin tone")})},
-{QStringLiteral("artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F3A8"), QStringLiteral("artist: medium skin tone"), QStringLiteral("artist: medium skin tone")})},
-{QStringLiteral("artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F3A8"), QStringLiteral("artist: medium-dark skin tone"), QStringLiteral("artist: medium-dark skin tone")})},
-{QStringLiteral("artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F3A8"), QStringLiteral("artist: dark skin tone"), QStringLiteral("artist: dark skin tone")})},
-{QStringLiteral("man artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F3A8"), QStringLiteral("man artist: light skin tone"), QStringLiteral("man artist: light skin tone")})},
-{QStringLiteral("man artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F3A8"), QStringLiteral("man artist: medium-light skin tone"), QStringLiteral("man artist: medium-light skin tone")})},
-{QStringLiteral("man artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F3A8"), QStringLiteral("man artist: medium skin tone"), QStringLiteral("man artist: medium skin tone")})},
-{QStringLiteral("man artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F3A8"), QStringLiteral("man artist: medium-dark skin tone"), QStringLiteral("man artist: medium-dark skin tone")})},
-{QStringLiteral("man artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F3A8"), QStringLiteral("man artist: dark skin tone"), QStringLiteral("man artist: dark skin tone")})},
-{QStringLiteral("woman artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F3A8"), QStringLiteral("woman artist: light skin tone"), QStringLiteral("woman artist: light skin tone")})},
-{QStringLiteral("woman artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F3A8"), QStringLiteral("woman artist: medium-light skin tone"), QStringLiteral("woman artist: medium-light skin tone")})},
-{QStringLiteral("woman artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F3A8"), QStringLiteral("woman artist: medium skin tone"), QStringLiteral("woman artist: medium skin tone")})},
-{QStringLiteral("woman artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F3A8"), QStringLiteral("woman artist: medium-dark skin tone"), QStringLiteral("woman artist: medium-dark skin tone")})},
-{QStringLiteral("woman artist"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F3A8"), QStringLiteral("woman artist: dark skin tone"), QStringLiteral("woman artist: dark skin tone")})},
-{QStringLiteral("pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002708\U0000FE0F"), QStringLiteral("pilot: light skin tone"), QStringLiteral("pilot: light skin tone")})},
-{QStringLiteral("pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002708\U0000FE0F"), QStringLiteral("pilot: medium-light skin tone"), QStringLiteral("pilot: medium-light skin tone")})},
-{QStringLiteral("pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002708\U0000FE0F"), QStringLiteral("pilot: medium skin tone"), QStringLiteral("pilot: medium skin tone")})},
-{QStringLiteral("pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002708\U0000FE0F"), QStringLiteral("pilot: medium-dark skin tone"), QStringLiteral("pilot: medium-dark skin tone")})},
-{QStringLiteral("pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002708\U0000FE0F"), QStringLiteral("pilot: dark skin tone"), QStringLiteral("pilot: dark skin tone")})},
-{QStringLiteral("man pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002708\U0000FE0F"), QStringLiteral("man pilot: light skin tone"), QStringLiteral("man pilot: light skin tone")})},
-{QStringLiteral("man pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002708\U0000FE0F"), QStringLiteral("man pilot: medium-light skin tone"), QStringLiteral("man pilot: medium-light skin tone")})},
-{QStringLiteral("man pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002708\U0000FE0F"), QStringLiteral("man pilot: medium skin tone"), QStringLiteral("man pilot: medium skin tone")})},
-{QStringLiteral("man pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002708\U0000FE0F"), QStringLiteral("man pilot: medium-dark skin tone"), QStringLiteral("man pilot: medium-dark skin tone")})},
-{QStringLiteral("man pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002708\U0000FE0F"), QStringLiteral("man pilot: dark skin tone"), QStringLiteral("man pilot: dark skin tone")})},
-{QStringLiteral("woman pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002708\U0000FE0F"), QStringLiteral("woman pilot: light skin tone"), QStringLiteral("woman pilot: light skin tone")})},
-{QStringLiteral("woman pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002708\U0000FE0F"), QStringLiteral("woman pilot: medium-light skin tone"), QStringLiteral("woman pilot: medium-light skin tone")})},
-{QStringLiteral("woman pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002708\U0000FE0F"), QStringLiteral("woman pilot: medium skin tone"), QStringLiteral("woman pilot: medium skin tone")})},
-{QStringLiteral("woman pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002708\U0000FE0F"), QStringLiteral("woman pilot: medium-dark skin tone"), QStringLiteral("woman pilot: medium-dark skin tone")})},
-{QStringLiteral("woman pilot"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002708\U0000FE0F"), QStringLiteral("woman pilot: dark skin tone"), QStringLiteral("woman pilot: dark skin tone")})},
-{QStringLiteral("astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F680"), QStringLiteral("astronaut: light skin tone"), QStringLiteral("astronaut: light skin tone")})},
-{QStringLiteral("astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F680"), QStringLiteral("astronaut: medium-light skin tone"), QStringLiteral("astronaut: medium-light skin tone")})},
-{QStringLiteral("astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F680"), QStringLiteral("astronaut: medium skin tone"), QStringLiteral("astronaut: medium skin tone")})},
-{QStringLiteral("astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F680"), QStringLiteral("astronaut: medium-dark skin tone"), QStringLiteral("astronaut: medium-dark skin tone")})},
-{QStringLiteral("astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F680"), QStringLiteral("astronaut: dark skin tone"), QStringLiteral("astronaut: dark skin tone")})},
-{QStringLiteral("man astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F680"), QStringLiteral("man astronaut: light skin tone"), QStringLiteral("man astronaut: light skin tone")})},
-{QStringLiteral("man astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F680"), QStringLiteral("man astronaut: medium-light skin tone"), QStringLiteral("man astronaut: medium-light skin tone")})},
-{QStringLiteral("man astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F680"), QStringLiteral("man astronaut: medium skin tone"), QStringLiteral("man astronaut: medium skin tone")})},
-{QStringLiteral("man astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F680"), QStringLiteral("man astronaut: medium-dark skin tone"), QStringLiteral("man astronaut: medium-dark skin tone")})},
-{QStringLiteral("man astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F680"), QStringLiteral("man astronaut: dark skin tone"), QStringLiteral("man astronaut: dark skin tone")})},
-{QStringLiteral("woman astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F680"), QStringLiteral("woman astronaut: light skin tone"), QStringLiteral("woman astronaut: light skin tone")})},
-{QStringLiteral("woman astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F680"), QStringLiteral("woman astronaut: medium-light skin tone"), QStringLiteral("woman astronaut: medium-light skin tone")})},
-{QStringLiteral("woman astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F680"), QStringLiteral("woman astronaut: medium skin tone"), QStringLiteral("woman astronaut: medium skin tone")})},
-{QStringLiteral("woman astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F680"), QStringLiteral("woman astronaut: medium-dark skin tone"), QStringLiteral("woman astronaut: medium-dark skin tone")})},
-{QStringLiteral("woman astronaut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F680"), QStringLiteral("woman astronaut: dark skin tone"), QStringLiteral("woman astronaut: dark skin tone")})},
-{QStringLiteral("firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F692"), QStringLiteral("firefighter: light skin tone"), QStringLiteral("firefighter: light skin tone")})},
-{QStringLiteral("firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F692"), QStringLiteral("firefighter: medium-light skin tone"), QStringLiteral("firefighter: medium-light skin tone")})},
-{QStringLiteral("firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F692"), QStringLiteral("firefighter: medium skin tone"), QStringLiteral("firefighter: medium skin tone")})},
-{QStringLiteral("firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F692"), QStringLiteral("firefighter: medium-dark skin tone"), QStringLiteral("firefighter: medium-dark skin tone")})},
-{QStringLiteral("firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F692"), QStringLiteral("firefighter: dark skin tone"), QStringLiteral("firefighter: dark skin tone")})},
-{QStringLiteral("man firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F692"), QStringLiteral("man firefighter: light skin tone"), QStringLiteral("man firefighter: light skin tone")})},
-{QStringLiteral("man firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F692"), QStringLiteral("man firefighter: medium-light skin tone"), QStringLiteral("man firefighter: medium-light skin tone")})},
-{QStringLiteral("man firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F692"), QStringLiteral("man firefighter: medium skin tone"), QStringLiteral("man firefighter: medium skin tone")})},
-{QStringLiteral("man firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F692"), QStringLiteral("man firefighter: medium-dark skin tone"), QStringLiteral("man firefighter: medium-dark skin tone")})},
-{QStringLiteral("man firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F692"), QStringLiteral("man firefighter: dark skin tone"), QStringLiteral("man firefighter: dark skin tone")})},
-{QStringLiteral("woman firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F692"), QStringLiteral("woman firefighter: light skin tone"), QStringLiteral("woman firefighter: light skin tone")})},
-{QStringLiteral("woman firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F692"), QStringLiteral("woman firefighter: medium-light skin tone"), QStringLiteral("woman firefighter: medium-light skin tone")})},
-{QStringLiteral("woman firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F692"), QStringLiteral("woman firefighter: medium skin tone"), QStringLiteral("woman firefighter: medium skin tone")})},
-{QStringLiteral("woman firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F692"), QStringLiteral("woman firefighter: medium-dark skin tone"), QStringLiteral("woman firefighter: medium-dark skin tone")})},
-{QStringLiteral("woman firefighter"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F692"), QStringLiteral("woman firefighter: dark skin tone"), QStringLiteral("woman firefighter: dark skin tone")})},
-{QStringLiteral("police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FB"), QStringLiteral("cop_tone1"), QStringLiteral("police officer: light skin tone")})},
-{QStringLiteral("police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FC"), QStringLiteral("cop_tone2"), QStringLiteral("police officer: medium-light skin tone")})},
-{QStringLiteral("police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FD"), QStringLiteral("cop_tone3"), QStringLiteral("police officer: medium skin tone")})},
-{QStringLiteral("police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FE"), QStringLiteral("cop_tone4"), QStringLiteral("police officer: medium-dark skin tone")})},
-{QStringLiteral("police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FF"), QStringLiteral("cop_tone5"), QStringLiteral("police officer: dark skin tone")})},
-{QStringLiteral("man police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man police officer: light skin tone"), QStringLiteral("man police officer: light skin tone")})},
-{QStringLiteral("man police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man police officer: medium-light skin tone"), QStringLiteral("man police officer: medium-light skin tone")})},
-{QStringLiteral("man police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man police officer: medium skin tone"), QStringLiteral("man police officer: medium skin tone")})},
-{QStringLiteral("man police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man police officer: medium-dark skin tone"), QStringLiteral("man police officer: medium-dark skin tone")})},
-{QStringLiteral("man police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man police officer: dark skin tone"), QStringLiteral("man police officer: dark skin tone")})},
-{QStringLiteral("woman police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman police officer: light skin tone"), QStringLiteral("woman police officer: light skin tone")})},
-{QStringLiteral("woman police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman police officer: medium-light skin tone"), QStringLiteral("woman police officer: medium-light skin tone")})},
-{QStringLiteral("woman police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman police officer: medium skin tone"), QStringLiteral("woman police officer: medium skin tone")})},
-{QStringLiteral("woman police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman police officer: medium-dark skin tone"), QStringLiteral("woman police officer: medium-dark skin tone")})},
-{QStringLiteral("woman police officer"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46E\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman police officer: dark skin tone"), QStringLiteral("woman police officer: dark skin tone")})},
-{QStringLiteral("detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FB"), QStringLiteral("spy_tone1"), QStringLiteral("detective: light skin tone")})},
-{QStringLiteral("detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FC"), QStringLiteral("spy_tone2"), QStringLiteral("detective: medium-light skin tone")})},
-{QStringLiteral("detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FD"), QStringLiteral("spy_tone3"), QStringLiteral("detective: medium skin tone")})},
-{QStringLiteral("detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FE"), QStringLiteral("spy_tone4"), QStringLiteral("detective: medium-dark skin tone")})},
-{QStringLiteral("detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FF"), QStringLiteral("spy_tone5"), QStringLiteral("detective: dark skin tone")})},
-{QStringLiteral("man detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man detective: light skin tone"), QStringLiteral("man detective: light skin tone")})},
-{QStringLiteral("man detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man detective: medium-light skin tone"), QStringLiteral("man detective: medium-light skin tone")})},
-{QStringLiteral("man detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man detective: medium skin tone"), QStringLiteral("man detective: medium skin tone")})},
-{QStringLiteral("man detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man detective: medium-dark skin tone"), QStringLiteral("man detective: medium-dark skin tone")})},
-{QStringLiteral("man detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man detective: dark skin tone"), QStringLiteral("man detective: dark skin tone")})},
-{QStringLiteral("woman detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman detective: light skin tone"), QStringLiteral("woman detective: light skin tone")})},
-{QStringLiteral("woman detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman detective: medium-light skin tone"), QStringLiteral("woman detective: medium-light skin tone")})},
-{QStringLiteral("woman detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman detective: medium skin tone"), QStringLiteral("woman detective: medium skin tone")})},
-{QStringLiteral("woman detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman detective: medium-dark skin tone"), QStringLiteral("woman detective: medium-dark skin tone")})},
-{QStringLiteral("woman detective"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F575\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman detective: dark skin tone"), QStringLiteral("woman detective: dark skin tone")})},
-{QStringLiteral("guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FB"), QStringLiteral("guardsman_tone1"), QStringLiteral("guard: light skin tone")})},
-{QStringLiteral("guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FC"), QStringLiteral("guardsman_tone2"), QStringLiteral("guard: medium-light skin tone")})},
-{QStringLiteral("guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FD"), QStringLiteral("guardsman_tone3"), QStringLiteral("guard: medium skin tone")})},
-{QStringLiteral("guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FE"), QStringLiteral("guardsman_tone4"), QStringLiteral("guard: medium-dark skin tone")})},
-{QStringLiteral("guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FF"), QStringLiteral("guardsman_tone5"), QStringLiteral("guard: dark skin tone")})},
-{QStringLiteral("man guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man guard: light skin tone"), QStringLiteral("man guard: light skin tone")})},
-{QStringLiteral("man guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man guard: medium-light skin tone"), QStringLiteral("man guard: medium-light skin tone")})},
-{QStringLiteral("man guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man guard: medium skin tone"), QStringLiteral("man guard: medium skin tone")})},
-{QStringLiteral("man guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man guard: medium-dark skin tone"), QStringLiteral("man guard: medium-dark skin tone")})},
-{QStringLiteral("man guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man guard: dark skin tone"), QStringLiteral("man guard: dark skin tone")})},
-{QStringLiteral("woman guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman guard: light skin tone"), QStringLiteral("woman guard: light skin tone")})},
-{QStringLiteral("woman guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman guard: medium-light skin tone"), QStringLiteral("woman guard: medium-light skin tone")})},
-{QStringLiteral("woman guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman guard: medium skin tone"), QStringLiteral("woman guard: medium skin tone")})},
-{QStringLiteral("woman guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman guard: medium-dark skin tone"), QStringLiteral("woman guard: medium-dark skin tone")})},
-{QStringLiteral("woman guard"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F482\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman guard: dark skin tone"), QStringLiteral("woman guard: dark skin tone")})},
-{QStringLiteral("ninja"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F977\U0001F3FB"), QStringLiteral("ninja: light skin tone"), QStringLiteral("ninja: light skin tone")})},
-{QStringLiteral("ninja"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F977\U0001F3FC"), QStringLiteral("ninja: medium-light skin tone"), QStringLiteral("ninja: medium-light skin tone")})},
-{QStringLiteral("ninja"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F977\U0001F3FD"), QStringLiteral("ninja: medium skin tone"), QStringLiteral("ninja: medium skin tone")})},
-{QStringLiteral("ninja"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F977\U0001F3FE"), QStringLiteral("ninja: medium-dark skin tone"), QStringLiteral("ninja: medium-dark skin tone")})},
-{QStringLiteral("ninja"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F977\U0001F3FF"), QStringLiteral("ninja: dark skin tone"), QStringLiteral("ninja: dark skin tone")})},
-{QStringLiteral("construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FB"), QStringLiteral("construction_worker_tone1"), QStringLiteral("construction worker: light skin tone")})},
-{QStringLiteral("construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FC"), QStringLiteral("construction_worker_tone2"), QStringLiteral("construction worker: medium-light skin tone")})},
-{QStringLiteral("construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FD"), QStringLiteral("construction_worker_tone3"), QStringLiteral("construction worker: medium skin tone")})},
-{QStringLiteral("construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FE"), QStringLiteral("construction_worker_tone4"), QStringLiteral("construction worker: medium-dark skin tone")})},
-{QStringLiteral("construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FF"), QStringLiteral("construction_worker_tone5"), QStringLiteral("construction worker: dark skin tone")})},
-{QStringLiteral("man construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man construction worker: light skin tone"), QStringLiteral("man construction worker: light skin tone")})},
-{QStringLiteral("man construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man construction worker: medium-light skin tone"), QStringLiteral("man construction worker: medium-light skin tone")})},
-{QStringLiteral("man construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man construction worker: medium skin tone"), QStringLiteral("man construction worker: medium skin tone")})},
-{QStringLiteral("man construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man construction worker: medium-dark skin tone"), QStringLiteral("man construction worker: medium-dark skin tone")})},
-{QStringLiteral("man construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man construction worker: dark skin tone"), QStringLiteral("man construction worker: dark skin tone")})},
-{QStringLiteral("woman construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman construction worker: light skin tone"), QStringLiteral("woman construction worker: light skin tone")})},
-{QStringLiteral("woman construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman construction worker: medium-light skin tone"), QStringLiteral("woman construction worker: medium-light skin tone")})},
-{QStringLiteral("woman construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman construction worker: medium skin tone"), QStringLiteral("woman construction worker: medium skin tone")})},
-{QStringLiteral("woman construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman construction worker: medium-dark skin tone"), QStringLiteral("woman construction worker: medium-dark skin tone")})},
-{QStringLiteral("woman construction worker"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F477\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman construction worker: dark skin tone"), QStringLiteral("woman construction worker: dark skin tone")})},
-{QStringLiteral("person with crown"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC5\U0001F3FB"), QStringLiteral("person with crown: light skin tone"), QStringLiteral("person with crown: light skin tone")})},
-{QStringLiteral("person with crown"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC5\U0001F3FC"), QStringLiteral("person with crown: medium-light skin tone"), QStringLiteral("person with crown: medium-light skin tone")})},
-{QStringLiteral("person with crown"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC5\U0001F3FD"), QStringLiteral("person with crown: medium skin tone"), QStringLiteral("person with crown: medium skin tone")})},
-{QStringLiteral("person with crown"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC5\U0001F3FE"), QStringLiteral("person with crown: medium-dark skin tone"), QStringLiteral("person with crown: medium-dark skin tone")})},
-{QStringLiteral("person with crown"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC5\U0001F3FF"), QStringLiteral("person with crown: dark skin tone"), QStringLiteral("person with crown: dark skin tone")})},
-{QStringLiteral("prince"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F934\U0001F3FB"), QStringLiteral("prince_tone1"), QStringLiteral("prince: light skin tone")})},
-{QStringLiteral("prince"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F934\U0001F3FC"), QStringLiteral("prince_tone2"), QStringLiteral("prince: medium-light skin tone")})},
-{QStringLiteral("prince"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F934\U0001F3FD"), QStringLiteral("prince_tone3"), QStringLiteral("prince: medium skin tone")})},
-{QStringLiteral("prince"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F934\U0001F3FE"), QStringLiteral("prince_tone4"), QStringLiteral("prince: medium-dark skin tone")})},
-{QStringLiteral("prince"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F934\U0001F3FF"), QStringLiteral("prince_tone5"), QStringLiteral("prince: dark skin tone")})},
-{QStringLiteral("princess"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F478\U0001F3FB"), QStringLiteral("princess_tone1"), QStringLiteral("princess: light skin tone")})},
-{QStringLiteral("princess"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F478\U0001F3FC"), QStringLiteral("princess_tone2"), QStringLiteral("princess: medium-light skin tone")})},
-{QStringLiteral("princess"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F478\U0001F3FD"), QStringLiteral("princess_tone3"), QStringLiteral("princess: medium skin tone")})},
-{QStringLiteral("princess"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F478\U0001F3FE"), QStringLiteral("princess_tone4"), QStringLiteral("princess: medium-dark skin tone")})},
-{QStringLiteral("princess"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F478\U0001F3FF"), QStringLiteral("princess_tone5"), QStringLiteral("princess: dark skin tone")})},
-{QStringLiteral("person wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FB"), QStringLiteral("man_with_turban_tone1"), QStringLiteral("person wearing turban: light skin tone")})},
-{QStringLiteral("person wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FC"), QStringLiteral("man_with_turban_tone2"), QStringLiteral("person wearing turban: medium-light skin tone")})},
-{QStringLiteral("person wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FD"), QStringLiteral("man_with_turban_tone3"), QStringLiteral("person wearing turban: medium skin tone")})},
-{QStringLiteral("person wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FE"), QStringLiteral("man_with_turban_tone4"), QStringLiteral("person wearing turban: medium-dark skin tone")})},
-{QStringLiteral("person wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FF"), QStringLiteral("man_with_turban_tone5"), QStringLiteral("person wearing turban: dark skin tone")})},
-{QStringLiteral("man wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man wearing turban: light skin tone"), QStringLiteral("man wearing turban: light skin tone")})},
-{QStringLiteral("man wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man wearing turban: medium-light skin tone"), QStringLiteral("man wearing turban: medium-light skin tone")})},
-{QStringLiteral("man wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man wearing turban: medium skin tone"), QStringLiteral("man wearing turban: medium skin tone")})},
-{QStringLiteral("man wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man wearing turban: medium-dark skin tone"), QStringLiteral("man wearing turban: medium-dark skin tone")})},
-{QStringLiteral("man wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man wearing turban: dark skin tone"), QStringLiteral("man wearing turban: dark skin tone")})},
-{QStringLiteral("woman wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman wearing turban: light skin tone"), QStringLiteral("woman wearing turban: light skin tone")})},
-{QStringLiteral("woman wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman wearing turban: medium-light skin tone"), QStringLiteral("woman wearing turban: medium-light skin tone")})},
-{QStringLiteral("woman wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman wearing turban: medium skin tone"), QStringLiteral("woman wearing turban: medium skin tone")})},
-{QStringLiteral("woman wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman wearing turban: medium-dark skin tone"), QStringLiteral("woman wearing turban: medium-dark skin tone")})},
-{QStringLiteral("woman wearing turban"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F473\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman wearing turban: dark skin tone"), QStringLiteral("woman wearing turban: dark skin tone")})},
-{QStringLiteral("person with skullcap"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F472\U0001F3FB"), QStringLiteral("man_with_gua_pi_mao_tone1"), QStringLiteral("person with skullcap: light skin tone")})},
-{QStringLiteral("person with skullcap"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F472\U0001F3FC"), QStringLiteral("man_with_gua_pi_mao_tone2"), QStringLiteral("person with skullcap: medium-light skin tone")})},
-{QStringLiteral("person with skullcap"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F472\U0001F3FD"), QStringLiteral("man_with_gua_pi_mao_tone3"), QStringLiteral("person with skullcap: medium skin tone")})},
-{QStringLiteral("person with skullcap"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F472\U0001F3FE"), QStringLiteral("man_with_gua_pi_mao_tone4"), QStringLiteral("person with skullcap: medium-dark skin tone")})},
-{QStringLiteral("person with skullcap"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F472\U0001F3FF"), QStringLiteral("man_with_gua_pi_mao_tone5"), QStringLiteral("person with skullcap: dark skin tone")})},
-{QStringLiteral("woman with headscarf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D5\U0001F3FB"), QStringLiteral("woman_with_headscarf_tone1"), QStringLiteral("woman with headscarf: light skin tone")})},
-{QStringLiteral("woman with headscarf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D5\U0001F3FC"), QStringLiteral("woman_with_headscarf_tone2"), QStringLiteral("woman with headscarf: medium-light skin tone")})},
-{QStringLiteral("woman with headscarf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D5\U0001F3FD"), QStringLiteral("woman_with_headscarf_tone3"), QStringLiteral("woman with headscarf: medium skin tone")})},
-{QStringLiteral("woman with headscarf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D5\U0001F3FE"), QStringLiteral("woman_with_headscarf_tone4"), QStringLiteral("woman with headscarf: medium-dark skin tone")})},
-{QStringLiteral("woman with headscarf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D5\U0001F3FF"), QStringLiteral("woman_with_headscarf_tone5"), QStringLiteral("woman with headscarf: dark skin tone")})},
-{QStringLiteral("person in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FB"), QStringLiteral("man_in_tuxedo_tone1"), QStringLiteral("person in tuxedo: light skin tone")})},
-{QStringLiteral("person in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FC"), QStringLiteral("man_in_tuxedo_tone2"), QStringLiteral("person in tuxedo: medium-light skin tone")})},
-{QStringLiteral("person in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FD"), QStringLiteral("man_in_tuxedo_tone3"), QStringLiteral("person in tuxedo: medium skin tone")})},
-{QStringLiteral("person in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FE"), QStringLiteral("man_in_tuxedo_tone4"), QStringLiteral("person in tuxedo: medium-dark skin tone")})},
-{QStringLiteral("person in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FF"), QStringLiteral("man_in_tuxedo_tone5"), QStringLiteral("person in tuxedo: dark skin tone")})},
-{QStringLiteral("man in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in tuxedo: light skin tone"), QStringLiteral("man in tuxedo: light skin tone")})},
-{QStringLiteral("man in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in tuxedo: medium-light skin tone"), QStringLiteral("man in tuxedo: medium-light skin tone")})},
-{QStringLiteral("man in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in tuxedo: medium skin tone"), QStringLiteral("man in tuxedo: medium skin tone")})},
-{QStringLiteral("man in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in tuxedo: medium-dark skin tone"), QStringLiteral("man in tuxedo: medium-dark skin tone")})},
-{QStringLiteral("man in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in tuxedo: dark skin tone"), QStringLiteral("man in tuxedo: dark skin tone")})},
-{QStringLiteral("woman in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in tuxedo: light skin tone"), QStringLiteral("woman in tuxedo: light skin tone")})},
-{QStringLiteral("woman in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in tuxedo: medium-light skin tone"), QStringLiteral("woman in tuxedo: medium-light skin tone")})},
-{QStringLiteral("woman in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in tuxedo: medium skin tone"), QStringLiteral("woman in tuxedo: medium skin tone")})},
-{QStringLiteral("woman in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in tuxedo: medium-dark skin tone"), QStringLiteral("woman in tuxedo: medium-dark skin tone")})},
-{QStringLiteral("woman in tuxedo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F935\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in tuxedo: dark skin tone"), QStringLiteral("woman in tuxedo: dark skin tone")})},
-{QStringLiteral("person with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FB"), QStringLiteral("bride_with_veil_tone1"), QStringLiteral("person with veil: light skin tone")})},
-{QStringLiteral("person with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FC"), QStringLiteral("bride_with_veil_tone2"), QStringLiteral("person with veil: medium-light skin tone")})},
-{QStringLiteral("person with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FD"), QStringLiteral("bride_with_veil_tone3"), QStringLiteral("person with veil: medium skin tone")})},
-{QStringLiteral("person with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FE"), QStringLiteral("bride_with_veil_tone4"), QStringLiteral("person with veil: medium-dark skin tone")})},
-{QStringLiteral("person with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FF"), QStringLiteral("bride_with_veil_tone5"), QStringLiteral("person with veil: dark skin tone")})},
-{QStringLiteral("man with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man with veil: light skin tone"), QStringLiteral("man with veil: light skin tone")})},
-{QStringLiteral("man with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man with veil: medium-light skin tone"), QStringLiteral("man with veil: medium-light skin tone")})},
-{QStringLiteral("man with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man with veil: medium skin tone"), QStringLiteral("man with veil: medium skin tone")})},
-{QStringLiteral("man with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man with veil: medium-dark skin tone"), QStringLiteral("man with veil: medium-dark skin tone")})},
-{QStringLiteral("man with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man with veil: dark skin tone"), QStringLiteral("man with veil: dark skin tone")})},
-{QStringLiteral("woman with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman with veil: light skin tone"), QStringLiteral("woman with veil: light skin tone")})},
-{QStringLiteral("woman with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman with veil: medium-light skin tone"), QStringLiteral("woman with veil: medium-light skin tone")})},
-{QStringLiteral("woman with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman with veil: medium skin tone"), QStringLiteral("woman with veil: medium skin tone")})},
-{QStringLiteral("woman with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman with veil: medium-dark skin tone"), QStringLiteral("woman with veil: medium-dark skin tone")})},
-{QStringLiteral("woman with veil"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F470\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman with veil: dark skin tone"), QStringLiteral("woman with veil: dark skin tone")})},
-{QStringLiteral("pregnant woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F930\U0001F3FB"), QStringLiteral("pregnant_woman_tone1"), QStringLiteral("pregnant woman: light skin tone")})},
-{QStringLiteral("pregnant woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F930\U0001F3FC"), QStringLiteral("pregnant_woman_tone2"), QStringLiteral("pregnant woman: medium-light skin tone")})},
-{QStringLiteral("pregnant woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F930\U0001F3FD"), QStringLiteral("pregnant_woman_tone3"), QStringLiteral("pregnant woman: medium skin tone")})},
-{QStringLiteral("pregnant woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F930\U0001F3FE"), QStringLiteral("pregnant_woman_tone4"), QStringLiteral("pregnant woman: medium-dark skin tone")})},
-{QStringLiteral("pregnant woman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F930\U0001F3FF"), QStringLiteral("pregnant_woman_tone5"), QStringLiteral("pregnant woman: dark skin tone")})},
-{QStringLiteral("pregnant man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC3\U0001F3FB"), QStringLiteral("pregnant man: light skin tone"), QStringLiteral("pregnant man: light skin tone")})},
-{QStringLiteral("pregnant man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC3\U0001F3FC"), QStringLiteral("pregnant man: medium-light skin tone"), QStringLiteral("pregnant man: medium-light skin tone")})},
-{QStringLiteral("pregnant man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC3\U0001F3FD"), QStringLiteral("pregnant man: medium skin tone"), QStringLiteral("pregnant man: medium skin tone")})},
-{QStringLiteral("pregnant man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC3\U0001F3FE"), QStringLiteral("pregnant man: medium-dark skin tone"), QStringLiteral("pregnant man: medium-dark skin tone")})},
-{QStringLiteral("pregnant man"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC3\U0001F3FF"), QStringLiteral("pregnant man: dark skin tone"), QStringLiteral("pregnant man: dark skin tone")})},
-{QStringLiteral("pregnant person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC4\U0001F3FB"), QStringLiteral("pregnant person: light skin tone"), QStringLiteral("pregnant person: light skin tone")})},
-{QStringLiteral("pregnant person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC4\U0001F3FC"), QStringLiteral("pregnant person: medium-light skin tone"), QStringLiteral("pregnant person: medium-light skin tone")})},
-{QStringLiteral("pregnant person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC4\U0001F3FD"), QStringLiteral("pregnant person: medium skin tone"), QStringLiteral("pregnant person: medium skin tone")})},
-{QStringLiteral("pregnant person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC4\U0001F3FE"), QStringLiteral("pregnant person: medium-dark skin tone"), QStringLiteral("pregnant person: medium-dark skin tone")})},
-{QStringLiteral("pregnant person"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001FAC4\U0001F3FF"), QStringLiteral("pregnant person: dark skin tone"), QStringLiteral("pregnant person: dark skin tone")})},
-{QStringLiteral("breast-feeding"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F931\U0001F3FB"), QStringLiteral("breast_feeding_tone1"), QStringLiteral("breast-feeding: light skin tone")})},
-{QStringLiteral("breast-feeding"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F931\U0001F3FC"), QStringLiteral("breast_feeding_tone2"), QStringLiteral("breast-feeding: medium-light skin tone")})},
-{QStringLiteral("breast-feeding"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F931\U0001F3FD"), QStringLiteral("breast_feeding_tone3"), QStringLiteral("breast-feeding: medium skin tone")})},
-{QStringLiteral("breast-feeding"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F931\U0001F3FE"), QStringLiteral("breast_feeding_tone4"), QStringLiteral("breast-feeding: medium-dark skin tone")})},
-{QStringLiteral("breast-feeding"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F931\U0001F3FF"), QStringLiteral("breast_feeding_tone5"), QStringLiteral("breast-feeding: dark skin tone")})},
-{QStringLiteral("woman feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F37C"), QStringLiteral("woman feeding baby: light skin tone"), QStringLiteral("woman feeding baby: light skin tone")})},
-{QStringLiteral("woman feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F37C"), QStringLiteral("woman feeding baby: medium-light skin tone"), QStringLiteral("woman feeding baby: medium-light skin tone")})},
-{QStringLiteral("woman feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F37C"), QStringLiteral("woman feeding baby: medium skin tone"), QStringLiteral("woman feeding baby: medium skin tone")})},
-{QStringLiteral("woman feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F37C"), QStringLiteral("woman feeding baby: medium-dark skin tone"), QStringLiteral("woman feeding baby: medium-dark skin tone")})},
-{QStringLiteral("woman feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F37C"), QStringLiteral("woman feeding baby: dark skin tone"), QStringLiteral("woman feeding baby: dark skin tone")})},
-{QStringLiteral("man feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F37C"), QStringLiteral("man feeding baby: light skin tone"), QStringLiteral("man feeding baby: light skin tone")})},
-{QStringLiteral("man feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F37C"), QStringLiteral("man feeding baby: medium-light skin tone"), QStringLiteral("man feeding baby: medium-light skin tone")})},
-{QStringLiteral("man feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F37C"), QStringLiteral("man feeding baby: medium skin tone"), QStringLiteral("man feeding baby: medium skin tone")})},
-{QStringLiteral("man feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F37C"), QStringLiteral("man feeding baby: medium-dark skin tone"), QStringLiteral("man feeding baby: medium-dark skin tone")})},
-{QStringLiteral("man feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F37C"), QStringLiteral("man feeding baby: dark skin tone"), QStringLiteral("man feeding baby: dark skin tone")})},
-{QStringLiteral("person feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F37C"), QStringLiteral("person feeding baby: light skin tone"), QStringLiteral("person feeding baby: light skin tone")})},
-{QStringLiteral("person feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F37C"), QStringLiteral("person feeding baby: medium-light skin tone"), QStringLiteral("person feeding baby: medium-light skin tone")})},
-{QStringLiteral("person feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F37C"), QStringLiteral("person feeding baby: medium skin tone"), QStringLiteral("person feeding baby: medium skin tone")})},
-{QStringLiteral("person feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F37C"), QStringLiteral("person feeding baby: medium-dark skin tone"), QStringLiteral("person feeding baby: medium-dark skin tone")})},
-{QStringLiteral("person feeding baby"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F37C"), QStringLiteral("person feeding baby: dark skin tone"), QStringLiteral("person feeding baby: dark skin tone")})},
-{QStringLiteral("baby angel"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47C\U0001F3FB"), QStringLiteral("angel_tone1"), QStringLiteral("baby angel: light skin tone")})},
-{QStringLiteral("baby angel"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47C\U0001F3FC"), QStringLiteral("angel_tone2"), QStringLiteral("baby angel: medium-light skin tone")})},
-{QStringLiteral("baby angel"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47C\U0001F3FD"), QStringLiteral("angel_tone3"), QStringLiteral("baby angel: medium skin tone")})},
-{QStringLiteral("baby angel"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47C\U0001F3FE"), QStringLiteral("angel_tone4"), QStringLiteral("baby angel: medium-dark skin tone")})},
-{QStringLiteral("baby angel"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F47C\U0001F3FF"), QStringLiteral("angel_tone5"), QStringLiteral("baby angel: dark skin tone")})},
-{QStringLiteral("Santa Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F385\U0001F3FB"), QStringLiteral("santa_tone1"), QStringLiteral("Santa Claus: light skin tone")})},
-{QStringLiteral("Santa Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F385\U0001F3FC"), QStringLiteral("santa_tone2"), QStringLiteral("Santa Claus: medium-light skin tone")})},
-{QStringLiteral("Santa Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F385\U0001F3FD"), QStringLiteral("santa_tone3"), QStringLiteral("Santa Claus: medium skin tone")})},
-{QStringLiteral("Santa Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F385\U0001F3FE"), QStringLiteral("santa_tone4"), QStringLiteral("Santa Claus: medium-dark skin tone")})},
-{QStringLiteral("Santa Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F385\U0001F3FF"), QStringLiteral("santa_tone5"), QStringLiteral("Santa Claus: dark skin tone")})},
-{QStringLiteral("Mrs. Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F936\U0001F3FB"), QStringLiteral("mrs_claus_tone1"), QStringLiteral("Mrs. Claus: light skin tone")})},
-{QStringLiteral("Mrs. Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F936\U0001F3FC"), QStringLiteral("mrs_claus_tone2"), QStringLiteral("Mrs. Claus: medium-light skin tone")})},
-{QStringLiteral("Mrs. Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F936\U0001F3FD"), QStringLiteral("mrs_claus_tone3"), QStringLiteral("Mrs. Claus: medium skin tone")})},
-{QStringLiteral("Mrs. Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F936\U0001F3FE"), QStringLiteral("mrs_claus_tone4"), QStringLiteral("Mrs. Claus: medium-dark skin tone")})},
-{QStringLiteral("Mrs. Claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F936\U0001F3FF"), QStringLiteral("mrs_claus_tone5"), QStringLiteral("Mrs. Claus: dark skin tone")})},
-{QStringLiteral("mx claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F384"), QStringLiteral("mx claus: light skin tone"), QStringLiteral("mx claus: light skin tone")})},
-{QStringLiteral("mx claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F384"), QStringLiteral("mx claus: medium-light skin tone"), QStringLiteral("mx claus: medium-light skin tone")})},
-{QStringLiteral("mx claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F384"), QStringLiteral("mx claus: medium skin tone"), QStringLiteral("mx claus: medium skin tone")})},
-{QStringLiteral("mx claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F384"), QStringLiteral("mx claus: medium-dark skin tone"), QStringLiteral("mx claus: medium-dark skin tone")})},
-{QStringLiteral("mx claus"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F384"), QStringLiteral("mx claus: dark skin tone"), QStringLiteral("mx claus: dark skin tone")})},
-{QStringLiteral("superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FB"), QStringLiteral("superhero_tone1"), QStringLiteral("superhero: light skin tone")})},
-{QStringLiteral("superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FC"), QStringLiteral("superhero_tone2"), QStringLiteral("superhero: medium-light skin tone")})},
-{QStringLiteral("superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FD"), QStringLiteral("superhero_tone3"), QStringLiteral("superhero: medium skin tone")})},
-{QStringLiteral("superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FE"), QStringLiteral("superhero_tone4"), QStringLiteral("superhero: medium-dark skin tone")})},
-{QStringLiteral("superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FF"), QStringLiteral("superhero_tone5"), QStringLiteral("superhero: dark skin tone")})},
-{QStringLiteral("man superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man superhero: light skin tone"), QStringLiteral("man superhero: light skin tone")})},
-{QStringLiteral("man superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man superhero: medium-light skin tone"), QStringLiteral("man superhero: medium-light skin tone")})},
-{QStringLiteral("man superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man superhero: medium skin tone"), QStringLiteral("man superhero: medium skin tone")})},
-{QStringLiteral("man superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man superhero: medium-dark skin tone"), QStringLiteral("man superhero: medium-dark skin tone")})},
-{QStringLiteral("man superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man superhero: dark skin tone"), QStringLiteral("man superhero: dark skin tone")})},
-{QStringLiteral("woman superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman superhero: light skin tone"), QStringLiteral("woman superhero: light skin tone")})},
-{QStringLiteral("woman superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman superhero: medium-light skin tone"), QStringLiteral("woman superhero: medium-light skin tone")})},
-{QStringLiteral("woman superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman superhero: medium skin tone"), QStringLiteral("woman superhero: medium skin tone")})},
-{QStringLiteral("woman superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman superhero: medium-dark skin tone"), QStringLiteral("woman superhero: medium-dark skin tone")})},
-{QStringLiteral("woman superhero"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B8\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman superhero: dark skin tone"), QStringLiteral("woman superhero: dark skin tone")})},
-{QStringLiteral("supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FB"), QStringLiteral("supervillain_tone1"), QStringLiteral("supervillain: light skin tone")})},
-{QStringLiteral("supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FC"), QStringLiteral("supervillain_tone2"), QStringLiteral("supervillain: medium-light skin tone")})},
-{QStringLiteral("supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FD"), QStringLiteral("supervillain_tone3"), QStringLiteral("supervillain: medium skin tone")})},
-{QStringLiteral("supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FE"), QStringLiteral("supervillain_tone4"), QStringLiteral("supervillain: medium-dark skin tone")})},
-{QStringLiteral("supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FF"), QStringLiteral("supervillain_tone5"), QStringLiteral("supervillain: dark skin tone")})},
-{QStringLiteral("man supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man supervillain: light skin tone"), QStringLiteral("man supervillain: light skin tone")})},
-{QStringLiteral("man supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man supervillain: medium-light skin tone"), QStringLiteral("man supervillain: medium-light skin tone")})},
-{QStringLiteral("man supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man supervillain: medium skin tone"), QStringLiteral("man supervillain: medium skin tone")})},
-{QStringLiteral("man supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man supervillain: medium-dark skin tone"), QStringLiteral("man supervillain: medium-dark skin tone")})},
-{QStringLiteral("man supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man supervillain: dark skin tone"), QStringLiteral("man supervillain: dark skin tone")})},
-{QStringLiteral("woman supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman supervillain: light skin tone"), QStringLiteral("woman supervillain: light skin tone")})},
-{QStringLiteral("woman supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman supervillain: medium-light skin tone"), QStringLiteral("woman supervillain: medium-light skin tone")})},
-{QStringLiteral("woman supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman supervillain: medium skin tone"), QStringLiteral("woman supervillain: medium skin tone")})},
-{QStringLiteral("woman supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman supervillain: medium-dark skin tone"), QStringLiteral("woman supervillain: medium-dark skin tone")})},
-{QStringLiteral("woman supervillain"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9B9\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman supervillain: dark skin tone"), QStringLiteral("woman supervillain: dark skin tone")})},
-{QStringLiteral("mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FB"), QStringLiteral("mage_tone1"), QStringLiteral("mage: light skin tone")})},
-{QStringLiteral("mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FC"), QStringLiteral("mage_tone2"), QStringLiteral("mage: medium-light skin tone")})},
-{QStringLiteral("mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FD"), QStringLiteral("mage_tone3"), QStringLiteral("mage: medium skin tone")})},
-{QStringLiteral("mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FE"), QStringLiteral("mage_tone4"), QStringLiteral("mage: medium-dark skin tone")})},
-{QStringLiteral("mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FF"), QStringLiteral("mage_tone5"), QStringLiteral("mage: dark skin tone")})},
-{QStringLiteral("man mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mage: light skin tone"), QStringLiteral("man mage: light skin tone")})},
-{QStringLiteral("man mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mage: medium-light skin tone"), QStringLiteral("man mage: medium-light skin tone")})},
-{QStringLiteral("man mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mage: medium skin tone"), QStringLiteral("man mage: medium skin tone")})},
-{QStringLiteral("man mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mage: medium-dark skin tone"), QStringLiteral("man mage: medium-dark skin tone")})},
-{QStringLiteral("man mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mage: dark skin tone"), QStringLiteral("man mage: dark skin tone")})},
-{QStringLiteral("woman mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mage: light skin tone"), QStringLiteral("woman mage: light skin tone")})},
-{QStringLiteral("woman mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mage: medium-light skin tone"), QStringLiteral("woman mage: medium-light skin tone")})},
-{QStringLiteral("woman mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mage: medium skin tone"), QStringLiteral("woman mage: medium skin tone")})},
-{QStringLiteral("woman mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mage: medium-dark skin tone"), QStringLiteral("woman mage: medium-dark skin tone")})},
-{QStringLiteral("woman mage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D9\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mage: dark skin tone"), QStringLiteral("woman mage: dark skin tone")})},
-{QStringLiteral("fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FB"), QStringLiteral("fairy_tone1"), QStringLiteral("fairy: light skin tone")})},
-{QStringLiteral("fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FC"), QStringLiteral("fairy_tone2"), QStringLiteral("fairy: medium-light skin tone")})},
-{QStringLiteral("fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FD"), QStringLiteral("fairy_tone3"), QStringLiteral("fairy: medium skin tone")})},
-{QStringLiteral("fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FE"), QStringLiteral("fairy_tone4"), QStringLiteral("fairy: medium-dark skin tone")})},
-{QStringLiteral("fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FF"), QStringLiteral("fairy_tone5"), QStringLiteral("fairy: dark skin tone")})},
-{QStringLiteral("man fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man fairy: light skin tone"), QStringLiteral("man fairy: light skin tone")})},
-{QStringLiteral("man fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man fairy: medium-light skin tone"), QStringLiteral("man fairy: medium-light skin tone")})},
-{QStringLiteral("man fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man fairy: medium skin tone"), QStringLiteral("man fairy: medium skin tone")})},
-{QStringLiteral("man fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man fairy: medium-dark skin tone"), QStringLiteral("man fairy: medium-dark skin tone")})},
-{QStringLiteral("man fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man fairy: dark skin tone"), QStringLiteral("man fairy: dark skin tone")})},
-{QStringLiteral("woman fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman fairy: light skin tone"), QStringLiteral("woman fairy: light skin tone")})},
-{QStringLiteral("woman fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman fairy: medium-light skin tone"), QStringLiteral("woman fairy: medium-light skin tone")})},
-{QStringLiteral("woman fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman fairy: medium skin tone"), QStringLiteral("woman fairy: medium skin tone")})},
-{QStringLiteral("woman fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman fairy: medium-dark skin tone"), QStringLiteral("woman fairy: medium-dark skin tone")})},
-{QStringLiteral("woman fairy"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DA\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman fairy: dark skin tone"), QStringLiteral("woman fairy: dark skin tone")})},
-{QStringLiteral("vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FB"), QStringLiteral("vampire_tone1"), QStringLiteral("vampire: light skin tone")})},
-{QStringLiteral("vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FC"), QStringLiteral("vampire_tone2"), QStringLiteral("vampire: medium-light skin tone")})},
-{QStringLiteral("vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FD"), QStringLiteral("vampire_tone3"), QStringLiteral("vampire: medium skin tone")})},
-{QStringLiteral("vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FE"), QStringLiteral("vampire_tone4"), QStringLiteral("vampire: medium-dark skin tone")})},
-{QStringLiteral("vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FF"), QStringLiteral("vampire_tone5"), QStringLiteral("vampire: dark skin tone")})},
-{QStringLiteral("man vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man vampire: light skin tone"), QStringLiteral("man vampire: light skin tone")})},
-{QStringLiteral("man vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man vampire: medium-light skin tone"), QStringLiteral("man vampire: medium-light skin tone")})},
-{QStringLiteral("man vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man vampire: medium skin tone"), QStringLiteral("man vampire: medium skin tone")})},
-{QStringLiteral("man vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man vampire: medium-dark skin tone"), QStringLiteral("man vampire: medium-dark skin tone")})},
-{QStringLiteral("man vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man vampire: dark skin tone"), QStringLiteral("man vampire: dark skin tone")})},
-{QStringLiteral("woman vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman vampire: light skin tone"), QStringLiteral("woman vampire: light skin tone")})},
-{QStringLiteral("woman vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman vampire: medium-light skin tone"), QStringLiteral("woman vampire: medium-light skin tone")})},
-{QStringLiteral("woman vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman vampire: medium skin tone"), QStringLiteral("woman vampire: medium skin tone")})},
-{QStringLiteral("woman vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman vampire: medium-dark skin tone"), QStringLiteral("woman vampire: medium-dark skin tone")})},
-{QStringLiteral("woman vampire"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DB\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman vampire: dark skin tone"), QStringLiteral("woman vampire: dark skin tone")})},
-{QStringLiteral("merperson"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FB"), QStringLiteral("merperson_tone1"), QStringLiteral("merperson: light skin tone")})},
-{QStringLiteral("merperson"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FC"), QStringLiteral("merperson_tone2"), QStringLiteral("merperson: medium-light skin tone")})},
-{QStringLiteral("merperson"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FD"), QStringLiteral("merperson_tone3"), QStringLiteral("merperson: medium skin tone")})},
-{QStringLiteral("merperson"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FE"), QStringLiteral("merperson_tone4"), QStringLiteral("merperson: medium-dark skin tone")})},
-{QStringLiteral("merperson"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FF"), QStringLiteral("merperson_tone5"), QStringLiteral("merperson: dark skin tone")})},
-{QStringLiteral("merman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("merman: light skin tone"), QStringLiteral("merman: light skin tone")})},
-{QStringLiteral("merman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("merman: medium-light skin tone"), QStringLiteral("merman: medium-light skin tone")})},
-{QStringLiteral("merman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("merman: medium skin tone"), QStringLiteral("merman: medium skin tone")})},
-{QStringLiteral("merman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("merman: medium-dark skin tone"), QStringLiteral("merman: medium-dark skin tone")})},
-{QStringLiteral("merman"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("merman: dark skin tone"), QStringLiteral("merman: dark skin tone")})},
-{QStringLiteral("mermaid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("mermaid: light skin tone"), QStringLiteral("mermaid: light skin tone")})},
-{QStringLiteral("mermaid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("mermaid: medium-light skin tone"), QStringLiteral("mermaid: medium-light skin tone")})},
-{QStringLiteral("mermaid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("mermaid: medium skin tone"), QStringLiteral("mermaid: medium skin tone")})},
-{QStringLiteral("mermaid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("mermaid: medium-dark skin tone"), QStringLiteral("mermaid: medium-dark skin tone")})},
-{QStringLiteral("mermaid"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DC\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("mermaid: dark skin tone"), QStringLiteral("mermaid: dark skin tone")})},
-{QStringLiteral("elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FB"), QStringLiteral("elf_tone1"), QStringLiteral("elf: light skin tone")})},
-{QStringLiteral("elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FC"), QStringLiteral("elf_tone2"), QStringLiteral("elf: medium-light skin tone")})},
-{QStringLiteral("elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FD"), QStringLiteral("elf_tone3"), QStringLiteral("elf: medium skin tone")})},
-{QStringLiteral("elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FE"), QStringLiteral("elf_tone4"), QStringLiteral("elf: medium-dark skin tone")})},
-{QStringLiteral("elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FF"), QStringLiteral("elf_tone5"), QStringLiteral("elf: dark skin tone")})},
-{QStringLiteral("man elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man elf: light skin tone"), QStringLiteral("man elf: light skin tone")})},
-{QStringLiteral("man elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man elf: medium-light skin tone"), QStringLiteral("man elf: medium-light skin tone")})},
-{QStringLiteral("man elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man elf: medium skin tone"), QStringLiteral("man elf: medium skin tone")})},
-{QStringLiteral("man elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man elf: medium-dark skin tone"), QStringLiteral("man elf: medium-dark skin tone")})},
-{QStringLiteral("man elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man elf: dark skin tone"), QStringLiteral("man elf: dark skin tone")})},
-{QStringLiteral("woman elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman elf: light skin tone"), QStringLiteral("woman elf: light skin tone")})},
-{QStringLiteral("woman elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman elf: medium-light skin tone"), QStringLiteral("woman elf: medium-light skin tone")})},
-{QStringLiteral("woman elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman elf: medium skin tone"), QStringLiteral("woman elf: medium skin tone")})},
-{QStringLiteral("woman elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman elf: medium-dark skin tone"), QStringLiteral("woman elf: medium-dark skin tone")})},
-{QStringLiteral("woman elf"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9DD\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman elf: dark skin tone"), QStringLiteral("woman elf: dark skin tone")})},
-{QStringLiteral("person getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FB"), QStringLiteral("massage_tone1"), QStringLiteral("person getting massage: light skin tone")})},
-{QStringLiteral("person getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FC"), QStringLiteral("massage_tone2"), QStringLiteral("person getting massage: medium-light skin tone")})},
-{QStringLiteral("person getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FD"), QStringLiteral("massage_tone3"), QStringLiteral("person getting massage: medium skin tone")})},
-{QStringLiteral("person getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FE"), QStringLiteral("massage_tone4"), QStringLiteral("person getting massage: medium-dark skin tone")})},
-{QStringLiteral("person getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FF"), QStringLiteral("massage_tone5"), QStringLiteral("person getting massage: dark skin tone")})},
-{QStringLiteral("man getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting massage: light skin tone"), QStringLiteral("man getting massage: light skin tone")})},
-{QStringLiteral("man getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting massage: medium-light skin tone"), QStringLiteral("man getting massage: medium-light skin tone")})},
-{QStringLiteral("man getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting massage: medium skin tone"), QStringLiteral("man getting massage: medium skin tone")})},
-{QStringLiteral("man getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting massage: medium-dark skin tone"), QStringLiteral("man getting massage: medium-dark skin tone")})},
-{QStringLiteral("man getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting massage: dark skin tone"), QStringLiteral("man getting massage: dark skin tone")})},
-{QStringLiteral("woman getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting massage: light skin tone"), QStringLiteral("woman getting massage: light skin tone")})},
-{QStringLiteral("woman getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting massage: medium-light skin tone"), QStringLiteral("woman getting massage: medium-light skin tone")})},
-{QStringLiteral("woman getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting massage: medium skin tone"), QStringLiteral("woman getting massage: medium skin tone")})},
-{QStringLiteral("woman getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting massage: medium-dark skin tone"), QStringLiteral("woman getting massage: medium-dark skin tone")})},
-{QStringLiteral("woman getting massage"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F486\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting massage: dark skin tone"), QStringLiteral("woman getting massage: dark skin tone")})},
-{QStringLiteral("person getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FB"), QStringLiteral("haircut_tone1"), QStringLiteral("person getting haircut: light skin tone")})},
-{QStringLiteral("person getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FC"), QStringLiteral("haircut_tone2"), QStringLiteral("person getting haircut: medium-light skin tone")})},
-{QStringLiteral("person getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FD"), QStringLiteral("haircut_tone3"), QStringLiteral("person getting haircut: medium skin tone")})},
-{QStringLiteral("person getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FE"), QStringLiteral("haircut_tone4"), QStringLiteral("person getting haircut: medium-dark skin tone")})},
-{QStringLiteral("person getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FF"), QStringLiteral("haircut_tone5"), QStringLiteral("person getting haircut: dark skin tone")})},
-{QStringLiteral("man getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting haircut: light skin tone"), QStringLiteral("man getting haircut: light skin tone")})},
-{QStringLiteral("man getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting haircut: medium-light skin tone"), QStringLiteral("man getting haircut: medium-light skin tone")})},
-{QStringLiteral("man getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting haircut: medium skin tone"), QStringLiteral("man getting haircut: medium skin tone")})},
-{QStringLiteral("man getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting haircut: medium-dark skin tone"), QStringLiteral("man getting haircut: medium-dark skin tone")})},
-{QStringLiteral("man getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man getting haircut: dark skin tone"), QStringLiteral("man getting haircut: dark skin tone")})},
-{QStringLiteral("woman getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting haircut: light skin tone"), QStringLiteral("woman getting haircut: light skin tone")})},
-{QStringLiteral("woman getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting haircut: medium-light skin tone"), QStringLiteral("woman getting haircut: medium-light skin tone")})},
-{QStringLiteral("woman getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting haircut: medium skin tone"), QStringLiteral("woman getting haircut: medium skin tone")})},
-{QStringLiteral("woman getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting haircut: medium-dark skin tone"), QStringLiteral("woman getting haircut: medium-dark skin tone")})},
-{QStringLiteral("woman getting haircut"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F487\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman getting haircut: dark skin tone"), QStringLiteral("woman getting haircut: dark skin tone")})},
-{QStringLiteral("person walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FB"), QStringLiteral("walking_tone1"), QStringLiteral("person walking: light skin tone")})},
-{QStringLiteral("person walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FC"), QStringLiteral("walking_tone2"), QStringLiteral("person walking: medium-light skin tone")})},
-{QStringLiteral("person walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FD"), QStringLiteral("walking_tone3"), QStringLiteral("person walking: medium skin tone")})},
-{QStringLiteral("person walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FE"), QStringLiteral("walking_tone4"), QStringLiteral("person walking: medium-dark skin tone")})},
-{QStringLiteral("person walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FF"), QStringLiteral("walking_tone5"), QStringLiteral("person walking: dark skin tone")})},
-{QStringLiteral("man walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man walking: light skin tone"), QStringLiteral("man walking: light skin tone")})},
-{QStringLiteral("man walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man walking: medium-light skin tone"), QStringLiteral("man walking: medium-light skin tone")})},
-{QStringLiteral("man walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man walking: medium skin tone"), QStringLiteral("man walking: medium skin tone")})},
-{QStringLiteral("man walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man walking: medium-dark skin tone"), QStringLiteral("man walking: medium-dark skin tone")})},
-{QStringLiteral("man walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man walking: dark skin tone"), QStringLiteral("man walking: dark skin tone")})},
-{QStringLiteral("woman walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman walking: light skin tone"), QStringLiteral("woman walking: light skin tone")})},
-{QStringLiteral("woman walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman walking: medium-light skin tone"), QStringLiteral("woman walking: medium-light skin tone")})},
-{QStringLiteral("woman walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman walking: medium skin tone"), QStringLiteral("woman walking: medium skin tone")})},
-{QStringLiteral("woman walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman walking: medium-dark skin tone"), QStringLiteral("woman walking: medium-dark skin tone")})},
-{QStringLiteral("woman walking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B6\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman walking: dark skin tone"), QStringLiteral("woman walking: dark skin tone")})},
-{QStringLiteral("person standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FB"), QStringLiteral("person standing: light skin tone"), QStringLiteral("person standing: light skin tone")})},
-{QStringLiteral("person standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FC"), QStringLiteral("person standing: medium-light skin tone"), QStringLiteral("person standing: medium-light skin tone")})},
-{QStringLiteral("person standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FD"), QStringLiteral("person standing: medium skin tone"), QStringLiteral("person standing: medium skin tone")})},
-{QStringLiteral("person standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FE"), QStringLiteral("person standing: medium-dark skin tone"), QStringLiteral("person standing: medium-dark skin tone")})},
-{QStringLiteral("person standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FF"), QStringLiteral("person standing: dark skin tone"), QStringLiteral("person standing: dark skin tone")})},
-{QStringLiteral("man standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man standing: light skin tone"), QStringLiteral("man standing: light skin tone")})},
-{QStringLiteral("man standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man standing: medium-light skin tone"), QStringLiteral("man standing: medium-light skin tone")})},
-{QStringLiteral("man standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man standing: medium skin tone"), QStringLiteral("man standing: medium skin tone")})},
-{QStringLiteral("man standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man standing: medium-dark skin tone"), QStringLiteral("man standing: medium-dark skin tone")})},
-{QStringLiteral("man standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man standing: dark skin tone"), QStringLiteral("man standing: dark skin tone")})},
-{QStringLiteral("woman standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman standing: light skin tone"), QStringLiteral("woman standing: light skin tone")})},
-{QStringLiteral("woman standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman standing: medium-light skin tone"), QStringLiteral("woman standing: medium-light skin tone")})},
-{QStringLiteral("woman standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman standing: medium skin tone"), QStringLiteral("woman standing: medium skin tone")})},
-{QStringLiteral("woman standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman standing: medium-dark skin tone"), QStringLiteral("woman standing: medium-dark skin tone")})},
-{QStringLiteral("woman standing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CD\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman standing: dark skin tone"), QStringLiteral("woman standing: dark skin tone")})},
-{QStringLiteral("person kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FB"), QStringLiteral("person kneeling: light skin tone"), QStringLiteral("person kneeling: light skin tone")})},
-{QStringLiteral("person kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FC"), QStringLiteral("person kneeling: medium-light skin tone"), QStringLiteral("person kneeling: medium-light skin tone")})},
-{QStringLiteral("person kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FD"), QStringLiteral("person kneeling: medium skin tone"), QStringLiteral("person kneeling: medium skin tone")})},
-{QStringLiteral("person kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FE"), QStringLiteral("person kneeling: medium-dark skin tone"), QStringLiteral("person kneeling: medium-dark skin tone")})},
-{QStringLiteral("person kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FF"), QStringLiteral("person kneeling: dark skin tone"), QStringLiteral("person kneeling: dark skin tone")})},
-{QStringLiteral("man kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man kneeling: light skin tone"), QStringLiteral("man kneeling: light skin tone")})},
-{QStringLiteral("man kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man kneeling: medium-light skin tone"), QStringLiteral("man kneeling: medium-light skin tone")})},
-{QStringLiteral("man kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man kneeling: medium skin tone"), QStringLiteral("man kneeling: medium skin tone")})},
-{QStringLiteral("man kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man kneeling: medium-dark skin tone"), QStringLiteral("man kneeling: medium-dark skin tone")})},
-{QStringLiteral("man kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man kneeling: dark skin tone"), QStringLiteral("man kneeling: dark skin tone")})},
-{QStringLiteral("woman kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman kneeling: light skin tone"), QStringLiteral("woman kneeling: light skin tone")})},
-{QStringLiteral("woman kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman kneeling: medium-light skin tone"), QStringLiteral("woman kneeling: medium-light skin tone")})},
-{QStringLiteral("woman kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman kneeling: medium skin tone"), QStringLiteral("woman kneeling: medium skin tone")})},
-{QStringLiteral("woman kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman kneeling: medium-dark skin tone"), QStringLiteral("woman kneeling: medium-dark skin tone")})},
-{QStringLiteral("woman kneeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9CE\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman kneeling: dark skin tone"), QStringLiteral("woman kneeling: dark skin tone")})},
-{QStringLiteral("person with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F9AF"), QStringLiteral("person with white cane: light skin tone"), QStringLiteral("person with white cane: light skin tone")})},
-{QStringLiteral("person with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F9AF"), QStringLiteral("person with white cane: medium-light skin tone"), QStringLiteral("person with white cane: medium-light skin tone")})},
-{QStringLiteral("person with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F9AF"), QStringLiteral("person with white cane: medium skin tone"), QStringLiteral("person with white cane: medium skin tone")})},
-{QStringLiteral("person with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F9AF"), QStringLiteral("person with white cane: medium-dark skin tone"), QStringLiteral("person with white cane: medium-dark skin tone")})},
-{QStringLiteral("person with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F9AF"), QStringLiteral("person with white cane: dark skin tone"), QStringLiteral("person with white cane: dark skin tone")})},
-{QStringLiteral("man with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F9AF"), QStringLiteral("man with white cane: light skin tone"), QStringLiteral("man with white cane: light skin tone")})},
-{QStringLiteral("man with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F9AF"), QStringLiteral("man with white cane: medium-light skin tone"), QStringLiteral("man with white cane: medium-light skin tone")})},
-{QStringLiteral("man with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F9AF"), QStringLiteral("man with white cane: medium skin tone"), QStringLiteral("man with white cane: medium skin tone")})},
-{QStringLiteral("man with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F9AF"), QStringLiteral("man with white cane: medium-dark skin tone"), QStringLiteral("man with white cane: medium-dark skin tone")})},
-{QStringLiteral("man with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F9AF"), QStringLiteral("man with white cane: dark skin tone"), QStringLiteral("man with white cane: dark skin tone")})},
-{QStringLiteral("woman with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F9AF"), QStringLiteral("woman with white cane: light skin tone"), QStringLiteral("woman with white cane: light skin tone")})},
-{QStringLiteral("woman with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F9AF"), QStringLiteral("woman with white cane: medium-light skin tone"), QStringLiteral("woman with white cane: medium-light skin tone")})},
-{QStringLiteral("woman with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F9AF"), QStringLiteral("woman with white cane: medium skin tone"), QStringLiteral("woman with white cane: medium skin tone")})},
-{QStringLiteral("woman with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F9AF"), QStringLiteral("woman with white cane: medium-dark skin tone"), QStringLiteral("woman with white cane: medium-dark skin tone")})},
-{QStringLiteral("woman with white cane"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F9AF"), QStringLiteral("woman with white cane: dark skin tone"), QStringLiteral("woman with white cane: dark skin tone")})},
-{QStringLiteral("person in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F9BC"), QStringLiteral("person in motorized wheelchair: light skin tone"), QStringLiteral("person in motorized wheelchair: light skin tone")})},
-{QStringLiteral("person in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F9BC"), QStringLiteral("person in motorized wheelchair: medium-light skin tone"), QStringLiteral("person in motorized wheelchair: medium-light skin tone")})},
-{QStringLiteral("person in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F9BC"), QStringLiteral("person in motorized wheelchair: medium skin tone"), QStringLiteral("person in motorized wheelchair: medium skin tone")})},
-{QStringLiteral("person in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F9BC"), QStringLiteral("person in motorized wheelchair: medium-dark skin tone"), QStringLiteral("person in motorized wheelchair: medium-dark skin tone")})},
-{QStringLiteral("person in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F9BC"), QStringLiteral("person in motorized wheelchair: dark skin tone"), QStringLiteral("person in motorized wheelchair: dark skin tone")})},
-{QStringLiteral("man in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F9BC"), QStringLiteral("man in motorized wheelchair: light skin tone"), QStringLiteral("man in motorized wheelchair: light skin tone")})},
-{QStringLiteral("man in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F9BC"), QStringLiteral("man in motorized wheelchair: medium-light skin tone"), QStringLiteral("man in motorized wheelchair: medium-light skin tone")})},
-{QStringLiteral("man in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F9BC"), QStringLiteral("man in motorized wheelchair: medium skin tone"), QStringLiteral("man in motorized wheelchair: medium skin tone")})},
-{QStringLiteral("man in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F9BC"), QStringLiteral("man in motorized wheelchair: medium-dark skin tone"), QStringLiteral("man in motorized wheelchair: medium-dark skin tone")})},
-{QStringLiteral("man in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F9BC"), QStringLiteral("man in motorized wheelchair: dark skin tone"), QStringLiteral("man in motorized wheelchair: dark skin tone")})},
-{QStringLiteral("woman in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F9BC"), QStringLiteral("woman in motorized wheelchair: light skin tone"), QStringLiteral("woman in motorized wheelchair: light skin tone")})},
-{QStringLiteral("woman in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F9BC"), QStringLiteral("woman in motorized wheelchair: medium-light skin tone"), QStringLiteral("woman in motorized wheelchair: medium-light skin tone")})},
-{QStringLiteral("woman in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F9BC"), QStringLiteral("woman in motorized wheelchair: medium skin tone"), QStringLiteral("woman in motorized wheelchair: medium skin tone")})},
-{QStringLiteral("woman in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F9BC"), QStringLiteral("woman in motorized wheelchair: medium-dark skin tone"), QStringLiteral("woman in motorized wheelchair: medium-dark skin tone")})},
-{QStringLiteral("woman in motorized wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F9BC"), QStringLiteral("woman in motorized wheelchair: dark skin tone"), QStringLiteral("woman in motorized wheelchair: dark skin tone")})},
-{QStringLiteral("person in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F9BD"), QStringLiteral("person in manual wheelchair: light skin tone"), QStringLiteral("person in manual wheelchair: light skin tone")})},
-{QStringLiteral("person in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F9BD"), QStringLiteral("person in manual wheelchair: medium-light skin tone"), QStringLiteral("person in manual wheelchair: medium-light skin tone")})},
-{QStringLiteral("person in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F9BD"), QStringLiteral("person in manual wheelchair: medium skin tone"), QStringLiteral("person in manual wheelchair: medium skin tone")})},
-{QStringLiteral("person in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F9BD"), QStringLiteral("person in manual wheelchair: medium-dark skin tone"), QStringLiteral("person in manual wheelchair: medium-dark skin tone")})},
-{QStringLiteral("person in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F9BD"), QStringLiteral("person in manual wheelchair: dark skin tone"), QStringLiteral("person in manual wheelchair: dark skin tone")})},
-{QStringLiteral("man in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F9BD"), QStringLiteral("man in manual wheelchair: light skin tone"), QStringLiteral("man in manual wheelchair: light skin tone")})},
-{QStringLiteral("man in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F9BD"), QStringLiteral("man in manual wheelchair: medium-light skin tone"), QStringLiteral("man in manual wheelchair: medium-light skin tone")})},
-{QStringLiteral("man in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F9BD"), QStringLiteral("man in manual wheelchair: medium skin tone"), QStringLiteral("man in manual wheelchair: medium skin tone")})},
-{QStringLiteral("man in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F9BD"), QStringLiteral("man in manual wheelchair: medium-dark skin tone"), QStringLiteral("man in manual wheelchair: medium-dark skin tone")})},
-{QStringLiteral("man in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F9BD"), QStringLiteral("man in manual wheelchair: dark skin tone"), QStringLiteral("man in manual wheelchair: dark skin tone")})},
-{QStringLiteral("woman in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F9BD"), QStringLiteral("woman in manual wheelchair: light skin tone"), QStringLiteral("woman in manual wheelchair: light skin tone")})},
-{QStringLiteral("woman in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F9BD"), QStringLiteral("woman in manual wheelchair: medium-light skin tone"), QStringLiteral("woman in manual wheelchair: medium-light skin tone")})},
-{QStringLiteral("woman in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F9BD"), QStringLiteral("woman in manual wheelchair: medium skin tone"), QStringLiteral("woman in manual wheelchair: medium skin tone")})},
-{QStringLiteral("woman in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F9BD"), QStringLiteral("woman in manual wheelchair: medium-dark skin tone"), QStringLiteral("woman in manual wheelchair: medium-dark skin tone")})},
-{QStringLiteral("woman in manual wheelchair"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F9BD"), QStringLiteral("woman in manual wheelchair: dark skin tone"), QStringLiteral("woman in manual wheelchair: dark skin tone")})},
-{QStringLiteral("person running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FB"), QStringLiteral("runner_tone1"), QStringLiteral("person running: light skin tone")})},
-{QStringLiteral("person running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FC"), QStringLiteral("runner_tone2"), QStringLiteral("person running: medium-light skin tone")})},
-{QStringLiteral("person running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FD"), QStringLiteral("runner_tone3"), QStringLiteral("person running: medium skin tone")})},
-{QStringLiteral("person running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FE"), QStringLiteral("runner_tone4"), QStringLiteral("person running: medium-dark skin tone")})},
-{QStringLiteral("person running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FF"), QStringLiteral("runner_tone5"), QStringLiteral("person running: dark skin tone")})},
-{QStringLiteral("man running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man running: light skin tone"), QStringLiteral("man running: light skin tone")})},
-{QStringLiteral("man running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man running: medium-light skin tone"), QStringLiteral("man running: medium-light skin tone")})},
-{QStringLiteral("man running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man running: medium skin tone"), QStringLiteral("man running: medium skin tone")})},
-{QStringLiteral("man running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man running: medium-dark skin tone"), QStringLiteral("man running: medium-dark skin tone")})},
-{QStringLiteral("man running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man running: dark skin tone"), QStringLiteral("man running: dark skin tone")})},
-{QStringLiteral("woman running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman running: light skin tone"), QStringLiteral("woman running: light skin tone")})},
-{QStringLiteral("woman running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman running: medium-light skin tone"), QStringLiteral("woman running: medium-light skin tone")})},
-{QStringLiteral("woman running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman running: medium skin tone"), QStringLiteral("woman running: medium skin tone")})},
-{QStringLiteral("woman running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman running: medium-dark skin tone"), QStringLiteral("woman running: medium-dark skin tone")})},
-{QStringLiteral("woman running"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C3\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman running: dark skin tone"), QStringLiteral("woman running: dark skin tone")})},
-{QStringLiteral("woman dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F483\U0001F3FB"), QStringLiteral("dancer_tone1"), QStringLiteral("woman dancing: light skin tone")})},
-{QStringLiteral("woman dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F483\U0001F3FC"), QStringLiteral("dancer_tone2"), QStringLiteral("woman dancing: medium-light skin tone")})},
-{QStringLiteral("woman dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F483\U0001F3FD"), QStringLiteral("dancer_tone3"), QStringLiteral("woman dancing: medium skin tone")})},
-{QStringLiteral("woman dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F483\U0001F3FE"), QStringLiteral("dancer_tone4"), QStringLiteral("woman dancing: medium-dark skin tone")})},
-{QStringLiteral("woman dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F483\U0001F3FF"), QStringLiteral("dancer_tone5"), QStringLiteral("woman dancing: dark skin tone")})},
-{QStringLiteral("man dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F57A\U0001F3FB"), QStringLiteral("man_dancing_tone1"), QStringLiteral("man dancing: light skin tone")})},
-{QStringLiteral("man dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F57A\U0001F3FC"), QStringLiteral("man_dancing_tone2"), QStringLiteral("man dancing: medium-light skin tone")})},
-{QStringLiteral("man dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F57A\U0001F3FD"), QStringLiteral("man_dancing_tone3"), QStringLiteral("man dancing: medium skin tone")})},
-{QStringLiteral("man dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F57A\U0001F3FE"), QStringLiteral("man_dancing_tone4"), QStringLiteral("man dancing: medium-dark skin tone")})},
-{QStringLiteral("man dancing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F57A\U0001F3FF"), QStringLiteral("man_dancing_tone5"), QStringLiteral("man dancing: dark skin tone")})},
-{QStringLiteral("person in suit levitating"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F574\U0001F3FB"), QStringLiteral("levitate_tone1"), QStringLiteral("person in suit levitating: light skin tone")})},
-{QStringLiteral("person in suit levitating"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F574\U0001F3FC"), QStringLiteral("levitate_tone2"), QStringLiteral("person in suit levitating: medium-light skin tone")})},
-{QStringLiteral("person in suit levitating"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F574\U0001F3FD"), QStringLiteral("levitate_tone3"), QStringLiteral("person in suit levitating: medium skin tone")})},
-{QStringLiteral("person in suit levitating"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F574\U0001F3FE"), QStringLiteral("levitate_tone4"), QStringLiteral("person in suit levitating: medium-dark skin tone")})},
-{QStringLiteral("person in suit levitating"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F574\U0001F3FF"), QStringLiteral("levitate_tone5"), QStringLiteral("person in suit levitating: dark skin tone")})},
-{QStringLiteral("person in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FB"), QStringLiteral("person_in_steamy_room_tone1"), QStringLiteral("person in steamy room: light skin tone")})},
-{QStringLiteral("person in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FC"), QStringLiteral("person_in_steamy_room_tone2"), QStringLiteral("person in steamy room: medium-light skin tone")})},
-{QStringLiteral("person in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FD"), QStringLiteral("person_in_steamy_room_tone3"), QStringLiteral("person in steamy room: medium skin tone")})},
-{QStringLiteral("person in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FE"), QStringLiteral("person_in_steamy_room_tone4"), QStringLiteral("person in steamy room: medium-dark skin tone")})},
-{QStringLiteral("person in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FF"), QStringLiteral("person_in_steamy_room_tone5"), QStringLiteral("person in steamy room: dark skin tone")})},
-{QStringLiteral("man in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in steamy room: light skin tone"), QStringLiteral("man in steamy room: light skin tone")})},
-{QStringLiteral("man in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in steamy room: medium-light skin tone"), QStringLiteral("man in steamy room: medium-light skin tone")})},
-{QStringLiteral("man in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in steamy room: medium skin tone"), QStringLiteral("man in steamy room: medium skin tone")})},
-{QStringLiteral("man in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in steamy room: medium-dark skin tone"), QStringLiteral("man in steamy room: medium-dark skin tone")})},
-{QStringLiteral("man in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in steamy room: dark skin tone"), QStringLiteral("man in steamy room: dark skin tone")})},
-{QStringLiteral("woman in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in steamy room: light skin tone"), QStringLiteral("woman in steamy room: light skin tone")})},
-{QStringLiteral("woman in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in steamy room: medium-light skin tone"), QStringLiteral("woman in steamy room: medium-light skin tone")})},
-{QStringLiteral("woman in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in steamy room: medium skin tone"), QStringLiteral("woman in steamy room: medium skin tone")})},
-{QStringLiteral("woman in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in steamy room: medium-dark skin tone"), QStringLiteral("woman in steamy room: medium-dark skin tone")})},
-{QStringLiteral("woman in steamy room"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D6\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in steamy room: dark skin tone"), QStringLiteral("woman in steamy room: dark skin tone")})},
-{QStringLiteral("person climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FB"), QStringLiteral("person_climbing_tone1"), QStringLiteral("person climbing: light skin tone")})},
-{QStringLiteral("person climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FC"), QStringLiteral("person_climbing_tone2"), QStringLiteral("person climbing: medium-light skin tone")})},
-{QStringLiteral("person climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FD"), QStringLiteral("person_climbing_tone3"), QStringLiteral("person climbing: medium skin tone")})},
-{QStringLiteral("person climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FE"), QStringLiteral("person_climbing_tone4"), QStringLiteral("person climbing: medium-dark skin tone")})},
-{QStringLiteral("person climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FF"), QStringLiteral("person_climbing_tone5"), QStringLiteral("person climbing: dark skin tone")})},
-{QStringLiteral("man climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man climbing: light skin tone"), QStringLiteral("man climbing: light skin tone")})},
-{QStringLiteral("man climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man climbing: medium-light skin tone"), QStringLiteral("man climbing: medium-light skin tone")})},
-{QStringLiteral("man climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man climbing: medium skin tone"), QStringLiteral("man climbing: medium skin tone")})},
-{QStringLiteral("man climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man climbing: medium-dark skin tone"), QStringLiteral("man climbing: medium-dark skin tone")})},
-{QStringLiteral("man climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man climbing: dark skin tone"), QStringLiteral("man climbing: dark skin tone")})},
-{QStringLiteral("woman climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman climbing: light skin tone"), QStringLiteral("woman climbing: light skin tone")})},
-{QStringLiteral("woman climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman climbing: medium-light skin tone"), QStringLiteral("woman climbing: medium-light skin tone")})},
-{QStringLiteral("woman climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman climbing: medium skin tone"), QStringLiteral("woman climbing: medium skin tone")})},
-{QStringLiteral("woman climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman climbing: medium-dark skin tone"), QStringLiteral("woman climbing: medium-dark skin tone")})},
-{QStringLiteral("woman climbing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D7\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman climbing: dark skin tone"), QStringLiteral("woman climbing: dark skin tone")})},
-{QStringLiteral("horse racing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C7\U0001F3FB"), QStringLiteral("horse_racing_tone1"), QStringLiteral("horse racing: light skin tone")})},
-{QStringLiteral("horse racing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C7\U0001F3FC"), QStringLiteral("horse_racing_tone2"), QStringLiteral("horse racing: medium-light skin tone")})},
-{QStringLiteral("horse racing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C7\U0001F3FD"), QStringLiteral("horse_racing_tone3"), QStringLiteral("horse racing: medium skin tone")})},
-{QStringLiteral("horse racing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C7\U0001F3FE"), QStringLiteral("horse_racing_tone4"), QStringLiteral("horse racing: medium-dark skin tone")})},
-{QStringLiteral("horse racing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C7\U0001F3FF"), QStringLiteral("horse_racing_tone5"), QStringLiteral("horse racing: dark skin tone")})},
-{QStringLiteral("snowboarder"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C2\U0001F3FB"), QStringLiteral("snowboarder_tone1"), QStringLiteral("snowboarder: light skin tone")})},
-{QStringLiteral("snowboarder"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C2\U0001F3FC"), QStringLiteral("snowboarder_tone2"), QStringLiteral("snowboarder: medium-light skin tone")})},
-{QStringLiteral("snowboarder"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C2\U0001F3FD"), QStringLiteral("snowboarder_tone3"), QStringLiteral("snowboarder: medium skin tone")})},
-{QStringLiteral("snowboarder"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C2\U0001F3FE"), QStringLiteral("snowboarder_tone4"), QStringLiteral("snowboarder: medium-dark skin tone")})},
-{QStringLiteral("snowboarder"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C2\U0001F3FF"), QStringLiteral("snowboarder_tone5"), QStringLiteral("snowboarder: dark skin tone")})},
-{QStringLiteral("person golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FB"), QStringLiteral("person_golfing_tone1"), QStringLiteral("person golfing: light skin tone")})},
-{QStringLiteral("person golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FC"), QStringLiteral("person_golfing_tone2"), QStringLiteral("person golfing: medium-light skin tone")})},
-{QStringLiteral("person golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FD"), QStringLiteral("person_golfing_tone3"), QStringLiteral("person golfing: medium skin tone")})},
-{QStringLiteral("person golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FE"), QStringLiteral("person_golfing_tone4"), QStringLiteral("person golfing: medium-dark skin tone")})},
-{QStringLiteral("person golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FF"), QStringLiteral("person_golfing_tone5"), QStringLiteral("person golfing: dark skin tone")})},
-{QStringLiteral("man golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man golfing: light skin tone"), QStringLiteral("man golfing: light skin tone")})},
-{QStringLiteral("man golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man golfing: medium-light skin tone"), QStringLiteral("man golfing: medium-light skin tone")})},
-{QStringLiteral("man golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man golfing: medium skin tone"), QStringLiteral("man golfing: medium skin tone")})},
-{QStringLiteral("man golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man golfing: medium-dark skin tone"), QStringLiteral("man golfing: medium-dark skin tone")})},
-{QStringLiteral("man golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man golfing: dark skin tone"), QStringLiteral("man golfing: dark skin tone")})},
-{QStringLiteral("woman golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman golfing: light skin tone"), QStringLiteral("woman golfing: light skin tone")})},
-{QStringLiteral("woman golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman golfing: medium-light skin tone"), QStringLiteral("woman golfing: medium-light skin tone")})},
-{QStringLiteral("woman golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman golfing: medium skin tone"), QStringLiteral("woman golfing: medium skin tone")})},
-{QStringLiteral("woman golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman golfing: medium-dark skin tone"), QStringLiteral("woman golfing: medium-dark skin tone")})},
-{QStringLiteral("woman golfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CC\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman golfing: dark skin tone"), QStringLiteral("woman golfing: dark skin tone")})},
-{QStringLiteral("person surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FB"), QStringLiteral("surfer_tone1"), QStringLiteral("person surfing: light skin tone")})},
-{QStringLiteral("person surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FC"), QStringLiteral("surfer_tone2"), QStringLiteral("person surfing: medium-light skin tone")})},
-{QStringLiteral("person surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FD"), QStringLiteral("surfer_tone3"), QStringLiteral("person surfing: medium skin tone")})},
-{QStringLiteral("person surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FE"), QStringLiteral("surfer_tone4"), QStringLiteral("person surfing: medium-dark skin tone")})},
-{QStringLiteral("person surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FF"), QStringLiteral("surfer_tone5"), QStringLiteral("person surfing: dark skin tone")})},
-{QStringLiteral("man surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man surfing: light skin tone"), QStringLiteral("man surfing: light skin tone")})},
-{QStringLiteral("man surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man surfing: medium-light skin tone"), QStringLiteral("man surfing: medium-light skin tone")})},
-{QStringLiteral("man surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man surfing: medium skin tone"), QStringLiteral("man surfing: medium skin tone")})},
-{QStringLiteral("man surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man surfing: medium-dark skin tone"), QStringLiteral("man surfing: medium-dark skin tone")})},
-{QStringLiteral("man surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man surfing: dark skin tone"), QStringLiteral("man surfing: dark skin tone")})},
-{QStringLiteral("woman surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman surfing: light skin tone"), QStringLiteral("woman surfing: light skin tone")})},
-{QStringLiteral("woman surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman surfing: medium-light skin tone"), QStringLiteral("woman surfing: medium-light skin tone")})},
-{QStringLiteral("woman surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman surfing: medium skin tone"), QStringLiteral("woman surfing: medium skin tone")})},
-{QStringLiteral("woman surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman surfing: medium-dark skin tone"), QStringLiteral("woman surfing: medium-dark skin tone")})},
-{QStringLiteral("woman surfing"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3C4\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman surfing: dark skin tone"), QStringLiteral("woman surfing: dark skin tone")})},
-{QStringLiteral("person rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FB"), QStringLiteral("rowboat_tone1"), QStringLiteral("person rowing boat: light skin tone")})},
-{QStringLiteral("person rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FC"), QStringLiteral("rowboat_tone2"), QStringLiteral("person rowing boat: medium-light skin tone")})},
-{QStringLiteral("person rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FD"), QStringLiteral("rowboat_tone3"), QStringLiteral("person rowing boat: medium skin tone")})},
-{QStringLiteral("person rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FE"), QStringLiteral("rowboat_tone4"), QStringLiteral("person rowing boat: medium-dark skin tone")})},
-{QStringLiteral("person rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FF"), QStringLiteral("rowboat_tone5"), QStringLiteral("person rowing boat: dark skin tone")})},
-{QStringLiteral("man rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man rowing boat: light skin tone"), QStringLiteral("man rowing boat: light skin tone")})},
-{QStringLiteral("man rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man rowing boat: medium-light skin tone"), QStringLiteral("man rowing boat: medium-light skin tone")})},
-{QStringLiteral("man rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man rowing boat: medium skin tone"), QStringLiteral("man rowing boat: medium skin tone")})},
-{QStringLiteral("man rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man rowing boat: medium-dark skin tone"), QStringLiteral("man rowing boat: medium-dark skin tone")})},
-{QStringLiteral("man rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man rowing boat: dark skin tone"), QStringLiteral("man rowing boat: dark skin tone")})},
-{QStringLiteral("woman rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman rowing boat: light skin tone"), QStringLiteral("woman rowing boat: light skin tone")})},
-{QStringLiteral("woman rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman rowing boat: medium-light skin tone"), QStringLiteral("woman rowing boat: medium-light skin tone")})},
-{QStringLiteral("woman rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman rowing boat: medium skin tone"), QStringLiteral("woman rowing boat: medium skin tone")})},
-{QStringLiteral("woman rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman rowing boat: medium-dark skin tone"), QStringLiteral("woman rowing boat: medium-dark skin tone")})},
-{QStringLiteral("woman rowing boat"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6A3\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman rowing boat: dark skin tone"), QStringLiteral("woman rowing boat: dark skin tone")})},
-{QStringLiteral("person swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FB"), QStringLiteral("swimmer_tone1"), QStringLiteral("person swimming: light skin tone")})},
-{QStringLiteral("person swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FC"), QStringLiteral("swimmer_tone2"), QStringLiteral("person swimming: medium-light skin tone")})},
-{QStringLiteral("person swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FD"), QStringLiteral("swimmer_tone3"), QStringLiteral("person swimming: medium skin tone")})},
-{QStringLiteral("person swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FE"), QStringLiteral("swimmer_tone4"), QStringLiteral("person swimming: medium-dark skin tone")})},
-{QStringLiteral("person swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FF"), QStringLiteral("swimmer_tone5"), QStringLiteral("person swimming: dark skin tone")})},
-{QStringLiteral("man swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man swimming: light skin tone"), QStringLiteral("man swimming: light skin tone")})},
-{QStringLiteral("man swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man swimming: medium-light skin tone"), QStringLiteral("man swimming: medium-light skin tone")})},
-{QStringLiteral("man swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man swimming: medium skin tone"), QStringLiteral("man swimming: medium skin tone")})},
-{QStringLiteral("man swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man swimming: medium-dark skin tone"), QStringLiteral("man swimming: medium-dark skin tone")})},
-{QStringLiteral("man swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man swimming: dark skin tone"), QStringLiteral("man swimming: dark skin tone")})},
-{QStringLiteral("woman swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman swimming: light skin tone"), QStringLiteral("woman swimming: light skin tone")})},
-{QStringLiteral("woman swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman swimming: medium-light skin tone"), QStringLiteral("woman swimming: medium-light skin tone")})},
-{QStringLiteral("woman swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman swimming: medium skin tone"), QStringLiteral("woman swimming: medium skin tone")})},
-{QStringLiteral("woman swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman swimming: medium-dark skin tone"), QStringLiteral("woman swimming: medium-dark skin tone")})},
-{QStringLiteral("woman swimming"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CA\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman swimming: dark skin tone"), QStringLiteral("woman swimming: dark skin tone")})},
-{QStringLiteral("person bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FB"), QStringLiteral("basketball_player_tone1"), QStringLiteral("person bouncing ball: light skin tone")})},
-{QStringLiteral("person bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FC"), QStringLiteral("basketball_player_tone2"), QStringLiteral("person bouncing ball: medium-light skin tone")})},
-{QStringLiteral("person bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FD"), QStringLiteral("basketball_player_tone3"), QStringLiteral("person bouncing ball: medium skin tone")})},
-{QStringLiteral("person bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FE"), QStringLiteral("basketball_player_tone4"), QStringLiteral("person bouncing ball: medium-dark skin tone")})},
-{QStringLiteral("person bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FF"), QStringLiteral("basketball_player_tone5"), QStringLiteral("person bouncing ball: dark skin tone")})},
-{QStringLiteral("man bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bouncing ball: light skin tone"), QStringLiteral("man bouncing ball: light skin tone")})},
-{QStringLiteral("man bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bouncing ball: medium-light skin tone"), QStringLiteral("man bouncing ball: medium-light skin tone")})},
-{QStringLiteral("man bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bouncing ball: medium skin tone"), QStringLiteral("man bouncing ball: medium skin tone")})},
-{QStringLiteral("man bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bouncing ball: medium-dark skin tone"), QStringLiteral("man bouncing ball: medium-dark skin tone")})},
-{QStringLiteral("man bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man bouncing ball: dark skin tone"), QStringLiteral("man bouncing ball: dark skin tone")})},
-{QStringLiteral("woman bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bouncing ball: light skin tone"), QStringLiteral("woman bouncing ball: light skin tone")})},
-{QStringLiteral("woman bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bouncing ball: medium-light skin tone"), QStringLiteral("woman bouncing ball: medium-light skin tone")})},
-{QStringLiteral("woman bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bouncing ball: medium skin tone"), QStringLiteral("woman bouncing ball: medium skin tone")})},
-{QStringLiteral("woman bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bouncing ball: medium-dark skin tone"), QStringLiteral("woman bouncing ball: medium-dark skin tone")})},
-{QStringLiteral("woman bouncing ball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U000026F9\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman bouncing ball: dark skin tone"), QStringLiteral("woman bouncing ball: dark skin tone")})},
-{QStringLiteral("person lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FB"), QStringLiteral("lifter_tone1"), QStringLiteral("person lifting weights: light skin tone")})},
-{QStringLiteral("person lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FC"), QStringLiteral("lifter_tone2"), QStringLiteral("person lifting weights: medium-light skin tone")})},
-{QStringLiteral("person lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FD"), QStringLiteral("lifter_tone3"), QStringLiteral("person lifting weights: medium skin tone")})},
-{QStringLiteral("person lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FE"), QStringLiteral("lifter_tone4"), QStringLiteral("person lifting weights: medium-dark skin tone")})},
-{QStringLiteral("person lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FF"), QStringLiteral("lifter_tone5"), QStringLiteral("person lifting weights: dark skin tone")})},
-{QStringLiteral("man lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man lifting weights: light skin tone"), QStringLiteral("man lifting weights: light skin tone")})},
-{QStringLiteral("man lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man lifting weights: medium-light skin tone"), QStringLiteral("man lifting weights: medium-light skin tone")})},
-{QStringLiteral("man lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man lifting weights: medium skin tone"), QStringLiteral("man lifting weights: medium skin tone")})},
-{QStringLiteral("man lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man lifting weights: medium-dark skin tone"), QStringLiteral("man lifting weights: medium-dark skin tone")})},
-{QStringLiteral("man lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man lifting weights: dark skin tone"), QStringLiteral("man lifting weights: dark skin tone")})},
-{QStringLiteral("woman lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman lifting weights: light skin tone"), QStringLiteral("woman lifting weights: light skin tone")})},
-{QStringLiteral("woman lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman lifting weights: medium-light skin tone"), QStringLiteral("woman lifting weights: medium-light skin tone")})},
-{QStringLiteral("woman lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman lifting weights: medium skin tone"), QStringLiteral("woman lifting weights: medium skin tone")})},
-{QStringLiteral("woman lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman lifting weights: medium-dark skin tone"), QStringLiteral("woman lifting weights: medium-dark skin tone")})},
-{QStringLiteral("woman lifting weights"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3CB\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman lifting weights: dark skin tone"), QStringLiteral("woman lifting weights: dark skin tone")})},
-{QStringLiteral("person biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FB"), QStringLiteral("bicyclist_tone1"), QStringLiteral("person biking: light skin tone")})},
-{QStringLiteral("person biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FC"), QStringLiteral("bicyclist_tone2"), QStringLiteral("person biking: medium-light skin tone")})},
-{QStringLiteral("person biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FD"), QStringLiteral("bicyclist_tone3"), QStringLiteral("person biking: medium skin tone")})},
-{QStringLiteral("person biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FE"), QStringLiteral("bicyclist_tone4"), QStringLiteral("person biking: medium-dark skin tone")})},
-{QStringLiteral("person biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FF"), QStringLiteral("bicyclist_tone5"), QStringLiteral("person biking: dark skin tone")})},
-{QStringLiteral("man biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man biking: light skin tone"), QStringLiteral("man biking: light skin tone")})},
-{QStringLiteral("man biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man biking: medium-light skin tone"), QStringLiteral("man biking: medium-light skin tone")})},
-{QStringLiteral("man biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man biking: medium skin tone"), QStringLiteral("man biking: medium skin tone")})},
-{QStringLiteral("man biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man biking: medium-dark skin tone"), QStringLiteral("man biking: medium-dark skin tone")})},
-{QStringLiteral("man biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man biking: dark skin tone"), QStringLiteral("man biking: dark skin tone")})},
-{QStringLiteral("woman biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman biking: light skin tone"), QStringLiteral("woman biking: light skin tone")})},
-{QStringLiteral("woman biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman biking: medium-light skin tone"), QStringLiteral("woman biking: medium-light skin tone")})},
-{QStringLiteral("woman biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman biking: medium skin tone"), QStringLiteral("woman biking: medium skin tone")})},
-{QStringLiteral("woman biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman biking: medium-dark skin tone"), QStringLiteral("woman biking: medium-dark skin tone")})},
-{QStringLiteral("woman biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B4\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman biking: dark skin tone"), QStringLiteral("woman biking: dark skin tone")})},
-{QStringLiteral("person mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FB"), QStringLiteral("mountain_bicyclist_tone1"), QStringLiteral("person mountain biking: light skin tone")})},
-{QStringLiteral("person mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FC"), QStringLiteral("mountain_bicyclist_tone2"), QStringLiteral("person mountain biking: medium-light skin tone")})},
-{QStringLiteral("person mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FD"), QStringLiteral("mountain_bicyclist_tone3"), QStringLiteral("person mountain biking: medium skin tone")})},
-{QStringLiteral("person mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FE"), QStringLiteral("mountain_bicyclist_tone4"), QStringLiteral("person mountain biking: medium-dark skin tone")})},
-{QStringLiteral("person mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FF"), QStringLiteral("mountain_bicyclist_tone5"), QStringLiteral("person mountain biking: dark skin tone")})},
-{QStringLiteral("man mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mountain biking: light skin tone"), QStringLiteral("man mountain biking: light skin tone")})},
-{QStringLiteral("man mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mountain biking: medium-light skin tone"), QStringLiteral("man mountain biking: medium-light skin tone")})},
-{QStringLiteral("man mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mountain biking: medium skin tone"), QStringLiteral("man mountain biking: medium skin tone")})},
-{QStringLiteral("man mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mountain biking: medium-dark skin tone"), QStringLiteral("man mountain biking: medium-dark skin tone")})},
-{QStringLiteral("man mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man mountain biking: dark skin tone"), QStringLiteral("man mountain biking: dark skin tone")})},
-{QStringLiteral("woman mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mountain biking: light skin tone"), QStringLiteral("woman mountain biking: light skin tone")})},
-{QStringLiteral("woman mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mountain biking: medium-light skin tone"), QStringLiteral("woman mountain biking: medium-light skin tone")})},
-{QStringLiteral("woman mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mountain biking: medium skin tone"), QStringLiteral("woman mountain biking: medium skin tone")})},
-{QStringLiteral("woman mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mountain biking: medium-dark skin tone"), QStringLiteral("woman mountain biking: medium-dark skin tone")})},
-{QStringLiteral("woman mountain biking"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6B5\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman mountain biking: dark skin tone"), QStringLiteral("woman mountain biking: dark skin tone")})},
-{QStringLiteral("person cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FB"), QStringLiteral("cartwheel_tone1"), QStringLiteral("person cartwheeling: light skin tone")})},
-{QStringLiteral("person cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FC"), QStringLiteral("cartwheel_tone2"), QStringLiteral("person cartwheeling: medium-light skin tone")})},
-{QStringLiteral("person cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FD"), QStringLiteral("cartwheel_tone3"), QStringLiteral("person cartwheeling: medium skin tone")})},
-{QStringLiteral("person cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FE"), QStringLiteral("cartwheel_tone4"), QStringLiteral("person cartwheeling: medium-dark skin tone")})},
-{QStringLiteral("person cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FF"), QStringLiteral("cartwheel_tone5"), QStringLiteral("person cartwheeling: dark skin tone")})},
-{QStringLiteral("man cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man cartwheeling: light skin tone"), QStringLiteral("man cartwheeling: light skin tone")})},
-{QStringLiteral("man cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man cartwheeling: medium-light skin tone"), QStringLiteral("man cartwheeling: medium-light skin tone")})},
-{QStringLiteral("man cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man cartwheeling: medium skin tone"), QStringLiteral("man cartwheeling: medium skin tone")})},
-{QStringLiteral("man cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man cartwheeling: medium-dark skin tone"), QStringLiteral("man cartwheeling: medium-dark skin tone")})},
-{QStringLiteral("man cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man cartwheeling: dark skin tone"), QStringLiteral("man cartwheeling: dark skin tone")})},
-{QStringLiteral("woman cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman cartwheeling: light skin tone"), QStringLiteral("woman cartwheeling: light skin tone")})},
-{QStringLiteral("woman cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman cartwheeling: medium-light skin tone"), QStringLiteral("woman cartwheeling: medium-light skin tone")})},
-{QStringLiteral("woman cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman cartwheeling: medium skin tone"), QStringLiteral("woman cartwheeling: medium skin tone")})},
-{QStringLiteral("woman cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman cartwheeling: medium-dark skin tone"), QStringLiteral("woman cartwheeling: medium-dark skin tone")})},
-{QStringLiteral("woman cartwheeling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F938\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman cartwheeling: dark skin tone"), QStringLiteral("woman cartwheeling: dark skin tone")})},
-{QStringLiteral("person playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FB"), QStringLiteral("water_polo_tone1"), QStringLiteral("person playing water polo: light skin tone")})},
-{QStringLiteral("person playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FC"), QStringLiteral("water_polo_tone2"), QStringLiteral("person playing water polo: medium-light skin tone")})},
-{QStringLiteral("person playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FD"), QStringLiteral("water_polo_tone3"), QStringLiteral("person playing water polo: medium skin tone")})},
-{QStringLiteral("person playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FE"), QStringLiteral("water_polo_tone4"), QStringLiteral("person playing water polo: medium-dark skin tone")})},
-{QStringLiteral("person playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FF"), QStringLiteral("water_polo_tone5"), QStringLiteral("person playing water polo: dark skin tone")})},
-{QStringLiteral("man playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing water polo: light skin tone"), QStringLiteral("man playing water polo: light skin tone")})},
-{QStringLiteral("man playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing water polo: medium-light skin tone"), QStringLiteral("man playing water polo: medium-light skin tone")})},
-{QStringLiteral("man playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing water polo: medium skin tone"), QStringLiteral("man playing water polo: medium skin tone")})},
-{QStringLiteral("man playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing water polo: medium-dark skin tone"), QStringLiteral("man playing water polo: medium-dark skin tone")})},
-{QStringLiteral("man playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing water polo: dark skin tone"), QStringLiteral("man playing water polo: dark skin tone")})},
-{QStringLiteral("woman playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing water polo: light skin tone"), QStringLiteral("woman playing water polo: light skin tone")})},
-{QStringLiteral("woman playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing water polo: medium-light skin tone"), QStringLiteral("woman playing water polo: medium-light skin tone")})},
-{QStringLiteral("woman playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing water polo: medium skin tone"), QStringLiteral("woman playing water polo: medium skin tone")})},
-{QStringLiteral("woman playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing water polo: medium-dark skin tone"), QStringLiteral("woman playing water polo: medium-dark skin tone")})},
-{QStringLiteral("woman playing water polo"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93D\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing water polo: dark skin tone"), QStringLiteral("woman playing water polo: dark skin tone")})},
-{QStringLiteral("person playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FB"), QStringLiteral("handball_tone1"), QStringLiteral("person playing handball: light skin tone")})},
-{QStringLiteral("person playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FC"), QStringLiteral("handball_tone2"), QStringLiteral("person playing handball: medium-light skin tone")})},
-{QStringLiteral("person playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FD"), QStringLiteral("handball_tone3"), QStringLiteral("person playing handball: medium skin tone")})},
-{QStringLiteral("person playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FE"), QStringLiteral("handball_tone4"), QStringLiteral("person playing handball: medium-dark skin tone")})},
-{QStringLiteral("person playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FF"), QStringLiteral("handball_tone5"), QStringLiteral("person playing handball: dark skin tone")})},
-{QStringLiteral("man playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing handball: light skin tone"), QStringLiteral("man playing handball: light skin tone")})},
-{QStringLiteral("man playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing handball: medium-light skin tone"), QStringLiteral("man playing handball: medium-light skin tone")})},
-{QStringLiteral("man playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing handball: medium skin tone"), QStringLiteral("man playing handball: medium skin tone")})},
-{QStringLiteral("man playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing handball: medium-dark skin tone"), QStringLiteral("man playing handball: medium-dark skin tone")})},
-{QStringLiteral("man playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man playing handball: dark skin tone"), QStringLiteral("man playing handball: dark skin tone")})},
-{QStringLiteral("woman playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing handball: light skin tone"), QStringLiteral("woman playing handball: light skin tone")})},
-{QStringLiteral("woman playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing handball: medium-light skin tone"), QStringLiteral("woman playing handball: medium-light skin tone")})},
-{QStringLiteral("woman playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing handball: medium skin tone"), QStringLiteral("woman playing handball: medium skin tone")})},
-{QStringLiteral("woman playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing handball: medium-dark skin tone"), QStringLiteral("woman playing handball: medium-dark skin tone")})},
-{QStringLiteral("woman playing handball"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F93E\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman playing handball: dark skin tone"), QStringLiteral("woman playing handball: dark skin tone")})},
-{QStringLiteral("person juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FB"), QStringLiteral("juggling_tone1"), QStringLiteral("person juggling: light skin tone")})},
-{QStringLiteral("person juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FC"), QStringLiteral("juggling_tone2"), QStringLiteral("person juggling: medium-light skin tone")})},
-{QStringLiteral("person juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FD"), QStringLiteral("juggling_tone3"), QStringLiteral("person juggling: medium skin tone")})},
-{QStringLiteral("person juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FE"), QStringLiteral("juggling_tone4"), QStringLiteral("person juggling: medium-dark skin tone")})},
-{QStringLiteral("person juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FF"), QStringLiteral("juggling_tone5"), QStringLiteral("person juggling: dark skin tone")})},
-{QStringLiteral("man juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man juggling: light skin tone"), QStringLiteral("man juggling: light skin tone")})},
-{QStringLiteral("man juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man juggling: medium-light skin tone"), QStringLiteral("man juggling: medium-light skin tone")})},
-{QStringLiteral("man juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man juggling: medium skin tone"), QStringLiteral("man juggling: medium skin tone")})},
-{QStringLiteral("man juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man juggling: medium-dark skin tone"), QStringLiteral("man juggling: medium-dark skin tone")})},
-{QStringLiteral("man juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man juggling: dark skin tone"), QStringLiteral("man juggling: dark skin tone")})},
-{QStringLiteral("woman juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman juggling: light skin tone"), QStringLiteral("woman juggling: light skin tone")})},
-{QStringLiteral("woman juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman juggling: medium-light skin tone"), QStringLiteral("woman juggling: medium-light skin tone")})},
-{QStringLiteral("woman juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman juggling: medium skin tone"), QStringLiteral("woman juggling: medium skin tone")})},
-{QStringLiteral("woman juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman juggling: medium-dark skin tone"), QStringLiteral("woman juggling: medium-dark skin tone")})},
-{QStringLiteral("woman juggling"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F939\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman juggling: dark skin tone"), QStringLiteral("woman juggling: dark skin tone")})},
-{QStringLiteral("person in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FB"), QStringLiteral("person_in_lotus_position_tone1"), QStringLiteral("person in lotus position: light skin tone")})},
-{QStringLiteral("person in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FC"), QStringLiteral("person_in_lotus_position_tone2"), QStringLiteral("person in lotus position: medium-light skin tone")})},
-{QStringLiteral("person in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FD"), QStringLiteral("person_in_lotus_position_tone3"), QStringLiteral("person in lotus position: medium skin tone")})},
-{QStringLiteral("person in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FE"), QStringLiteral("person_in_lotus_position_tone4"), QStringLiteral("person in lotus position: medium-dark skin tone")})},
-{QStringLiteral("person in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FF"), QStringLiteral("person_in_lotus_position_tone5"), QStringLiteral("person in lotus position: dark skin tone")})},
-{QStringLiteral("man in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FB\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in lotus position: light skin tone"), QStringLiteral("man in lotus position: light skin tone")})},
-{QStringLiteral("man in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FC\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in lotus position: medium-light skin tone"), QStringLiteral("man in lotus position: medium-light skin tone")})},
-{QStringLiteral("man in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FD\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in lotus position: medium skin tone"), QStringLiteral("man in lotus position: medium skin tone")})},
-{QStringLiteral("man in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FE\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in lotus position: medium-dark skin tone"), QStringLiteral("man in lotus position: medium-dark skin tone")})},
-{QStringLiteral("man in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FF\U0000200D\U00002642\U0000FE0F"), QStringLiteral("man in lotus position: dark skin tone"), QStringLiteral("man in lotus position: dark skin tone")})},
-{QStringLiteral("woman in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FB\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in lotus position: light skin tone"), QStringLiteral("woman in lotus position: light skin tone")})},
-{QStringLiteral("woman in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FC\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in lotus position: medium-light skin tone"), QStringLiteral("woman in lotus position: medium-light skin tone")})},
-{QStringLiteral("woman in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FD\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in lotus position: medium skin tone"), QStringLiteral("woman in lotus position: medium skin tone")})},
-{QStringLiteral("woman in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FE\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in lotus position: medium-dark skin tone"), QStringLiteral("woman in lotus position: medium-dark skin tone")})},
-{QStringLiteral("woman in lotus position"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D8\U0001F3FF\U0000200D\U00002640\U0000FE0F"), QStringLiteral("woman in lotus position: dark skin tone"), QStringLiteral("woman in lotus position: dark skin tone")})},
-{QStringLiteral("person taking bath"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C0\U0001F3FB"), QStringLiteral("bath_tone1"), QStringLiteral("person taking bath: light skin tone")})},
-{QStringLiteral("person taking bath"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C0\U0001F3FC"), QStringLiteral("bath_tone2"), QStringLiteral("person taking bath: medium-light skin tone")})},
-{QStringLiteral("person taking bath"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C0\U0001F3FD"), QStringLiteral("bath_tone3"), QStringLiteral("person taking bath: medium skin tone")})},
-{QStringLiteral("person taking bath"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C0\U0001F3FE"), QStringLiteral("bath_tone4"), QStringLiteral("person taking bath: medium-dark skin tone")})},
-{QStringLiteral("person taking bath"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6C0\U0001F3FF"), QStringLiteral("bath_tone5"), QStringLiteral("person taking bath: dark skin tone")})},
-{QStringLiteral("person in bed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CC\U0001F3FB"), QStringLiteral("person_in_bed_tone1"), QStringLiteral("person in bed: light skin tone")})},
-{QStringLiteral("person in bed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CC\U0001F3FC"), QStringLiteral("person_in_bed_tone2"), QStringLiteral("person in bed: medium-light skin tone")})},
-{QStringLiteral("person in bed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CC\U0001F3FD"), QStringLiteral("person_in_bed_tone3"), QStringLiteral("person in bed: medium skin tone")})},
-{QStringLiteral("person in bed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CC\U0001F3FE"), QStringLiteral("person_in_bed_tone4"), QStringLiteral("person in bed: medium-dark skin tone")})},
-{QStringLiteral("person in bed"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F6CC\U0001F3FF"), QStringLiteral("person_in_bed_tone5"), QStringLiteral("person in bed: dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("people holding hands: light skin tone"), QStringLiteral("people holding hands: light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("people holding hands: light skin tone, medium-light skin tone"), QStringLiteral("people holding hands: light skin tone, medium-light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("people holding hands: light skin tone, medium skin tone"), QStringLiteral("people holding hands: light skin tone, medium skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("people holding hands: light skin tone, medium-dark skin tone"), QStringLiteral("people holding hands: light skin tone, medium-dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("people holding hands: light skin tone, dark skin tone"), QStringLiteral("people holding hands: light skin tone, dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("people holding hands: medium-light skin tone, light skin tone"), QStringLiteral("people holding hands: medium-light skin tone, light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("people holding hands: medium-light skin tone"), QStringLiteral("people holding hands: medium-light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("people holding hands: medium-light skin tone, medium skin tone"), QStringLiteral("people holding hands: medium-light skin tone, medium skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("people holding hands: medium-light skin tone, medium-dark skin tone"), QStringLiteral("people holding hands: medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("people holding hands: medium-light skin tone, dark skin tone"), QStringLiteral("people holding hands: medium-light skin tone, dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("people holding hands: medium skin tone, light skin tone"), QStringLiteral("people holding hands: medium skin tone, light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("people holding hands: medium skin tone, medium-light skin tone"), QStringLiteral("people holding hands: medium skin tone, medium-light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("people holding hands: medium skin tone"), QStringLiteral("people holding hands: medium skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("people holding hands: medium skin tone, medium-dark skin tone"), QStringLiteral("people holding hands: medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("people holding hands: medium skin tone, dark skin tone"), QStringLiteral("people holding hands: medium skin tone, dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("people holding hands: medium-dark skin tone, light skin tone"), QStringLiteral("people holding hands: medium-dark skin tone, light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("people holding hands: medium-dark skin tone, medium-light skin tone"), QStringLiteral("people holding hands: medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("people holding hands: medium-dark skin tone, medium skin tone"), QStringLiteral("people holding hands: medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("people holding hands: medium-dark skin tone"), QStringLiteral("people holding hands: medium-dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("people holding hands: medium-dark skin tone, dark skin tone"), QStringLiteral("people holding hands: medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("people holding hands: dark skin tone, light skin tone"), QStringLiteral("people holding hands: dark skin tone, light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("people holding hands: dark skin tone, medium-light skin tone"), QStringLiteral("people holding hands: dark skin tone, medium-light skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("people holding hands: dark skin tone, medium skin tone"), QStringLiteral("people holding hands: dark skin tone, medium skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("people holding hands: dark skin tone, medium-dark skin tone"), QStringLiteral("people holding hands: dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("people holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("people holding hands: dark skin tone"), QStringLiteral("people holding hands: dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46D\U0001F3FB"), QStringLiteral("women holding hands: light skin tone"), QStringLiteral("women holding hands: light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("women holding hands: light skin tone, medium-light skin tone"), QStringLiteral("women holding hands: light skin tone, medium-light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("women holding hands: light skin tone, medium skin tone"), QStringLiteral("women holding hands: light skin tone, medium skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("women holding hands: light skin tone, medium-dark skin tone"), QStringLiteral("women holding hands: light skin tone, medium-dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("women holding hands: light skin tone, dark skin tone"), QStringLiteral("women holding hands: light skin tone, dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("women holding hands: medium-light skin tone, light skin tone"), QStringLiteral("women holding hands: medium-light skin tone, light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46D\U0001F3FC"), QStringLiteral("women holding hands: medium-light skin tone"), QStringLiteral("women holding hands: medium-light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("women holding hands: medium-light skin tone, medium skin tone"), QStringLiteral("women holding hands: medium-light skin tone, medium skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("women holding hands: medium-light skin tone, medium-dark skin tone"), QStringLiteral("women holding hands: medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("women holding hands: medium-light skin tone, dark skin tone"), QStringLiteral("women holding hands: medium-light skin tone, dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("women holding hands: medium skin tone, light skin tone"), QStringLiteral("women holding hands: medium skin tone, light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("women holding hands: medium skin tone, medium-light skin tone"), QStringLiteral("women holding hands: medium skin tone, medium-light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46D\U0001F3FD"), QStringLiteral("women holding hands: medium skin tone"), QStringLiteral("women holding hands: medium skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("women holding hands: medium skin tone, medium-dark skin tone"), QStringLiteral("women holding hands: medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("women holding hands: medium skin tone, dark skin tone"), QStringLiteral("women holding hands: medium skin tone, dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("women holding hands: medium-dark skin tone, light skin tone"), QStringLiteral("women holding hands: medium-dark skin tone, light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("women holding hands: medium-dark skin tone, medium-light skin tone"), QStringLiteral("women holding hands: medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("women holding hands: medium-dark skin tone, medium skin tone"), QStringLiteral("women holding hands: medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46D\U0001F3FE"), QStringLiteral("women holding hands: medium-dark skin tone"), QStringLiteral("women holding hands: medium-dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("women holding hands: medium-dark skin tone, dark skin tone"), QStringLiteral("women holding hands: medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("women holding hands: dark skin tone, light skin tone"), QStringLiteral("women holding hands: dark skin tone, light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("women holding hands: dark skin tone, medium-light skin tone"), QStringLiteral("women holding hands: dark skin tone, medium-light skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("women holding hands: dark skin tone, medium skin tone"), QStringLiteral("women holding hands: dark skin tone, medium skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("women holding hands: dark skin tone, medium-dark skin tone"), QStringLiteral("women holding hands: dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("women holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46D\U0001F3FF"), QStringLiteral("women holding hands: dark skin tone"), QStringLiteral("women holding hands: dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46B\U0001F3FB"), QStringLiteral("woman and man holding hands: light skin tone"), QStringLiteral("woman and man holding hands: light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("woman and man holding hands: light skin tone, medium-light skin tone"), QStringLiteral("woman and man holding hands: light skin tone, medium-light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("woman and man holding hands: light skin tone, medium skin tone"), QStringLiteral("woman and man holding hands: light skin tone, medium skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("woman and man holding hands: light skin tone, medium-dark skin tone"), QStringLiteral("woman and man holding hands: light skin tone, medium-dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("woman and man holding hands: light skin tone, dark skin tone"), QStringLiteral("woman and man holding hands: light skin tone, dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("woman and man holding hands: medium-light skin tone, light skin tone"), QStringLiteral("woman and man holding hands: medium-light skin tone, light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46B\U0001F3FC"), QStringLiteral("woman and man holding hands: medium-light skin tone"), QStringLiteral("woman and man holding hands: medium-light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("woman and man holding hands: medium-light skin tone, medium skin tone"), QStringLiteral("woman and man holding hands: medium-light skin tone, medium skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("woman and man holding hands: medium-light skin tone, medium-dark skin tone"), QStringLiteral("woman and man holding hands: medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("woman and man holding hands: medium-light skin tone, dark skin tone"), QStringLiteral("woman and man holding hands: medium-light skin tone, dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("woman and man holding hands: medium skin tone, light skin tone"), QStringLiteral("woman and man holding hands: medium skin tone, light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("woman and man holding hands: medium skin tone, medium-light skin tone"), QStringLiteral("woman and man holding hands: medium skin tone, medium-light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46B\U0001F3FD"), QStringLiteral("woman and man holding hands: medium skin tone"), QStringLiteral("woman and man holding hands: medium skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("woman and man holding hands: medium skin tone, medium-dark skin tone"), QStringLiteral("woman and man holding hands: medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("woman and man holding hands: medium skin tone, dark skin tone"), QStringLiteral("woman and man holding hands: medium skin tone, dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("woman and man holding hands: medium-dark skin tone, light skin tone"), QStringLiteral("woman and man holding hands: medium-dark skin tone, light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("woman and man holding hands: medium-dark skin tone, medium-light skin tone"), QStringLiteral("woman and man holding hands: medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("woman and man holding hands: medium-dark skin tone, medium skin tone"), QStringLiteral("woman and man holding hands: medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46B\U0001F3FE"), QStringLiteral("woman and man holding hands: medium-dark skin tone"), QStringLiteral("woman and man holding hands: medium-dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("woman and man holding hands: medium-dark skin tone, dark skin tone"), QStringLiteral("woman and man holding hands: medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("woman and man holding hands: dark skin tone, light skin tone"), QStringLiteral("woman and man holding hands: dark skin tone, light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("woman and man holding hands: dark skin tone, medium-light skin tone"), QStringLiteral("woman and man holding hands: dark skin tone, medium-light skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("woman and man holding hands: dark skin tone, medium skin tone"), QStringLiteral("woman and man holding hands: dark skin tone, medium skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("woman and man holding hands: dark skin tone, medium-dark skin tone"), QStringLiteral("woman and man holding hands: dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("woman and man holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46B\U0001F3FF"), QStringLiteral("woman and man holding hands: dark skin tone"), QStringLiteral("woman and man holding hands: dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46C\U0001F3FB"), QStringLiteral("men holding hands: light skin tone"), QStringLiteral("men holding hands: light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("men holding hands: light skin tone, medium-light skin tone"), QStringLiteral("men holding hands: light skin tone, medium-light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("men holding hands: light skin tone, medium skin tone"), QStringLiteral("men holding hands: light skin tone, medium skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("men holding hands: light skin tone, medium-dark skin tone"), QStringLiteral("men holding hands: light skin tone, medium-dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("men holding hands: light skin tone, dark skin tone"), QStringLiteral("men holding hands: light skin tone, dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("men holding hands: medium-light skin tone, light skin tone"), QStringLiteral("men holding hands: medium-light skin tone, light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46C\U0001F3FC"), QStringLiteral("men holding hands: medium-light skin tone"), QStringLiteral("men holding hands: medium-light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("men holding hands: medium-light skin tone, medium skin tone"), QStringLiteral("men holding hands: medium-light skin tone, medium skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("men holding hands: medium-light skin tone, medium-dark skin tone"), QStringLiteral("men holding hands: medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("men holding hands: medium-light skin tone, dark skin tone"), QStringLiteral("men holding hands: medium-light skin tone, dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("men holding hands: medium skin tone, light skin tone"), QStringLiteral("men holding hands: medium skin tone, light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("men holding hands: medium skin tone, medium-light skin tone"), QStringLiteral("men holding hands: medium skin tone, medium-light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46C\U0001F3FD"), QStringLiteral("men holding hands: medium skin tone"), QStringLiteral("men holding hands: medium skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("men holding hands: medium skin tone, medium-dark skin tone"), QStringLiteral("men holding hands: medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("men holding hands: medium skin tone, dark skin tone"), QStringLiteral("men holding hands: medium skin tone, dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("men holding hands: medium-dark skin tone, light skin tone"), QStringLiteral("men holding hands: medium-dark skin tone, light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("men holding hands: medium-dark skin tone, medium-light skin tone"), QStringLiteral("men holding hands: medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("men holding hands: medium-dark skin tone, medium skin tone"), QStringLiteral("men holding hands: medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46C\U0001F3FE"), QStringLiteral("men holding hands: medium-dark skin tone"), QStringLiteral("men holding hands: medium-dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("men holding hands: medium-dark skin tone, dark skin tone"), QStringLiteral("men holding hands: medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("men holding hands: dark skin tone, light skin tone"), QStringLiteral("men holding hands: dark skin tone, light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("men holding hands: dark skin tone, medium-light skin tone"), QStringLiteral("men holding hands: dark skin tone, medium-light skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("men holding hands: dark skin tone, medium skin tone"), QStringLiteral("men holding hands: dark skin tone, medium skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("men holding hands: dark skin tone, medium-dark skin tone"), QStringLiteral("men holding hands: dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("men holding hands"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F46C\U0001F3FF"), QStringLiteral("men holding hands: dark skin tone"), QStringLiteral("men holding hands: dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48F\U0001F3FB"), QStringLiteral("kiss: light skin tone"), QStringLiteral("kiss: light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48F\U0001F3FC"), QStringLiteral("kiss: medium-light skin tone"), QStringLiteral("kiss: medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48F\U0001F3FD"), QStringLiteral("kiss: medium skin tone"), QStringLiteral("kiss: medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48F\U0001F3FE"), QStringLiteral("kiss: medium-dark skin tone"), QStringLiteral("kiss: medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F48F\U0001F3FF"), QStringLiteral("kiss: dark skin tone"), QStringLiteral("kiss: dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("kiss: person, person, light skin tone, medium-light skin tone"), QStringLiteral("kiss: person, person, light skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("kiss: person, person, light skin tone, medium skin tone"), QStringLiteral("kiss: person, person, light skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("kiss: person, person, light skin tone, medium-dark skin tone"), QStringLiteral("kiss: person, person, light skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("kiss: person, person, light skin tone, dark skin tone"), QStringLiteral("kiss: person, person, light skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("kiss: person, person, medium-light skin tone, light skin tone"), QStringLiteral("kiss: person, person, medium-light skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("kiss: person, person, medium-light skin tone, medium skin tone"), QStringLiteral("kiss: person, person, medium-light skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("kiss: person, person, medium-light skin tone, medium-dark skin tone"), QStringLiteral("kiss: person, person, medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("kiss: person, person, medium-light skin tone, dark skin tone"), QStringLiteral("kiss: person, person, medium-light skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("kiss: person, person, medium skin tone, light skin tone"), QStringLiteral("kiss: person, person, medium skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("kiss: person, person, medium skin tone, medium-light skin tone"), QStringLiteral("kiss: person, person, medium skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("kiss: person, person, medium skin tone, medium-dark skin tone"), QStringLiteral("kiss: person, person, medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("kiss: person, person, medium skin tone, dark skin tone"), QStringLiteral("kiss: person, person, medium skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("kiss: person, person, medium-dark skin tone, light skin tone"), QStringLiteral("kiss: person, person, medium-dark skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("kiss: person, person, medium-dark skin tone, medium-light skin tone"), QStringLiteral("kiss: person, person, medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("kiss: person, person, medium-dark skin tone, medium skin tone"), QStringLiteral("kiss: person, person, medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("kiss: person, person, medium-dark skin tone, dark skin tone"), QStringLiteral("kiss: person, person, medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("kiss: person, person, dark skin tone, light skin tone"), QStringLiteral("kiss: person, person, dark skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("kiss: person, person, dark skin tone, medium-light skin tone"), QStringLiteral("kiss: person, person, dark skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("kiss: person, person, dark skin tone, medium skin tone"), QStringLiteral("kiss: person, person, dark skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("kiss: person, person, dark skin tone, medium-dark skin tone"), QStringLiteral("kiss: person, person, dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: woman, man, light skin tone"), QStringLiteral("kiss: woman, man, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: woman, man, light skin tone, medium-light skin tone"), QStringLiteral("kiss: woman, man, light skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: woman, man, light skin tone, medium skin tone"), QStringLiteral("kiss: woman, man, light skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: woman, man, light skin tone, medium-dark skin tone"), QStringLiteral("kiss: woman, man, light skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: woman, man, light skin tone, dark skin tone"), QStringLiteral("kiss: woman, man, light skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: woman, man, medium-light skin tone, light skin tone"), QStringLiteral("kiss: woman, man, medium-light skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: woman, man, medium-light skin tone"), QStringLiteral("kiss: woman, man, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: woman, man, medium-light skin tone, medium skin tone"), QStringLiteral("kiss: woman, man, medium-light skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: woman, man, medium-light skin tone, medium-dark skin tone"), QStringLiteral("kiss: woman, man, medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: woman, man, medium-light skin tone, dark skin tone"), QStringLiteral("kiss: woman, man, medium-light skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: woman, man, medium skin tone, light skin tone"), QStringLiteral("kiss: woman, man, medium skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: woman, man, medium skin tone, medium-light skin tone"), QStringLiteral("kiss: woman, man, medium skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: woman, man, medium skin tone"), QStringLiteral("kiss: woman, man, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: woman, man, medium skin tone, medium-dark skin tone"), QStringLiteral("kiss: woman, man, medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: woman, man, medium skin tone, dark skin tone"), QStringLiteral("kiss: woman, man, medium skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: woman, man, medium-dark skin tone, light skin tone"), QStringLiteral("kiss: woman, man, medium-dark skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: woman, man, medium-dark skin tone, medium-light skin tone"), QStringLiteral("kiss: woman, man, medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: woman, man, medium-dark skin tone, medium skin tone"), QStringLiteral("kiss: woman, man, medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: woman, man, medium-dark skin tone"), QStringLiteral("kiss: woman, man, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: woman, man, medium-dark skin tone, dark skin tone"), QStringLiteral("kiss: woman, man, medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: woman, man, dark skin tone, light skin tone"), QStringLiteral("kiss: woman, man, dark skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: woman, man, dark skin tone, medium-light skin tone"), QStringLiteral("kiss: woman, man, dark skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: woman, man, dark skin tone, medium skin tone"), QStringLiteral("kiss: woman, man, dark skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: woman, man, dark skin tone, medium-dark skin tone"), QStringLiteral("kiss: woman, man, dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: woman, man, dark skin tone"), QStringLiteral("kiss: woman, man, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: man, man, light skin tone"), QStringLiteral("kiss: man, man, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: man, man, light skin tone, medium-light skin tone"), QStringLiteral("kiss: man, man, light skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: man, man, light skin tone, medium skin tone"), QStringLiteral("kiss: man, man, light skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: man, man, light skin tone, medium-dark skin tone"), QStringLiteral("kiss: man, man, light skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: man, man, light skin tone, dark skin tone"), QStringLiteral("kiss: man, man, light skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: man, man, medium-light skin tone, light skin tone"), QStringLiteral("kiss: man, man, medium-light skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: man, man, medium-light skin tone"), QStringLiteral("kiss: man, man, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: man, man, medium-light skin tone, medium skin tone"), QStringLiteral("kiss: man, man, medium-light skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: man, man, medium-light skin tone, medium-dark skin tone"), QStringLiteral("kiss: man, man, medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: man, man, medium-light skin tone, dark skin tone"), QStringLiteral("kiss: man, man, medium-light skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: man, man, medium skin tone, light skin tone"), QStringLiteral("kiss: man, man, medium skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: man, man, medium skin tone, medium-light skin tone"), QStringLiteral("kiss: man, man, medium skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: man, man, medium skin tone"), QStringLiteral("kiss: man, man, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: man, man, medium skin tone, medium-dark skin tone"), QStringLiteral("kiss: man, man, medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: man, man, medium skin tone, dark skin tone"), QStringLiteral("kiss: man, man, medium skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: man, man, medium-dark skin tone, light skin tone"), QStringLiteral("kiss: man, man, medium-dark skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: man, man, medium-dark skin tone, medium-light skin tone"), QStringLiteral("kiss: man, man, medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: man, man, medium-dark skin tone, medium skin tone"), QStringLiteral("kiss: man, man, medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: man, man, medium-dark skin tone"), QStringLiteral("kiss: man, man, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: man, man, medium-dark skin tone, dark skin tone"), QStringLiteral("kiss: man, man, medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("kiss: man, man, dark skin tone, light skin tone"), QStringLiteral("kiss: man, man, dark skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("kiss: man, man, dark skin tone, medium-light skin tone"), QStringLiteral("kiss: man, man, dark skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("kiss: man, man, dark skin tone, medium skin tone"), QStringLiteral("kiss: man, man, dark skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("kiss: man, man, dark skin tone, medium-dark skin tone"), QStringLiteral("kiss: man, man, dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("kiss: man, man, dark skin tone"), QStringLiteral("kiss: man, man, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("kiss: woman, woman, light skin tone"), QStringLiteral("kiss: woman, woman, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("kiss: woman, woman, light skin tone, medium-light skin tone"), QStringLiteral("kiss: woman, woman, light skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("kiss: woman, woman, light skin tone, medium skin tone"), QStringLiteral("kiss: woman, woman, light skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("kiss: woman, woman, light skin tone, medium-dark skin tone"), QStringLiteral("kiss: woman, woman, light skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("kiss: woman, woman, light skin tone, dark skin tone"), QStringLiteral("kiss: woman, woman, light skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("kiss: woman, woman, medium-light skin tone, light skin tone"), QStringLiteral("kiss: woman, woman, medium-light skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("kiss: woman, woman, medium-light skin tone"), QStringLiteral("kiss: woman, woman, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("kiss: woman, woman, medium-light skin tone, medium skin tone"), QStringLiteral("kiss: woman, woman, medium-light skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("kiss: woman, woman, medium-light skin tone, medium-dark skin tone"), QStringLiteral("kiss: woman, woman, medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("kiss: woman, woman, medium-light skin tone, dark skin tone"), QStringLiteral("kiss: woman, woman, medium-light skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("kiss: woman, woman, medium skin tone, light skin tone"), QStringLiteral("kiss: woman, woman, medium skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("kiss: woman, woman, medium skin tone, medium-light skin tone"), QStringLiteral("kiss: woman, woman, medium skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("kiss: woman, woman, medium skin tone"), QStringLiteral("kiss: woman, woman, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("kiss: woman, woman, medium skin tone, medium-dark skin tone"), QStringLiteral("kiss: woman, woman, medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("kiss: woman, woman, medium skin tone, dark skin tone"), QStringLiteral("kiss: woman, woman, medium skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("kiss: woman, woman, medium-dark skin tone, light skin tone"), QStringLiteral("kiss: woman, woman, medium-dark skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("kiss: woman, woman, medium-dark skin tone, medium-light skin tone"), QStringLiteral("kiss: woman, woman, medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("kiss: woman, woman, medium-dark skin tone, medium skin tone"), QStringLiteral("kiss: woman, woman, medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("kiss: woman, woman, medium-dark skin tone"), QStringLiteral("kiss: woman, woman, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("kiss: woman, woman, medium-dark skin tone, dark skin tone"), QStringLiteral("kiss: woman, woman, medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("kiss: woman, woman, dark skin tone, light skin tone"), QStringLiteral("kiss: woman, woman, dark skin tone, light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("kiss: woman, woman, dark skin tone, medium-light skin tone"), QStringLiteral("kiss: woman, woman, dark skin tone, medium-light skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("kiss: woman, woman, dark skin tone, medium skin tone"), QStringLiteral("kiss: woman, woman, dark skin tone, medium skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("kiss: woman, woman, dark skin tone, medium-dark skin tone"), QStringLiteral("kiss: woman, woman, dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("kiss"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("kiss: woman, woman, dark skin tone"), QStringLiteral("kiss: woman, woman, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F491\U0001F3FB"), QStringLiteral("couple with heart: light skin tone"), QStringLiteral("couple with heart: light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F491\U0001F3FC"), QStringLiteral("couple with heart: medium-light skin tone"), QStringLiteral("couple with heart: medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F491\U0001F3FD"), QStringLiteral("couple with heart: medium skin tone"), QStringLiteral("couple with heart: medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F491\U0001F3FE"), QStringLiteral("couple with heart: medium-dark skin tone"), QStringLiteral("couple with heart: medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F491\U0001F3FF"), QStringLiteral("couple with heart: dark skin tone"), QStringLiteral("couple with heart: dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("couple with heart: person, person, light skin tone, medium-light skin tone"), QStringLiteral("couple with heart: person, person, light skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("couple with heart: person, person, light skin tone, medium skin tone"), QStringLiteral("couple with heart: person, person, light skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("couple with heart: person, person, light skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: person, person, light skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("couple with heart: person, person, light skin tone, dark skin tone"), QStringLiteral("couple with heart: person, person, light skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("couple with heart: person, person, medium-light skin tone, light skin tone"), QStringLiteral("couple with heart: person, person, medium-light skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("couple with heart: person, person, medium-light skin tone, medium skin tone"), QStringLiteral("couple with heart: person, person, medium-light skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("couple with heart: person, person, medium-light skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: person, person, medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("couple with heart: person, person, medium-light skin tone, dark skin tone"), QStringLiteral("couple with heart: person, person, medium-light skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("couple with heart: person, person, medium skin tone, light skin tone"), QStringLiteral("couple with heart: person, person, medium skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("couple with heart: person, person, medium skin tone, medium-light skin tone"), QStringLiteral("couple with heart: person, person, medium skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("couple with heart: person, person, medium skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: person, person, medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("couple with heart: person, person, medium skin tone, dark skin tone"), QStringLiteral("couple with heart: person, person, medium skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("couple with heart: person, person, medium-dark skin tone, light skin tone"), QStringLiteral("couple with heart: person, person, medium-dark skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("couple with heart: person, person, medium-dark skin tone, medium-light skin tone"), QStringLiteral("couple with heart: person, person, medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("couple with heart: person, person, medium-dark skin tone, medium skin tone"), QStringLiteral("couple with heart: person, person, medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FF"), QStringLiteral("couple with heart: person, person, medium-dark skin tone, dark skin tone"), QStringLiteral("couple with heart: person, person, medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FB"), QStringLiteral("couple with heart: person, person, dark skin tone, light skin tone"), QStringLiteral("couple with heart: person, person, dark skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FC"), QStringLiteral("couple with heart: person, person, dark skin tone, medium-light skin tone"), QStringLiteral("couple with heart: person, person, dark skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FD"), QStringLiteral("couple with heart: person, person, dark skin tone, medium skin tone"), QStringLiteral("couple with heart: person, person, dark skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FE"), QStringLiteral("couple with heart: person, person, dark skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: person, person, dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: woman, man, light skin tone"), QStringLiteral("couple with heart: woman, man, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: woman, man, light skin tone, medium-light skin tone"), QStringLiteral("couple with heart: woman, man, light skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: woman, man, light skin tone, medium skin tone"), QStringLiteral("couple with heart: woman, man, light skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: woman, man, light skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: woman, man, light skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: woman, man, light skin tone, dark skin tone"), QStringLiteral("couple with heart: woman, man, light skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: woman, man, medium-light skin tone, light skin tone"), QStringLiteral("couple with heart: woman, man, medium-light skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: woman, man, medium-light skin tone"), QStringLiteral("couple with heart: woman, man, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: woman, man, medium-light skin tone, medium skin tone"), QStringLiteral("couple with heart: woman, man, medium-light skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: woman, man, medium-light skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: woman, man, medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: woman, man, medium-light skin tone, dark skin tone"), QStringLiteral("couple with heart: woman, man, medium-light skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: woman, man, medium skin tone, light skin tone"), QStringLiteral("couple with heart: woman, man, medium skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: woman, man, medium skin tone, medium-light skin tone"), QStringLiteral("couple with heart: woman, man, medium skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: woman, man, medium skin tone"), QStringLiteral("couple with heart: woman, man, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: woman, man, medium skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: woman, man, medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: woman, man, medium skin tone, dark skin tone"), QStringLiteral("couple with heart: woman, man, medium skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone, light skin tone"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone, medium-light skin tone"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone, medium skin tone"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone, dark skin tone"), QStringLiteral("couple with heart: woman, man, medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: woman, man, dark skin tone, light skin tone"), QStringLiteral("couple with heart: woman, man, dark skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: woman, man, dark skin tone, medium-light skin tone"), QStringLiteral("couple with heart: woman, man, dark skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: woman, man, dark skin tone, medium skin tone"), QStringLiteral("couple with heart: woman, man, dark skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: woman, man, dark skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: woman, man, dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: woman, man, dark skin tone"), QStringLiteral("couple with heart: woman, man, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: man, man, light skin tone"), QStringLiteral("couple with heart: man, man, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: man, man, light skin tone, medium-light skin tone"), QStringLiteral("couple with heart: man, man, light skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: man, man, light skin tone, medium skin tone"), QStringLiteral("couple with heart: man, man, light skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: man, man, light skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: man, man, light skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: man, man, light skin tone, dark skin tone"), QStringLiteral("couple with heart: man, man, light skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: man, man, medium-light skin tone, light skin tone"), QStringLiteral("couple with heart: man, man, medium-light skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: man, man, medium-light skin tone"), QStringLiteral("couple with heart: man, man, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: man, man, medium-light skin tone, medium skin tone"), QStringLiteral("couple with heart: man, man, medium-light skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: man, man, medium-light skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: man, man, medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: man, man, medium-light skin tone, dark skin tone"), QStringLiteral("couple with heart: man, man, medium-light skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: man, man, medium skin tone, light skin tone"), QStringLiteral("couple with heart: man, man, medium skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: man, man, medium skin tone, medium-light skin tone"), QStringLiteral("couple with heart: man, man, medium skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: man, man, medium skin tone"), QStringLiteral("couple with heart: man, man, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: man, man, medium skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: man, man, medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: man, man, medium skin tone, dark skin tone"), QStringLiteral("couple with heart: man, man, medium skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: man, man, medium-dark skin tone, light skin tone"), QStringLiteral("couple with heart: man, man, medium-dark skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: man, man, medium-dark skin tone, medium-light skin tone"), QStringLiteral("couple with heart: man, man, medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: man, man, medium-dark skin tone, medium skin tone"), QStringLiteral("couple with heart: man, man, medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: man, man, medium-dark skin tone"), QStringLiteral("couple with heart: man, man, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: man, man, medium-dark skin tone, dark skin tone"), QStringLiteral("couple with heart: man, man, medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB"), QStringLiteral("couple with heart: man, man, dark skin tone, light skin tone"), QStringLiteral("couple with heart: man, man, dark skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC"), QStringLiteral("couple with heart: man, man, dark skin tone, medium-light skin tone"), QStringLiteral("couple with heart: man, man, dark skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD"), QStringLiteral("couple with heart: man, man, dark skin tone, medium skin tone"), QStringLiteral("couple with heart: man, man, dark skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE"), QStringLiteral("couple with heart: man, man, dark skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: man, man, dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF"), QStringLiteral("couple with heart: man, man, dark skin tone"), QStringLiteral("couple with heart: man, man, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("couple with heart: woman, woman, light skin tone"), QStringLiteral("couple with heart: woman, woman, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("couple with heart: woman, woman, light skin tone, medium-light skin tone"), QStringLiteral("couple with heart: woman, woman, light skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("couple with heart: woman, woman, light skin tone, medium skin tone"), QStringLiteral("couple with heart: woman, woman, light skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("couple with heart: woman, woman, light skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: woman, woman, light skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("couple with heart: woman, woman, light skin tone, dark skin tone"), QStringLiteral("couple with heart: woman, woman, light skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone, light skin tone"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone, medium skin tone"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone, dark skin tone"), QStringLiteral("couple with heart: woman, woman, medium-light skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("couple with heart: woman, woman, medium skin tone, light skin tone"), QStringLiteral("couple with heart: woman, woman, medium skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("couple with heart: woman, woman, medium skin tone, medium-light skin tone"), QStringLiteral("couple with heart: woman, woman, medium skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("couple with heart: woman, woman, medium skin tone"), QStringLiteral("couple with heart: woman, woman, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("couple with heart: woman, woman, medium skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: woman, woman, medium skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("couple with heart: woman, woman, medium skin tone, dark skin tone"), QStringLiteral("couple with heart: woman, woman, medium skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone, light skin tone"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone, medium-light skin tone"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone, medium skin tone"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone, dark skin tone"), QStringLiteral("couple with heart: woman, woman, medium-dark skin tone, dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB"), QStringLiteral("couple with heart: woman, woman, dark skin tone, light skin tone"), QStringLiteral("couple with heart: woman, woman, dark skin tone, light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC"), QStringLiteral("couple with heart: woman, woman, dark skin tone, medium-light skin tone"), QStringLiteral("couple with heart: woman, woman, dark skin tone, medium-light skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD"), QStringLiteral("couple with heart: woman, woman, dark skin tone, medium skin tone"), QStringLiteral("couple with heart: woman, woman, dark skin tone, medium skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE"), QStringLiteral("couple with heart: woman, woman, dark skin tone, medium-dark skin tone"), QStringLiteral("couple with heart: woman, woman, dark skin tone, medium-dark skin tone")})},
-{QStringLiteral("couple with heart"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF"), QStringLiteral("couple with heart: woman, woman, dark skin tone"), QStringLiteral("couple with heart: woman, woman, dark skin tone")})},
-{QStringLiteral("light skin tone"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3FB"), QStringLiteral("tone1"), QStringLiteral("light skin tone")})},
-{QStringLiteral("medium-light skin tone"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3FC"), QStringLiteral("tone2"), QStringLiteral("medium-light skin tone")})},
-{QStringLiteral("medium skin tone"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3FD"), QStringLiteral("tone3"), QStringLiteral("medium skin tone")})},
-{QStringLiteral("medium-dark skin tone"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3FE"), QStringLiteral("tone4"), QStringLiteral("medium-dark skin tone")})},
-{QStringLiteral("dark skin tone"), QVariant::fromValue(Emoji{QString::fromUtf8("\U0001F3FF"), QStringLiteral("tone5"), QStringLiteral("dark skin tone")})},
+constexpr EmojiData emojiTones[] = {
+{"\U0001F936\U0001F3FB", "mrs_claus_tone1", "Mrs. Claus: light skin tone"},
+{"\U0001F936\U0001F3FC", "mrs_claus_tone2", "Mrs. Claus: medium-light skin tone"},
+{"\U0001F936\U0001F3FD", "mrs_claus_tone3", "Mrs. Claus: medium skin tone"},
+{"\U0001F936\U0001F3FE", "mrs_claus_tone4", "Mrs. Claus: medium-dark skin tone"},
+{"\U0001F936\U0001F3FF", "mrs_claus_tone5", "Mrs. Claus: dark skin tone"},
+{"\U0001F44C\U0001F3FB", "ok_hand_tone1", "OK hand: light skin tone"},
+{"\U0001F44C\U0001F3FC", "ok_hand_tone2", "OK hand: medium-light skin tone"},
+{"\U0001F44C\U0001F3FD", "ok_hand_tone3", "OK hand: medium skin tone"},
+{"\U0001F44C\U0001F3FE", "ok_hand_tone4", "OK hand: medium-dark skin tone"},
+{"\U0001F44C\U0001F3FF", "ok_hand_tone5", "OK hand: dark skin tone"},
+{"\U0001F385\U0001F3FB", "santa_tone1", "Santa Claus: light skin tone"},
+{"\U0001F385\U0001F3FC", "santa_tone2", "Santa Claus: medium-light skin tone"},
+{"\U0001F385\U0001F3FD", "santa_tone3", "Santa Claus: medium skin tone"},
+{"\U0001F385\U0001F3FE", "santa_tone4", "Santa Claus: medium-dark skin tone"},
+{"\U0001F385\U0001F3FF", "santa_tone5", "Santa Claus: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F3A8", "artist: light skin tone", "artist: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F3A8", "artist: medium-light skin tone", "artist: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F3A8", "artist: medium skin tone", "artist: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F3A8", "artist: medium-dark skin tone", "artist: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F3A8", "artist: dark skin tone", "artist: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F680", "astronaut: light skin tone", "astronaut: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F680", "astronaut: medium-light skin tone", "astronaut: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F680", "astronaut: medium skin tone", "astronaut: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F680", "astronaut: medium-dark skin tone", "astronaut: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F680", "astronaut: dark skin tone", "astronaut: dark skin tone"},
+{"\U0001F476\U0001F3FB", "baby_tone1", "baby: light skin tone"},
+{"\U0001F476\U0001F3FC", "baby_tone2", "baby: medium-light skin tone"},
+{"\U0001F476\U0001F3FD", "baby_tone3", "baby: medium skin tone"},
+{"\U0001F476\U0001F3FE", "baby_tone4", "baby: medium-dark skin tone"},
+{"\U0001F476\U0001F3FF", "baby_tone5", "baby: dark skin tone"},
+{"\U0001F47C\U0001F3FB", "angel_tone1", "baby angel: light skin tone"},
+{"\U0001F47C\U0001F3FC", "angel_tone2", "baby angel: medium-light skin tone"},
+{"\U0001F47C\U0001F3FD", "angel_tone3", "baby angel: medium skin tone"},
+{"\U0001F47C\U0001F3FE", "angel_tone4", "baby angel: medium-dark skin tone"},
+{"\U0001F47C\U0001F3FF", "angel_tone5", "baby angel: dark skin tone"},
+{"\U0001F447\U0001F3FB", "point_down_tone1", "backhand index pointing down: light skin tone"},
+{"\U0001F447\U0001F3FC", "point_down_tone2", "backhand index pointing down: medium-light skin tone"},
+{"\U0001F447\U0001F3FD", "point_down_tone3", "backhand index pointing down: medium skin tone"},
+{"\U0001F447\U0001F3FE", "point_down_tone4", "backhand index pointing down: medium-dark skin tone"},
+{"\U0001F447\U0001F3FF", "point_down_tone5", "backhand index pointing down: dark skin tone"},
+{"\U0001F448\U0001F3FB", "point_left_tone1", "backhand index pointing left: light skin tone"},
+{"\U0001F448\U0001F3FC", "point_left_tone2", "backhand index pointing left: medium-light skin tone"},
+{"\U0001F448\U0001F3FD", "point_left_tone3", "backhand index pointing left: medium skin tone"},
+{"\U0001F448\U0001F3FE", "point_left_tone4", "backhand index pointing left: medium-dark skin tone"},
+{"\U0001F448\U0001F3FF", "point_left_tone5", "backhand index pointing left: dark skin tone"},
+{"\U0001F449\U0001F3FB", "point_right_tone1", "backhand index pointing right: light skin tone"},
+{"\U0001F449\U0001F3FC", "point_right_tone2", "backhand index pointing right: medium-light skin tone"},
+{"\U0001F449\U0001F3FD", "point_right_tone3", "backhand index pointing right: medium skin tone"},
+{"\U0001F449\U0001F3FE", "point_right_tone4", "backhand index pointing right: medium-dark skin tone"},
+{"\U0001F449\U0001F3FF", "point_right_tone5", "backhand index pointing right: dark skin tone"},
+{"\U0001F446\U0001F3FB", "point_up_2_tone1", "backhand index pointing up: light skin tone"},
+{"\U0001F446\U0001F3FC", "point_up_2_tone2", "backhand index pointing up: medium-light skin tone"},
+{"\U0001F446\U0001F3FD", "point_up_2_tone3", "backhand index pointing up: medium skin tone"},
+{"\U0001F446\U0001F3FE", "point_up_2_tone4", "backhand index pointing up: medium-dark skin tone"},
+{"\U0001F446\U0001F3FF", "point_up_2_tone5", "backhand index pointing up: dark skin tone"},
+{"\U0001F466\U0001F3FB", "boy_tone1", "boy: light skin tone"},
+{"\U0001F466\U0001F3FC", "boy_tone2", "boy: medium-light skin tone"},
+{"\U0001F466\U0001F3FD", "boy_tone3", "boy: medium skin tone"},
+{"\U0001F466\U0001F3FE", "boy_tone4", "boy: medium-dark skin tone"},
+{"\U0001F466\U0001F3FF", "boy_tone5", "boy: dark skin tone"},
+{"\U0001F931\U0001F3FB", "breast_feeding_tone1", "breast-feeding: light skin tone"},
+{"\U0001F931\U0001F3FC", "breast_feeding_tone2", "breast-feeding: medium-light skin tone"},
+{"\U0001F931\U0001F3FD", "breast_feeding_tone3", "breast-feeding: medium skin tone"},
+{"\U0001F931\U0001F3FE", "breast_feeding_tone4", "breast-feeding: medium-dark skin tone"},
+{"\U0001F931\U0001F3FF", "breast_feeding_tone5", "breast-feeding: dark skin tone"},
+{"\U0001F919\U0001F3FB", "call_me_tone1", "call me hand: light skin tone"},
+{"\U0001F919\U0001F3FC", "call_me_tone2", "call me hand: medium-light skin tone"},
+{"\U0001F919\U0001F3FD", "call_me_tone3", "call me hand: medium skin tone"},
+{"\U0001F919\U0001F3FE", "call_me_tone4", "call me hand: medium-dark skin tone"},
+{"\U0001F919\U0001F3FF", "call_me_tone5", "call me hand: dark skin tone"},
+{"\U0001F9D2\U0001F3FB", "child_tone1", "child: light skin tone"},
+{"\U0001F9D2\U0001F3FC", "child_tone2", "child: medium-light skin tone"},
+{"\U0001F9D2\U0001F3FD", "child_tone3", "child: medium skin tone"},
+{"\U0001F9D2\U0001F3FE", "child_tone4", "child: medium-dark skin tone"},
+{"\U0001F9D2\U0001F3FF", "child_tone5", "child: dark skin tone"},
+{"\U0001F44F\U0001F3FB", "clap_tone1", "clapping hands: light skin tone"},
+{"\U0001F44F\U0001F3FC", "clap_tone2", "clapping hands: medium-light skin tone"},
+{"\U0001F44F\U0001F3FD", "clap_tone3", "clapping hands: medium skin tone"},
+{"\U0001F44F\U0001F3FE", "clap_tone4", "clapping hands: medium-dark skin tone"},
+{"\U0001F44F\U0001F3FF", "clap_tone5", "clapping hands: dark skin tone"},
+{"\U0001F477\U0001F3FB", "construction_worker_tone1", "construction worker: light skin tone"},
+{"\U0001F477\U0001F3FC", "construction_worker_tone2", "construction worker: medium-light skin tone"},
+{"\U0001F477\U0001F3FD", "construction_worker_tone3", "construction worker: medium skin tone"},
+{"\U0001F477\U0001F3FE", "construction_worker_tone4", "construction worker: medium-dark skin tone"},
+{"\U0001F477\U0001F3FF", "construction_worker_tone5", "construction worker: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F373", "cook: light skin tone", "cook: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F373", "cook: medium-light skin tone", "cook: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F373", "cook: medium skin tone", "cook: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F373", "cook: medium-dark skin tone", "cook: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F373", "cook: dark skin tone", "cook: dark skin tone"},
+{"\U0001F491\U0001F3FB", "couple with heart: light skin tone", "couple with heart: light skin tone"},
+{"\U0001F491\U0001F3FC", "couple with heart: medium-light skin tone", "couple with heart: medium-light skin tone"},
+{"\U0001F491\U0001F3FD", "couple with heart: medium skin tone", "couple with heart: medium skin tone"},
+{"\U0001F491\U0001F3FE", "couple with heart: medium-dark skin tone", "couple with heart: medium-dark skin tone"},
+{"\U0001F491\U0001F3FF", "couple with heart: dark skin tone", "couple with heart: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FC", "couple with heart: person, person, light skin tone, medium-light skin tone", "couple with heart: person, person, light skin tone, medium-light skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FD", "couple with heart: person, person, light skin tone, medium skin tone", "couple with heart: person, person, light skin tone, medium skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FE", "couple with heart: person, person, light skin tone, medium-dark skin tone", "couple with heart: person, person, light skin tone, medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FF", "couple with heart: person, person, light skin tone, dark skin tone", "couple with heart: person, person, light skin tone, dark skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FB", "couple with heart: person, person, medium-light skin tone, light skin tone", "couple with heart: person, person, medium-light skin tone, light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FD", "couple with heart: person, person, medium-light skin tone, medium skin tone", "couple with heart: person, person, medium-light skin tone, medium skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FE", "couple with heart: person, person, medium-light skin tone, medium-dark skin tone", "couple with heart: person, person, medium-light skin tone, medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FF", "couple with heart: person, person, medium-light skin tone, dark skin tone", "couple with heart: person, person, medium-light skin tone, dark skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FB", "couple with heart: person, person, medium skin tone, light skin tone", "couple with heart: person, person, medium skin tone, light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FC", "couple with heart: person, person, medium skin tone, medium-light skin tone", "couple with heart: person, person, medium skin tone, medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FE", "couple with heart: person, person, medium skin tone, medium-dark skin tone", "couple with heart: person, person, medium skin tone, medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FF", "couple with heart: person, person, medium skin tone, dark skin tone", "couple with heart: person, person, medium skin tone, dark skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FB", "couple with heart: person, person, medium-dark skin tone, light skin tone", "couple with heart: person, person, medium-dark skin tone, light skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FC", "couple with heart: person, person, medium-dark skin tone, medium-light skin tone", "couple with heart: person, person, medium-dark skin tone, medium-light skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FD", "couple with heart: person, person, medium-dark skin tone, medium skin tone", "couple with heart: person, person, medium-dark skin tone, medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FF", "couple with heart: person, person, medium-dark skin tone, dark skin tone", "couple with heart: person, person, medium-dark skin tone, dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FB", "couple with heart: person, person, dark skin tone, light skin tone", "couple with heart: person, person, dark skin tone, light skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FC", "couple with heart: person, person, dark skin tone, medium-light skin tone", "couple with heart: person, person, dark skin tone, medium-light skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FD", "couple with heart: person, person, dark skin tone, medium skin tone", "couple with heart: person, person, dark skin tone, medium skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F9D1\U0001F3FE", "couple with heart: person, person, dark skin tone, medium-dark skin tone", "couple with heart: person, person, dark skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", "couple with heart: woman, man, light skin tone", "couple with heart: woman, man, light skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", "couple with heart: woman, man, light skin tone, medium-light skin tone", "couple with heart: woman, man, light skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", "couple with heart: woman, man, light skin tone, medium skin tone", "couple with heart: woman, man, light skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", "couple with heart: woman, man, light skin tone, medium-dark skin tone", "couple with heart: woman, man, light skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", "couple with heart: woman, man, light skin tone, dark skin tone", "couple with heart: woman, man, light skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", "couple with heart: woman, man, medium-light skin tone, light skin tone", "couple with heart: woman, man, medium-light skin tone, light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", "couple with heart: woman, man, medium-light skin tone", "couple with heart: woman, man, medium-light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", "couple with heart: woman, man, medium-light skin tone, medium skin tone", "couple with heart: woman, man, medium-light skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", "couple with heart: woman, man, medium-light skin tone, medium-dark skin tone", "couple with heart: woman, man, medium-light skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", "couple with heart: woman, man, medium-light skin tone, dark skin tone", "couple with heart: woman, man, medium-light skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", "couple with heart: woman, man, medium skin tone, light skin tone", "couple with heart: woman, man, medium skin tone, light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", "couple with heart: woman, man, medium skin tone, medium-light skin tone", "couple with heart: woman, man, medium skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", "couple with heart: woman, man, medium skin tone", "couple with heart: woman, man, medium skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", "couple with heart: woman, man, medium skin tone, medium-dark skin tone", "couple with heart: woman, man, medium skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", "couple with heart: woman, man, medium skin tone, dark skin tone", "couple with heart: woman, man, medium skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", "couple with heart: woman, man, medium-dark skin tone, light skin tone", "couple with heart: woman, man, medium-dark skin tone, light skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", "couple with heart: woman, man, medium-dark skin tone, medium-light skin tone", "couple with heart: woman, man, medium-dark skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", "couple with heart: woman, man, medium-dark skin tone, medium skin tone", "couple with heart: woman, man, medium-dark skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", "couple with heart: woman, man, medium-dark skin tone", "couple with heart: woman, man, medium-dark skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", "couple with heart: woman, man, medium-dark skin tone, dark skin tone", "couple with heart: woman, man, medium-dark skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", "couple with heart: woman, man, dark skin tone, light skin tone", "couple with heart: woman, man, dark skin tone, light skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", "couple with heart: woman, man, dark skin tone, medium-light skin tone", "couple with heart: woman, man, dark skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", "couple with heart: woman, man, dark skin tone, medium skin tone", "couple with heart: woman, man, dark skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", "couple with heart: woman, man, dark skin tone, medium-dark skin tone", "couple with heart: woman, man, dark skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", "couple with heart: woman, man, dark skin tone", "couple with heart: woman, man, dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", "couple with heart: man, man, light skin tone", "couple with heart: man, man, light skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", "couple with heart: man, man, light skin tone, medium-light skin tone", "couple with heart: man, man, light skin tone, medium-light skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", "couple with heart: man, man, light skin tone, medium skin tone", "couple with heart: man, man, light skin tone, medium skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", "couple with heart: man, man, light skin tone, medium-dark skin tone", "couple with heart: man, man, light skin tone, medium-dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", "couple with heart: man, man, light skin tone, dark skin tone", "couple with heart: man, man, light skin tone, dark skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", "couple with heart: man, man, medium-light skin tone, light skin tone", "couple with heart: man, man, medium-light skin tone, light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", "couple with heart: man, man, medium-light skin tone", "couple with heart: man, man, medium-light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", "couple with heart: man, man, medium-light skin tone, medium skin tone", "couple with heart: man, man, medium-light skin tone, medium skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", "couple with heart: man, man, medium-light skin tone, medium-dark skin tone", "couple with heart: man, man, medium-light skin tone, medium-dark skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", "couple with heart: man, man, medium-light skin tone, dark skin tone", "couple with heart: man, man, medium-light skin tone, dark skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", "couple with heart: man, man, medium skin tone, light skin tone", "couple with heart: man, man, medium skin tone, light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", "couple with heart: man, man, medium skin tone, medium-light skin tone", "couple with heart: man, man, medium skin tone, medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", "couple with heart: man, man, medium skin tone", "couple with heart: man, man, medium skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", "couple with heart: man, man, medium skin tone, medium-dark skin tone", "couple with heart: man, man, medium skin tone, medium-dark skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", "couple with heart: man, man, medium skin tone, dark skin tone", "couple with heart: man, man, medium skin tone, dark skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", "couple with heart: man, man, medium-dark skin tone, light skin tone", "couple with heart: man, man, medium-dark skin tone, light skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", "couple with heart: man, man, medium-dark skin tone, medium-light skin tone", "couple with heart: man, man, medium-dark skin tone, medium-light skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", "couple with heart: man, man, medium-dark skin tone, medium skin tone", "couple with heart: man, man, medium-dark skin tone, medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", "couple with heart: man, man, medium-dark skin tone", "couple with heart: man, man, medium-dark skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", "couple with heart: man, man, medium-dark skin tone, dark skin tone", "couple with heart: man, man, medium-dark skin tone, dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FB", "couple with heart: man, man, dark skin tone, light skin tone", "couple with heart: man, man, dark skin tone, light skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FC", "couple with heart: man, man, dark skin tone, medium-light skin tone", "couple with heart: man, man, dark skin tone, medium-light skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FD", "couple with heart: man, man, dark skin tone, medium skin tone", "couple with heart: man, man, dark skin tone, medium skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FE", "couple with heart: man, man, dark skin tone, medium-dark skin tone", "couple with heart: man, man, dark skin tone, medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F468\U0001F3FF", "couple with heart: man, man, dark skin tone", "couple with heart: man, man, dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB", "couple with heart: woman, woman, light skin tone", "couple with heart: woman, woman, light skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC", "couple with heart: woman, woman, light skin tone, medium-light skin tone", "couple with heart: woman, woman, light skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD", "couple with heart: woman, woman, light skin tone, medium skin tone", "couple with heart: woman, woman, light skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE", "couple with heart: woman, woman, light skin tone, medium-dark skin tone", "couple with heart: woman, woman, light skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF", "couple with heart: woman, woman, light skin tone, dark skin tone", "couple with heart: woman, woman, light skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB", "couple with heart: woman, woman, medium-light skin tone, light skin tone", "couple with heart: woman, woman, medium-light skin tone, light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC", "couple with heart: woman, woman, medium-light skin tone", "couple with heart: woman, woman, medium-light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD", "couple with heart: woman, woman, medium-light skin tone, medium skin tone", "couple with heart: woman, woman, medium-light skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE", "couple with heart: woman, woman, medium-light skin tone, medium-dark skin tone", "couple with heart: woman, woman, medium-light skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF", "couple with heart: woman, woman, medium-light skin tone, dark skin tone", "couple with heart: woman, woman, medium-light skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB", "couple with heart: woman, woman, medium skin tone, light skin tone", "couple with heart: woman, woman, medium skin tone, light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC", "couple with heart: woman, woman, medium skin tone, medium-light skin tone", "couple with heart: woman, woman, medium skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD", "couple with heart: woman, woman, medium skin tone", "couple with heart: woman, woman, medium skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE", "couple with heart: woman, woman, medium skin tone, medium-dark skin tone", "couple with heart: woman, woman, medium skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF", "couple with heart: woman, woman, medium skin tone, dark skin tone", "couple with heart: woman, woman, medium skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB", "couple with heart: woman, woman, medium-dark skin tone, light skin tone", "couple with heart: woman, woman, medium-dark skin tone, light skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC", "couple with heart: woman, woman, medium-dark skin tone, medium-light skin tone", "couple with heart: woman, woman, medium-dark skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD", "couple with heart: woman, woman, medium-dark skin tone, medium skin tone", "couple with heart: woman, woman, medium-dark skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE", "couple with heart: woman, woman, medium-dark skin tone", "couple with heart: woman, woman, medium-dark skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF", "couple with heart: woman, woman, medium-dark skin tone, dark skin tone", "couple with heart: woman, woman, medium-dark skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FB", "couple with heart: woman, woman, dark skin tone, light skin tone", "couple with heart: woman, woman, dark skin tone, light skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FC", "couple with heart: woman, woman, dark skin tone, medium-light skin tone", "couple with heart: woman, woman, dark skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FD", "couple with heart: woman, woman, dark skin tone, medium skin tone", "couple with heart: woman, woman, dark skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FE", "couple with heart: woman, woman, dark skin tone, medium-dark skin tone", "couple with heart: woman, woman, dark skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F469\U0001F3FF", "couple with heart: woman, woman, dark skin tone", "couple with heart: woman, woman, dark skin tone"},
+{"\U0001F91E\U0001F3FB", "fingers_crossed_tone1", "crossed fingers: light skin tone"},
+{"\U0001F91E\U0001F3FC", "fingers_crossed_tone2", "crossed fingers: medium-light skin tone"},
+{"\U0001F91E\U0001F3FD", "fingers_crossed_tone3", "crossed fingers: medium skin tone"},
+{"\U0001F91E\U0001F3FE", "fingers_crossed_tone4", "crossed fingers: medium-dark skin tone"},
+{"\U0001F91E\U0001F3FF", "fingers_crossed_tone5", "crossed fingers: dark skin tone"},
+{"\U0001F3FF", "tone5", "dark skin tone"},
+{"\U0001F9CF\U0001F3FB\U0000200D\U00002642\U0000FE0F", "deaf man: light skin tone", "deaf man: light skin tone"},
+{"\U0001F9CF\U0001F3FC\U0000200D\U00002642\U0000FE0F", "deaf man: medium-light skin tone", "deaf man: medium-light skin tone"},
+{"\U0001F9CF\U0001F3FD\U0000200D\U00002642\U0000FE0F", "deaf man: medium skin tone", "deaf man: medium skin tone"},
+{"\U0001F9CF\U0001F3FE\U0000200D\U00002642\U0000FE0F", "deaf man: medium-dark skin tone", "deaf man: medium-dark skin tone"},
+{"\U0001F9CF\U0001F3FF\U0000200D\U00002642\U0000FE0F", "deaf man: dark skin tone", "deaf man: dark skin tone"},
+{"\U0001F9CF\U0001F3FB", "deaf person: light skin tone", "deaf person: light skin tone"},
+{"\U0001F9CF\U0001F3FC", "deaf person: medium-light skin tone", "deaf person: medium-light skin tone"},
+{"\U0001F9CF\U0001F3FD", "deaf person: medium skin tone", "deaf person: medium skin tone"},
+{"\U0001F9CF\U0001F3FE", "deaf person: medium-dark skin tone", "deaf person: medium-dark skin tone"},
+{"\U0001F9CF\U0001F3FF", "deaf person: dark skin tone", "deaf person: dark skin tone"},
+{"\U0001F9CF\U0001F3FB\U0000200D\U00002640\U0000FE0F", "deaf woman: light skin tone", "deaf woman: light skin tone"},
+{"\U0001F9CF\U0001F3FC\U0000200D\U00002640\U0000FE0F", "deaf woman: medium-light skin tone", "deaf woman: medium-light skin tone"},
+{"\U0001F9CF\U0001F3FD\U0000200D\U00002640\U0000FE0F", "deaf woman: medium skin tone", "deaf woman: medium skin tone"},
+{"\U0001F9CF\U0001F3FE\U0000200D\U00002640\U0000FE0F", "deaf woman: medium-dark skin tone", "deaf woman: medium-dark skin tone"},
+{"\U0001F9CF\U0001F3FF\U0000200D\U00002640\U0000FE0F", "deaf woman: dark skin tone", "deaf woman: dark skin tone"},
+{"\U0001F575\U0001F3FB", "spy_tone1", "detective: light skin tone"},
+{"\U0001F575\U0001F3FC", "spy_tone2", "detective: medium-light skin tone"},
+{"\U0001F575\U0001F3FD", "spy_tone3", "detective: medium skin tone"},
+{"\U0001F575\U0001F3FE", "spy_tone4", "detective: medium-dark skin tone"},
+{"\U0001F575\U0001F3FF", "spy_tone5", "detective: dark skin tone"},
+{"\U0001F442\U0001F3FB", "ear_tone1", "ear: light skin tone"},
+{"\U0001F442\U0001F3FC", "ear_tone2", "ear: medium-light skin tone"},
+{"\U0001F442\U0001F3FD", "ear_tone3", "ear: medium skin tone"},
+{"\U0001F442\U0001F3FE", "ear_tone4", "ear: medium-dark skin tone"},
+{"\U0001F442\U0001F3FF", "ear_tone5", "ear: dark skin tone"},
+{"\U0001F9BB\U0001F3FB", "ear with hearing aid: light skin tone", "ear with hearing aid: light skin tone"},
+{"\U0001F9BB\U0001F3FC", "ear with hearing aid: medium-light skin tone", "ear with hearing aid: medium-light skin tone"},
+{"\U0001F9BB\U0001F3FD", "ear with hearing aid: medium skin tone", "ear with hearing aid: medium skin tone"},
+{"\U0001F9BB\U0001F3FE", "ear with hearing aid: medium-dark skin tone", "ear with hearing aid: medium-dark skin tone"},
+{"\U0001F9BB\U0001F3FF", "ear with hearing aid: dark skin tone", "ear with hearing aid: dark skin tone"},
+{"\U0001F9DD\U0001F3FB", "elf_tone1", "elf: light skin tone"},
+{"\U0001F9DD\U0001F3FC", "elf_tone2", "elf: medium-light skin tone"},
+{"\U0001F9DD\U0001F3FD", "elf_tone3", "elf: medium skin tone"},
+{"\U0001F9DD\U0001F3FE", "elf_tone4", "elf: medium-dark skin tone"},
+{"\U0001F9DD\U0001F3FF", "elf_tone5", "elf: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F3ED", "factory worker: light skin tone", "factory worker: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F3ED", "factory worker: medium-light skin tone", "factory worker: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F3ED", "factory worker: medium skin tone", "factory worker: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F3ED", "factory worker: medium-dark skin tone", "factory worker: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F3ED", "factory worker: dark skin tone", "factory worker: dark skin tone"},
+{"\U0001F9DA\U0001F3FB", "fairy_tone1", "fairy: light skin tone"},
+{"\U0001F9DA\U0001F3FC", "fairy_tone2", "fairy: medium-light skin tone"},
+{"\U0001F9DA\U0001F3FD", "fairy_tone3", "fairy: medium skin tone"},
+{"\U0001F9DA\U0001F3FE", "fairy_tone4", "fairy: medium-dark skin tone"},
+{"\U0001F9DA\U0001F3FF", "fairy_tone5", "fairy: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F33E", "farmer: light skin tone", "farmer: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F33E", "farmer: medium-light skin tone", "farmer: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F33E", "farmer: medium skin tone", "farmer: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F33E", "farmer: medium-dark skin tone", "farmer: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F33E", "farmer: dark skin tone", "farmer: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F692", "firefighter: light skin tone", "firefighter: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F692", "firefighter: medium-light skin tone", "firefighter: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F692", "firefighter: medium skin tone", "firefighter: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F692", "firefighter: medium-dark skin tone", "firefighter: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F692", "firefighter: dark skin tone", "firefighter: dark skin tone"},
+{"\U0001F4AA\U0001F3FB", "muscle_tone1", "flexed biceps: light skin tone"},
+{"\U0001F4AA\U0001F3FC", "muscle_tone2", "flexed biceps: medium-light skin tone"},
+{"\U0001F4AA\U0001F3FD", "muscle_tone3", "flexed biceps: medium skin tone"},
+{"\U0001F4AA\U0001F3FE", "muscle_tone4", "flexed biceps: medium-dark skin tone"},
+{"\U0001F4AA\U0001F3FF", "muscle_tone5", "flexed biceps: dark skin tone"},
+{"\U0001F64F\U0001F3FB", "pray_tone1", "folded hands: light skin tone"},
+{"\U0001F64F\U0001F3FC", "pray_tone2", "folded hands: medium-light skin tone"},
+{"\U0001F64F\U0001F3FD", "pray_tone3", "folded hands: medium skin tone"},
+{"\U0001F64F\U0001F3FE", "pray_tone4", "folded hands: medium-dark skin tone"},
+{"\U0001F64F\U0001F3FF", "pray_tone5", "folded hands: dark skin tone"},
+{"\U0001F9B6\U0001F3FB", "foot_tone1", "foot: light skin tone"},
+{"\U0001F9B6\U0001F3FC", "foot_tone2", "foot: medium-light skin tone"},
+{"\U0001F9B6\U0001F3FD", "foot_tone3", "foot: medium skin tone"},
+{"\U0001F9B6\U0001F3FE", "foot_tone4", "foot: medium-dark skin tone"},
+{"\U0001F9B6\U0001F3FF", "foot_tone5", "foot: dark skin tone"},
+{"\U0001F467\U0001F3FB", "girl_tone1", "girl: light skin tone"},
+{"\U0001F467\U0001F3FC", "girl_tone2", "girl: medium-light skin tone"},
+{"\U0001F467\U0001F3FD", "girl_tone3", "girl: medium skin tone"},
+{"\U0001F467\U0001F3FE", "girl_tone4", "girl: medium-dark skin tone"},
+{"\U0001F467\U0001F3FF", "girl_tone5", "girl: dark skin tone"},
+{"\U0001F482\U0001F3FB", "guardsman_tone1", "guard: light skin tone"},
+{"\U0001F482\U0001F3FC", "guardsman_tone2", "guard: medium-light skin tone"},
+{"\U0001F482\U0001F3FD", "guardsman_tone3", "guard: medium skin tone"},
+{"\U0001F482\U0001F3FE", "guardsman_tone4", "guard: medium-dark skin tone"},
+{"\U0001F482\U0001F3FF", "guardsman_tone5", "guard: dark skin tone"},
+{"\U0001F590\U0001F3FB", "hand_splayed_tone1", "hand with fingers splayed: light skin tone"},
+{"\U0001F590\U0001F3FC", "hand_splayed_tone2", "hand with fingers splayed: medium-light skin tone"},
+{"\U0001F590\U0001F3FD", "hand_splayed_tone3", "hand with fingers splayed: medium skin tone"},
+{"\U0001F590\U0001F3FE", "hand_splayed_tone4", "hand with fingers splayed: medium-dark skin tone"},
+{"\U0001F590\U0001F3FF", "hand_splayed_tone5", "hand with fingers splayed: dark skin tone"},
+{"\U0001FAF0\U0001F3FB", "hand with index finger and thumb crossed: light skin tone", "hand with index finger and thumb crossed: light skin tone"},
+{"\U0001FAF0\U0001F3FC", "hand with index finger and thumb crossed: medium-light skin tone", "hand with index finger and thumb crossed: medium-light skin tone"},
+{"\U0001FAF0\U0001F3FD", "hand with index finger and thumb crossed: medium skin tone", "hand with index finger and thumb crossed: medium skin tone"},
+{"\U0001FAF0\U0001F3FE", "hand with index finger and thumb crossed: medium-dark skin tone", "hand with index finger and thumb crossed: medium-dark skin tone"},
+{"\U0001FAF0\U0001F3FF", "hand with index finger and thumb crossed: dark skin tone", "hand with index finger and thumb crossed: dark skin tone"},
+{"\U0001F91D\U0001F3FB", "handshake: light skin tone", "handshake: light skin tone"},
+{"\U0001F91D\U0001F3FC", "handshake: medium-light skin tone", "handshake: medium-light skin tone"},
+{"\U0001F91D\U0001F3FD", "handshake: medium skin tone", "handshake: medium skin tone"},
+{"\U0001F91D\U0001F3FE", "handshake: medium-dark skin tone", "handshake: medium-dark skin tone"},
+{"\U0001F91D\U0001F3FF", "handshake: dark skin tone", "handshake: dark skin tone"},
+{"\U0001FAF1\U0001F3FB\U0000200D\U0001FAF2\U0001F3FC", "handshake: light skin tone, medium-light skin tone", "handshake: light skin tone, medium-light skin tone"},
+{"\U0001FAF1\U0001F3FB\U0000200D\U0001FAF2\U0001F3FD", "handshake: light skin tone, medium skin tone", "handshake: light skin tone, medium skin tone"},
+{"\U0001FAF1\U0001F3FB\U0000200D\U0001FAF2\U0001F3FE", "handshake: light skin tone, medium-dark skin tone", "handshake: light skin tone, medium-dark skin tone"},
+{"\U0001FAF1\U0001F3FB\U0000200D\U0001FAF2\U0001F3FF", "handshake: light skin tone, dark skin tone", "handshake: light skin tone, dark skin tone"},
+{"\U0001FAF1\U0001F3FC\U0000200D\U0001FAF2\U0001F3FB", "handshake: medium-light skin tone, light skin tone", "handshake: medium-light skin tone, light skin tone"},
+{"\U0001FAF1\U0001F3FC\U0000200D\U0001FAF2\U0001F3FD", "handshake: medium-light skin tone, medium skin tone", "handshake: medium-light skin tone, medium skin tone"},
+{"\U0001FAF1\U0001F3FC\U0000200D\U0001FAF2\U0001F3FE", "handshake: medium-light skin tone, medium-dark skin tone", "handshake: medium-light skin tone, medium-dark skin tone"},
+{"\U0001FAF1\U0001F3FC\U0000200D\U0001FAF2\U0001F3FF", "handshake: medium-light skin tone, dark skin tone", "handshake: medium-light skin tone, dark skin tone"},
+{"\U0001FAF1\U0001F3FD\U0000200D\U0001FAF2\U0001F3FB", "handshake: medium skin tone, light skin tone", "handshake: medium skin tone, light skin tone"},
+{"\U0001FAF1\U0001F3FD\U0000200D\U0001FAF2\U0001F3FC", "handshake: medium skin tone, medium-light skin tone", "handshake: medium skin tone, medium-light skin tone"},
+{"\U0001FAF1\U0001F3FD\U0000200D\U0001FAF2\U0001F3FE", "handshake: medium skin tone, medium-dark skin tone", "handshake: medium skin tone, medium-dark skin tone"},
+{"\U0001FAF1\U0001F3FD\U0000200D\U0001FAF2\U0001F3FF", "handshake: medium skin tone, dark skin tone", "handshake: medium skin tone, dark skin tone"},
+{"\U0001FAF1\U0001F3FE\U0000200D\U0001FAF2\U0001F3FB", "handshake: medium-dark skin tone, light skin tone", "handshake: medium-dark skin tone, light skin tone"},
+{"\U0001FAF1\U0001F3FE\U0000200D\U0001FAF2\U0001F3FC", "handshake: medium-dark skin tone, medium-light skin tone", "handshake: medium-dark skin tone, medium-light skin tone"},
+{"\U0001FAF1\U0001F3FE\U0000200D\U0001FAF2\U0001F3FD", "handshake: medium-dark skin tone, medium skin tone", "handshake: medium-dark skin tone, medium skin tone"},
+{"\U0001FAF1\U0001F3FE\U0000200D\U0001FAF2\U0001F3FF", "handshake: medium-dark skin tone, dark skin tone", "handshake: medium-dark skin tone, dark skin tone"},
+{"\U0001FAF1\U0001F3FF\U0000200D\U0001FAF2\U0001F3FB", "handshake: dark skin tone, light skin tone", "handshake: dark skin tone, light skin tone"},
+{"\U0001FAF1\U0001F3FF\U0000200D\U0001FAF2\U0001F3FC", "handshake: dark skin tone, medium-light skin tone", "handshake: dark skin tone, medium-light skin tone"},
+{"\U0001FAF1\U0001F3FF\U0000200D\U0001FAF2\U0001F3FD", "handshake: dark skin tone, medium skin tone", "handshake: dark skin tone, medium skin tone"},
+{"\U0001FAF1\U0001F3FF\U0000200D\U0001FAF2\U0001F3FE", "handshake: dark skin tone, medium-dark skin tone", "handshake: dark skin tone, medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U00002695\U0000FE0F", "health worker: light skin tone", "health worker: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U00002695\U0000FE0F", "health worker: medium-light skin tone", "health worker: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U00002695\U0000FE0F", "health worker: medium skin tone", "health worker: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U00002695\U0000FE0F", "health worker: medium-dark skin tone", "health worker: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U00002695\U0000FE0F", "health worker: dark skin tone", "health worker: dark skin tone"},
+{"\U0001FAF6\U0001F3FB", "heart hands: light skin tone", "heart hands: light skin tone"},
+{"\U0001FAF6\U0001F3FC", "heart hands: medium-light skin tone", "heart hands: medium-light skin tone"},
+{"\U0001FAF6\U0001F3FD", "heart hands: medium skin tone", "heart hands: medium skin tone"},
+{"\U0001FAF6\U0001F3FE", "heart hands: medium-dark skin tone", "heart hands: medium-dark skin tone"},
+{"\U0001FAF6\U0001F3FF", "heart hands: dark skin tone", "heart hands: dark skin tone"},
+{"\U0001F3C7\U0001F3FB", "horse_racing_tone1", "horse racing: light skin tone"},
+{"\U0001F3C7\U0001F3FC", "horse_racing_tone2", "horse racing: medium-light skin tone"},
+{"\U0001F3C7\U0001F3FD", "horse_racing_tone3", "horse racing: medium skin tone"},
+{"\U0001F3C7\U0001F3FE", "horse_racing_tone4", "horse racing: medium-dark skin tone"},
+{"\U0001F3C7\U0001F3FF", "horse_racing_tone5", "horse racing: dark skin tone"},
+{"\U0001FAF5\U0001F3FB", "index pointing at the viewer: light skin tone", "index pointing at the viewer: light skin tone"},
+{"\U0001FAF5\U0001F3FC", "index pointing at the viewer: medium-light skin tone", "index pointing at the viewer: medium-light skin tone"},
+{"\U0001FAF5\U0001F3FD", "index pointing at the viewer: medium skin tone", "index pointing at the viewer: medium skin tone"},
+{"\U0001FAF5\U0001F3FE", "index pointing at the viewer: medium-dark skin tone", "index pointing at the viewer: medium-dark skin tone"},
+{"\U0001FAF5\U0001F3FF", "index pointing at the viewer: dark skin tone", "index pointing at the viewer: dark skin tone"},
+{"\U0000261D\U0001F3FB", "point_up_tone1", "index pointing up: light skin tone"},
+{"\U0000261D\U0001F3FC", "point_up_tone2", "index pointing up: medium-light skin tone"},
+{"\U0000261D\U0001F3FD", "point_up_tone3", "index pointing up: medium skin tone"},
+{"\U0000261D\U0001F3FE", "point_up_tone4", "index pointing up: medium-dark skin tone"},
+{"\U0000261D\U0001F3FF", "point_up_tone5", "index pointing up: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U00002696\U0000FE0F", "judge: light skin tone", "judge: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U00002696\U0000FE0F", "judge: medium-light skin tone", "judge: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U00002696\U0000FE0F", "judge: medium skin tone", "judge: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U00002696\U0000FE0F", "judge: medium-dark skin tone", "judge: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U00002696\U0000FE0F", "judge: dark skin tone", "judge: dark skin tone"},
+{"\U0001F48F\U0001F3FB", "kiss: light skin tone", "kiss: light skin tone"},
+{"\U0001F48F\U0001F3FC", "kiss: medium-light skin tone", "kiss: medium-light skin tone"},
+{"\U0001F48F\U0001F3FD", "kiss: medium skin tone", "kiss: medium skin tone"},
+{"\U0001F48F\U0001F3FE", "kiss: medium-dark skin tone", "kiss: medium-dark skin tone"},
+{"\U0001F48F\U0001F3FF", "kiss: dark skin tone", "kiss: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FC", "kiss: person, person, light skin tone, medium-light skin tone", "kiss: person, person, light skin tone, medium-light skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FD", "kiss: person, person, light skin tone, medium skin tone", "kiss: person, person, light skin tone, medium skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FE", "kiss: person, person, light skin tone, medium-dark skin tone", "kiss: person, person, light skin tone, medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FF", "kiss: person, person, light skin tone, dark skin tone", "kiss: person, person, light skin tone, dark skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FB", "kiss: person, person, medium-light skin tone, light skin tone", "kiss: person, person, medium-light skin tone, light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FD", "kiss: person, person, medium-light skin tone, medium skin tone", "kiss: person, person, medium-light skin tone, medium skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FE", "kiss: person, person, medium-light skin tone, medium-dark skin tone", "kiss: person, person, medium-light skin tone, medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FF", "kiss: person, person, medium-light skin tone, dark skin tone", "kiss: person, person, medium-light skin tone, dark skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FB", "kiss: person, person, medium skin tone, light skin tone", "kiss: person, person, medium skin tone, light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FC", "kiss: person, person, medium skin tone, medium-light skin tone", "kiss: person, person, medium skin tone, medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FE", "kiss: person, person, medium skin tone, medium-dark skin tone", "kiss: person, person, medium skin tone, medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FF", "kiss: person, person, medium skin tone, dark skin tone", "kiss: person, person, medium skin tone, dark skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FB", "kiss: person, person, medium-dark skin tone, light skin tone", "kiss: person, person, medium-dark skin tone, light skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FC", "kiss: person, person, medium-dark skin tone, medium-light skin tone", "kiss: person, person, medium-dark skin tone, medium-light skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FD", "kiss: person, person, medium-dark skin tone, medium skin tone", "kiss: person, person, medium-dark skin tone, medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FF", "kiss: person, person, medium-dark skin tone, dark skin tone", "kiss: person, person, medium-dark skin tone, dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FB", "kiss: person, person, dark skin tone, light skin tone", "kiss: person, person, dark skin tone, light skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FC", "kiss: person, person, dark skin tone, medium-light skin tone", "kiss: person, person, dark skin tone, medium-light skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FD", "kiss: person, person, dark skin tone, medium skin tone", "kiss: person, person, dark skin tone, medium skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F9D1\U0001F3FE", "kiss: person, person, dark skin tone, medium-dark skin tone", "kiss: person, person, dark skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", "kiss: woman, man, light skin tone", "kiss: woman, man, light skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", "kiss: woman, man, light skin tone, medium-light skin tone", "kiss: woman, man, light skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", "kiss: woman, man, light skin tone, medium skin tone", "kiss: woman, man, light skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", "kiss: woman, man, light skin tone, medium-dark skin tone", "kiss: woman, man, light skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", "kiss: woman, man, light skin tone, dark skin tone", "kiss: woman, man, light skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", "kiss: woman, man, medium-light skin tone, light skin tone", "kiss: woman, man, medium-light skin tone, light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", "kiss: woman, man, medium-light skin tone", "kiss: woman, man, medium-light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", "kiss: woman, man, medium-light skin tone, medium skin tone", "kiss: woman, man, medium-light skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", "kiss: woman, man, medium-light skin tone, medium-dark skin tone", "kiss: woman, man, medium-light skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", "kiss: woman, man, medium-light skin tone, dark skin tone", "kiss: woman, man, medium-light skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", "kiss: woman, man, medium skin tone, light skin tone", "kiss: woman, man, medium skin tone, light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", "kiss: woman, man, medium skin tone, medium-light skin tone", "kiss: woman, man, medium skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", "kiss: woman, man, medium skin tone", "kiss: woman, man, medium skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", "kiss: woman, man, medium skin tone, medium-dark skin tone", "kiss: woman, man, medium skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", "kiss: woman, man, medium skin tone, dark skin tone", "kiss: woman, man, medium skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", "kiss: woman, man, medium-dark skin tone, light skin tone", "kiss: woman, man, medium-dark skin tone, light skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", "kiss: woman, man, medium-dark skin tone, medium-light skin tone", "kiss: woman, man, medium-dark skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", "kiss: woman, man, medium-dark skin tone, medium skin tone", "kiss: woman, man, medium-dark skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", "kiss: woman, man, medium-dark skin tone", "kiss: woman, man, medium-dark skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", "kiss: woman, man, medium-dark skin tone, dark skin tone", "kiss: woman, man, medium-dark skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", "kiss: woman, man, dark skin tone, light skin tone", "kiss: woman, man, dark skin tone, light skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", "kiss: woman, man, dark skin tone, medium-light skin tone", "kiss: woman, man, dark skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", "kiss: woman, man, dark skin tone, medium skin tone", "kiss: woman, man, dark skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", "kiss: woman, man, dark skin tone, medium-dark skin tone", "kiss: woman, man, dark skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", "kiss: woman, man, dark skin tone", "kiss: woman, man, dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", "kiss: man, man, light skin tone", "kiss: man, man, light skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", "kiss: man, man, light skin tone, medium-light skin tone", "kiss: man, man, light skin tone, medium-light skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", "kiss: man, man, light skin tone, medium skin tone", "kiss: man, man, light skin tone, medium skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", "kiss: man, man, light skin tone, medium-dark skin tone", "kiss: man, man, light skin tone, medium-dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", "kiss: man, man, light skin tone, dark skin tone", "kiss: man, man, light skin tone, dark skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", "kiss: man, man, medium-light skin tone, light skin tone", "kiss: man, man, medium-light skin tone, light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", "kiss: man, man, medium-light skin tone", "kiss: man, man, medium-light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", "kiss: man, man, medium-light skin tone, medium skin tone", "kiss: man, man, medium-light skin tone, medium skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", "kiss: man, man, medium-light skin tone, medium-dark skin tone", "kiss: man, man, medium-light skin tone, medium-dark skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", "kiss: man, man, medium-light skin tone, dark skin tone", "kiss: man, man, medium-light skin tone, dark skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", "kiss: man, man, medium skin tone, light skin tone", "kiss: man, man, medium skin tone, light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", "kiss: man, man, medium skin tone, medium-light skin tone", "kiss: man, man, medium skin tone, medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", "kiss: man, man, medium skin tone", "kiss: man, man, medium skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", "kiss: man, man, medium skin tone, medium-dark skin tone", "kiss: man, man, medium skin tone, medium-dark skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", "kiss: man, man, medium skin tone, dark skin tone", "kiss: man, man, medium skin tone, dark skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", "kiss: man, man, medium-dark skin tone, light skin tone", "kiss: man, man, medium-dark skin tone, light skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", "kiss: man, man, medium-dark skin tone, medium-light skin tone", "kiss: man, man, medium-dark skin tone, medium-light skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", "kiss: man, man, medium-dark skin tone, medium skin tone", "kiss: man, man, medium-dark skin tone, medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", "kiss: man, man, medium-dark skin tone", "kiss: man, man, medium-dark skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", "kiss: man, man, medium-dark skin tone, dark skin tone", "kiss: man, man, medium-dark skin tone, dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FB", "kiss: man, man, dark skin tone, light skin tone", "kiss: man, man, dark skin tone, light skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FC", "kiss: man, man, dark skin tone, medium-light skin tone", "kiss: man, man, dark skin tone, medium-light skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FD", "kiss: man, man, dark skin tone, medium skin tone", "kiss: man, man, dark skin tone, medium skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FE", "kiss: man, man, dark skin tone, medium-dark skin tone", "kiss: man, man, dark skin tone, medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F468\U0001F3FF", "kiss: man, man, dark skin tone", "kiss: man, man, dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB", "kiss: woman, woman, light skin tone", "kiss: woman, woman, light skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC", "kiss: woman, woman, light skin tone, medium-light skin tone", "kiss: woman, woman, light skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD", "kiss: woman, woman, light skin tone, medium skin tone", "kiss: woman, woman, light skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE", "kiss: woman, woman, light skin tone, medium-dark skin tone", "kiss: woman, woman, light skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF", "kiss: woman, woman, light skin tone, dark skin tone", "kiss: woman, woman, light skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB", "kiss: woman, woman, medium-light skin tone, light skin tone", "kiss: woman, woman, medium-light skin tone, light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC", "kiss: woman, woman, medium-light skin tone", "kiss: woman, woman, medium-light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD", "kiss: woman, woman, medium-light skin tone, medium skin tone", "kiss: woman, woman, medium-light skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE", "kiss: woman, woman, medium-light skin tone, medium-dark skin tone", "kiss: woman, woman, medium-light skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF", "kiss: woman, woman, medium-light skin tone, dark skin tone", "kiss: woman, woman, medium-light skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB", "kiss: woman, woman, medium skin tone, light skin tone", "kiss: woman, woman, medium skin tone, light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC", "kiss: woman, woman, medium skin tone, medium-light skin tone", "kiss: woman, woman, medium skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD", "kiss: woman, woman, medium skin tone", "kiss: woman, woman, medium skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE", "kiss: woman, woman, medium skin tone, medium-dark skin tone", "kiss: woman, woman, medium skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF", "kiss: woman, woman, medium skin tone, dark skin tone", "kiss: woman, woman, medium skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB", "kiss: woman, woman, medium-dark skin tone, light skin tone", "kiss: woman, woman, medium-dark skin tone, light skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC", "kiss: woman, woman, medium-dark skin tone, medium-light skin tone", "kiss: woman, woman, medium-dark skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD", "kiss: woman, woman, medium-dark skin tone, medium skin tone", "kiss: woman, woman, medium-dark skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE", "kiss: woman, woman, medium-dark skin tone", "kiss: woman, woman, medium-dark skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF", "kiss: woman, woman, medium-dark skin tone, dark skin tone", "kiss: woman, woman, medium-dark skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FB", "kiss: woman, woman, dark skin tone, light skin tone", "kiss: woman, woman, dark skin tone, light skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FC", "kiss: woman, woman, dark skin tone, medium-light skin tone", "kiss: woman, woman, dark skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FD", "kiss: woman, woman, dark skin tone, medium skin tone", "kiss: woman, woman, dark skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FE", "kiss: woman, woman, dark skin tone, medium-dark skin tone", "kiss: woman, woman, dark skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002764\U0000FE0F\U0000200D\U0001F48B\U0000200D\U0001F469\U0001F3FF", "kiss: woman, woman, dark skin tone", "kiss: woman, woman, dark skin tone"},
+{"\U0001F91B\U0001F3FB", "left_facing_fist_tone1", "left-facing fist: light skin tone"},
+{"\U0001F91B\U0001F3FC", "left_facing_fist_tone2", "left-facing fist: medium-light skin tone"},
+{"\U0001F91B\U0001F3FD", "left_facing_fist_tone3", "left-facing fist: medium skin tone"},
+{"\U0001F91B\U0001F3FE", "left_facing_fist_tone4", "left-facing fist: medium-dark skin tone"},
+{"\U0001F91B\U0001F3FF", "left_facing_fist_tone5", "left-facing fist: dark skin tone"},
+{"\U0001FAF2\U0001F3FB", "leftwards hand: light skin tone", "leftwards hand: light skin tone"},
+{"\U0001FAF2\U0001F3FC", "leftwards hand: medium-light skin tone", "leftwards hand: medium-light skin tone"},
+{"\U0001FAF2\U0001F3FD", "leftwards hand: medium skin tone", "leftwards hand: medium skin tone"},
+{"\U0001FAF2\U0001F3FE", "leftwards hand: medium-dark skin tone", "leftwards hand: medium-dark skin tone"},
+{"\U0001FAF2\U0001F3FF", "leftwards hand: dark skin tone", "leftwards hand: dark skin tone"},
+{"\U0001F9B5\U0001F3FB", "leg_tone1", "leg: light skin tone"},
+{"\U0001F9B5\U0001F3FC", "leg_tone2", "leg: medium-light skin tone"},
+{"\U0001F9B5\U0001F3FD", "leg_tone3", "leg: medium skin tone"},
+{"\U0001F9B5\U0001F3FE", "leg_tone4", "leg: medium-dark skin tone"},
+{"\U0001F9B5\U0001F3FF", "leg_tone5", "leg: dark skin tone"},
+{"\U0001F3FB", "tone1", "light skin tone"},
+{"\U0001F91F\U0001F3FB", "love_you_gesture_tone1", "love-you gesture: light skin tone"},
+{"\U0001F91F\U0001F3FC", "love_you_gesture_tone2", "love-you gesture: medium-light skin tone"},
+{"\U0001F91F\U0001F3FD", "love_you_gesture_tone3", "love-you gesture: medium skin tone"},
+{"\U0001F91F\U0001F3FE", "love_you_gesture_tone4", "love-you gesture: medium-dark skin tone"},
+{"\U0001F91F\U0001F3FF", "love_you_gesture_tone5", "love-you gesture: dark skin tone"},
+{"\U0001F9D9\U0001F3FB", "mage_tone1", "mage: light skin tone"},
+{"\U0001F9D9\U0001F3FC", "mage_tone2", "mage: medium-light skin tone"},
+{"\U0001F9D9\U0001F3FD", "mage_tone3", "mage: medium skin tone"},
+{"\U0001F9D9\U0001F3FE", "mage_tone4", "mage: medium-dark skin tone"},
+{"\U0001F9D9\U0001F3FF", "mage_tone5", "mage: dark skin tone"},
+{"\U0001F468\U0001F3FB", "man_tone1", "man: light skin tone"},
+{"\U0001F468\U0001F3FC", "man_tone2", "man: medium-light skin tone"},
+{"\U0001F468\U0001F3FD", "man_tone3", "man: medium skin tone"},
+{"\U0001F468\U0001F3FE", "man_tone4", "man: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF", "man_tone5", "man: dark skin tone"},
+{"\U0001F9D4\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man: light skin tone, beard", "man: light skin tone, beard"},
+{"\U0001F9D4\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man: medium-light skin tone, beard", "man: medium-light skin tone, beard"},
+{"\U0001F9D4\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man: medium skin tone, beard", "man: medium skin tone, beard"},
+{"\U0001F9D4\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man: medium-dark skin tone, beard", "man: medium-dark skin tone, beard"},
+{"\U0001F9D4\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man: dark skin tone, beard", "man: dark skin tone, beard"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F9B0", "man: light skin tone, red hair", "man: light skin tone, red hair"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F9B0", "man: medium-light skin tone, red hair", "man: medium-light skin tone, red hair"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F9B0", "man: medium skin tone, red hair", "man: medium skin tone, red hair"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F9B0", "man: medium-dark skin tone, red hair", "man: medium-dark skin tone, red hair"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F9B0", "man: dark skin tone, red hair", "man: dark skin tone, red hair"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F9B1", "man: light skin tone, curly hair", "man: light skin tone, curly hair"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F9B1", "man: medium-light skin tone, curly hair", "man: medium-light skin tone, curly hair"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F9B1", "man: medium skin tone, curly hair", "man: medium skin tone, curly hair"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F9B1", "man: medium-dark skin tone, curly hair", "man: medium-dark skin tone, curly hair"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F9B1", "man: dark skin tone, curly hair", "man: dark skin tone, curly hair"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F9B3", "man: light skin tone, white hair", "man: light skin tone, white hair"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F9B3", "man: medium-light skin tone, white hair", "man: medium-light skin tone, white hair"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F9B3", "man: medium skin tone, white hair", "man: medium skin tone, white hair"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F9B3", "man: medium-dark skin tone, white hair", "man: medium-dark skin tone, white hair"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F9B3", "man: dark skin tone, white hair", "man: dark skin tone, white hair"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F9B2", "man: light skin tone, bald", "man: light skin tone, bald"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F9B2", "man: medium-light skin tone, bald", "man: medium-light skin tone, bald"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F9B2", "man: medium skin tone, bald", "man: medium skin tone, bald"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F9B2", "man: medium-dark skin tone, bald", "man: medium-dark skin tone, bald"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F9B2", "man: dark skin tone, bald", "man: dark skin tone, bald"},
+{"\U0001F471\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man: light skin tone, blond hair", "man: light skin tone, blond hair"},
+{"\U0001F471\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man: medium-light skin tone, blond hair", "man: medium-light skin tone, blond hair"},
+{"\U0001F471\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man: medium skin tone, blond hair", "man: medium skin tone, blond hair"},
+{"\U0001F471\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man: medium-dark skin tone, blond hair", "man: medium-dark skin tone, blond hair"},
+{"\U0001F471\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man: dark skin tone, blond hair", "man: dark skin tone, blond hair"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F3A8", "man artist: light skin tone", "man artist: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F3A8", "man artist: medium-light skin tone", "man artist: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F3A8", "man artist: medium skin tone", "man artist: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F3A8", "man artist: medium-dark skin tone", "man artist: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F3A8", "man artist: dark skin tone", "man artist: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F680", "man astronaut: light skin tone", "man astronaut: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F680", "man astronaut: medium-light skin tone", "man astronaut: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F680", "man astronaut: medium skin tone", "man astronaut: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F680", "man astronaut: medium-dark skin tone", "man astronaut: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F680", "man astronaut: dark skin tone", "man astronaut: dark skin tone"},
+{"\U0001F6B4\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man biking: light skin tone", "man biking: light skin tone"},
+{"\U0001F6B4\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man biking: medium-light skin tone", "man biking: medium-light skin tone"},
+{"\U0001F6B4\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man biking: medium skin tone", "man biking: medium skin tone"},
+{"\U0001F6B4\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man biking: medium-dark skin tone", "man biking: medium-dark skin tone"},
+{"\U0001F6B4\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man biking: dark skin tone", "man biking: dark skin tone"},
+{"\U000026F9\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man bouncing ball: light skin tone", "man bouncing ball: light skin tone"},
+{"\U000026F9\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man bouncing ball: medium-light skin tone", "man bouncing ball: medium-light skin tone"},
+{"\U000026F9\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man bouncing ball: medium skin tone", "man bouncing ball: medium skin tone"},
+{"\U000026F9\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man bouncing ball: medium-dark skin tone", "man bouncing ball: medium-dark skin tone"},
+{"\U000026F9\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man bouncing ball: dark skin tone", "man bouncing ball: dark skin tone"},
+{"\U0001F647\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man bowing: light skin tone", "man bowing: light skin tone"},
+{"\U0001F647\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man bowing: medium-light skin tone", "man bowing: medium-light skin tone"},
+{"\U0001F647\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man bowing: medium skin tone", "man bowing: medium skin tone"},
+{"\U0001F647\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man bowing: medium-dark skin tone", "man bowing: medium-dark skin tone"},
+{"\U0001F647\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man bowing: dark skin tone", "man bowing: dark skin tone"},
+{"\U0001F938\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man cartwheeling: light skin tone", "man cartwheeling: light skin tone"},
+{"\U0001F938\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man cartwheeling: medium-light skin tone", "man cartwheeling: medium-light skin tone"},
+{"\U0001F938\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man cartwheeling: medium skin tone", "man cartwheeling: medium skin tone"},
+{"\U0001F938\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man cartwheeling: medium-dark skin tone", "man cartwheeling: medium-dark skin tone"},
+{"\U0001F938\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man cartwheeling: dark skin tone", "man cartwheeling: dark skin tone"},
+{"\U0001F9D7\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man climbing: light skin tone", "man climbing: light skin tone"},
+{"\U0001F9D7\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man climbing: medium-light skin tone", "man climbing: medium-light skin tone"},
+{"\U0001F9D7\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man climbing: medium skin tone", "man climbing: medium skin tone"},
+{"\U0001F9D7\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man climbing: medium-dark skin tone", "man climbing: medium-dark skin tone"},
+{"\U0001F9D7\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man climbing: dark skin tone", "man climbing: dark skin tone"},
+{"\U0001F477\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man construction worker: light skin tone", "man construction worker: light skin tone"},
+{"\U0001F477\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man construction worker: medium-light skin tone", "man construction worker: medium-light skin tone"},
+{"\U0001F477\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man construction worker: medium skin tone", "man construction worker: medium skin tone"},
+{"\U0001F477\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man construction worker: medium-dark skin tone", "man construction worker: medium-dark skin tone"},
+{"\U0001F477\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man construction worker: dark skin tone", "man construction worker: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F373", "man cook: light skin tone", "man cook: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F373", "man cook: medium-light skin tone", "man cook: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F373", "man cook: medium skin tone", "man cook: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F373", "man cook: medium-dark skin tone", "man cook: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F373", "man cook: dark skin tone", "man cook: dark skin tone"},
+{"\U0001F57A\U0001F3FB", "man_dancing_tone1", "man dancing: light skin tone"},
+{"\U0001F57A\U0001F3FC", "man_dancing_tone2", "man dancing: medium-light skin tone"},
+{"\U0001F57A\U0001F3FD", "man_dancing_tone3", "man dancing: medium skin tone"},
+{"\U0001F57A\U0001F3FE", "man_dancing_tone4", "man dancing: medium-dark skin tone"},
+{"\U0001F57A\U0001F3FF", "man_dancing_tone5", "man dancing: dark skin tone"},
+{"\U0001F575\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man detective: light skin tone", "man detective: light skin tone"},
+{"\U0001F575\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man detective: medium-light skin tone", "man detective: medium-light skin tone"},
+{"\U0001F575\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man detective: medium skin tone", "man detective: medium skin tone"},
+{"\U0001F575\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man detective: medium-dark skin tone", "man detective: medium-dark skin tone"},
+{"\U0001F575\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man detective: dark skin tone", "man detective: dark skin tone"},
+{"\U0001F9DD\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man elf: light skin tone", "man elf: light skin tone"},
+{"\U0001F9DD\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man elf: medium-light skin tone", "man elf: medium-light skin tone"},
+{"\U0001F9DD\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man elf: medium skin tone", "man elf: medium skin tone"},
+{"\U0001F9DD\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man elf: medium-dark skin tone", "man elf: medium-dark skin tone"},
+{"\U0001F9DD\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man elf: dark skin tone", "man elf: dark skin tone"},
+{"\U0001F926\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man facepalming: light skin tone", "man facepalming: light skin tone"},
+{"\U0001F926\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man facepalming: medium-light skin tone", "man facepalming: medium-light skin tone"},
+{"\U0001F926\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man facepalming: medium skin tone", "man facepalming: medium skin tone"},
+{"\U0001F926\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man facepalming: medium-dark skin tone", "man facepalming: medium-dark skin tone"},
+{"\U0001F926\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man facepalming: dark skin tone", "man facepalming: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F3ED", "man factory worker: light skin tone", "man factory worker: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F3ED", "man factory worker: medium-light skin tone", "man factory worker: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F3ED", "man factory worker: medium skin tone", "man factory worker: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F3ED", "man factory worker: medium-dark skin tone", "man factory worker: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F3ED", "man factory worker: dark skin tone", "man factory worker: dark skin tone"},
+{"\U0001F9DA\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man fairy: light skin tone", "man fairy: light skin tone"},
+{"\U0001F9DA\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man fairy: medium-light skin tone", "man fairy: medium-light skin tone"},
+{"\U0001F9DA\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man fairy: medium skin tone", "man fairy: medium skin tone"},
+{"\U0001F9DA\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man fairy: medium-dark skin tone", "man fairy: medium-dark skin tone"},
+{"\U0001F9DA\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man fairy: dark skin tone", "man fairy: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F33E", "man farmer: light skin tone", "man farmer: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F33E", "man farmer: medium-light skin tone", "man farmer: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F33E", "man farmer: medium skin tone", "man farmer: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F33E", "man farmer: medium-dark skin tone", "man farmer: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F33E", "man farmer: dark skin tone", "man farmer: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F37C", "man feeding baby: light skin tone", "man feeding baby: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F37C", "man feeding baby: medium-light skin tone", "man feeding baby: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F37C", "man feeding baby: medium skin tone", "man feeding baby: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F37C", "man feeding baby: medium-dark skin tone", "man feeding baby: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F37C", "man feeding baby: dark skin tone", "man feeding baby: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F692", "man firefighter: light skin tone", "man firefighter: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F692", "man firefighter: medium-light skin tone", "man firefighter: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F692", "man firefighter: medium skin tone", "man firefighter: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F692", "man firefighter: medium-dark skin tone", "man firefighter: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F692", "man firefighter: dark skin tone", "man firefighter: dark skin tone"},
+{"\U0001F64D\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man frowning: light skin tone", "man frowning: light skin tone"},
+{"\U0001F64D\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man frowning: medium-light skin tone", "man frowning: medium-light skin tone"},
+{"\U0001F64D\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man frowning: medium skin tone", "man frowning: medium skin tone"},
+{"\U0001F64D\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man frowning: medium-dark skin tone", "man frowning: medium-dark skin tone"},
+{"\U0001F64D\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man frowning: dark skin tone", "man frowning: dark skin tone"},
+{"\U0001F645\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man gesturing NO: light skin tone", "man gesturing NO: light skin tone"},
+{"\U0001F645\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man gesturing NO: medium-light skin tone", "man gesturing NO: medium-light skin tone"},
+{"\U0001F645\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man gesturing NO: medium skin tone", "man gesturing NO: medium skin tone"},
+{"\U0001F645\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man gesturing NO: medium-dark skin tone", "man gesturing NO: medium-dark skin tone"},
+{"\U0001F645\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man gesturing NO: dark skin tone", "man gesturing NO: dark skin tone"},
+{"\U0001F646\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man gesturing OK: light skin tone", "man gesturing OK: light skin tone"},
+{"\U0001F646\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man gesturing OK: medium-light skin tone", "man gesturing OK: medium-light skin tone"},
+{"\U0001F646\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man gesturing OK: medium skin tone", "man gesturing OK: medium skin tone"},
+{"\U0001F646\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man gesturing OK: medium-dark skin tone", "man gesturing OK: medium-dark skin tone"},
+{"\U0001F646\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man gesturing OK: dark skin tone", "man gesturing OK: dark skin tone"},
+{"\U0001F487\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man getting haircut: light skin tone", "man getting haircut: light skin tone"},
+{"\U0001F487\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man getting haircut: medium-light skin tone", "man getting haircut: medium-light skin tone"},
+{"\U0001F487\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man getting haircut: medium skin tone", "man getting haircut: medium skin tone"},
+{"\U0001F487\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man getting haircut: medium-dark skin tone", "man getting haircut: medium-dark skin tone"},
+{"\U0001F487\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man getting haircut: dark skin tone", "man getting haircut: dark skin tone"},
+{"\U0001F486\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man getting massage: light skin tone", "man getting massage: light skin tone"},
+{"\U0001F486\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man getting massage: medium-light skin tone", "man getting massage: medium-light skin tone"},
+{"\U0001F486\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man getting massage: medium skin tone", "man getting massage: medium skin tone"},
+{"\U0001F486\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man getting massage: medium-dark skin tone", "man getting massage: medium-dark skin tone"},
+{"\U0001F486\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man getting massage: dark skin tone", "man getting massage: dark skin tone"},
+{"\U0001F3CC\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man golfing: light skin tone", "man golfing: light skin tone"},
+{"\U0001F3CC\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man golfing: medium-light skin tone", "man golfing: medium-light skin tone"},
+{"\U0001F3CC\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man golfing: medium skin tone", "man golfing: medium skin tone"},
+{"\U0001F3CC\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man golfing: medium-dark skin tone", "man golfing: medium-dark skin tone"},
+{"\U0001F3CC\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man golfing: dark skin tone", "man golfing: dark skin tone"},
+{"\U0001F482\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man guard: light skin tone", "man guard: light skin tone"},
+{"\U0001F482\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man guard: medium-light skin tone", "man guard: medium-light skin tone"},
+{"\U0001F482\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man guard: medium skin tone", "man guard: medium skin tone"},
+{"\U0001F482\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man guard: medium-dark skin tone", "man guard: medium-dark skin tone"},
+{"\U0001F482\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man guard: dark skin tone", "man guard: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U00002695\U0000FE0F", "man health worker: light skin tone", "man health worker: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U00002695\U0000FE0F", "man health worker: medium-light skin tone", "man health worker: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U00002695\U0000FE0F", "man health worker: medium skin tone", "man health worker: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U00002695\U0000FE0F", "man health worker: medium-dark skin tone", "man health worker: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U00002695\U0000FE0F", "man health worker: dark skin tone", "man health worker: dark skin tone"},
+{"\U0001F9D8\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man in lotus position: light skin tone", "man in lotus position: light skin tone"},
+{"\U0001F9D8\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man in lotus position: medium-light skin tone", "man in lotus position: medium-light skin tone"},
+{"\U0001F9D8\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man in lotus position: medium skin tone", "man in lotus position: medium skin tone"},
+{"\U0001F9D8\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man in lotus position: medium-dark skin tone", "man in lotus position: medium-dark skin tone"},
+{"\U0001F9D8\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man in lotus position: dark skin tone", "man in lotus position: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F9BD", "man in manual wheelchair: light skin tone", "man in manual wheelchair: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F9BD", "man in manual wheelchair: medium-light skin tone", "man in manual wheelchair: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F9BD", "man in manual wheelchair: medium skin tone", "man in manual wheelchair: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F9BD", "man in manual wheelchair: medium-dark skin tone", "man in manual wheelchair: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F9BD", "man in manual wheelchair: dark skin tone", "man in manual wheelchair: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F9BC", "man in motorized wheelchair: light skin tone", "man in motorized wheelchair: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F9BC", "man in motorized wheelchair: medium-light skin tone", "man in motorized wheelchair: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F9BC", "man in motorized wheelchair: medium skin tone", "man in motorized wheelchair: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F9BC", "man in motorized wheelchair: medium-dark skin tone", "man in motorized wheelchair: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F9BC", "man in motorized wheelchair: dark skin tone", "man in motorized wheelchair: dark skin tone"},
+{"\U0001F9D6\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man in steamy room: light skin tone", "man in steamy room: light skin tone"},
+{"\U0001F9D6\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man in steamy room: medium-light skin tone", "man in steamy room: medium-light skin tone"},
+{"\U0001F9D6\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man in steamy room: medium skin tone", "man in steamy room: medium skin tone"},
+{"\U0001F9D6\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man in steamy room: medium-dark skin tone", "man in steamy room: medium-dark skin tone"},
+{"\U0001F9D6\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man in steamy room: dark skin tone", "man in steamy room: dark skin tone"},
+{"\U0001F935\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man in tuxedo: light skin tone", "man in tuxedo: light skin tone"},
+{"\U0001F935\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man in tuxedo: medium-light skin tone", "man in tuxedo: medium-light skin tone"},
+{"\U0001F935\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man in tuxedo: medium skin tone", "man in tuxedo: medium skin tone"},
+{"\U0001F935\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man in tuxedo: medium-dark skin tone", "man in tuxedo: medium-dark skin tone"},
+{"\U0001F935\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man in tuxedo: dark skin tone", "man in tuxedo: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U00002696\U0000FE0F", "man judge: light skin tone", "man judge: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U00002696\U0000FE0F", "man judge: medium-light skin tone", "man judge: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U00002696\U0000FE0F", "man judge: medium skin tone", "man judge: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U00002696\U0000FE0F", "man judge: medium-dark skin tone", "man judge: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U00002696\U0000FE0F", "man judge: dark skin tone", "man judge: dark skin tone"},
+{"\U0001F939\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man juggling: light skin tone", "man juggling: light skin tone"},
+{"\U0001F939\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man juggling: medium-light skin tone", "man juggling: medium-light skin tone"},
+{"\U0001F939\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man juggling: medium skin tone", "man juggling: medium skin tone"},
+{"\U0001F939\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man juggling: medium-dark skin tone", "man juggling: medium-dark skin tone"},
+{"\U0001F939\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man juggling: dark skin tone", "man juggling: dark skin tone"},
+{"\U0001F9CE\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man kneeling: light skin tone", "man kneeling: light skin tone"},
+{"\U0001F9CE\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man kneeling: medium-light skin tone", "man kneeling: medium-light skin tone"},
+{"\U0001F9CE\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man kneeling: medium skin tone", "man kneeling: medium skin tone"},
+{"\U0001F9CE\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man kneeling: medium-dark skin tone", "man kneeling: medium-dark skin tone"},
+{"\U0001F9CE\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man kneeling: dark skin tone", "man kneeling: dark skin tone"},
+{"\U0001F3CB\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man lifting weights: light skin tone", "man lifting weights: light skin tone"},
+{"\U0001F3CB\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man lifting weights: medium-light skin tone", "man lifting weights: medium-light skin tone"},
+{"\U0001F3CB\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man lifting weights: medium skin tone", "man lifting weights: medium skin tone"},
+{"\U0001F3CB\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man lifting weights: medium-dark skin tone", "man lifting weights: medium-dark skin tone"},
+{"\U0001F3CB\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man lifting weights: dark skin tone", "man lifting weights: dark skin tone"},
+{"\U0001F9D9\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man mage: light skin tone", "man mage: light skin tone"},
+{"\U0001F9D9\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man mage: medium-light skin tone", "man mage: medium-light skin tone"},
+{"\U0001F9D9\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man mage: medium skin tone", "man mage: medium skin tone"},
+{"\U0001F9D9\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man mage: medium-dark skin tone", "man mage: medium-dark skin tone"},
+{"\U0001F9D9\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man mage: dark skin tone", "man mage: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F527", "man mechanic: light skin tone", "man mechanic: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F527", "man mechanic: medium-light skin tone", "man mechanic: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F527", "man mechanic: medium skin tone", "man mechanic: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F527", "man mechanic: medium-dark skin tone", "man mechanic: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F527", "man mechanic: dark skin tone", "man mechanic: dark skin tone"},
+{"\U0001F6B5\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man mountain biking: light skin tone", "man mountain biking: light skin tone"},
+{"\U0001F6B5\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man mountain biking: medium-light skin tone", "man mountain biking: medium-light skin tone"},
+{"\U0001F6B5\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man mountain biking: medium skin tone", "man mountain biking: medium skin tone"},
+{"\U0001F6B5\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man mountain biking: medium-dark skin tone", "man mountain biking: medium-dark skin tone"},
+{"\U0001F6B5\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man mountain biking: dark skin tone", "man mountain biking: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F4BC", "man office worker: light skin tone", "man office worker: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F4BC", "man office worker: medium-light skin tone", "man office worker: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F4BC", "man office worker: medium skin tone", "man office worker: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F4BC", "man office worker: medium-dark skin tone", "man office worker: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F4BC", "man office worker: dark skin tone", "man office worker: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U00002708\U0000FE0F", "man pilot: light skin tone", "man pilot: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U00002708\U0000FE0F", "man pilot: medium-light skin tone", "man pilot: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U00002708\U0000FE0F", "man pilot: medium skin tone", "man pilot: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U00002708\U0000FE0F", "man pilot: medium-dark skin tone", "man pilot: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U00002708\U0000FE0F", "man pilot: dark skin tone", "man pilot: dark skin tone"},
+{"\U0001F93E\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man playing handball: light skin tone", "man playing handball: light skin tone"},
+{"\U0001F93E\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man playing handball: medium-light skin tone", "man playing handball: medium-light skin tone"},
+{"\U0001F93E\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man playing handball: medium skin tone", "man playing handball: medium skin tone"},
+{"\U0001F93E\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man playing handball: medium-dark skin tone", "man playing handball: medium-dark skin tone"},
+{"\U0001F93E\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man playing handball: dark skin tone", "man playing handball: dark skin tone"},
+{"\U0001F93D\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man playing water polo: light skin tone", "man playing water polo: light skin tone"},
+{"\U0001F93D\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man playing water polo: medium-light skin tone", "man playing water polo: medium-light skin tone"},
+{"\U0001F93D\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man playing water polo: medium skin tone", "man playing water polo: medium skin tone"},
+{"\U0001F93D\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man playing water polo: medium-dark skin tone", "man playing water polo: medium-dark skin tone"},
+{"\U0001F93D\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man playing water polo: dark skin tone", "man playing water polo: dark skin tone"},
+{"\U0001F46E\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man police officer: light skin tone", "man police officer: light skin tone"},
+{"\U0001F46E\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man police officer: medium-light skin tone", "man police officer: medium-light skin tone"},
+{"\U0001F46E\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man police officer: medium skin tone", "man police officer: medium skin tone"},
+{"\U0001F46E\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man police officer: medium-dark skin tone", "man police officer: medium-dark skin tone"},
+{"\U0001F46E\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man police officer: dark skin tone", "man police officer: dark skin tone"},
+{"\U0001F64E\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man pouting: light skin tone", "man pouting: light skin tone"},
+{"\U0001F64E\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man pouting: medium-light skin tone", "man pouting: medium-light skin tone"},
+{"\U0001F64E\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man pouting: medium skin tone", "man pouting: medium skin tone"},
+{"\U0001F64E\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man pouting: medium-dark skin tone", "man pouting: medium-dark skin tone"},
+{"\U0001F64E\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man pouting: dark skin tone", "man pouting: dark skin tone"},
+{"\U0001F64B\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man raising hand: light skin tone", "man raising hand: light skin tone"},
+{"\U0001F64B\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man raising hand: medium-light skin tone", "man raising hand: medium-light skin tone"},
+{"\U0001F64B\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man raising hand: medium skin tone", "man raising hand: medium skin tone"},
+{"\U0001F64B\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man raising hand: medium-dark skin tone", "man raising hand: medium-dark skin tone"},
+{"\U0001F64B\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man raising hand: dark skin tone", "man raising hand: dark skin tone"},
+{"\U0001F6A3\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man rowing boat: light skin tone", "man rowing boat: light skin tone"},
+{"\U0001F6A3\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man rowing boat: medium-light skin tone", "man rowing boat: medium-light skin tone"},
+{"\U0001F6A3\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man rowing boat: medium skin tone", "man rowing boat: medium skin tone"},
+{"\U0001F6A3\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man rowing boat: medium-dark skin tone", "man rowing boat: medium-dark skin tone"},
+{"\U0001F6A3\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man rowing boat: dark skin tone", "man rowing boat: dark skin tone"},
+{"\U0001F3C3\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man running: light skin tone", "man running: light skin tone"},
+{"\U0001F3C3\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man running: medium-light skin tone", "man running: medium-light skin tone"},
+{"\U0001F3C3\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man running: medium skin tone", "man running: medium skin tone"},
+{"\U0001F3C3\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man running: medium-dark skin tone", "man running: medium-dark skin tone"},
+{"\U0001F3C3\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man running: dark skin tone", "man running: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F52C", "man scientist: light skin tone", "man scientist: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F52C", "man scientist: medium-light skin tone", "man scientist: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F52C", "man scientist: medium skin tone", "man scientist: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F52C", "man scientist: medium-dark skin tone", "man scientist: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F52C", "man scientist: dark skin tone", "man scientist: dark skin tone"},
+{"\U0001F937\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man shrugging: light skin tone", "man shrugging: light skin tone"},
+{"\U0001F937\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man shrugging: medium-light skin tone", "man shrugging: medium-light skin tone"},
+{"\U0001F937\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man shrugging: medium skin tone", "man shrugging: medium skin tone"},
+{"\U0001F937\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man shrugging: medium-dark skin tone", "man shrugging: medium-dark skin tone"},
+{"\U0001F937\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man shrugging: dark skin tone", "man shrugging: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F3A4", "man singer: light skin tone", "man singer: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F3A4", "man singer: medium-light skin tone", "man singer: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F3A4", "man singer: medium skin tone", "man singer: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F3A4", "man singer: medium-dark skin tone", "man singer: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F3A4", "man singer: dark skin tone", "man singer: dark skin tone"},
+{"\U0001F9CD\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man standing: light skin tone", "man standing: light skin tone"},
+{"\U0001F9CD\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man standing: medium-light skin tone", "man standing: medium-light skin tone"},
+{"\U0001F9CD\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man standing: medium skin tone", "man standing: medium skin tone"},
+{"\U0001F9CD\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man standing: medium-dark skin tone", "man standing: medium-dark skin tone"},
+{"\U0001F9CD\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man standing: dark skin tone", "man standing: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F393", "man student: light skin tone", "man student: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F393", "man student: medium-light skin tone", "man student: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F393", "man student: medium skin tone", "man student: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F393", "man student: medium-dark skin tone", "man student: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F393", "man student: dark skin tone", "man student: dark skin tone"},
+{"\U0001F9B8\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man superhero: light skin tone", "man superhero: light skin tone"},
+{"\U0001F9B8\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man superhero: medium-light skin tone", "man superhero: medium-light skin tone"},
+{"\U0001F9B8\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man superhero: medium skin tone", "man superhero: medium skin tone"},
+{"\U0001F9B8\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man superhero: medium-dark skin tone", "man superhero: medium-dark skin tone"},
+{"\U0001F9B8\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man superhero: dark skin tone", "man superhero: dark skin tone"},
+{"\U0001F9B9\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man supervillain: light skin tone", "man supervillain: light skin tone"},
+{"\U0001F9B9\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man supervillain: medium-light skin tone", "man supervillain: medium-light skin tone"},
+{"\U0001F9B9\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man supervillain: medium skin tone", "man supervillain: medium skin tone"},
+{"\U0001F9B9\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man supervillain: medium-dark skin tone", "man supervillain: medium-dark skin tone"},
+{"\U0001F9B9\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man supervillain: dark skin tone", "man supervillain: dark skin tone"},
+{"\U0001F3C4\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man surfing: light skin tone", "man surfing: light skin tone"},
+{"\U0001F3C4\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man surfing: medium-light skin tone", "man surfing: medium-light skin tone"},
+{"\U0001F3C4\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man surfing: medium skin tone", "man surfing: medium skin tone"},
+{"\U0001F3C4\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man surfing: medium-dark skin tone", "man surfing: medium-dark skin tone"},
+{"\U0001F3C4\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man surfing: dark skin tone", "man surfing: dark skin tone"},
+{"\U0001F3CA\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man swimming: light skin tone", "man swimming: light skin tone"},
+{"\U0001F3CA\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man swimming: medium-light skin tone", "man swimming: medium-light skin tone"},
+{"\U0001F3CA\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man swimming: medium skin tone", "man swimming: medium skin tone"},
+{"\U0001F3CA\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man swimming: medium-dark skin tone", "man swimming: medium-dark skin tone"},
+{"\U0001F3CA\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man swimming: dark skin tone", "man swimming: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F3EB", "man teacher: light skin tone", "man teacher: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F3EB", "man teacher: medium-light skin tone", "man teacher: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F3EB", "man teacher: medium skin tone", "man teacher: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F3EB", "man teacher: medium-dark skin tone", "man teacher: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F3EB", "man teacher: dark skin tone", "man teacher: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F4BB", "man technologist: light skin tone", "man technologist: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F4BB", "man technologist: medium-light skin tone", "man technologist: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F4BB", "man technologist: medium skin tone", "man technologist: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F4BB", "man technologist: medium-dark skin tone", "man technologist: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F4BB", "man technologist: dark skin tone", "man technologist: dark skin tone"},
+{"\U0001F481\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man tipping hand: light skin tone", "man tipping hand: light skin tone"},
+{"\U0001F481\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man tipping hand: medium-light skin tone", "man tipping hand: medium-light skin tone"},
+{"\U0001F481\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man tipping hand: medium skin tone", "man tipping hand: medium skin tone"},
+{"\U0001F481\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man tipping hand: medium-dark skin tone", "man tipping hand: medium-dark skin tone"},
+{"\U0001F481\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man tipping hand: dark skin tone", "man tipping hand: dark skin tone"},
+{"\U0001F9DB\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man vampire: light skin tone", "man vampire: light skin tone"},
+{"\U0001F9DB\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man vampire: medium-light skin tone", "man vampire: medium-light skin tone"},
+{"\U0001F9DB\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man vampire: medium skin tone", "man vampire: medium skin tone"},
+{"\U0001F9DB\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man vampire: medium-dark skin tone", "man vampire: medium-dark skin tone"},
+{"\U0001F9DB\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man vampire: dark skin tone", "man vampire: dark skin tone"},
+{"\U0001F6B6\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man walking: light skin tone", "man walking: light skin tone"},
+{"\U0001F6B6\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man walking: medium-light skin tone", "man walking: medium-light skin tone"},
+{"\U0001F6B6\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man walking: medium skin tone", "man walking: medium skin tone"},
+{"\U0001F6B6\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man walking: medium-dark skin tone", "man walking: medium-dark skin tone"},
+{"\U0001F6B6\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man walking: dark skin tone", "man walking: dark skin tone"},
+{"\U0001F473\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man wearing turban: light skin tone", "man wearing turban: light skin tone"},
+{"\U0001F473\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man wearing turban: medium-light skin tone", "man wearing turban: medium-light skin tone"},
+{"\U0001F473\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man wearing turban: medium skin tone", "man wearing turban: medium skin tone"},
+{"\U0001F473\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man wearing turban: medium-dark skin tone", "man wearing turban: medium-dark skin tone"},
+{"\U0001F473\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man wearing turban: dark skin tone", "man wearing turban: dark skin tone"},
+{"\U0001F470\U0001F3FB\U0000200D\U00002642\U0000FE0F", "man with veil: light skin tone", "man with veil: light skin tone"},
+{"\U0001F470\U0001F3FC\U0000200D\U00002642\U0000FE0F", "man with veil: medium-light skin tone", "man with veil: medium-light skin tone"},
+{"\U0001F470\U0001F3FD\U0000200D\U00002642\U0000FE0F", "man with veil: medium skin tone", "man with veil: medium skin tone"},
+{"\U0001F470\U0001F3FE\U0000200D\U00002642\U0000FE0F", "man with veil: medium-dark skin tone", "man with veil: medium-dark skin tone"},
+{"\U0001F470\U0001F3FF\U0000200D\U00002642\U0000FE0F", "man with veil: dark skin tone", "man with veil: dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F9AF", "man with white cane: light skin tone", "man with white cane: light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F9AF", "man with white cane: medium-light skin tone", "man with white cane: medium-light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F9AF", "man with white cane: medium skin tone", "man with white cane: medium skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F9AF", "man with white cane: medium-dark skin tone", "man with white cane: medium-dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F9AF", "man with white cane: dark skin tone", "man with white cane: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F527", "mechanic: light skin tone", "mechanic: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F527", "mechanic: medium-light skin tone", "mechanic: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F527", "mechanic: medium skin tone", "mechanic: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F527", "mechanic: medium-dark skin tone", "mechanic: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F527", "mechanic: dark skin tone", "mechanic: dark skin tone"},
+{"\U0001F3FD", "tone3", "medium skin tone"},
+{"\U0001F3FE", "tone4", "medium-dark skin tone"},
+{"\U0001F3FC", "tone2", "medium-light skin tone"},
+{"\U0001F46C\U0001F3FB", "men holding hands: light skin tone", "men holding hands: light skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC", "men holding hands: light skin tone, medium-light skin tone", "men holding hands: light skin tone, medium-light skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD", "men holding hands: light skin tone, medium skin tone", "men holding hands: light skin tone, medium skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE", "men holding hands: light skin tone, medium-dark skin tone", "men holding hands: light skin tone, medium-dark skin tone"},
+{"\U0001F468\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF", "men holding hands: light skin tone, dark skin tone", "men holding hands: light skin tone, dark skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB", "men holding hands: medium-light skin tone, light skin tone", "men holding hands: medium-light skin tone, light skin tone"},
+{"\U0001F46C\U0001F3FC", "men holding hands: medium-light skin tone", "men holding hands: medium-light skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD", "men holding hands: medium-light skin tone, medium skin tone", "men holding hands: medium-light skin tone, medium skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE", "men holding hands: medium-light skin tone, medium-dark skin tone", "men holding hands: medium-light skin tone, medium-dark skin tone"},
+{"\U0001F468\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF", "men holding hands: medium-light skin tone, dark skin tone", "men holding hands: medium-light skin tone, dark skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB", "men holding hands: medium skin tone, light skin tone", "men holding hands: medium skin tone, light skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC", "men holding hands: medium skin tone, medium-light skin tone", "men holding hands: medium skin tone, medium-light skin tone"},
+{"\U0001F46C\U0001F3FD", "men holding hands: medium skin tone", "men holding hands: medium skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE", "men holding hands: medium skin tone, medium-dark skin tone", "men holding hands: medium skin tone, medium-dark skin tone"},
+{"\U0001F468\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF", "men holding hands: medium skin tone, dark skin tone", "men holding hands: medium skin tone, dark skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB", "men holding hands: medium-dark skin tone, light skin tone", "men holding hands: medium-dark skin tone, light skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC", "men holding hands: medium-dark skin tone, medium-light skin tone", "men holding hands: medium-dark skin tone, medium-light skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD", "men holding hands: medium-dark skin tone, medium skin tone", "men holding hands: medium-dark skin tone, medium skin tone"},
+{"\U0001F46C\U0001F3FE", "men holding hands: medium-dark skin tone", "men holding hands: medium-dark skin tone"},
+{"\U0001F468\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF", "men holding hands: medium-dark skin tone, dark skin tone", "men holding hands: medium-dark skin tone, dark skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB", "men holding hands: dark skin tone, light skin tone", "men holding hands: dark skin tone, light skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC", "men holding hands: dark skin tone, medium-light skin tone", "men holding hands: dark skin tone, medium-light skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD", "men holding hands: dark skin tone, medium skin tone", "men holding hands: dark skin tone, medium skin tone"},
+{"\U0001F468\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE", "men holding hands: dark skin tone, medium-dark skin tone", "men holding hands: dark skin tone, medium-dark skin tone"},
+{"\U0001F46C\U0001F3FF", "men holding hands: dark skin tone", "men holding hands: dark skin tone"},
+{"\U0001F9DC\U0001F3FB\U0000200D\U00002640\U0000FE0F", "mermaid: light skin tone", "mermaid: light skin tone"},
+{"\U0001F9DC\U0001F3FC\U0000200D\U00002640\U0000FE0F", "mermaid: medium-light skin tone", "mermaid: medium-light skin tone"},
+{"\U0001F9DC\U0001F3FD\U0000200D\U00002640\U0000FE0F", "mermaid: medium skin tone", "mermaid: medium skin tone"},
+{"\U0001F9DC\U0001F3FE\U0000200D\U00002640\U0000FE0F", "mermaid: medium-dark skin tone", "mermaid: medium-dark skin tone"},
+{"\U0001F9DC\U0001F3FF\U0000200D\U00002640\U0000FE0F", "mermaid: dark skin tone", "mermaid: dark skin tone"},
+{"\U0001F9DC\U0001F3FB\U0000200D\U00002642\U0000FE0F", "merman: light skin tone", "merman: light skin tone"},
+{"\U0001F9DC\U0001F3FC\U0000200D\U00002642\U0000FE0F", "merman: medium-light skin tone", "merman: medium-light skin tone"},
+{"\U0001F9DC\U0001F3FD\U0000200D\U00002642\U0000FE0F", "merman: medium skin tone", "merman: medium skin tone"},
+{"\U0001F9DC\U0001F3FE\U0000200D\U00002642\U0000FE0F", "merman: medium-dark skin tone", "merman: medium-dark skin tone"},
+{"\U0001F9DC\U0001F3FF\U0000200D\U00002642\U0000FE0F", "merman: dark skin tone", "merman: dark skin tone"},
+{"\U0001F9DC\U0001F3FB", "merperson_tone1", "merperson: light skin tone"},
+{"\U0001F9DC\U0001F3FC", "merperson_tone2", "merperson: medium-light skin tone"},
+{"\U0001F9DC\U0001F3FD", "merperson_tone3", "merperson: medium skin tone"},
+{"\U0001F9DC\U0001F3FE", "merperson_tone4", "merperson: medium-dark skin tone"},
+{"\U0001F9DC\U0001F3FF", "merperson_tone5", "merperson: dark skin tone"},
+{"\U0001F595\U0001F3FB", "middle_finger_tone1", "middle finger: light skin tone"},
+{"\U0001F595\U0001F3FC", "middle_finger_tone2", "middle finger: medium-light skin tone"},
+{"\U0001F595\U0001F3FD", "middle_finger_tone3", "middle finger: medium skin tone"},
+{"\U0001F595\U0001F3FE", "middle_finger_tone4", "middle finger: medium-dark skin tone"},
+{"\U0001F595\U0001F3FF", "middle_finger_tone5", "middle finger: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F384", "mx claus: light skin tone", "mx claus: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F384", "mx claus: medium-light skin tone", "mx claus: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F384", "mx claus: medium skin tone", "mx claus: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F384", "mx claus: medium-dark skin tone", "mx claus: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F384", "mx claus: dark skin tone", "mx claus: dark skin tone"},
+{"\U0001F485\U0001F3FB", "nail_care_tone1", "nail polish: light skin tone"},
+{"\U0001F485\U0001F3FC", "nail_care_tone2", "nail polish: medium-light skin tone"},
+{"\U0001F485\U0001F3FD", "nail_care_tone3", "nail polish: medium skin tone"},
+{"\U0001F485\U0001F3FE", "nail_care_tone4", "nail polish: medium-dark skin tone"},
+{"\U0001F485\U0001F3FF", "nail_care_tone5", "nail polish: dark skin tone"},
+{"\U0001F977\U0001F3FB", "ninja: light skin tone", "ninja: light skin tone"},
+{"\U0001F977\U0001F3FC", "ninja: medium-light skin tone", "ninja: medium-light skin tone"},
+{"\U0001F977\U0001F3FD", "ninja: medium skin tone", "ninja: medium skin tone"},
+{"\U0001F977\U0001F3FE", "ninja: medium-dark skin tone", "ninja: medium-dark skin tone"},
+{"\U0001F977\U0001F3FF", "ninja: dark skin tone", "ninja: dark skin tone"},
+{"\U0001F443\U0001F3FB", "nose_tone1", "nose: light skin tone"},
+{"\U0001F443\U0001F3FC", "nose_tone2", "nose: medium-light skin tone"},
+{"\U0001F443\U0001F3FD", "nose_tone3", "nose: medium skin tone"},
+{"\U0001F443\U0001F3FE", "nose_tone4", "nose: medium-dark skin tone"},
+{"\U0001F443\U0001F3FF", "nose_tone5", "nose: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F4BC", "office worker: light skin tone", "office worker: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F4BC", "office worker: medium-light skin tone", "office worker: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F4BC", "office worker: medium skin tone", "office worker: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F4BC", "office worker: medium-dark skin tone", "office worker: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F4BC", "office worker: dark skin tone", "office worker: dark skin tone"},
+{"\U0001F474\U0001F3FB", "older_man_tone1", "old man: light skin tone"},
+{"\U0001F474\U0001F3FC", "older_man_tone2", "old man: medium-light skin tone"},
+{"\U0001F474\U0001F3FD", "older_man_tone3", "old man: medium skin tone"},
+{"\U0001F474\U0001F3FE", "older_man_tone4", "old man: medium-dark skin tone"},
+{"\U0001F474\U0001F3FF", "older_man_tone5", "old man: dark skin tone"},
+{"\U0001F475\U0001F3FB", "older_woman_tone1", "old woman: light skin tone"},
+{"\U0001F475\U0001F3FC", "older_woman_tone2", "old woman: medium-light skin tone"},
+{"\U0001F475\U0001F3FD", "older_woman_tone3", "old woman: medium skin tone"},
+{"\U0001F475\U0001F3FE", "older_woman_tone4", "old woman: medium-dark skin tone"},
+{"\U0001F475\U0001F3FF", "older_woman_tone5", "old woman: dark skin tone"},
+{"\U0001F9D3\U0001F3FB", "older_adult_tone1", "older person: light skin tone"},
+{"\U0001F9D3\U0001F3FC", "older_adult_tone2", "older person: medium-light skin tone"},
+{"\U0001F9D3\U0001F3FD", "older_adult_tone3", "older person: medium skin tone"},
+{"\U0001F9D3\U0001F3FE", "older_adult_tone4", "older person: medium-dark skin tone"},
+{"\U0001F9D3\U0001F3FF", "older_adult_tone5", "older person: dark skin tone"},
+{"\U0001F44A\U0001F3FB", "punch_tone1", "oncoming fist: light skin tone"},
+{"\U0001F44A\U0001F3FC", "punch_tone2", "oncoming fist: medium-light skin tone"},
+{"\U0001F44A\U0001F3FD", "punch_tone3", "oncoming fist: medium skin tone"},
+{"\U0001F44A\U0001F3FE", "punch_tone4", "oncoming fist: medium-dark skin tone"},
+{"\U0001F44A\U0001F3FF", "punch_tone5", "oncoming fist: dark skin tone"},
+{"\U0001F450\U0001F3FB", "open_hands_tone1", "open hands: light skin tone"},
+{"\U0001F450\U0001F3FC", "open_hands_tone2", "open hands: medium-light skin tone"},
+{"\U0001F450\U0001F3FD", "open_hands_tone3", "open hands: medium skin tone"},
+{"\U0001F450\U0001F3FE", "open_hands_tone4", "open hands: medium-dark skin tone"},
+{"\U0001F450\U0001F3FF", "open_hands_tone5", "open hands: dark skin tone"},
+{"\U0001FAF3\U0001F3FB", "palm down hand: light skin tone", "palm down hand: light skin tone"},
+{"\U0001FAF3\U0001F3FC", "palm down hand: medium-light skin tone", "palm down hand: medium-light skin tone"},
+{"\U0001FAF3\U0001F3FD", "palm down hand: medium skin tone", "palm down hand: medium skin tone"},
+{"\U0001FAF3\U0001F3FE", "palm down hand: medium-dark skin tone", "palm down hand: medium-dark skin tone"},
+{"\U0001FAF3\U0001F3FF", "palm down hand: dark skin tone", "palm down hand: dark skin tone"},
+{"\U0001FAF4\U0001F3FB", "palm up hand: light skin tone", "palm up hand: light skin tone"},
+{"\U0001FAF4\U0001F3FC", "palm up hand: medium-light skin tone", "palm up hand: medium-light skin tone"},
+{"\U0001FAF4\U0001F3FD", "palm up hand: medium skin tone", "palm up hand: medium skin tone"},
+{"\U0001FAF4\U0001F3FE", "palm up hand: medium-dark skin tone", "palm up hand: medium-dark skin tone"},
+{"\U0001FAF4\U0001F3FF", "palm up hand: dark skin tone", "palm up hand: dark skin tone"},
+{"\U0001F932\U0001F3FB", "palms_up_together_tone1", "palms up together: light skin tone"},
+{"\U0001F932\U0001F3FC", "palms_up_together_tone2", "palms up together: medium-light skin tone"},
+{"\U0001F932\U0001F3FD", "palms_up_together_tone3", "palms up together: medium skin tone"},
+{"\U0001F932\U0001F3FE", "palms_up_together_tone4", "palms up together: medium-dark skin tone"},
+{"\U0001F932\U0001F3FF", "palms_up_together_tone5", "palms up together: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB", "people holding hands: light skin tone", "people holding hands: light skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC", "people holding hands: light skin tone, medium-light skin tone", "people holding hands: light skin tone, medium-light skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD", "people holding hands: light skin tone, medium skin tone", "people holding hands: light skin tone, medium skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE", "people holding hands: light skin tone, medium-dark skin tone", "people holding hands: light skin tone, medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF", "people holding hands: light skin tone, dark skin tone", "people holding hands: light skin tone, dark skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB", "people holding hands: medium-light skin tone, light skin tone", "people holding hands: medium-light skin tone, light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC", "people holding hands: medium-light skin tone", "people holding hands: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD", "people holding hands: medium-light skin tone, medium skin tone", "people holding hands: medium-light skin tone, medium skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE", "people holding hands: medium-light skin tone, medium-dark skin tone", "people holding hands: medium-light skin tone, medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF", "people holding hands: medium-light skin tone, dark skin tone", "people holding hands: medium-light skin tone, dark skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB", "people holding hands: medium skin tone, light skin tone", "people holding hands: medium skin tone, light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC", "people holding hands: medium skin tone, medium-light skin tone", "people holding hands: medium skin tone, medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD", "people holding hands: medium skin tone", "people holding hands: medium skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE", "people holding hands: medium skin tone, medium-dark skin tone", "people holding hands: medium skin tone, medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF", "people holding hands: medium skin tone, dark skin tone", "people holding hands: medium skin tone, dark skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB", "people holding hands: medium-dark skin tone, light skin tone", "people holding hands: medium-dark skin tone, light skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC", "people holding hands: medium-dark skin tone, medium-light skin tone", "people holding hands: medium-dark skin tone, medium-light skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD", "people holding hands: medium-dark skin tone, medium skin tone", "people holding hands: medium-dark skin tone, medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE", "people holding hands: medium-dark skin tone", "people holding hands: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF", "people holding hands: medium-dark skin tone, dark skin tone", "people holding hands: medium-dark skin tone, dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FB", "people holding hands: dark skin tone, light skin tone", "people holding hands: dark skin tone, light skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FC", "people holding hands: dark skin tone, medium-light skin tone", "people holding hands: dark skin tone, medium-light skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FD", "people holding hands: dark skin tone, medium skin tone", "people holding hands: dark skin tone, medium skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FE", "people holding hands: dark skin tone, medium-dark skin tone", "people holding hands: dark skin tone, medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F9D1\U0001F3FF", "people holding hands: dark skin tone", "people holding hands: dark skin tone"},
+{"\U0001F9D1\U0001F3FB", "adult_tone1", "person: light skin tone"},
+{"\U0001F9D1\U0001F3FC", "adult_tone2", "person: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD", "adult_tone3", "person: medium skin tone"},
+{"\U0001F9D1\U0001F3FE", "adult_tone4", "person: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF", "adult_tone5", "person: dark skin tone"},
+{"\U0001F471\U0001F3FB", "person_with_blond_hair_tone1", "person: light skin tone, blond hair"},
+{"\U0001F471\U0001F3FC", "person_with_blond_hair_tone2", "person: medium-light skin tone, blond hair"},
+{"\U0001F471\U0001F3FD", "person_with_blond_hair_tone3", "person: medium skin tone, blond hair"},
+{"\U0001F471\U0001F3FE", "person_with_blond_hair_tone4", "person: medium-dark skin tone, blond hair"},
+{"\U0001F471\U0001F3FF", "person_with_blond_hair_tone5", "person: dark skin tone, blond hair"},
+{"\U0001F9D4\U0001F3FB", "bearded_person_tone1", "person: light skin tone, beard"},
+{"\U0001F9D4\U0001F3FC", "bearded_person_tone2", "person: medium-light skin tone, beard"},
+{"\U0001F9D4\U0001F3FD", "bearded_person_tone3", "person: medium skin tone, beard"},
+{"\U0001F9D4\U0001F3FE", "bearded_person_tone4", "person: medium-dark skin tone, beard"},
+{"\U0001F9D4\U0001F3FF", "bearded_person_tone5", "person: dark skin tone, beard"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F9B0", "person: light skin tone, red hair", "person: light skin tone, red hair"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F9B0", "person: medium-light skin tone, red hair", "person: medium-light skin tone, red hair"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F9B0", "person: medium skin tone, red hair", "person: medium skin tone, red hair"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F9B0", "person: medium-dark skin tone, red hair", "person: medium-dark skin tone, red hair"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F9B0", "person: dark skin tone, red hair", "person: dark skin tone, red hair"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F9B1", "person: light skin tone, curly hair", "person: light skin tone, curly hair"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F9B1", "person: medium-light skin tone, curly hair", "person: medium-light skin tone, curly hair"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F9B1", "person: medium skin tone, curly hair", "person: medium skin tone, curly hair"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F9B1", "person: medium-dark skin tone, curly hair", "person: medium-dark skin tone, curly hair"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F9B1", "person: dark skin tone, curly hair", "person: dark skin tone, curly hair"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F9B3", "person: light skin tone, white hair", "person: light skin tone, white hair"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F9B3", "person: medium-light skin tone, white hair", "person: medium-light skin tone, white hair"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F9B3", "person: medium skin tone, white hair", "person: medium skin tone, white hair"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F9B3", "person: medium-dark skin tone, white hair", "person: medium-dark skin tone, white hair"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F9B3", "person: dark skin tone, white hair", "person: dark skin tone, white hair"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F9B2", "person: light skin tone, bald", "person: light skin tone, bald"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F9B2", "person: medium-light skin tone, bald", "person: medium-light skin tone, bald"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F9B2", "person: medium skin tone, bald", "person: medium skin tone, bald"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F9B2", "person: medium-dark skin tone, bald", "person: medium-dark skin tone, bald"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F9B2", "person: dark skin tone, bald", "person: dark skin tone, bald"},
+{"\U0001F6B4\U0001F3FB", "bicyclist_tone1", "person biking: light skin tone"},
+{"\U0001F6B4\U0001F3FC", "bicyclist_tone2", "person biking: medium-light skin tone"},
+{"\U0001F6B4\U0001F3FD", "bicyclist_tone3", "person biking: medium skin tone"},
+{"\U0001F6B4\U0001F3FE", "bicyclist_tone4", "person biking: medium-dark skin tone"},
+{"\U0001F6B4\U0001F3FF", "bicyclist_tone5", "person biking: dark skin tone"},
+{"\U000026F9\U0001F3FB", "basketball_player_tone1", "person bouncing ball: light skin tone"},
+{"\U000026F9\U0001F3FC", "basketball_player_tone2", "person bouncing ball: medium-light skin tone"},
+{"\U000026F9\U0001F3FD", "basketball_player_tone3", "person bouncing ball: medium skin tone"},
+{"\U000026F9\U0001F3FE", "basketball_player_tone4", "person bouncing ball: medium-dark skin tone"},
+{"\U000026F9\U0001F3FF", "basketball_player_tone5", "person bouncing ball: dark skin tone"},
+{"\U0001F647\U0001F3FB", "bow_tone1", "person bowing: light skin tone"},
+{"\U0001F647\U0001F3FC", "bow_tone2", "person bowing: medium-light skin tone"},
+{"\U0001F647\U0001F3FD", "bow_tone3", "person bowing: medium skin tone"},
+{"\U0001F647\U0001F3FE", "bow_tone4", "person bowing: medium-dark skin tone"},
+{"\U0001F647\U0001F3FF", "bow_tone5", "person bowing: dark skin tone"},
+{"\U0001F938\U0001F3FB", "cartwheel_tone1", "person cartwheeling: light skin tone"},
+{"\U0001F938\U0001F3FC", "cartwheel_tone2", "person cartwheeling: medium-light skin tone"},
+{"\U0001F938\U0001F3FD", "cartwheel_tone3", "person cartwheeling: medium skin tone"},
+{"\U0001F938\U0001F3FE", "cartwheel_tone4", "person cartwheeling: medium-dark skin tone"},
+{"\U0001F938\U0001F3FF", "cartwheel_tone5", "person cartwheeling: dark skin tone"},
+{"\U0001F9D7\U0001F3FB", "person_climbing_tone1", "person climbing: light skin tone"},
+{"\U0001F9D7\U0001F3FC", "person_climbing_tone2", "person climbing: medium-light skin tone"},
+{"\U0001F9D7\U0001F3FD", "person_climbing_tone3", "person climbing: medium skin tone"},
+{"\U0001F9D7\U0001F3FE", "person_climbing_tone4", "person climbing: medium-dark skin tone"},
+{"\U0001F9D7\U0001F3FF", "person_climbing_tone5", "person climbing: dark skin tone"},
+{"\U0001F926\U0001F3FB", "face_palm_tone1", "person facepalming: light skin tone"},
+{"\U0001F926\U0001F3FC", "face_palm_tone2", "person facepalming: medium-light skin tone"},
+{"\U0001F926\U0001F3FD", "face_palm_tone3", "person facepalming: medium skin tone"},
+{"\U0001F926\U0001F3FE", "face_palm_tone4", "person facepalming: medium-dark skin tone"},
+{"\U0001F926\U0001F3FF", "face_palm_tone5", "person facepalming: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F37C", "person feeding baby: light skin tone", "person feeding baby: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F37C", "person feeding baby: medium-light skin tone", "person feeding baby: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F37C", "person feeding baby: medium skin tone", "person feeding baby: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F37C", "person feeding baby: medium-dark skin tone", "person feeding baby: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F37C", "person feeding baby: dark skin tone", "person feeding baby: dark skin tone"},
+{"\U0001F64D\U0001F3FB", "person_frowning_tone1", "person frowning: light skin tone"},
+{"\U0001F64D\U0001F3FC", "person_frowning_tone2", "person frowning: medium-light skin tone"},
+{"\U0001F64D\U0001F3FD", "person_frowning_tone3", "person frowning: medium skin tone"},
+{"\U0001F64D\U0001F3FE", "person_frowning_tone4", "person frowning: medium-dark skin tone"},
+{"\U0001F64D\U0001F3FF", "person_frowning_tone5", "person frowning: dark skin tone"},
+{"\U0001F645\U0001F3FB", "no_good_tone1", "person gesturing NO: light skin tone"},
+{"\U0001F645\U0001F3FC", "no_good_tone2", "person gesturing NO: medium-light skin tone"},
+{"\U0001F645\U0001F3FD", "no_good_tone3", "person gesturing NO: medium skin tone"},
+{"\U0001F645\U0001F3FE", "no_good_tone4", "person gesturing NO: medium-dark skin tone"},
+{"\U0001F645\U0001F3FF", "no_good_tone5", "person gesturing NO: dark skin tone"},
+{"\U0001F646\U0001F3FB", "ok_woman_tone1", "person gesturing OK: light skin tone"},
+{"\U0001F646\U0001F3FC", "ok_woman_tone2", "person gesturing OK: medium-light skin tone"},
+{"\U0001F646\U0001F3FD", "ok_woman_tone3", "person gesturing OK: medium skin tone"},
+{"\U0001F646\U0001F3FE", "ok_woman_tone4", "person gesturing OK: medium-dark skin tone"},
+{"\U0001F646\U0001F3FF", "ok_woman_tone5", "person gesturing OK: dark skin tone"},
+{"\U0001F487\U0001F3FB", "haircut_tone1", "person getting haircut: light skin tone"},
+{"\U0001F487\U0001F3FC", "haircut_tone2", "person getting haircut: medium-light skin tone"},
+{"\U0001F487\U0001F3FD", "haircut_tone3", "person getting haircut: medium skin tone"},
+{"\U0001F487\U0001F3FE", "haircut_tone4", "person getting haircut: medium-dark skin tone"},
+{"\U0001F487\U0001F3FF", "haircut_tone5", "person getting haircut: dark skin tone"},
+{"\U0001F486\U0001F3FB", "massage_tone1", "person getting massage: light skin tone"},
+{"\U0001F486\U0001F3FC", "massage_tone2", "person getting massage: medium-light skin tone"},
+{"\U0001F486\U0001F3FD", "massage_tone3", "person getting massage: medium skin tone"},
+{"\U0001F486\U0001F3FE", "massage_tone4", "person getting massage: medium-dark skin tone"},
+{"\U0001F486\U0001F3FF", "massage_tone5", "person getting massage: dark skin tone"},
+{"\U0001F3CC\U0001F3FB", "person_golfing_tone1", "person golfing: light skin tone"},
+{"\U0001F3CC\U0001F3FC", "person_golfing_tone2", "person golfing: medium-light skin tone"},
+{"\U0001F3CC\U0001F3FD", "person_golfing_tone3", "person golfing: medium skin tone"},
+{"\U0001F3CC\U0001F3FE", "person_golfing_tone4", "person golfing: medium-dark skin tone"},
+{"\U0001F3CC\U0001F3FF", "person_golfing_tone5", "person golfing: dark skin tone"},
+{"\U0001F6CC\U0001F3FB", "person_in_bed_tone1", "person in bed: light skin tone"},
+{"\U0001F6CC\U0001F3FC", "person_in_bed_tone2", "person in bed: medium-light skin tone"},
+{"\U0001F6CC\U0001F3FD", "person_in_bed_tone3", "person in bed: medium skin tone"},
+{"\U0001F6CC\U0001F3FE", "person_in_bed_tone4", "person in bed: medium-dark skin tone"},
+{"\U0001F6CC\U0001F3FF", "person_in_bed_tone5", "person in bed: dark skin tone"},
+{"\U0001F9D8\U0001F3FB", "person_in_lotus_position_tone1", "person in lotus position: light skin tone"},
+{"\U0001F9D8\U0001F3FC", "person_in_lotus_position_tone2", "person in lotus position: medium-light skin tone"},
+{"\U0001F9D8\U0001F3FD", "person_in_lotus_position_tone3", "person in lotus position: medium skin tone"},
+{"\U0001F9D8\U0001F3FE", "person_in_lotus_position_tone4", "person in lotus position: medium-dark skin tone"},
+{"\U0001F9D8\U0001F3FF", "person_in_lotus_position_tone5", "person in lotus position: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F9BD", "person in manual wheelchair: light skin tone", "person in manual wheelchair: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F9BD", "person in manual wheelchair: medium-light skin tone", "person in manual wheelchair: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F9BD", "person in manual wheelchair: medium skin tone", "person in manual wheelchair: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F9BD", "person in manual wheelchair: medium-dark skin tone", "person in manual wheelchair: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F9BD", "person in manual wheelchair: dark skin tone", "person in manual wheelchair: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F9BC", "person in motorized wheelchair: light skin tone", "person in motorized wheelchair: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F9BC", "person in motorized wheelchair: medium-light skin tone", "person in motorized wheelchair: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F9BC", "person in motorized wheelchair: medium skin tone", "person in motorized wheelchair: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F9BC", "person in motorized wheelchair: medium-dark skin tone", "person in motorized wheelchair: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F9BC", "person in motorized wheelchair: dark skin tone", "person in motorized wheelchair: dark skin tone"},
+{"\U0001F9D6\U0001F3FB", "person_in_steamy_room_tone1", "person in steamy room: light skin tone"},
+{"\U0001F9D6\U0001F3FC", "person_in_steamy_room_tone2", "person in steamy room: medium-light skin tone"},
+{"\U0001F9D6\U0001F3FD", "person_in_steamy_room_tone3", "person in steamy room: medium skin tone"},
+{"\U0001F9D6\U0001F3FE", "person_in_steamy_room_tone4", "person in steamy room: medium-dark skin tone"},
+{"\U0001F9D6\U0001F3FF", "person_in_steamy_room_tone5", "person in steamy room: dark skin tone"},
+{"\U0001F574\U0001F3FB", "levitate_tone1", "person in suit levitating: light skin tone"},
+{"\U0001F574\U0001F3FC", "levitate_tone2", "person in suit levitating: medium-light skin tone"},
+{"\U0001F574\U0001F3FD", "levitate_tone3", "person in suit levitating: medium skin tone"},
+{"\U0001F574\U0001F3FE", "levitate_tone4", "person in suit levitating: medium-dark skin tone"},
+{"\U0001F574\U0001F3FF", "levitate_tone5", "person in suit levitating: dark skin tone"},
+{"\U0001F935\U0001F3FB", "man_in_tuxedo_tone1", "person in tuxedo: light skin tone"},
+{"\U0001F935\U0001F3FC", "man_in_tuxedo_tone2", "person in tuxedo: medium-light skin tone"},
+{"\U0001F935\U0001F3FD", "man_in_tuxedo_tone3", "person in tuxedo: medium skin tone"},
+{"\U0001F935\U0001F3FE", "man_in_tuxedo_tone4", "person in tuxedo: medium-dark skin tone"},
+{"\U0001F935\U0001F3FF", "man_in_tuxedo_tone5", "person in tuxedo: dark skin tone"},
+{"\U0001F939\U0001F3FB", "juggling_tone1", "person juggling: light skin tone"},
+{"\U0001F939\U0001F3FC", "juggling_tone2", "person juggling: medium-light skin tone"},
+{"\U0001F939\U0001F3FD", "juggling_tone3", "person juggling: medium skin tone"},
+{"\U0001F939\U0001F3FE", "juggling_tone4", "person juggling: medium-dark skin tone"},
+{"\U0001F939\U0001F3FF", "juggling_tone5", "person juggling: dark skin tone"},
+{"\U0001F9CE\U0001F3FB", "person kneeling: light skin tone", "person kneeling: light skin tone"},
+{"\U0001F9CE\U0001F3FC", "person kneeling: medium-light skin tone", "person kneeling: medium-light skin tone"},
+{"\U0001F9CE\U0001F3FD", "person kneeling: medium skin tone", "person kneeling: medium skin tone"},
+{"\U0001F9CE\U0001F3FE", "person kneeling: medium-dark skin tone", "person kneeling: medium-dark skin tone"},
+{"\U0001F9CE\U0001F3FF", "person kneeling: dark skin tone", "person kneeling: dark skin tone"},
+{"\U0001F3CB\U0001F3FB", "lifter_tone1", "person lifting weights: light skin tone"},
+{"\U0001F3CB\U0001F3FC", "lifter_tone2", "person lifting weights: medium-light skin tone"},
+{"\U0001F3CB\U0001F3FD", "lifter_tone3", "person lifting weights: medium skin tone"},
+{"\U0001F3CB\U0001F3FE", "lifter_tone4", "person lifting weights: medium-dark skin tone"},
+{"\U0001F3CB\U0001F3FF", "lifter_tone5", "person lifting weights: dark skin tone"},
+{"\U0001F6B5\U0001F3FB", "mountain_bicyclist_tone1", "person mountain biking: light skin tone"},
+{"\U0001F6B5\U0001F3FC", "mountain_bicyclist_tone2", "person mountain biking: medium-light skin tone"},
+{"\U0001F6B5\U0001F3FD", "mountain_bicyclist_tone3", "person mountain biking: medium skin tone"},
+{"\U0001F6B5\U0001F3FE", "mountain_bicyclist_tone4", "person mountain biking: medium-dark skin tone"},
+{"\U0001F6B5\U0001F3FF", "mountain_bicyclist_tone5", "person mountain biking: dark skin tone"},
+{"\U0001F93E\U0001F3FB", "handball_tone1", "person playing handball: light skin tone"},
+{"\U0001F93E\U0001F3FC", "handball_tone2", "person playing handball: medium-light skin tone"},
+{"\U0001F93E\U0001F3FD", "handball_tone3", "person playing handball: medium skin tone"},
+{"\U0001F93E\U0001F3FE", "handball_tone4", "person playing handball: medium-dark skin tone"},
+{"\U0001F93E\U0001F3FF", "handball_tone5", "person playing handball: dark skin tone"},
+{"\U0001F93D\U0001F3FB", "water_polo_tone1", "person playing water polo: light skin tone"},
+{"\U0001F93D\U0001F3FC", "water_polo_tone2", "person playing water polo: medium-light skin tone"},
+{"\U0001F93D\U0001F3FD", "water_polo_tone3", "person playing water polo: medium skin tone"},
+{"\U0001F93D\U0001F3FE", "water_polo_tone4", "person playing water polo: medium-dark skin tone"},
+{"\U0001F93D\U0001F3FF", "water_polo_tone5", "person playing water polo: dark skin tone"},
+{"\U0001F64E\U0001F3FB", "person_with_pouting_face_tone1", "person pouting: light skin tone"},
+{"\U0001F64E\U0001F3FC", "person_with_pouting_face_tone2", "person pouting: medium-light skin tone"},
+{"\U0001F64E\U0001F3FD", "person_with_pouting_face_tone3", "person pouting: medium skin tone"},
+{"\U0001F64E\U0001F3FE", "person_with_pouting_face_tone4", "person pouting: medium-dark skin tone"},
+{"\U0001F64E\U0001F3FF", "person_with_pouting_face_tone5", "person pouting: dark skin tone"},
+{"\U0001F64B\U0001F3FB", "raising_hand_tone1", "person raising hand: light skin tone"},
+{"\U0001F64B\U0001F3FC", "raising_hand_tone2", "person raising hand: medium-light skin tone"},
+{"\U0001F64B\U0001F3FD", "raising_hand_tone3", "person raising hand: medium skin tone"},
+{"\U0001F64B\U0001F3FE", "raising_hand_tone4", "person raising hand: medium-dark skin tone"},
+{"\U0001F64B\U0001F3FF", "raising_hand_tone5", "person raising hand: dark skin tone"},
+{"\U0001F6A3\U0001F3FB", "rowboat_tone1", "person rowing boat: light skin tone"},
+{"\U0001F6A3\U0001F3FC", "rowboat_tone2", "person rowing boat: medium-light skin tone"},
+{"\U0001F6A3\U0001F3FD", "rowboat_tone3", "person rowing boat: medium skin tone"},
+{"\U0001F6A3\U0001F3FE", "rowboat_tone4", "person rowing boat: medium-dark skin tone"},
+{"\U0001F6A3\U0001F3FF", "rowboat_tone5", "person rowing boat: dark skin tone"},
+{"\U0001F3C3\U0001F3FB", "runner_tone1", "person running: light skin tone"},
+{"\U0001F3C3\U0001F3FC", "runner_tone2", "person running: medium-light skin tone"},
+{"\U0001F3C3\U0001F3FD", "runner_tone3", "person running: medium skin tone"},
+{"\U0001F3C3\U0001F3FE", "runner_tone4", "person running: medium-dark skin tone"},
+{"\U0001F3C3\U0001F3FF", "runner_tone5", "person running: dark skin tone"},
+{"\U0001F937\U0001F3FB", "shrug_tone1", "person shrugging: light skin tone"},
+{"\U0001F937\U0001F3FC", "shrug_tone2", "person shrugging: medium-light skin tone"},
+{"\U0001F937\U0001F3FD", "shrug_tone3", "person shrugging: medium skin tone"},
+{"\U0001F937\U0001F3FE", "shrug_tone4", "person shrugging: medium-dark skin tone"},
+{"\U0001F937\U0001F3FF", "shrug_tone5", "person shrugging: dark skin tone"},
+{"\U0001F9CD\U0001F3FB", "person standing: light skin tone", "person standing: light skin tone"},
+{"\U0001F9CD\U0001F3FC", "person standing: medium-light skin tone", "person standing: medium-light skin tone"},
+{"\U0001F9CD\U0001F3FD", "person standing: medium skin tone", "person standing: medium skin tone"},
+{"\U0001F9CD\U0001F3FE", "person standing: medium-dark skin tone", "person standing: medium-dark skin tone"},
+{"\U0001F9CD\U0001F3FF", "person standing: dark skin tone", "person standing: dark skin tone"},
+{"\U0001F3C4\U0001F3FB", "surfer_tone1", "person surfing: light skin tone"},
+{"\U0001F3C4\U0001F3FC", "surfer_tone2", "person surfing: medium-light skin tone"},
+{"\U0001F3C4\U0001F3FD", "surfer_tone3", "person surfing: medium skin tone"},
+{"\U0001F3C4\U0001F3FE", "surfer_tone4", "person surfing: medium-dark skin tone"},
+{"\U0001F3C4\U0001F3FF", "surfer_tone5", "person surfing: dark skin tone"},
+{"\U0001F3CA\U0001F3FB", "swimmer_tone1", "person swimming: light skin tone"},
+{"\U0001F3CA\U0001F3FC", "swimmer_tone2", "person swimming: medium-light skin tone"},
+{"\U0001F3CA\U0001F3FD", "swimmer_tone3", "person swimming: medium skin tone"},
+{"\U0001F3CA\U0001F3FE", "swimmer_tone4", "person swimming: medium-dark skin tone"},
+{"\U0001F3CA\U0001F3FF", "swimmer_tone5", "person swimming: dark skin tone"},
+{"\U0001F6C0\U0001F3FB", "bath_tone1", "person taking bath: light skin tone"},
+{"\U0001F6C0\U0001F3FC", "bath_tone2", "person taking bath: medium-light skin tone"},
+{"\U0001F6C0\U0001F3FD", "bath_tone3", "person taking bath: medium skin tone"},
+{"\U0001F6C0\U0001F3FE", "bath_tone4", "person taking bath: medium-dark skin tone"},
+{"\U0001F6C0\U0001F3FF", "bath_tone5", "person taking bath: dark skin tone"},
+{"\U0001F481\U0001F3FB", "information_desk_person_tone1", "person tipping hand: light skin tone"},
+{"\U0001F481\U0001F3FC", "information_desk_person_tone2", "person tipping hand: medium-light skin tone"},
+{"\U0001F481\U0001F3FD", "information_desk_person_tone3", "person tipping hand: medium skin tone"},
+{"\U0001F481\U0001F3FE", "information_desk_person_tone4", "person tipping hand: medium-dark skin tone"},
+{"\U0001F481\U0001F3FF", "information_desk_person_tone5", "person tipping hand: dark skin tone"},
+{"\U0001F6B6\U0001F3FB", "walking_tone1", "person walking: light skin tone"},
+{"\U0001F6B6\U0001F3FC", "walking_tone2", "person walking: medium-light skin tone"},
+{"\U0001F6B6\U0001F3FD", "walking_tone3", "person walking: medium skin tone"},
+{"\U0001F6B6\U0001F3FE", "walking_tone4", "person walking: medium-dark skin tone"},
+{"\U0001F6B6\U0001F3FF", "walking_tone5", "person walking: dark skin tone"},
+{"\U0001F473\U0001F3FB", "man_with_turban_tone1", "person wearing turban: light skin tone"},
+{"\U0001F473\U0001F3FC", "man_with_turban_tone2", "person wearing turban: medium-light skin tone"},
+{"\U0001F473\U0001F3FD", "man_with_turban_tone3", "person wearing turban: medium skin tone"},
+{"\U0001F473\U0001F3FE", "man_with_turban_tone4", "person wearing turban: medium-dark skin tone"},
+{"\U0001F473\U0001F3FF", "man_with_turban_tone5", "person wearing turban: dark skin tone"},
+{"\U0001FAC5\U0001F3FB", "person with crown: light skin tone", "person with crown: light skin tone"},
+{"\U0001FAC5\U0001F3FC", "person with crown: medium-light skin tone", "person with crown: medium-light skin tone"},
+{"\U0001FAC5\U0001F3FD", "person with crown: medium skin tone", "person with crown: medium skin tone"},
+{"\U0001FAC5\U0001F3FE", "person with crown: medium-dark skin tone", "person with crown: medium-dark skin tone"},
+{"\U0001FAC5\U0001F3FF", "person with crown: dark skin tone", "person with crown: dark skin tone"},
+{"\U0001F472\U0001F3FB", "man_with_gua_pi_mao_tone1", "person with skullcap: light skin tone"},
+{"\U0001F472\U0001F3FC", "man_with_gua_pi_mao_tone2", "person with skullcap: medium-light skin tone"},
+{"\U0001F472\U0001F3FD", "man_with_gua_pi_mao_tone3", "person with skullcap: medium skin tone"},
+{"\U0001F472\U0001F3FE", "man_with_gua_pi_mao_tone4", "person with skullcap: medium-dark skin tone"},
+{"\U0001F472\U0001F3FF", "man_with_gua_pi_mao_tone5", "person with skullcap: dark skin tone"},
+{"\U0001F470\U0001F3FB", "bride_with_veil_tone1", "person with veil: light skin tone"},
+{"\U0001F470\U0001F3FC", "bride_with_veil_tone2", "person with veil: medium-light skin tone"},
+{"\U0001F470\U0001F3FD", "bride_with_veil_tone3", "person with veil: medium skin tone"},
+{"\U0001F470\U0001F3FE", "bride_with_veil_tone4", "person with veil: medium-dark skin tone"},
+{"\U0001F470\U0001F3FF", "bride_with_veil_tone5", "person with veil: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F9AF", "person with white cane: light skin tone", "person with white cane: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F9AF", "person with white cane: medium-light skin tone", "person with white cane: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F9AF", "person with white cane: medium skin tone", "person with white cane: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F9AF", "person with white cane: medium-dark skin tone", "person with white cane: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F9AF", "person with white cane: dark skin tone", "person with white cane: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U00002708\U0000FE0F", "pilot: light skin tone", "pilot: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U00002708\U0000FE0F", "pilot: medium-light skin tone", "pilot: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U00002708\U0000FE0F", "pilot: medium skin tone", "pilot: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U00002708\U0000FE0F", "pilot: medium-dark skin tone", "pilot: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U00002708\U0000FE0F", "pilot: dark skin tone", "pilot: dark skin tone"},
+{"\U0001F90C\U0001F3FB", "pinched fingers: light skin tone", "pinched fingers: light skin tone"},
+{"\U0001F90C\U0001F3FC", "pinched fingers: medium-light skin tone", "pinched fingers: medium-light skin tone"},
+{"\U0001F90C\U0001F3FD", "pinched fingers: medium skin tone", "pinched fingers: medium skin tone"},
+{"\U0001F90C\U0001F3FE", "pinched fingers: medium-dark skin tone", "pinched fingers: medium-dark skin tone"},
+{"\U0001F90C\U0001F3FF", "pinched fingers: dark skin tone", "pinched fingers: dark skin tone"},
+{"\U0001F90F\U0001F3FB", "pinching hand: light skin tone", "pinching hand: light skin tone"},
+{"\U0001F90F\U0001F3FC", "pinching hand: medium-light skin tone", "pinching hand: medium-light skin tone"},
+{"\U0001F90F\U0001F3FD", "pinching hand: medium skin tone", "pinching hand: medium skin tone"},
+{"\U0001F90F\U0001F3FE", "pinching hand: medium-dark skin tone", "pinching hand: medium-dark skin tone"},
+{"\U0001F90F\U0001F3FF", "pinching hand: dark skin tone", "pinching hand: dark skin tone"},
+{"\U0001F46E\U0001F3FB", "cop_tone1", "police officer: light skin tone"},
+{"\U0001F46E\U0001F3FC", "cop_tone2", "police officer: medium-light skin tone"},
+{"\U0001F46E\U0001F3FD", "cop_tone3", "police officer: medium skin tone"},
+{"\U0001F46E\U0001F3FE", "cop_tone4", "police officer: medium-dark skin tone"},
+{"\U0001F46E\U0001F3FF", "cop_tone5", "police officer: dark skin tone"},
+{"\U0001FAC3\U0001F3FB", "pregnant man: light skin tone", "pregnant man: light skin tone"},
+{"\U0001FAC3\U0001F3FC", "pregnant man: medium-light skin tone", "pregnant man: medium-light skin tone"},
+{"\U0001FAC3\U0001F3FD", "pregnant man: medium skin tone", "pregnant man: medium skin tone"},
+{"\U0001FAC3\U0001F3FE", "pregnant man: medium-dark skin tone", "pregnant man: medium-dark skin tone"},
+{"\U0001FAC3\U0001F3FF", "pregnant man: dark skin tone", "pregnant man: dark skin tone"},
+{"\U0001FAC4\U0001F3FB", "pregnant person: light skin tone", "pregnant person: light skin tone"},
+{"\U0001FAC4\U0001F3FC", "pregnant person: medium-light skin tone", "pregnant person: medium-light skin tone"},
+{"\U0001FAC4\U0001F3FD", "pregnant person: medium skin tone", "pregnant person: medium skin tone"},
+{"\U0001FAC4\U0001F3FE", "pregnant person: medium-dark skin tone", "pregnant person: medium-dark skin tone"},
+{"\U0001FAC4\U0001F3FF", "pregnant person: dark skin tone", "pregnant person: dark skin tone"},
+{"\U0001F930\U0001F3FB", "pregnant_woman_tone1", "pregnant woman: light skin tone"},
+{"\U0001F930\U0001F3FC", "pregnant_woman_tone2", "pregnant woman: medium-light skin tone"},
+{"\U0001F930\U0001F3FD", "pregnant_woman_tone3", "pregnant woman: medium skin tone"},
+{"\U0001F930\U0001F3FE", "pregnant_woman_tone4", "pregnant woman: medium-dark skin tone"},
+{"\U0001F930\U0001F3FF", "pregnant_woman_tone5", "pregnant woman: dark skin tone"},
+{"\U0001F934\U0001F3FB", "prince_tone1", "prince: light skin tone"},
+{"\U0001F934\U0001F3FC", "prince_tone2", "prince: medium-light skin tone"},
+{"\U0001F934\U0001F3FD", "prince_tone3", "prince: medium skin tone"},
+{"\U0001F934\U0001F3FE", "prince_tone4", "prince: medium-dark skin tone"},
+{"\U0001F934\U0001F3FF", "prince_tone5", "prince: dark skin tone"},
+{"\U0001F478\U0001F3FB", "princess_tone1", "princess: light skin tone"},
+{"\U0001F478\U0001F3FC", "princess_tone2", "princess: medium-light skin tone"},
+{"\U0001F478\U0001F3FD", "princess_tone3", "princess: medium skin tone"},
+{"\U0001F478\U0001F3FE", "princess_tone4", "princess: medium-dark skin tone"},
+{"\U0001F478\U0001F3FF", "princess_tone5", "princess: dark skin tone"},
+{"\U0001F91A\U0001F3FB", "raised_back_of_hand_tone1", "raised back of hand: light skin tone"},
+{"\U0001F91A\U0001F3FC", "raised_back_of_hand_tone2", "raised back of hand: medium-light skin tone"},
+{"\U0001F91A\U0001F3FD", "raised_back_of_hand_tone3", "raised back of hand: medium skin tone"},
+{"\U0001F91A\U0001F3FE", "raised_back_of_hand_tone4", "raised back of hand: medium-dark skin tone"},
+{"\U0001F91A\U0001F3FF", "raised_back_of_hand_tone5", "raised back of hand: dark skin tone"},
+{"\U0000270A\U0001F3FB", "fist_tone1", "raised fist: light skin tone"},
+{"\U0000270A\U0001F3FC", "fist_tone2", "raised fist: medium-light skin tone"},
+{"\U0000270A\U0001F3FD", "fist_tone3", "raised fist: medium skin tone"},
+{"\U0000270A\U0001F3FE", "fist_tone4", "raised fist: medium-dark skin tone"},
+{"\U0000270A\U0001F3FF", "fist_tone5", "raised fist: dark skin tone"},
+{"\U0000270B\U0001F3FB", "raised_hand_tone1", "raised hand: light skin tone"},
+{"\U0000270B\U0001F3FC", "raised_hand_tone2", "raised hand: medium-light skin tone"},
+{"\U0000270B\U0001F3FD", "raised_hand_tone3", "raised hand: medium skin tone"},
+{"\U0000270B\U0001F3FE", "raised_hand_tone4", "raised hand: medium-dark skin tone"},
+{"\U0000270B\U0001F3FF", "raised_hand_tone5", "raised hand: dark skin tone"},
+{"\U0001F64C\U0001F3FB", "raised_hands_tone1", "raising hands: light skin tone"},
+{"\U0001F64C\U0001F3FC", "raised_hands_tone2", "raising hands: medium-light skin tone"},
+{"\U0001F64C\U0001F3FD", "raised_hands_tone3", "raising hands: medium skin tone"},
+{"\U0001F64C\U0001F3FE", "raised_hands_tone4", "raising hands: medium-dark skin tone"},
+{"\U0001F64C\U0001F3FF", "raised_hands_tone5", "raising hands: dark skin tone"},
+{"\U0001F91C\U0001F3FB", "right_facing_fist_tone1", "right-facing fist: light skin tone"},
+{"\U0001F91C\U0001F3FC", "right_facing_fist_tone2", "right-facing fist: medium-light skin tone"},
+{"\U0001F91C\U0001F3FD", "right_facing_fist_tone3", "right-facing fist: medium skin tone"},
+{"\U0001F91C\U0001F3FE", "right_facing_fist_tone4", "right-facing fist: medium-dark skin tone"},
+{"\U0001F91C\U0001F3FF", "right_facing_fist_tone5", "right-facing fist: dark skin tone"},
+{"\U0001FAF1\U0001F3FB", "rightwards hand: light skin tone", "rightwards hand: light skin tone"},
+{"\U0001FAF1\U0001F3FC", "rightwards hand: medium-light skin tone", "rightwards hand: medium-light skin tone"},
+{"\U0001FAF1\U0001F3FD", "rightwards hand: medium skin tone", "rightwards hand: medium skin tone"},
+{"\U0001FAF1\U0001F3FE", "rightwards hand: medium-dark skin tone", "rightwards hand: medium-dark skin tone"},
+{"\U0001FAF1\U0001F3FF", "rightwards hand: dark skin tone", "rightwards hand: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F52C", "scientist: light skin tone", "scientist: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F52C", "scientist: medium-light skin tone", "scientist: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F52C", "scientist: medium skin tone", "scientist: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F52C", "scientist: medium-dark skin tone", "scientist: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F52C", "scientist: dark skin tone", "scientist: dark skin tone"},
+{"\U0001F933\U0001F3FB", "selfie_tone1", "selfie: light skin tone"},
+{"\U0001F933\U0001F3FC", "selfie_tone2", "selfie: medium-light skin tone"},
+{"\U0001F933\U0001F3FD", "selfie_tone3", "selfie: medium skin tone"},
+{"\U0001F933\U0001F3FE", "selfie_tone4", "selfie: medium-dark skin tone"},
+{"\U0001F933\U0001F3FF", "selfie_tone5", "selfie: dark skin tone"},
+{"\U0001F918\U0001F3FB", "metal_tone1", "sign of the horns: light skin tone"},
+{"\U0001F918\U0001F3FC", "metal_tone2", "sign of the horns: medium-light skin tone"},
+{"\U0001F918\U0001F3FD", "metal_tone3", "sign of the horns: medium skin tone"},
+{"\U0001F918\U0001F3FE", "metal_tone4", "sign of the horns: medium-dark skin tone"},
+{"\U0001F918\U0001F3FF", "metal_tone5", "sign of the horns: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F3A4", "singer: light skin tone", "singer: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F3A4", "singer: medium-light skin tone", "singer: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F3A4", "singer: medium skin tone", "singer: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F3A4", "singer: medium-dark skin tone", "singer: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F3A4", "singer: dark skin tone", "singer: dark skin tone"},
+{"\U0001F3C2\U0001F3FB", "snowboarder_tone1", "snowboarder: light skin tone"},
+{"\U0001F3C2\U0001F3FC", "snowboarder_tone2", "snowboarder: medium-light skin tone"},
+{"\U0001F3C2\U0001F3FD", "snowboarder_tone3", "snowboarder: medium skin tone"},
+{"\U0001F3C2\U0001F3FE", "snowboarder_tone4", "snowboarder: medium-dark skin tone"},
+{"\U0001F3C2\U0001F3FF", "snowboarder_tone5", "snowboarder: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F393", "student: light skin tone", "student: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F393", "student: medium-light skin tone", "student: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F393", "student: medium skin tone", "student: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F393", "student: medium-dark skin tone", "student: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F393", "student: dark skin tone", "student: dark skin tone"},
+{"\U0001F9B8\U0001F3FB", "superhero_tone1", "superhero: light skin tone"},
+{"\U0001F9B8\U0001F3FC", "superhero_tone2", "superhero: medium-light skin tone"},
+{"\U0001F9B8\U0001F3FD", "superhero_tone3", "superhero: medium skin tone"},
+{"\U0001F9B8\U0001F3FE", "superhero_tone4", "superhero: medium-dark skin tone"},
+{"\U0001F9B8\U0001F3FF", "superhero_tone5", "superhero: dark skin tone"},
+{"\U0001F9B9\U0001F3FB", "supervillain_tone1", "supervillain: light skin tone"},
+{"\U0001F9B9\U0001F3FC", "supervillain_tone2", "supervillain: medium-light skin tone"},
+{"\U0001F9B9\U0001F3FD", "supervillain_tone3", "supervillain: medium skin tone"},
+{"\U0001F9B9\U0001F3FE", "supervillain_tone4", "supervillain: medium-dark skin tone"},
+{"\U0001F9B9\U0001F3FF", "supervillain_tone5", "supervillain: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F3EB", "teacher: light skin tone", "teacher: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F3EB", "teacher: medium-light skin tone", "teacher: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F3EB", "teacher: medium skin tone", "teacher: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F3EB", "teacher: medium-dark skin tone", "teacher: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F3EB", "teacher: dark skin tone", "teacher: dark skin tone"},
+{"\U0001F9D1\U0001F3FB\U0000200D\U0001F4BB", "technologist: light skin tone", "technologist: light skin tone"},
+{"\U0001F9D1\U0001F3FC\U0000200D\U0001F4BB", "technologist: medium-light skin tone", "technologist: medium-light skin tone"},
+{"\U0001F9D1\U0001F3FD\U0000200D\U0001F4BB", "technologist: medium skin tone", "technologist: medium skin tone"},
+{"\U0001F9D1\U0001F3FE\U0000200D\U0001F4BB", "technologist: medium-dark skin tone", "technologist: medium-dark skin tone"},
+{"\U0001F9D1\U0001F3FF\U0000200D\U0001F4BB", "technologist: dark skin tone", "technologist: dark skin tone"},
+{"\U0001F44E\U0001F3FB", "thumbsdown_tone1", "thumbs down: light skin tone"},
+{"\U0001F44E\U0001F3FC", "thumbsdown_tone2", "thumbs down: medium-light skin tone"},
+{"\U0001F44E\U0001F3FD", "thumbsdown_tone3", "thumbs down: medium skin tone"},
+{"\U0001F44E\U0001F3FE", "thumbsdown_tone4", "thumbs down: medium-dark skin tone"},
+{"\U0001F44E\U0001F3FF", "thumbsdown_tone5", "thumbs down: dark skin tone"},
+{"\U0001F44D\U0001F3FB", "thumbsup_tone1", "thumbs up: light skin tone"},
+{"\U0001F44D\U0001F3FC", "thumbsup_tone2", "thumbs up: medium-light skin tone"},
+{"\U0001F44D\U0001F3FD", "thumbsup_tone3", "thumbs up: medium skin tone"},
+{"\U0001F44D\U0001F3FE", "thumbsup_tone4", "thumbs up: medium-dark skin tone"},
+{"\U0001F44D\U0001F3FF", "thumbsup_tone5", "thumbs up: dark skin tone"},
+{"\U0001F9DB\U0001F3FB", "vampire_tone1", "vampire: light skin tone"},
+{"\U0001F9DB\U0001F3FC", "vampire_tone2", "vampire: medium-light skin tone"},
+{"\U0001F9DB\U0001F3FD", "vampire_tone3", "vampire: medium skin tone"},
+{"\U0001F9DB\U0001F3FE", "vampire_tone4", "vampire: medium-dark skin tone"},
+{"\U0001F9DB\U0001F3FF", "vampire_tone5", "vampire: dark skin tone"},
+{"\U0000270C\U0001F3FB", "v_tone1", "victory hand: light skin tone"},
+{"\U0000270C\U0001F3FC", "v_tone2", "victory hand: medium-light skin tone"},
+{"\U0000270C\U0001F3FD", "v_tone3", "victory hand: medium skin tone"},
+{"\U0000270C\U0001F3FE", "v_tone4", "victory hand: medium-dark skin tone"},
+{"\U0000270C\U0001F3FF", "v_tone5", "victory hand: dark skin tone"},
+{"\U0001F596\U0001F3FB", "vulcan_tone1", "vulcan salute: light skin tone"},
+{"\U0001F596\U0001F3FC", "vulcan_tone2", "vulcan salute: medium-light skin tone"},
+{"\U0001F596\U0001F3FD", "vulcan_tone3", "vulcan salute: medium skin tone"},
+{"\U0001F596\U0001F3FE", "vulcan_tone4", "vulcan salute: medium-dark skin tone"},
+{"\U0001F596\U0001F3FF", "vulcan_tone5", "vulcan salute: dark skin tone"},
+{"\U0001F44B\U0001F3FB", "wave_tone1", "waving hand: light skin tone"},
+{"\U0001F44B\U0001F3FC", "wave_tone2", "waving hand: medium-light skin tone"},
+{"\U0001F44B\U0001F3FD", "wave_tone3", "waving hand: medium skin tone"},
+{"\U0001F44B\U0001F3FE", "wave_tone4", "waving hand: medium-dark skin tone"},
+{"\U0001F44B\U0001F3FF", "wave_tone5", "waving hand: dark skin tone"},
+{"\U0001F9D4\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman: light skin tone, beard", "woman: light skin tone, beard"},
+{"\U0001F9D4\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman: medium-light skin tone, beard", "woman: medium-light skin tone, beard"},
+{"\U0001F9D4\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman: medium skin tone, beard", "woman: medium skin tone, beard"},
+{"\U0001F9D4\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman: medium-dark skin tone, beard", "woman: medium-dark skin tone, beard"},
+{"\U0001F9D4\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman: dark skin tone, beard", "woman: dark skin tone, beard"},
+{"\U0001F469\U0001F3FB", "woman_tone1", "woman: light skin tone"},
+{"\U0001F469\U0001F3FC", "woman_tone2", "woman: medium-light skin tone"},
+{"\U0001F469\U0001F3FD", "woman_tone3", "woman: medium skin tone"},
+{"\U0001F469\U0001F3FE", "woman_tone4", "woman: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF", "woman_tone5", "woman: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F9B0", "woman: light skin tone, red hair", "woman: light skin tone, red hair"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F9B0", "woman: medium-light skin tone, red hair", "woman: medium-light skin tone, red hair"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F9B0", "woman: medium skin tone, red hair", "woman: medium skin tone, red hair"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F9B0", "woman: medium-dark skin tone, red hair", "woman: medium-dark skin tone, red hair"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F9B0", "woman: dark skin tone, red hair", "woman: dark skin tone, red hair"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F9B1", "woman: light skin tone, curly hair", "woman: light skin tone, curly hair"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F9B1", "woman: medium-light skin tone, curly hair", "woman: medium-light skin tone, curly hair"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F9B1", "woman: medium skin tone, curly hair", "woman: medium skin tone, curly hair"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F9B1", "woman: medium-dark skin tone, curly hair", "woman: medium-dark skin tone, curly hair"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F9B1", "woman: dark skin tone, curly hair", "woman: dark skin tone, curly hair"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F9B3", "woman: light skin tone, white hair", "woman: light skin tone, white hair"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F9B3", "woman: medium-light skin tone, white hair", "woman: medium-light skin tone, white hair"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F9B3", "woman: medium skin tone, white hair", "woman: medium skin tone, white hair"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F9B3", "woman: medium-dark skin tone, white hair", "woman: medium-dark skin tone, white hair"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F9B3", "woman: dark skin tone, white hair", "woman: dark skin tone, white hair"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F9B2", "woman: light skin tone, bald", "woman: light skin tone, bald"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F9B2", "woman: medium-light skin tone, bald", "woman: medium-light skin tone, bald"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F9B2", "woman: medium skin tone, bald", "woman: medium skin tone, bald"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F9B2", "woman: medium-dark skin tone, bald", "woman: medium-dark skin tone, bald"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F9B2", "woman: dark skin tone, bald", "woman: dark skin tone, bald"},
+{"\U0001F471\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman: light skin tone, blond hair", "woman: light skin tone, blond hair"},
+{"\U0001F471\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman: medium-light skin tone, blond hair", "woman: medium-light skin tone, blond hair"},
+{"\U0001F471\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman: medium skin tone, blond hair", "woman: medium skin tone, blond hair"},
+{"\U0001F471\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman: medium-dark skin tone, blond hair", "woman: medium-dark skin tone, blond hair"},
+{"\U0001F471\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman: dark skin tone, blond hair", "woman: dark skin tone, blond hair"},
+{"\U0001F46B\U0001F3FB", "woman and man holding hands: light skin tone", "woman and man holding hands: light skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC", "woman and man holding hands: light skin tone, medium-light skin tone", "woman and man holding hands: light skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD", "woman and man holding hands: light skin tone, medium skin tone", "woman and man holding hands: light skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE", "woman and man holding hands: light skin tone, medium-dark skin tone", "woman and man holding hands: light skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF", "woman and man holding hands: light skin tone, dark skin tone", "woman and man holding hands: light skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB", "woman and man holding hands: medium-light skin tone, light skin tone", "woman and man holding hands: medium-light skin tone, light skin tone"},
+{"\U0001F46B\U0001F3FC", "woman and man holding hands: medium-light skin tone", "woman and man holding hands: medium-light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD", "woman and man holding hands: medium-light skin tone, medium skin tone", "woman and man holding hands: medium-light skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE", "woman and man holding hands: medium-light skin tone, medium-dark skin tone", "woman and man holding hands: medium-light skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF", "woman and man holding hands: medium-light skin tone, dark skin tone", "woman and man holding hands: medium-light skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB", "woman and man holding hands: medium skin tone, light skin tone", "woman and man holding hands: medium skin tone, light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC", "woman and man holding hands: medium skin tone, medium-light skin tone", "woman and man holding hands: medium skin tone, medium-light skin tone"},
+{"\U0001F46B\U0001F3FD", "woman and man holding hands: medium skin tone", "woman and man holding hands: medium skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE", "woman and man holding hands: medium skin tone, medium-dark skin tone", "woman and man holding hands: medium skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF", "woman and man holding hands: medium skin tone, dark skin tone", "woman and man holding hands: medium skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB", "woman and man holding hands: medium-dark skin tone, light skin tone", "woman and man holding hands: medium-dark skin tone, light skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC", "woman and man holding hands: medium-dark skin tone, medium-light skin tone", "woman and man holding hands: medium-dark skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD", "woman and man holding hands: medium-dark skin tone, medium skin tone", "woman and man holding hands: medium-dark skin tone, medium skin tone"},
+{"\U0001F46B\U0001F3FE", "woman and man holding hands: medium-dark skin tone", "woman and man holding hands: medium-dark skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FF", "woman and man holding hands: medium-dark skin tone, dark skin tone", "woman and man holding hands: medium-dark skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FB", "woman and man holding hands: dark skin tone, light skin tone", "woman and man holding hands: dark skin tone, light skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FC", "woman and man holding hands: dark skin tone, medium-light skin tone", "woman and man holding hands: dark skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FD", "woman and man holding hands: dark skin tone, medium skin tone", "woman and man holding hands: dark skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F468\U0001F3FE", "woman and man holding hands: dark skin tone, medium-dark skin tone", "woman and man holding hands: dark skin tone, medium-dark skin tone"},
+{"\U0001F46B\U0001F3FF", "woman and man holding hands: dark skin tone", "woman and man holding hands: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F3A8", "woman artist: light skin tone", "woman artist: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F3A8", "woman artist: medium-light skin tone", "woman artist: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F3A8", "woman artist: medium skin tone", "woman artist: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F3A8", "woman artist: medium-dark skin tone", "woman artist: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F3A8", "woman artist: dark skin tone", "woman artist: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F680", "woman astronaut: light skin tone", "woman astronaut: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F680", "woman astronaut: medium-light skin tone", "woman astronaut: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F680", "woman astronaut: medium skin tone", "woman astronaut: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F680", "woman astronaut: medium-dark skin tone", "woman astronaut: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F680", "woman astronaut: dark skin tone", "woman astronaut: dark skin tone"},
+{"\U0001F6B4\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman biking: light skin tone", "woman biking: light skin tone"},
+{"\U0001F6B4\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman biking: medium-light skin tone", "woman biking: medium-light skin tone"},
+{"\U0001F6B4\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman biking: medium skin tone", "woman biking: medium skin tone"},
+{"\U0001F6B4\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman biking: medium-dark skin tone", "woman biking: medium-dark skin tone"},
+{"\U0001F6B4\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman biking: dark skin tone", "woman biking: dark skin tone"},
+{"\U000026F9\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman bouncing ball: light skin tone", "woman bouncing ball: light skin tone"},
+{"\U000026F9\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman bouncing ball: medium-light skin tone", "woman bouncing ball: medium-light skin tone"},
+{"\U000026F9\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman bouncing ball: medium skin tone", "woman bouncing ball: medium skin tone"},
+{"\U000026F9\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman bouncing ball: medium-dark skin tone", "woman bouncing ball: medium-dark skin tone"},
+{"\U000026F9\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman bouncing ball: dark skin tone", "woman bouncing ball: dark skin tone"},
+{"\U0001F647\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman bowing: light skin tone", "woman bowing: light skin tone"},
+{"\U0001F647\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman bowing: medium-light skin tone", "woman bowing: medium-light skin tone"},
+{"\U0001F647\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman bowing: medium skin tone", "woman bowing: medium skin tone"},
+{"\U0001F647\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman bowing: medium-dark skin tone", "woman bowing: medium-dark skin tone"},
+{"\U0001F647\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman bowing: dark skin tone", "woman bowing: dark skin tone"},
+{"\U0001F938\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman cartwheeling: light skin tone", "woman cartwheeling: light skin tone"},
+{"\U0001F938\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman cartwheeling: medium-light skin tone", "woman cartwheeling: medium-light skin tone"},
+{"\U0001F938\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman cartwheeling: medium skin tone", "woman cartwheeling: medium skin tone"},
+{"\U0001F938\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman cartwheeling: medium-dark skin tone", "woman cartwheeling: medium-dark skin tone"},
+{"\U0001F938\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman cartwheeling: dark skin tone", "woman cartwheeling: dark skin tone"},
+{"\U0001F9D7\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman climbing: light skin tone", "woman climbing: light skin tone"},
+{"\U0001F9D7\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman climbing: medium-light skin tone", "woman climbing: medium-light skin tone"},
+{"\U0001F9D7\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman climbing: medium skin tone", "woman climbing: medium skin tone"},
+{"\U0001F9D7\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman climbing: medium-dark skin tone", "woman climbing: medium-dark skin tone"},
+{"\U0001F9D7\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman climbing: dark skin tone", "woman climbing: dark skin tone"},
+{"\U0001F477\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman construction worker: light skin tone", "woman construction worker: light skin tone"},
+{"\U0001F477\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman construction worker: medium-light skin tone", "woman construction worker: medium-light skin tone"},
+{"\U0001F477\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman construction worker: medium skin tone", "woman construction worker: medium skin tone"},
+{"\U0001F477\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman construction worker: medium-dark skin tone", "woman construction worker: medium-dark skin tone"},
+{"\U0001F477\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman construction worker: dark skin tone", "woman construction worker: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F373", "woman cook: light skin tone", "woman cook: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F373", "woman cook: medium-light skin tone", "woman cook: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F373", "woman cook: medium skin tone", "woman cook: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F373", "woman cook: medium-dark skin tone", "woman cook: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F373", "woman cook: dark skin tone", "woman cook: dark skin tone"},
+{"\U0001F483\U0001F3FB", "dancer_tone1", "woman dancing: light skin tone"},
+{"\U0001F483\U0001F3FC", "dancer_tone2", "woman dancing: medium-light skin tone"},
+{"\U0001F483\U0001F3FD", "dancer_tone3", "woman dancing: medium skin tone"},
+{"\U0001F483\U0001F3FE", "dancer_tone4", "woman dancing: medium-dark skin tone"},
+{"\U0001F483\U0001F3FF", "dancer_tone5", "woman dancing: dark skin tone"},
+{"\U0001F575\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman detective: light skin tone", "woman detective: light skin tone"},
+{"\U0001F575\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman detective: medium-light skin tone", "woman detective: medium-light skin tone"},
+{"\U0001F575\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman detective: medium skin tone", "woman detective: medium skin tone"},
+{"\U0001F575\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman detective: medium-dark skin tone", "woman detective: medium-dark skin tone"},
+{"\U0001F575\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman detective: dark skin tone", "woman detective: dark skin tone"},
+{"\U0001F9DD\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman elf: light skin tone", "woman elf: light skin tone"},
+{"\U0001F9DD\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman elf: medium-light skin tone", "woman elf: medium-light skin tone"},
+{"\U0001F9DD\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman elf: medium skin tone", "woman elf: medium skin tone"},
+{"\U0001F9DD\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman elf: medium-dark skin tone", "woman elf: medium-dark skin tone"},
+{"\U0001F9DD\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman elf: dark skin tone", "woman elf: dark skin tone"},
+{"\U0001F926\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman facepalming: light skin tone", "woman facepalming: light skin tone"},
+{"\U0001F926\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman facepalming: medium-light skin tone", "woman facepalming: medium-light skin tone"},
+{"\U0001F926\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman facepalming: medium skin tone", "woman facepalming: medium skin tone"},
+{"\U0001F926\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman facepalming: medium-dark skin tone", "woman facepalming: medium-dark skin tone"},
+{"\U0001F926\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman facepalming: dark skin tone", "woman facepalming: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F3ED", "woman factory worker: light skin tone", "woman factory worker: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F3ED", "woman factory worker: medium-light skin tone", "woman factory worker: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F3ED", "woman factory worker: medium skin tone", "woman factory worker: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F3ED", "woman factory worker: medium-dark skin tone", "woman factory worker: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F3ED", "woman factory worker: dark skin tone", "woman factory worker: dark skin tone"},
+{"\U0001F9DA\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman fairy: light skin tone", "woman fairy: light skin tone"},
+{"\U0001F9DA\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman fairy: medium-light skin tone", "woman fairy: medium-light skin tone"},
+{"\U0001F9DA\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman fairy: medium skin tone", "woman fairy: medium skin tone"},
+{"\U0001F9DA\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman fairy: medium-dark skin tone", "woman fairy: medium-dark skin tone"},
+{"\U0001F9DA\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman fairy: dark skin tone", "woman fairy: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F33E", "woman farmer: light skin tone", "woman farmer: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F33E", "woman farmer: medium-light skin tone", "woman farmer: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F33E", "woman farmer: medium skin tone", "woman farmer: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F33E", "woman farmer: medium-dark skin tone", "woman farmer: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F33E", "woman farmer: dark skin tone", "woman farmer: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F37C", "woman feeding baby: light skin tone", "woman feeding baby: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F37C", "woman feeding baby: medium-light skin tone", "woman feeding baby: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F37C", "woman feeding baby: medium skin tone", "woman feeding baby: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F37C", "woman feeding baby: medium-dark skin tone", "woman feeding baby: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F37C", "woman feeding baby: dark skin tone", "woman feeding baby: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F692", "woman firefighter: light skin tone", "woman firefighter: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F692", "woman firefighter: medium-light skin tone", "woman firefighter: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F692", "woman firefighter: medium skin tone", "woman firefighter: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F692", "woman firefighter: medium-dark skin tone", "woman firefighter: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F692", "woman firefighter: dark skin tone", "woman firefighter: dark skin tone"},
+{"\U0001F64D\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman frowning: light skin tone", "woman frowning: light skin tone"},
+{"\U0001F64D\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman frowning: medium-light skin tone", "woman frowning: medium-light skin tone"},
+{"\U0001F64D\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman frowning: medium skin tone", "woman frowning: medium skin tone"},
+{"\U0001F64D\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman frowning: medium-dark skin tone", "woman frowning: medium-dark skin tone"},
+{"\U0001F64D\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman frowning: dark skin tone", "woman frowning: dark skin tone"},
+{"\U0001F645\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman gesturing NO: light skin tone", "woman gesturing NO: light skin tone"},
+{"\U0001F645\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman gesturing NO: medium-light skin tone", "woman gesturing NO: medium-light skin tone"},
+{"\U0001F645\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman gesturing NO: medium skin tone", "woman gesturing NO: medium skin tone"},
+{"\U0001F645\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman gesturing NO: medium-dark skin tone", "woman gesturing NO: medium-dark skin tone"},
+{"\U0001F645\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman gesturing NO: dark skin tone", "woman gesturing NO: dark skin tone"},
+{"\U0001F646\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman gesturing OK: light skin tone", "woman gesturing OK: light skin tone"},
+{"\U0001F646\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman gesturing OK: medium-light skin tone", "woman gesturing OK: medium-light skin tone"},
+{"\U0001F646\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman gesturing OK: medium skin tone", "woman gesturing OK: medium skin tone"},
+{"\U0001F646\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman gesturing OK: medium-dark skin tone", "woman gesturing OK: medium-dark skin tone"},
+{"\U0001F646\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman gesturing OK: dark skin tone", "woman gesturing OK: dark skin tone"},
+{"\U0001F487\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman getting haircut: light skin tone", "woman getting haircut: light skin tone"},
+{"\U0001F487\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman getting haircut: medium-light skin tone", "woman getting haircut: medium-light skin tone"},
+{"\U0001F487\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman getting haircut: medium skin tone", "woman getting haircut: medium skin tone"},
+{"\U0001F487\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman getting haircut: medium-dark skin tone", "woman getting haircut: medium-dark skin tone"},
+{"\U0001F487\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman getting haircut: dark skin tone", "woman getting haircut: dark skin tone"},
+{"\U0001F486\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman getting massage: light skin tone", "woman getting massage: light skin tone"},
+{"\U0001F486\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman getting massage: medium-light skin tone", "woman getting massage: medium-light skin tone"},
+{"\U0001F486\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman getting massage: medium skin tone", "woman getting massage: medium skin tone"},
+{"\U0001F486\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman getting massage: medium-dark skin tone", "woman getting massage: medium-dark skin tone"},
+{"\U0001F486\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman getting massage: dark skin tone", "woman getting massage: dark skin tone"},
+{"\U0001F3CC\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman golfing: light skin tone", "woman golfing: light skin tone"},
+{"\U0001F3CC\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman golfing: medium-light skin tone", "woman golfing: medium-light skin tone"},
+{"\U0001F3CC\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman golfing: medium skin tone", "woman golfing: medium skin tone"},
+{"\U0001F3CC\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman golfing: medium-dark skin tone", "woman golfing: medium-dark skin tone"},
+{"\U0001F3CC\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman golfing: dark skin tone", "woman golfing: dark skin tone"},
+{"\U0001F482\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman guard: light skin tone", "woman guard: light skin tone"},
+{"\U0001F482\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman guard: medium-light skin tone", "woman guard: medium-light skin tone"},
+{"\U0001F482\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman guard: medium skin tone", "woman guard: medium skin tone"},
+{"\U0001F482\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman guard: medium-dark skin tone", "woman guard: medium-dark skin tone"},
+{"\U0001F482\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman guard: dark skin tone", "woman guard: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002695\U0000FE0F", "woman health worker: light skin tone", "woman health worker: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002695\U0000FE0F", "woman health worker: medium-light skin tone", "woman health worker: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002695\U0000FE0F", "woman health worker: medium skin tone", "woman health worker: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002695\U0000FE0F", "woman health worker: medium-dark skin tone", "woman health worker: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002695\U0000FE0F", "woman health worker: dark skin tone", "woman health worker: dark skin tone"},
+{"\U0001F9D8\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman in lotus position: light skin tone", "woman in lotus position: light skin tone"},
+{"\U0001F9D8\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman in lotus position: medium-light skin tone", "woman in lotus position: medium-light skin tone"},
+{"\U0001F9D8\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman in lotus position: medium skin tone", "woman in lotus position: medium skin tone"},
+{"\U0001F9D8\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman in lotus position: medium-dark skin tone", "woman in lotus position: medium-dark skin tone"},
+{"\U0001F9D8\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman in lotus position: dark skin tone", "woman in lotus position: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F9BD", "woman in manual wheelchair: light skin tone", "woman in manual wheelchair: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F9BD", "woman in manual wheelchair: medium-light skin tone", "woman in manual wheelchair: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F9BD", "woman in manual wheelchair: medium skin tone", "woman in manual wheelchair: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F9BD", "woman in manual wheelchair: medium-dark skin tone", "woman in manual wheelchair: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F9BD", "woman in manual wheelchair: dark skin tone", "woman in manual wheelchair: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F9BC", "woman in motorized wheelchair: light skin tone", "woman in motorized wheelchair: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F9BC", "woman in motorized wheelchair: medium-light skin tone", "woman in motorized wheelchair: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F9BC", "woman in motorized wheelchair: medium skin tone", "woman in motorized wheelchair: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F9BC", "woman in motorized wheelchair: medium-dark skin tone", "woman in motorized wheelchair: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F9BC", "woman in motorized wheelchair: dark skin tone", "woman in motorized wheelchair: dark skin tone"},
+{"\U0001F9D6\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman in steamy room: light skin tone", "woman in steamy room: light skin tone"},
+{"\U0001F9D6\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman in steamy room: medium-light skin tone", "woman in steamy room: medium-light skin tone"},
+{"\U0001F9D6\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman in steamy room: medium skin tone", "woman in steamy room: medium skin tone"},
+{"\U0001F9D6\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman in steamy room: medium-dark skin tone", "woman in steamy room: medium-dark skin tone"},
+{"\U0001F9D6\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman in steamy room: dark skin tone", "woman in steamy room: dark skin tone"},
+{"\U0001F935\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman in tuxedo: light skin tone", "woman in tuxedo: light skin tone"},
+{"\U0001F935\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman in tuxedo: medium-light skin tone", "woman in tuxedo: medium-light skin tone"},
+{"\U0001F935\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman in tuxedo: medium skin tone", "woman in tuxedo: medium skin tone"},
+{"\U0001F935\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman in tuxedo: medium-dark skin tone", "woman in tuxedo: medium-dark skin tone"},
+{"\U0001F935\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman in tuxedo: dark skin tone", "woman in tuxedo: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002696\U0000FE0F", "woman judge: light skin tone", "woman judge: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002696\U0000FE0F", "woman judge: medium-light skin tone", "woman judge: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002696\U0000FE0F", "woman judge: medium skin tone", "woman judge: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002696\U0000FE0F", "woman judge: medium-dark skin tone", "woman judge: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002696\U0000FE0F", "woman judge: dark skin tone", "woman judge: dark skin tone"},
+{"\U0001F939\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman juggling: light skin tone", "woman juggling: light skin tone"},
+{"\U0001F939\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman juggling: medium-light skin tone", "woman juggling: medium-light skin tone"},
+{"\U0001F939\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman juggling: medium skin tone", "woman juggling: medium skin tone"},
+{"\U0001F939\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman juggling: medium-dark skin tone", "woman juggling: medium-dark skin tone"},
+{"\U0001F939\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman juggling: dark skin tone", "woman juggling: dark skin tone"},
+{"\U0001F9CE\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman kneeling: light skin tone", "woman kneeling: light skin tone"},
+{"\U0001F9CE\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman kneeling: medium-light skin tone", "woman kneeling: medium-light skin tone"},
+{"\U0001F9CE\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman kneeling: medium skin tone", "woman kneeling: medium skin tone"},
+{"\U0001F9CE\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman kneeling: medium-dark skin tone", "woman kneeling: medium-dark skin tone"},
+{"\U0001F9CE\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman kneeling: dark skin tone", "woman kneeling: dark skin tone"},
+{"\U0001F3CB\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman lifting weights: light skin tone", "woman lifting weights: light skin tone"},
+{"\U0001F3CB\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman lifting weights: medium-light skin tone", "woman lifting weights: medium-light skin tone"},
+{"\U0001F3CB\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman lifting weights: medium skin tone", "woman lifting weights: medium skin tone"},
+{"\U0001F3CB\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman lifting weights: medium-dark skin tone", "woman lifting weights: medium-dark skin tone"},
+{"\U0001F3CB\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman lifting weights: dark skin tone", "woman lifting weights: dark skin tone"},
+{"\U0001F9D9\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman mage: light skin tone", "woman mage: light skin tone"},
+{"\U0001F9D9\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman mage: medium-light skin tone", "woman mage: medium-light skin tone"},
+{"\U0001F9D9\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman mage: medium skin tone", "woman mage: medium skin tone"},
+{"\U0001F9D9\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman mage: medium-dark skin tone", "woman mage: medium-dark skin tone"},
+{"\U0001F9D9\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman mage: dark skin tone", "woman mage: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F527", "woman mechanic: light skin tone", "woman mechanic: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F527", "woman mechanic: medium-light skin tone", "woman mechanic: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F527", "woman mechanic: medium skin tone", "woman mechanic: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F527", "woman mechanic: medium-dark skin tone", "woman mechanic: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F527", "woman mechanic: dark skin tone", "woman mechanic: dark skin tone"},
+{"\U0001F6B5\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman mountain biking: light skin tone", "woman mountain biking: light skin tone"},
+{"\U0001F6B5\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman mountain biking: medium-light skin tone", "woman mountain biking: medium-light skin tone"},
+{"\U0001F6B5\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman mountain biking: medium skin tone", "woman mountain biking: medium skin tone"},
+{"\U0001F6B5\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman mountain biking: medium-dark skin tone", "woman mountain biking: medium-dark skin tone"},
+{"\U0001F6B5\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman mountain biking: dark skin tone", "woman mountain biking: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F4BC", "woman office worker: light skin tone", "woman office worker: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F4BC", "woman office worker: medium-light skin tone", "woman office worker: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F4BC", "woman office worker: medium skin tone", "woman office worker: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F4BC", "woman office worker: medium-dark skin tone", "woman office worker: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F4BC", "woman office worker: dark skin tone", "woman office worker: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U00002708\U0000FE0F", "woman pilot: light skin tone", "woman pilot: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U00002708\U0000FE0F", "woman pilot: medium-light skin tone", "woman pilot: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U00002708\U0000FE0F", "woman pilot: medium skin tone", "woman pilot: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U00002708\U0000FE0F", "woman pilot: medium-dark skin tone", "woman pilot: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U00002708\U0000FE0F", "woman pilot: dark skin tone", "woman pilot: dark skin tone"},
+{"\U0001F93E\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman playing handball: light skin tone", "woman playing handball: light skin tone"},
+{"\U0001F93E\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman playing handball: medium-light skin tone", "woman playing handball: medium-light skin tone"},
+{"\U0001F93E\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman playing handball: medium skin tone", "woman playing handball: medium skin tone"},
+{"\U0001F93E\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman playing handball: medium-dark skin tone", "woman playing handball: medium-dark skin tone"},
+{"\U0001F93E\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman playing handball: dark skin tone", "woman playing handball: dark skin tone"},
+{"\U0001F93D\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman playing water polo: light skin tone", "woman playing water polo: light skin tone"},
+{"\U0001F93D\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman playing water polo: medium-light skin tone", "woman playing water polo: medium-light skin tone"},
+{"\U0001F93D\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman playing water polo: medium skin tone", "woman playing water polo: medium skin tone"},
+{"\U0001F93D\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman playing water polo: medium-dark skin tone", "woman playing water polo: medium-dark skin tone"},
+{"\U0001F93D\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman playing water polo: dark skin tone", "woman playing water polo: dark skin tone"},
+{"\U0001F46E\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman police officer: light skin tone", "woman police officer: light skin tone"},
+{"\U0001F46E\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman police officer: medium-light skin tone", "woman police officer: medium-light skin tone"},
+{"\U0001F46E\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman police officer: medium skin tone", "woman police officer: medium skin tone"},
+{"\U0001F46E\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman police officer: medium-dark skin tone", "woman police officer: medium-dark skin tone"},
+{"\U0001F46E\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman police officer: dark skin tone", "woman police officer: dark skin tone"},
+{"\U0001F64E\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman pouting: light skin tone", "woman pouting: light skin tone"},
+{"\U0001F64E\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman pouting: medium-light skin tone", "woman pouting: medium-light skin tone"},
+{"\U0001F64E\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman pouting: medium skin tone", "woman pouting: medium skin tone"},
+{"\U0001F64E\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman pouting: medium-dark skin tone", "woman pouting: medium-dark skin tone"},
+{"\U0001F64E\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman pouting: dark skin tone", "woman pouting: dark skin tone"},
+{"\U0001F64B\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman raising hand: light skin tone", "woman raising hand: light skin tone"},
+{"\U0001F64B\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman raising hand: medium-light skin tone", "woman raising hand: medium-light skin tone"},
+{"\U0001F64B\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman raising hand: medium skin tone", "woman raising hand: medium skin tone"},
+{"\U0001F64B\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman raising hand: medium-dark skin tone", "woman raising hand: medium-dark skin tone"},
+{"\U0001F64B\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman raising hand: dark skin tone", "woman raising hand: dark skin tone"},
+{"\U0001F6A3\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman rowing boat: light skin tone", "woman rowing boat: light skin tone"},
+{"\U0001F6A3\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman rowing boat: medium-light skin tone", "woman rowing boat: medium-light skin tone"},
+{"\U0001F6A3\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman rowing boat: medium skin tone", "woman rowing boat: medium skin tone"},
+{"\U0001F6A3\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman rowing boat: medium-dark skin tone", "woman rowing boat: medium-dark skin tone"},
+{"\U0001F6A3\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman rowing boat: dark skin tone", "woman rowing boat: dark skin tone"},
+{"\U0001F3C3\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman running: light skin tone", "woman running: light skin tone"},
+{"\U0001F3C3\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman running: medium-light skin tone", "woman running: medium-light skin tone"},
+{"\U0001F3C3\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman running: medium skin tone", "woman running: medium skin tone"},
+{"\U0001F3C3\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman running: medium-dark skin tone", "woman running: medium-dark skin tone"},
+{"\U0001F3C3\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman running: dark skin tone", "woman running: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F52C", "woman scientist: light skin tone", "woman scientist: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F52C", "woman scientist: medium-light skin tone", "woman scientist: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F52C", "woman scientist: medium skin tone", "woman scientist: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F52C", "woman scientist: medium-dark skin tone", "woman scientist: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F52C", "woman scientist: dark skin tone", "woman scientist: dark skin tone"},
+{"\U0001F937\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman shrugging: light skin tone", "woman shrugging: light skin tone"},
+{"\U0001F937\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman shrugging: medium-light skin tone", "woman shrugging: medium-light skin tone"},
+{"\U0001F937\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman shrugging: medium skin tone", "woman shrugging: medium skin tone"},
+{"\U0001F937\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman shrugging: medium-dark skin tone", "woman shrugging: medium-dark skin tone"},
+{"\U0001F937\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman shrugging: dark skin tone", "woman shrugging: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F3A4", "woman singer: light skin tone", "woman singer: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F3A4", "woman singer: medium-light skin tone", "woman singer: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F3A4", "woman singer: medium skin tone", "woman singer: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F3A4", "woman singer: medium-dark skin tone", "woman singer: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F3A4", "woman singer: dark skin tone", "woman singer: dark skin tone"},
+{"\U0001F9CD\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman standing: light skin tone", "woman standing: light skin tone"},
+{"\U0001F9CD\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman standing: medium-light skin tone", "woman standing: medium-light skin tone"},
+{"\U0001F9CD\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman standing: medium skin tone", "woman standing: medium skin tone"},
+{"\U0001F9CD\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman standing: medium-dark skin tone", "woman standing: medium-dark skin tone"},
+{"\U0001F9CD\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman standing: dark skin tone", "woman standing: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F393", "woman student: light skin tone", "woman student: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F393", "woman student: medium-light skin tone", "woman student: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F393", "woman student: medium skin tone", "woman student: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F393", "woman student: medium-dark skin tone", "woman student: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F393", "woman student: dark skin tone", "woman student: dark skin tone"},
+{"\U0001F9B8\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman superhero: light skin tone", "woman superhero: light skin tone"},
+{"\U0001F9B8\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman superhero: medium-light skin tone", "woman superhero: medium-light skin tone"},
+{"\U0001F9B8\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman superhero: medium skin tone", "woman superhero: medium skin tone"},
+{"\U0001F9B8\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman superhero: medium-dark skin tone", "woman superhero: medium-dark skin tone"},
+{"\U0001F9B8\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman superhero: dark skin tone", "woman superhero: dark skin tone"},
+{"\U0001F9B9\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman supervillain: light skin tone", "woman supervillain: light skin tone"},
+{"\U0001F9B9\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman supervillain: medium-light skin tone", "woman supervillain: medium-light skin tone"},
+{"\U0001F9B9\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman supervillain: medium skin tone", "woman supervillain: medium skin tone"},
+{"\U0001F9B9\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman supervillain: medium-dark skin tone", "woman supervillain: medium-dark skin tone"},
+{"\U0001F9B9\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman supervillain: dark skin tone", "woman supervillain: dark skin tone"},
+{"\U0001F3C4\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman surfing: light skin tone", "woman surfing: light skin tone"},
+{"\U0001F3C4\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman surfing: medium-light skin tone", "woman surfing: medium-light skin tone"},
+{"\U0001F3C4\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman surfing: medium skin tone", "woman surfing: medium skin tone"},
+{"\U0001F3C4\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman surfing: medium-dark skin tone", "woman surfing: medium-dark skin tone"},
+{"\U0001F3C4\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman surfing: dark skin tone", "woman surfing: dark skin tone"},
+{"\U0001F3CA\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman swimming: light skin tone", "woman swimming: light skin tone"},
+{"\U0001F3CA\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman swimming: medium-light skin tone", "woman swimming: medium-light skin tone"},
+{"\U0001F3CA\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman swimming: medium skin tone", "woman swimming: medium skin tone"},
+{"\U0001F3CA\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman swimming: medium-dark skin tone", "woman swimming: medium-dark skin tone"},
+{"\U0001F3CA\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman swimming: dark skin tone", "woman swimming: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F3EB", "woman teacher: light skin tone", "woman teacher: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F3EB", "woman teacher: medium-light skin tone", "woman teacher: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F3EB", "woman teacher: medium skin tone", "woman teacher: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F3EB", "woman teacher: medium-dark skin tone", "woman teacher: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F3EB", "woman teacher: dark skin tone", "woman teacher: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F4BB", "woman technologist: light skin tone", "woman technologist: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F4BB", "woman technologist: medium-light skin tone", "woman technologist: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F4BB", "woman technologist: medium skin tone", "woman technologist: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F4BB", "woman technologist: medium-dark skin tone", "woman technologist: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F4BB", "woman technologist: dark skin tone", "woman technologist: dark skin tone"},
+{"\U0001F481\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman tipping hand: light skin tone", "woman tipping hand: light skin tone"},
+{"\U0001F481\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman tipping hand: medium-light skin tone", "woman tipping hand: medium-light skin tone"},
+{"\U0001F481\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman tipping hand: medium skin tone", "woman tipping hand: medium skin tone"},
+{"\U0001F481\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman tipping hand: medium-dark skin tone", "woman tipping hand: medium-dark skin tone"},
+{"\U0001F481\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman tipping hand: dark skin tone", "woman tipping hand: dark skin tone"},
+{"\U0001F9DB\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman vampire: light skin tone", "woman vampire: light skin tone"},
+{"\U0001F9DB\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman vampire: medium-light skin tone", "woman vampire: medium-light skin tone"},
+{"\U0001F9DB\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman vampire: medium skin tone", "woman vampire: medium skin tone"},
+{"\U0001F9DB\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman vampire: medium-dark skin tone", "woman vampire: medium-dark skin tone"},
+{"\U0001F9DB\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman vampire: dark skin tone", "woman vampire: dark skin tone"},
+{"\U0001F6B6\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman walking: light skin tone", "woman walking: light skin tone"},
+{"\U0001F6B6\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman walking: medium-light skin tone", "woman walking: medium-light skin tone"},
+{"\U0001F6B6\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman walking: medium skin tone", "woman walking: medium skin tone"},
+{"\U0001F6B6\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman walking: medium-dark skin tone", "woman walking: medium-dark skin tone"},
+{"\U0001F6B6\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman walking: dark skin tone", "woman walking: dark skin tone"},
+{"\U0001F473\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman wearing turban: light skin tone", "woman wearing turban: light skin tone"},
+{"\U0001F473\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman wearing turban: medium-light skin tone", "woman wearing turban: medium-light skin tone"},
+{"\U0001F473\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman wearing turban: medium skin tone", "woman wearing turban: medium skin tone"},
+{"\U0001F473\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman wearing turban: medium-dark skin tone", "woman wearing turban: medium-dark skin tone"},
+{"\U0001F473\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman wearing turban: dark skin tone", "woman wearing turban: dark skin tone"},
+{"\U0001F9D5\U0001F3FB", "woman_with_headscarf_tone1", "woman with headscarf: light skin tone"},
+{"\U0001F9D5\U0001F3FC", "woman_with_headscarf_tone2", "woman with headscarf: medium-light skin tone"},
+{"\U0001F9D5\U0001F3FD", "woman_with_headscarf_tone3", "woman with headscarf: medium skin tone"},
+{"\U0001F9D5\U0001F3FE", "woman_with_headscarf_tone4", "woman with headscarf: medium-dark skin tone"},
+{"\U0001F9D5\U0001F3FF", "woman_with_headscarf_tone5", "woman with headscarf: dark skin tone"},
+{"\U0001F470\U0001F3FB\U0000200D\U00002640\U0000FE0F", "woman with veil: light skin tone", "woman with veil: light skin tone"},
+{"\U0001F470\U0001F3FC\U0000200D\U00002640\U0000FE0F", "woman with veil: medium-light skin tone", "woman with veil: medium-light skin tone"},
+{"\U0001F470\U0001F3FD\U0000200D\U00002640\U0000FE0F", "woman with veil: medium skin tone", "woman with veil: medium skin tone"},
+{"\U0001F470\U0001F3FE\U0000200D\U00002640\U0000FE0F", "woman with veil: medium-dark skin tone", "woman with veil: medium-dark skin tone"},
+{"\U0001F470\U0001F3FF\U0000200D\U00002640\U0000FE0F", "woman with veil: dark skin tone", "woman with veil: dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F9AF", "woman with white cane: light skin tone", "woman with white cane: light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F9AF", "woman with white cane: medium-light skin tone", "woman with white cane: medium-light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F9AF", "woman with white cane: medium skin tone", "woman with white cane: medium skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F9AF", "woman with white cane: medium-dark skin tone", "woman with white cane: medium-dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F9AF", "woman with white cane: dark skin tone", "woman with white cane: dark skin tone"},
+{"\U0001F46D\U0001F3FB", "women holding hands: light skin tone", "women holding hands: light skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FC", "women holding hands: light skin tone, medium-light skin tone", "women holding hands: light skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FD", "women holding hands: light skin tone, medium skin tone", "women holding hands: light skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FE", "women holding hands: light skin tone, medium-dark skin tone", "women holding hands: light skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FB\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FF", "women holding hands: light skin tone, dark skin tone", "women holding hands: light skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FB", "women holding hands: medium-light skin tone, light skin tone", "women holding hands: medium-light skin tone, light skin tone"},
+{"\U0001F46D\U0001F3FC", "women holding hands: medium-light skin tone", "women holding hands: medium-light skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FD", "women holding hands: medium-light skin tone, medium skin tone", "women holding hands: medium-light skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FE", "women holding hands: medium-light skin tone, medium-dark skin tone", "women holding hands: medium-light skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FC\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FF", "women holding hands: medium-light skin tone, dark skin tone", "women holding hands: medium-light skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FB", "women holding hands: medium skin tone, light skin tone", "women holding hands: medium skin tone, light skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FC", "women holding hands: medium skin tone, medium-light skin tone", "women holding hands: medium skin tone, medium-light skin tone"},
+{"\U0001F46D\U0001F3FD", "women holding hands: medium skin tone", "women holding hands: medium skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FE", "women holding hands: medium skin tone, medium-dark skin tone", "women holding hands: medium skin tone, medium-dark skin tone"},
+{"\U0001F469\U0001F3FD\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FF", "women holding hands: medium skin tone, dark skin tone", "women holding hands: medium skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FB", "women holding hands: medium-dark skin tone, light skin tone", "women holding hands: medium-dark skin tone, light skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FC", "women holding hands: medium-dark skin tone, medium-light skin tone", "women holding hands: medium-dark skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FD", "women holding hands: medium-dark skin tone, medium skin tone", "women holding hands: medium-dark skin tone, medium skin tone"},
+{"\U0001F46D\U0001F3FE", "women holding hands: medium-dark skin tone", "women holding hands: medium-dark skin tone"},
+{"\U0001F469\U0001F3FE\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FF", "women holding hands: medium-dark skin tone, dark skin tone", "women holding hands: medium-dark skin tone, dark skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FB", "women holding hands: dark skin tone, light skin tone", "women holding hands: dark skin tone, light skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FC", "women holding hands: dark skin tone, medium-light skin tone", "women holding hands: dark skin tone, medium-light skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FD", "women holding hands: dark skin tone, medium skin tone", "women holding hands: dark skin tone, medium skin tone"},
+{"\U0001F469\U0001F3FF\U0000200D\U0001F91D\U0000200D\U0001F469\U0001F3FE", "women holding hands: dark skin tone, medium-dark skin tone", "women holding hands: dark skin tone, medium-dark skin tone"},
+{"\U0001F46D\U0001F3FF", "women holding hands: dark skin tone", "women holding hands: dark skin tone"},
+{"\U0000270D\U0001F3FB", "writing_hand_tone1", "writing hand: light skin tone"},
+{"\U0000270D\U0001F3FC", "writing_hand_tone2", "writing hand: medium-light skin tone"},
+{"\U0000270D\U0001F3FD", "writing_hand_tone3", "writing hand: medium skin tone"},
+{"\U0000270D\U0001F3FE", "writing_hand_tone4", "writing hand: medium-dark skin tone"},
+{"\U0000270D\U0001F3FF", "writing_hand_tone5", "writing hand: dark skin tone"},
+};
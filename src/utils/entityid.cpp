@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "utils/entityid.h"
+
+#include <QJsonValue>
+
+#include <limits>
+
+EntityId::EntityId(const QString &id)
+{
+    // Only canonical numbers, anything else (like leading zeroes) has to round trip as-is
+    const bool canonical = !id.isEmpty() && id.size() <= 20 && (id.size() == 1 || id.front() != u'0');
+
+    quint64 number = 0;
+    bool numeric = canonical;
+    for (qsizetype i = 0; numeric && i < id.size(); i++) {
+        const char16_t c = id[i].unicode();
+        if (c < u'0' || c > u'9') {
+            numeric = false;
+            break;
+        }
+
+        const quint64 digit = c - u'0';
+        if (number > (std::numeric_limits<quint64>::max() - digit) / 10) {
+            numeric = false;
+            break;
+        }
+        number = number * 10 + digit;
+    }
+
+    if (numeric) {
+        m_number = number;
+        m_numeric = true;
+    } else {
+        m_string = id;
+    }
+}
+
+EntityId EntityId::fromJson(const QJsonValue &value)
+{
+    if (value.isDouble()) {
+        return EntityId(QString::number(value.toInteger()));
+    }
+
+    return EntityId(value.toString());
+}
+
+bool EntityId::isNull() const
+{
+    return !m_numeric && m_string.isEmpty();
+}
+
+bool EntityId::isNumeric() const
+{
+    return m_numeric;
+}
+
+quint64 EntityId::toUInt64() const
+{
+    return m_number;
+}
+
+QString EntityId::toString() const
+{
+    return m_numeric ? QString::number(m_number) : m_string;
+}
+
+qsizetype EntityId::length() const
+{
+    if (!m_numeric) {
+        return m_string.size();
+    }
+
+    qsizetype digits = 1;
+    for (quint64 number = m_number; number >= 10; number /= 10) {
+        digits++;
+    }
+    return digits;
+}
+
+int EntityId::compare(const EntityId &other) const
+{
+    if (m_numeric && other.m_numeric) {
+        return m_number < other.m_number ? -1 : (m_number > other.m_number ? 1 : 0);
+    }
+
+    // Longer ids are newer, for both numbers and the flake ids other servers use
+    const qsizetype ownLength = length();
+    const qsizetype otherLength = other.length();
+    if (ownLength != otherLength) {
+        return ownLength < otherLength ? -1 : 1;
+    }
+
+    const int result = QString::compare(toString(), other.toString(), Qt::CaseSensitive);
+    return result < 0 ? -1 : (result > 0 ? 1 : 0);
+}
+
+bool EntityId::operator==(const EntityId &other) const
+{
+    return m_numeric == other.m_numeric && (m_numeric ? m_number == other.m_number : m_string == other.m_string);
+}
+
+bool EntityId::operator!=(const EntityId &other) const
+{
+    return !(*this == other);
+}
+
+bool EntityId::operator<(const EntityId &other) const
+{
+    return compare(other) < 0;
+}
+
+bool EntityId::operator>(const EntityId &other) const
+{
+    return compare(other) > 0;
+}
+
+bool EntityId::operator<=(const EntityId &other) const
+{
+    return compare(other) <= 0;
+}
+
+bool EntityId::operator>=(const EntityId &other) const
+{
+    return compare(other) >= 0;
+}
@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QHashFunctions>
+#include <QString>
+
+class QJsonValue;
+
+/**
+ * @brief The id of a status, notification or account.
+ *
+ * Mastodon ids are numbers sent as strings, which are only kept as a 64-bit integer here. They compare and hash numerically, so "99" comes before
+ * "100" unlike with a string comparison, and don't need a string allocation each. Other servers may use ids that aren't numbers (like Pleroma's flake
+ * ids), which are kept as strings and ordered by length first, then alphabetically.
+ */
+class EntityId
+{
+public:
+    EntityId() = default;
+
+    /**
+     * @brief Parses the id @p id.
+     */
+    explicit EntityId(const QString &id);
+
+    /**
+     * @brief Parses an id from JSON, which is usually a string but some servers send numbers.
+     */
+    static EntityId fromJson(const QJsonValue &value);
+
+    /**
+     * @return If this is an empty id.
+     */
+    bool isNull() const;
+
+    /**
+     * @return If this id is a number, in which case toUInt64() returns it.
+     */
+    bool isNumeric() const;
+
+    /**
+     * @return The id as a number, or 0 if it isn't one.
+     */
+    quint64 toUInt64() const;
+
+    /**
+     * @return The id as sent by the server, which is formatted again for numeric ids.
+     */
+    QString toString() const;
+
+    /**
+     * @return A negative number if this id comes before @p other, a positive one if it comes after, or zero if they're equal.
+     */
+    int compare(const EntityId &other) const;
+
+    bool operator==(const EntityId &other) const;
+    bool operator!=(const EntityId &other) const;
+    bool operator<(const EntityId &other) const;
+    bool operator>(const EntityId &other) const;
+    bool operator<=(const EntityId &other) const;
+    bool operator>=(const EntityId &other) const;
+
+    friend size_t qHash(const EntityId &id, size_t seed = 0) noexcept
+    {
+        return id.m_numeric ? qHash(id.m_number, seed) : qHash(id.m_string, seed);
+    }
+
+private:
+    qsizetype length() const;
+
+    QString m_string; // Only set for ids that aren't numbers
+    quint64 m_number = 0;
+    bool m_numeric = false;
+};
+
+Q_DECLARE_TYPEINFO(EntityId, Q_RELOCATABLE_TYPE);
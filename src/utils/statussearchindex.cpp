@@ -0,0 +1,358 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "utils/statussearchindex.h"
+
+#include "utils/entityid.h"
+
+#include <QDataStream>
+#include <QIODevice>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QRegularExpression>
+
+#include <algorithm>
+
+using namespace Qt::Literals::StringLiterals;
+
+namespace
+{
+// Written at the start of a saved index, the version has to be bumped whenever the format or what's indexed changes
+constexpr quint32 fileMagic = 0x544b5349;
+constexpr quint32 fileVersion = 1;
+
+struct Clause {
+    QStringList words;
+    bool phrase = false;
+};
+
+QList<Clause> parseQuery(QStringView query)
+{
+    QList<Clause> clauses;
+
+    // Every other part is in quotes
+    const auto parts = query.split(u'"');
+    for (qsizetype i = 0; i < parts.size(); i++) {
+        const QStringList words = StatusSearchIndex::words(parts[i]);
+        if (words.isEmpty()) {
+            continue;
+        }
+
+        if (i % 2 == 1) {
+            clauses.push_back({words, words.size() > 1});
+        } else {
+            for (const auto &word : words) {
+                clauses.push_back({{word}, false});
+            }
+        }
+    }
+
+    return clauses;
+}
+}
+
+StatusSearchIndex::StatusSearchIndex(qsizetype capacity)
+    : m_capacity(capacity)
+{
+}
+
+void StatusSearchIndex::add(const QJsonObject &status)
+{
+    const QJsonObject original = status["reblog"_L1].isObject() ? status["reblog"_L1].toObject() : status;
+    const QString id = original["id"_L1].toString();
+    if (id.isEmpty()) {
+        return;
+    }
+
+    if (original["visibility"_L1].toString() == "direct"_L1) {
+        remove(id);
+        return;
+    }
+
+    QStringList text{
+        plainText(original["content"_L1].toString()),
+        original["spoiler_text"_L1].toString(),
+    };
+
+    const auto account = original["account"_L1].toObject();
+    text.push_back(account["display_name"_L1].toString());
+    text.push_back(account["acct"_L1].toString());
+
+    const auto tags = original["tags"_L1].toArray();
+    for (const auto &tag : tags) {
+        text.push_back(tag.toObject()["name"_L1].toString());
+    }
+
+    const auto attachments = original["media_attachments"_L1].toArray();
+    for (const auto &attachment : attachments) {
+        text.push_back(attachment.toObject()["description"_L1].toString());
+    }
+
+    const auto options = original["poll"_L1].toObject()["options"_L1].toArray();
+    for (const auto &option : options) {
+        text.push_back(option.toObject()["title"_L1].toString());
+    }
+
+    // An edited status is indexed again, and counts as new
+    remove(id);
+
+    const quint32 number = m_nextNumber++;
+    Document document{id, words(text.join(u'\n')).join(u' '), qCompress(QJsonDocument(original).toJson(QJsonDocument::Compact))};
+    addPostings(number, document.words);
+    m_numbers.insert(id, number);
+    m_documents.insert(number, std::move(document));
+
+    while (m_documents.size() > m_capacity) {
+        removeDocument(m_documents.firstKey());
+    }
+}
+
+void StatusSearchIndex::remove(const QString &statusId)
+{
+    const auto it = m_numbers.constFind(statusId);
+    if (it != m_numbers.cend()) {
+        removeDocument(*it);
+    }
+}
+
+QList<QJsonObject> StatusSearchIndex::search(QStringView query, qsizetype limit) const
+{
+    const QList<Clause> clauses = parseQuery(query);
+    if (clauses.isEmpty() || limit <= 0) {
+        return {};
+    }
+
+    // Narrow down to the documents that contain every word, rarest first would be faster but the lists are short enough
+    QList<quint32> candidates;
+    bool first = true;
+    for (const auto &clause : clauses) {
+        for (qsizetype i = 0; i < clause.words.size(); i++) {
+            // Words in a phrase have to match in full, except for the last one which may still be typed
+            const bool prefix = !clause.phrase || i == clause.words.size() - 1;
+            const QList<quint32> documents = postings(clause.words[i], prefix);
+
+            if (first) {
+                candidates = documents;
+                first = false;
+            } else {
+                QList<quint32> intersection;
+                std::set_intersection(candidates.cbegin(), candidates.cend(), documents.cbegin(), documents.cend(), std::back_inserter(intersection));
+                candidates = std::move(intersection);
+            }
+
+            if (candidates.isEmpty()) {
+                return {};
+            }
+        }
+    }
+
+    QList<const Document *> matches;
+    for (const quint32 number : std::as_const(candidates)) {
+        const Document &document = *m_documents.constFind(number);
+        const QString words = u' ' + document.words;
+
+        const bool phrasesMatch = std::all_of(clauses.cbegin(), clauses.cend(), [&words](const Clause &clause) {
+            return !clause.phrase || words.contains(u' ' + clause.words.join(u' '));
+        });
+        if (phrasesMatch) {
+            matches.push_back(&document);
+        }
+    }
+
+    std::sort(matches.begin(), matches.end(), [](const Document *left, const Document *right) {
+        return EntityId(left->id) > EntityId(right->id);
+    });
+
+    QList<QJsonObject> statuses;
+    for (qsizetype i = 0; i < matches.size() && i < limit; i++) {
+        statuses.push_back(QJsonDocument::fromJson(qUncompress(matches[i]->status)).object());
+    }
+
+    return statuses;
+}
+
+qsizetype StatusSearchIndex::size() const
+{
+    return m_documents.size();
+}
+
+void StatusSearchIndex::save(QIODevice *device) const
+{
+    QDataStream stream(device);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    stream << fileMagic << fileVersion << m_nextNumber << static_cast<quint32>(m_documents.size());
+    for (auto it = m_documents.cbegin(); it != m_documents.cend(); ++it) {
+        stream << it.key() << it->id << it->words << it->status;
+    }
+    stream << m_postings;
+}
+
+bool StatusSearchIndex::load(QIODevice *device)
+{
+    m_nextNumber = 0;
+    m_documents.clear();
+    m_numbers.clear();
+    m_postings.clear();
+
+    QDataStream stream(device);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    quint32 count = 0;
+    stream >> magic >> version;
+    if (magic != fileMagic || version != fileVersion) {
+        return false;
+    }
+
+    stream >> m_nextNumber >> count;
+    for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; i++) {
+        quint32 number = 0;
+        Document document;
+        stream >> number >> document.id >> document.words >> document.status;
+        m_numbers.insert(document.id, number);
+        m_documents.insert(number, std::move(document));
+    }
+    stream >> m_postings;
+
+    if (stream.status() != QDataStream::Ok) {
+        m_nextNumber = 0;
+        m_documents.clear();
+        m_numbers.clear();
+        m_postings.clear();
+        return false;
+    }
+
+    // The capacity may have been lowered since
+    while (m_documents.size() > m_capacity) {
+        removeDocument(m_documents.firstKey());
+    }
+
+    return true;
+}
+
+QStringList StatusSearchIndex::words(QStringView text)
+{
+    // Decomposing first splits accented letters into the letter and the accent, which is then skipped
+    const QString decomposed = text.toString().normalized(QString::NormalizationForm_KD);
+
+    QStringList words;
+    QString word;
+    for (const QChar c : decomposed) {
+        if (c.category() == QChar::Mark_NonSpacing) {
+            continue;
+        }
+
+        if (c.isLetterOrNumber()) {
+            word += c.toLower();
+        } else if (!word.isEmpty()) {
+            words.push_back(word);
+            word.clear();
+        }
+    }
+
+    if (!word.isEmpty()) {
+        words.push_back(word);
+    }
+
+    return words;
+}
+
+QString StatusSearchIndex::plainText(const QString &html)
+{
+    static const QRegularExpression tagExp(QStringLiteral("<[^>]*>"));
+    static const QRegularExpression entityExp(QStringLiteral("&(#[0-9]+|#[xX][0-9a-fA-F]+|[a-zA-Z]+);"));
+
+    // Tags are replaced by a space, so paragraphs and line breaks still separate words
+    QString text = html;
+    text.replace(tagExp, QStringLiteral(" "));
+
+    QString result;
+    result.reserve(text.size());
+    qsizetype last = 0;
+    auto it = entityExp.globalMatch(text);
+    while (it.hasNext()) {
+        const auto match = it.next();
+        result += QStringView(text).sliced(last, match.capturedStart() - last);
+        last = match.capturedEnd();
+
+        const QString entity = match.captured(1);
+        if (entity.startsWith(u'#')) {
+            const bool hex = entity.size() > 1 && (entity[1] == u'x' || entity[1] == u'X');
+            const char32_t codePoint = entity.mid(hex ? 2 : 1).toUInt(nullptr, hex ? 16 : 10);
+            result += QString::fromUcs4(&codePoint, 1);
+        } else if (entity == "amp"_L1) {
+            result += u'&';
+        } else if (entity == "lt"_L1) {
+            result += u'<';
+        } else if (entity == "gt"_L1) {
+            result += u'>';
+        } else if (entity == "quot"_L1) {
+            result += u'"';
+        } else if (entity == "apos"_L1) {
+            result += u'\'';
+        } else {
+            result += u' ';
+        }
+    }
+    result += QStringView(text).sliced(last);
+
+    return result;
+}
+
+QList<quint32> StatusSearchIndex::postings(const QString &word, bool prefix) const
+{
+    if (!prefix) {
+        return m_postings.value(word);
+    }
+
+    QList<quint32> documents;
+    for (auto it = m_postings.lowerBound(word); it != m_postings.cend() && it.key().startsWith(word); ++it) {
+        documents.append(*it);
+    }
+
+    std::sort(documents.begin(), documents.end());
+    documents.erase(std::unique(documents.begin(), documents.end()), documents.end());
+
+    return documents;
+}
+
+void StatusSearchIndex::addPostings(quint32 number, const QString &words)
+{
+    const auto list = QStringView(words).split(u' ', Qt::SkipEmptyParts);
+    for (const auto word : list) {
+        // Each new document has the highest number so far, so the lists stay sorted
+        auto &documents = m_postings[word.toString()];
+        if (documents.isEmpty() || documents.constLast() != number) {
+            documents.push_back(number);
+        }
+    }
+}
+
+void StatusSearchIndex::removeDocument(quint32 number)
+{
+    const auto it = m_documents.find(number);
+    if (it == m_documents.end()) {
+        return;
+    }
+
+    const auto list = QStringView(it->words).split(u' ', Qt::SkipEmptyParts);
+    for (const auto word : list) {
+        const auto postings = m_postings.find(word.toString());
+        if (postings == m_postings.end()) {
+            continue;
+        }
+
+        const auto position = std::lower_bound(postings->begin(), postings->end(), number);
+        if (position != postings->end() && *position == number) {
+            postings->erase(position);
+        }
+        if (postings->isEmpty()) {
+            m_postings.erase(postings);
+        }
+    }
+
+    m_numbers.remove(it->id);
+    m_documents.erase(it);
+}
@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QHash>
+#include <QJsonObject>
+#include <QList>
+#include <QMap>
+#include <QString>
+
+class QIODevice;
+
+/**
+ * @brief A full-text index over statuses, so the ones the user has already seen can be searched without asking the server.
+ *
+ * The text, content warning, author, hashtags, poll options and media descriptions of each status are split into words, which are folded to lowercase
+ * without accents. Every word maps to the statuses containing it, and the words are kept sorted so a query word matches every word it's a prefix of.
+ * Once there are more statuses than the capacity, the ones that were added the longest ago are dropped.
+ *
+ * This isn't thread-safe, see StatusIndex for using it in the background.
+ */
+class StatusSearchIndex
+{
+public:
+    static constexpr qsizetype defaultCapacity = 5000;
+
+    /**
+     * @param capacity How many statuses to keep before dropping the oldest.
+     */
+    explicit StatusSearchIndex(qsizetype capacity = defaultCapacity);
+
+    /**
+     * @brief Adds @p status, replacing it if it's already indexed. Boosts are indexed as the status they boost.
+     *
+     * Direct messages aren't indexed, since the index is saved to disk.
+     */
+    void add(const QJsonObject &status);
+
+    /**
+     * @brief Removes the status with the id @p statusId, if it's indexed.
+     */
+    void remove(const QString &statusId);
+
+    /**
+     * @return At most @p limit statuses matching @p query, newest first.
+     *
+     * Every word of @p query has to be the start of a word in the status. Words in double quotes have to appear next to each other in that order.
+     */
+    QList<QJsonObject> search(QStringView query, qsizetype limit) const;
+
+    /**
+     * @return The number of indexed statuses.
+     */
+    qsizetype size() const;
+
+    /**
+     * @brief Writes the index to @p device.
+     */
+    void save(QIODevice *device) const;
+
+    /**
+     * @brief Replaces the index with one written by save() to @p device.
+     * @return If it could be read, otherwise the index is left empty.
+     */
+    bool load(QIODevice *device);
+
+    /**
+     * @return The searchable words of @p text, in lowercase and without accents.
+     */
+    static QStringList words(QStringView text);
+
+    /**
+     * @return @p html as plain text.
+     */
+    static QString plainText(const QString &html);
+
+private:
+    struct Document {
+        QString id;
+        QString words; // All searchable words, separated by spaces
+        QByteArray status; // Compressed JSON
+    };
+
+    QList<quint32> postings(const QString &word, bool prefix) const;
+    void addPostings(quint32 number, const QString &words);
+    void removeDocument(quint32 number);
+
+    qsizetype m_capacity;
+    quint32 m_nextNumber = 0;
+    QMap<quint32, Document> m_documents; // Oldest first
+    QHash<QString, quint32> m_numbers;
+    QMap<QString, QList<quint32>> m_postings; // The documents containing each word, in ascending order
+};
@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "utils/stringpool.h"
+
+#include <QMutex>
+#include <QSet>
+
+QString StringPool::intern(const QString &string)
+{
+    // Enough for the catalogs of a few instances, it's cleared when full so it can't grow forever
+    constexpr qsizetype maximumInternedStrings = 16384;
+
+    if (string.isEmpty()) {
+        return {};
+    }
+
+    static QMutex mutex;
+    static QSet<QString> strings;
+
+    QMutexLocker locker(&mutex);
+    if (strings.size() >= maximumInternedStrings) {
+        strings.clear();
+    }
+
+    return *strings.insert(string);
+}
@@ -0,0 +1,20 @@
+// SPDX-FileCopyrightText: 2024 Joshua Goins <josh@redstrate.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <QString>
+
+/**
+ * @brief Shares one copy of strings that repeat across many objects.
+ *
+ * Things like languages, provider names and emoji shortcodes only take a handful of distinct values, but are stored once per post otherwise.
+ */
+class StringPool
+{
+public:
+    /**
+     * @return A string equal to @p string, sharing its data with every other interned copy.
+     */
+    static QString intern(const QString &string);
+};
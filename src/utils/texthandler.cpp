@@ -4,6 +4,8 @@
 
 #include "utils/texthandler.h"
 
+#include "utils/customemojiimageprovider.h"
+
 #include <QQuickTextDocument>
 #include <QTextBlock>
 #include <QTextCursor>
@@ -118,11 +120,45 @@ QPair<QString, QList<QString>> TextHandler::removeStandaloneTags(QString content
 
 QString TextHandler::replaceCustomEmojis(const QList<CustomEmoji> &emojis, const QString &source)
 {
-    QString processed = source;
+    if (emojis.isEmpty()) {
+        return source;
+    }
+
+    QHash<QStringView, const CustomEmoji *> emojisByShortcode;
+    emojisByShortcode.reserve(emojis.size());
     for (const auto &emoji : emojis) {
-        processed = processed.replace(QLatin1Char(':') + emoji.shortcode + QLatin1Char(':'),
-                                      QStringLiteral("<img height=\"16\" align=\"middle\" width=\"16\" src=\"") + emoji.url + QStringLiteral("\">"));
+        if (!emojisByShortcode.contains(emoji.shortcode)) {
+            emojisByShortcode.insert(emoji.shortcode, &emoji);
+        }
+    }
+
+    // Look up each :shortcode: in a single pass, instead of searching the whole text once per emoji
+    QString processed;
+    qsizetype start = 0;
+    qsizetype colon = source.indexOf(u':');
+    while (colon != -1) {
+        const qsizetype nextColon = source.indexOf(u':', colon + 1);
+        if (nextColon == -1) {
+            break;
+        }
+
+        const auto emoji = emojisByShortcode.value(QStringView(source).sliced(colon + 1, nextColon - colon - 1));
+        if (emoji == nullptr) {
+            // The second colon could still start a shortcode
+            colon = nextColon;
+            continue;
+        }
+
+        processed += QStringView(source).sliced(start, colon - start);
+        processed += u"<img height=\"16\" align=\"middle\" width=\"16\" src=\""_s + CustomEmojiImageProvider::imageSource(emoji->url) + u"\">"_s;
+        start = nextColon + 1;
+        colon = source.indexOf(u':', start);
+    }
+
+    if (start == 0) {
+        return source;
     }
+    processed += QStringView(source).sliced(start);
 
     return processed;
 }
@@ -44,6 +44,8 @@ tones_file.write("// SPDX-License-Identifier: LGPL-2.0-or-later\n")
 tones_file.write("// This file is auto-generated. All changes will be lost. See tools/update-emojis.py\n")
 tones_file.write("// clang-format off\n")
 
+groups = {}
+tones = []
 for line in response.text.split("\n"):
     if line.startswith("# group"):
         raw_group = line.split(": ")[1]
@@ -91,12 +93,27 @@ for line in response.text.split("\n"):
         if escaped_sequence in emoji_unicode_shortname_map:
             shortcode = emoji_unicode_shortname_map[escaped_sequence]
 
-        emoji_args = 'QString::fromUtf8("{0}"), QStringLiteral("{1}"), QStringLiteral("{2}")'.format(escaped_sequence, shortcode, description)
-        emoji_qvariant = 'QVariant::fromValue(Emoji{' + emoji_args + '})'
+        emoji_data = '{{"{0}", "{1}", "{2}"}}'.format(escaped_sequence, shortcode, description)
 
         if is_skin_tone:
-            tones_file.write("{\"" + description.split(":")[0] + "\", " + emoji_qvariant + "},\n")
+            tones.append((description.split(":")[0], emoji_data))
             continue
-        file.write("_emojis[" + group + "].append(" + emoji_qvariant + ");\n")
+        if group not in groups:
+            groups[group] = []
+        groups[group].append(emoji_data)
+
+# These are plain constexpr arrays, so they end up in read-only data instead of being constructed at startup
+for (group, emojis) in groups.items():
+    file.write("constexpr EmojiData " + group.lower() + "Emojis[] = {\n")
+    for emoji_data in emojis:
+        file.write(emoji_data + ",\n")
+    file.write("};\n")
 file.close()
+
+# Sorted by the base emoji, so its tones can be looked up with a binary search. The sort is stable to keep the tones in order.
+tones.sort(key=lambda tone: tone[0].encode("utf-8"))
+tones_file.write("constexpr EmojiData emojiTones[] = {\n")
+for (base, emoji_data) in tones:
+    tones_file.write(emoji_data + ",\n")
+tones_file.write("};\n")
 tones_file.close()